@@ -1,3 +1,4 @@
+#include <cstdint>
 #include <cstdio>
 
 #include <Kernels/Time.h>
@@ -33,7 +34,7 @@ int main()
   nonZeroFlops += kernelNonZeroFlops;
   hardwareFlops += kernelHardwareFlops;
   
-  int faceRelations[4][2];
+  std::int8_t faceRelations[4][2];
   CellDRMapping dummyDRMapping[4];
 
   unsigned numConfs = 12*12*12*12;
@@ -11,12 +11,14 @@ kernels_options = pb.Aux.get_allowed_kernels()
 parser.add_argument('-c', '--cells', default=100000, type=int, help="num cells in a time cluster")
 parser.add_argument('-t', '--timesteps', default=20, type=int, help="num time steps/repeats")
 parser.add_argument('-k', '--kernel', default='all', choices=kernels_options, type=str, help="kernel types")
+parser.add_argument('-s', '--statistics', default='', type=str, help="cluster statistics of a SeisSol run (kernel lts)")
 args = parser.parse_args()
 
 config = pb.ProxyConfig()
 config.cells = args.cells
 config.timesteps = args.timesteps
 config.kernel = pb.Aux.str_to_kernel(args.kernel)
+config.cluster_statistics = args.statistics
 
 output = pb.run_proxy(config)
 pb.Aux.display_output(output, args.kernel)
@@ -13,6 +13,13 @@ PYBIND11_MODULE(seissol_proxy_bindings, module) {
       .value("localwoader", Kernel::localwoader)
       .value("neigh_dr", Kernel::neigh_dr)
       .value("godunov_dr", Kernel::godunov_dr)
+      .value("friction_dr", Kernel::friction_dr)
+      .value("plasticity", Kernel::plasticity)
+      .value("boundary", Kernel::boundary)
+      .value("sources", Kernel::sources)
+      .value("receivers", Kernel::receivers)
+      .value("taylor", Kernel::taylor)
+      .value("lts", Kernel::lts)
       .export_values();
 
   py::class_<ProxyConfig>(module, "ProxyConfig")
@@ -20,7 +27,8 @@ PYBIND11_MODULE(seissol_proxy_bindings, module) {
       .def_readwrite("cells", &ProxyConfig::cells)
       .def_readwrite("timesteps", &ProxyConfig::timesteps)
       .def_readwrite("kernel", &ProxyConfig::kernel)
-      .def_readwrite("verbose", &ProxyConfig::verbose);
+      .def_readwrite("verbose", &ProxyConfig::verbose)
+      .def_readwrite("cluster_statistics", &ProxyConfig::clusterStatistics);
 
   py::class_<ProxyOutput>(module, "ProxyOutput")
       .def(py::init<>())
@@ -37,7 +45,8 @@ PYBIND11_MODULE(seissol_proxy_bindings, module) {
       .def_readwrite("bytes_per_cycle", &ProxyOutput::bytesPerCycle)
       .def_readwrite("non_zero_gflops", &ProxyOutput::nonZeroGFlops)
       .def_readwrite("hardware_gflops", &ProxyOutput::hardwareGFlops)
-      .def_readwrite("gib_per_second", &ProxyOutput::gibPerSecond);
+      .def_readwrite("gib_per_second", &ProxyOutput::gibPerSecond)
+      .def_readwrite("time_per_simulated_second", &ProxyOutput::timePerSimulatedSecond);
 
   py::class_<Aux>(module, "Aux")
       .def(py::init<>())
@@ -13,7 +13,14 @@ enum Kernel {
   ader,
   localwoader,
   neigh_dr,
-  godunov_dr
+  godunov_dr,
+  friction_dr,
+  plasticity,
+  boundary,
+  sources,
+  receivers,
+  taylor,
+  lts
 };
 
 struct ProxyConfig {
@@ -21,6 +28,8 @@ struct ProxyConfig {
   unsigned timesteps{10};
   Kernel kernel{Kernel::all};
   bool verbose{true};
+  //! cluster statistics of a SeisSol run (SEISSOL_CLUSTER_STATISTICS_PREFIX), replayed by the kernel lts
+  std::string clusterStatistics{};
 };
 
 struct ProxyOutput{
@@ -38,6 +47,8 @@ struct ProxyOutput{
   double nonZeroGFlops{};
   double hardwareGFlops{};
   double gibPerSecond{};
+  //! kernel lts: wall time per simulated second
+  double timePerSimulatedSecond{};
 };
 
 ProxyOutput runProxy(ProxyConfig config);
@@ -87,6 +98,9 @@ struct Aux {
     printf("GFLOPS (non-zero) for seissol proxy : %f\n",   output.nonZeroGFlops);
     printf("GFLOPS (hardware) for seissol proxy : %f\n",   output.hardwareGFlops);
     printf("GiB/s (estimate) for seissol proxy  : %f\n",   output.gibPerSecond);
+    if (output.timePerSimulatedSecond > 0.0) {
+      printf("time per simulated second           : %f\n",   output.timePerSimulatedSecond);
+    }
     printf("=================================================\n");
     printf("\n");
   }
@@ -99,7 +113,14 @@ protected:
       {Kernel::ader,        "ader"},
       {Kernel::localwoader, "localwoader"},
       {Kernel::neigh_dr,    "neigh_dr"},
-      {Kernel::godunov_dr,  "godunov_dr"}
+      {Kernel::godunov_dr,  "godunov_dr"},
+      {Kernel::friction_dr, "friction_dr"},
+      {Kernel::plasticity,  "plasticity"},
+      {Kernel::boundary,    "boundary"},
+      {Kernel::sources,     "sources"},
+      {Kernel::receivers,   "receivers"},
+      {Kernel::taylor,      "taylor"},
+      {Kernel::lts,         "lts"}
   };
 
   inline static std::unordered_map<std::string, Kernel> invMap{
@@ -109,7 +130,14 @@ protected:
       {"ader", Kernel::ader},
       {"localwoader", Kernel::localwoader},
       {"neigh_dr", Kernel::neigh_dr},
-      {"godunov_dr", Kernel::godunov_dr}
+      {"godunov_dr", Kernel::godunov_dr},
+      {"friction_dr", Kernel::friction_dr},
+      {"plasticity", Kernel::plasticity},
+      {"boundary", Kernel::boundary},
+      {"sources", Kernel::sources},
+      {"receivers", Kernel::receivers},
+      {"taylor", Kernel::taylor},
+      {"lts", Kernel::lts}
   };
 };
 
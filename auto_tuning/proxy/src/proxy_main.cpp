@@ -15,6 +15,8 @@ int main(int argc, char* argv[]) {
   args.addAdditionalOption("cells", "Number of cells");
   args.addAdditionalOption("timesteps", "Number of timesteps");
   args.addAdditionalOption("kernel", kernelHelp.str());
+  args.addOption("statistics", 's', "Cluster statistics of a SeisSol run (required by the kernel lts)",
+                 utils::Args::Required, false);
 
   if (args.parse(argc, argv) != utils::Args::Success) {
     return -1;
@@ -24,6 +26,7 @@ int main(int argc, char* argv[]) {
   config.cells = args.getAdditionalArgument<unsigned>("cells");
   config.timesteps = args.getAdditionalArgument<unsigned>("timesteps");
   auto kernelStr = args.getAdditionalArgument<std::string>("kernel");
+  config.clusterStatistics = args.getArgument<std::string>("statistics", "");
 
   try {
     config.kernel = Aux::str2kernel(kernelStr);
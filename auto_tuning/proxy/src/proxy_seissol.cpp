@@ -83,6 +83,7 @@ extern long long pspamm_num_total_flops;
 #include <Kernels/DynamicRupture.h>
 #include "utils/logger.h"
 #include <cassert>
+#include <fstream>
 
 // seissol_kernel includes
 #include "proxy_seissol_tools.hpp"
@@ -135,6 +136,43 @@ void testKernel(unsigned kernel, unsigned timesteps) {
         computeDynRupGodunovState();
       }
       break;
+#ifndef ACL_DEVICE
+    case friction_dr:
+      for (; t < timesteps; ++t) {
+        proxy::cpu::computeDynRupFrictionLaw();
+      }
+      break;
+    case plasticity:
+      for (; t < timesteps; ++t) {
+        proxy::cpu::computePlasticityIntegration();
+      }
+      break;
+    case boundary:
+      for (; t < timesteps; ++t) {
+        proxy::cpu::computeBoundaryIntegration();
+      }
+      break;
+    case sources:
+      for (; t < timesteps; ++t) {
+        proxy::cpu::computePointSources();
+      }
+      break;
+    case receivers:
+      for (; t < timesteps; ++t) {
+        proxy::cpu::computeReceivers();
+      }
+      break;
+    case taylor:
+      for (; t < timesteps; ++t) {
+        proxy::cpu::computeTaylorExpansion();
+      }
+      break;
+    case lts:
+      for (; t < timesteps; ++t) {
+        proxy::cpu::computeLtsIntegration();
+      }
+      break;
+#endif
     default:
       break;
   }
@@ -147,9 +185,19 @@ ProxyOutput runProxy(ProxyConfig config) {
   registerMarkers();
 
   bool enableDynamicRupture = false;
-  if (config.kernel == neigh_dr || config.kernel == godunov_dr) {
+  if (config.kernel == neigh_dr || config.kernel == godunov_dr || config.kernel == friction_dr) {
     enableDynamicRupture = true;
   }
+  const bool enableFrictionLaw = config.kernel == friction_dr;
+  const bool enablePlasticity = config.kernel == plasticity;
+
+#ifdef ACL_DEVICE
+  if (config.kernel == friction_dr || config.kernel == plasticity || config.kernel == boundary
+      || config.kernel == sources || config.kernel == receivers || config.kernel == taylor
+      || config.kernel == lts) {
+    throw std::runtime_error("The kernel " + Aux::kernel2str(config.kernel) + " is only available on the host.");
+  }
+#endif
 
 #ifdef ACL_DEVICE
   deviceT &device = deviceT::getInstance();
@@ -168,7 +216,38 @@ ProxyOutput runProxy(ProxyConfig config) {
     printf("Allocating fake data...\n");
 
   initGlobalData();
-  config.cells = initDataStructures(config.cells, enableDynamicRupture);
+  if (config.kernel == lts) {
+    std::ifstream statisticsFile(config.clusterStatistics);
+    if (!statisticsFile) {
+      throw std::runtime_error("The kernel lts requires the cluster statistics of a SeisSol run, could not open \""
+                               + config.clusterStatistics + "\"");
+    }
+    config.cells = initLtsDataStructures(seissol::initializers::time_stepping::parseClusterStatistics(statisticsFile));
+  } else {
+    config.cells = initDataStructures(config.cells, enableDynamicRupture, enableFrictionLaw, enablePlasticity);
+  }
+  switch (config.kernel) {
+    case friction_dr:
+      initFrictionLaw();
+      break;
+    case plasticity:
+      initPlasticity();
+      break;
+    case boundary:
+      initBoundaries();
+      break;
+    case sources:
+      initPointSources();
+      break;
+    case receivers:
+      initReceivers();
+      break;
+    case taylor:
+      initTaylorExpansion();
+      break;
+    default:
+      break;
+  }
 #ifdef ACL_DEVICE
   initDataStructuresOnDevice(enableDynamicRupture);
 #endif // ACL_DEVICE
@@ -185,7 +264,13 @@ ProxyOutput runProxy(ProxyConfig config) {
 
   // init OpenMP and LLC
   testKernel(config.kernel, 1);
-  
+  m_plasticityChecks = 0;
+  m_plasticityCandidates = 0;
+  m_plasticityYields = 0;
+  for (auto& cluster : m_clusters) {
+    cluster.time = 0.0;
+  }
+
   libxsmm_num_total_flops = 0;
   pspamm_num_total_flops = 0;
 
@@ -236,6 +321,32 @@ ProxyOutput runProxy(ProxyConfig config) {
       flop_fun = &flops_drgod_actual;
       bytes_fun = &noestimate;
       break;
+    case friction_dr:
+      // only the space-time interpolation, the flops of the friction law are not counted
+      flop_fun = &flops_drgod_actual;
+      bytes_fun = &noestimate;
+      break;
+    case plasticity:
+      flop_fun = &flops_plasticity_actual;
+      bytes_fun = &noestimate;
+      break;
+    case boundary:
+      flop_fun = &flops_local_actual;
+      bytes_fun = &noestimate;
+      break;
+    case sources:
+    case receivers:
+      flop_fun = &noflops;
+      bytes_fun = &noestimate;
+      break;
+    case taylor:
+      flop_fun = &flops_taylor_actual;
+      bytes_fun = &noestimate;
+      break;
+    case lts:
+      flop_fun = &flops_lts_actual;
+      bytes_fun = &noestimate;
+      break;
   }
  
 
@@ -260,7 +371,23 @@ ProxyOutput runProxy(ProxyConfig config) {
   output.nonZeroGFlops = (static_cast<double>(actual_flops.d_nonZeroFlops)  * 1.e-9)/total;
   output.hardwareGFlops = (static_cast<double>(actual_flops.d_hardwareFlops) * 1.e-9)/total;
   output.gibPerSecond = (bytes_estimate/(1024.0*1024.0*1024.0))/total;
+  if (config.kernel == lts) {
+    output.timePerSimulatedSecond = total / (config.timesteps * m_clusters.back().timeStepWidth);
+    if (config.verbose) {
+      printf("cluster  time step width  cells  dr faces  updates  time share\n");
+      for (unsigned tc = 0; tc < m_clusters.size(); ++tc) {
+        const unsigned cells = m_ltsTree->child(tc).child<Copy>().getNumberOfCells()
+                             + m_ltsTree->child(tc).child<Interior>().getNumberOfCells();
+        const unsigned drFaces = m_dynRupTree->child(tc).child<Copy>().getNumberOfCells()
+                               + m_dynRupTree->child(tc).child<Interior>().getNumberOfCells();
+        printf("%7u  %15e  %5u  %8u  %7u  %10f\n", m_clusters[tc].globalClusterId, m_clusters[tc].timeStepWidth,
+               cells, drFaces, m_clusters.back().stepTicks / m_clusters[tc].stepTicks, m_clusters[tc].time / total);
+      }
+      printf("\n");
+    }
+  }
 
+  freeKernelData();
   delete m_ltsTree;
   delete m_dynRupTree;
   delete m_allocator;
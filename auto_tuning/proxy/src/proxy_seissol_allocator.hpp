@@ -61,7 +61,18 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <Initializer/DynamicRupture.h>
 #include <Initializer/GlobalData.h>
 #include <Solver/time_stepping/MiniSeisSol.cpp>
+#include <DynamicRupture/Factory.h>
+#include <Initializer/time_stepping/ClusterStatistics.h>
+#include <Kernels/Plasticity.h>
+#include <Kernels/Receiver.h>
+#include <SourceTerm/PointSource.h>
+#include <SourceTerm/typedefs.hpp>
 #include <yateto.h>
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <numeric>
 #include <unordered_set>
 
 #ifdef ACL_DEVICE
@@ -75,6 +86,7 @@ seissol::initializers::LTSTree               *m_ltsTree{nullptr};
 seissol::initializers::LTS                   m_lts;
 seissol::initializers::LTSTree               *m_dynRupTree{nullptr};
 seissol::initializers::DynamicRupture        m_dynRup;
+seissol::dr::DRParameters                    m_drParameters;
 
 GlobalData m_globalDataOnHost;
 GlobalData m_globalDataOnDevice;
@@ -88,6 +100,34 @@ seissol::kernels::DynamicRupture m_dynRupKernel;
 
 seissol::memory::ManagedAllocator *m_allocator{nullptr};
 
+// data of the kernels which are not part of the local and neighboring integration
+std::unique_ptr<seissol::dr::friction_law::FrictionSolver> m_frictionSolver;
+std::unique_ptr<seissol::sourceterm::PointSources>        m_pointSources;
+std::vector<unsigned>                                      m_pointSourceCells;
+std::unique_ptr<seissol::kernels::ReceiverCluster>         m_receiverCluster;
+
+//! one point source and one receiver per this number of cells
+constexpr unsigned CellsPerPoint = 100;
+
+//! cells checked by, passed by and yielding in the plasticity kernel (reset after the warm-up)
+unsigned long long m_plasticityChecks = 0;
+unsigned long long m_plasticityCandidates = 0;
+unsigned long long m_plasticityYields = 0;
+
+//! A time cluster replayed by the kernel lts
+struct ProxyCluster {
+  unsigned globalClusterId;
+  double timeStepWidth;
+  //! time step width in units of the time step width of the fastest cluster
+  unsigned stepTicks;
+  bool plasticity;
+  //! measured time of the updates (reset after the warm-up)
+  double time;
+};
+
+//! clusters of the kernel lts, sorted by the time step width
+std::vector<ProxyCluster> m_clusters;
+
 namespace tensor = seissol::tensor;
 
 void initGlobalData() {
@@ -110,10 +150,27 @@ void initGlobalData() {
   m_dynRupKernel.setGlobalData(globalData);
 }
 
-unsigned int initDataStructures(unsigned int i_cells, bool enableDynamicRupture) {
+void fakeDynRupFaces(seissol::initializers::Layer& layer, unsigned numberOfFakeDerivatives) {
+  real** timeDerivativePlus = layer.var(m_dynRup.timeDerivativePlus);
+  real** timeDerivativeMinus = layer.var(m_dynRup.timeDerivativeMinus);
+  DRFaceInformation* faceInformation = layer.var(m_dynRup.faceInformation);
+
+  for (unsigned face = 0; face < layer.getNumberOfCells(); ++face) {
+    unsigned plusCell = (unsigned int)lrand48() % numberOfFakeDerivatives;
+    unsigned minusCell = (unsigned int)lrand48() % numberOfFakeDerivatives;
+    timeDerivativePlus[face] = &m_fakeDerivatives[plusCell * yateto::computeFamilySize<tensor::dQ>()];
+    timeDerivativeMinus[face] = &m_fakeDerivatives[minusCell * yateto::computeFamilySize<tensor::dQ>()];
+
+    faceInformation[face].plusSide = (unsigned int)lrand48() % 4;
+    faceInformation[face].minusSide = (unsigned int)lrand48() % 4;
+    faceInformation[face].faceRelation = (unsigned int)lrand48() % 3;
+  }
+}
+
+unsigned int initDataStructures(unsigned int i_cells, bool enableDynamicRupture, bool enableFrictionLaw, bool enablePlasticity) {
   // init RNG
   srand48(i_cells);
-  m_lts.addTo(*m_ltsTree, false); // proxy does not use plasticity
+  m_lts.addTo(*m_ltsTree, enablePlasticity);
   m_ltsTree->setNumberOfTimeClusters(1);
   m_ltsTree->fixate();
   
@@ -130,7 +187,10 @@ unsigned int initDataStructures(unsigned int i_cells, bool enableDynamicRupture)
   m_ltsTree->allocateBuckets();
   
   if (enableDynamicRupture) {
-    m_dynRup.addTo(*m_dynRupTree);
+    // linear slip weakening with forced rupture time, which does not depend on the nucleation stress
+    m_drParameters.frictionLaw = 16;
+    m_drParameters.isNativeSolverEnabled = enableFrictionLaw;
+    m_dynRup.addTo(*m_dynRupTree, m_drParameters);
     m_dynRupTree->setNumberOfTimeClusters(1);
     m_dynRupTree->fixate();
     
@@ -164,9 +224,6 @@ unsigned int initDataStructures(unsigned int i_cells, bool enableDynamicRupture)
     seissol::initializers::Layer& interior = m_dynRupTree->child(0).child<Interior>();
     real (*imposedStatePlus)[seissol::tensor::QInterpolated::size()] = interior.var(m_dynRup.imposedStatePlus);
     real (*fluxSolverPlus)[seissol::tensor::fluxSolver::size()]     = interior.var(m_dynRup.fluxSolverPlus);
-    real** timeDerivativePlus = interior.var(m_dynRup.timeDerivativePlus);
-    real** timeDerivativeMinus = interior.var(m_dynRup.timeDerivativeMinus);
-    DRFaceInformation* faceInformation = interior.var(m_dynRup.faceInformation);
     
     /* init drMapping */
     for (unsigned cell = 0; cell < i_cells; ++cell) {
@@ -183,21 +240,351 @@ unsigned int initDataStructures(unsigned int i_cells, bool enableDynamicRupture)
     }
 
     /* init dr godunov state */
-    for (unsigned face = 0; face < interior.getNumberOfCells(); ++face) {
-      unsigned plusCell = (unsigned int)lrand48() % i_cells;
-      unsigned minusCell = (unsigned int)lrand48() % i_cells;
-      timeDerivativePlus[face] = &m_fakeDerivatives[plusCell * yateto::computeFamilySize<tensor::dQ>()];
-      timeDerivativeMinus[face] = &m_fakeDerivatives[minusCell * yateto::computeFamilySize<tensor::dQ>()];
-      
-      faceInformation[face].plusSide = (unsigned int)lrand48() % 4;
-      faceInformation[face].minusSide = (unsigned int)lrand48() % 4;
-      faceInformation[face].faceRelation = (unsigned int)lrand48() % 3;
-    }
+    fakeDynRupFaces(interior, i_cells);
   }
   
   return i_cells;
 }
 
+void initFrictionLaw() {
+  seissol::initializers::Layer& interior = m_dynRupTree->child(0).child<Interior>();
+  const unsigned numberOfFaces = interior.getNumberOfCells();
+  auto* waveSpeedsPlus = interior.var(m_dynRup.waveSpeedsPlus);
+  auto* waveSpeedsMinus = interior.var(m_dynRup.waveSpeedsMinus);
+  auto* initialStress = interior.var(m_dynRup.initialStressInFaultCS);
+  auto* ruptureTimePending = interior.var(m_dynRup.ruptureTimePending);
+  auto* dynStressTimePending = interior.var(m_dynRup.dynStressTimePending);
+
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (unsigned face = 0; face < numberOfFaces; ++face) {
+    waveSpeedsPlus[face] = {2700.0, 6000.0, 3464.0};
+    waveSpeedsMinus[face] = {2700.0, 6000.0, 3464.0};
+    for (unsigned point = 0; point < seissol::dr::numPaddedPoints; ++point) {
+      interior.var(m_dynRup.mu)[face][point] = 0.6;
+      interior.var(m_dynRup.muS)[face][point] = 0.6;
+      interior.var(m_dynRup.muD)[face][point] = 0.1;
+      interior.var(m_dynRup.dC)[face][point] = 0.4;
+      interior.var(m_dynRup.cohesion)[face][point] = 0.0;
+      // half of the faces rupture right away
+      interior.var(m_dynRup.forcedRuptureTime)[face][point] = (face % 2 == 0) ? 0.0 : 1.0e10;
+      interior.var(m_dynRup.slip)[face][point] = 0.0;
+      interior.var(m_dynRup.slip1)[face][point] = 0.0;
+      interior.var(m_dynRup.slip2)[face][point] = 0.0;
+      interior.var(m_dynRup.peakSlipRate)[face][point] = 0.0;
+      interior.var(m_dynRup.ruptureTime)[face][point] = 0.0;
+      interior.var(m_dynRup.dynStressTime)[face][point] = 0.0;
+      ruptureTimePending[face][point] = true;
+      dynStressTimePending[face][point] = true;
+      const real stress[6] = {-120.0e6, -120.0e6, 0.0, 70.0e6, 0.0, 0.0};
+      for (unsigned component = 0; component < 6; ++component) {
+        initialStress[face][component][point] = stress[component];
+        interior.var(m_dynRup.nucleationStressInFaultCS)[face][component][point] = 0.0;
+      }
+    }
+  }
+
+  m_frictionSolver = seissol::dr::factory::getFrictionSolver(m_drParameters);
+  m_dynRupKernel.setTimeStepWidth(seissol::miniSeisSolTimeStep);
+}
+
+void initPlasticity(seissol::initializers::Layer& layer) {
+  PlasticityData* plasticity = layer.var(m_lts.plasticity);
+  real (*pstrain)[7 * NUMBER_OF_ALIGNED_BASIS_FUNCTIONS] = layer.var(m_lts.pstrain);
+
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (unsigned cell = 0; cell < layer.getNumberOfCells(); ++cell) {
+    std::fill_n(plasticity[cell].initialLoading, 6, static_cast<real>(0.0));
+    // every other cell can yield, the remaining cells are rejected by the yield check
+    plasticity[cell].cohesionTimesCosAngularFriction = (cell % 2 == 0) ? 0.0 : 1.0e30;
+    plasticity[cell].sinAngularFriction = 0.5;
+    plasticity[cell].mufactor = 1.0 / (2.0 * 3.0e10);
+    std::fill_n(pstrain[cell], 7 * NUMBER_OF_ALIGNED_BASIS_FUNCTIONS, static_cast<real>(0.0));
+  }
+}
+
+void initPlasticity() {
+  initPlasticity(m_ltsTree->child(0).child<Interior>());
+}
+
+/**
+ * Sets the face types, the LTS setups and the dynamic rupture mapping of the cells of a layer as in the statistics.
+ * Gravitational free surface, Dirichlet and analytical boundaries are replayed as free surface, which has no
+ * boundary data.
+ **/
+void fakeLtsLayer(seissol::initializers::Layer& layer,
+                  seissol::initializers::Layer& dynRupLayer,
+                  const seissol::initializers::time_stepping::ClusterLayerStatistics& statistics,
+                  unsigned numberOfFakeDerivatives) {
+  const unsigned nrOfCells = layer.getNumberOfCells();
+  real**                buffers         = layer.var(m_lts.buffers);
+  real**                derivatives     = layer.var(m_lts.derivatives);
+  real*               (*faceNeighbors)[4] = layer.var(m_lts.faceNeighbors);
+  CellLocalInformation* cellInformation = layer.var(m_lts.cellInformation);
+  CellDRMapping       (*drMapping)[4]   = layer.var(m_lts.drMapping);
+
+  seissol::fakeData(m_lts, layer, FaceType::regular);
+
+  // the face types in random order
+  std::vector<FaceType> faceTypes;
+  faceTypes.reserve(4 * nrOfCells);
+  for (unsigned type = 0; type < statistics.numberOfFaces.size(); ++type) {
+    faceTypes.insert(faceTypes.end(), statistics.numberOfFaces[type], static_cast<FaceType>(type));
+  }
+  faceTypes.resize(4 * nrOfCells, FaceType::regular);
+  for (unsigned face = faceTypes.size(); face > 1; --face) {
+    std::swap(faceTypes[face - 1], faceTypes[(unsigned int)lrand48() % face]);
+  }
+
+  const unsigned derivativesSize = yateto::computeFamilySize<tensor::dQ>();
+  const unsigned numberOfCellsWithDerivatives = std::min(statistics.numberOfCellsWithDerivatives, nrOfCells);
+  real* derivativesBuffer = static_cast<real*>(m_allocator->allocateMemory(
+      std::max(numberOfCellsWithDerivatives, 1u) * derivativesSize * sizeof(real), PAGESIZE_HEAP, MEMKIND_TIMEDOFS));
+
+  unsigned eligibleFaces = 0;
+  for (const FaceType faceType : faceTypes) {
+    eligibleFaces += (faceType != FaceType::outflow && faceType != FaceType::dynamicRupture) ? 1 : 0;
+  }
+  const double derivativeFaceFraction =
+      eligibleFaces > 0 ? static_cast<double>(statistics.numberOfDerivativeFaces) / eligibleFaces : 0.0;
+
+  for (unsigned cell = 0; cell < nrOfCells; ++cell) {
+    if (cell < numberOfCellsWithDerivatives) {
+      derivatives[cell] = derivativesBuffer + cell * derivativesSize;
+      cellInformation[cell].ltsSetup |= (1 << 9);
+    }
+    for (unsigned face = 0; face < 4; ++face) {
+      FaceType faceType = faceTypes[4 * cell + face];
+      if (faceType == FaceType::freeSurfaceGravity || faceType == FaceType::dirichlet || faceType == FaceType::analytical) {
+        faceType = FaceType::freeSurface;
+      }
+      if (faceType == FaceType::dynamicRupture && dynRupLayer.getNumberOfCells() == 0) {
+        faceType = FaceType::regular;
+      }
+      cellInformation[cell].faceTypes[face] = faceType;
+
+      switch (faceType) {
+      case FaceType::freeSurface:
+        faceNeighbors[cell][face] = buffers[cell];
+        break;
+      case FaceType::outflow:
+        faceNeighbors[cell][face] = nullptr;
+        break;
+      case FaceType::dynamicRupture: {
+        faceNeighbors[cell][face] = nullptr;
+        const unsigned drFace = (unsigned int)lrand48() % dynRupLayer.getNumberOfCells();
+        drMapping[cell][face].side = (unsigned int)lrand48() % 4;
+        drMapping[cell][face].faceRelation = (unsigned int)lrand48() % 3;
+        drMapping[cell][face].godunov = dynRupLayer.var(m_dynRup.imposedStatePlus)[drFace];
+        drMapping[cell][face].fluxSolver = dynRupLayer.var(m_dynRup.fluxSolverPlus)[drFace];
+        break;
+      }
+      default:
+        break;
+      }
+
+      // neighbors in slower clusters provide their derivatives, which are integrated in time
+      if (faceType != FaceType::outflow && faceType != FaceType::dynamicRupture && drand48() < derivativeFaceFraction) {
+        cellInformation[cell].ltsSetup |= (1 << face);
+        faceNeighbors[cell][face] = &m_fakeDerivatives[((unsigned int)lrand48() % numberOfFakeDerivatives) * derivativesSize];
+      }
+    }
+  }
+
+  fakeDynRupFaces(dynRupLayer, numberOfFakeDerivatives);
+}
+
+/**
+ * Builds the time clusters of the kernel lts from the cluster statistics of a SeisSol run.
+ * Returns the number of cells.
+ **/
+unsigned int initLtsDataStructures(const std::vector<seissol::initializers::time_stepping::ClusterLayerStatistics>& statistics) {
+  using seissol::initializers::time_stepping::ClusterLayerStatistics;
+  srand48(statistics.size());
+
+  // interior and copy layer per cluster, sorted by the time step width
+  std::map<unsigned, std::pair<ClusterLayerStatistics, ClusterLayerStatistics>> layers;
+  for (const auto& entry : statistics) {
+    auto& layer = entry.copy ? layers[entry.globalClusterId].second : layers[entry.globalClusterId].first;
+    layer = entry;
+  }
+  m_clusters.clear();
+  for (const auto& [clusterId, clusterLayers] : layers) {
+    const double timeStepWidth = std::max(clusterLayers.first.timeStepWidth, clusterLayers.second.timeStepWidth);
+    m_clusters.push_back({clusterId, timeStepWidth, 1, clusterLayers.first.plasticity || clusterLayers.second.plasticity, 0.0});
+  }
+  if (m_clusters.empty()) {
+    throw std::runtime_error("The cluster statistics contain no clusters");
+  }
+  std::sort(m_clusters.begin(), m_clusters.end(), [](const ProxyCluster& a, const ProxyCluster& b) {
+    return a.timeStepWidth < b.timeStepWidth;
+  });
+  for (auto& cluster : m_clusters) {
+    cluster.stepTicks = std::max(1u, static_cast<unsigned>(std::lround(cluster.timeStepWidth / m_clusters[0].timeStepWidth)));
+  }
+  const unsigned numberOfClusters = m_clusters.size();
+  const bool enablePlasticity = std::any_of(m_clusters.begin(), m_clusters.end(), [](const ProxyCluster& cluster) {
+    return cluster.plasticity;
+  });
+
+  m_lts.addTo(*m_ltsTree, enablePlasticity);
+  m_ltsTree->setNumberOfTimeClusters(numberOfClusters);
+  m_ltsTree->fixate();
+  m_drParameters.frictionLaw = 16;
+  m_dynRup.addTo(*m_dynRupTree, m_drParameters);
+  m_dynRupTree->setNumberOfTimeClusters(numberOfClusters);
+  m_dynRupTree->fixate();
+
+  unsigned numberOfCells = 0;
+  for (unsigned tc = 0; tc < numberOfClusters; ++tc) {
+    const auto& clusterLayers = layers.at(m_clusters[tc].globalClusterId);
+    seissol::initializers::TimeCluster& cluster = m_ltsTree->child(tc);
+    cluster.child<Ghost>().setNumberOfCells(0);
+    cluster.child<Copy>().setNumberOfCells(clusterLayers.second.numberOfCells);
+    cluster.child<Interior>().setNumberOfCells(clusterLayers.first.numberOfCells);
+    for (auto* layer : {&cluster.child<Copy>(), &cluster.child<Interior>()}) {
+      layer->setBucketSize(m_lts.buffersDerivatives, sizeof(real) * tensor::I::size() * layer->getNumberOfCells());
+    }
+
+    seissol::initializers::TimeCluster& dynRupCluster = m_dynRupTree->child(tc);
+    dynRupCluster.child<Ghost>().setNumberOfCells(0);
+    dynRupCluster.child<Copy>().setNumberOfCells(clusterLayers.second.numberOfDynamicRuptureFaces);
+    dynRupCluster.child<Interior>().setNumberOfCells(clusterLayers.first.numberOfDynamicRuptureFaces);
+    numberOfCells += clusterLayers.first.numberOfCells + clusterLayers.second.numberOfCells;
+  }
+  m_ltsTree->allocateVariables();
+  m_ltsTree->touchVariables();
+  m_ltsTree->allocateBuckets();
+  m_dynRupTree->allocateVariables();
+  m_dynRupTree->touchVariables();
+
+  const unsigned numberOfFakeDerivatives = std::max(numberOfCells, 1u);
+  m_fakeDerivatives = (real*) m_allocator->allocateMemory(numberOfFakeDerivatives * yateto::computeFamilySize<tensor::dQ>() * sizeof(real), PAGESIZE_HEAP, MEMKIND_TIMEDOFS);
+  seissol::fillWithStuff(m_fakeDerivatives, numberOfFakeDerivatives * yateto::computeFamilySize<tensor::dQ>());
+
+  for (unsigned tc = 0; tc < numberOfClusters; ++tc) {
+    const auto& clusterLayers = layers.at(m_clusters[tc].globalClusterId);
+    fakeLtsLayer(m_ltsTree->child(tc).child<Copy>(), m_dynRupTree->child(tc).child<Copy>(), clusterLayers.second, numberOfFakeDerivatives);
+    fakeLtsLayer(m_ltsTree->child(tc).child<Interior>(), m_dynRupTree->child(tc).child<Interior>(), clusterLayers.first, numberOfFakeDerivatives);
+  }
+  if (enablePlasticity) {
+    for (unsigned tc = 0; tc < numberOfClusters; ++tc) {
+      initPlasticity(m_ltsTree->child(tc).child<Copy>());
+      initPlasticity(m_ltsTree->child(tc).child<Interior>());
+    }
+  }
+
+  return numberOfCells;
+}
+
+void initBoundaries() {
+  seissol::initializers::Layer& layer = m_ltsTree->child(0).child<Interior>();
+  const unsigned nrOfCells = layer.getNumberOfCells();
+  CellLocalInformation* cellInformation = layer.var(m_lts.cellInformation);
+  CellMaterialData* material = layer.var(m_lts.material);
+  CellBoundaryMapping (*boundaryMapping)[4] = layer.var(m_lts.boundaryMapping);
+  real* (*faceDisplacements)[4] = layer.var(m_lts.faceDisplacements);
+
+  auto* boundaryFaces = static_cast<BoundaryFaceInformation*>(
+      m_allocator->allocateMemory(4 * nrOfCells * sizeof(BoundaryFaceInformation), PAGESIZE_HEAP, seissol::memory::Standard));
+  auto* displacements = static_cast<real*>(
+      m_allocator->allocateMemory(4 * nrOfCells * tensor::faceDisplacement::size() * sizeof(real), PAGESIZE_HEAP, seissol::memory::Standard));
+  seissol::fillWithStuff(reinterpret_cast<real*>(boundaryFaces), 4 * nrOfCells * sizeof(BoundaryFaceInformation) / sizeof(real));
+
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (unsigned cell = 0; cell < nrOfCells; ++cell) {
+    material[cell].local.rho = 2700.0;
+    for (unsigned face = 0; face < 4; ++face) {
+      // faces 0 and 1 have the gravitational free surface, faces 2 and 3 the Dirichlet boundary condition
+      const bool isFreeSurface = face < 2;
+      cellInformation[cell].faceTypes[face] = isFreeSurface ? FaceType::freeSurfaceGravity : FaceType::dirichlet;
+      BoundaryFaceInformation& boundaryFace = boundaryFaces[4 * cell + face];
+      boundaryMapping[cell][face].nodes = boundaryFace.nodes;
+      boundaryMapping[cell][face].TData = boundaryFace.TData;
+      boundaryMapping[cell][face].TinvData = boundaryFace.TinvData;
+      boundaryMapping[cell][face].easiBoundaryConstant = boundaryFace.easiBoundaryConstant;
+      boundaryMapping[cell][face].easiBoundaryMap = boundaryFace.easiBoundaryMap;
+      real* faceDisplacement = displacements + (4 * cell + face) * tensor::faceDisplacement::size();
+      std::fill_n(faceDisplacement, tensor::faceDisplacement::size(), static_cast<real>(0.0));
+      faceDisplacements[cell][face] = isFreeSurface ? faceDisplacement : nullptr;
+    }
+  }
+}
+
+void initPointSources() {
+  seissol::initializers::Layer& layer = m_ltsTree->child(0).child<Interior>();
+  const unsigned numberOfSources = std::max(1u, layer.getNumberOfCells() / CellsPerPoint);
+
+  m_pointSources = std::make_unique<seissol::sourceterm::PointSources>();
+  m_pointSources->mode = seissol::sourceterm::PointSources::FSRM;
+  m_pointSources->numberOfSources = numberOfSources;
+  int error = posix_memalign(reinterpret_cast<void**>(&m_pointSources->mInvJInvPhisAtSources), ALIGNMENT,
+                             numberOfSources * tensor::mInvJInvPhisAtSources::size() * sizeof(real));
+  error |= posix_memalign(reinterpret_cast<void**>(&m_pointSources->tensor), ALIGNMENT,
+                          numberOfSources * seissol::sourceterm::PointSources::TensorSize * sizeof(real));
+  if (error) {
+    throw std::runtime_error("could not allocate the point sources");
+  }
+  seissol::fillWithStuff(reinterpret_cast<real*>(m_pointSources->mInvJInvPhisAtSources), numberOfSources * tensor::mInvJInvPhisAtSources::size());
+  seissol::fillWithStuff(reinterpret_cast<real*>(m_pointSources->tensor), numberOfSources * seissol::sourceterm::PointSources::TensorSize);
+
+  // a source time function with one sample per time step
+  std::vector<real> samples(64);
+  for (unsigned sample = 0; sample < samples.size(); ++sample) {
+    samples[sample] = static_cast<real>(std::sin(0.1 * sample));
+  }
+  m_pointSources->slipRates.resize(numberOfSources);
+  m_pointSourceCells.resize(numberOfSources);
+  for (unsigned source = 0; source < numberOfSources; ++source) {
+    seissol::sourceterm::samplesToPiecewiseLinearFunction1D(samples.data(),
+                                                            samples.size(),
+                                                            0.0,
+                                                            seissol::miniSeisSolTimeStep,
+                                                            &m_pointSources->slipRates[source][0]);
+    // distinct cells, such that the sources can be added in parallel
+    m_pointSourceCells[source] = source * (layer.getNumberOfCells() / numberOfSources);
+  }
+}
+
+void initReceivers() {
+  seissol::initializers::Layer& layer = m_ltsTree->child(0).child<Interior>();
+  const unsigned numberOfReceivers = std::max(1u, layer.getNumberOfCells() / CellsPerPoint);
+
+  // all quantities except for the memory variables (as the receiver writer), five samples per time step
+  std::vector<unsigned> quantities(NUMBER_OF_QUANTITIES - 6 * NUMBER_OF_RELAXATION_MECHANISMS);
+  std::iota(quantities.begin(), quantities.end(), 0);
+  m_receiverCluster = std::make_unique<seissol::kernels::ReceiverCluster>(&m_globalDataOnHost,
+                                                                          quantities,
+                                                                          seissol::miniSeisSolTimeStep / 5.0,
+                                                                          0.0);
+  seissol::kernels::LocalData::Loader loader;
+  loader.load(m_lts, layer);
+  for (unsigned receiver = 0; receiver < numberOfReceivers; ++receiver) {
+    const unsigned cell = (unsigned int)lrand48() % layer.getNumberOfCells();
+    m_receiverCluster->addReceiver(receiver, {drand48() / 4.0, drand48() / 4.0, drand48() / 4.0}, loader.entry(cell), nullptr);
+  }
+}
+
+void initTaylorExpansion() {
+  // one set of time derivatives per cell, as for the evaluation of the receivers or the free surface output
+  const unsigned nrOfCells = m_ltsTree->child(0).child<Interior>().getNumberOfCells();
+  m_fakeDerivatives = (real*) m_allocator->allocateMemory(nrOfCells * yateto::computeFamilySize<tensor::dQ>() * sizeof(real), PAGESIZE_HEAP, MEMKIND_TIMEDOFS);
+  seissol::fillWithStuff(m_fakeDerivatives, nrOfCells * yateto::computeFamilySize<tensor::dQ>());
+}
+
+void freeKernelData() {
+  m_frictionSolver.reset();
+  m_pointSources.reset();
+  m_pointSourceCells.clear();
+  m_receiverCluster.reset();
+  m_clusters.clear();
+}
+
 #ifdef ACL_DEVICE
 void initDataStructuresOnDevice(bool enableDynamicRupture) {
 
@@ -148,4 +148,87 @@ seissol_flops flops_all_actual(unsigned int i_timesteps) {
   return ret;
 }
 
+seissol_flops flops_plasticity_actual(unsigned int i_timesteps) {
+  seissol_flops ret;
+  long long l_nonZeroFlopsPossible, l_hardwareFlopsPossible;
+  long long l_nonZeroFlopsCheck, l_hardwareFlopsCheck, l_nonZeroFlopsYield, l_hardwareFlopsYield;
+  seissol::kernels::Plasticity::flopsYieldingPossible(l_nonZeroFlopsPossible, l_hardwareFlopsPossible);
+  seissol::kernels::Plasticity::flopsPlasticity(l_nonZeroFlopsCheck, l_hardwareFlopsCheck, l_nonZeroFlopsYield, l_hardwareFlopsYield);
+
+  // the cells are counted by the kernel over the measured time steps
+  ret.d_nonZeroFlops  = m_plasticityChecks * l_nonZeroFlopsPossible
+                      + m_plasticityCandidates * l_nonZeroFlopsCheck
+                      + m_plasticityYields * l_nonZeroFlopsYield;
+  ret.d_hardwareFlops = m_plasticityChecks * l_hardwareFlopsPossible
+                      + m_plasticityCandidates * l_hardwareFlopsCheck
+                      + m_plasticityYields * l_hardwareFlopsYield;
+
+  return ret;
+}
+
+seissol_flops flops_taylor_actual(unsigned int i_timesteps) {
+  seissol_flops ret;
+  long long l_nonZeroFlops, l_hardwareFlops;
+  m_timeKernel.flopsTaylorExpansion(l_nonZeroFlops, l_hardwareFlops);
 
+  const unsigned nrOfCells = m_ltsTree->child(0).child<Interior>().getNumberOfCells();
+  ret.d_nonZeroFlops  = l_nonZeroFlops * nrOfCells * i_timesteps;
+  ret.d_hardwareFlops = l_hardwareFlops * nrOfCells * i_timesteps;
+
+  return ret;
+}
+
+seissol_flops flops_lts_actual(unsigned int i_timesteps) {
+  seissol_flops ret;
+  ret.d_nonZeroFlops = 0;
+  ret.d_hardwareFlops = 0;
+
+  unsigned int l_aderNonZeroFlops, l_aderHardwareFlops;
+  m_timeKernel.flopsAder(l_aderNonZeroFlops, l_aderHardwareFlops);
+  const unsigned ticks = m_clusters.back().stepTicks;
+  for (unsigned tc = 0; tc < m_clusters.size(); ++tc) {
+    long long l_nonZeroFlops = 0;
+    long long l_hardwareFlops = 0;
+    for (auto* layer : {&m_ltsTree->child(tc).child<Copy>(), &m_ltsTree->child(tc).child<Interior>()}) {
+      CellLocalInformation* cellInformation = layer->var(m_lts.cellInformation);
+      CellDRMapping        (*drMapping)[4]  = layer->var(m_lts.drMapping);
+      for (unsigned cell = 0; cell < layer->getNumberOfCells(); ++cell) {
+        unsigned int l_localNonZeroFlops, l_localHardwareFlops, l_neighborNonZeroFlops, l_neighborHardwareFlops;
+        long long l_drNonZeroFlops, l_drHardwareFlops;
+        m_localKernel.flopsIntegral(cellInformation[cell].faceTypes, l_localNonZeroFlops, l_localHardwareFlops);
+        m_neighborKernel.flopsNeighborsIntegral( cellInformation[cell].faceTypes, cellInformation[cell].faceRelations, drMapping[cell], l_neighborNonZeroFlops, l_neighborHardwareFlops, l_drNonZeroFlops, l_drHardwareFlops );
+        l_nonZeroFlops  += l_aderNonZeroFlops + l_localNonZeroFlops + l_neighborNonZeroFlops + l_drNonZeroFlops;
+        l_hardwareFlops += l_aderHardwareFlops + l_localHardwareFlops + l_neighborHardwareFlops + l_drHardwareFlops;
+      }
+    }
+    for (auto* layer : {&m_dynRupTree->child(tc).child<Copy>(), &m_dynRupTree->child(tc).child<Interior>()}) {
+      DRFaceInformation* faceInformation = layer->var(m_dynRup.faceInformation);
+      for (unsigned face = 0; face < layer->getNumberOfCells(); ++face) {
+        long long l_drNonZeroFlops, l_drHardwareFlops;
+        m_dynRupKernel.flopsGodunovState(faceInformation[face], l_drNonZeroFlops, l_drHardwareFlops);
+        l_nonZeroFlops  += l_drNonZeroFlops;
+        l_hardwareFlops += l_drHardwareFlops;
+      }
+    }
+    // updates of the cluster per time step of the slowest cluster
+    const unsigned updates = ticks / m_clusters[tc].stepTicks;
+    ret.d_nonZeroFlops  += l_nonZeroFlops * updates * i_timesteps;
+    ret.d_hardwareFlops += l_hardwareFlops * updates * i_timesteps;
+  }
+
+  if (m_clusters.front().plasticity) {
+    seissol_flops plasticity = flops_plasticity_actual(i_timesteps);
+    ret.d_nonZeroFlops  += plasticity.d_nonZeroFlops;
+    ret.d_hardwareFlops += plasticity.d_hardwareFlops;
+  }
+
+  return ret;
+}
+
+seissol_flops noflops(unsigned int i_timesteps) {
+  // point sources and receivers are memory bound, hence no flops are reported
+  seissol_flops ret;
+  ret.d_nonZeroFlops = 0;
+  ret.d_hardwareFlops = 0;
+  return ret;
+}
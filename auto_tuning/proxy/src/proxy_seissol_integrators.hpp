@@ -26,6 +26,10 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include <generated_code/tensor.h>
+#include <Kernels/denseMatrixOps.hpp>
+#include <utils/env.h>
+#include <chrono>
+#include <cmath>
 
 namespace tensor = seissol::tensor;
 namespace kernels = seissol::kernels;
@@ -37,6 +41,12 @@ void registerMarkers() {
         LIKWID_MARKER_REGISTER("localwoader");
         LIKWID_MARKER_REGISTER("local");
         LIKWID_MARKER_REGISTER("neighboring");
+        LIKWID_MARKER_REGISTER("plasticity");
+        LIKWID_MARKER_REGISTER("boundary");
+        LIKWID_MARKER_REGISTER("sources");
+        LIKWID_MARKER_REGISTER("receivers");
+        LIKWID_MARKER_REGISTER("taylor");
+        LIKWID_MARKER_REGISTER("friction_dr");
     }
 }
 
@@ -102,8 +112,7 @@ namespace proxy::cpu {
   #endif
   }
 
-  void computeLocalIntegration() {
-    auto&                 layer           = m_ltsTree->child(0).child<Interior>();
+  void computeLocalIntegration(seissol::initializers::Layer& layer, double timeStepWidth) {
     unsigned              nrOfCells       = layer.getNumberOfCells();
     real**                buffers                       = layer.var(m_lts.buffers);
     real**                derivatives                   = layer.var(m_lts.derivatives);
@@ -111,27 +120,35 @@ namespace proxy::cpu {
     kernels::LocalData::Loader loader;
     loader.load(m_lts, layer);
 
+    // as in SeisSol: compute the buffers in a local buffer and stream them out (SEISSOL_STREAMING_STORES)
+    static const bool streamBuffers = utils::Env::get<int>("SEISSOL_STREAMING_STORES", kernels::hasNonTemporalStores ? 1 : 0) != 0;
+
   #ifdef _OPENMP
     #pragma omp parallel
     {
     LIKWID_MARKER_START("local");
     kernels::LocalTmp tmp;
+    alignas(ALIGNMENT) real integrationBuffer[tensor::I::size()];
     #pragma omp for schedule(static)
   #endif
     for( unsigned int l_cell = 0; l_cell < nrOfCells; l_cell++ ) {
       auto data = loader.entry(l_cell);
-      m_timeKernel.computeAder(      (double)seissol::miniSeisSolTimeStep,
+      real* timeIntegrated = streamBuffers ? integrationBuffer : buffers[l_cell];
+      m_timeKernel.computeAder(                      timeStepWidth,
                                              data,
                                              tmp,
-                                             buffers[l_cell],
+                                             timeIntegrated,
                                              derivatives[l_cell] );
-      m_localKernel.computeIntegral(buffers[l_cell],
+      m_localKernel.computeIntegral(timeIntegrated,
                                     data,
                                     tmp,
                                     nullptr,
                                     nullptr,
                                     0,
                                     0);
+      if (streamBuffers) {
+        kernels::streamstore(tensor::I::size(), integrationBuffer, buffers[l_cell]);
+      }
     }
   #ifdef _OPENMP
     LIKWID_MARKER_STOP("local");
@@ -139,8 +156,11 @@ namespace proxy::cpu {
   #endif
   }
 
-  void computeNeighboringIntegration() {
-    auto&                     layer                           = m_ltsTree->child(0).child<Interior>();
+  void computeLocalIntegration() {
+    computeLocalIntegration(m_ltsTree->child(0).child<Interior>(), seissol::miniSeisSolTimeStep);
+  }
+
+  void computeNeighboringIntegration(seissol::initializers::Layer& layer, double timeStepWidth) {
     unsigned                  nrOfCells                       = layer.getNumberOfCells();
     real*                     (*faceNeighbors)[4]             = layer.var(m_lts.faceNeighbors);
     CellDRMapping             (*drMapping)[4]                 = layer.var(m_lts.drMapping);
@@ -170,7 +190,7 @@ namespace proxy::cpu {
                                                       cellInformation[l_cell].ltsSetup,
                                                       cellInformation[l_cell].faceTypes,
                                                       0.0,
-                                              (double)seissol::miniSeisSolTimeStep,
+                                                      timeStepWidth,
                                                       faceNeighbors[l_cell],
   #ifdef _OPENMP
                                                       *reinterpret_cast<real (*)[4][tensor::I::size()]>(&(m_globalDataOnHost.integrationBufferLTS[omp_get_thread_num()*4*tensor::I::size()])),
@@ -192,6 +212,9 @@ namespace proxy::cpu {
       if (l_cell < (nrOfCells-1) ) {
         l_faceNeighbors_prefetch[3] = (cellInformation[l_cell+1].faceTypes[0] != FaceType::dynamicRupture) ?
             faceNeighbors[l_cell+1][0] : drMapping[l_cell+1][0].godunov;
+        seissol::kernels::TimeCommon::prefetchDerivatives(cellInformation[l_cell+1].ltsSetup,
+                                                          cellInformation[l_cell+1].faceTypes,
+                                                          faceNeighbors[l_cell+1]);
       } else {
         l_faceNeighbors_prefetch[3] = faceNeighbors[l_cell][3];
       }
@@ -213,7 +236,188 @@ namespace proxy::cpu {
   #endif
   }
 
+  void computeNeighboringIntegration() {
+    computeNeighboringIntegration(m_ltsTree->child(0).child<Interior>(), seissol::miniSeisSolTimeStep);
+  }
+
+  void computeDynRupGodunovState(seissol::initializers::Layer& layerData)
+  {
+    DRFaceInformation* faceInformation = layerData.var(m_dynRup.faceInformation);
+    DRGodunovData* godunovData = layerData.var(m_dynRup.godunovData);
+    DROutput* drOutput = layerData.var(m_dynRup.drOutput);
+    real** timeDerivativePlus = layerData.var(m_dynRup.timeDerivativePlus);
+    real** timeDerivativeMinus = layerData.var(m_dynRup.timeDerivativeMinus);
+    alignas(ALIGNMENT) real QInterpolatedPlus[CONVERGENCE_ORDER][tensor::QInterpolated::size()];
+    alignas(ALIGNMENT) real QInterpolatedMinus[CONVERGENCE_ORDER][tensor::QInterpolated::size()];
+
+  #ifdef _OPENMP
+    #pragma omp parallel for schedule(static) private(QInterpolatedPlus,QInterpolatedMinus)
+  #endif
+    for (unsigned face = 0; face < layerData.getNumberOfCells(); ++face) {
+      unsigned prefetchFace = (face < layerData.getNumberOfCells()-1) ? face+1 : face;
+      m_dynRupKernel.spaceTimeInterpolation(  faceInformation[face],
+                                             &m_globalDataOnHost,
+                                             &godunovData[face],
+                                             &drOutput[face],
+                                              timeDerivativePlus[face],
+                                              timeDerivativeMinus[face],
+                                              QInterpolatedPlus,
+                                              QInterpolatedMinus,
+                                              timeDerivativePlus[prefetchFace],
+                                              timeDerivativeMinus[prefetchFace] );
+    }
+  }
+
   void computeDynRupGodunovState()
+  {
+    computeDynRupGodunovState(m_dynRupTree->child(0).child<Interior>());
+  }
+
+  void computePlasticityIntegration(seissol::initializers::Layer& layer, double timeStepWidth) {
+    unsigned              nrOfCells       = layer.getNumberOfCells();
+    real                (*dofs)[tensor::Q::size()] = layer.var(m_lts.dofs);
+    PlasticityData*       plasticity      = layer.var(m_lts.plasticity);
+    real                (*pstrain)[7 * NUMBER_OF_ALIGNED_BASIS_FUNCTIONS] = layer.var(m_lts.pstrain);
+
+    // relaxation time of the viscoplastic model
+    const double T_v = 0.05;
+    const double oneMinusIntegratingFactor = 1.0 - std::exp(-timeStepWidth / T_v);
+    unsigned long long candidates = 0;
+    unsigned long long yields = 0;
+
+  #ifdef _OPENMP
+    #pragma omp parallel reduction(+:candidates,yields)
+    {
+    LIKWID_MARKER_START("plasticity");
+    #pragma omp for schedule(static)
+  #endif
+    for( unsigned int l_cell = 0; l_cell < nrOfCells; l_cell++ ) {
+      if (seissol::kernels::Plasticity::isYieldingPossible(&m_globalDataOnHost, &plasticity[l_cell], dofs[l_cell])) {
+        ++candidates;
+        yields += seissol::kernels::Plasticity::computePlasticity( oneMinusIntegratingFactor,
+                                                                   timeStepWidth,
+                                                                   T_v,
+                                                                   &m_globalDataOnHost,
+                                                                   &plasticity[l_cell],
+                                                                   dofs[l_cell],
+                                                                   pstrain[l_cell] );
+      }
+    }
+  #ifdef _OPENMP
+    LIKWID_MARKER_STOP("plasticity");
+    }
+  #endif
+
+    m_plasticityChecks += nrOfCells;
+    m_plasticityCandidates += candidates;
+    m_plasticityYields += yields;
+  }
+
+  void computePlasticityIntegration() {
+    computePlasticityIntegration(m_ltsTree->child(0).child<Interior>(), seissol::miniSeisSolTimeStep);
+  }
+
+  void computeBoundaryIntegration() {
+    auto&                 layer           = m_ltsTree->child(0).child<Interior>();
+    unsigned              nrOfCells       = layer.getNumberOfCells();
+    real**                buffers                       = layer.var(m_lts.buffers);
+    real**                derivatives                   = layer.var(m_lts.derivatives);
+    CellMaterialData*     materialData                  = layer.var(m_lts.material);
+    CellBoundaryMapping (*boundaryMapping)[4]           = layer.var(m_lts.boundaryMapping);
+
+    kernels::LocalData::Loader loader;
+    loader.load(m_lts, layer);
+
+  #ifdef _OPENMP
+    #pragma omp parallel
+    {
+    LIKWID_MARKER_START("boundary");
+    kernels::LocalTmp tmp;
+    #pragma omp for schedule(static)
+  #endif
+    for( unsigned int l_cell = 0; l_cell < nrOfCells; l_cell++ ) {
+      auto data = loader.entry(l_cell);
+      m_timeKernel.computeAder(      (double)seissol::miniSeisSolTimeStep,
+                                             data,
+                                             tmp,
+                                             buffers[l_cell],
+                                             derivatives[l_cell],
+                                             0.0,
+                                             true );
+      m_localKernel.computeIntegral(buffers[l_cell],
+                                    data,
+                                    tmp,
+                                    &materialData[l_cell],
+                                    &boundaryMapping[l_cell],
+                                    0.0,
+                                    seissol::miniSeisSolTimeStep);
+    }
+  #ifdef _OPENMP
+    LIKWID_MARKER_STOP("boundary");
+    }
+  #endif
+  }
+
+  void computePointSources() {
+    auto&                 layer           = m_ltsTree->child(0).child<Interior>();
+    real                (*dofs)[tensor::Q::size()] = layer.var(m_lts.dofs);
+    seissol::sourceterm::PointSources& sources = *m_pointSources;
+
+  #ifdef _OPENMP
+    #pragma omp parallel
+    {
+    LIKWID_MARKER_START("sources");
+    #pragma omp for schedule(static)
+  #endif
+    for (unsigned source = 0; source < sources.numberOfSources; ++source) {
+      seissol::sourceterm::addTimeIntegratedPointSourceFSRM( sources.mInvJInvPhisAtSources[source],
+                                                             sources.tensor[source],
+                                                             sources.slipRates[source][0],
+                                                             0.0,
+                                                             seissol::miniSeisSolTimeStep,
+                                                             dofs[m_pointSourceCells[source]] );
+    }
+  #ifdef _OPENMP
+    LIKWID_MARKER_STOP("sources");
+    }
+  #endif
+  }
+
+  void computeReceivers() {
+    LIKWID_MARKER_START("receivers");
+    m_receiverCluster->calcReceivers(0.0, 0.0, seissol::miniSeisSolTimeStep);
+    LIKWID_MARKER_STOP("receivers");
+    // the receiver writer drops the samples once they are written
+    for (auto& receiver : *m_receiverCluster) {
+      receiver.output.clear();
+    }
+  }
+
+  void computeTaylorExpansion() {
+    auto&                 layer           = m_ltsTree->child(0).child<Interior>();
+    unsigned              nrOfCells       = layer.getNumberOfCells();
+    real                (*dofs)[tensor::Q::size()] = layer.var(m_lts.dofs);
+
+  #ifdef _OPENMP
+    #pragma omp parallel
+    {
+    LIKWID_MARKER_START("taylor");
+    #pragma omp for schedule(static)
+  #endif
+    for (unsigned cell = 0; cell < nrOfCells; ++cell) {
+      // evaluates in the middle of the time step, written to the dofs such that the kernel is not optimized away
+      m_timeKernel.computeTaylorExpansion( 0.5 * seissol::miniSeisSolTimeStep,
+                                           0.0,
+                                           &m_fakeDerivatives[cell * yateto::computeFamilySize<tensor::dQ>()],
+                                           dofs[cell] );
+    }
+  #ifdef _OPENMP
+    LIKWID_MARKER_STOP("taylor");
+    }
+  #endif
+  }
+
+  void computeDynRupFrictionLaw()
   {
     seissol::initializers::Layer& layerData = m_dynRupTree->child(0).child<Interior>();
     DRFaceInformation* faceInformation = layerData.var(m_dynRup.faceInformation);
@@ -223,9 +427,14 @@ namespace proxy::cpu {
     real** timeDerivativeMinus = layerData.var(m_dynRup.timeDerivativeMinus);
     alignas(ALIGNMENT) real QInterpolatedPlus[CONVERGENCE_ORDER][tensor::QInterpolated::size()];
     alignas(ALIGNMENT) real QInterpolatedMinus[CONVERGENCE_ORDER][tensor::QInterpolated::size()];
+    // the friction law depends on the time, e.g. through the forced rupture time
+    static double fullUpdateTime = 0.0;
 
   #ifdef _OPENMP
-    #pragma omp parallel for schedule(static) private(QInterpolatedPlus,QInterpolatedMinus)
+    #pragma omp parallel private(QInterpolatedPlus,QInterpolatedMinus)
+    {
+    LIKWID_MARKER_START("friction_dr");
+    #pragma omp for schedule(static)
   #endif
     for (unsigned face = 0; face < layerData.getNumberOfCells(); ++face) {
       unsigned prefetchFace = (face < layerData.getNumberOfCells()-1) ? face+1 : face;
@@ -239,6 +448,67 @@ namespace proxy::cpu {
                                               QInterpolatedMinus,
                                               timeDerivativePlus[prefetchFace],
                                               timeDerivativeMinus[prefetchFace] );
+      m_frictionSolver->evaluate( layerData,
+                                  &m_dynRup,
+                                  face,
+                                  QInterpolatedPlus,
+                                  QInterpolatedMinus,
+                                  fullUpdateTime,
+                                  m_dynRupKernel.timePoints,
+                                  m_dynRupKernel.timeWeights );
+    }
+  #ifdef _OPENMP
+    LIKWID_MARKER_STOP("friction_dr");
+    }
+  #endif
+
+    fullUpdateTime += seissol::miniSeisSolTimeStep;
+  }
+
+  /**
+   * One time step of the slowest cluster of the kernel lts.
+   * The clusters advance in units of the time step width of the fastest cluster. A cluster predicts (local
+   * integration) at the start of its time step and corrects (neighboring integration) at its end, after the
+   * faster clusters, as the actors of the time clusters do.
+   **/
+  void computeLtsIntegration() {
+    const unsigned numberOfClusters = m_clusters.size();
+    const unsigned ticks = m_clusters.back().stepTicks;
+
+    auto timed = [](ProxyCluster& cluster, auto&& update) {
+      const auto begin = std::chrono::steady_clock::now();
+      update();
+      cluster.time += std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    };
+
+    for (unsigned tick = 0; tick <= ticks; ++tick) {
+      for (unsigned tc = 0; tick > 0 && tc < numberOfClusters; ++tc) {
+        ProxyCluster& cluster = m_clusters[tc];
+        if (tick % cluster.stepTicks == 0) {
+          timed(cluster, [&]() {
+            auto& ltsCluster = m_ltsTree->child(tc);
+            auto& dynRupCluster = m_dynRupTree->child(tc);
+            computeDynRupGodunovState(dynRupCluster.child<Copy>());
+            computeDynRupGodunovState(dynRupCluster.child<Interior>());
+            computeNeighboringIntegration(ltsCluster.child<Copy>(), cluster.timeStepWidth);
+            computeNeighboringIntegration(ltsCluster.child<Interior>(), cluster.timeStepWidth);
+            if (cluster.plasticity) {
+              computePlasticityIntegration(ltsCluster.child<Copy>(), cluster.timeStepWidth);
+              computePlasticityIntegration(ltsCluster.child<Interior>(), cluster.timeStepWidth);
+            }
+          });
+        }
+      }
+      for (unsigned tc = 0; tick < ticks && tc < numberOfClusters; ++tc) {
+        ProxyCluster& cluster = m_clusters[tc];
+        if (tick % cluster.stepTicks == 0) {
+          timed(cluster, [&]() {
+            // the copy layer first, such that its data can be sent early
+            computeLocalIntegration(m_ltsTree->child(tc).child<Copy>(), cluster.timeStepWidth);
+            computeLocalIntegration(m_ltsTree->child(tc).child<Interior>(), cluster.timeStepWidth);
+          });
+        }
+      }
     }
   }
 } // namespace proxy::cpu
@@ -0,0 +1,199 @@
+#!/usr/bin/env python3
+##
+# @file
+# This file is part of SeisSol.
+#
+# @section LICENSE
+# Copyright (c) 2026, SeisSol Group
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice,
+#    this list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+#    contributors may be used to endorse or promote products derived from this
+#    software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+# LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+# CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+# SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+# INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+# CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+#
+# @section DESCRIPTION
+# Performance regression check of the kernels: runs SeisSol-proxy for each kernel,
+# writes the median times as JSON and compares them with a stored baseline of the
+# same configuration (equations, order, precision, architecture).
+#
+
+import argparse
+import datetime
+import json
+import os
+import platform
+import re
+import statistics
+import subprocess
+import sys
+
+DEFAULT_KERNELS = 'ader,local,neigh,godunov_dr,friction_dr,plasticity,boundary,sources,receivers,taylor'
+
+PATTERNS = {
+  'time': re.compile(r'^time for seissol proxy\s*:\s*([0-9\.eE+-]+)', re.MULTILINE),
+  'hardwareGflops': re.compile(r'^GFLOPS \(hardware\) for seissol proxy\s*:\s*([0-9\.eE+-]+|nan|inf)', re.MULTILINE),
+  'nonZeroGflops': re.compile(r'^GFLOPS \(non-zero\) for seissol proxy\s*:\s*([0-9\.eE+-]+|nan|inf)', re.MULTILINE)
+}
+
+def cpuModel():
+  try:
+    with open('/proc/cpuinfo') as f:
+      for line in f:
+        if line.startswith('model name'):
+          return line.split(':', 1)[1].strip()
+  except OSError:
+    pass
+  return platform.processor() or 'unknown'
+
+def measure(args, kernel):
+  """Runs the proxy repeatedly for one kernel; returns None if the kernel is not available in this build."""
+  runs = []
+  for repetition in range(args.repetitions):
+    logFile = os.path.join(args.workingDir, '{}.run{}'.format(kernel, repetition))
+    with open(logFile, 'w') as log:
+      result = subprocess.run([args.proxy, str(args.cells), str(args.timesteps), kernel],
+                              stdout=log, stderr=subprocess.STDOUT)
+    with open(logFile) as f:
+      output = f.read()
+    match = PATTERNS['time'].search(output)
+    if result.returncode != 0 or not match:
+      print('Warning: skipping kernel {}, see {}'.format(kernel, logFile))
+      return None
+    runs.append({key: float(pattern.search(output).group(1)) if pattern.search(output) else 0.0
+                 for key, pattern in PATTERNS.items()})
+
+  times = [run['time'] for run in runs]
+  median = min(runs, key=lambda run: abs(run['time'] - statistics.median(times)))
+  return {
+    'time': statistics.median(times),
+    'timeMin': min(times),
+    'timeMax': max(times),
+    'hardwareGflops': median['hardwareGflops'],
+    'nonZeroGflops': median['nonZeroGflops']
+  }
+
+def compare(results, baseline, tolerance):
+  """Prints the kernels side by side; returns the kernels which are slower than the baseline by more than tolerance."""
+  regressions = []
+  print('{:12} {:>12} {:>12} {:>8}'.format('kernel', 'time [s]', 'baseline', 'ratio'))
+  for kernel, result in results['kernels'].items():
+    reference = baseline['kernels'].get(kernel)
+    if reference is None or reference['time'] <= 0.0:
+      print('{:12} {:>12.6f} {:>12} {:>8}'.format(kernel, result['time'], '-', '-'))
+      continue
+    ratio = result['time'] / reference['time']
+    flag = ''
+    if ratio > 1.0 + tolerance:
+      regressions.append(kernel)
+      flag = '  <- slower'
+    elif ratio < 1.0 - tolerance:
+      flag = '  <- faster'
+    print('{:12} {:>12.6f} {:>12.6f} {:>8.3f}{}'.format(kernel, result['time'], reference['time'], ratio, flag))
+  return regressions
+
+def main():
+  scriptDir = os.path.dirname(os.path.abspath(__file__))
+  sourceDir = os.path.abspath(os.path.join(scriptDir, '..', '..'))
+
+  parser = argparse.ArgumentParser(description='Measures the kernels with SeisSol-proxy and compares them with a baseline.')
+  parser.add_argument('--proxy', required=True, help='SeisSol_proxy executable of the configuration')
+  parser.add_argument('--workingDir', required=True)
+  parser.add_argument('--equations', default='elastic')
+  parser.add_argument('--order', required=True, type=int)
+  parser.add_argument('--precision', default='double', choices=['double', 'single'])
+  parser.add_argument('--hostArch', required=True, help='HOST_ARCH as given to cmake, e.g. skx')
+  parser.add_argument('--deviceArch', default='none', help='DEVICE_ARCH as given to cmake for GPU builds, e.g. sm_80')
+  parser.add_argument('--kernels', default=DEFAULT_KERNELS, help='comma-separated list of proxy kernels')
+  parser.add_argument('--cells', default=100000, type=int)
+  parser.add_argument('--timesteps', default=20, type=int)
+  parser.add_argument('--repetitions', default=5, type=int)
+  parser.add_argument('--tolerance', default=0.1, type=float,
+                      help='relative slowdown of the median time which counts as regression')
+  parser.add_argument('--baseline', default=None,
+                      help='baseline file (default: auto_tuning/benchmarks/<arch>[_<deviceArch>]_<equations>_O<order>_<precision>.json)')
+  parser.add_argument('--update', action='store_true', help='store the results as new baseline')
+  args = parser.parse_args()
+
+  os.makedirs(args.workingDir, exist_ok=True)
+  attributes = [args.hostArch, args.equations, 'O{}'.format(args.order), args.precision[0]]
+  if args.deviceArch != 'none':
+    attributes.insert(1, args.deviceArch)
+  name = '_'.join(attributes)
+  baselineFile = args.baseline or os.path.join(sourceDir, 'auto_tuning', 'benchmarks', name + '.json')
+
+  results = {
+    'configuration': {
+      'hostArch': args.hostArch,
+      'deviceArch': args.deviceArch,
+      'equations': args.equations,
+      'order': args.order,
+      'precision': args.precision,
+      'cpu': cpuModel(),
+      'threads': os.environ.get('OMP_NUM_THREADS', str(os.cpu_count()))
+    },
+    'date': datetime.date.today().isoformat(),
+    'cells': args.cells,
+    'timesteps': args.timesteps,
+    'repetitions': args.repetitions,
+    'kernels': {}
+  }
+  for kernel in args.kernels.split(','):
+    result = measure(args, kernel)
+    if result is not None:
+      results['kernels'][kernel] = result
+      print('{:12} {:>12.6f} s {:>10.2f} GFLOPS'.format(kernel, result['time'], result['hardwareGflops']), flush=True)
+  if not results['kernels']:
+    sys.exit('No kernel could be measured.')
+
+  resultFile = os.path.join(args.workingDir, name + '.json')
+  with open(resultFile, 'w') as f:
+    json.dump(results, f, indent=2)
+  print('Wrote {}'.format(resultFile))
+
+  if args.update or not os.path.exists(baselineFile):
+    os.makedirs(os.path.dirname(os.path.abspath(baselineFile)), exist_ok=True)
+    with open(baselineFile, 'w') as f:
+      json.dump(results, f, indent=2)
+    print('Stored the baseline {}'.format(baselineFile))
+    return
+
+  with open(baselineFile) as f:
+    baseline = json.load(f)
+  for key in ['cpu', 'threads']:
+    if baseline['configuration'].get(key) != results['configuration'][key]:
+      print('Warning: the baseline was measured with {} {}, this run with {}'.format(
+        key, baseline['configuration'].get(key), results['configuration'][key]))
+  if baseline.get('cells') != args.cells or baseline.get('timesteps') != args.timesteps:
+    print('Warning: the baseline was measured with {} cells and {} time steps'.format(
+      baseline.get('cells'), baseline.get('timesteps')))
+
+  regressions = compare(results, baseline, args.tolerance)
+  if regressions:
+    sys.exit('Slower than the baseline {} by more than {:.0%}: {}'.format(
+      baselineFile, args.tolerance, ', '.join(regressions)))
+  print('No kernel is slower than the baseline by more than {:.0%}'.format(args.tolerance))
+
+if __name__ == '__main__':
+  main()
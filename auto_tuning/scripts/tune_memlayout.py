@@ -0,0 +1,216 @@
+#!/usr/bin/env python3
+##
+# @file
+# This file is part of SeisSol.
+#
+# @section LICENSE
+# Copyright (c) 2026, SeisSol Group
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice,
+#    this list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+#    contributors may be used to endorse or promote products derived from this
+#    software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+# LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+# CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+# SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+# INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+# CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+#
+# @section DESCRIPTION
+# Selects the memory layout (sparse or dense per matrix) and the GEMM tools by
+# building and running SeisSol-proxy for every candidate on the current node.
+# The best layout is written such that memlayout.guessMemoryLayout picks it up.
+#
+
+import argparse
+import glob
+import os
+import re
+import statistics
+import subprocess
+import sys
+import xml.etree.ElementTree as etree
+
+GROUPS = {
+  'stiffnessTransposed': ['kDivMT(0)', 'kDivMT(1)', 'kDivMT(2)'],
+  'stiffness': ['kDivM(0)', 'kDivM(1)', 'kDivM(2)']
+}
+
+def candidateMatrices(equations):
+  """Matrices (or groups) which may be stored sparse."""
+  candidates = [{'group': 'stiffnessTransposed'}, {'group': 'stiffness'}, {'name': 'star'}]
+  for prefix in ['fMrT', 'rDivM', 'rT']:
+    candidates += [{'name': '{}({})'.format(prefix, i)} for i in range(4)]
+  candidates += [{'name': 'fP({})'.format(i)} for i in range(1, 3)]
+  if equations.startswith('viscoelastic'):
+    candidates.append({'name': 'ET'})
+  return candidates
+
+def label(candidate):
+  return candidate.get('group', candidate.get('name'))
+
+def writeLayout(fileName, sparseMatrices, comment=None):
+  root = etree.Element('memory_layouts')
+  if comment:
+    root.append(etree.Comment(comment))
+  for name, matrices in GROUPS.items():
+    group = etree.SubElement(root, 'group', {'name': name})
+    for matrix in matrices:
+      etree.SubElement(group, 'matrix', {'name': matrix})
+  for candidate in sparseMatrices:
+    attributes = dict(candidate)
+    attributes['sparse'] = 'True'
+    etree.SubElement(root, 'matrix', attributes)
+  if hasattr(etree, 'indent'):
+    etree.indent(root)
+  etree.ElementTree(root).write(fileName)
+
+def run(command, logFile):
+  with open(logFile, 'w') as log:
+    result = subprocess.run(command, stdout=log, stderr=subprocess.STDOUT)
+  if result.returncode != 0:
+    raise RuntimeError('{} failed, see {}'.format(' '.join(command), logFile))
+
+def measure(args, name, layoutFile, gemmTools):
+  """Builds SeisSol-proxy with the given layout and GEMM tools and returns the median run time."""
+  buildDir = os.path.join(args.workingDir, 'build_' + name)
+  logPrefix = os.path.join(args.workingDir, name)
+  run(['cmake', '-S', args.sourceDir, '-B', buildDir,
+       '-DCMAKE_BUILD_TYPE=Release',
+       '-DEQUATIONS=' + args.equations,
+       '-DORDER={}'.format(args.order),
+       '-DNUMBER_OF_MECHANISMS={}'.format(args.numberOfMechanisms),
+       '-DPRECISION=' + args.precision,
+       '-DHOST_ARCH=' + args.hostArch,
+       '-DNUMBER_OF_FUSED_SIMULATIONS={}'.format(args.multipleSimulations),
+       '-DMEMORY_LAYOUT=' + os.path.abspath(layoutFile),
+       '-DGEMM_TOOLS_LIST=' + gemmTools] + args.cmakeArgs,
+      logPrefix + '.configure')
+  run(['cmake', '--build', buildDir, '--target', 'SeisSol-proxy', '-j', str(args.jobs)], logPrefix + '.build')
+
+  proxy = glob.glob(os.path.join(buildDir, 'SeisSol_proxy_*'))
+  if len(proxy) != 1:
+    raise RuntimeError('Could not find the proxy executable in ' + buildDir)
+
+  times = []
+  timePattern = re.compile(r'^time for seissol proxy\s*:\s*([0-9\.eE+-]+)', re.MULTILINE)
+  for repetition in range(args.repetitions):
+    logFile = '{}.run{}'.format(logPrefix, repetition)
+    run([proxy[0], str(args.cells), str(args.timesteps), args.kernel], logFile)
+    with open(logFile) as f:
+      match = timePattern.search(f.read())
+    if not match:
+      raise RuntimeError('No time found in ' + logFile)
+    times.append(float(match.group(1)))
+  time = statistics.median(times)
+  print('{:40} {:>12.6f} s'.format(name, time), flush=True)
+  return time
+
+def tune(args, gemmTools):
+  """Greedy selection: every matrix which is faster sparse than dense is stored sparse."""
+  tag = re.sub(r'[^A-Za-z0-9]', '-', gemmTools)
+  layoutDir = os.path.join(args.workingDir, 'layouts')
+
+  denseFile = os.path.join(layoutDir, '{}_dense.xml'.format(tag))
+  writeLayout(denseFile, [])
+  denseTime = measure(args, '{}_dense'.format(tag), denseFile, gemmTools)
+
+  faster = []
+  for candidate in candidateMatrices(args.equations):
+    name = '{}_{}'.format(tag, re.sub(r'[^A-Za-z0-9]', '', label(candidate)))
+    layoutFile = os.path.join(layoutDir, name + '.xml')
+    writeLayout(layoutFile, [candidate])
+    try:
+      time = measure(args, name, layoutFile, gemmTools)
+    except RuntimeError as error:
+      print('Warning: skipping {} ({})'.format(label(candidate), error))
+      continue
+    if time < denseTime:
+      faster.append((time, candidate))
+
+  best = (denseTime, [])
+  if faster:
+    faster.sort(key=lambda entry: entry[0])
+    best = min(best, (faster[0][0], [faster[0][1]]), key=lambda entry: entry[0])
+    if len(faster) > 1:
+      combined = [candidate for _, candidate in faster]
+      combinedFile = os.path.join(layoutDir, '{}_combined.xml'.format(tag))
+      writeLayout(combinedFile, combined)
+      combinedTime = measure(args, '{}_combined'.format(tag), combinedFile, gemmTools)
+      best = min(best, (combinedTime, combined), key=lambda entry: entry[0])
+  return best
+
+def main():
+  scriptDir = os.path.dirname(os.path.abspath(__file__))
+  sourceDir = os.path.abspath(os.path.join(scriptDir, '..', '..'))
+
+  parser = argparse.ArgumentParser(description='Tunes the memory layout of the generated kernels on this node.')
+  parser.add_argument('--sourceDir', default=sourceDir)
+  parser.add_argument('--workingDir', required=True)
+  parser.add_argument('--equations', default='elastic')
+  parser.add_argument('--order', required=True, type=int)
+  parser.add_argument('--numberOfMechanisms', default=0, type=int)
+  parser.add_argument('--precision', default='double', choices=['double', 'single'])
+  parser.add_argument('--hostArch', required=True, help='HOST_ARCH as given to cmake, e.g. skx')
+  parser.add_argument('--multipleSimulations', default=1, type=int)
+  parser.add_argument('--gemmTools', default='LIBXSMM,PSpaMM;LIBXSMM;Eigen',
+                      help='semicolon-separated list of GEMM_TOOLS_LIST values to compare')
+  parser.add_argument('--cells', default=100000, type=int)
+  parser.add_argument('--timesteps', default=20, type=int)
+  parser.add_argument('--kernel', default='all')
+  parser.add_argument('--repetitions', default=3, type=int)
+  parser.add_argument('--jobs', default=os.cpu_count(), type=int)
+  parser.add_argument('--output', default=None,
+                      help='layout file to write (default: auto_tuning/config/<arch>_<equations>_O<order>_<precision>.xml)')
+  parser.add_argument('cmakeArgs', nargs='*', help='additional cmake arguments (after --)')
+  args = parser.parse_args()
+
+  if args.numberOfMechanisms == 0 and args.equations.startswith('viscoelastic'):
+    raise ValueError('The number of mechanisms must be greater than 0 for equations=viscoelastic.')
+
+  os.makedirs(os.path.join(args.workingDir, 'layouts'), exist_ok=True)
+
+  results = []
+  for gemmTools in args.gemmTools.split(';'):
+    try:
+      time, sparseMatrices = tune(args, gemmTools)
+    except RuntimeError as error:
+      print('Warning: GEMM tools {} are not usable ({})'.format(gemmTools, error))
+      continue
+    results.append((time, gemmTools, sparseMatrices))
+  if not results:
+    sys.exit('No configuration could be built and run.')
+
+  time, gemmTools, sparseMatrices = min(results, key=lambda entry: entry[0])
+
+  # file name attributes as parsed by generated_code/memlayout.py
+  attributes = [args.hostArch, args.equations, 'O{}'.format(args.order), args.precision[0]]
+  if args.multipleSimulations > 1:
+    attributes.append('ms{}'.format(args.multipleSimulations))
+  output = args.output or os.path.join(args.sourceDir, 'auto_tuning', 'config', '_'.join(attributes) + '.xml')
+
+  comment = ' Tuned with auto_tuning/scripts/tune_memlayout.py: proxy kernel {}, {} cells, {} time steps, '\
+            'median time {:.6f} s. Best with -DGEMM_TOOLS_LIST={} '.format(args.kernel, args.cells, args.timesteps, time, gemmTools)
+  writeLayout(output, sparseMatrices, comment)
+  print('Sparse: {}'.format(', '.join(label(candidate) for candidate in sparseMatrices) or 'none'))
+  print('Wrote {} (use it with -DGEMM_TOOLS_LIST="{}")'.format(output, gemmTools))
+
+if __name__ == '__main__':
+  main()
@@ -65,6 +65,21 @@ set(PLASTICITY_OPTIONS nb ip)
 set_property(CACHE PLASTICITY_METHOD PROPERTY STRINGS ${PLASTICITY_OPTIONS})
 
 
+set(FLUX_SOLVER_PRECISION "native" CACHE STRING "Precision of the stored flux solvers of the cells: native (as PRECISION) or single (double precision CPU builds only)")
+set(FLUX_SOLVER_PRECISION_OPTIONS native single)
+set_property(CACHE FLUX_SOLVER_PRECISION PROPERTY STRINGS ${FLUX_SOLVER_PRECISION_OPTIONS})
+
+set(STAR_MATRICES "stored" CACHE STRING "Star matrices of the cells: stored, or recomputed from the material in each time step (only elastic on GPUs)")
+set(STAR_MATRICES_OPTIONS stored recomputed)
+set_property(CACHE STAR_MATRICES PROPERTY STRINGS ${STAR_MATRICES_OPTIONS})
+
+set(DEVICE_GEMM_FUSION "auto" CACHE STRING "Fuse the GEMM chains of the device kernels with ChainForge: auto (if installed), on or off (GemmForge only)")
+set(DEVICE_GEMM_FUSION_OPTIONS auto on off)
+set_property(CACHE DEVICE_GEMM_FUSION PROPERTY STRINGS ${DEVICE_GEMM_FUSION_OPTIONS})
+
+option(FUSED_LOCAL_INTEGRAL "Compute the volume integral and the local flux of a cell in one kernel (not for viscoelastic2)" OFF)
+
+
 set(NUMBER_OF_FUSED_SIMULATIONS 1 CACHE STRING "A number of fused simulations")
 
 
@@ -74,6 +89,14 @@ option(COMMTHREAD "Use a communication thread for MPI+MP." OFF)
 
 option(NUMA_AWARE_PINNING "Use libnuma to pin threads to correct NUMA nodes" ON)
 
+option(HWLOC "Use hwloc to pin the OpenMP workers (SEISSOL_PINNING=auto)" OFF)
+
+option(HARDWARE_COUNTERS "Read Linux perf events in the loop statistics regions (SEISSOL_HARDWARE_COUNTERS)" OFF)
+
+option(GDS "Write checkpoints from device memory with GPUDirect Storage (cuFile, requires DEVICE_BACKEND=cuda)" OFF)
+
+option(ADIOS2 "Use ADIOS2 for the wave field, free surface and fault output (xdmfWriterBackend = 'adios2')" OFF)
+
 option(PROXY_PYBINDING "enable pybind11 for proxy (everything will be compiled with -fPIC)" OFF)
 
 set(LOG_LEVEL "warning" CACHE STRING "Log level for the code")
@@ -113,6 +136,9 @@ check_parameter("EQUATIONS" ${EQUATIONS} "${EQUATIONS_OPTIONS}")
 check_parameter("PRECISION" ${PRECISION} "${PRECISION_OPTIONS}")
 check_parameter("DYNAMIC_RUPTURE_METHOD" ${DYNAMIC_RUPTURE_METHOD} "${RUPTURE_OPTIONS}")
 check_parameter("PLASTICITY_METHOD" ${PLASTICITY_METHOD} "${PLASTICITY_OPTIONS}")
+check_parameter("FLUX_SOLVER_PRECISION" ${FLUX_SOLVER_PRECISION} "${FLUX_SOLVER_PRECISION_OPTIONS}")
+check_parameter("STAR_MATRICES" ${STAR_MATRICES} "${STAR_MATRICES_OPTIONS}")
+check_parameter("DEVICE_GEMM_FUSION" ${DEVICE_GEMM_FUSION} "${DEVICE_GEMM_FUSION_OPTIONS}")
 check_parameter("LOG_LEVEL" ${LOG_LEVEL} "${LOG_LEVEL_OPTIONS}")
 check_parameter("LOG_LEVEL_MASTER" ${LOG_LEVEL_MASTER} "${LOG_LEVEL_MASTER_OPTIONS}")
 
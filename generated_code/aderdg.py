@@ -247,6 +247,19 @@ class LinearADERDG(ADERDGBase):
       volume = (self.Q['kp'] <= volumeSum)
       generator.add(f'{name_prefix}volume', volume, target=target)
 
+      if target == 'cpu':
+        # volume integral and local flux over all four faces in one pass (USE_FUSED_LOCAL_INTEGRAL)
+        fluxSolverSpp = self.flux_solver_spp()
+        AplusTFace = [Tensor(f'AplusTFace({i})', fluxSolverSpp.shape, spp=fluxSolverSpp) for i in range(4)]
+        fusedSum = self.Q['kp']
+        for i in range(3):
+          fusedSum += self.db.kDivM[i][self.t('kl')] * self.I['lq'] * self.starMatrix(i)['qp']
+        if self.sourceMatrix():
+          fusedSum += self.I['kq'] * self.sourceMatrix()['qp']
+        for i in range(4):
+          fusedSum += self.db.rDivM[i][self.t('km')] * self.db.fMrT[i][self.t('ml')] * self.I['lq'] * AplusTFace[i]['qp']
+        generator.add('volumeLocalFlux', self.Q['kp'] <= fusedSum, target=target)
+
       localFlux = lambda i: self.Q['kp'] <= self.Q['kp'] + self.db.rDivM[i][self.t('km')] * self.db.fMrT[i][self.t('ml')] * self.I['lq'] * self.AplusT['qp']
       localFluxPrefetch = lambda i: self.I if i == 0 else (self.Q if i == 1 else None)
       generator.addFamily(f'{name_prefix}localFlux',
@@ -69,6 +69,7 @@ cmdLineParser.add_argument('--multipleSimulations', type=int)
 cmdLineParser.add_argument('--dynamicRuptureMethod')
 cmdLineParser.add_argument('--PlasticityMethod')
 cmdLineParser.add_argument('--gemm_tools')
+cmdLineParser.add_argument('--device_gemm_fusion', choices=['auto', 'on', 'off'], default='auto')
 cmdLineArgs = cmdLineParser.parse_args()
 
 # derive the compute platform
@@ -157,12 +158,14 @@ for tool in gemm_tool_list:
 
 
 cost_estimators = BoundingBoxCostEstimator
-if 'gpu' in targets and cmdLineArgs.equations == 'elastic':
+if 'gpu' in targets and cmdLineArgs.equations == 'elastic' and cmdLineArgs.device_gemm_fusion != 'off':
   try:
     chainforge_spec = importlib.util.find_spec('chainforge')
     chainforge_spec.loader.load_module()
     cost_estimators = FusedGemmsBoundingBoxCostEstimator
   except:
+    if cmdLineArgs.device_gemm_fusion == 'on':
+      sys.exit('ChainForge was not found, but DEVICE_GEMM_FUSION=on')
     print('WARNING: ChainForge was not found. Falling back to GemmForge.')
 
 
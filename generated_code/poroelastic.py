@@ -7,6 +7,7 @@ from yateto.input import parseXMLMatrixFile, parseJSONMatrixFile, memoryLayoutFr
 from yateto.ast.transformer import DeduceIndices, EquivalentSparsityPattern
 
 from aderdg import LinearADERDG
+from common import generate_kernel_name_prefix
 from multSim import OptionalDimTensor
 
 def choose(n, k):
@@ -26,6 +27,13 @@ class PoroelasticADERDG(LinearADERDG):
 
     memoryLayoutFromFile(memLayout, self.db, clones)
 
+    # G = E - diag(E) as a matrix, i.e. with the non-zero entries at (o-4, o) for o >= 10,
+    # as the batched device kernels can not use scalars which differ per cell
+    GSpp = np.zeros((self.numberOfQuantities(), self.numberOfQuantities()), dtype=bool)
+    for o in range(10, 13):
+      GSpp[o-4, o] = True
+    self.Gmatrix = Tensor('Gmatrix', GSpp.shape, spp=GSpp)
+
   def numberOfQuantities(self):
     return 13 
 
@@ -131,25 +139,37 @@ class PoroelasticADERDG(LinearADERDG):
       stiffnessSpp[:,Bn_1:Bn] = -stiffnessValues[d][:,Bn_1:Bn]
       return Tensor('kDivMTSub({},{})'.format(d,n), fullShape, spp=stiffnessSpp)
 
-    kernels = list()
-
-    kernels.append( spaceTimePredictorRhs['kpt'] <= self.Q['kp'] * self.db.wHat['t'] )
-    for n in range(self.order-1,-1,-1):
-      for o in range(self.numberOfQuantities()-1,-1,-1):
-        kernels.append( spaceTimePredictor['kpt'] <= spaceTimePredictor['kpt'] + selectModes(n)['kl'] * selectQuantity(o)['pq'] * spaceTimePredictorRhs['lqu'] * Zinv(o)['ut'] )
-        #G only has one relevant non-zero entry in each iteration, so we make it a scalar
-        #G[o] = E[o-4, o] * timestep
-        #In addition E only has non-zero entries, if o > 10
-        if o >= 10:
-          kernels.append( spaceTimePredictorRhs['kpt'] <= spaceTimePredictorRhs['kpt'] + G[o] * selectQuantityG(o)['pv'] * selectQuantity(o)['vq'] * selectModes(n)['kl'] * spaceTimePredictor['lqt'] )
-      if n > 0:
-        derivativeSum = spaceTimePredictorRhs['kpt']
-        for d in range(3):
-          derivativeSum += kSub(d,n)['kl'] * spaceTimePredictor['lqt'] * self.starMatrix(d)['qp']
-      kernels.append( spaceTimePredictorRhs['kpt'] <=  derivativeSum )
-    kernels.append( self.I['kp'] <= timestep * spaceTimePredictor['kpt'] * self.db.timeInt['t'] )
-
-    generator.add('spaceTimePredictor', kernels)
+    for target in targets:
+      name_prefix = generate_kernel_name_prefix(target)
+      # libxsmm can not generate GEMMs with alpha != 1, hence the host kernel gets the star matrices
+      # and G multiplied with the time step width, while the device kernel scales them itself
+      onDevice = target == 'gpu'
+
+      kernels = list()
+
+      kernels.append( spaceTimePredictorRhs['kpt'] <= self.Q['kp'] * self.db.wHat['t'] )
+      for n in range(self.order-1,-1,-1):
+        for o in range(self.numberOfQuantities()-1,-1,-1):
+          kernels.append( spaceTimePredictor['kpt'] <= spaceTimePredictor['kpt'] + selectModes(n)['kl'] * selectQuantity(o)['pq'] * spaceTimePredictorRhs['lqu'] * Zinv(o)['ut'] )
+          #G only has one relevant non-zero entry in each iteration, so we make it a scalar
+          #G[o] = E[o-4, o] * timestep
+          #In addition E only has non-zero entries, if o > 10
+          if o >= 10:
+            if onDevice:
+              kernels.append( spaceTimePredictorRhs['kpt'] <= spaceTimePredictorRhs['kpt'] + timestep * self.Gmatrix['pv'] * selectQuantity(o)['vq'] * selectModes(n)['kl'] * spaceTimePredictor['lqt'] )
+            else:
+              kernels.append( spaceTimePredictorRhs['kpt'] <= spaceTimePredictorRhs['kpt'] + G[o] * selectQuantityG(o)['pv'] * selectQuantity(o)['vq'] * selectModes(n)['kl'] * spaceTimePredictor['lqt'] )
+        if n > 0:
+          derivativeSum = spaceTimePredictorRhs['kpt']
+          for d in range(3):
+            if onDevice:
+              derivativeSum += timestep * kSub(d,n)['kl'] * spaceTimePredictor['lqt'] * self.starMatrix(d)['qp']
+            else:
+              derivativeSum += kSub(d,n)['kl'] * spaceTimePredictor['lqt'] * self.starMatrix(d)['qp']
+        kernels.append( spaceTimePredictorRhs['kpt'] <=  derivativeSum )
+      kernels.append( self.I['kp'] <= timestep * spaceTimePredictor['kpt'] * self.db.timeInt['t'] )
+
+      generator.add(f'{name_prefix}spaceTimePredictor', kernels, target=target)
 
     # Test to see if the kernel actually solves the system of equations
     # This part is not used in the time kernel, but for unit testing
@@ -171,3 +191,4 @@ class PoroelasticADERDG(LinearADERDG):
   def add_include_tensors(self, include_tensors):
     super().add_include_tensors(include_tensors)
     include_tensors.add(self.db.Z)
+    include_tensors.add(self.Gmatrix)
@@ -0,0 +1,206 @@
+#!/usr/bin/env python3
+# Reconstructs the critical path of the LTS actors from the actor trace (SEISSOL_ACTOR_TRACE_PREFIX)
+# and attributes the idle time of the time clusters to MPI waits, dependencies on other clusters,
+# synchronization points and scheduling. Across the ranks, the compute time per synchronization
+# interval yields the load imbalance.
+import argparse
+import bisect
+import collections
+import csv
+import glob
+import re
+
+parser = argparse.ArgumentParser(description="critical path and idle time analysis of the actor trace")
+parser.add_argument("prefix", help="SEISSOL_ACTOR_TRACE_PREFIX of the run")
+parser.add_argument("--csv", help="write the idle time per rank and actor to this file", type=str)
+parser.add_argument("--rank", help="only print the critical paths of this rank", type=int)
+args = parser.parse_args()
+
+IdleCategories = ["mpi", "dependency", "sync", "scheduling"]
+
+
+class Actor:
+    def __init__(self, kind, cluster, other):
+        self.kind = kind
+        self.cluster = cluster
+        self.other = other
+        self.actions = []
+        self.receives = []
+
+    def name(self):
+        if self.kind == "ghost":
+            return f"ghost {self.cluster}->{self.other}"
+        return f"{self.kind} {self.cluster}"
+
+
+class Rank:
+    def __init__(self, prefix):
+        self.actors = {}
+        with open(prefix + ".actors.csv") as f:
+            for row in csv.DictReader(f):
+                self.actors[int(row["actor"])] = Actor(row["kind"], int(row["cluster"]), int(row["other_cluster"]))
+        sends = []
+        with open(prefix + ".events.csv") as f:
+            for row in csv.DictReader(f):
+                actor = self.actors[int(row["actor"])]
+                begin, end, message = int(row["begin"]), int(row["end"]), int(row["message"])
+                if row["type"] == "action":
+                    actor.actions.append((begin, end, row["kind"]))
+                elif row["type"] == "send":
+                    sends.append((int(row["actor"]), begin, message))
+                else:
+                    actor.receives.append((begin, message))
+        for actor in self.actors.values():
+            actor.actions.sort()
+            actor.receives.sort()
+            actor.begins = [a[0] for a in actor.actions]
+            actor.receiveTimes = [r[0] for r in actor.receives]
+        # message -> (sender, index of the action which sent it, time of the send)
+        self.sends = {}
+        for sender, time, message in sends:
+            index = bisect.bisect_right(self.actors[sender].begins, time) - 1
+            self.sends[message] = (sender, index, time)
+
+    def enablingMessage(self, actorId, index):
+        """The latest message sent after the previous action, which was received before the action"""
+        actor = self.actors[actorId]
+        begin = actor.actions[index][0]
+        previousEnd = actor.actions[index - 1][1] if index > 0 else -1
+        first = bisect.bisect_right(actor.receiveTimes, previousEnd)
+        last = bisect.bisect_right(actor.receiveTimes, begin)
+        latest = None
+        for _, message in actor.receives[first:last]:
+            send = self.sends.get(message)
+            if send is not None and send[2] > previousEnd and (latest is None or send[2] > latest[2]):
+                latest = send
+        return latest
+
+    def classifyGap(self, actorId, index):
+        actor = self.actors[actorId]
+        if actor.actions[index][2] == "restart":
+            return "sync"
+        message = self.enablingMessage(actorId, index)
+        if message is None:
+            return "mpi" if actor.kind == "ghost" else "scheduling"
+        return "mpi" if self.actors[message[0]].kind == "ghost" else "dependency"
+
+    def idleTime(self):
+        """Idle time between consecutive actions per local actor and category (in seconds)"""
+        idle = {}
+        for actorId, actor in self.actors.items():
+            if actor.kind == "ghost":
+                continue
+            categories = collections.Counter()
+            for index in range(1, len(actor.actions)):
+                gap = actor.actions[index][0] - actor.actions[index - 1][1]
+                categories[self.classifyGap(actorId, index)] += 1e-9 * gap
+            idle[actorId] = categories
+        return idle
+
+    def epochs(self):
+        """Index ranges of the actions of each actor per synchronization interval"""
+        epochs = collections.defaultdict(dict)
+        for actorId, actor in self.actors.items():
+            start = 0
+            epoch = 0
+            for index, action in enumerate(actor.actions):
+                if action[2] == "sync":
+                    epochs[epoch][actorId] = (start, index)
+                    start = index + 1
+                    epoch += 1
+        return [epochs[e] for e in sorted(epochs)]
+
+    def computeTime(self, epoch):
+        total = 0.0
+        for actorId, (first, last) in epoch.items():
+            actor = self.actors[actorId]
+            if actor.kind != "ghost":
+                total += sum(1e-9 * (a[1] - a[0]) for a in actor.actions[first:last + 1] if a[2] in ("predict", "correct", "correct-predict"))
+        return total
+
+    def criticalPath(self, epoch):
+        """Walks back from the actor which reached the synchronization point last"""
+        local = [a for a in epoch if self.actors[a].kind != "ghost"]
+        if not local:
+            return None
+        actorId = max(local, key=lambda a: self.actors[a].actions[epoch[a][1]][1])
+        index = epoch[actorId][1]
+        first = epoch[actorId][0]
+        compute = collections.Counter()
+        waits = collections.Counter()
+        end = self.actors[actorId].actions[index][1]
+        while True:
+            actor = self.actors[actorId]
+            begin, finish, kind = actor.actions[index]
+            if kind in ("predict", "correct", "correct-predict") and actor.kind != "ghost":
+                compute[actor.name()] += 1e-9 * (finish - begin)
+            if kind == "restart" or index <= first:
+                start = begin
+                break
+            message = self.enablingMessage(actorId, index)
+            category = self.classifyGap(actorId, index)
+            if message is not None and message[0] != actorId:
+                # the path continues at the action of the sender
+                waits[category] += 1e-9 * (begin - message[2])
+                actorId, index = message[0], message[1]
+                first = epoch.get(actorId, (0, 0))[0]
+            else:
+                waits[category] += 1e-9 * (begin - actor.actions[index - 1][1])
+                index -= 1
+        return 1e-9 * (end - start), compute, waits
+
+
+files = sorted(glob.glob(args.prefix + ".*.actors.csv"), key=lambda f: int(re.search(r"\.(\d+)\.actors\.csv$", f).group(1)))
+if not files:
+    raise SystemExit(f"no actor trace found for {args.prefix}")
+ranks = [Rank(f[: -len(".actors.csv")]) for f in files]
+
+# Load imbalance: the compute time of each synchronization interval compared to the slowest rank
+epochsPerRank = [rank.epochs() for rank in ranks]
+numberOfEpochs = min(len(e) for e in epochsPerRank)
+imbalance = [0.0] * len(ranks)
+slowest = collections.Counter()
+for e in range(numberOfEpochs):
+    compute = [rank.computeTime(epochsPerRank[r][e]) for r, rank in enumerate(ranks)]
+    maxCompute = max(compute)
+    slowest[compute.index(maxCompute)] += 1
+    for r in range(len(ranks)):
+        imbalance[r] += maxCompute - compute[r]
+
+print(f"{len(ranks)} ranks, {numberOfEpochs} synchronization intervals")
+print("rank  " + "".join(f"{c:>12}" for c in IdleCategories) + f"{'imbalance':>12}{'slowest':>9}")
+rows = []
+for r, rank in enumerate(ranks):
+    idle = rank.idleTime()
+    totals = collections.Counter()
+    for actorId, categories in idle.items():
+        totals.update(categories)
+        rows.append([r, rank.actors[actorId].name()] + [categories[c] for c in IdleCategories])
+    print(f"{r:<6}" + "".join(f"{totals[c]:12.4g}" for c in IdleCategories) + f"{imbalance[r]:12.4g}{slowest[r]:9d}")
+print("Idle times are summed over the actors of a rank (in seconds); the imbalance is the compute time of the slowest rank")
+print("minus the compute time of the rank, summed over the synchronization intervals.")
+
+for r, rank in enumerate(ranks):
+    if args.rank is not None and r != args.rank:
+        continue
+    compute = collections.Counter()
+    waits = collections.Counter()
+    length = 0.0
+    for epoch in epochsPerRank[r]:
+        path = rank.criticalPath(epoch)
+        if path is not None:
+            length += path[0]
+            compute.update(path[1])
+            waits.update(path[2])
+    print(f"\nCritical path of rank {r}: {length:.4g} s")
+    for name, time in compute.most_common():
+        print(f"  {name:<20}{time:12.4g} s ({100.0 * time / length:.1f}%)" if length > 0 else f"  {name}")
+    for category in IdleCategories:
+        if waits[category] > 0:
+            print(f"  wait: {category:<14}{waits[category]:12.4g} s ({100.0 * waits[category] / length:.1f}%)")
+
+if args.csv:
+    with open(args.csv, "w") as f:
+        writer = csv.writer(f)
+        writer.writerow(["rank", "actor"] + IdleCategories)
+        writer.writerows(rows)
@@ -0,0 +1,193 @@
+#!/usr/bin/env python3
+# Runs SeisSol on generated box meshes (meshgenerator = 'CubeGenerator') for a series of rank counts
+# and collects the scaling reports (SEISSOL_SCALING_REPORT) of the runs into one CSV file.
+# Weak scaling keeps the number of cubes per rank fixed, strong scaling the total number of cubes.
+# The edge length of the cubes is the same in all runs, hence all runs have the same time step.
+import argparse
+import csv
+import json
+import os
+import shlex
+import subprocess
+import sys
+
+parser = argparse.ArgumentParser(description="weak and strong scaling benchmark on generated box meshes")
+parser.add_argument("seissol", help="SeisSol executable")
+parser.add_argument("--mode", choices=["weak", "strong"], default="weak")
+parser.add_argument("--ranks", default="1,2,4,8", help="comma separated list of rank counts")
+parser.add_argument(
+    "--cubes", default="16,16,16", help="cubes in x,y,z per rank (weak) or in total (strong)"
+)
+parser.add_argument("--steps", type=int, default=100, help="number of time steps")
+parser.add_argument("--edge", type=float, default=100.0, help="edge length of the cubes in m")
+parser.add_argument(
+    "--timeStep", type=float, default=1e-4, help="time step in s (has to satisfy the CFL condition)"
+)
+parser.add_argument("--lts", type=int, default=1, help="ClusteredLTS of the runs (1 = global time stepping)")
+parser.add_argument(
+    "--launcher",
+    default="mpirun -n {ranks}",
+    help="command prefix which starts the MPI ranks, {ranks} is replaced by the number of ranks",
+)
+parser.add_argument("--workingDir", default="scaling-benchmark")
+parser.add_argument("--output", default="scaling.csv", help="CSV file with one row per run")
+args = parser.parse_args()
+
+ParameterFile = """&equations
+MaterialFileName = 'material.yaml'
+/
+&IniCondition
+/
+&Boundaries
+BC_fs = 1
+BC_of = 1
+/
+&DynamicRupture
+FL = 0
+/
+&SourceType
+/
+&SpongeLayer
+/
+&MeshNml
+meshgenerator = 'CubeGenerator'
+cubeX = {cubes[0]}
+cubeY = {cubes[1]}
+cubeZ = {cubes[2]}
+cubePx = {partitions[0]}
+cubePy = {partitions[1]}
+cubePz = {partitions[2]}
+cubeScale = 1.0
+cubeBoundary = 5
+ScalingMatrixX = {size[0]} 0.0 0.0
+ScalingMatrixY = 0.0 {size[1]} 0.0
+ScalingMatrixZ = 0.0 0.0 {size[2]}
+/
+&Discretization
+CFL = 0.5
+FixTimeStep = {timeStep}
+ClusteredLTS = {lts}
+/
+&Output
+OutputFile = 'output/benchmark'
+Format = 10
+printIntervalCriterion = 1
+checkPointInterval = 0
+/
+&AbortCriteria
+EndTime = {endTime}
+/
+&Analysis
+/
+&Debugging
+/
+"""
+
+Material = """!ConstantMap
+map:
+  rho: 2700
+  mu: 3.23980e10
+  lambda: 3.24038e10
+"""
+
+
+def partitionGrid(ranks):
+    """Same grid as seissol::geometry::CubeGenerator::partitionGrid with automatic partitions."""
+    factors = []
+    remaining = ranks
+    factor = 2
+    while remaining > 1:
+        while remaining % factor == 0:
+            factors.append(factor)
+            remaining //= factor
+        factor += 1
+    grid = [1, 1, 1]
+    for factor in reversed(factors):
+        smallest = min(range(3), key=lambda d: (grid[d], d))
+        grid[smallest] *= factor
+    return grid
+
+
+def run(ranks, cubesArgument):
+    partitions = partitionGrid(ranks)
+    if args.mode == "weak":
+        cubes = [c * p for c, p in zip(cubesArgument, partitions)]
+    else:
+        cubes = cubesArgument
+    if any(c < p for c, p in zip(cubes, partitions)):
+        print(f"Skipping {ranks} ranks: {cubes} cubes cannot be distributed to {partitions} partitions")
+        return None
+
+    directory = os.path.join(args.workingDir, f"{args.mode}_{ranks}")
+    os.makedirs(os.path.join(directory, "output"), exist_ok=True)
+    with open(os.path.join(directory, "parameters.par"), "w") as f:
+        f.write(
+            ParameterFile.format(
+                cubes=cubes,
+                partitions=partitions,
+                size=[c * args.edge for c in cubes],
+                timeStep=args.timeStep,
+                lts=args.lts,
+                endTime=args.steps * args.timeStep,
+            )
+        )
+    with open(os.path.join(directory, "material.yaml"), "w") as f:
+        f.write(Material)
+
+    report = os.path.abspath(os.path.join(directory, "report.json"))
+    command = shlex.split(args.launcher.format(ranks=ranks)) + [os.path.abspath(args.seissol), "parameters.par"]
+    env = dict(os.environ, SEISSOL_SCALING_REPORT=report)
+    print(f"Running {ranks} ranks with {cubes[0]}x{cubes[1]}x{cubes[2]} cubes")
+    with open(os.path.join(directory, "seissol.log"), "w") as log:
+        result = subprocess.run(command, cwd=directory, env=env, stdout=log, stderr=subprocess.STDOUT)
+    if result.returncode != 0 or not os.path.exists(report):
+        print(f"The run with {ranks} ranks failed, see {os.path.join(directory, 'seissol.log')}")
+        return None
+    with open(report) as f:
+        return json.load(f)
+
+
+cubesArgument = [int(c) for c in args.cubes.split(",")]
+rows = []
+reference = None
+for ranks in [int(r) for r in args.ranks.split(",")]:
+    report = run(ranks, cubesArgument)
+    if report is None:
+        continue
+    if reference is None:
+        reference = report
+    # Weak scaling: constant time per step, strong scaling: time per step proportional to 1/ranks
+    ideal = reference["time_per_step"]
+    if args.mode == "strong":
+        ideal *= reference["ranks"] / report["ranks"]
+    rows.append(
+        {
+            "ranks": report["ranks"],
+            "threads_per_rank": report["threads_per_rank"],
+            "cells": report["cells"],
+            "time_steps": report["time_steps"],
+            "time_per_step": report["time_per_step"],
+            "cell_updates_per_second": report["cell_updates_per_second"],
+            "compute_time_max": report["compute_time"]["max"],
+            "communication_wait_mean": report["communication_wait"]["mean"],
+            "communication_wait_max": report["communication_wait"]["max"],
+            "imbalance": report["imbalance"],
+            "efficiency": ideal / report["time_per_step"] if report["time_per_step"] > 0 else 0.0,
+        }
+    )
+
+if not rows:
+    sys.exit("No run succeeded")
+
+with open(args.output, "w", newline="") as f:
+    writer = csv.DictWriter(f, fieldnames=list(rows[0].keys()))
+    writer.writeheader()
+    writer.writerows(rows)
+
+print(f"{'ranks':>6} {'cells':>10} {'s/step':>10} {'wait':>8} {'imbalance':>9} {'efficiency':>10}")
+for row in rows:
+    print(
+        f"{row['ranks']:>6} {row['cells']:>10} {row['time_per_step']:>10.4g} {row['communication_wait_max']:>8.3g}"
+        f" {row['imbalance']:>9.3f} {row['efficiency']:>10.3f}"
+    )
+print(f"Wrote {args.output}")
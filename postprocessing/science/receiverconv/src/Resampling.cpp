@@ -0,0 +1,87 @@
+#include "Resampling.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+std::vector<double> receiverconv::resample(const std::vector<double>& times,
+                                           const std::vector<double>& values,
+                                           std::size_t numberOfVariables,
+                                           double interval,
+                                           std::size_t numberOfSamples) {
+  std::vector<double> resampled(numberOfSamples * numberOfVariables, std::numeric_limits<double>::quiet_NaN());
+  if (times.empty()) {
+    return resampled;
+  }
+  // Tolerance for the end points, which are usually output times as well
+  const double tolerance = 1e-9 * interval;
+  std::size_t next = 0;
+  for (std::size_t k = 0; k < numberOfSamples; ++k) {
+    const double time = k * interval;
+    if (time < times.front() - tolerance || time > times.back() + tolerance) {
+      continue;
+    }
+    while (next + 1 < times.size() && times[next + 1] < time) {
+      ++next;
+    }
+    const std::size_t right = std::min(next + 1, times.size() - 1);
+    const double width = times[right] - times[next];
+    const double weight = width > 0.0 ? std::clamp((time - times[next]) / width, 0.0, 1.0) : 0.0;
+    for (std::size_t v = 0; v < numberOfVariables; ++v) {
+      resampled[k * numberOfVariables + v] =
+          (1.0 - weight) * values[next * numberOfVariables + v] + weight * values[right * numberOfVariables + v];
+    }
+  }
+  return resampled;
+}
+
+void receiverconv::lowPassFilter(std::vector<double>& values,
+                                 std::size_t numberOfVariables,
+                                 double interval,
+                                 double cornerFrequency) {
+  // Bilinear transform of the analog filter with the prewarped corner frequency
+  const double k = std::tan(M_PI * cornerFrequency * interval);
+  const double norm = 1.0 / (1.0 + std::sqrt(2.0) * k + k * k);
+  const double b0 = k * k * norm;
+  const double b1 = 2.0 * b0;
+  const double b2 = b0;
+  const double a1 = 2.0 * (k * k - 1.0) * norm;
+  const double a2 = (1.0 - std::sqrt(2.0) * k + k * k) * norm;
+
+  const std::size_t numberOfSamples = numberOfVariables > 0 ? values.size() / numberOfVariables : 0;
+  for (std::size_t v = 0; v < numberOfVariables; ++v) {
+    auto at = [&](std::size_t sample) -> double& { return values[sample * numberOfVariables + v]; };
+    std::size_t begin = 0;
+    while (begin < numberOfSamples && std::isnan(at(begin))) {
+      ++begin;
+    }
+    std::size_t end = numberOfSamples;
+    while (end > begin && std::isnan(at(end - 1))) {
+      --end;
+    }
+    if (end - begin < 2) {
+      continue;
+    }
+
+    // Direct form I, started in the steady state of the first sample to avoid a transient
+    auto pass = [&](auto sample, std::size_t count) {
+      double x1 = at(sample(0));
+      double x2 = x1;
+      double y1 = x1;
+      double y2 = x1;
+      for (std::size_t i = 0; i < count; ++i) {
+        double& value = at(sample(i));
+        const double x0 = value;
+        const double y0 = b0 * x0 + b1 * x1 + b2 * x2 - a1 * y1 - a2 * y2;
+        x2 = x1;
+        x1 = x0;
+        y2 = y1;
+        y1 = y0;
+        value = y0;
+      }
+    };
+    const std::size_t count = end - begin;
+    pass([&](std::size_t i) { return begin + i; }, count);
+    pass([&](std::size_t i) { return end - 1 - i; }, count);
+  }
+}
@@ -0,0 +1,28 @@
+#ifndef RECEIVERCONV_RESAMPLING_H
+#define RECEIVERCONV_RESAMPLING_H
+
+#include <cstddef>
+#include <vector>
+
+namespace receiverconv {
+/**
+ * Interpolates the samples [time][variable] linearly at the times k * interval for k < numberOfSamples.
+ * Times outside of the recorded ones are NaN.
+ */
+std::vector<double> resample(const std::vector<double>& times,
+                             const std::vector<double>& values,
+                             std::size_t numberOfVariables,
+                             double interval,
+                             std::size_t numberOfSamples);
+
+/**
+ * Applies a second order Butterworth low-pass filter forward and backward (i.e. without phase shift) to each
+ * variable of the equidistant samples [time][variable]; NaN samples at the beginning and end are skipped.
+ */
+void lowPassFilter(std::vector<double>& values,
+                   std::size_t numberOfVariables,
+                   double interval,
+                   double cornerFrequency);
+} // namespace receiverconv
+
+#endif // RECEIVERCONV_RESAMPLING_H
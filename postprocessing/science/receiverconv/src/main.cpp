@@ -0,0 +1,334 @@
+/**
+ * Converts the ASCII receiver or fault receiver files of a SeisSol run into a single HDF5 file with the same
+ * layout as the HDF5 receiver output of SeisSol (SEISSOL_RECEIVER_OUTPUT=hdf5):
+ *
+ *   /points      receivers x 3 coordinates
+ *   /time        time steps
+ *   /receivers   time steps x receivers x variables, with the attribute "variables" (comma-separated names)
+ *   /parameters  receivers x further header values (e.g. the initial stress of fault receivers), if any,
+ *                with the attribute "names"
+ *
+ * The files are distributed over the MPI ranks, which read, resample and filter them independently and write
+ * their receivers with collective I/O. Receivers without a file are NaN.
+ **/
+
+#include "Resampling.h"
+
+#include <ResultWriter/ReceiverDatFile.h>
+
+#include <utils/args.h>
+
+#include <glob.h>
+#include <hdf5.h>
+#include <mpi.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+template <typename T>
+void checkH5Err(T status) {
+  if (status < 0) {
+    throw std::runtime_error("An HDF5 error occurred.");
+  }
+}
+
+std::vector<std::string> findFiles(const std::string& pattern) {
+  glob_t result;
+  std::vector<std::string> files;
+  if (glob(pattern.c_str(), 0, nullptr, &result) == 0) {
+    files.assign(result.gl_pathv, result.gl_pathv + result.gl_pathc);
+  }
+  globfree(&result);
+  std::sort(files.begin(), files.end());
+  return files;
+}
+
+std::string join(const std::vector<std::string>& names) {
+  std::string joined;
+  for (auto const& name : names) {
+    joined += (joined.empty() ? "" : ",") + name;
+  }
+  return joined;
+}
+
+void writeStringAttribute(hid_t object, const char* name, const std::string& value) {
+  hid_t stringType = H5Tcopy(H5T_C_S1);
+  checkH5Err(stringType);
+  checkH5Err(H5Tset_size(stringType, value.size() + 1));
+  hid_t space = H5Screate(H5S_SCALAR);
+  checkH5Err(space);
+  hid_t attribute = H5Acreate(object, name, stringType, space, H5P_DEFAULT, H5P_DEFAULT);
+  checkH5Err(attribute);
+  checkH5Err(H5Awrite(attribute, stringType, value.c_str()));
+  checkH5Err(H5Aclose(attribute));
+  checkH5Err(H5Sclose(space));
+  checkH5Err(H5Tclose(stringType));
+}
+
+/**
+ * Creates a dataset filled with NaN, whose dimension receiverDim are the receivers, and writes the local receivers
+ * collectively. rows[i] contains the values of receivers[i] in the order of the other dimensions.
+ */
+void writeReceiverDataset(hid_t file,
+                          hid_t transfer,
+                          const char* name,
+                          std::vector<hsize_t> const& dims,
+                          unsigned receiverDim,
+                          std::vector<unsigned> const& receivers,
+                          std::vector<std::vector<double>> const& rows) {
+  hid_t space = H5Screate_simple(dims.size(), dims.data(), nullptr);
+  checkH5Err(space);
+  hid_t properties = H5Pcreate(H5P_DATASET_CREATE);
+  checkH5Err(properties);
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  checkH5Err(H5Pset_fill_value(properties, H5T_NATIVE_DOUBLE, &nan));
+  hid_t dataset = H5Dcreate(file, name, H5T_NATIVE_DOUBLE, space, H5P_DEFAULT, properties, H5P_DEFAULT);
+  checkH5Err(dataset);
+  checkH5Err(H5Pclose(properties));
+
+  // The selection has to be in the order of the file, i.e. by the leading dimensions and then by receiver
+  hsize_t leading = 1;
+  for (unsigned d = 0; d < receiverDim; ++d) {
+    leading *= dims[d];
+  }
+  hsize_t trailing = 1;
+  for (unsigned d = receiverDim + 1; d < dims.size(); ++d) {
+    trailing *= dims[d];
+  }
+  std::vector<std::size_t> order(receivers.size());
+  for (std::size_t i = 0; i < order.size(); ++i) {
+    order[i] = i;
+  }
+  std::sort(order.begin(), order.end(), [&](auto a, auto b) { return receivers[a] < receivers[b]; });
+
+  // One hyperslab per receiver; the buffer is in the order of the file
+  checkH5Err(H5Sselect_none(space));
+  std::vector<hsize_t> start(dims.size(), 0);
+  std::vector<hsize_t> count(dims);
+  count[receiverDim] = 1;
+  for (auto i : order) {
+    start[receiverDim] = receivers[i];
+    checkH5Err(H5Sselect_hyperslab(space, H5S_SELECT_OR, start.data(), nullptr, count.data(), nullptr));
+  }
+  std::vector<double> buffer;
+  buffer.reserve(leading * trailing * receivers.size());
+  for (hsize_t l = 0; l < leading; ++l) {
+    for (auto i : order) {
+      buffer.insert(buffer.end(), rows[i].begin() + l * trailing, rows[i].begin() + (l + 1) * trailing);
+    }
+  }
+  const hsize_t memoryDims = std::max<hsize_t>(buffer.size(), 1);
+  hid_t memorySpace = H5Screate_simple(1, &memoryDims, nullptr);
+  checkH5Err(memorySpace);
+  if (buffer.empty()) {
+    checkH5Err(H5Sselect_none(memorySpace));
+  }
+  checkH5Err(H5Dwrite(dataset, H5T_NATIVE_DOUBLE, memorySpace, space, transfer, buffer.data()));
+  checkH5Err(H5Sclose(memorySpace));
+  checkH5Err(H5Sclose(space));
+  checkH5Err(H5Dclose(dataset));
+}
+
+int convert(const std::string& prefix, const std::string& output, bool fault, double interval, double lowPass) {
+  int rank = 0;
+  int size = 1;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+  const std::string kind = fault ? "-faultreceiver-" : "-receiver-";
+  const auto files = findFiles(prefix + kind + "*.dat");
+  if (files.empty()) {
+    throw std::runtime_error("No files found for " + prefix + kind + "*.dat.");
+  }
+  if (rank == 0) {
+    std::cout << "Converting " << files.size() << " receivers on " << size << " ranks." << std::endl;
+  }
+
+  std::vector<unsigned> receivers;
+  std::vector<seissol::writer::ReceiverDatFile> data;
+  for (std::size_t i = rank; i < files.size(); i += size) {
+    receivers.push_back(seissol::writer::receiverNumberFromFileName(files[i]) - 1);
+    data.push_back(seissol::writer::readReceiverDatFile(files[i]));
+  }
+
+  // All receivers need the variables and header values of the first one
+  std::string variables;
+  std::vector<std::string> parameterNames;
+  if (rank == 0) {
+    variables = join(data.front().variables);
+    for (auto const& parameter : data.front().parameters) {
+      parameterNames.push_back(parameter.first);
+    }
+  }
+  std::string parameters = join(parameterNames);
+  for (auto* string : {&variables, &parameters}) {
+    unsigned long length = string->size();
+    MPI_Bcast(&length, 1, MPI_UNSIGNED_LONG, 0, MPI_COMM_WORLD);
+    string->resize(length);
+    MPI_Bcast(string->data(), length, MPI_CHAR, 0, MPI_COMM_WORLD);
+  }
+  const std::size_t numberOfVariables = std::count(variables.begin(), variables.end(), ',') + 1;
+  const std::size_t numberOfParameters =
+      parameters.empty() ? 0 : std::count(parameters.begin(), parameters.end(), ',') + 1;
+  for (std::size_t r = 0; r < data.size(); ++r) {
+    std::vector<std::string> names;
+    for (auto const& parameter : data[r].parameters) {
+      names.push_back(parameter.first);
+    }
+    if (join(data[r].variables) != variables || join(names) != parameters) {
+      throw std::runtime_error("The receivers have different variables.");
+    }
+  }
+
+  // The time steps: either the resampled ones or the ones of the first receiver, which all receivers must have
+  unsigned long numberOfTimes = 0;
+  std::vector<double> times;
+  if (interval > 0.0) {
+    double endTime = 0.0;
+    for (auto const& receiver : data) {
+      if (!receiver.times.empty()) {
+        endTime = std::max(endTime, receiver.times.back());
+      }
+    }
+    MPI_Allreduce(MPI_IN_PLACE, &endTime, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+    numberOfTimes = static_cast<unsigned long>(std::floor(endTime / interval * (1.0 + 1e-12))) + 1;
+    for (unsigned long t = 0; t < numberOfTimes; ++t) {
+      times.push_back(t * interval);
+    }
+    for (auto& receiver : data) {
+      receiver.values = receiverconv::resample(receiver.times, receiver.values, numberOfVariables, interval, numberOfTimes);
+      if (lowPass > 0.0) {
+        receiverconv::lowPassFilter(receiver.values, numberOfVariables, interval, lowPass);
+      }
+    }
+  } else {
+    if (lowPass > 0.0) {
+      throw std::runtime_error("The low-pass filter requires resampled receivers (--interval).");
+    }
+    if (rank == 0) {
+      times = data.front().times;
+      numberOfTimes = times.size();
+    }
+    MPI_Bcast(&numberOfTimes, 1, MPI_UNSIGNED_LONG, 0, MPI_COMM_WORLD);
+    times.resize(numberOfTimes);
+    MPI_Bcast(times.data(), numberOfTimes, MPI_DOUBLE, 0, MPI_COMM_WORLD);
+    for (std::size_t r = 0; r < data.size(); ++r) {
+      const auto& receiverTimes = data[r].times;
+      const bool sameTimes = receiverTimes.size() == times.size() &&
+                             std::equal(times.begin(), times.end(), receiverTimes.begin(),
+                                        [](double a, double b) { return std::abs(a - b) <= 1e-9 * std::abs(a) + 1e-15; });
+      if (!sameTimes) {
+        throw std::runtime_error("The receiver " + std::to_string(receivers[r] + 1) +
+                                 " has other time steps than the first one; resample them with --interval.");
+      }
+    }
+  }
+
+  unsigned long numberOfReceivers = 0;
+  for (auto receiver : receivers) {
+    numberOfReceivers = std::max<unsigned long>(numberOfReceivers, receiver + 1);
+  }
+  MPI_Allreduce(MPI_IN_PLACE, &numberOfReceivers, 1, MPI_UNSIGNED_LONG, MPI_MAX, MPI_COMM_WORLD);
+
+  hid_t access = H5Pcreate(H5P_FILE_ACCESS);
+  checkH5Err(access);
+  checkH5Err(H5Pset_fapl_mpio(access, MPI_COMM_WORLD, MPI_INFO_NULL));
+  hid_t transfer = H5Pcreate(H5P_DATASET_XFER);
+  checkH5Err(transfer);
+  checkH5Err(H5Pset_dxpl_mpio(transfer, H5FD_MPIO_COLLECTIVE));
+  hid_t file = H5Fcreate(output.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, access);
+  checkH5Err(file);
+  checkH5Err(H5Pclose(access));
+
+  std::vector<std::vector<double>> points;
+  std::vector<std::vector<double>> parameterValues;
+  std::vector<std::vector<double>> samples;
+  for (auto& receiver : data) {
+    points.emplace_back(receiver.point.begin(), receiver.point.end());
+    parameterValues.emplace_back();
+    for (auto const& parameter : receiver.parameters) {
+      parameterValues.back().push_back(parameter.second);
+    }
+    samples.push_back(std::move(receiver.values));
+  }
+  writeReceiverDataset(file, transfer, "/points", {numberOfReceivers, 3}, 0, receivers, points);
+  if (numberOfParameters > 0) {
+    writeReceiverDataset(file, transfer, "/parameters", {numberOfReceivers, numberOfParameters}, 0, receivers,
+                         parameterValues);
+  }
+  writeReceiverDataset(file, transfer, "/receivers", {numberOfTimes, numberOfReceivers, numberOfVariables}, 1,
+                       receivers, samples);
+
+  // The time steps are written by the first rank
+  const hsize_t timeDims = numberOfTimes;
+  hid_t timeSpace = H5Screate_simple(1, &timeDims, nullptr);
+  checkH5Err(timeSpace);
+  hid_t time = H5Dcreate(file, "/time", H5T_NATIVE_DOUBLE, timeSpace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+  checkH5Err(time);
+  hid_t memorySpace = H5Screate_simple(1, &timeDims, nullptr);
+  checkH5Err(memorySpace);
+  if (rank != 0) {
+    checkH5Err(H5Sselect_none(timeSpace));
+    checkH5Err(H5Sselect_none(memorySpace));
+  }
+  checkH5Err(H5Dwrite(time, H5T_NATIVE_DOUBLE, memorySpace, timeSpace, transfer, times.data()));
+  checkH5Err(H5Sclose(memorySpace));
+  checkH5Err(H5Sclose(timeSpace));
+  checkH5Err(H5Dclose(time));
+
+  hid_t receiverDataset = H5Dopen(file, "/receivers", H5P_DEFAULT);
+  checkH5Err(receiverDataset);
+  writeStringAttribute(receiverDataset, "variables", variables);
+  checkH5Err(H5Dclose(receiverDataset));
+  if (numberOfParameters > 0) {
+    hid_t parameterDataset = H5Dopen(file, "/parameters", H5P_DEFAULT);
+    checkH5Err(parameterDataset);
+    writeStringAttribute(parameterDataset, "names", parameters);
+    checkH5Err(H5Dclose(parameterDataset));
+  }
+
+  checkH5Err(H5Pclose(transfer));
+  checkH5Err(H5Fclose(file));
+
+  if (rank == 0) {
+    std::cout << "Wrote " << numberOfReceivers << " receivers with " << numberOfTimes << " time steps to " << output
+              << "." << std::endl;
+  }
+  return 0;
+}
+} // namespace
+
+int main(int argc, char** argv) {
+  MPI_Init(&argc, &argv);
+
+  utils::Args args;
+  args.addOption("prefix", 'p', "Output prefix of the SeisSol run (OutputFile in the parameter file)");
+  args.addOption("output", 'o', "Output file (.h5)");
+  args.addOption("fault", 'f', "Convert the fault receivers instead of the receivers", utils::Args::No, false);
+  args.addOption("interval", 'i', "Resample the receivers with this time step", utils::Args::Required, false);
+  args.addOption("lowpass", 'l', "Corner frequency of a zero-phase Butterworth low-pass filter (requires --interval)",
+                 utils::Args::Required, false);
+
+  int result = 1;
+  if (args.parse(argc, argv) == utils::Args::Success) {
+    try {
+      result = convert(args.getArgument<std::string>("prefix"),
+                       args.getArgument<std::string>("output"),
+                       args.isSet("fault"),
+                       args.getArgument<double>("interval", 0.0),
+                       args.getArgument<double>("lowpass", 0.0));
+    } catch (std::exception const& e) {
+      std::cerr << e.what() << std::endl;
+      MPI_Abort(MPI_COMM_WORLD, 1);
+    }
+  }
+
+  MPI_Finalize();
+  return result;
+}
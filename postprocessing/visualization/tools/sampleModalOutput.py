@@ -0,0 +1,141 @@
+#!/usr/bin/env python3
+# Evaluates the modal wave field output (Refinement = -1) on a refined mesh
+# and writes it as a cell-based XDMF/HDF5 output which can be opened in ParaView.
+import argparse
+import os
+import re
+import h5py
+import numpy as np
+import seissolxdmf
+import recreateXdmf
+
+parser = argparse.ArgumentParser(description="sample modal wave field output on a refined mesh")
+parser.add_argument("xdmfFilename", help="xdmf output file written with Refinement = -1")
+parser.add_argument("--add2prefix", help="string to append to prefix for new file", type=str, default="_sampled")
+parser.add_argument("--Data", nargs="+", metavar=("variable"), required=True, help="variables to sample (example u v w)")
+parser.add_argument("--refinement", type=int, default=1, help="each cell is split into 8^refinement subcells")
+parser.add_argument("--idt", nargs="+", help="list of time steps to write (default: all)", type=int)
+parser.add_argument("--precision", type=str, choices=["float", "double"], default="float", help="precision of output file")
+args = parser.parse_args()
+
+
+def singularityFreeJacobiP(n, a, b, x, y):
+    """Same recursion as seissol::functions::SingularityFreeJacobiP"""
+    if n == 0:
+        return np.ones_like(x)
+    Pm_1 = np.ones_like(x)
+    Pm = (0.5 * a - 0.5 * b) * y + (1.0 + 0.5 * (a + b)) * x
+    for m in range(2, n + 1):
+        Pm_2 = Pm_1
+        Pm_1 = Pm
+        c0 = 2.0 * m + a + b
+        c1 = c0 - 1.0
+        c2 = float(a * a) - float(b * b)
+        c3 = c0 * (c0 - 2.0)
+        c4 = 2.0 * (m + a - 1.0) * (m + b - 1.0) * c0
+        c5 = 2.0 * m * (m + a + b) * (c0 - 2.0)
+        Pm = (c1 * (c2 * y + c3 * x) * Pm_1 - c4 * y * y * Pm_2) / c5
+    return Pm
+
+
+def tetraDubinerP(i, j, k, xi, eta, zeta):
+    """Same as seissol::functions::TetraDubinerP"""
+    r_num = 2.0 * xi - 1.0 + eta + zeta
+    s_num = 2.0 * eta - 1.0 + zeta
+    t = 2.0 * zeta - 1.0
+    sigmatheta = 1.0 - eta - zeta
+    theta = 1.0 - zeta
+    ti = singularityFreeJacobiP(i, 0, 0, r_num, sigmatheta)
+    tij = singularityFreeJacobiP(j, 2 * i + 1, 0, s_num, theta)
+    tijk = singularityFreeJacobiP(k, 2 * i + 2 * j + 2, 0, t, np.ones_like(t))
+    return ti * tij * tijk
+
+
+def basisFunctions(order, points):
+    """Basis functions at the reference points in the order of seissol::basisFunction::SampledBasisFunctions"""
+    result = []
+    for o in range(order):
+        for k in range(o + 1):
+            for j in range(o - k + 1):
+                result.append(tetraDubinerP(o - j - k, j, k, points[:, 0], points[:, 1], points[:, 2]))
+    return np.array(result)
+
+
+def refineTetrahedra(tets):
+    """Splits each tetrahedron (n x 4 x 3) into 8 tetrahedra"""
+    v = [tets[:, i, :] for i in range(4)]
+    m = {}
+    for a in range(4):
+        for b in range(a + 1, 4):
+            m[(a, b)] = m[(b, a)] = 0.5 * (v[a] + v[b])
+    children = [
+        [v[0], m[(0, 1)], m[(0, 2)], m[(0, 3)]],
+        [m[(0, 1)], v[1], m[(1, 2)], m[(1, 3)]],
+        [m[(0, 2)], m[(1, 2)], v[2], m[(2, 3)]],
+        [m[(0, 3)], m[(1, 3)], m[(2, 3)], v[3]],
+        [m[(0, 1)], m[(0, 2)], m[(0, 3)], m[(1, 3)]],
+        [m[(0, 1)], m[(0, 2)], m[(1, 2)], m[(1, 3)]],
+        [m[(0, 2)], m[(0, 3)], m[(1, 3)], m[(2, 3)]],
+        [m[(0, 2)], m[(1, 2)], m[(1, 3)], m[(2, 3)]],
+    ]
+    return np.stack([np.stack(child, axis=1) for child in children], axis=1).reshape(-1, 4, 3)
+
+
+sx = seissolxdmf.seissolxdmf(args.xdmfFilename)
+xyz = sx.ReadGeometry()
+connect = sx.ReadConnect()
+nElements = connect.shape[0]
+
+# The number of basis functions follows from the variable names, e.g. u_m0 ... u_m55
+variableNames = sx.ReadAvailableDataFields()
+numBasisFunctions = len([name for name in variableNames if re.fullmatch(args.Data[0] + r"_m\d+", name)])
+order = 1
+while order * (order + 1) * (order + 2) // 6 < numBasisFunctions:
+    order += 1
+if numBasisFunctions == 0 or order * (order + 1) * (order + 2) // 6 != numBasisFunctions:
+    raise ValueError(f"{args.xdmfFilename} does not contain the modal coefficients of {args.Data[0]}")
+print(f"order {order}, {numBasisFunctions} basis functions")
+
+# Sub-cells of the reference tetrahedron and the basis functions at their centres
+subTets = np.array([[[0.0, 0.0, 0.0], [1.0, 0.0, 0.0], [0.0, 1.0, 0.0], [0.0, 0.0, 1.0]]])
+for level in range(args.refinement):
+    subTets = refineTetrahedra(subTets)
+nSub = subTets.shape[0]
+phi = basisFunctions(order, subTets.mean(axis=1))
+
+# Refined mesh: x = x0 + xi (x1 - x0) + eta (x2 - x0) + zeta (x3 - x0) for each sub-cell vertex
+x0 = xyz[connect[:, 0], :]
+jacobian = np.stack([xyz[connect[:, i], :] - x0 for i in range(1, 4)], axis=1)
+refVertices = subTets.reshape(-1, 3)
+vertices = (x0[:, np.newaxis, :] + np.einsum("vr,crx->cvx", refVertices, jacobian)).reshape(-1, 3)
+newConnect = np.arange(vertices.shape[0], dtype=np.int64).reshape(-1, 4)
+
+indices = args.idt if args.idt else range(sx.ndt)
+myDtype = "float64" if args.precision == "double" else "float32"
+prefix = os.path.splitext(args.xdmfFilename)[0]
+prefix_new = recreateXdmf.generate_new_prefix(prefix, args.add2prefix)
+
+with h5py.File(prefix_new + "_vertex.h5", "w") as h5fv:
+    h5fv.create_dataset("/mesh0/geometry", data=vertices)
+with h5py.File(prefix_new + "_cell.h5", "w") as h5fc:
+    h5fc.create_dataset("/mesh0/connect", data=newConnect)
+    for sdata in args.Data:
+        dset = h5fc.create_dataset("/mesh0/" + sdata, (len(indices), nElements * nSub), dtype=myDtype)
+        for kk, i in enumerate(indices):
+            coefficients = np.array([sx.ReadData(f"{sdata}_m{b}", idt=i) for b in range(numBasisFunctions)])
+            dset[kk, :] = (phi.T @ coefficients).T.reshape(-1)
+        print("done sampling " + sdata)
+
+recreateXdmf.recreateXdmf(
+    prefix,
+    prefix_new,
+    vertices.shape[0],
+    nElements * nSub,
+    len(indices),
+    sx.ReadTimeStep(),
+    list(range(len(indices))),
+    args.Data,
+    tohdf5=True,
+    prec=8 if args.precision == "double" else 4,
+    append2prefix=args.add2prefix,
+)
@@ -0,0 +1,40 @@
+#include "AdaptiveInterval.h"
+
+#include <cmath>
+
+#include "Parallel/MPI.h"
+#include "utils/logger.h"
+
+seissol::checkpoint::AdaptiveInterval::AdaptiveInterval(double failureRate) {
+  if (failureRate < 0.0) {
+    logError() << "SEISSOL_CHECKPOINT_FAILURE_RATE has to be positive.";
+  }
+  if (failureRate > 0.0) {
+    m_meanTimeBetweenFailures = 3600.0 / failureRate;
+  }
+}
+
+double seissol::checkpoint::AdaptiveInterval::optimalComputeTime(double cost, double meanTimeBetweenFailures) {
+  if (cost >= 2.0 * meanTimeBetweenFailures) {
+    return meanTimeBetweenFailures;
+  }
+  const double ratio = cost / (2.0 * meanTimeBetweenFailures);
+  return std::sqrt(2.0 * cost * meanTimeBetweenFailures) * (1.0 + std::sqrt(ratio) / 3.0 + ratio / 9.0) - cost;
+}
+
+double seissol::checkpoint::AdaptiveInterval::update(double cost, double simulatedTime, double computeTime) {
+  double times[2] = {cost, computeTime};
+#ifdef USE_MPI
+  MPI_Allreduce(MPI_IN_PLACE, times, 2, MPI_DOUBLE, MPI_MAX, seissol::MPI::mpi.comm());
+#endif // USE_MPI
+
+  if (times[1] <= 0.0 || simulatedTime <= 0.0) {
+    return simulatedTime;
+  }
+
+  const double wallTime = optimalComputeTime(times[0], m_meanTimeBetweenFailures);
+  const double interval = simulatedTime / times[1] * wallTime;
+  logInfo(seissol::MPI::mpi.rank()) << "Checkpoint: cost" << times[0] << "s, simulation rate" << simulatedTime / times[1]
+                                    << "; next checkpoint after" << wallTime << "s (simulated time" << interval << ").";
+  return interval;
+}
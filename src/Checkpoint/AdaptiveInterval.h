@@ -0,0 +1,46 @@
+#ifndef SEISSOL_CHECKPOINT_ADAPTIVEINTERVAL_H
+#define SEISSOL_CHECKPOINT_ADAPTIVEINTERVAL_H
+
+namespace seissol::checkpoint {
+/**
+ * Adaptive checkpoint interval: with SEISSOL_CHECKPOINT_FAILURE_RATE (expected failures of the job per hour
+ * of wall-clock time), the interval between two checkpoints is chosen such that the time spent in checkpoints
+ * plus the expected work lost by a failure is minimal (Young/Daly).
+ *
+ * After each checkpoint, the measured cost of the checkpoint and the simulation rate (simulated time per
+ * wall-clock second) since the previous checkpoint give the next interval in simulated time.
+ * The first checkpoint uses the interval of the parameter file.
+ **/
+class AdaptiveInterval {
+  public:
+  //! failureRate: expected failures per hour of wall-clock time; zero disables the adaptive interval
+  explicit AdaptiveInterval(double failureRate);
+
+  bool enabled() const { return m_meanTimeBetweenFailures > 0.0; }
+
+  /**
+   * Wall-clock time between two checkpoints (without the checkpoint itself) which minimizes the expected
+   * overhead, following Daly's higher-order estimate.
+   *
+   * @param cost Wall-clock time of a checkpoint
+   * @param meanTimeBetweenFailures Mean wall-clock time between two failures
+   **/
+  static double optimalComputeTime(double cost, double meanTimeBetweenFailures);
+
+  /**
+   * Computes the next interval from the last checkpoint; collective, such that all ranks use the
+   * same interval (the slowest rank decides).
+   *
+   * @param cost Wall-clock time of the last checkpoint on this rank
+   * @param simulatedTime Simulated time since the previous checkpoint
+   * @param computeTime Wall-clock time since the previous checkpoint (without the checkpoints)
+   * @return The simulated time until the next checkpoint
+   **/
+  double update(double cost, double simulatedTime, double computeTime);
+
+  private:
+  double m_meanTimeBetweenFailures = 0.0;
+};
+} // namespace seissol::checkpoint
+
+#endif // SEISSOL_CHECKPOINT_ADAPTIVEINTERVAL_H
@@ -40,14 +40,21 @@
 #include "utils/logger.h"
 
 #include "Backend.h"
+#include "WavefieldDummy.h"
 #include "posix/Fault.h"
 #include "posix/Wavefield.h"
+#include "posix/WavefieldCompressed.h"
 #include "h5/Wavefield.h"
 #include "h5/Fault.h"
+#include "h5/WavefieldAsync.h"
+#include "h5/FaultAsync.h"
 #include "mpio/Wavefield.h"
 #include "mpio/WavefieldAsync.h"
+#include "mpio/WavefieldElastic.h"
 #include "mpio/Fault.h"
 #include "mpio/FaultAsync.h"
+#include "mpio/FaultElastic.h"
+#include "gds/Wavefield.h"
 #ifdef USE_SIONLIB
 #include "sionlib/Fault.h"
 #include "sionlib/Wavefield.h"
@@ -57,13 +64,20 @@ void seissol::checkpoint::createBackend(Backend backend, Wavefield* &waveField,
 {
 	switch (backend) {
 	case POSIX:
-		waveField = new posix::Wavefield();
+		if (posix::WavefieldCompressed::enabled())
+			waveField = new posix::WavefieldCompressed();
+		else
+			waveField = new posix::Wavefield();
 		fault = new posix::Fault();
 		break;
 	case HDF5:
 		waveField = new h5::Wavefield();
 		fault = new h5::Fault();
 		break;
+	case HDF5_ASYNC:
+		waveField = new h5::WavefieldAsync();
+		fault = new h5::FaultAsync();
+		break;
 	case MPIO:
 		waveField = new mpio::Wavefield();
 		fault = new mpio::Fault();
@@ -72,6 +86,10 @@ void seissol::checkpoint::createBackend(Backend backend, Wavefield* &waveField,
 		waveField = new mpio::WavefieldAsync();
 		fault = new mpio::FaultAsync();
 		break;
+	case MPIO_ELASTIC:
+		waveField = new mpio::WavefieldElastic();
+		fault = new mpio::FaultElastic();
+		break;
 	case SIONLIB:
 #ifdef USE_SIONLIB
 		waveField = new sionlib::Wavefield();
@@ -81,7 +99,24 @@ void seissol::checkpoint::createBackend(Backend backend, Wavefield* &waveField,
 		logError() << "SIONlib checkpoint backend unsupported";
 		break;
 #endif //USE_SIONLIB
+	case GDS:
+#ifdef USE_GDS
+		// The wave field is written on the compute ranks (see createDeviceWavefield)
+		waveField = new WavefieldDummy();
+		fault = new posix::Fault();
+		break;
+#else // USE_GDS
+		logError() << "GPUDirect Storage checkpoint backend unsupported";
+		break;
+#endif // USE_GDS
 	default:
 		logError() << "Unsupported checkpoint backend";
 	}
-}
\ No newline at end of file
+}
+
+seissol::checkpoint::Wavefield* seissol::checkpoint::createDeviceWavefield(Backend backend)
+{
+	if (backend == GDS)
+		return new gds::Wavefield();
+	return 0L;
+}
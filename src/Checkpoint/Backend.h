@@ -53,9 +53,15 @@ namespace checkpoint
 enum Backend {
 	POSIX,
 	HDF5,
+	/** HDF5 with the write completed at the next checkpoint */
+	HDF5_ASYNC,
 	MPIO,
 	MPIO_ASYNC,
+	/** MPI-IO with a layout independent of the partitioning */
+	MPIO_ELASTIC,
 	SIONLIB,
+	/** POSIX files with the wave field written from device memory by GPUDirect Storage */
+	GDS,
 	DISABLED
 };
 
@@ -64,6 +70,13 @@ enum Backend {
  */
 void createBackend(Backend backend, Wavefield* &waveField, Fault* &fault);
 
+/**
+ * Create the wave field instance which is used on the compute ranks
+ *
+ * @return The wave field or null if the backend writes the wave field in the executor
+ */
+Wavefield* createDeviceWavefield(Backend backend);
+
 }
 
 }
@@ -46,6 +46,7 @@
 #endif // USE_MPI
 
 #include <cstdio>
+#include <limits>
 #include <string>
 #include <unistd.h>
 #include <sys/stat.h>
@@ -60,6 +61,9 @@ namespace seissol
 namespace checkpoint
 {
 
+/** Global id of cells or fault sides which are not stored (see Manager::setGlobalIds) */
+const unsigned long INVALID_GLOBAL_ID = std::numeric_limits<unsigned long>::max();
+
 /**
  * Common interface for all checkpoints
  */
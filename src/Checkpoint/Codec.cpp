@@ -0,0 +1,196 @@
+#include "Codec.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+
+namespace {
+using Bits = std::conditional_t<sizeof(real) == sizeof(std::uint64_t), std::uint64_t, std::uint32_t>;
+static_assert(sizeof(Bits) == sizeof(real), "Unsupported floating point type");
+
+//! Quantized values are only stored if they fit in 62 bits
+constexpr double MaxQuantized = 4611686018427387904.0; // 2^62
+
+Bits toBits(real value) {
+  Bits bits;
+  std::memcpy(&bits, &value, sizeof(real));
+  return bits;
+}
+
+real fromBits(Bits bits) {
+  real value;
+  std::memcpy(&value, &bits, sizeof(real));
+  return value;
+}
+
+void putBytes(Bits bits, unsigned int numberOfBytes, std::vector<char>& stream) {
+  for (unsigned int i = 0; i < numberOfBytes; ++i) {
+    stream.push_back(static_cast<char>((bits >> (8 * i)) & 0xFF));
+  }
+}
+
+void putVarint(std::uint64_t value, std::vector<char>& stream) {
+  while (value >= 0x80) {
+    stream.push_back(static_cast<char>((value & 0x7F) | 0x80));
+    value >>= 7;
+  }
+  stream.push_back(static_cast<char>(value));
+}
+
+/** Sequential reader of the stream, which stops at the end */
+class Reader {
+  public:
+  Reader(const char* stream, std::size_t size) : m_stream(stream), m_size(size) {}
+
+  bool getByte(unsigned int& byte) {
+    if (m_position >= m_size) {
+      return false;
+    }
+    byte = static_cast<unsigned char>(m_stream[m_position++]);
+    return true;
+  }
+
+  bool getBytes(unsigned int numberOfBytes, Bits& bits) {
+    bits = 0;
+    for (unsigned int i = 0; i < numberOfBytes; ++i) {
+      unsigned int byte;
+      if (!getByte(byte)) {
+        return false;
+      }
+      bits |= static_cast<Bits>(byte) << (8 * i);
+    }
+    return true;
+  }
+
+  bool getVarint(std::uint64_t& value) {
+    value = 0;
+    for (unsigned int shift = 0; shift < 64; shift += 7) {
+      unsigned int byte;
+      if (!getByte(byte)) {
+        return false;
+      }
+      value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+      if (!(byte & 0x80)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  private:
+  const char* m_stream;
+  std::size_t m_size;
+  std::size_t m_position = 0;
+};
+
+unsigned int significantBytes(Bits bits) {
+  unsigned int numberOfBytes = 0;
+  while (bits != 0) {
+    ++numberOfBytes;
+    bits >>= 8;
+  }
+  return numberOfBytes;
+}
+} // namespace
+
+seissol::checkpoint::CodecMode seissol::checkpoint::parseCodecMode(const std::string& mode) {
+  if (mode == "none") {
+    return CodecMode::None;
+  }
+  if (mode == "lossless") {
+    return CodecMode::Lossless;
+  }
+  if (mode == "lossy") {
+    return CodecMode::Lossy;
+  }
+  throw std::runtime_error("Unknown checkpoint compression " + mode + ".");
+}
+
+seissol::checkpoint::Codec::Codec(
+    CodecMode mode, unsigned int blockSize, unsigned int blockRows, unsigned int exactRows, double tolerance)
+    : m_mode(mode), m_blockSize(blockSize), m_blockRows(blockRows), m_exactRows(exactRows), m_tolerance(tolerance) {
+  if (m_blockSize == 0 || m_blockRows == 0 || m_blockSize % m_blockRows != 0) {
+    throw std::invalid_argument("The block size has to be a multiple of the number of rows.");
+  }
+  if (m_mode == CodecMode::Lossy && !(m_tolerance > 0.0)) {
+    throw std::invalid_argument("Lossy compression requires a positive tolerance.");
+  }
+}
+
+void seissol::checkpoint::Codec::encode(const real* values,
+                                        unsigned long numberOfValues,
+                                        std::vector<char>& stream) const {
+  std::vector<Bits> previous(m_blockSize, 0);
+  for (unsigned long i = 0; i < numberOfValues; ++i) {
+    const Bits bits = toBits(values[i]);
+    if (m_mode == CodecMode::None || isExact(i)) {
+      putBytes(bits, sizeof(real), stream);
+    } else if (m_mode == CodecMode::Lossless) {
+      Bits& predicted = previous[i % m_blockSize];
+      const Bits difference = bits ^ predicted;
+      const unsigned int numberOfBytes = significantBytes(difference);
+      stream.push_back(static_cast<char>(numberOfBytes));
+      putBytes(difference, numberOfBytes, stream);
+      predicted = bits;
+    } else {
+      const double scaled = values[i] / (2.0 * m_tolerance);
+      if (std::abs(scaled) < MaxQuantized) {
+        const auto quantized = static_cast<std::int64_t>(std::llround(scaled));
+        // Zigzag encoding; 0 marks values which are stored as they are
+        const auto zigzag = (static_cast<std::uint64_t>(quantized) << 1) ^ static_cast<std::uint64_t>(quantized >> 63);
+        putVarint(zigzag + 1, stream);
+      } else {
+        putVarint(0, stream);
+        putBytes(bits, sizeof(real), stream);
+      }
+    }
+  }
+}
+
+bool seissol::checkpoint::Codec::decode(const char* stream,
+                                        std::size_t streamSize,
+                                        unsigned long firstValue,
+                                        unsigned long numberOfValues,
+                                        real* values) const {
+  Reader reader(stream, streamSize);
+  std::vector<Bits> previous(m_blockSize, 0);
+  const unsigned long end = firstValue + numberOfValues;
+  for (unsigned long i = 0; i < end; ++i) {
+    Bits bits;
+    if (m_mode == CodecMode::None || isExact(i)) {
+      if (!reader.getBytes(sizeof(real), bits)) {
+        return false;
+      }
+    } else if (m_mode == CodecMode::Lossless) {
+      unsigned int numberOfBytes;
+      Bits difference;
+      if (!reader.getByte(numberOfBytes) || numberOfBytes > sizeof(real) ||
+          !reader.getBytes(numberOfBytes, difference)) {
+        return false;
+      }
+      Bits& predicted = previous[i % m_blockSize];
+      bits = difference ^ predicted;
+      predicted = bits;
+    } else {
+      std::uint64_t zigzag;
+      if (!reader.getVarint(zigzag)) {
+        return false;
+      }
+      if (zigzag == 0) {
+        if (!reader.getBytes(sizeof(real), bits)) {
+          return false;
+        }
+      } else {
+        --zigzag;
+        const auto quantized = static_cast<std::int64_t>(zigzag >> 1) ^ -static_cast<std::int64_t>(zigzag & 1);
+        bits = toBits(static_cast<real>(quantized * 2.0 * m_tolerance));
+      }
+    }
+    if (i >= firstValue) {
+      values[i - firstValue] = fromBits(bits);
+    }
+  }
+  return true;
+}
@@ -0,0 +1,62 @@
+#ifndef SEISSOL_CHECKPOINT_CODEC_H
+#define SEISSOL_CHECKPOINT_CODEC_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "Kernels/precision.hpp"
+
+namespace seissol::checkpoint {
+enum class CodecMode { None, Lossless, Lossy };
+
+CodecMode parseCodecMode(const std::string& mode);
+
+/**
+ * Compression of the degrees of freedom for checkpoints.
+ *
+ * The dofs are interpreted as blocks (one per cell) of column-major matrices with blockRows modes.
+ * The first exactRows modes (the low-order modes) of each column are stored as they are. The
+ * remaining (high-order) modes are either stored lossless as the XOR with the same value of the
+ * previous block without the leading zero bytes, or quantized with an absolute error of at most
+ * tolerance and stored as variable-length integers.
+ **/
+class Codec {
+  public:
+  Codec(CodecMode mode, unsigned int blockSize, unsigned int blockRows, unsigned int exactRows, double tolerance);
+
+  CodecMode mode() const { return m_mode; }
+  unsigned int blockSize() const { return m_blockSize; }
+  unsigned int blockRows() const { return m_blockRows; }
+  unsigned int exactRows() const { return m_exactRows; }
+  double tolerance() const { return m_tolerance; }
+
+  //! Appends the encoded values to the stream
+  void encode(const real* values, unsigned long numberOfValues, std::vector<char>& stream) const;
+
+  /**
+   * Decodes the values [firstValue, firstValue + numberOfValues) of the stream.
+   *
+   * @return False if the stream is too short
+   **/
+  bool decode(const char* stream,
+              std::size_t streamSize,
+              unsigned long firstValue,
+              unsigned long numberOfValues,
+              real* values) const;
+
+  //! Number of modes of the polynomials up to degree order - 1
+  static unsigned int numberOfBasisFunctions(unsigned int order) { return order * (order + 1) * (order + 2) / 6; }
+
+  private:
+  bool isExact(unsigned long value) const { return (value % m_blockSize) % m_blockRows < m_exactRows; }
+
+  CodecMode m_mode;
+  unsigned int m_blockSize;
+  unsigned int m_blockRows;
+  unsigned int m_exactRows;
+  double m_tolerance;
+};
+} // namespace seissol::checkpoint
+
+#endif // SEISSOL_CHECKPOINT_CODEC_H
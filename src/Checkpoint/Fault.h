@@ -80,6 +80,16 @@ public:
 
 	virtual ~Fault() {}
 
+	/**
+	 * Set the global ids of the fault sides (two for each side, see Manager::setGlobalIds).
+	 *
+	 * Only used by back-ends with a layout independent of the partitioning; must be called
+	 * before init().
+	 */
+	virtual void setFaceIds(const unsigned long* faceIds, unsigned int numSides)
+	{
+	}
+
 	/**
 	 * @return True of a valid checkpoint is available
 	 */
@@ -0,0 +1,273 @@
+#include "Incremental.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "Parallel/MPI.h"
+#include "utils/logger.h"
+
+namespace {
+constexpr unsigned long Magic = 0x31544c4544535353UL; // "SSSDELT1"
+
+struct FileHeader {
+  unsigned long magic;
+  unsigned long partitions;
+};
+
+struct TableEntry {
+  unsigned long offset;
+  unsigned long size;
+};
+
+struct SectionHeader {
+  double referenceTime;
+  double time;
+  unsigned long headerSize;
+  unsigned long blockSize;
+  unsigned long numberOfBlocks;
+};
+
+void writeAll(int file, const void* data, std::size_t size, off_t offset) {
+  const char* bytes = static_cast<const char*>(data);
+  while (size > 0) {
+    const ssize_t written = pwrite(file, bytes, size, offset);
+    if (written < 0) {
+      logError() << "Could not write the incremental checkpoint:" << strerror(errno);
+    }
+    bytes += written;
+    size -= written;
+    offset += written;
+  }
+}
+
+bool readAll(int file, void* data, std::size_t size, off_t offset) {
+  char* bytes = static_cast<char*>(data);
+  while (size > 0) {
+    const ssize_t read = pread(file, bytes, size, offset);
+    if (read <= 0) {
+      return false;
+    }
+    bytes += read;
+    size -= read;
+    offset += read;
+  }
+  return true;
+}
+
+std::size_t blockLength(unsigned long block, unsigned long numberOfDofs, unsigned long blockSize) {
+  return std::min(blockSize, numberOfDofs - block * blockSize);
+}
+
+void barrier() {
+#ifdef USE_MPI
+  MPI_Barrier(seissol::MPI::mpi.comm());
+#endif // USE_MPI
+}
+} // namespace
+
+void seissol::checkpoint::Incremental::init(const std::string& filename,
+                                            unsigned int numberOfIncrementalCheckpoints,
+                                            double tolerance,
+                                            unsigned long numberOfDofs,
+                                            unsigned int blockSize) {
+  m_filename = filename;
+  m_numberOfIncrementalCheckpoints = numberOfIncrementalCheckpoints;
+  m_tolerance = tolerance;
+  m_numberOfDofs = numberOfDofs;
+  m_blockSize = blockSize;
+  m_reference.clear();
+  m_incrementalSinceFull = 0;
+
+  if (enabled()) {
+    logInfo(seissol::MPI::mpi.rank()) << "Writing" << numberOfIncrementalCheckpoints
+                                      << "incremental checkpoints between the full checkpoints.";
+  }
+}
+
+void seissol::checkpoint::Incremental::setReference(double time, const real* dofs) {
+  if (!enabled()) {
+    return;
+  }
+  m_reference.assign(dofs, dofs + m_numberOfDofs);
+  m_referenceTime = time;
+  m_incrementalSinceFull = 0;
+
+  // The delta belongs to the previous full checkpoint
+  if (seissol::MPI::mpi.rank() == 0) {
+    std::remove(deltaFile(m_filename).c_str());
+  }
+}
+
+void seissol::checkpoint::Incremental::write(double time,
+                                             const void* header,
+                                             std::size_t headerSize,
+                                             const real* dofs) {
+  const int rank = seissol::MPI::mpi.rank();
+  const int partitions = seissol::MPI::mpi.size();
+
+  const auto blocks = changedBlocks(m_reference.data(), dofs, m_numberOfDofs, m_blockSize, m_tolerance);
+
+  // Serialize the section of this rank
+  std::size_t numberOfValues = 0;
+  for (auto block : blocks) {
+    numberOfValues += blockLength(block, m_numberOfDofs, m_blockSize);
+  }
+  const SectionHeader sectionHeader{m_referenceTime, time, headerSize, m_blockSize, blocks.size()};
+  std::vector<char> section(sizeof(SectionHeader) + headerSize + blocks.size() * sizeof(unsigned long) +
+                            numberOfValues * sizeof(real));
+  char* position = section.data();
+  std::memcpy(position, &sectionHeader, sizeof(SectionHeader));
+  position += sizeof(SectionHeader);
+  std::memcpy(position, header, headerSize);
+  position += headerSize;
+  std::memcpy(position, blocks.data(), blocks.size() * sizeof(unsigned long));
+  position += blocks.size() * sizeof(unsigned long);
+  for (auto block : blocks) {
+    const std::size_t length = blockLength(block, m_numberOfDofs, m_blockSize);
+    std::memcpy(position, dofs + block * m_blockSize, length * sizeof(real));
+    position += length * sizeof(real);
+  }
+
+  unsigned long offset = 0;
+  unsigned long size = section.size();
+#ifdef USE_MPI
+  MPI_Exscan(&size, &offset, 1, MPI_UNSIGNED_LONG, MPI_SUM, seissol::MPI::mpi.comm());
+  if (rank == 0) {
+    offset = 0;
+  }
+#endif // USE_MPI
+  offset += sizeof(FileHeader) + partitions * sizeof(TableEntry);
+
+  const std::string temporaryFile = deltaFile(m_filename) + ".tmp";
+  if (rank == 0) {
+    const int file = open(temporaryFile.c_str(), O_WRONLY | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+    if (file < 0) {
+      logError() << "Could not create" << temporaryFile << ":" << strerror(errno);
+    }
+    const FileHeader fileHeader{Magic, static_cast<unsigned long>(partitions)};
+    writeAll(file, &fileHeader, sizeof(FileHeader), 0);
+    close(file);
+  }
+  barrier();
+
+  const int file = open(temporaryFile.c_str(), O_WRONLY);
+  if (file < 0) {
+    logError() << "Could not open" << temporaryFile << ":" << strerror(errno);
+  }
+  const TableEntry entry{offset, size};
+  writeAll(file, &entry, sizeof(TableEntry), sizeof(FileHeader) + rank * sizeof(TableEntry));
+  writeAll(file, section.data(), section.size(), offset);
+  if (fsync(file) != 0) {
+    logError() << "Could not write the incremental checkpoint:" << strerror(errno);
+  }
+  close(file);
+  barrier();
+
+  ++m_incrementalSinceFull;
+  logInfo(rank) << "Incremental checkpoint: Wrote" << blocks.size() << "changed blocks of the dofs.";
+}
+
+void seissol::checkpoint::Incremental::commit() {
+  if (seissol::MPI::mpi.rank() == 0) {
+    const std::string file = deltaFile(m_filename);
+    if (std::rename((file + ".tmp").c_str(), file.c_str()) != 0) {
+      logError() << "Could not rename the incremental checkpoint:" << strerror(errno);
+    }
+  }
+}
+
+bool seissol::checkpoint::Incremental::load(const std::string& filename,
+                                            WavefieldHeader& header,
+                                            real* dofs,
+                                            unsigned long numberOfDofs) {
+  const int rank = seissol::MPI::mpi.rank();
+
+  TableEntry entry{};
+  SectionHeader section{};
+  const int file = open(deltaFile(filename).c_str(), O_RDONLY);
+  int valid = 0;
+  if (file >= 0) {
+    FileHeader fileHeader{};
+    valid = readAll(file, &fileHeader, sizeof(FileHeader), 0) && fileHeader.magic == Magic &&
+            fileHeader.partitions == static_cast<unsigned long>(seissol::MPI::mpi.size()) &&
+            readAll(file, &entry, sizeof(TableEntry), sizeof(FileHeader) + rank * sizeof(TableEntry)) &&
+            readAll(file, &section, sizeof(SectionHeader), entry.offset) &&
+            section.referenceTime == header.time() && section.headerSize == header.size() &&
+            section.blockSize > 0;
+  }
+
+  // All ranks have to continue from the same time
+  double minTime = section.time;
+  double maxTime = section.time;
+#ifdef USE_MPI
+  MPI_Allreduce(MPI_IN_PLACE, &valid, 1, MPI_INT, MPI_LAND, seissol::MPI::mpi.comm());
+  MPI_Allreduce(MPI_IN_PLACE, &minTime, 1, MPI_DOUBLE, MPI_MIN, seissol::MPI::mpi.comm());
+  MPI_Allreduce(MPI_IN_PLACE, &maxTime, 1, MPI_DOUBLE, MPI_MAX, seissol::MPI::mpi.comm());
+#endif // USE_MPI
+  if (!valid || minTime != maxTime) {
+    if (file >= 0) {
+      logWarning(rank) << "Ignoring" << deltaFile(filename) << ", which does not belong to the loaded checkpoint.";
+      close(file);
+    }
+    return false;
+  }
+
+  std::vector<unsigned long> blocks(section.numberOfBlocks);
+  off_t offset = entry.offset + sizeof(SectionHeader);
+  bool complete = readAll(file, header.data(), section.headerSize, offset);
+  offset += section.headerSize;
+  complete = complete && readAll(file, blocks.data(), blocks.size() * sizeof(unsigned long), offset);
+  offset += blocks.size() * sizeof(unsigned long);
+  for (auto block : blocks) {
+    if (!complete || block * section.blockSize >= numberOfDofs) {
+      logError() << "The incremental checkpoint" << deltaFile(filename) << "is corrupt.";
+    }
+    const std::size_t length = blockLength(block, numberOfDofs, section.blockSize);
+    complete = readAll(file, dofs + block * section.blockSize, length * sizeof(real), offset);
+    offset += length * sizeof(real);
+  }
+  if (!complete) {
+    logError() << "The incremental checkpoint" << deltaFile(filename) << "is corrupt.";
+  }
+  close(file);
+
+  logInfo(rank) << "Applied the incremental checkpoint at time" << section.time << "with"
+                << blocks.size() << "changed blocks.";
+  return true;
+}
+
+std::vector<unsigned long> seissol::checkpoint::Incremental::changedBlocks(const real* reference,
+                                                                           const real* dofs,
+                                                                           unsigned long numberOfDofs,
+                                                                           unsigned int blockSize,
+                                                                           double tolerance) {
+  const unsigned long numberOfBlocks = (numberOfDofs + blockSize - 1) / blockSize;
+  std::vector<char> changed(numberOfBlocks, 0);
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+#endif // _OPENMP
+  for (unsigned long block = 0; block < numberOfBlocks; ++block) {
+    const unsigned long end = block * blockSize + blockLength(block, numberOfDofs, blockSize);
+    for (unsigned long i = block * blockSize; i < end; ++i) {
+      // NaN counts as changed
+      if (!(std::abs(dofs[i] - reference[i]) <= tolerance)) {
+        changed[block] = 1;
+        break;
+      }
+    }
+  }
+
+  std::vector<unsigned long> blocks;
+  for (unsigned long block = 0; block < numberOfBlocks; ++block) {
+    if (changed[block]) {
+      blocks.push_back(block);
+    }
+  }
+  return blocks;
+}
@@ -0,0 +1,82 @@
+#ifndef SEISSOL_CHECKPOINT_INCREMENTAL_H
+#define SEISSOL_CHECKPOINT_INCREMENTAL_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "utils/logger.h"
+
+#include "Kernels/precision.hpp"
+#include "WavefieldHeader.h"
+
+namespace seissol::checkpoint {
+/**
+ * Incremental wave field checkpoints: after a full checkpoint of the backend, the next
+ * SEISSOL_CHECKPOINT_INCREMENTAL checkpoints only write the blocks of the dofs which changed by more
+ * than SEISSOL_CHECKPOINT_INCREMENTAL_TOLERANCE since the full checkpoint to <filename>.delta.
+ * A restart applies the delta which belongs to the loaded full checkpoint.
+ *
+ * All ranks write one shared file: a table with the offset and the size of the section of each
+ * rank, followed by the sections (time of the full checkpoint, time, header, changed blocks).
+ **/
+class Incremental {
+  public:
+  /**
+   * @param numberOfIncrementalCheckpoints Incremental checkpoints between two full checkpoints (0 disables them)
+   * @param blockSize Number of values compared and written together (e.g. the dofs of a cell)
+   **/
+  void init(const std::string& filename,
+            unsigned int numberOfIncrementalCheckpoints,
+            double tolerance,
+            unsigned long numberOfDofs,
+            unsigned int blockSize);
+
+  bool enabled() const { return m_numberOfIncrementalCheckpoints > 0; }
+
+  //! True if the backend has to write the next checkpoint
+  bool isFullCheckpointDue() const {
+    return !enabled() || m_reference.empty() || m_incrementalSinceFull >= m_numberOfIncrementalCheckpoints;
+  }
+
+  //! Stores the dofs of a full checkpoint and removes the delta of the previous one
+  void setReference(double time, const real* dofs);
+
+  //! Writes the blocks which changed since the full checkpoint to a temporary file
+  void write(double time, const void* header, std::size_t headerSize, const real* dofs);
+
+  //! Replaces the last delta by the one written in write
+  void commit();
+
+  /**
+   * Applies the delta of the full checkpoint at header.time() to the header and the dofs if all
+   * ranks have a matching one.
+   *
+   * @return True if a delta was applied
+   **/
+  static bool load(const std::string& filename, WavefieldHeader& header, real* dofs, unsigned long numberOfDofs);
+
+  //! Blocks for which any value of dofs differs from the reference by more than the tolerance
+  static std::vector<unsigned long> changedBlocks(const real* reference,
+                                                  const real* dofs,
+                                                  unsigned long numberOfDofs,
+                                                  unsigned int blockSize,
+                                                  double tolerance);
+
+  static std::string deltaFile(const std::string& filename) { return filename + ".delta"; }
+
+  private:
+  std::string m_filename;
+  unsigned int m_numberOfIncrementalCheckpoints = 0;
+  double m_tolerance = 0.0;
+  unsigned int m_blockSize = 1;
+  unsigned long m_numberOfDofs = 0;
+
+  //! The dofs and the time of the last full checkpoint
+  std::vector<real> m_reference;
+  double m_referenceTime = 0.0;
+  unsigned int m_incrementalSinceFull = 0;
+};
+} // namespace seissol::checkpoint
+
+#endif // SEISSOL_CHECKPOINT_INCREMENTAL_H
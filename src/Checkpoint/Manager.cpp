@@ -37,11 +37,35 @@
  * @section DESCRIPTION
  */
 
+#include <limits>
+#include <string>
+
 #include "utils/env.h"
 #include "utils/logger.h"
 
 #include "Manager.h"
 #include "SeisSol.h"
+#include "posix/Wavefield.h"
+
+void seissol::checkpoint::Manager::prefetch()
+{
+		if (m_backend == DISABLED || utils::Env::get<int>("SEISSOL_CHECKPOINT_PREFETCH", 0) == 0)
+			return;
+
+		const int rank = seissol::MPI::mpi.rank();
+		// The other backends read collectively and need the layout computed in init()
+		if (m_backend != POSIX || seissol::SeisSol::main.asyncIO().groupSize() != 1
+				|| utils::Env::get<int>("SEISSOL_CHECKPOINT_AGGREGATION", 0) > 1) {
+			logWarning(rank) << "SEISSOL_CHECKPOINT_PREFETCH is only supported by the POSIX backend"
+				<< "without aggregation and dedicated output ranks; not prefetching the checkpoint.";
+			return;
+		}
+
+		posix::Wavefield waveField;
+		waveField.setFilename(m_filename.c_str());
+		logInfo(rank) << "Prefetching the wave field checkpoint";
+		m_prefetch.start(waveField.localFile());
+}
 
 bool seissol::checkpoint::Manager::init(real* dofs, unsigned int numDofs,
 		double* mu, double* slipRate1, double* slipRate2, double* slip, double* slip1, double* slip2,
@@ -55,6 +79,14 @@ bool seissol::checkpoint::Manager::init(real* dofs, unsigned int numDofs,
 			return false;
 		}
 
+		// The load reads the prefetched file from the page cache
+		Stopwatch prefetchWatch;
+		prefetchWatch.start();
+		const unsigned long prefetchedBytes = m_prefetch.wait();
+		if (prefetchedBytes > 0)
+			logInfo(seissol::MPI::mpi.rank()) << "Prefetched" << prefetchedBytes << "bytes of the checkpoint; waited"
+				<< prefetchWatch.stop() << "s for the prefetch.";
+
 		// Initialize the asynchronous module
 		async::Module<ManagerExecutor, CheckpointInitParam, CheckpointParam>::init();
 
@@ -62,6 +94,28 @@ bool seissol::checkpoint::Manager::init(real* dofs, unsigned int numDofs,
 		Fault* fault;
 		createBackend(m_backend, waveField, fault);
 
+		// Backends which write the wave field directly from device memory
+		m_deviceWaveField = createDeviceWavefield(m_backend);
+		if (m_deviceWaveField) {
+			if (seissol::SeisSol::main.asyncIO().groupSize() != 1)
+				logError() << "The GPUDirect Storage checkpoint does not support dedicated output ranks.";
+			delete waveField;
+			waveField = m_deviceWaveField;
+		}
+
+		if (m_backend != POSIX
+				&& std::string(utils::Env::get<const char*>("SEISSOL_CHECKPOINT_COMPRESSION", "none")) != "none")
+			logWarning(seissol::MPI::mpi.rank()) << "Checkpoint compression is only supported by the POSIX backend.";
+
+		if (m_backend == MPIO_ELASTIC) {
+			if (seissol::SeisSol::main.asyncIO().groupSize() != 1)
+				logError() << "The elastic MPI-IO checkpoint does not support dedicated output ranks.";
+			if (m_cellIds.size() * tensor::Q::size() != numDofs || m_faceIds.size() != 2 * numSides)
+				logError() << "The global ids do not match the checkpoint data.";
+			waveField->setCellIds(m_cellIds.data(), m_cellIds.size());
+			fault->setFaceIds(m_faceIds.data(), numSides);
+		}
+
 		// Set the header
 		waveField->setHeader(m_header);
 
@@ -78,7 +132,8 @@ bool seissol::checkpoint::Manager::init(real* dofs, unsigned int numDofs,
 		m_numDofs = numDofs;
 		m_numDRDofs = numSides * numBndGP;
 
-		id = addBuffer(dofs, numDofs * sizeof(real));
+		// The device wave field is not copied to the executor
+		id = addBuffer(dofs, m_deviceWaveField ? 0 : numDofs * sizeof(real));
 		assert(id == DOFS);
 		id = addBuffer(mu, m_numDRDofs * sizeof(double));
 		assert(id == DR_DOFS0);
@@ -90,6 +145,13 @@ bool seissol::checkpoint::Manager::init(real* dofs, unsigned int numDofs,
 		addBuffer(state, m_numDRDofs * sizeof(double));
 		addBuffer(strength, m_numDRDofs * sizeof(double));
 
+		if (m_backend == MPIO_ELASTIC) {
+			id = addSyncBuffer(m_cellIds.data(), m_cellIds.size() * sizeof(unsigned long));
+			assert(id == CELL_IDS);
+			id = addSyncBuffer(m_faceIds.data(), m_faceIds.size() * sizeof(unsigned long));
+			assert(id == FACE_IDS);
+		}
+
 		//
 		// Initialization for loading checkpoints
 		//
@@ -108,6 +170,10 @@ bool seissol::checkpoint::Manager::init(real* dofs, unsigned int numDofs,
 		// Load checkpoint?
 		if (exists) {
 			waveField->load(dofs);
+			// Continue from the last incremental checkpoint of the full checkpoint
+			// (incremental checkpoints depend on the partitioning)
+			if (m_backend != MPIO_ELASTIC && m_backend != GDS)
+				Incremental::load(m_filename, m_header, dofs, numDofs);
 			fault->load(faultTimeStep, mu, slipRate1, slipRate2,
 				slip, slip1, slip2, state, strength);
 		} else {
@@ -116,24 +182,58 @@ bool seissol::checkpoint::Manager::init(real* dofs, unsigned int numDofs,
 			waveField->initHeader(m_header);
 		}
 
-		waveField->close();
+		// Restart from the node-local checkpoints if they are newer
+		m_nodeLocal.init(m_filename, numDofs, m_numDRDofs);
+		if (m_deviceWaveField && m_nodeLocal.enabled())
+			logError() << "Node-local checkpoints are not supported by the GPUDirect Storage checkpoint.";
+		m_dofs = dofs;
+		double* drDofs[NodeLocal::NumberOfDRVariables] = {mu, slipRate1, slipRate2, slip, slip1, slip2, state, strength};
+		for (unsigned int i = 0; i < NodeLocal::NumberOfDRVariables; i++)
+			m_drDofs[i] = drDofs[i];
+		const double backendTime = exists ? m_header.time() : -std::numeric_limits<double>::infinity();
+		const bool loadedNodeLocal = m_nodeLocal.load(backendTime, m_header, dofs, drDofs, faultTimeStep);
+
+		if (m_deviceWaveField) {
+			m_deviceWaveField->initLate(dofs);
+		} else {
+			waveField->close();
+			delete waveField;
+		}
 		fault->close();
-
-		delete waveField;
 		delete fault;
 
 		sendBuffer(FILENAME,  m_filename.size()+1);
+		if (m_backend == MPIO_ELASTIC) {
+			sendBuffer(CELL_IDS, m_cellIds.size() * sizeof(unsigned long));
+			sendBuffer(FACE_IDS, m_faceIds.size() * sizeof(unsigned long));
+		}
 
 		// Initialize the executor
 		CheckpointInitParam param;
 		param.backend = m_backend;
 		param.numBndGP = numBndGP;
 		param.loaded = exists;
+		param.incrementalCheckpoints = utils::Env::get<unsigned int>("SEISSOL_CHECKPOINT_INCREMENTAL", 0);
+		param.incrementalTolerance = utils::Env::get<double>("SEISSOL_CHECKPOINT_INCREMENTAL_TOLERANCE", 0.0);
+		param.blockSize = tensor::Q::size();
+		if (param.incrementalCheckpoints > 0
+				&& (m_backend == HDF5_ASYNC || m_backend == MPIO_ASYNC || m_backend == MPIO_ELASTIC || m_backend == GDS
+					|| seissol::SeisSol::main.asyncIO().groupSize() != 1)) {
+			logWarning(seissol::MPI::mpi.rank()) << "Incremental checkpoints are not supported with the"
+				<< "asynchronous backends, the elastic MPI-IO backend, the GPUDirect Storage backend or with dedicated output ranks; writing full checkpoints.";
+			param.incrementalCheckpoints = 0;
+		}
 		callInit(param);
 
 		removeBuffer(FILENAME);
+		if (m_backend == MPIO_ELASTIC) {
+			removeBuffer(CELL_IDS);
+			removeBuffer(FACE_IDS);
+			std::vector<unsigned long>().swap(m_cellIds);
+			std::vector<unsigned long>().swap(m_faceIds);
+		}
 
-		return exists;
+		return exists || loadedNodeLocal;
 }
 
 void seissol::checkpoint::Manager::setUp()
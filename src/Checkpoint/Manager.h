@@ -47,6 +47,8 @@
 #include <cassert>
 #include <cstring>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "utils/logger.h"
 
@@ -56,6 +58,8 @@
 #include "ManagerExecutor.h"
 #include "Wavefield.h"
 #include "Fault.h"
+#include "NodeLocal.h"
+#include "Prefetch.h"
 #include "WavefieldHeader.h"
 #include "Monitoring/Stopwatch.h"
 
@@ -85,13 +89,38 @@ private:
 	/** Checkpoint header */
 	WavefieldHeader m_header;
 
+	/** Node-local checkpoint level */
+	NodeLocal m_nodeLocal;
+
+	/** Reads the wave field checkpoint during the setup */
+	Prefetch m_prefetch;
+
+	/** The data written to the node-local checkpoints */
+	const real* m_dofs;
+	const double* m_drDofs[NodeLocal::NumberOfDRVariables];
+
+	/** Global ids of the cells and the fault sides (only for MPIO_ELASTIC) */
+	std::vector<unsigned long> m_cellIds;
+	std::vector<unsigned long> m_faceIds;
+
+	/** Wave field written by the compute ranks (only for GDS) */
+	Wavefield* m_deviceWaveField;
+
+	/** True if the last checkpoint of the device wave field is not yet linked */
+	bool m_deviceWaveFieldPending;
+
 	/** Stopwatch for checkpointing frontend */
 	Stopwatch m_stopwatch;
 
+	/** Wall-clock time of the last call to write */
+	double m_lastWriteTime = 0.0;
+
 public:
 	Manager()
 		: m_backend(DISABLED),
-		  m_numDofs(0), m_numDRDofs(0)
+		  m_numDofs(0), m_numDRDofs(0),
+		  m_dofs(0L), m_drDofs{},
+		  m_deviceWaveField(0L), m_deviceWaveFieldPending(false)
 	{
 	}
 
@@ -114,6 +143,27 @@ public:
 	}
 
 
+	/**
+	 * @return True if the back-end requires the global ids of the cells and the fault sides
+	 */
+	bool requiresGlobalIds() const
+	{
+		return m_backend == MPIO_ELASTIC;
+	}
+
+	/**
+	 * Set the global ids for the checkpoint layout of the MPIO_ELASTIC back-end (before init)
+	 *
+	 * @param cellIds The global id of the cell of each block of dofs
+	 * @param faceIds Two ids for each fault side (4 * id + side of the element on the plus side and
+	 *  of the element on the minus side, or INVALID_GLOBAL_ID if the element is not local)
+	 */
+	void setGlobalIds(std::vector<unsigned long> cellIds, std::vector<unsigned long> faceIds)
+	{
+		m_cellIds = std::move(cellIds);
+		m_faceIds = std::move(faceIds);
+	}
+
 	/**
 	 * This is called on all ranks
 	 */
@@ -127,6 +177,12 @@ public:
 		return m_header;
 	}
 
+	/**
+	 * Start reading the wave field checkpoint of this rank in the background (SEISSOL_CHECKPOINT_PREFETCH=1),
+	 * such that init() loads it from the page cache. Called on all ranks as soon as the LTS tree is fixed.
+	 */
+	void prefetch();
+
 	/**
 	 * Initialize checkpointing and load the last checkpoint if present
 	 *
@@ -151,12 +207,24 @@ public:
 			return;
 
 		m_stopwatch.start();
+		Stopwatch writeStopwatch;
+		writeStopwatch.start();
 
 		const int rank = seissol::MPI::mpi.rank();
 
 		// Set current time
 		m_header.time() = time;
 
+		if (m_nodeLocal.enabled()) {
+			logInfo(rank) << "Checkpoint: Writing node-local checkpoint at time" << utils::nospace << time << '.';
+			if (!m_nodeLocal.write(m_header, m_dofs, m_drDofs, faultTimeStep)) {
+				// Only every n-th checkpoint is drained to the parallel file system
+				m_stopwatch.pause();
+				m_lastWriteTime = writeStopwatch.split();
+				return;
+			}
+		}
+
 		SCOREP_USER_REGION_DEFINE(r_wait);
 		SCOREP_USER_REGION_BEGIN(r_wait, "checkpointmanager_wait", SCOREP_USER_REGION_TYPE_COMMON);
 		logInfo(rank) << "Checkpoint: Waiting for last.";
@@ -165,9 +233,18 @@ public:
 
 		logInfo(rank) << "Checkpoint: Writing at time" << utils::nospace << time << '.';
 
+		if (m_deviceWaveField) {
+			// The executor has linked the last checkpoint (together with the fault),
+			// only switch to the other file
+			if (m_deviceWaveFieldPending)
+				m_deviceWaveField->updateLink();
+			m_deviceWaveField->write(m_header.data(), m_header.size());
+			m_deviceWaveFieldPending = true;
+		}
+
 		// Send buffers
 		sendBuffer(HEADER);
-		sendBuffer(DOFS, m_numDofs * sizeof(real));
+		sendBuffer(DOFS, m_deviceWaveField ? 0 : m_numDofs * sizeof(real));
 		for (unsigned int i = 0; i < 8; i++)
 			sendBuffer(DR_DOFS0+i, m_numDRDofs * sizeof(double));
 
@@ -181,10 +258,19 @@ public:
 		SCOREP_USER_REGION_END(r_call);
 
 		m_stopwatch.pause();
+		m_lastWriteTime = writeStopwatch.split();
 
 		logInfo(rank) << "Checkpoint: Writing at time" << utils::nospace << time << ". Done.";
 	}
 
+	/**
+	 * @return The wall-clock time of the last checkpoint, i.e. the time the simulation waited for it
+	 */
+	double lastWriteTime() const
+	{
+		return m_lastWriteTime;
+	}
+
 	/**
 	 * Close checkpointing
 	 */
@@ -196,6 +282,12 @@ public:
 		// Terminate the executor
 		wait();
 
+		if (m_deviceWaveField) {
+			m_deviceWaveField->close();
+			delete m_deviceWaveField;
+			m_deviceWaveField = 0L;
+		}
+
 		m_stopwatch.printTime("Time checkpoint frontend:");
 
 		// Cleanup the asynchronous module
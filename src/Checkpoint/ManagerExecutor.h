@@ -43,6 +43,7 @@
 #include "async/ExecInfo.h"
 
 #include "Backend.h"
+#include "Incremental.h"
 #include "Monitoring/Stopwatch.h"
 
 namespace seissol
@@ -56,7 +57,10 @@ enum BufferTags {
 	FILENAME = 0,
 	HEADER = 1,
 	DOFS = 2,
-	DR_DOFS0 = 3
+	DR_DOFS0 = 3,
+	/** Global ids for the MPIO_ELASTIC back-end (only during initialization) */
+	CELL_IDS = DR_DOFS0 + 8,
+	FACE_IDS = CELL_IDS + 1
 };
 
 /**
@@ -67,6 +71,10 @@ struct CheckpointInitParam
 	Backend backend;
 	unsigned int numBndGP;
 	bool loaded;
+	/** Incremental checkpoints between two full checkpoints */
+	unsigned int incrementalCheckpoints;
+	double incrementalTolerance;
+	unsigned int blockSize;
 };
 
 /**
@@ -87,6 +95,9 @@ private:
 	/** The dynamic rupture checkpoint */
 	Fault *m_fault;
 
+	/** Incremental wave field checkpoints */
+	Incremental m_incremental;
+
 	/** Stopwatch for checkpoint backend */
 	Stopwatch m_stopwatch;
 
@@ -111,6 +122,13 @@ public:
 		m_waveField->setFilename(filename);
 		m_fault->setFilename(filename);
 
+		if (param.backend == MPIO_ELASTIC) {
+			m_waveField->setCellIds(static_cast<const unsigned long*>(info.buffer(CELL_IDS)),
+				info.bufferSize(CELL_IDS) / sizeof(unsigned long));
+			m_fault->setFaceIds(static_cast<const unsigned long*>(info.buffer(FACE_IDS)),
+				info.bufferSize(FACE_IDS) / (2 * sizeof(unsigned long)));
+		}
+
 		m_waveField->init(info.bufferSize(HEADER), info.bufferSize(DOFS) / sizeof(real));
 		m_fault->init(info.bufferSize(DR_DOFS0) / param.numBndGP / sizeof(double), param.numBndGP);
 
@@ -125,6 +143,8 @@ public:
 			drDofs[i] = static_cast<const double*>(info.buffer(DR_DOFS0 + i));
 
 		m_waveField->initLate(dofs);
+		m_incremental.init(filename, param.incrementalCheckpoints, param.incrementalTolerance,
+			info.bufferSize(DOFS) / sizeof(real), param.blockSize);
 		m_fault->initLate(drDofs[0], drDofs[1], drDofs[2], drDofs[3], drDofs[4], drDofs[5],
 			drDofs[6], drDofs[7]);
 	}
@@ -136,13 +156,24 @@ public:
 	{
 		m_stopwatch.start();
 
-		m_waveField->write(info.buffer(HEADER), info.bufferSize(HEADER));
+		const real* dofs = static_cast<const real*>(info.buffer(DOFS));
+		const bool full = m_incremental.isFullCheckpointDue();
+		if (full)
+			m_waveField->write(info.buffer(HEADER), info.bufferSize(HEADER));
+		else
+			m_incremental.write(param.time, info.buffer(HEADER), info.bufferSize(HEADER), dofs);
 		m_fault->write(param.faultTimeStep);
 
 		// Update both links at the "same" time
-		m_waveField->updateLink();
+		if (full)
+			m_waveField->updateLink();
+		else
+			m_incremental.commit();
 		m_fault->updateLink();
 
+		if (full)
+			m_incremental.setReference(param.time, dofs);
+
 		// Prepare next checkpoint (only for async checkpoints)
 		m_waveField->writePrepare(info.buffer(HEADER), info.bufferSize(HEADER));
 		m_fault->writePrepare(param.faultTimeStep);
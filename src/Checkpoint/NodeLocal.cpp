@@ -0,0 +1,123 @@
+#include "NodeLocal.h"
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <sys/stat.h>
+#include <vector>
+
+#include "Parallel/MPI.h"
+#include "utils/env.h"
+
+namespace {
+constexpr unsigned long Magic = 0x4c41434f4c535353UL; // "SSSLOCAL"
+
+struct FileHeader {
+  unsigned long magic;
+  double time;
+  unsigned long headerSize;
+  unsigned long numberOfDofs;
+  unsigned long numberOfDRDofs;
+  int faultTimeStep;
+};
+} // namespace
+
+std::string seissol::checkpoint::NodeLocal::localFile(const std::string& directory,
+                                                      const std::string& filename,
+                                                      int rank) {
+  const auto separator = filename.find_last_of('/');
+  const std::string basename = separator == std::string::npos ? filename : filename.substr(separator + 1);
+  return directory + "/" + basename + "." + std::to_string(rank) + ".local";
+}
+
+void seissol::checkpoint::NodeLocal::init(const std::string& filename,
+                                          unsigned long numberOfDofs,
+                                          unsigned int numberOfDRDofs) {
+  const std::string directory = utils::Env::get("SEISSOL_CHECKPOINT_LOCAL_DIR", "");
+  if (directory.empty()) {
+    return;
+  }
+  const int rank = seissol::MPI::mpi.rank();
+
+  if (mkdir(directory.c_str(), S_IRWXU | S_IRWXG) != 0 && errno != EEXIST) {
+    logError() << "Could not create the node-local checkpoint directory" << directory << ":" << strerror(errno);
+  }
+  m_file = localFile(directory, filename, rank);
+  m_numberOfDofs = numberOfDofs;
+  m_numberOfDRDofs = numberOfDRDofs;
+  m_drainInterval = utils::Env::get<unsigned int>("SEISSOL_CHECKPOINT_LOCAL_DRAIN", 1);
+  if (m_drainInterval == 0) {
+    logError() << "SEISSOL_CHECKPOINT_LOCAL_DRAIN has to be positive.";
+  }
+  m_numberOfCheckpoints = 0;
+
+  logInfo(rank) << "Writing node-local checkpoints to" << directory << "and one out of" << m_drainInterval
+                << "checkpoints to the parallel file system.";
+}
+
+bool seissol::checkpoint::NodeLocal::write(const WavefieldHeader& header,
+                                           const real* dofs,
+                                           const double* const* drDofs,
+                                           int faultTimeStep) {
+  const FileHeader fileHeader{
+      Magic, header.time(), header.size(), m_numberOfDofs, m_numberOfDRDofs, faultTimeStep};
+
+  // Replace the last checkpoint only once the new one is complete. The local file does not survive
+  // the failure of its node either, thus fsync is not required.
+  const std::string temporaryFile = m_file + ".tmp";
+  std::ofstream out(temporaryFile, std::ios::binary | std::ios::trunc);
+  out.write(reinterpret_cast<const char*>(&fileHeader), sizeof(FileHeader));
+  out.write(static_cast<const char*>(header.data()), header.size());
+  out.write(reinterpret_cast<const char*>(dofs), m_numberOfDofs * sizeof(real));
+  for (unsigned int i = 0; i < NumberOfDRVariables; i++) {
+    out.write(reinterpret_cast<const char*>(drDofs[i]), m_numberOfDRDofs * sizeof(double));
+  }
+  out.close();
+  if (!out || std::rename(temporaryFile.c_str(), m_file.c_str()) != 0) {
+    logError() << "Could not write the node-local checkpoint" << m_file;
+  }
+
+  return m_numberOfCheckpoints++ % m_drainInterval == 0;
+}
+
+bool seissol::checkpoint::NodeLocal::load(
+    double backendTime, WavefieldHeader& header, real* dofs, double* const* drDofs, int& faultTimeStep) {
+  if (!enabled()) {
+    return false;
+  }
+  const int rank = seissol::MPI::mpi.rank();
+
+  std::ifstream in(m_file, std::ios::binary);
+  FileHeader fileHeader{};
+  in.read(reinterpret_cast<char*>(&fileHeader), sizeof(FileHeader));
+  int valid = in && fileHeader.magic == Magic && fileHeader.headerSize == header.size() &&
+              fileHeader.numberOfDofs == m_numberOfDofs && fileHeader.numberOfDRDofs == m_numberOfDRDofs &&
+              fileHeader.time > backendTime;
+
+  // All ranks have to continue from the same time
+  double minTime = valid ? fileHeader.time : -std::numeric_limits<double>::infinity();
+  double maxTime = minTime;
+#ifdef USE_MPI
+  MPI_Allreduce(MPI_IN_PLACE, &valid, 1, MPI_INT, MPI_LAND, seissol::MPI::mpi.comm());
+  MPI_Allreduce(MPI_IN_PLACE, &minTime, 1, MPI_DOUBLE, MPI_MIN, seissol::MPI::mpi.comm());
+  MPI_Allreduce(MPI_IN_PLACE, &maxTime, 1, MPI_DOUBLE, MPI_MAX, seissol::MPI::mpi.comm());
+#endif // USE_MPI
+  if (!valid || minTime != maxTime) {
+    return false;
+  }
+
+  in.read(static_cast<char*>(header.data()), header.size());
+  in.read(reinterpret_cast<char*>(dofs), m_numberOfDofs * sizeof(real));
+  for (unsigned int i = 0; i < NumberOfDRVariables; i++) {
+    in.read(reinterpret_cast<char*>(drDofs[i]), m_numberOfDRDofs * sizeof(double));
+  }
+  if (!in) {
+    logError() << "The node-local checkpoint" << m_file << "is incomplete.";
+  }
+  faultTimeStep = fileHeader.faultTimeStep;
+
+  logInfo(rank) << "Loaded the node-local checkpoints at time" << fileHeader.time;
+  return true;
+}
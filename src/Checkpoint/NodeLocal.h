@@ -0,0 +1,58 @@
+#ifndef SEISSOL_CHECKPOINT_NODELOCAL_H
+#define SEISSOL_CHECKPOINT_NODELOCAL_H
+
+#include <string>
+
+#include "utils/logger.h"
+
+#include "Kernels/precision.hpp"
+#include "WavefieldHeader.h"
+
+namespace seissol::checkpoint {
+/**
+ * Node-local checkpoint level: with SEISSOL_CHECKPOINT_LOCAL_DIR, every checkpoint is first written
+ * synchronously by each rank to its own file in this directory (e.g. a node-local SSD). Only every
+ * SEISSOL_CHECKPOINT_LOCAL_DRAIN-th checkpoint is passed to the backend, which drains it to the
+ * parallel file system in the background.
+ *
+ * A restart uses the node-local checkpoints if all ranks find one that is newer than the
+ * checkpoint of the backend.
+ **/
+class NodeLocal {
+  public:
+  static constexpr unsigned int NumberOfDRVariables = 8;
+
+  void init(const std::string& filename, unsigned long numberOfDofs, unsigned int numberOfDRDofs);
+
+  bool enabled() const { return !m_file.empty(); }
+
+  /**
+   * Writes the checkpoint to the node-local file.
+   *
+   * @return True if the checkpoint has to be drained to the backend
+   **/
+  bool write(const WavefieldHeader& header,
+             const real* dofs,
+             const double* const* drDofs,
+             int faultTimeStep);
+
+  /**
+   * Loads the node-local checkpoints if they are newer than backendTime on all ranks.
+   *
+   * @return True if the node-local checkpoints were loaded
+   **/
+  bool load(double backendTime, WavefieldHeader& header, real* dofs, double* const* drDofs, int& faultTimeStep);
+
+  //! The node-local file of a rank
+  static std::string localFile(const std::string& directory, const std::string& filename, int rank);
+
+  private:
+  std::string m_file;
+  unsigned long m_numberOfDofs = 0;
+  unsigned int m_numberOfDRDofs = 0;
+  unsigned int m_drainInterval = 1;
+  unsigned int m_numberOfCheckpoints = 0;
+};
+} // namespace seissol::checkpoint
+
+#endif // SEISSOL_CHECKPOINT_NODELOCAL_H
@@ -0,0 +1,35 @@
+#include "Prefetch.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <vector>
+
+void seissol::checkpoint::Prefetch::start(const std::string& file, unsigned long chunkSize) {
+  wait();
+  m_bytes = 0;
+  m_thread = std::thread(&Prefetch::run, this, file, chunkSize);
+}
+
+unsigned long seissol::checkpoint::Prefetch::wait() {
+  if (m_thread.joinable()) {
+    m_thread.join();
+  }
+  return m_bytes;
+}
+
+void seissol::checkpoint::Prefetch::run(std::string file, unsigned long chunkSize) {
+  const int fh = ::open(file.c_str(), O_RDONLY);
+  if (fh < 0) {
+    return;
+  }
+  posix_fadvise(fh, 0, 0, POSIX_FADV_SEQUENTIAL);
+  posix_fadvise(fh, 0, 0, POSIX_FADV_WILLNEED);
+
+  // The advice is not honored by all file systems; reading the file fills the page cache
+  std::vector<char> buffer(chunkSize);
+  ssize_t readSize = 0;
+  while ((readSize = ::read(fh, buffer.data(), buffer.size())) > 0) {
+    m_bytes += readSize;
+  }
+  ::close(fh);
+}
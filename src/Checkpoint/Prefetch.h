@@ -0,0 +1,35 @@
+#ifndef SEISSOL_CHECKPOINT_PREFETCH_H
+#define SEISSOL_CHECKPOINT_PREFETCH_H
+
+#include <string>
+#include <thread>
+
+namespace seissol::checkpoint {
+/**
+ * Reads a checkpoint file on a background thread while the solver is set up, such that the
+ * later load of the checkpoint is served from the page cache (SEISSOL_CHECKPOINT_PREFETCH=1).
+ * Missing files are ignored; the prefetch is only a hint.
+ **/
+class Prefetch {
+  public:
+  ~Prefetch() { wait(); }
+
+  //! Starts reading the file in chunks of chunkSize bytes
+  void start(const std::string& file, unsigned long chunkSize = 1ul << 26);
+
+  /**
+   * Waits until the file is read.
+   *
+   * @return The number of bytes read
+   **/
+  unsigned long wait();
+
+  private:
+  void run(std::string file, unsigned long chunkSize);
+
+  std::thread m_thread;
+  unsigned long m_bytes = 0;
+};
+} // namespace seissol::checkpoint
+
+#endif // SEISSOL_CHECKPOINT_PREFETCH_H
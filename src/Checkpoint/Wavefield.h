@@ -108,6 +108,16 @@ public:
 		m_header = &header;
 	}
 
+	/**
+	 * Set the global ids of the cells (one for each block of dofs).
+	 *
+	 * Only used by back-ends with a layout independent of the partitioning; must be called
+	 * before init().
+	 */
+	virtual void setCellIds(const unsigned long* cellIds, unsigned long numCells)
+	{
+	}
+
 	/**
 	 * Initialize checkpointing
 	 *
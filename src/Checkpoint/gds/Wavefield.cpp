@@ -0,0 +1,143 @@
+#include <cstring>
+
+#include <cuda_runtime_api.h>
+
+#include "Wavefield.h"
+
+bool seissol::checkpoint::gds::Wavefield::init(size_t headerSize, unsigned long numDofs, unsigned int groupSize)
+{
+	// No aggregation: cuFile writes the dofs of each rank to its own file
+	seissol::checkpoint::Wavefield::init(headerSize, numDofs, groupSize);
+
+	checkCuFile(cuFileDriverOpen(), "cuFileDriverOpen");
+	m_driverOpen = true;
+
+	return exists();
+}
+
+void seissol::checkpoint::gds::Wavefield::load(real* dofs)
+{
+	logInfo(rank()) << "Loading wave field checkpoint with GPUDirect Storage";
+
+	seissol::checkpoint::CheckPoint::setLoaded();
+
+	int file = open();
+	checkErr(file);
+
+	// Read header
+	checkErr(read(file, header().data(), header().size()), header().size());
+
+	// cuFile only bypasses the page cache for files opened with O_DIRECT
+	int directFile = open64(linkFile().c_str(), O_RDONLY | O_DIRECT);
+	CUfileHandle_t handle = registerHandle(directFile >= 0 ? directFile : file);
+
+	// Read dofs
+	const unsigned long size = numDofs()*sizeof(real);
+	for (unsigned long done = 0; done < size; ) {
+		ssize_t readSize = cuFileRead(handle, dofs, size - done, header().size() + done, done);
+		if (readSize <= 0)
+			logError() << "cuFileRead failed:" << readSize;
+		done += readSize;
+	}
+
+	cuFileHandleDeregister(handle);
+
+	// Close the files
+	if (directFile >= 0)
+		checkErr(::close(directFile));
+	checkErr(::close(file));
+}
+
+void seissol::checkpoint::gds::Wavefield::initLate(const real* dofs)
+{
+	posix::Wavefield::initLate(dofs);
+
+	if (alignment() == 0 || !utils::Env::get<int>("SEISSOL_CHECKPOINT_DIRECT", 0))
+		logWarning(rank()) << "GPUDirect Storage requires SEISSOL_CHECKPOINT_DIRECT=1 and SEISSOL_CHECKPOINT_ALIGNMENT=4096"
+			<< "to bypass the page cache.";
+
+	// Managed memory cannot be registered; cuFile uses its device bounce buffers instead
+	cudaPointerAttributes attributes;
+	if (numDofs() > 0
+			&& cudaPointerGetAttributes(&attributes, dofs) == cudaSuccess
+			&& attributes.type == cudaMemoryTypeDevice) {
+		checkCuFile(cuFileBufRegister(dofs, numDofs()*sizeof(real), 0), "cuFileBufRegister");
+		m_bufferRegistered = true;
+	}
+}
+
+void seissol::checkpoint::gds::Wavefield::write(const void* header, size_t headerSize)
+{
+	EPIK_TRACER("CheckPoint_write");
+	SCOREP_USER_REGION("CheckPoint_write", SCOREP_USER_REGION_TYPE_FUNCTION);
+
+	logInfo(rank()) << "Checkpoint backend: Writing with GPUDirect Storage.";
+
+	// Save data
+	EPIK_USER_REG(r_write_wavefield, "checkpoint_write_wavefield");
+	SCOREP_USER_REGION_DEFINE(r_write_wavefield);
+	EPIK_USER_START(r_write_wavefield);
+	SCOREP_USER_REGION_BEGIN(r_write_wavefield, "checkpoint_write_wavefield", SCOREP_USER_REGION_TYPE_COMMON);
+
+	const Segment segment = {header, headerSize};
+	writeSegments(&segment, 1);
+
+	if (!m_registered[odd()]) {
+		m_handles[odd()] = registerHandle(file());
+		m_registered[odd()] = true;
+	}
+
+	// Write the exact size, the device buffer is not padded to the alignment
+	const unsigned long size = numDofs()*sizeof(real);
+	for (unsigned long done = 0; done < size; ) {
+		ssize_t written = cuFileWrite(m_handles[odd()], dofs(), size - done, headerSize + done, done);
+		if (written <= 0)
+			logError() << "cuFileWrite failed:" << written;
+		done += written;
+	}
+
+	EPIK_USER_END(r_write_wavefield);
+	SCOREP_USER_REGION_END(r_write_wavefield);
+
+	// Finalize the checkpoint
+	finalizeCheckpoint();
+
+	logInfo(rank()) << "Checkpoint backend: Writing. Done.";
+}
+
+void seissol::checkpoint::gds::Wavefield::close()
+{
+	for (unsigned int i = 0; i < 2; i++) {
+		if (m_registered[i])
+			cuFileHandleDeregister(m_handles[i]);
+		m_registered[i] = false;
+	}
+
+	if (m_bufferRegistered)
+		cuFileBufDeregister(dofs());
+	m_bufferRegistered = false;
+
+	posix::Wavefield::close();
+
+	if (m_driverOpen)
+		cuFileDriverClose();
+	m_driverOpen = false;
+}
+
+CUfileHandle_t seissol::checkpoint::gds::Wavefield::registerHandle(int file)
+{
+	CUfileDescr_t descr;
+	memset(&descr, 0, sizeof(descr));
+	descr.handle.fd = file;
+	descr.type = CU_FILE_HANDLE_TYPE_OPAQUE_FD;
+
+	CUfileHandle_t handle;
+	checkCuFile(cuFileHandleRegister(&handle, &descr), "cuFileHandleRegister");
+	return handle;
+}
+
+void seissol::checkpoint::gds::Wavefield::checkCuFile(CUfileError_t status, const char* function)
+{
+	if (status.err != CU_FILE_SUCCESS)
+		logError() << "Error in the GPUDirect Storage checkpoint module:" << function << "failed with" << status.err;
+}
@@ -0,0 +1,89 @@
+#ifndef CHECKPOINT_GDS_WAVEFIELD_H
+#define CHECKPOINT_GDS_WAVEFIELD_H
+
+#ifndef USE_GDS
+#include "Checkpoint/WavefieldDummy.h"
+#else // USE_GDS
+
+#include <cufile.h>
+
+#include "Checkpoint/posix/Wavefield.h"
+
+#endif // USE_GDS
+
+namespace seissol
+{
+
+namespace checkpoint
+{
+
+namespace gds
+{
+
+#ifndef USE_GDS
+typedef WavefieldDummy Wavefield;
+#else // USE_GDS
+
+/**
+ * Wave field checkpoint which transfers the dofs between device memory and the file with
+ * GPUDirect Storage (cuFile)
+ *
+ * The files are identical to the files of the POSIX backend. In contrast to the other backends,
+ * the wave field is written by the compute ranks (the dofs never reach the checkpoint thread).
+ */
+class Wavefield : public posix::Wavefield
+{
+private:
+	/** True if the cuFile driver was opened */
+	bool m_driverOpen;
+
+	/** cuFile handles of the two checkpoint files */
+	CUfileHandle_t m_handles[2];
+
+	/** True if the corresponding handle is registered */
+	bool m_registered[2];
+
+	/** True if the dofs are registered as cuFile buffer */
+	bool m_bufferRegistered;
+
+public:
+	Wavefield()
+		: seissol::checkpoint::CheckPoint(IDENTIFIER),
+		seissol::checkpoint::Wavefield(IDENTIFIER),
+		posix::Wavefield(IDENTIFIER),
+		m_driverOpen(false), m_bufferRegistered(false)
+	{
+		m_registered[0] = m_registered[1] = false;
+	}
+
+	bool init(size_t headerSize, unsigned long numDofs, unsigned int groupSize = 1) override;
+
+	void load(real* dofs) override;
+
+	void initLate(const real* dofs) override;
+
+	void write(const void* header, size_t headerSize) override;
+
+	void close() override;
+
+private:
+	/**
+	 * Register a file descriptor with cuFile
+	 */
+	static CUfileHandle_t registerHandle(int file);
+
+	/**
+	 * Check the return value of cuFile
+	 */
+	static void checkCuFile(CUfileError_t status, const char* function);
+};
+
+#endif // USE_GDS
+
+}
+
+}
+
+}
+
+#endif // CHECKPOINT_GDS_WAVEFIELD_H
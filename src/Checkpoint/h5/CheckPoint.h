@@ -55,6 +55,11 @@
 #endif // USE_MPI
 #include "Initializer/preProcessorMacros.fpp"
 
+#if H5_VERSION_GE(1, 13, 0)
+/** Asynchronous operations with event sets (requires the async VOL connector to overlap the I/O) */
+#define USE_HDF_ASYNC
+#endif
+
 namespace seissol
 {
 
@@ -73,10 +78,13 @@ private:
 	/** Property list for data access */
 	hid_t m_h5XferList;
 
+	/** Event set for asynchronous writes (-1 for synchronous writes) */
+	hid_t m_h5eventSet;
+
 public:
 	CheckPoint(unsigned long identifier)
 		: seissol::checkpoint::CheckPoint(identifier),
-		m_h5XferList(-1)
+		m_h5XferList(-1), m_h5eventSet(-1)
 	{
 		m_h5files[0] = m_h5files[1] = -1;
 	}
@@ -98,6 +106,11 @@ public:
 
 		if (m_h5XferList >= 0)
 			checkH5Err(H5Pclose(m_h5XferList));
+
+#ifdef USE_HDF_ASYNC
+		if (m_h5eventSet >= 0)
+			checkH5Err(H5ESclose(m_h5eventSet));
+#endif // USE_HDF_ASYNC
 	}
 
 protected:
@@ -167,6 +180,70 @@ protected:
 		return m_h5XferList;
 	}
 
+	/**
+	 * Create the event set for asynchronous writes
+	 *
+	 * Without support for event sets in HDF5, all writes remain synchronous.
+	 */
+	void createEventSet()
+	{
+#ifdef USE_HDF_ASYNC
+		m_h5eventSet = H5EScreate();
+		checkH5Err(m_h5eventSet);
+#endif // USE_HDF_ASYNC
+	}
+
+	/**
+	 * Wait until all writes of the event set are completed
+	 */
+	void waitEventSet()
+	{
+#ifdef USE_HDF_ASYNC
+		if (m_h5eventSet < 0)
+			return;
+
+		size_t numInProgress;
+		hbool_t failed;
+		checkH5Err(H5ESwait(m_h5eventSet, H5ES_WAIT_FOREVER, &numInProgress, &failed));
+		if (failed)
+			logError() << "Asynchronous checkpoint write failed";
+#endif // USE_HDF_ASYNC
+	}
+
+	/**
+	 * Write an attribute (asynchronously if an event set exists)
+	 *
+	 * The buffer has to remain valid until waitEventSet() returns.
+	 */
+	void writeAttribute(hid_t h5attr, hid_t h5type, const void* buffer)
+	{
+#ifdef USE_HDF_ASYNC
+		if (m_h5eventSet >= 0) {
+			checkH5Err(H5Awrite_async(h5attr, h5type, buffer, m_h5eventSet));
+			return;
+		}
+#endif // USE_HDF_ASYNC
+		checkH5Err(H5Awrite(h5attr, h5type, buffer));
+	}
+
+	/**
+	 * Write a data set collectively (asynchronously if an event set exists)
+	 *
+	 * The buffer has to remain valid until waitEventSet() returns.
+	 */
+	void writeDataset(hid_t h5data, hid_t h5memSpace, hid_t h5fSpace, const void* buffer)
+	{
+#ifdef USE_HDF_ASYNC
+		if (m_h5eventSet >= 0) {
+			checkH5Err(H5Dwrite_async(h5data, H5T_NATIVE_DOUBLE, h5memSpace, h5fSpace,
+					m_h5XferList, buffer, m_h5eventSet));
+			return;
+		}
+#endif // USE_HDF_ASYNC
+		checkH5Err(H5Dwrite(h5data, H5T_NATIVE_DOUBLE, h5memSpace, h5fSpace,
+				m_h5XferList, buffer));
+	}
+
 	/**
 	 * Open a check point file
 	 *
@@ -125,14 +125,26 @@ void seissol::checkpoint::h5::Fault::write(int timestepFault)
 
 	logInfo(rank()) << "Checkpoint backend: Writing fault.";
 
-	// Create array with all pointers
+	const double* values[NUM_VARIABLES];
+	for (unsigned int i = 0; i < NUM_VARIABLES; i++)
+		values[i] = data(i);
+	writeData(&timestepFault, values);
+
+	// Finalize the checkpoint
+	finalizeCheckpoint();
+
+	logInfo(rank()) << "Checkpoint backend: Writing fault. Done.";
+}
+
+void seissol::checkpoint::h5::Fault::writeData(const int* timestepFault, const double* const* values)
+{
 	EPIK_USER_REG(r_write_fault, "checkpoint_write_fault");
 	SCOREP_USER_REGION_DEFINE(r_write_fault);
 	EPIK_USER_START(r_write_fault);
 	SCOREP_USER_REGION_BEGIN(r_write_fault, "checkpoint_write_fault", SCOREP_USER_REGION_TYPE_COMMON);
 
 	// Attributes
-	checkH5Err(H5Awrite(m_h5timestepFault[odd()], H5T_NATIVE_INT, &timestepFault));
+	writeAttribute(m_h5timestepFault[odd()], H5T_NATIVE_INT, timestepFault);
 
 	// Set memory and file space
 	hsize_t fStart[2] = {fileOffset(), 0};
@@ -142,20 +154,13 @@ void seissol::checkpoint::h5::Fault::write(int timestepFault)
 	checkH5Err(H5Sselect_all(h5memSpace));
 	checkH5Err(H5Sselect_hyperslab(m_h5fSpaceData, H5S_SELECT_SET, fStart, 0L, count, 0L));
 
-	for (unsigned int i = 0; i < NUM_VARIABLES; i++) {
-		checkH5Err(H5Dwrite(m_h5data[odd()][i], H5T_NATIVE_DOUBLE, h5memSpace, m_h5fSpaceData,
-				h5XferList(), data(i)));
-	}
+	for (unsigned int i = 0; i < NUM_VARIABLES; i++)
+		writeDataset(m_h5data[odd()][i], h5memSpace, m_h5fSpaceData, values[i]);
 
 	checkH5Err(H5Sclose(h5memSpace));
 
 	EPIK_USER_END(r_write_fault);
 	SCOREP_USER_REGION_END(r_write_fault);
-
-	// Finalize the checkpoint
-	finalizeCheckpoint();
-
-	logInfo(rank()) << "Checkpoint backend: Writing fault. Done.";
 }
 
 bool seissol::checkpoint::h5::Fault::validate(hid_t h5file) const
@@ -134,12 +134,20 @@ public:
 	}
 
 
+protected:
+	/**
+	 * Write the time step of the fault writer and all variables to the current file
+	 *
+	 * @param values One array of numSides() * numBndGP() values per variable
+	 */
+	void writeData(const int* timestepFault, const double* const* values);
+
 private:
 	bool validate(hid_t h5file) const;
 
 	hid_t initFile(int odd, const char* filename);
 
-private:
+protected:
 	static const unsigned long IDENTIFIER = 0x7A127;
 };
 
@@ -0,0 +1,70 @@
+#include <cstring>
+
+#include "FaultAsync.h"
+
+bool seissol::checkpoint::h5::FaultAsync::init(unsigned int numSides, unsigned int numBndGP,
+		unsigned int groupSize)
+{
+	bool exists = Fault::init(numSides, numBndGP, groupSize);
+
+	if (numSides != 0) {
+		m_dataCopy = new double[NUM_VARIABLES * numSides * numBndGP];
+		createEventSet();
+	}
+
+	return exists;
+}
+
+void seissol::checkpoint::h5::FaultAsync::writePrepare(int timestepFault)
+{
+	EPIK_TRACER("CheckPointFault_writePrepare");
+	SCOREP_USER_REGION("CheckPointFault_writePrepare", SCOREP_USER_REGION_TYPE_FUNCTION);
+
+	if (numSides() == 0)
+		return;
+
+	// Create copy of the data
+	m_timestepFault = timestepFault;
+	const double* values[NUM_VARIABLES];
+	for (unsigned int i = 0; i < NUM_VARIABLES; i++) {
+		values[i] = &m_dataCopy[i*numSides()*numBndGP()];
+		memcpy(&m_dataCopy[i*numSides()*numBndGP()],
+				data(i), numSides()*numBndGP()*sizeof(double));
+	}
+
+	// Save data
+	writeData(&m_timestepFault, values);
+
+	m_started = true;
+
+	logInfo(rank()) << "Checkpoint backend: Writing fault. Done.";
+}
+
+void seissol::checkpoint::h5::FaultAsync::write(int timestepFault)
+{
+	EPIK_TRACER("CheckPointFault_write");
+	SCOREP_USER_REGION("CheckPointFault_write", SCOREP_USER_REGION_TYPE_FUNCTION);
+
+	if (numSides() == 0)
+		return;
+
+	logInfo(rank()) << "Checkpoint backend: Writing fault.";
+
+	if (m_started)
+		waitEventSet();
+
+	// Finalize the checkpoint
+	finalizeCheckpoint();
+}
+
+void seissol::checkpoint::h5::FaultAsync::close()
+{
+	if (numSides() != 0) {
+		// Finalize last checkpoint
+		write(0); // Time does not matter
+
+		delete [] m_dataCopy;
+	}
+
+	Fault::close();
+}
@@ -0,0 +1,66 @@
+#ifndef CHECKPOINT_H5_FAULT_ASYNC_H
+#define CHECKPOINT_H5_FAULT_ASYNC_H
+
+#ifndef USE_HDF
+#include "Checkpoint/FaultDummy.h"
+#else // USE_HDF
+
+#include "Fault.h"
+
+#endif // USE_HDF
+
+namespace seissol
+{
+
+namespace checkpoint
+{
+
+namespace h5
+{
+
+#ifndef USE_HDF
+typedef FaultDummy FaultAsync;
+#else // USE_HDF
+
+/**
+ * Fault checkpoints which are completed with the next checkpoint (see WavefieldAsync)
+ */
+class FaultAsync : public Fault
+{
+private:
+	/** Copy of the time step of the fault writer */
+	int m_timestepFault;
+
+	/** Buffer for storing a copy of the data */
+	double* m_dataCopy;
+
+	/** True if a checkpoint was started */
+	bool m_started;
+
+public:
+	FaultAsync()
+		: seissol::checkpoint::CheckPoint(IDENTIFIER),
+		seissol::checkpoint::Fault(IDENTIFIER),
+		m_timestepFault(0), m_dataCopy(0L), m_started(false)
+	{
+	}
+
+	bool init(unsigned int numSides, unsigned int numBndGP,
+		unsigned int groupSize = 1) override;
+
+	void writePrepare(int timestepFault) override;
+
+	void write(int timestepFault) override;
+
+	void close();
+};
+
+#endif // USE_HDF
+
+}
+
+}
+
+}
+
+#endif // CHECKPOINT_H5_FAULT_ASYNC_H
@@ -136,13 +136,23 @@ void seissol::checkpoint::h5::Wavefield::write(const void* header, size_t header
 
 	logInfo(rank()) << "Checkpoint backend: Writing.";
 
+	writeData(header, dofs());
+
+	// Finalize the checkpoint
+	finalizeCheckpoint();
+
+	logInfo(rank()) << "Checkpoint backend: Writing. Done.";
+}
+
+void seissol::checkpoint::h5::Wavefield::writeData(const void* header, const real* dofs)
+{
 	EPIK_USER_REG(r_header, "checkpoint_write_header");
 	SCOREP_USER_REGION_DEFINE(r_header);
 	EPIK_USER_START(r_header);
 	SCOREP_USER_REGION_BEGIN(r_header, "checkpoint_write_header", SCOREP_USER_REGION_TYPE_COMMON);
 
 	// Header
-	checkH5Err(H5Awrite(m_h5header[odd()], m_h5headerType, header));
+	writeAttribute(m_h5header[odd()], m_h5headerType, header);
 
 	EPIK_USER_END(r_header);
 	SCOREP_USER_REGION_END(r_header);
@@ -163,8 +173,7 @@ void seissol::checkpoint::h5::Wavefield::write(const void* header, size_t header
 	for (unsigned int i = 0; i < totalIterations()-1; i++) {
 		checkH5Err(H5Sselect_hyperslab(m_h5fSpaceData, H5S_SELECT_SET, &fStart, 0L, &count, 0L));
 
-		checkH5Err(H5Dwrite(m_h5data[odd()], H5T_NATIVE_DOUBLE, h5memSpace, m_h5fSpaceData,
-				h5XferList(), &const_cast<real*>(dofs())[offset]));
+		writeDataset(m_h5data[odd()], h5memSpace, m_h5fSpaceData, &dofs[offset]);
 
 		// We are finished in less iterations, read data twice
 		// so everybody needs the same number of iterations
@@ -181,17 +190,11 @@ void seissol::checkpoint::h5::Wavefield::write(const void* header, size_t header
 	checkH5Err(h5memSpace);
 	checkH5Err(H5Sselect_all(h5memSpace));
 	checkH5Err(H5Sselect_hyperslab(m_h5fSpaceData, H5S_SELECT_SET, &fStart, 0L, &count, 0L));
-	checkH5Err(H5Dwrite(m_h5data[odd()], H5T_NATIVE_DOUBLE, h5memSpace, m_h5fSpaceData,
-			h5XferList(), &dofs()[offset]));
+	writeDataset(m_h5data[odd()], h5memSpace, m_h5fSpaceData, &dofs[offset]);
 	checkH5Err(H5Sclose(h5memSpace));
 
 	EPIK_USER_END(r_write_wavefield);
 	SCOREP_USER_REGION_END(r_write_wavefield);
-
-	// Finalize the checkpoint
-	finalizeCheckpoint();
-
-	logInfo(rank()) << "Checkpoint backend: Writing. Done.";
 }
 
 bool seissol::checkpoint::h5::Wavefield::validate(hid_t h5file) const
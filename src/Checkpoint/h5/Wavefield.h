@@ -128,11 +128,16 @@ public:
 	}
 
 protected:
+	/**
+	 * Write the header and the degrees of freedom to the current file
+	 */
+	void writeData(const void* header, const real* dofs);
+
 	bool validate(hid_t h5file) const;
 
 	hid_t initFile(int odd, const char* filename);
 
-private:
+protected:
 	static const unsigned long IDENTIFIER = 0x7A93F;
 };
 
@@ -0,0 +1,56 @@
+#include <cstring>
+
+#include "WavefieldAsync.h"
+
+bool seissol::checkpoint::h5::WavefieldAsync::init(size_t headerSize, unsigned long numDofs, unsigned int groupSize)
+{
+	bool exists = Wavefield::init(headerSize, numDofs, groupSize);
+
+	m_headerCopy.resize(headerSize);
+	m_dofsCopy = new real[numDofs];
+
+	createEventSet();
+
+	return exists;
+}
+
+void seissol::checkpoint::h5::WavefieldAsync::writePrepare(const void* header, size_t headerSize)
+{
+	EPIK_TRACER("CheckPoint_writePrepare");
+	SCOREP_USER_REGION("CheckPoint_writePrepare", SCOREP_USER_REGION_TYPE_FUNCTION);
+
+	// Create copy of the header and the dofs
+	memcpy(m_headerCopy.data(), header, headerSize);
+	memcpy(m_dofsCopy, dofs(), numDofs()*sizeof(real));
+
+	// Save data
+	writeData(m_headerCopy.data(), m_dofsCopy);
+
+	m_started = true;
+
+	logInfo(rank()) << "Checkpoint backend: Writing. Done.";
+}
+
+void seissol::checkpoint::h5::WavefieldAsync::write(const void* header, size_t headerSize)
+{
+	EPIK_TRACER("CheckPoint_write");
+	SCOREP_USER_REGION("CheckPoint_write", SCOREP_USER_REGION_TYPE_FUNCTION);
+
+	logInfo(rank()) << "Checkpoint backend: Writing.";
+
+	if (m_started)
+		waitEventSet();
+
+	// Finalize the checkpoint
+	finalizeCheckpoint();
+}
+
+void seissol::checkpoint::h5::WavefieldAsync::close()
+{
+	// Finalize last checkpoint
+	write(0L, 0); // Time does not matter
+
+	delete [] m_dofsCopy;
+
+	Wavefield::close();
+}
@@ -0,0 +1,71 @@
+#ifndef CHECKPOINT_H5_WAVEFIELD_ASYNC_H
+#define CHECKPOINT_H5_WAVEFIELD_ASYNC_H
+
+#ifndef USE_HDF
+#include "Checkpoint/WavefieldDummy.h"
+#else // USE_HDF
+
+#include <vector>
+
+#include "Wavefield.h"
+
+#endif // USE_HDF
+
+namespace seissol
+{
+
+namespace checkpoint
+{
+
+namespace h5
+{
+
+#ifndef USE_HDF
+typedef WavefieldDummy WavefieldAsync;
+#else // USE_HDF
+
+/**
+ * Wave field checkpoints which are completed with the next checkpoint
+ *
+ * The header and the DOFs are copied from the executor buffers in writePrepare(), which starts the collective
+ * write of the copy. With HDF5 event sets (and the async VOL connector), the write overlaps with the
+ * computation; otherwise it is written when it is started.
+ */
+class WavefieldAsync : public Wavefield
+{
+private:
+	/** Buffer for storing the header copy */
+	std::vector<char> m_headerCopy;
+
+	/** Buffer for storing the DOFs copy */
+	real* m_dofsCopy;
+
+	/** True if a checkpoint was started */
+	bool m_started;
+
+public:
+	WavefieldAsync()
+		: seissol::checkpoint::CheckPoint(IDENTIFIER),
+		seissol::checkpoint::Wavefield(IDENTIFIER),
+		m_dofsCopy(0L), m_started(false)
+	{
+	}
+
+	bool init(size_t headerSize, unsigned long numDofs, unsigned int groupSize = 1) override;
+
+	void writePrepare(const void* header, size_t headerSize) override;
+
+	void write(const void* header, size_t headerSize) override;
+
+	void close();
+};
+
+#endif // USE_HDF
+
+}
+
+}
+
+}
+
+#endif // CHECKPOINT_H5_WAVEFIELD_ASYNC_H
@@ -43,6 +43,7 @@
 
 #include <mpi.h>
 
+#include <algorithm>
 #include <cassert>
 
 #include "utils/env.h"
@@ -287,6 +288,44 @@ protected:
 		return MPI_File_set_view(file, 0, MPI_BYTE, m_fileDataType, const_cast<char*>("native"), MPI_INFO_NULL);
 	}
 
+	/**
+	 * Set a file view with byte offsets (for explicit offsets)
+	 *
+	 * @return The MPI error code
+	 */
+	int setByteView(MPI_File file)
+	{
+		return MPI_File_set_view(file, 0, MPI_BYTE, MPI_BYTE, const_cast<char*>("native"), MPI_INFO_NULL);
+	}
+
+	/**
+	 * Collective read at a byte offset in parts of at most 1 GB (due to the 2 GB limit)
+	 */
+	void readAtAll(MPI_File file, MPI_Offset offset, void* buffer, unsigned long size)
+	{
+		const unsigned long iterations = accessIterations(size);
+		for (unsigned long i = 0; i < iterations; i++) {
+			const unsigned long begin = std::min(i * MAX_ACCESS_SIZE, size);
+			const unsigned long count = std::min(MAX_ACCESS_SIZE, size - begin);
+			checkMPIErr(MPI_File_read_at_all(file, offset + begin, static_cast<char*>(buffer) + begin,
+				count, MPI_BYTE, MPI_STATUS_IGNORE));
+		}
+	}
+
+	/**
+	 * Collective write at a byte offset in parts of at most 1 GB (due to the 2 GB limit)
+	 */
+	void writeAtAll(MPI_File file, MPI_Offset offset, const void* buffer, unsigned long size)
+	{
+		const unsigned long iterations = accessIterations(size);
+		for (unsigned long i = 0; i < iterations; i++) {
+			const unsigned long begin = std::min(i * MAX_ACCESS_SIZE, size);
+			const unsigned long count = std::min(MAX_ACCESS_SIZE, size - begin);
+			checkMPIErr(MPI_File_write_at_all(file, offset + begin,
+				const_cast<char*>(static_cast<const char*>(buffer)) + begin, count, MPI_BYTE, MPI_STATUS_IGNORE));
+		}
+	}
+
 	/**
 	 * @return The current MPI file
 	 */
@@ -313,6 +352,19 @@ protected:
 	 */
 	virtual bool validate(MPI_File file) = 0;
 
+private:
+	/**
+	 * @return The number of collective calls required by all ranks to access size bytes
+	 */
+	unsigned long accessIterations(unsigned long size) const
+	{
+		unsigned long iterations = (size + MAX_ACCESS_SIZE - 1) / MAX_ACCESS_SIZE;
+		MPI_Allreduce(MPI_IN_PLACE, &iterations, 1, MPI_UNSIGNED_LONG, MPI_MAX, comm());
+		return iterations;
+	}
+
+	static constexpr unsigned long MAX_ACCESS_SIZE = 1ul<<30;
+
 protected:
 	static void checkMPIErr(int ret)
 	{
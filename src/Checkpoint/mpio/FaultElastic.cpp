@@ -0,0 +1,177 @@
+#include <cstddef>
+
+#include <algorithm>
+
+#include "FaultElastic.h"
+#include "Redistribution.h"
+#include "Monitoring/instrumentation.fpp"
+
+void seissol::checkpoint::mpio::FaultElastic::setFaceIds(const unsigned long* faceIds, unsigned int numSides)
+{
+	m_faceIds.assign(faceIds, faceIds + 2 * numSides);
+}
+
+bool seissol::checkpoint::mpio::FaultElastic::init(unsigned int numSides, unsigned int numBndGP,
+		unsigned int groupSize)
+{
+	seissol::checkpoint::Fault::init(numSides, numBndGP, groupSize);
+
+	if (numSides == 0)
+		return true;
+
+	// Compute total number of sides and local offset
+	setSumOffset(numSides);
+
+	// Create the header data type
+	MPI_Datatype headerType;
+	int blockLength[] = {1, 1, 1};
+	MPI_Aint displ[] = {offsetof(Header, identifier), offsetof(Header, timestepFault), offsetof(Header, numSides)};
+	MPI_Datatype types[] = {MPI_UNSIGNED_LONG, MPI_INT, MPI_UNSIGNED_LONG};
+	MPI_Type_create_struct(3, blockLength, displ, types, &headerType);
+	setHeaderType(headerType);
+
+	// Define the file view (only the header view is used)
+	defineFileView(sizeof(Header), numBndGP * sizeof(double), numSides, NUM_VARIABLES);
+
+	return exists();
+}
+
+void seissol::checkpoint::mpio::FaultElastic::load(int &timestepFault, double* mu, double* slipRate1, double* slipRate2,
+	double* slip, double* slip1, double* slip2, double* state, double* strength)
+{
+	if (numSides() == 0)
+		return;
+
+	logInfo(rank()) << "Loading elastic fault checkpoint";
+
+	seissol::checkpoint::CheckPoint::setLoaded();
+
+	MPI_File file = open();
+	if (file == MPI_FILE_NULL)
+		logError() << "Could not open fault checkpoint file";
+
+	// Read and broadcast header
+	checkMPIErr(setHeaderView(file));
+
+	Header header;
+	if (rank() == 0)
+		checkMPIErr(MPI_File_read(file, &header, 1, headerType(), MPI_STATUS_IGNORE));
+
+	MPI_Bcast(&header, 1, headerType(), 0, comm());
+	timestepFault = header.timestepFault;
+
+	// Read an equal part of the sides and their ids
+	const unsigned long first = header.numSides * rank() / partitions();
+	const unsigned long last = header.numSides * (rank() + 1) / partitions();
+	const unsigned long count = last - first;
+	const unsigned long sideSize = numBndGP() * sizeof(double);
+
+	std::vector<double> fileData(NUM_VARIABLES * count * numBndGP());
+	std::vector<unsigned long> ids(2 * count);
+	checkMPIErr(setByteView(file));
+	for (unsigned int i = 0; i < NUM_VARIABLES; i++)
+		readAtAll(file, variableOffset(i, header.numSides) + first * sideSize,
+			&fileData[i * count * numBndGP()], count * sideSize);
+	readAtAll(file, variableOffset(NUM_VARIABLES, header.numSides) + 2 * first * sizeof(unsigned long),
+		ids.data(), ids.size() * sizeof(unsigned long));
+
+	// Close the file
+	checkMPIErr(MPI_File_close(&file));
+
+	// Store all variables of a side together
+	std::vector<double> records(fileData.size());
+	for (unsigned long side = 0; side < count; side++) {
+		for (unsigned int i = 0; i < NUM_VARIABLES; i++)
+			std::copy_n(&fileData[(i * count + side) * numBndGP()], numBndGP(),
+				&records[(side * NUM_VARIABLES + i) * numBndGP()]);
+	}
+
+	// Request each side by the id of the local element
+	std::vector<unsigned long> requests(numSides());
+	unsigned long keySpace = 0;
+	for (unsigned int side = 0; side < numSides(); side++) {
+		requests[side] = m_faceIds[2 * side] != INVALID_GLOBAL_ID ? m_faceIds[2 * side] : m_faceIds[2 * side + 1];
+		keySpace = std::max(keySpace, requests[side] + 1);
+	}
+	MPI_Allreduce(MPI_IN_PLACE, &keySpace, 1, MPI_UNSIGNED_LONG, MPI_MAX, comm());
+
+	std::vector<double> sides(numSides() * NUM_VARIABLES * numBndGP());
+	redistribute(ids.data(), 2, records.data(), count, NUM_VARIABLES * sideSize,
+		requests.data(), requests.size(), sides.data(), keySpace, comm());
+
+	double* data[NUM_VARIABLES] = {mu, slipRate1, slipRate2, slip, slip1, slip2, state, strength};
+	for (unsigned int side = 0; side < numSides(); side++) {
+		for (unsigned int i = 0; i < NUM_VARIABLES; i++)
+			std::copy_n(&sides[(side * NUM_VARIABLES + i) * numBndGP()], numBndGP(), &data[i][side * numBndGP()]);
+	}
+}
+
+void seissol::checkpoint::mpio::FaultElastic::write(int timestepFault)
+{
+	SCOREP_USER_REGION("CheckPointFault_write", SCOREP_USER_REGION_TYPE_FUNCTION);
+
+	if (numSides() == 0)
+		return;
+
+	logInfo(rank()) << "Checkpoint backend: Writing fault.";
+
+	// Write the header
+	writeHeader(timestepFault);
+
+	// Save data and ids
+	SCOREP_USER_REGION_DEFINE(r_write_fault);
+	SCOREP_USER_REGION_BEGIN(r_write_fault, "checkpoint_write_fault", SCOREP_USER_REGION_TYPE_COMMON);
+
+	const unsigned long sideSize = numBndGP() * sizeof(double);
+	checkMPIErr(setByteView(file()));
+	for (unsigned int i = 0; i < NUM_VARIABLES; i++)
+		writeAtAll(file(), variableOffset(i, numTotalElems()) + fileOffset() * sideSize,
+			data(i), numSides() * sideSize);
+	writeAtAll(file(), variableOffset(NUM_VARIABLES, numTotalElems()) + 2 * fileOffset() * sizeof(unsigned long),
+		m_faceIds.data(), m_faceIds.size() * sizeof(unsigned long));
+
+	SCOREP_USER_REGION_END(r_write_fault);
+
+	// Finalize the checkpoint
+	finalizeCheckpoint();
+
+	logInfo(rank()) << "Checkpoint backend: Writing fault. Done.";
+}
+
+bool seissol::checkpoint::mpio::FaultElastic::validate(MPI_File file)
+{
+	int result = true;
+
+	if (rank() == 0) {
+		Header header;
+
+		// Check the header
+		MPI_File_read(file, &header, 1, headerType(), MPI_STATUS_IGNORE);
+
+		if (header.identifier != identifier()) {
+			logWarning() << "Checkpoint identifier does match";
+			result = false;
+		}
+	}
+
+	// Make sure everybody knows the result of the validation
+	MPI_Bcast(&result, 1, MPI_INT, 0, comm());
+
+	return result;
+}
+
+void seissol::checkpoint::mpio::FaultElastic::writeHeader(int timestepFault)
+{
+	SCOREP_USER_REGION("checkpoint_write_fault_header", SCOREP_USER_REGION_TYPE_FUNCTION);
+
+	checkMPIErr(setHeaderView(file()));
+
+	if (rank() == 0) {
+		Header header;
+		header.identifier = identifier();
+		header.timestepFault = timestepFault;
+		header.numSides = numTotalElems();
+
+		checkMPIErr(MPI_File_write(file(), &header, 1, headerType(), MPI_STATUS_IGNORE));
+	}
+}
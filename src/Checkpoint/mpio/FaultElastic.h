@@ -0,0 +1,101 @@
+#ifndef CHECKPOINT_MPIO_FAULT_ELASTIC_H
+#define CHECKPOINT_MPIO_FAULT_ELASTIC_H
+
+#ifndef USE_MPI
+#include "Checkpoint/FaultDummy.h"
+#else // USE_MPI
+
+#include <mpi.h>
+
+#include <vector>
+
+#include "CheckPoint.h"
+#include "Checkpoint/Fault.h"
+
+#endif // USE_MPI
+
+namespace seissol
+{
+
+namespace checkpoint
+{
+
+namespace mpio
+{
+
+#ifndef USE_MPI
+typedef FaultDummy FaultElastic;
+#else // USE_MPI
+
+/**
+ * Fault checkpoint which can be loaded with a different number of ranks (or a different partitioning)
+ *
+ * Each variable is stored for all sides in the order of the ranks, followed by two global ids for each
+ * side: one derived from the element on the plus side and one derived from the element on the minus
+ * side (if the element is local). A side is loaded by the id of an element which is local now.
+ */
+class FaultElastic : public CheckPoint, virtual public seissol::checkpoint::Fault
+{
+private:
+	/** Struct describing the  header information in the file */
+	struct Header {
+		unsigned long identifier;
+		int timestepFault;
+		unsigned long numSides;
+	};
+
+	/** Global ids of the local sides */
+	std::vector<unsigned long> m_faceIds;
+
+public:
+	FaultElastic()
+		: seissol::checkpoint::CheckPoint(IDENTIFIER),
+		seissol::checkpoint::Fault(IDENTIFIER),
+		CheckPoint(IDENTIFIER)
+	{}
+
+	void setFaceIds(const unsigned long* faceIds, unsigned int numSides) override;
+
+	bool init(unsigned int numSides, unsigned int numBndGP,
+		unsigned int groupSize = 1);
+
+	void load(int &timestepFault, double* mu, double* slipRate1, double* slipRate2,
+		double* slip, double* slip1, double* slip2, double* state, double* strength);
+
+	void write(int timestepFault);
+
+	void close()
+	{
+		if (numSides() == 0)
+			return;
+
+		CheckPoint::close();
+	}
+
+protected:
+	bool validate(MPI_File file);
+
+	void writeHeader(int timestepFault);
+
+private:
+	/**
+	 * @return The offset of a variable in the file
+	 */
+	unsigned long variableOffset(unsigned int var, unsigned long numSides) const
+	{
+		return headerSize() + var * numSides * numBndGP() * sizeof(double);
+	}
+
+protected:
+	static const unsigned long IDENTIFIER = 0x7A84A;
+};
+
+#endif // USE_MPI
+
+}
+
+}
+
+}
+
+#endif // CHECKPOINT_MPIO_FAULT_ELASTIC_H
@@ -0,0 +1,128 @@
+#include "Redistribution.h"
+
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+#include "utils/logger.h"
+
+namespace {
+/**
+ * Exchanges the number of items for all ranks and computes the displacements
+ * (with the total number of items as the last element)
+ **/
+void exchangeCounts(const std::vector<int>& sendCounts,
+                    std::vector<int>& sendDispls,
+                    std::vector<int>& recvCounts,
+                    std::vector<int>& recvDispls,
+                    MPI_Comm comm) {
+  const int partitions = sendCounts.size();
+  recvCounts.resize(partitions);
+  MPI_Alltoall(sendCounts.data(), 1, MPI_INT, recvCounts.data(), 1, MPI_INT, comm);
+
+  sendDispls.assign(partitions + 1, 0);
+  recvDispls.assign(partitions + 1, 0);
+  for (int rank = 0; rank < partitions; ++rank) {
+    sendDispls[rank + 1] = sendDispls[rank] + sendCounts[rank];
+    recvDispls[rank + 1] = recvDispls[rank] + recvCounts[rank];
+  }
+}
+} // namespace
+
+void seissol::checkpoint::mpio::redistribute(const unsigned long* keys,
+                                             unsigned int keysPerRecord,
+                                             const void* records,
+                                             unsigned long numRecords,
+                                             std::size_t recordSize,
+                                             const unsigned long* requestedKeys,
+                                             unsigned long numRequests,
+                                             void* result,
+                                             unsigned long keySpace,
+                                             MPI_Comm comm) {
+  int partitions;
+  MPI_Comm_size(comm, &partitions);
+
+  MPI_Datatype recordType;
+  MPI_Type_contiguous(recordSize, MPI_BYTE, &recordType);
+  MPI_Type_commit(&recordType);
+
+  // Send the records to the owners of their keys
+  std::vector<int> sendCounts(partitions, 0);
+  for (unsigned long i = 0; i < numRecords * keysPerRecord; ++i) {
+    if (keys[i] != INVALID_GLOBAL_ID) {
+      sendCounts[keyOwner(keys[i], keySpace, partitions)]++;
+    }
+  }
+  std::vector<int> sendDispls, recvCounts, recvDispls;
+  exchangeCounts(sendCounts, sendDispls, recvCounts, recvDispls, comm);
+
+  std::vector<unsigned long> sendKeys(sendDispls[partitions]);
+  std::vector<char> sendRecords(sendDispls[partitions] * recordSize);
+  std::vector<int> position(sendDispls.begin(), sendDispls.end() - 1);
+  for (unsigned long i = 0; i < numRecords * keysPerRecord; ++i) {
+    if (keys[i] != INVALID_GLOBAL_ID) {
+      const int p = position[keyOwner(keys[i], keySpace, partitions)]++;
+      sendKeys[p] = keys[i];
+      memcpy(&sendRecords[p * recordSize],
+             static_cast<const char*>(records) + (i / keysPerRecord) * recordSize,
+             recordSize);
+    }
+  }
+
+  std::vector<unsigned long> ownedKeys(recvDispls[partitions]);
+  std::vector<char> ownedRecords(recvDispls[partitions] * recordSize);
+  MPI_Alltoallv(sendKeys.data(), sendCounts.data(), sendDispls.data(), MPI_UNSIGNED_LONG,
+                ownedKeys.data(), recvCounts.data(), recvDispls.data(), MPI_UNSIGNED_LONG, comm);
+  MPI_Alltoallv(sendRecords.data(), sendCounts.data(), sendDispls.data(), recordType,
+                ownedRecords.data(), recvCounts.data(), recvDispls.data(), recordType, comm);
+  std::vector<char>().swap(sendRecords);
+
+  std::unordered_map<unsigned long, unsigned long> ownedIndex;
+  ownedIndex.reserve(ownedKeys.size());
+  for (unsigned long i = 0; i < ownedKeys.size(); ++i) {
+    ownedIndex.emplace(ownedKeys[i], i);
+  }
+
+  // Send the requests to the owners of the keys
+  sendCounts.assign(partitions, 0);
+  for (unsigned long i = 0; i < numRequests; ++i) {
+    if (requestedKeys[i] != INVALID_GLOBAL_ID) {
+      sendCounts[keyOwner(requestedKeys[i], keySpace, partitions)]++;
+    }
+  }
+  exchangeCounts(sendCounts, sendDispls, recvCounts, recvDispls, comm);
+
+  sendKeys.resize(sendDispls[partitions]);
+  std::vector<unsigned long> requestOrder(sendDispls[partitions]);
+  position.assign(sendDispls.begin(), sendDispls.end() - 1);
+  for (unsigned long i = 0; i < numRequests; ++i) {
+    if (requestedKeys[i] != INVALID_GLOBAL_ID) {
+      const int p = position[keyOwner(requestedKeys[i], keySpace, partitions)]++;
+      sendKeys[p] = requestedKeys[i];
+      requestOrder[p] = i;
+    }
+  }
+
+  std::vector<unsigned long> receivedRequests(recvDispls[partitions]);
+  MPI_Alltoallv(sendKeys.data(), sendCounts.data(), sendDispls.data(), MPI_UNSIGNED_LONG,
+                receivedRequests.data(), recvCounts.data(), recvDispls.data(), MPI_UNSIGNED_LONG, comm);
+
+  // Answer the requests
+  std::vector<char> replies(recvDispls[partitions] * recordSize);
+  for (unsigned long i = 0; i < receivedRequests.size(); ++i) {
+    const auto owned = ownedIndex.find(receivedRequests[i]);
+    if (owned == ownedIndex.end()) {
+      logError() << "The checkpoint does not contain the record" << receivedRequests[i];
+    }
+    memcpy(&replies[i * recordSize], &ownedRecords[owned->second * recordSize], recordSize);
+  }
+
+  std::vector<char> answers(sendDispls[partitions] * recordSize);
+  MPI_Alltoallv(replies.data(), recvCounts.data(), recvDispls.data(), recordType,
+                answers.data(), sendCounts.data(), sendDispls.data(), recordType, comm);
+  for (unsigned long i = 0; i < requestOrder.size(); ++i) {
+    memcpy(static_cast<char*>(result) + requestOrder[i] * recordSize, &answers[i * recordSize], recordSize);
+  }
+
+  MPI_Type_free(&recordType);
+}
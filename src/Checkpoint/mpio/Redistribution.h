@@ -0,0 +1,38 @@
+#ifndef SEISSOL_CHECKPOINT_MPIO_REDISTRIBUTION_H
+#define SEISSOL_CHECKPOINT_MPIO_REDISTRIBUTION_H
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <cstddef>
+
+#include "Checkpoint/CheckPoint.h"
+
+namespace seissol::checkpoint::mpio {
+//! Rank which collects the records of a key during the redistribution (block distribution of the keys)
+inline int keyOwner(unsigned long key, unsigned long keySpace, int partitions) {
+  const unsigned long keysPerRank = std::max(1UL, (keySpace + partitions - 1) / partitions);
+  return static_cast<int>(std::min<unsigned long>(key / keysPerRank, partitions - 1));
+}
+
+/**
+ * Redistributes records of a fixed size, which are available in an arbitrary distribution (e.g. a
+ * contiguous part of a checkpoint file), to the ranks which request them by their key.
+ * Each record is stored under keysPerRecord keys in [0, keySpace); INVALID_GLOBAL_ID keys are ignored.
+ *
+ * @param result Buffer for numRequests records in the order of requestedKeys (requests with an
+ *  INVALID_GLOBAL_ID are skipped)
+ **/
+void redistribute(const unsigned long* keys,
+                  unsigned int keysPerRecord,
+                  const void* records,
+                  unsigned long numRecords,
+                  std::size_t recordSize,
+                  const unsigned long* requestedKeys,
+                  unsigned long numRequests,
+                  void* result,
+                  unsigned long keySpace,
+                  MPI_Comm comm);
+} // namespace seissol::checkpoint::mpio
+
+#endif // SEISSOL_CHECKPOINT_MPIO_REDISTRIBUTION_H
@@ -0,0 +1,133 @@
+#include <mpi.h>
+
+#include <algorithm>
+
+#include "WavefieldElastic.h"
+#include "Redistribution.h"
+#include "Monitoring/instrumentation.fpp"
+
+void seissol::checkpoint::mpio::WavefieldElastic::setCellIds(const unsigned long* cellIds, unsigned long numCells)
+{
+	m_cellIds.assign(cellIds, cellIds + numCells);
+}
+
+void seissol::checkpoint::mpio::WavefieldElastic::setHeader(seissol::checkpoint::WavefieldHeader &header)
+{
+	Wavefield::setHeader(header);
+	header.add(m_numMeshCellsComp);
+	header.add(m_numRecordsComp);
+}
+
+bool seissol::checkpoint::mpio::WavefieldElastic::init(size_t headerSize, unsigned long numDofs, unsigned int groupSize)
+{
+	// The layout of the cells is required to validate the checkpoint in Wavefield::init
+	m_numRecords = m_cellIds.size();
+	m_blockSize = m_cellIds.empty() ? 0 : numDofs / m_cellIds.size();
+	m_numMeshCells = 0;
+	for (unsigned long id : m_cellIds) {
+		if (id != INVALID_GLOBAL_ID)
+			m_numMeshCells = std::max(m_numMeshCells, id + 1);
+	}
+	MPI_Allreduce(MPI_IN_PLACE, &m_blockSize, 1, MPI_UNSIGNED_LONG, MPI_MAX, seissol::MPI::mpi.comm());
+	MPI_Allreduce(MPI_IN_PLACE, &m_numMeshCells, 1, MPI_UNSIGNED_LONG, MPI_MAX, seissol::MPI::mpi.comm());
+	m_recordOffset = m_numRecords;
+	MPI_Scan(MPI_IN_PLACE, &m_recordOffset, 1, MPI_UNSIGNED_LONG, MPI_SUM, seissol::MPI::mpi.comm());
+	m_recordOffset -= m_numRecords;
+	MPI_Allreduce(MPI_IN_PLACE, &m_numRecords, 1, MPI_UNSIGNED_LONG, MPI_SUM, seissol::MPI::mpi.comm());
+
+	bool exists = Wavefield::init(headerSize, numDofs, groupSize);
+
+	if (numTotalElems() != m_numRecords * m_blockSize)
+		logError() << "The elastic MPI-IO checkpoint does not support SEISSOL_CHECKPOINT_BLOCK_SIZE.";
+
+	return exists;
+}
+
+void seissol::checkpoint::mpio::WavefieldElastic::load(real* dofs)
+{
+	logInfo(rank()) << "Loading elastic wave field checkpoint";
+
+	seissol::checkpoint::CheckPoint::setLoaded();
+
+	MPI_File file = open();
+	if (file == MPI_FILE_NULL)
+		logError() << "Could not open checkpoint file";
+
+	// Read and broadcast header
+	checkMPIErr(setHeaderView(file));
+
+	if (rank() == 0)
+		checkMPIErr(MPI_File_read(file, header().data(), 1, headerType(), MPI_STATUS_IGNORE));
+
+	MPI_Bcast(header().data(), 1, headerType(), 0, comm());
+
+	// Read an equal part of the cells and their ids
+	const unsigned long numRecords = header().value(m_numRecordsComp);
+	const unsigned long first = numRecords * rank() / partitions();
+	const unsigned long last = numRecords * (rank() + 1) / partitions();
+	const unsigned long recordSize = m_blockSize * sizeof(real);
+
+	std::vector<real> records((last - first) * m_blockSize);
+	std::vector<unsigned long> ids(last - first);
+	checkMPIErr(setByteView(file));
+	readAtAll(file, headerSize() + first * recordSize, records.data(), records.size() * sizeof(real));
+	readAtAll(file, idOffset(numRecords) + first * sizeof(unsigned long), ids.data(), ids.size() * sizeof(unsigned long));
+
+	// Close the file
+	checkMPIErr(MPI_File_close(&file));
+
+	// Move the cells to the ranks that contain them now
+	redistribute(ids.data(), 1, records.data(), ids.size(), recordSize,
+		m_cellIds.data(), m_cellIds.size(), dofs, m_numMeshCells, comm());
+
+	// The next checkpoint is written with the layout of this run
+	initHeader(header());
+}
+
+void seissol::checkpoint::mpio::WavefieldElastic::initHeader(WavefieldHeader &header)
+{
+	Wavefield::initHeader(header);
+
+	header.value(m_numMeshCellsComp) = m_numMeshCells;
+	header.value(m_numRecordsComp) = m_numRecords;
+}
+
+void seissol::checkpoint::mpio::WavefieldElastic::write(const void* header, size_t headerSize)
+{
+	SCOREP_USER_REGION("CheckPoint_write_ids", SCOREP_USER_REGION_TYPE_FUNCTION);
+
+	// Write the ids first; the header and the dofs are flushed by the MPI-IO checkpoint
+	checkMPIErr(setByteView(file()));
+	writeAtAll(file(), idOffset(m_numRecords) + m_recordOffset * sizeof(unsigned long),
+		m_cellIds.data(), m_cellIds.size() * sizeof(unsigned long));
+
+	Wavefield::write(header, headerSize);
+}
+
+bool seissol::checkpoint::mpio::WavefieldElastic::validate(MPI_File file)
+{
+	if (setHeaderView(file) != 0) {
+		logWarning() << "Could not set checkpoint header view";
+		return false;
+	}
+
+	int result = true;
+
+	if (rank() == 0 && hasHeader()) { // Only validate on compute nodes
+		// Check the header
+		MPI_File_read(file, header().data(), 1, headerType(), MPI_STATUS_IGNORE);
+
+		if (header().identifier() != identifier()) {
+			logWarning() << "Checkpoint identifier does match";
+			result = false;
+		} else if (header().value(m_numMeshCellsComp) != m_numMeshCells) {
+			logWarning() << "Number of cells in checkpoint does not match";
+			result = false;
+		}
+	}
+
+	// Make sure everybody knows the result of the validation
+	MPI_Bcast(&result, 1, MPI_INT, 0, comm());
+
+	return result;
+}
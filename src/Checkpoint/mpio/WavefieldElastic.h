@@ -0,0 +1,102 @@
+#ifndef CHECKPOINT_MPIO_WAVEFIELD_ELASTIC_H
+#define CHECKPOINT_MPIO_WAVEFIELD_ELASTIC_H
+
+#ifndef USE_MPI
+#include "Checkpoint/WavefieldDummy.h"
+#else // USE_MPI
+
+#include <vector>
+
+#include "Wavefield.h"
+
+#endif // USE_MPI
+
+namespace seissol
+{
+
+namespace checkpoint
+{
+
+namespace mpio
+{
+
+#ifndef USE_MPI
+typedef WavefieldDummy WavefieldElastic;
+#else // USE_MPI
+
+/**
+ * Wave field checkpoint which can be loaded with a different number of ranks (or a different partitioning)
+ *
+ * The cells are written in the order of the ranks (as in the MPI-IO checkpoint), followed by the global
+ * ids of the cells. To load the checkpoint, each rank reads an equal part of the file and the cells are
+ * redistributed to the ranks which contain them now.
+ */
+class WavefieldElastic : public Wavefield
+{
+private:
+	/** The number of cells of the mesh in the header */
+	DynStruct::Component<unsigned long> m_numMeshCellsComp;
+
+	/** The number of cells in the file in the header (including duplicated cells) */
+	DynStruct::Component<unsigned long> m_numRecordsComp;
+
+	/** Global ids of the local cells */
+	std::vector<unsigned long> m_cellIds;
+
+	/** Number of dofs per cell */
+	unsigned long m_blockSize;
+
+	/** Number of cells of the mesh */
+	unsigned long m_numMeshCells;
+
+	/** Number of cells written by all ranks */
+	unsigned long m_numRecords;
+
+	/** Offset of this rank in the cells */
+	unsigned long m_recordOffset;
+
+public:
+	WavefieldElastic()
+		: seissol::checkpoint::CheckPoint(IDENTIFIER),
+		seissol::checkpoint::Wavefield(IDENTIFIER),
+		m_blockSize(0), m_numMeshCells(0), m_numRecords(0), m_recordOffset(0)
+	{
+	}
+
+	void setCellIds(const unsigned long* cellIds, unsigned long numCells) override;
+
+	void setHeader(WavefieldHeader &header) override;
+
+	bool init(size_t headerSize, unsigned long numDofs, unsigned int groupSize = 1) override;
+
+	void load(real* dofs) override;
+
+	void initHeader(WavefieldHeader &header) override;
+
+	void write(const void* header, size_t headerSize) override;
+
+protected:
+	bool validate(MPI_File file) override;
+
+private:
+	/**
+	 * @return The offset of the global ids in the file
+	 */
+	unsigned long idOffset(unsigned long numRecords) const
+	{
+		return headerSize() + numRecords * m_blockSize * sizeof(real);
+	}
+
+protected:
+	static const unsigned long IDENTIFIER = 0x7A3B5;
+};
+
+#endif // USE_MPI
+
+}
+
+}
+
+}
+
+#endif // CHECKPOINT_MPIO_WAVEFIELD_ELASTIC_H
@@ -51,6 +51,7 @@
 #include <fcntl.h>
 #include <string>
 #include <unistd.h>
+#include <vector>
 #include <sys/stat.h>
 
 #include "utils/env.h"
@@ -71,6 +72,14 @@ namespace posix
 
 class CheckPoint : virtual public seissol::checkpoint::CheckPoint
 {
+protected:
+	/** A contiguous part of the local data of a checkpoint */
+	struct Segment
+	{
+		const void* data;
+		unsigned long size;
+	};
+
 private:
 	/** Identifiers of the files */
 	int m_files[2];
@@ -84,6 +93,30 @@ private:
 	/** Buffer to write header data */
 	void* m_header;
 
+	/** True if the ranks of an aggregation group share one file */
+	bool m_aggregated;
+
+#ifdef USE_MPI
+	/** Communicator of the aggregation group (rank 0 writes the file) */
+	MPI_Comm m_aggregationComm;
+#endif // USE_MPI
+
+	/** Rank and size of the aggregation group */
+	int m_aggregationRank;
+	int m_aggregationSize;
+
+	/** Index of the file of the aggregation group (rank of the writer) */
+	int m_aggregationFile;
+
+	/** Receive buffer of the writer */
+	std::vector<char> m_aggregationBuffer;
+
+	/** Maximum size of a message to the writer */
+	static const unsigned long AGGREGATION_CHUNK_SIZE = 1ul << 26;
+
+	/** Tag for the messages to the writer */
+	static const int AGGREGATION_TAG = 0x7A5;
+
 public:
 	CheckPoint(unsigned long identifier)
 		: seissol::checkpoint::CheckPoint(identifier),
@@ -92,11 +125,14 @@ public:
 		m_files[0] = m_files[1] = -1;
 
 		m_alignment = utils::Env::get<size_t>("SEISSOL_CHECKPOINT_ALIGNMENT", 0);
+		initAggregationMembers();
 	}
 
 	CheckPoint(unsigned long identifier, size_t headerSize)
 		: seissol::checkpoint::CheckPoint(identifier)
 	{
+		initAggregationMembers();
+
 		m_files[0] = m_files[1] = -1;
 
 		headerSize += sizeof(unsigned long); // Require additional space for the identifier
@@ -132,9 +168,51 @@ public:
 			for (unsigned int i = 0; i < 2; i++)
 				checkErr(::close(m_files[i]));
 		}
+
+#ifdef USE_MPI
+		if (m_aggregationComm != MPI_COMM_NULL)
+			MPI_Comm_free(&m_aggregationComm);
+#endif // USE_MPI
 	}
 
 protected:
+	/**
+	 * Group the ranks which write to the same file (SEISSOL_CHECKPOINT_AGGREGATION)
+	 *
+	 * Must be called after the communicator is set up and before the checkpoint files are accessed.
+	 */
+	void initAggregation()
+	{
+#ifdef USE_MPI
+		const int aggregation = utils::Env::get<int>("SEISSOL_CHECKPOINT_AGGREGATION", 0);
+		if (aggregation == 0 || aggregation == 1)
+			return;
+
+		if (groupSize() > 1) {
+			logWarning(rank()) << "Checkpoint aggregation is not supported with grouped checkpoints.";
+			return;
+		}
+
+		if (aggregation < 0)
+			// One file per node
+			MPI_Comm_split_type(comm(), MPI_COMM_TYPE_SHARED, rank(), MPI_INFO_NULL, &m_aggregationComm);
+		else
+			MPI_Comm_split(comm(), rank() / aggregation, rank(), &m_aggregationComm);
+
+		MPI_Comm_rank(m_aggregationComm, &m_aggregationRank);
+		MPI_Comm_size(m_aggregationComm, &m_aggregationSize);
+
+		m_aggregationFile = rank();
+		MPI_Bcast(&m_aggregationFile, 1, MPI_INT, 0, m_aggregationComm);
+
+		m_aggregated = true;
+
+		int numFiles = (m_aggregationRank == 0 ? 1 : 0);
+		MPI_Allreduce(MPI_IN_PLACE, &numFiles, 1, MPI_INT, MPI_SUM, comm());
+		logInfo(rank()) << "Aggregating the checkpoint into" << numFiles << "files";
+#endif // USE_MPI
+	}
+
 	bool exists()
 	{
 		if (!seissol::checkpoint::CheckPoint::exists())
@@ -164,7 +242,9 @@ protected:
 		EPIK_USER_START(r_flush);
 		SCOREP_USER_REGION_BEGIN(r_flush, "checkpoint_flush", SCOREP_USER_REGION_TYPE_COMMON);
 
-		checkErr(fsync(m_files[odd()]));
+		// Only the writer of an aggregation group has a file
+		if (m_files[odd()] >= 0)
+			checkErr(fsync(m_files[odd()]));
 
 		EPIK_USER_END(r_flush);
 		SCOREP_USER_REGION_END(r_flush);
@@ -185,16 +265,115 @@ protected:
 		return fh;
 	}
 
+	/**
+	 * Move to the local data of a file returned by open()
+	 *
+	 * With aggregation, the data of this rank is found with the index at the beginning of the file.
+	 */
+	void seekData(int file)
+	{
+		unsigned long offset = 0;
+		if (m_aggregated)
+			checkErr(pread64(file, &offset, sizeof(offset), (2 + m_aggregationRank) * sizeof(unsigned long)),
+				sizeof(offset));
+		checkErr(lseek64(file, offset, SEEK_SET));
+	}
+
+	/**
+	 * Write the local data of a checkpoint to the current file
+	 *
+	 * Without aggregation, each rank writes its own file. Otherwise, the writer of an aggregation group
+	 * receives the data of the group in chunks and writes them behind an index of the data of each rank.
+	 * All ranks of the communicator have to call this function.
+	 */
+	void writeSegments(const Segment* segments, unsigned int numSegments)
+	{
+		unsigned long size = 0;
+		for (unsigned int i = 0; i < numSegments; i++)
+			size += segments[i].size;
+
+		if (!m_aggregated) {
+			off64_t offset = 0;
+			for (unsigned int i = 0; i < numSegments; i++) {
+				writeAll(m_files[odd()], segments[i].data, segments[i].size, offset);
+				offset += segments[i].size;
+			}
+			return;
+		}
+
+#ifdef USE_MPI
+		if (m_aggregationRank != 0) {
+			MPI_Gather(&size, 1, MPI_UNSIGNED_LONG, 0L, 1, MPI_UNSIGNED_LONG, 0, m_aggregationComm);
+			for (unsigned int i = 0; i < numSegments; i++) {
+				const char* buffer = static_cast<const char*>(segments[i].data);
+				for (unsigned long sent = 0; sent < segments[i].size; sent += AGGREGATION_CHUNK_SIZE) {
+					const unsigned long left = segments[i].size - sent;
+					const int count = (left < AGGREGATION_CHUNK_SIZE ? left : AGGREGATION_CHUNK_SIZE);
+					MPI_Send(buffer + sent, count, MPI_BYTE, 0, AGGREGATION_TAG, m_aggregationComm);
+				}
+			}
+			return;
+		}
+
+		// Index: identifier, number of ranks and the offset of each rank
+		std::vector<unsigned long> index(2 + m_aggregationSize);
+		std::vector<unsigned long> sizes(m_aggregationSize);
+		MPI_Gather(&size, 1, MPI_UNSIGNED_LONG, sizes.data(), 1, MPI_UNSIGNED_LONG, 0, m_aggregationComm);
+		index[0] = identifier();
+		index[1] = m_aggregationSize;
+		unsigned long offset = alignSize(index.size() * sizeof(unsigned long));
+		for (int i = 0; i < m_aggregationSize; i++) {
+			index[2 + i] = offset;
+			offset += alignSize(sizes[i]);
+		}
+		writeAll(m_files[odd()], index.data(), index.size() * sizeof(unsigned long), 0);
+
+		offset = index[2];
+		for (unsigned int i = 0; i < numSegments; i++) {
+			writeAll(m_files[odd()], segments[i].data, segments[i].size, offset);
+			offset += segments[i].size;
+		}
+
+		for (int i = 1; i < m_aggregationSize; i++) {
+			offset = index[2 + i];
+			for (unsigned long received = 0; received < sizes[i]; ) {
+				MPI_Status status;
+				MPI_Probe(i, AGGREGATION_TAG, m_aggregationComm, &status);
+				int count;
+				MPI_Get_count(&status, MPI_BYTE, &count);
+				if (m_aggregationBuffer.size() < static_cast<unsigned long>(count))
+					m_aggregationBuffer.resize(count);
+				MPI_Recv(m_aggregationBuffer.data(), count, MPI_BYTE, i, AGGREGATION_TAG, m_aggregationComm,
+					MPI_STATUS_IGNORE);
+
+				writeAll(m_files[odd()], m_aggregationBuffer.data(), count, offset);
+				offset += count;
+				received += count;
+			}
+		}
+#endif // USE_MPI
+	}
+
 	const std::string linkFile() const
 	{
 		return std::string(seissol::checkpoint::CheckPoint::linkFile())
-		  + "/" + fname() + "." + utils::StringUtils::toString(rank() / groupSize());
+		  + "/" + fname() + "." + utils::StringUtils::toString(fileIndex());
 	}
 
 	const std::string dataFile(int odd) const
 	{
 		return seissol::checkpoint::CheckPoint::dataFile(odd)
-		  + "/" + fname() + "." + utils::StringUtils::toString(rank() / groupSize());
+		  + "/" + fname() + "." + utils::StringUtils::toString(fileIndex());
+	}
+
+	/**
+	 * @return The index of the file of this rank
+	 */
+	int fileIndex() const
+	{
+		if (m_aggregated)
+			return m_aggregationFile;
+		return rank() / groupSize();
 	}
 
 	/**
@@ -233,10 +412,18 @@ protected:
 		MPI_Barrier(comm());
 #endif // USE_MPI
 
+		// With aggregation, only the writer of the group opens the file
+		if (m_aggregated && m_aggregationRank != 0)
+			return;
+
 		int oflags = O_WRONLY | O_CREAT;
 		if (utils::Env::get<int>("SEISSOL_CHECKPOINT_DIRECT", 0)) {
-			oflags |= O_DIRECT;
-			logInfo(rank()) << "Using direct I/O for checkpointing";
+			if (m_aggregated) {
+				logWarning(rank()) << "Direct I/O is not supported with checkpoint aggregation.";
+			} else {
+				oflags |= O_DIRECT;
+				logInfo(rank()) << "Using direct I/O for checkpointing";
+			}
 		}
 
 		for (unsigned int i = 0; i < 2; i++) {
@@ -267,22 +454,48 @@ protected:
 	}
 
 	/**
-	 * Write the header info to the file
+	 * Store the header info in the header buffer
+	 *
+	 * @return The segment of the header buffer
 	 *
 	 * @warning This function only works when the header size is set in the constructor
 	 */
 	template<typename T>
-	void writeHeader(int file, const T &header)
+	Segment headerSegment(const T &header)
 	{
 		assert(sizeof(T)+sizeof(unsigned long) <= m_headerSize);
 
 		T* headStart = reinterpret_cast<T*>(static_cast<unsigned long*>(m_header)+1);
 		*headStart = header;
 
-		checkErr(write(file, m_header, m_headerSize), m_headerSize);
+		Segment segment = {m_header, m_headerSize};
+		return segment;
+	}
+
+	/**
+	 * @return The size rounded up to the alignment
+	 */
+	unsigned long alignSize(unsigned long size) const
+	{
+		if (m_alignment) {
+			size = (size + m_alignment - 1) / m_alignment;
+			size *= m_alignment;
+		}
+		return size;
 	}
 
 private:
+	void initAggregationMembers()
+	{
+		m_aggregated = false;
+#ifdef USE_MPI
+		m_aggregationComm = MPI_COMM_NULL;
+#endif // USE_MPI
+		m_aggregationRank = 0;
+		m_aggregationSize = 1;
+		m_aggregationFile = 0;
+	}
+
 	/**
 	 * Validate an existing check point file
 	 *
@@ -302,9 +515,34 @@ private:
 			return false;
 		}
 
+		if (m_aggregated) {
+			unsigned long numRanks;
+			size = read(file, &numRanks, sizeof(numRanks));
+			if (size < static_cast<ssize_t>(sizeof(numRanks)) || numRanks != static_cast<unsigned long>(m_aggregationSize)) {
+				logWarning() << "Checkpoint aggregation does not match";
+				return false;
+			}
+		}
+
 		return true;
 	}
 
+	/**
+	 * Write a buffer at an offset of a file
+	 */
+	static void writeAll(int file, const void* data, unsigned long size, off64_t offset)
+	{
+		const char* buffer = static_cast<const char*>(data);
+		while (size > 0) {
+			ssize_t written = pwrite64(file, buffer, size, offset);
+			if (written <= 0)
+				checkErr(written, size);
+			buffer += written;
+			offset += written;
+			size -= written;
+		}
+	}
+
 protected:
 	template<typename T>
 	static void checkErr(T ret)
@@ -49,6 +49,8 @@ bool seissol::checkpoint::posix::Fault::init(unsigned int numSides, unsigned int
 	if (numSides == 0)
 		return true;
 
+	initAggregation();
+
 	return exists();
 }
 
@@ -64,6 +66,7 @@ void seissol::checkpoint::posix::Fault::load(int &timestepFault, double* mu, dou
 
 	int file = open();
 	checkErr(file);
+	seekData(file);
 
 	// Read header
 	readHeader(file, timestepFault);
@@ -96,34 +99,21 @@ void seissol::checkpoint::posix::Fault::write(int timestepFault)
 
 	logInfo(rank()) << "Checkpoint backend: Writing fault.";
 
-	// Start at the beginning
-	checkErr(lseek64(file(), 0, SEEK_SET));
-
-	// Write the header
-	EPIK_USER_REG(r_write_header, "checkpoint_write_fault_header");
-	SCOREP_USER_REGION_DEFINE(r_write_header);
-	EPIK_USER_START(r_write_header);
-	SCOREP_USER_REGION_BEGIN(r_write_header, "checkpoint_write_fault_header", SCOREP_USER_REGION_TYPE_COMMON);
-
-	writeHeader(file(), timestepFault)
-
-	EPIK_USER_END(r_write_header);
-	SCOREP_USER_REGION_END(r_write_header);
-
 	// Save data
 	EPIK_USER_REG(r_write_wavefield, "checkpoint_write_fault");
 	SCOREP_USER_REGION_DEFINE(r_write_fault);
 	EPIK_USER_START(r_write_wavefield);
 	SCOREP_USER_REGION_BEGIN(r_write_fault, "checkpoint_write_fault", SCOREP_USER_REGION_TYPE_COMMON);
 
-	unsigned long size = numSides() * numBndGP() * sizeof(real);
-	if (alignment()) {
-		size = (size + alignment() - 1) / alignment();
-		size *= alignment();
-	}
+	const unsigned long size = alignSize(numSides() * numBndGP() * sizeof(real));
 
-	for (unsigned int i = 0; i < NUM_VARIABLES; i++)
-		checkErr(::write(file(), data(i), size));
+	Segment segments[NUM_VARIABLES+1];
+	segments[0] = headerSegment(timestepFault);
+	for (unsigned int i = 0; i < NUM_VARIABLES; i++) {
+		segments[i+1].data = data(i);
+		segments[i+1].size = size;
+	}
+	writeSegments(segments, NUM_VARIABLES+1);
 
 	EPIK_USER_END(r_write_fault);
 	SCOREP_USER_REGION_END(r_write_fault);
@@ -43,6 +43,8 @@ bool seissol::checkpoint::posix::Wavefield::init(size_t headerSize, unsigned lon
 {
 	seissol::checkpoint::Wavefield::init(headerSize, numDofs, groupSize);
 
+	initAggregation();
+
 	return exists();
 }
 
@@ -54,6 +56,7 @@ void seissol::checkpoint::posix::Wavefield::load(real* dofs)
 
 	int file = open();
 	checkErr(file);
+	seekData(file);
 
 	// Read header
 	checkErr(read(file, header().data(), header().size()), header().size());
@@ -85,41 +88,14 @@ void seissol::checkpoint::posix::Wavefield::write(const void* header, size_t hea
 
 	logInfo(rank()) << "Checkpoint backend: Writing.";
 
-	// Start at the beginning
-	checkErr(lseek64(file(), 0, SEEK_SET));
-
-	// Write the header
-	EPIK_USER_REG(r_write_header, "checkpoint_write_header");
-	SCOREP_USER_REGION_DEFINE(r_write_header);
-	EPIK_USER_START(r_write_header);
-	SCOREP_USER_REGION_BEGIN(r_write_header, "checkpoint_write_header", SCOREP_USER_REGION_TYPE_COMMON);
-
-	checkErr(::write(file(), header, headerSize), headerSize);
-
-	EPIK_USER_END(r_write_header);
-	SCOREP_USER_REGION_END(r_write_header);
-
 	// Save data
 	EPIK_USER_REG(r_write_wavefield, "checkpoint_write_wavefield");
 	SCOREP_USER_REGION_DEFINE(r_write_wavefield);
 	EPIK_USER_START(r_write_wavefield);
 	SCOREP_USER_REGION_BEGIN(r_write_wavefield, "checkpoint_write_wavefield", SCOREP_USER_REGION_TYPE_COMMON);
 
-	// Convert to char* to do pointer arithmetic
-	const char* buffer = reinterpret_cast<const char*>(dofs());
-	unsigned long left = numDofs()*sizeof(real);
-	if (alignment()) {
-		left = (left + alignment() - 1) / alignment();
-		left *= alignment();
-	}
-
-	while (left > 0) {
-		unsigned long written = ::write(file(), buffer, left);
-		if (written <= 0)
-			checkErr(written, left);
-		buffer += written;
-		left -= written;
-	}
+	const Segment segments[2] = {{header, headerSize}, {dofs(), alignSize(numDofs()*sizeof(real))}};
+	writeSegments(segments, 2);
 
 	EPIK_USER_END(r_write_wavefield);
 	SCOREP_USER_REGION_END(r_write_wavefield);
@@ -68,7 +68,29 @@ public:
 
 	void write(const void* header, size_t headerSize);
 
-private:
+	/**
+	 * @return The file with the wave field of this rank; can be called before init()
+	 *  since it requires no collective operations
+	 */
+	std::string localFile()
+	{
+#ifdef USE_MPI
+		setComm(seissol::MPI::mpi.comm());
+#endif // USE_MPI
+		return linkFile();
+	}
+
+protected:
+	/**
+	 * Constructor for derived classes with a different file format
+	 */
+	Wavefield(unsigned long identifier)
+		: seissol::checkpoint::CheckPoint(identifier),
+		seissol::checkpoint::Wavefield(identifier),
+		CheckPoint(identifier)
+	{
+	}
+
 	static const unsigned long IDENTIFIER = 0x7A56F;
 };
 
@@ -0,0 +1,178 @@
+#include <algorithm>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+
+#include "utils/env.h"
+#include "utils/logger.h"
+
+#include "WavefieldCompressed.h"
+#include "generated_code/tensor.h"
+#include "Initializer/preProcessorMacros.fpp"
+
+namespace
+{
+
+/**
+ * Parameters of the codec (stored after the header)
+ */
+struct CodecHeader
+{
+	unsigned long mode;
+	unsigned long blockSize;
+	unsigned long blockRows;
+	unsigned long exactRows;
+	double tolerance;
+	unsigned long numValues;
+	unsigned long streamSize;
+};
+
+}
+
+bool seissol::checkpoint::posix::WavefieldCompressed::enabled()
+{
+	const std::string mode = utils::Env::get<const char*>("SEISSOL_CHECKPOINT_COMPRESSION", "none");
+	try {
+		return parseCodecMode(mode) != CodecMode::None;
+	} catch (const std::runtime_error &e) {
+		logError() << e.what();
+	}
+	return false;
+}
+
+seissol::checkpoint::Codec seissol::checkpoint::posix::WavefieldCompressed::createCodec()
+{
+	CodecMode mode = CodecMode::None;
+	try {
+		mode = parseCodecMode(utils::Env::get<const char*>("SEISSOL_CHECKPOINT_COMPRESSION", "none"));
+	} catch (const std::runtime_error &e) {
+		logError() << e.what();
+	}
+
+	// Modes up to degree CONVERGENCE_ORDER-2 are stored exactly by default
+	const unsigned int exactOrder = utils::Env::get<unsigned int>("SEISSOL_CHECKPOINT_COMPRESSION_EXACT_ORDER",
+		CONVERGENCE_ORDER - 1);
+	if (exactOrder > CONVERGENCE_ORDER)
+		logError() << "SEISSOL_CHECKPOINT_COMPRESSION_EXACT_ORDER must not be larger than the order.";
+
+	const double tolerance = utils::Env::get<double>("SEISSOL_CHECKPOINT_COMPRESSION_TOLERANCE", 0.0);
+	if (mode == CodecMode::Lossy && !(tolerance > 0.0))
+		logError() << "Lossy checkpoint compression requires a positive SEISSOL_CHECKPOINT_COMPRESSION_TOLERANCE.";
+
+	return Codec(mode, tensor::Q::size(), tensor::Q::Shape[0],
+		Codec::numberOfBasisFunctions(exactOrder), tolerance);
+}
+
+void seissol::checkpoint::posix::WavefieldCompressed::load(real* dofs)
+{
+	logInfo(rank()) << "Loading compressed wave field checkpoint";
+
+	seissol::checkpoint::CheckPoint::setLoaded();
+
+	int file = open();
+	checkErr(file);
+	seekData(file);
+
+	// Read header
+	checkErr(read(file, header().data(), header().size()), header().size());
+
+	CodecHeader codecHeader;
+	checkErr(read(file, &codecHeader, sizeof(CodecHeader)), sizeof(CodecHeader));
+
+	// Read the compressed dofs of the group
+	std::vector<char> stream(codecHeader.streamSize);
+	char* buffer = stream.data();
+	unsigned long left = stream.size();
+	while (left > 0) {
+		unsigned long readSize = read(file, buffer, left);
+		if (readSize <= 0)
+			checkErr(readSize, left);
+		buffer += readSize;
+		left -= readSize;
+	}
+
+	// Close the file
+	checkErr(::close(file));
+
+	if (codecHeader.mode > static_cast<unsigned long>(CodecMode::Lossy))
+		logError() << "Unknown compression in the checkpoint.";
+	if (codecHeader.numValues < groupOffset() + numDofs())
+		logError() << "The compressed checkpoint does not match the number of dofs.";
+
+	try {
+		const Codec codec(static_cast<CodecMode>(codecHeader.mode), codecHeader.blockSize,
+			codecHeader.blockRows, codecHeader.exactRows, codecHeader.tolerance);
+		if (!codec.decode(stream.data(), stream.size(), groupOffset(), numDofs(), dofs))
+			logError() << "The compressed checkpoint is corrupt.";
+	} catch (const std::invalid_argument &e) {
+		logError() << "The compressed checkpoint is corrupt:" << e.what();
+	}
+}
+
+void seissol::checkpoint::posix::WavefieldCompressed::write(const void* header, size_t headerSize)
+{
+	EPIK_TRACER("CheckPoint_write");
+	SCOREP_USER_REGION("CheckPoint_write", SCOREP_USER_REGION_TYPE_FUNCTION);
+
+	logInfo(rank()) << "Checkpoint backend: Writing.";
+
+	// Compress the dofs
+	SCOREP_USER_REGION_DEFINE(r_compress);
+	SCOREP_USER_REGION_BEGIN(r_compress, "checkpoint_compress", SCOREP_USER_REGION_TYPE_COMMON);
+
+	m_stream.resize(sizeof(CodecHeader));
+	m_codec.encode(dofs(), numDofs(), m_stream);
+
+	CodecHeader codecHeader;
+	codecHeader.mode = static_cast<unsigned long>(m_codec.mode());
+	codecHeader.blockSize = m_codec.blockSize();
+	codecHeader.blockRows = m_codec.blockRows();
+	codecHeader.exactRows = m_codec.exactRows();
+	codecHeader.tolerance = m_codec.tolerance();
+	codecHeader.numValues = numDofs();
+	codecHeader.streamSize = m_stream.size() - sizeof(CodecHeader);
+	memcpy(m_stream.data(), &codecHeader, sizeof(CodecHeader));
+
+	unsigned long size = m_stream.size();
+	if (alignment()) {
+		size = (size + alignment() - 1) / alignment();
+		size *= alignment();
+	}
+	m_stream.resize(size, 0);
+
+	SCOREP_USER_REGION_END(r_compress);
+
+	// Direct I/O requires an aligned buffer
+	void* alignedStream = 0L;
+	const char* buffer = m_stream.data();
+	if (alignment()) {
+		if (posix_memalign(&alignedStream, alignment(), size) != 0)
+			logError() << "Could not allocate buffer for alignment";
+		memcpy(alignedStream, m_stream.data(), size);
+		buffer = static_cast<const char*>(alignedStream);
+	}
+
+	// Save data
+	SCOREP_USER_REGION_DEFINE(r_write_wavefield);
+	SCOREP_USER_REGION_BEGIN(r_write_wavefield, "checkpoint_write_wavefield", SCOREP_USER_REGION_TYPE_COMMON);
+
+	const Segment segments[2] = {{header, headerSize}, {buffer, size}};
+	writeSegments(segments, 2);
+
+	SCOREP_USER_REGION_END(r_write_wavefield);
+
+	free(alignedStream);
+
+	// Finalize the checkpoint
+	finalizeCheckpoint();
+
+	// Compression ratio of all ranks
+	unsigned long sizes[2] = {numDofs() * sizeof(real), m_stream.size()};
+#ifdef USE_MPI
+	MPI_Allreduce(MPI_IN_PLACE, sizes, 2, MPI_UNSIGNED_LONG, MPI_SUM, comm());
+#endif // USE_MPI
+	logInfo(rank()) << "Checkpoint backend: Compressed the wave field from" << sizes[0] << "to" << sizes[1]
+		<< "bytes (ratio" << utils::nospace << static_cast<double>(sizes[0]) / std::max(sizes[1], 1ul) << ").";
+
+	logInfo(rank()) << "Checkpoint backend: Writing. Done.";
+}
@@ -0,0 +1,66 @@
+#ifndef CHECKPOINT_POSIX_WAVEFIELD_COMPRESSED_H
+#define CHECKPOINT_POSIX_WAVEFIELD_COMPRESSED_H
+
+#include <vector>
+
+#include "Wavefield.h"
+#include "Checkpoint/Codec.h"
+
+namespace seissol
+{
+
+namespace checkpoint
+{
+
+namespace posix
+{
+
+/**
+ * POSIX wave field checkpoint with compressed high-order modes
+ *
+ * The compression is done in the backend, i.e. by the checkpoint thread or the dedicated
+ * output ranks. The parameters of the codec are stored in the file.
+ */
+class WavefieldCompressed : public Wavefield
+{
+private:
+	/** The codec used for writing */
+	Codec m_codec;
+
+	/** Buffer for the compressed dofs */
+	std::vector<char> m_stream;
+
+public:
+	WavefieldCompressed()
+		: seissol::checkpoint::CheckPoint(IDENTIFIER),
+		seissol::checkpoint::Wavefield(IDENTIFIER),
+		Wavefield(IDENTIFIER),
+		m_codec(createCodec())
+	{
+	}
+
+	void load(real* dofs) override;
+
+	void write(const void* header, size_t headerSize) override;
+
+	/**
+	 * @return True if compression is enabled with SEISSOL_CHECKPOINT_COMPRESSION
+	 */
+	static bool enabled();
+
+private:
+	/**
+	 * Create the codec from the environment variables
+	 */
+	static Codec createCodec();
+
+	static const unsigned long IDENTIFIER = 0x7A5C0;
+};
+
+}
+
+}
+
+}
+
+#endif // CHECKPOINT_POSIX_WAVEFIELD_COMPRESSED_H
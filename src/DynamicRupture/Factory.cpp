@@ -0,0 +1,69 @@
+#include "Factory.h"
+
+#include <string>
+
+#include <utils/env.h>
+#include <utils/logger.h>
+
+#include <DynamicRupture/FrictionLaws/LinearSlipWeakening.h>
+#include <DynamicRupture/FrictionLaws/RateAndState.h>
+#include <Parallel/MPI.h>
+
+void seissol::dr::factory::selectFrictionSolver(DRParameters& drParameters) {
+  int const rank = seissol::MPI::mpi.rank();
+  std::string const solver = utils::Env::get<const char*>("SEISSOL_FRICTION_SOLVER", "fortran");
+
+#ifdef MULTIPLE_SIMULATIONS
+  // Both friction solvers hold one simulation per fault point: the native fault state has no simulation dimension,
+  // and the Fortran solver would take the fused simulations of QInterpolated for its quadrature points
+  logError() << "Dynamic rupture is not supported with fused simulations (NUMBER_OF_FUSED_SIMULATIONS > 1).";
+#endif
+
+  drParameters.isNativeSolverEnabled = false;
+  if (solver == "fortran") {
+    return;
+  }
+  if (solver != "native") {
+    logWarning(rank) << "Unknown friction solver" << solver << "in SEISSOL_FRICTION_SOLVER, using the Fortran friction solver.";
+    return;
+  }
+
+  int const fl = drParameters.frictionLaw;
+#ifdef ACL_DEVICE
+  // only the linear slip weakening laws are implemented on the device
+  bool const isSupported = fl == 2 || fl == 16;
+#else
+  bool const isSupported = fl == 2 || fl == 16 || fl == 3 || fl == 4 || fl == 103;
+#endif
+  if (!isSupported) {
+    logWarning(rank) << "Friction law" << fl << "is not supported by the native friction solver, using the Fortran friction solver.";
+  } else if (drParameters.isMagnitudeOutputOn) {
+    logWarning(rank) << "Magnitude output is not supported by the native friction solver, using the Fortran friction solver.";
+  } else {
+    logInfo(rank) << "Using the native friction solver for friction law" << fl;
+    drParameters.isNativeSolverEnabled = true;
+  }
+}
+
+std::unique_ptr<seissol::dr::friction_law::FrictionSolver>
+    seissol::dr::factory::getFrictionSolver(DRParameters const& drParameters) {
+  using namespace friction_law;
+  if (!drParameters.isNativeSolverEnabled) {
+    return nullptr;
+  }
+
+  switch (drParameters.frictionLaw) {
+    case 2:
+    case 16:
+      return std::make_unique<LinearSlipWeakening>(drParameters);
+    case 3:
+      return std::make_unique<AgingLawRateAndState>(drParameters);
+    case 4:
+      return std::make_unique<SlipLawRateAndState>(drParameters);
+    case 103:
+      return std::make_unique<FastVelocityWeakeningRateAndState>(drParameters);
+    default:
+      logError() << "Friction law" << drParameters.frictionLaw << "is not supported by the native friction solver.";
+  }
+  return nullptr;
+}
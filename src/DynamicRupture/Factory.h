@@ -0,0 +1,22 @@
+#ifndef SEISSOL_DR_FACTORY_H
+#define SEISSOL_DR_FACTORY_H
+
+#include <memory>
+
+#include <DynamicRupture/FrictionLaws/FrictionSolver.h>
+#include <DynamicRupture/Parameters.h>
+
+namespace seissol::dr::factory {
+/**
+ * Decides whether the friction law is evaluated by the C++ friction solvers.
+ * The C++ solvers are requested with SEISSOL_FRICTION_SOLVER=native and are used if they support the setup.
+ **/
+void selectFrictionSolver(DRParameters& drParameters);
+
+/**
+ * Returns the C++ friction solver of the friction law or nullptr if the Fortran implementation is used.
+ **/
+std::unique_ptr<friction_law::FrictionSolver> getFrictionSolver(DRParameters const& drParameters);
+} // namespace seissol::dr::factory
+
+#endif // SEISSOL_DR_FACTORY_H
@@ -0,0 +1,222 @@
+#include "FortranFaultState.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <DynamicRupture/Misc.h>
+#include <Parallel/Tasking.h>
+
+#ifdef ACL_DEVICE
+#include <device.h>
+#endif
+
+namespace {
+using seissol::dr::numberOfPoints;
+using seissol::dr::numPaddedPoints;
+using seissol::initializers::DynamicRupture;
+using seissol::initializers::Layer;
+using seissol::initializers::LTSTree;
+using seissol::initializers::Variable;
+
+using PointVariable = Variable<real[numPaddedPoints]> DynamicRupture::*;
+using SpectralVariable = Variable<real[seissol::dr::numberOfTPGridPoints][numPaddedPoints]> DynamicRupture::*;
+using FortranArray = double* seissol::dr::FortranFaultState::*;
+
+template <typename F>
+void forEachFace(LTSTree* dynRupTree, DynamicRupture* dynRup, F&& function) {
+  for (auto it = dynRupTree->beginLeaf(seissol::initializers::LayerMask(Ghost)); it != dynRupTree->endLeaf(); ++it) {
+    DRFaceInformation* faceInformation = it->var(dynRup->faceInformation);
+    seissol::parallel::forEachCell(it->getNumberOfCells(), [&](unsigned ltsFace) {
+      function(*it, ltsFace, faceInformation[ltsFace]);
+    });
+  }
+}
+
+//! The friction state is in unified memory on GPUs, thus the device has to finish before the host accesses it.
+void synchronizeDevice() {
+#ifdef ACL_DEVICE
+  device::DeviceInstance::getInstance().api->synchDevice();
+#endif
+}
+
+void copyFromFortranArray(double const* fortranArray, unsigned meshFace, real* target) {
+  double const* source = fortranArray + static_cast<size_t>(meshFace) * numberOfPoints;
+  std::copy(source, source + numberOfPoints, target);
+  std::fill(target + numberOfPoints, target + numPaddedPoints, 0);
+}
+
+void copyToFortranArray(real const* source, unsigned meshFace, double* fortranArray) {
+  double* target = fortranArray + static_cast<size_t>(meshFace) * numberOfPoints;
+  std::copy(source, source + numberOfPoints, target);
+}
+
+//! Variables which are evolved by the friction solvers
+std::vector<std::pair<PointVariable, FortranArray>> evolvingVariables(seissol::dr::DRParameters const& drParameters,
+                                                                     seissol::dr::FortranFaultState const& fortranState) {
+  using seissol::dr::FortranFaultState;
+  std::vector<std::pair<PointVariable, FortranArray>> variables = {
+      {&DynamicRupture::mu, &FortranFaultState::mu},
+      {&DynamicRupture::slipRate1, &FortranFaultState::slipRate1},
+      {&DynamicRupture::slipRate2, &FortranFaultState::slipRate2},
+      {&DynamicRupture::slip, &FortranFaultState::slip},
+      {&DynamicRupture::slip1, &FortranFaultState::slip1},
+      {&DynamicRupture::slip2, &FortranFaultState::slip2},
+      {&DynamicRupture::tractionXY, &FortranFaultState::tractionXY},
+      {&DynamicRupture::tractionXZ, &FortranFaultState::tractionXZ},
+      {&DynamicRupture::peakSlipRate, &FortranFaultState::peakSlipRate},
+      {&DynamicRupture::ruptureTime, &FortranFaultState::ruptureTime},
+      {&DynamicRupture::dynStressTime, &FortranFaultState::dynStressTime}};
+  int const fl = drParameters.frictionLaw;
+  if (fl == 3 || fl == 4 || fl == 103) {
+    variables.emplace_back(&DynamicRupture::stateVariable, &FortranFaultState::stateVariable);
+  }
+  if (fortranState.temperature != nullptr) {
+    variables.emplace_back(&DynamicRupture::temperature, &FortranFaultState::temperature);
+    variables.emplace_back(&DynamicRupture::pressure, &FortranFaultState::pressure);
+  }
+  return variables;
+}
+} // namespace
+
+void seissol::dr::FortranFaultStateBridge::initialize(FortranFaultState const& fortranState,
+                                                      std::unordered_map<std::string, double*> const& faultParameters,
+                                                      DRParameters const& drParameters,
+                                                      seissol::initializers::LTSTree* dynRupTree,
+                                                      seissol::initializers::DynamicRupture* dynRup) {
+  m_fortranState = fortranState;
+  m_drParameters = drParameters;
+  m_dynRupTree = dynRupTree;
+  m_dynRup = dynRup;
+
+  // Friction parameters
+  int const fl = drParameters.frictionLaw;
+  std::vector<std::pair<PointVariable, std::string>> parameters;
+  if (fl == 2 || fl == 16) {
+    parameters = {{&DynamicRupture::dC, "d_c"},
+                  {&DynamicRupture::muS, "mu_s"},
+                  {&DynamicRupture::muD, "mu_d"},
+                  {&DynamicRupture::cohesion, "cohesion"},
+                  {&DynamicRupture::forcedRuptureTime, "forced_rupture_time"}};
+  } else {
+    parameters = {{&DynamicRupture::rsA, "rs_a"}, {&DynamicRupture::rsSl0, "RS_sl0"}, {&DynamicRupture::rsSrW, "rs_srW"}};
+    if (drParameters.isThermalPressureOn) {
+      parameters.emplace_back(&DynamicRupture::alphaHy, "alpha_hy");
+      parameters.emplace_back(&DynamicRupture::tpHalfWidthShearZone, "TP_half_width_shear_zone");
+    }
+  }
+  for (auto const& entry : parameters) {
+    PointVariable const variable = entry.first;
+    auto parameter = faultParameters.find(entry.second);
+    if (parameter == faultParameters.end()) {
+      // e.g. forced_rupture_time for FL 2
+      continue;
+    }
+    double const* fortranArray = parameter->second;
+    forEachFace(dynRupTree, dynRup, [&](Layer& layer, unsigned ltsFace, DRFaceInformation const& faceInformation) {
+      copyFromFortranArray(fortranArray, faceInformation.meshFace, layer.var(dynRup->*variable)[ltsFace]);
+    });
+  }
+
+  // Output flags
+  bool const ruptureFront = drParameters.isRuptureFrontOutputOn;
+  bool const dynStress = drParameters.isRuptureFrontOutputOn && drParameters.isDynamicStressOutputOn;
+  forEachFace(dynRupTree, dynRup, [&](Layer& layer, unsigned ltsFace, DRFaceInformation const& faceInformation) {
+    bool* ruptureTimePending = layer.var(dynRup->ruptureTimePending)[ltsFace];
+    bool* dynStressTimePending = layer.var(dynRup->dynStressTimePending)[ltsFace];
+    std::fill(ruptureTimePending, ruptureTimePending + numPaddedPoints, ruptureFront && faceInformation.plusSideOnThisRank);
+    std::fill(dynStressTimePending, dynStressTimePending + numPaddedPoints, dynStress && faceInformation.plusSideOnThisRank);
+  });
+
+  // Nucleation stress does not change after initialization
+  forEachFace(dynRupTree, dynRup, [&](Layer& layer, unsigned ltsFace, DRFaceInformation const& faceInformation) {
+    real (*nucleationStress)[numPaddedPoints] = layer.var(dynRup->nucleationStressInFaultCS)[ltsFace];
+    for (unsigned i = 0; i < 6; ++i) {
+      if (fortranState.nucleationStressInFaultCS != nullptr) {
+        copyFromFortranArray(fortranState.nucleationStressInFaultCS + i * numberOfPoints,
+                             6 * faceInformation.meshFace,
+                             nucleationStress[i]);
+      } else {
+        std::fill(nucleationStress[i], nucleationStress[i] + numPaddedPoints, 0);
+      }
+    }
+  });
+
+  // Nucleation window of each face
+  forEachFace(dynRupTree, dynRup, [&](Layer& layer, unsigned ltsFace, DRFaceInformation const&) {
+    real const (*nucleationStress)[numPaddedPoints] = layer.var(dynRup->nucleationStressInFaultCS)[ltsFace];
+    DRNucleationWindow& window = layer.var(dynRup->nucleationWindow)[ltsFace];
+    window.hasNucleationStress = false;
+    for (unsigned i = 0; i < 6; ++i) {
+      window.hasNucleationStress |= std::any_of(
+          nucleationStress[i], nucleationStress[i] + numberOfPoints, [](real value) { return value != 0.0; });
+    }
+    window.forcedRuptureBegin = 0.0;
+    window.forcedRuptureEnd = 0.0;
+    if (fl == 16) {
+      real const* forcedRuptureTime = layer.var(dynRup->forcedRuptureTime)[ltsFace];
+      auto const range = std::minmax_element(forcedRuptureTime, forcedRuptureTime + numberOfPoints);
+      window.forcedRuptureBegin = *range.first;
+      window.forcedRuptureEnd = *range.second + drParameters.t0;
+    }
+  });
+
+  // Thermal pressurization starts without perturbation of temperature and pore pressure (see ini_model_DR.f90)
+  if (drParameters.isThermalPressureOn && fl != 2 && fl != 16) {
+    for (SpectralVariable const variable : {&DynamicRupture::tpTheta, &DynamicRupture::tpSigma}) {
+      forEachFace(dynRupTree, dynRup, [&](Layer& layer, unsigned ltsFace, DRFaceInformation const&) {
+        real (*spectrum)[numPaddedPoints] = layer.var(dynRup->*variable)[ltsFace];
+        std::fill(spectrum[0], spectrum[0] + seissol::dr::numberOfTPGridPoints * numPaddedPoints, 0);
+      });
+    }
+  }
+
+  copyStateFromFortran();
+}
+
+void seissol::dr::FortranFaultStateBridge::initializeThermalPressurization(double* temperature, double* pressure) {
+  m_fortranState.temperature = temperature;
+  m_fortranState.pressure = pressure;
+  copyStateFromFortran();
+}
+
+void seissol::dr::FortranFaultStateBridge::copyStateFromFortran() {
+  synchronizeDevice();
+  for (auto const& entry : evolvingVariables(m_drParameters, m_fortranState)) {
+    PointVariable const variable = entry.first;
+    double const* source = m_fortranState.*(entry.second);
+    forEachFace(m_dynRupTree, m_dynRup, [&](Layer& layer, unsigned ltsFace, DRFaceInformation const& faceInformation) {
+      copyFromFortranArray(source, faceInformation.meshFace, layer.var(m_dynRup->*variable)[ltsFace]);
+    });
+  }
+
+  // The initial stress is modified by the nucleation
+  forEachFace(m_dynRupTree, m_dynRup, [&](Layer& layer, unsigned ltsFace, DRFaceInformation const& faceInformation) {
+    real (*initialStress)[numPaddedPoints] = layer.var(m_dynRup->initialStressInFaultCS)[ltsFace];
+    for (unsigned i = 0; i < 6; ++i) {
+      copyFromFortranArray(m_fortranState.initialStressInFaultCS + i * numberOfPoints,
+                           6 * faceInformation.meshFace,
+                           initialStress[i]);
+    }
+  });
+}
+
+void seissol::dr::FortranFaultStateBridge::copyStateToFortran() {
+  synchronizeDevice();
+  for (auto const& entry : evolvingVariables(m_drParameters, m_fortranState)) {
+    PointVariable const variable = entry.first;
+    double* target = m_fortranState.*(entry.second);
+    forEachFace(m_dynRupTree, m_dynRup, [&](Layer& layer, unsigned ltsFace, DRFaceInformation const& faceInformation) {
+      copyToFortranArray(layer.var(m_dynRup->*variable)[ltsFace], faceInformation.meshFace, target);
+    });
+  }
+
+  forEachFace(m_dynRupTree, m_dynRup, [&](Layer& layer, unsigned ltsFace, DRFaceInformation const& faceInformation) {
+    real (*initialStress)[numPaddedPoints] = layer.var(m_dynRup->initialStressInFaultCS)[ltsFace];
+    for (unsigned i = 0; i < 6; ++i) {
+      copyToFortranArray(initialStress[i],
+                         6 * faceInformation.meshFace,
+                         m_fortranState.initialStressInFaultCS + i * numberOfPoints);
+    }
+  });
+}
@@ -0,0 +1,78 @@
+#ifndef SEISSOL_DR_FORTRANFAULTSTATE_H
+#define SEISSOL_DR_FORTRANFAULTSTATE_H
+
+#include <string>
+#include <unordered_map>
+
+#include <Initializer/DynamicRupture.h>
+#include <Initializer/tree/LTSTree.hpp>
+#include <DynamicRupture/Parameters.h>
+
+namespace seissol::dr {
+/**
+ * Pointers to the fault state arrays of the Fortran part (DISC%DynRup and EQN).
+ * All arrays have the shape (nBndGP, nSide), except for the stresses which have the shape (nBndGP, 6, nSide).
+ **/
+struct FortranFaultState {
+  double* mu = nullptr;
+  double* slipRate1 = nullptr;
+  double* slipRate2 = nullptr;
+  double* slip = nullptr;
+  double* slip1 = nullptr;
+  double* slip2 = nullptr;
+  double* tractionXY = nullptr;
+  double* tractionXZ = nullptr;
+  double* stateVariable = nullptr;
+  double* peakSlipRate = nullptr;
+  double* ruptureTime = nullptr;
+  double* dynStressTime = nullptr;
+  double* initialStressInFaultCS = nullptr;
+  //! nullptr if the friction law has no nucleation stress
+  double* nucleationStressInFaultCS = nullptr;
+  //! nullptr without thermal pressurization (DISC%DynRup%TP)
+  double* temperature = nullptr;
+  double* pressure = nullptr;
+};
+
+/**
+ * Keeps the fault state of the C++ friction solvers and the Fortran fault state consistent.
+ *
+ * The Fortran arrays remain the reference for fault output and checkpointing, hence the C++ state
+ * is written back before each of those.
+ **/
+class FortranFaultStateBridge {
+  public:
+  /**
+   * Copies the initial fault state and the friction parameters into the dynamic rupture tree.
+   *
+   * @param faultParameters parameters which were evaluated by easi, indexed by parameter name.
+   **/
+  void initialize(FortranFaultState const& fortranState,
+                  std::unordered_map<std::string, double*> const& faultParameters,
+                  DRParameters const& drParameters,
+                  seissol::initializers::LTSTree* dynRupTree,
+                  seissol::initializers::DynamicRupture* dynRup);
+
+  /**
+   * Adds temperature and pore pressure of thermal pressurization to the evolving fault state,
+   * which are needed by the fault output.
+   **/
+  void initializeThermalPressurization(double* temperature, double* pressure);
+
+  //! Copies the evolving fault state from Fortran, e.g. after loading a checkpoint.
+  void copyStateFromFortran();
+
+  //! Copies the evolving fault state to Fortran.
+  void copyStateToFortran();
+
+  bool isInitialized() const { return m_dynRupTree != nullptr; }
+
+  private:
+  FortranFaultState m_fortranState;
+  DRParameters m_drParameters;
+  seissol::initializers::LTSTree* m_dynRupTree = nullptr;
+  seissol::initializers::DynamicRupture* m_dynRup = nullptr;
+};
+} // namespace seissol::dr
+
+#endif // SEISSOL_DR_FORTRANFAULTSTATE_H
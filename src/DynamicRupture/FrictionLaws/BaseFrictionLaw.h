@@ -0,0 +1,225 @@
+#ifndef SEISSOL_DR_BASEFRICTIONLAW_H
+#define SEISSOL_DR_BASEFRICTIONLAW_H
+
+#include <algorithm>
+#include <cmath>
+
+#include <DynamicRupture/FrictionLaws/FrictionSolver.h>
+#include <DynamicRupture/Misc.h>
+#include <generated_code/init.h>
+
+namespace seissol::dr::friction_law {
+//! Godunov state on the fault in fault coordinates for every temporal quadrature point
+struct FaultStresses {
+  alignas(ALIGNMENT) real normalStress[CONVERGENCE_ORDER][numPaddedPoints];
+  alignas(ALIGNMENT) real xyStress[CONVERGENCE_ORDER][numPaddedPoints];
+  alignas(ALIGNMENT) real xzStress[CONVERGENCE_ORDER][numPaddedPoints];
+};
+
+//! Tractions computed by the friction law for every temporal quadrature point
+struct TractionResults {
+  alignas(ALIGNMENT) real xy[CONVERGENCE_ORDER][numPaddedPoints];
+  alignas(ALIGNMENT) real xz[CONVERGENCE_ORDER][numPaddedPoints];
+};
+
+//! Inverse P- and S-wave impedances on both sides of the fault
+struct Impedances {
+  real invZp;
+  real invZs;
+  real invZpNeig;
+  real invZsNeig;
+  real etaP;
+  real etaS;
+};
+
+/**
+ * Common part of all friction laws.
+ *
+ * Derived has to implement
+ *   bool updateFrictionAndSlip(Layer&, DynamicRupture const*, unsigned ltsFace,
+ *                              FaultStresses const&, TractionResults&, Impedances const&,
+ *                              double fullUpdateTime, double const deltaT[CONVERGENCE_ORDER]);
+ * which updates the friction law state of the face, computes the tractions and returns true if the face slipped.
+ **/
+template <typename Derived>
+class BaseFrictionLaw : public FrictionSolver {
+  public:
+  explicit BaseFrictionLaw(DRParameters const& drParameters) : FrictionSolver(drParameters) {}
+
+  bool evaluate(seissol::initializers::Layer& layerData,
+                seissol::initializers::DynamicRupture const* dynRup,
+                unsigned ltsFace,
+                real QInterpolatedPlus[CONVERGENCE_ORDER][tensor::QInterpolated::size()],
+                real QInterpolatedMinus[CONVERGENCE_ORDER][tensor::QInterpolated::size()],
+                double fullUpdateTime,
+                double const timePoints[CONVERGENCE_ORDER],
+                double const timeWeights[CONVERGENCE_ORDER]) override {
+    Impedances impedances = computeImpedances(layerData.var(dynRup->waveSpeedsPlus)[ltsFace],
+                                              layerData.var(dynRup->waveSpeedsMinus)[ltsFace]);
+
+    FaultStresses faultStresses;
+    computeGodunovState(QInterpolatedPlus, QInterpolatedMinus, impedances, faultStresses);
+
+    double deltaT[CONVERGENCE_ORDER];
+    misc::computeDeltaT<CONVERGENCE_ORDER>(timePoints, deltaT);
+
+    TractionResults tractionResults;
+    bool const slipping = static_cast<Derived*>(this)->updateFrictionAndSlip(
+        layerData, dynRup, ltsFace, faultStresses, tractionResults, impedances, fullUpdateTime, deltaT);
+
+    computeImposedState(QInterpolatedPlus,
+                        QInterpolatedMinus,
+                        faultStresses,
+                        tractionResults,
+                        impedances,
+                        timeWeights,
+                        layerData.var(dynRup->imposedStatePlus)[ltsFace],
+                        layerData.var(dynRup->imposedStateMinus)[ltsFace]);
+    return slipping;
+  }
+
+  protected:
+  static constexpr unsigned godunovLd = numPaddedPoints;
+
+  //! slip rate at which the rupture front arrives at a point
+  static constexpr real ruptureSlipRate = 0.001;
+
+  static Impedances computeImpedances(model::IsotropicWaveSpeeds const& plus,
+                                      model::IsotropicWaveSpeeds const& minus) {
+    Impedances impedances;
+    impedances.invZp = 1.0 / (plus.density * plus.pWaveVelocity);
+    impedances.invZs = 1.0 / (plus.density * plus.sWaveVelocity);
+    impedances.invZpNeig = 1.0 / (minus.density * minus.pWaveVelocity);
+    impedances.invZsNeig = 1.0 / (minus.density * minus.sWaveVelocity);
+    impedances.etaP = 1.0 / (impedances.invZp + impedances.invZpNeig);
+    impedances.etaS = 1.0 / (impedances.invZs + impedances.invZsNeig);
+    return impedances;
+  }
+
+  static void computeGodunovState(real QInterpolatedPlus[CONVERGENCE_ORDER][tensor::QInterpolated::size()],
+                                  real QInterpolatedMinus[CONVERGENCE_ORDER][tensor::QInterpolated::size()],
+                                  Impedances const& impedances,
+                                  FaultStresses& faultStresses) {
+    for (unsigned timeIndex = 0; timeIndex < CONVERGENCE_ORDER; ++timeIndex) {
+      real const* qP = QInterpolatedPlus[timeIndex];
+      real const* qM = QInterpolatedMinus[timeIndex];
+#pragma omp simd
+      for (unsigned point = 0; point < numberOfPoints; ++point) {
+        faultStresses.normalStress[timeIndex][point] =
+            impedances.etaP * (qM[6 * godunovLd + point] - qP[6 * godunovLd + point] +
+                               qP[0 * godunovLd + point] * impedances.invZp +
+                               qM[0 * godunovLd + point] * impedances.invZpNeig);
+        faultStresses.xyStress[timeIndex][point] =
+            impedances.etaS * (qM[7 * godunovLd + point] - qP[7 * godunovLd + point] +
+                               qP[3 * godunovLd + point] * impedances.invZs +
+                               qM[3 * godunovLd + point] * impedances.invZsNeig);
+        faultStresses.xzStress[timeIndex][point] =
+            impedances.etaS * (qM[8 * godunovLd + point] - qP[8 * godunovLd + point] +
+                               qP[5 * godunovLd + point] * impedances.invZs +
+                               qM[5 * godunovLd + point] * impedances.invZsNeig);
+      }
+    }
+  }
+
+  static void computeImposedState(real QInterpolatedPlus[CONVERGENCE_ORDER][tensor::QInterpolated::size()],
+                                  real QInterpolatedMinus[CONVERGENCE_ORDER][tensor::QInterpolated::size()],
+                                  FaultStresses const& faultStresses,
+                                  TractionResults const& tractionResults,
+                                  Impedances const& impedances,
+                                  double const timeWeights[CONVERGENCE_ORDER],
+                                  real imposedStatePlus[tensor::QInterpolated::size()],
+                                  real imposedStateMinus[tensor::QInterpolated::size()]) {
+    std::fill(imposedStatePlus, imposedStatePlus + tensor::QInterpolated::size(), 0);
+    std::fill(imposedStateMinus, imposedStateMinus + tensor::QInterpolated::size(), 0);
+
+    for (unsigned timeIndex = 0; timeIndex < CONVERGENCE_ORDER; ++timeIndex) {
+      real const weight = timeWeights[timeIndex];
+      real const* qP = QInterpolatedPlus[timeIndex];
+      real const* qM = QInterpolatedMinus[timeIndex];
+      real const* normalStress = faultStresses.normalStress[timeIndex];
+      real const* tractionXY = tractionResults.xy[timeIndex];
+      real const* tractionXZ = tractionResults.xz[timeIndex];
+#pragma omp simd
+      for (unsigned point = 0; point < numberOfPoints; ++point) {
+        imposedStateMinus[0 * godunovLd + point] += weight * normalStress[point];
+        imposedStateMinus[3 * godunovLd + point] += weight * tractionXY[point];
+        imposedStateMinus[5 * godunovLd + point] += weight * tractionXZ[point];
+        imposedStateMinus[6 * godunovLd + point] +=
+            weight * (qM[6 * godunovLd + point] -
+                      impedances.invZpNeig * (normalStress[point] - qM[0 * godunovLd + point]));
+        imposedStateMinus[7 * godunovLd + point] +=
+            weight * (qM[7 * godunovLd + point] -
+                      impedances.invZsNeig * (tractionXY[point] - qM[3 * godunovLd + point]));
+        imposedStateMinus[8 * godunovLd + point] +=
+            weight * (qM[8 * godunovLd + point] -
+                      impedances.invZsNeig * (tractionXZ[point] - qM[5 * godunovLd + point]));
+
+        imposedStatePlus[0 * godunovLd + point] += weight * normalStress[point];
+        imposedStatePlus[3 * godunovLd + point] += weight * tractionXY[point];
+        imposedStatePlus[5 * godunovLd + point] += weight * tractionXZ[point];
+        imposedStatePlus[6 * godunovLd + point] +=
+            weight * (qP[6 * godunovLd + point] +
+                      impedances.invZp * (normalStress[point] - qP[0 * godunovLd + point]));
+        imposedStatePlus[7 * godunovLd + point] +=
+            weight * (qP[7 * godunovLd + point] +
+                      impedances.invZs * (tractionXY[point] - qP[3 * godunovLd + point]));
+        imposedStatePlus[8 * godunovLd + point] +=
+            weight * (qP[8 * godunovLd + point] +
+                      impedances.invZs * (tractionXZ[point] - qP[5 * godunovLd + point]));
+      }
+    }
+  }
+
+  /**
+   * Adds the nucleation stress increment of [time - dt, time] to the initial stress.
+   **/
+  void adjustInitialStress(real (*initialStressInFaultCS)[numPaddedPoints],
+                           real const (*nucleationStressInFaultCS)[numPaddedPoints],
+                           double time,
+                           double dt) const {
+    if (time <= drParameters.t0) {
+      real const gNuc = misc::smoothStepIncrement(time, drParameters.t0, dt);
+      for (unsigned i = 0; i < 6; ++i) {
+#pragma omp simd
+        for (unsigned point = 0; point < numberOfPoints; ++point) {
+          initialStressInFaultCS[i][point] += nucleationStressInFaultCS[i][point] * gNuc;
+        }
+      }
+    }
+  }
+
+  /**
+   * Projects values at the quadrature points onto the space of the DOFs and evaluates
+   * the projection at the quadrature points again.
+   **/
+  static void resample(real const in[numPaddedPoints], real out[numPaddedPoints]) {
+    static_assert(tensor::resample::Shape[0] == numberOfPoints, "Different number of quadrature points?");
+    std::fill(out, out + numPaddedPoints, 0);
+    for (unsigned j = 0; j < numberOfPoints; ++j) {
+#pragma omp simd
+      for (unsigned i = 0; i < numberOfPoints; ++i) {
+        out[i] += init::resample::Values[i + j * numberOfPoints] * in[j];
+      }
+    }
+  }
+
+  /**
+   * Stores the rupture time and the peak slip rate, which are evaluated once per time step.
+   **/
+  static void saveRuptureFrontAndPeakSlipRate(real const slipRateMagnitude[numPaddedPoints],
+                                              real ruptureTime[numPaddedPoints],
+                                              bool ruptureTimePending[numPaddedPoints],
+                                              real peakSlipRate[numPaddedPoints],
+                                              double fullUpdateTime) {
+    for (unsigned point = 0; point < numberOfPoints; ++point) {
+      if (ruptureTimePending[point] && slipRateMagnitude[point] > ruptureSlipRate) {
+        ruptureTime[point] = fullUpdateTime;
+        ruptureTimePending[point] = false;
+      }
+      peakSlipRate[point] = std::max(peakSlipRate[point], slipRateMagnitude[point]);
+    }
+  }
+};
+} // namespace seissol::dr::friction_law
+
+#endif // SEISSOL_DR_BASEFRICTIONLAW_H
@@ -0,0 +1,76 @@
+#ifndef SEISSOL_DR_FRICTIONSOLVER_H
+#define SEISSOL_DR_FRICTIONSOLVER_H
+
+#include <Initializer/DynamicRupture.h>
+#include <Initializer/tree/Layer.hpp>
+#include <DynamicRupture/Parameters.h>
+#include <utils/logger.h>
+
+namespace seissol::dr::friction_law {
+/**
+ * Interface of the C++ friction solvers, which replace the per-face calls to
+ * f_interoperability_evaluateFrictionLaw.
+ *
+ * All state of the friction law is stored face-wise in the layers of the dynamic rupture tree,
+ * see seissol::initializers::DynamicRupture.
+ **/
+class FrictionSolver {
+  public:
+  explicit FrictionSolver(DRParameters const& drParameters) : drParameters(drParameters) {}
+  virtual ~FrictionSolver() = default;
+
+  /**
+   * Computes the Godunov state, evaluates the friction law and stores the imposed state of one face.
+   *
+   * @param layerData dynamic rupture layer which contains the face.
+   * @param dynRup dynamic rupture variable handles.
+   * @param ltsFace face id within the layer.
+   * @param QInterpolatedPlus space-time interpolated values on the plus side.
+   * @param QInterpolatedMinus space-time interpolated values on the minus side.
+   * @param fullUpdateTime start time of the current time step.
+   * @param timePoints temporal quadrature points relative to fullUpdateTime.
+   * @param timeWeights temporal quadrature weights.
+   * @return true if the face slipped in this time step (counted as active face in the loop statistics).
+   **/
+  virtual bool evaluate(seissol::initializers::Layer& layerData,
+                        seissol::initializers::DynamicRupture const* dynRup,
+                        unsigned ltsFace,
+                        real QInterpolatedPlus[CONVERGENCE_ORDER][tensor::QInterpolated::size()],
+                        real QInterpolatedMinus[CONVERGENCE_ORDER][tensor::QInterpolated::size()],
+                        double fullUpdateTime,
+                        double const timePoints[CONVERGENCE_ORDER],
+                        double const timeWeights[CONVERGENCE_ORDER]) = 0;
+
+#ifdef ACL_DEVICE
+  /**
+   * Evaluates the friction law for all faces of a layer on the device.
+   *
+   * @param QInterpolatedPlus device pointer to the space-time interpolated values of all faces on the plus side.
+   * @param QInterpolatedMinus device pointer to the space-time interpolated values of all faces on the minus side.
+   * @param resampleMatrix device pointer to init::resample.
+   * @param streamPtr device stream.
+   **/
+  virtual void evaluateOnDevice(seissol::initializers::Layer& layerData,
+                                seissol::initializers::DynamicRupture const* dynRup,
+                                real const* QInterpolatedPlus,
+                                real const* QInterpolatedMinus,
+                                double fullUpdateTime,
+                                double const timePoints[CONVERGENCE_ORDER],
+                                double const timeWeights[CONVERGENCE_ORDER],
+                                real const* resampleMatrix,
+                                void* streamPtr) {
+    logError() << "Friction law" << drParameters.frictionLaw << "is not available on the device.";
+  }
+
+  //! true if evaluateOnDevice is implemented
+  virtual bool isAvailableOnDevice() const { return false; }
+#endif
+
+  DRParameters const& getParameters() const { return drParameters; }
+
+  protected:
+  DRParameters drParameters;
+};
+} // namespace seissol::dr::friction_law
+
+#endif // SEISSOL_DR_FRICTIONSOLVER_H
@@ -0,0 +1,215 @@
+#ifndef SEISSOL_DR_LINEARSLIPWEAKENING_H
+#define SEISSOL_DR_LINEARSLIPWEAKENING_H
+
+#include <DynamicRupture/FrictionLaws/BaseFrictionLaw.h>
+#ifdef ACL_DEVICE
+#include <Kernels/DeviceAux/FrictionLawAux.h>
+#endif
+
+namespace seissol::dr::friction_law {
+/**
+ * Linear slip weakening friction (FL 2) and linear slip weakening with forced rupture time (FL 16),
+ * see Linear_slip_weakening_TPV1617 in Evaluate_friction_law.f90.
+ **/
+class LinearSlipWeakening : public BaseFrictionLaw<LinearSlipWeakening> {
+  public:
+  using BaseFrictionLaw::BaseFrictionLaw;
+
+  //! slip rate below which the fault is healed instantaneously
+  static constexpr real healingThreshold = 10e-14;
+
+  bool updateFrictionAndSlip(seissol::initializers::Layer& layerData,
+                             seissol::initializers::DynamicRupture const* dynRup,
+                             unsigned ltsFace,
+                             FaultStresses const& faultStresses,
+                             TractionResults& tractionResults,
+                             Impedances const& impedances,
+                             double fullUpdateTime,
+                             double const deltaT[CONVERGENCE_ORDER]) {
+    real* mu = layerData.var(dynRup->mu)[ltsFace];
+    real* slip = layerData.var(dynRup->slip)[ltsFace];
+    real* slip1 = layerData.var(dynRup->slip1)[ltsFace];
+    real* slip2 = layerData.var(dynRup->slip2)[ltsFace];
+    real* slipRate1 = layerData.var(dynRup->slipRate1)[ltsFace];
+    real* slipRate2 = layerData.var(dynRup->slipRate2)[ltsFace];
+    real* tractionXY = layerData.var(dynRup->tractionXY)[ltsFace];
+    real* tractionXZ = layerData.var(dynRup->tractionXZ)[ltsFace];
+    real const* cohesion = layerData.var(dynRup->cohesion)[ltsFace];
+    real const* dC = layerData.var(dynRup->dC)[ltsFace];
+    real const* muS = layerData.var(dynRup->muS)[ltsFace];
+    real const* muD = layerData.var(dynRup->muD)[ltsFace];
+    real const* forcedRuptureTime = layerData.var(dynRup->forcedRuptureTime)[ltsFace];
+    real (*initialStress)[numPaddedPoints] = layerData.var(dynRup->initialStressInFaultCS)[ltsFace];
+    real (*nucleationStress)[numPaddedPoints] = layerData.var(dynRup->nucleationStressInFaultCS)[ltsFace];
+    DRNucleationWindow const& nucleationWindow = layerData.var(dynRup->nucleationWindow)[ltsFace];
+
+    alignas(ALIGNMENT) real slipRateMagnitude[numPaddedPoints] = {};
+    alignas(ALIGNMENT) real resampledSlipRate[numPaddedPoints];
+
+    bool const hasNucleation = drParameters.frictionLaw == 2 && nucleationWindow.hasNucleationStress;
+    bool const hasForcedRuptureTime = drParameters.frictionLaw == 16;
+    real const t0 = drParameters.t0;
+    real const eta = impedances.etaS;
+
+    bool slipping = false;
+    double time = fullUpdateTime;
+    for (unsigned timeIndex = 0; timeIndex < CONVERGENCE_ORDER; ++timeIndex) {
+      real const dt = deltaT[timeIndex];
+      time += dt;
+      if (hasNucleation) {
+        adjustInitialStress(initialStress, nucleationStress, time, dt);
+      }
+
+      // Outside of the forced rupture window, the forced weakening is the same for all points
+      real forcedWeakening = 0.0;
+      bool isForcedRuptureActive = false;
+      if (hasForcedRuptureTime) {
+        if (time > nucleationWindow.forcedRuptureEnd) {
+          forcedWeakening = 1.0;
+        } else {
+          isForcedRuptureActive = time >= nucleationWindow.forcedRuptureBegin;
+        }
+      }
+
+      real const* normalStress = faultStresses.normalStress[timeIndex];
+      real const* xyStress = faultStresses.xyStress[timeIndex];
+      real const* xzStress = faultStresses.xzStress[timeIndex];
+      real maxSlipRate = 0.0;
+#pragma omp simd reduction(max:maxSlipRate)
+      for (unsigned point = 0; point < numberOfPoints; ++point) {
+        real const pressure = initialStress[0][point] + normalStress[point];
+        real const strength = -cohesion[point] - mu[point] * std::min(pressure, static_cast<real>(0.0));
+        real const totalXY = initialStress[3][point] + xyStress[point];
+        real const totalXZ = initialStress[5][point] + xzStress[point];
+        real const shearStress = std::sqrt(totalXY * totalXY + totalXZ * totalXZ);
+
+        real const slipRate = std::max(static_cast<real>(0.0), (shearStress - strength) / eta);
+        slipRateMagnitude[point] = slipRate;
+        maxSlipRate = std::max(maxSlipRate, slipRate);
+        slipRate1[point] = slipRate * totalXY / (strength + eta * slipRate);
+        slipRate2[point] = slipRate * totalXZ / (strength + eta * slipRate);
+        tractionXY[point] = xyStress[point] - eta * slipRate1[point];
+        tractionXZ[point] = xzStress[point] - eta * slipRate2[point];
+        tractionResults.xy[timeIndex][point] = tractionXY[point];
+        tractionResults.xz[timeIndex][point] = tractionXZ[point];
+
+        slip1[point] += slipRate1[point] * dt;
+        slip2[point] += slipRate2[point] * dt;
+      }
+
+      // Resample slip rate, such that the state (slip) lies in the same polynomial space as the degrees of freedom.
+      // If the trial traction stays below the strength at all points, the face is locked and the slip rate vanishes.
+      if (maxSlipRate > 0.0) {
+        resample(slipRateMagnitude, resampledSlipRate);
+        slipping = true;
+      } else {
+        std::fill(resampledSlipRate, resampledSlipRate + numPaddedPoints, 0);
+      }
+
+#pragma omp simd
+      for (unsigned point = 0; point < numberOfPoints; ++point) {
+        slip[point] = std::max(static_cast<real>(0.0), slip[point] + resampledSlipRate[point] * dt);
+
+        real const f1 = std::min(std::abs(slip[point]) / dC[point], static_cast<real>(1.0));
+        real f2 = forcedWeakening;
+        if (isForcedRuptureActive) {
+          if (t0 == 0) {
+            f2 = (time >= forcedRuptureTime[point]) ? 1.0 : 0.0;
+          } else {
+            f2 = std::max(static_cast<real>(0.0),
+                          std::min(static_cast<real>((time - forcedRuptureTime[point]) / t0), static_cast<real>(1.0)));
+          }
+        }
+        mu[point] = muS[point] - (muS[point] - muD[point]) * std::max(f1, f2);
+
+        if (drParameters.isInstantaneousHealingOn && slipRateMagnitude[point] < healingThreshold) {
+          mu[point] = muS[point];
+          slip[point] = 0.0;
+        }
+      }
+    }
+
+    real* ruptureTime = layerData.var(dynRup->ruptureTime)[ltsFace];
+    real* dynStressTime = layerData.var(dynRup->dynStressTime)[ltsFace];
+    real* peakSlipRate = layerData.var(dynRup->peakSlipRate)[ltsFace];
+    bool* ruptureTimePending = layerData.var(dynRup->ruptureTimePending)[ltsFace];
+    bool* dynStressTimePending = layerData.var(dynRup->dynStressTimePending)[ltsFace];
+
+    saveRuptureFrontAndPeakSlipRate(slipRateMagnitude, ruptureTime, ruptureTimePending, peakSlipRate, fullUpdateTime);
+
+    // time when shear stress is equal to the dynamic stress after rupture arrived
+    for (unsigned point = 0; point < numberOfPoints; ++point) {
+      if (ruptureTime[point] > 0.0 && ruptureTime[point] <= fullUpdateTime && dynStressTimePending[point] &&
+          std::abs(slip[point]) >= dC[point]) {
+        dynStressTime[point] = fullUpdateTime;
+        dynStressTimePending[point] = false;
+      }
+    }
+    return slipping;
+  }
+
+#ifdef ACL_DEVICE
+  void evaluateOnDevice(seissol::initializers::Layer& layerData,
+                        seissol::initializers::DynamicRupture const* dynRup,
+                        real const* QInterpolatedPlus,
+                        real const* QInterpolatedMinus,
+                        double fullUpdateTime,
+                        double const timePoints[CONVERGENCE_ORDER],
+                        double const timeWeights[CONVERGENCE_ORDER],
+                        real const* resampleMatrix,
+                        void* streamPtr) override {
+    using namespace seissol::kernels::device::aux::friction_law;
+    LinearSlipWeakeningLayer layer{};
+    layer.QInterpolatedPlus = QInterpolatedPlus;
+    layer.QInterpolatedMinus = QInterpolatedMinus;
+    layer.imposedStatePlus = layerData.var(dynRup->imposedStatePlus)[0];
+    layer.imposedStateMinus = layerData.var(dynRup->imposedStateMinus)[0];
+    layer.waveSpeedsPlus = layerData.var(dynRup->waveSpeedsPlus);
+    layer.waveSpeedsMinus = layerData.var(dynRup->waveSpeedsMinus);
+    layer.mu = layerData.var(dynRup->mu)[0];
+    layer.slip = layerData.var(dynRup->slip)[0];
+    layer.slip1 = layerData.var(dynRup->slip1)[0];
+    layer.slip2 = layerData.var(dynRup->slip2)[0];
+    layer.slipRate1 = layerData.var(dynRup->slipRate1)[0];
+    layer.slipRate2 = layerData.var(dynRup->slipRate2)[0];
+    layer.tractionXY = layerData.var(dynRup->tractionXY)[0];
+    layer.tractionXZ = layerData.var(dynRup->tractionXZ)[0];
+    layer.peakSlipRate = layerData.var(dynRup->peakSlipRate)[0];
+    layer.ruptureTime = layerData.var(dynRup->ruptureTime)[0];
+    layer.dynStressTime = layerData.var(dynRup->dynStressTime)[0];
+    layer.ruptureTimePending = layerData.var(dynRup->ruptureTimePending)[0];
+    layer.dynStressTimePending = layerData.var(dynRup->dynStressTimePending)[0];
+    layer.dC = layerData.var(dynRup->dC)[0];
+    layer.muS = layerData.var(dynRup->muS)[0];
+    layer.muD = layerData.var(dynRup->muD)[0];
+    layer.cohesion = layerData.var(dynRup->cohesion)[0];
+    layer.forcedRuptureTime = layerData.var(dynRup->forcedRuptureTime)[0];
+    layer.initialStressInFaultCS = layerData.var(dynRup->initialStressInFaultCS)[0][0];
+    layer.nucleationStressInFaultCS = layerData.var(dynRup->nucleationStressInFaultCS)[0][0];
+    layer.resampleMatrix = resampleMatrix;
+
+    LinearSlipWeakeningSettings settings{};
+    settings.fullUpdateTime = fullUpdateTime;
+    misc::computeDeltaT<CONVERGENCE_ORDER>(timePoints, settings.deltaT);
+    double time = fullUpdateTime;
+    for (unsigned timeIndex = 0; timeIndex < CONVERGENCE_ORDER; ++timeIndex) {
+      time += settings.deltaT[timeIndex];
+      settings.timeWeights[timeIndex] = timeWeights[timeIndex];
+      // the nucleation increment is the same for all points, see adjustInitialStress
+      bool const isNucleating = drParameters.frictionLaw == 2 && time <= drParameters.t0;
+      settings.nucleationIncrement[timeIndex] =
+          isNucleating ? misc::smoothStepIncrement(time, drParameters.t0, settings.deltaT[timeIndex]) : 0.0;
+    }
+    settings.t0 = drParameters.t0;
+    settings.hasForcedRuptureTime = drParameters.frictionLaw == 16;
+    settings.isInstantaneousHealingOn = drParameters.isInstantaneousHealingOn;
+
+    evaluateLinearSlipWeakening(layer, settings, layerData.getNumberOfCells(), streamPtr);
+  }
+
+  bool isAvailableOnDevice() const override { return true; }
+#endif
+};
+} // namespace seissol::dr::friction_law
+
+#endif // SEISSOL_DR_LINEARSLIPWEAKENING_H
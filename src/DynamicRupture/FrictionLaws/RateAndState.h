@@ -0,0 +1,378 @@
+#ifndef SEISSOL_DR_RATEANDSTATE_H
+#define SEISSOL_DR_RATEANDSTATE_H
+
+#include <utils/logger.h>
+
+#include <DynamicRupture/FrictionLaws/BaseFrictionLaw.h>
+#include <DynamicRupture/FrictionLaws/ThermalPressurization.h>
+
+namespace seissol::dr::friction_law {
+//! Rate and state parameters of a single face
+struct RateAndStateParameters {
+  real f0;
+  real b;
+  real sr0;
+  real muW;
+  real const* a;
+  real const* sl0;
+  real const* srW;
+};
+
+/**
+ * Aging law (FL 3)
+ **/
+struct AgingLaw {
+  static constexpr bool resampleStateVariable = false;
+
+  static real updateStateVariable(RateAndStateParameters const& rs, unsigned point, real sv0, real slipRate, real dt) {
+    real const exp1 = std::exp(-slipRate * dt / rs.sl0[point]);
+    return sv0 * exp1 + rs.sl0[point] / slipRate * (1.0 - exp1);
+  }
+
+  //! Returns x with mu = a * asinh(slipRate * x)
+  static real frictionPrefactor(RateAndStateParameters const& rs, unsigned point, real stateVariable) {
+    return 0.5 / rs.sr0 * std::exp((rs.f0 + rs.b * std::log(rs.sr0 * stateVariable / rs.sl0[point])) / rs.a[point]);
+  }
+};
+
+/**
+ * Slip law (FL 4)
+ **/
+struct SlipLaw {
+  static constexpr bool resampleStateVariable = false;
+
+  static real updateStateVariable(RateAndStateParameters const& rs, unsigned point, real sv0, real slipRate, real dt) {
+    real const exp1 = std::exp(-slipRate * dt / rs.sl0[point]);
+    return rs.sl0[point] / slipRate * std::pow(slipRate * sv0 / rs.sl0[point], exp1);
+  }
+
+  static real frictionPrefactor(RateAndStateParameters const& rs, unsigned point, real stateVariable) {
+    return AgingLaw::frictionPrefactor(rs, point, stateVariable);
+  }
+};
+
+/**
+ * Slip law with strong velocity weakening (FL 103)
+ **/
+struct FastVelocityWeakeningLaw {
+  static constexpr bool resampleStateVariable = true;
+
+  static real updateStateVariable(RateAndStateParameters const& rs, unsigned point, real sv0, real slipRate, real dt) {
+    real const a = rs.a[point];
+    // low-velocity steady state friction coefficient
+    real const flv = rs.f0 - (rs.b - a) * std::log(slipRate / rs.sr0);
+    // steady state friction coefficient
+    real const muW = rs.muW;
+    real const fss = muW + (flv - muW) / std::pow(1.0 + std::pow(slipRate / rs.srW[point], 8), 1.0 / 8.0);
+    // steady-state state variable
+    real const svss = a * std::log(2.0 * rs.sr0 / slipRate * std::sinh(fss / a));
+    // exact integration of dSV/dt, assuming constant slip rate over the integration step
+    real const exp1 = std::exp(-slipRate * dt / rs.sl0[point]);
+    return svss * (1.0 - exp1) + exp1 * sv0;
+  }
+
+  static real frictionPrefactor(RateAndStateParameters const& rs, unsigned point, real stateVariable) {
+    return 0.5 / rs.sr0 * std::exp(stateVariable / rs.a[point]);
+  }
+};
+
+/**
+ * Rate and state friction following Kaneko et al. (2008), see rate_and_state in Evaluate_friction_law.f90.
+ * With thermal pressurization, the pore pressure reduces the effective normal stress.
+ **/
+template <typename StateLaw>
+class RateAndState : public BaseFrictionLaw<RateAndState<StateLaw>> {
+  public:
+  explicit RateAndState(DRParameters const& drParameters)
+      : BaseFrictionLaw<RateAndState<StateLaw>>(drParameters), thermalPressurization(drParameters) {}
+
+  static constexpr unsigned numberOfSlipRateUpdates = 60;
+  static constexpr unsigned numberOfStateVariableUpdates = 2;
+  //! absolute tolerance of the Newton-Raphson iteration
+  static constexpr real newtonTolerance = 1e-8;
+  //! lower bound of the slip rate, avoids NaN for slip rates close to zero
+  static constexpr real almostZero = 1e-45;
+
+  bool updateFrictionAndSlip(seissol::initializers::Layer& layerData,
+                             seissol::initializers::DynamicRupture const* dynRup,
+                             unsigned ltsFace,
+                             FaultStresses const& faultStresses,
+                             TractionResults& tractionResults,
+                             Impedances const& impedances,
+                             double fullUpdateTime,
+                             double const deltaT[CONVERGENCE_ORDER]) {
+    auto const& drParameters = this->drParameters;
+    real* mu = layerData.var(dynRup->mu)[ltsFace];
+    real* slip = layerData.var(dynRup->slip)[ltsFace];
+    real* slip1 = layerData.var(dynRup->slip1)[ltsFace];
+    real* slip2 = layerData.var(dynRup->slip2)[ltsFace];
+    real* slipRate1 = layerData.var(dynRup->slipRate1)[ltsFace];
+    real* slipRate2 = layerData.var(dynRup->slipRate2)[ltsFace];
+    real* tractionXY = layerData.var(dynRup->tractionXY)[ltsFace];
+    real* tractionXZ = layerData.var(dynRup->tractionXZ)[ltsFace];
+    real* stateVariable = layerData.var(dynRup->stateVariable)[ltsFace];
+    real (*initialStress)[numPaddedPoints] = layerData.var(dynRup->initialStressInFaultCS)[ltsFace];
+    real (*nucleationStress)[numPaddedPoints] = layerData.var(dynRup->nucleationStressInFaultCS)[ltsFace];
+    bool const hasNucleation = layerData.var(dynRup->nucleationWindow)[ltsFace].hasNucleationStress;
+
+    RateAndStateParameters rs;
+    rs.f0 = drParameters.rsF0;
+    rs.b = drParameters.rsB;
+    rs.sr0 = drParameters.rsSr0;
+    rs.muW = drParameters.muW;
+    rs.a = layerData.var(dynRup->rsA)[ltsFace];
+    rs.sl0 = layerData.var(dynRup->rsSl0)[ltsFace];
+    rs.srW = (drParameters.frictionLaw == 103) ? layerData.var(dynRup->rsSrW)[ltsFace] : nullptr;
+
+    alignas(ALIGNMENT) real localStateVariable[numPaddedPoints];
+    alignas(ALIGNMENT) real localMu[numPaddedPoints];
+    alignas(ALIGNMENT) real slipRateMagnitude[numPaddedPoints] = {};
+    alignas(ALIGNMENT) real stateVariable0[numPaddedPoints];
+    alignas(ALIGNMENT) real slipRateForStateUpdate[numPaddedPoints];
+    alignas(ALIGNMENT) real normalStress[numPaddedPoints];
+    alignas(ALIGNMENT) real totalNormalStress[numPaddedPoints];
+    alignas(ALIGNMENT) real porePressure[numPaddedPoints] = {};
+    alignas(ALIGNMENT) real heating[numPaddedPoints];
+    alignas(ALIGNMENT) real shearStress[numPaddedPoints];
+    alignas(ALIGNMENT) real slipRateTest[numPaddedPoints];
+
+    std::copy(stateVariable, stateVariable + numPaddedPoints, localStateVariable);
+    std::copy(mu, mu + numPaddedPoints, localMu);
+
+    bool const isThermalPressureOn = drParameters.isThermalPressureOn;
+    ThermalPressurizationFace tpFace{};
+    ThermalPressurizationSums tpSums;
+    if (isThermalPressureOn) {
+      tpFace.temperature = layerData.var(dynRup->temperature)[ltsFace];
+      tpFace.pressure = layerData.var(dynRup->pressure)[ltsFace];
+      tpFace.theta = layerData.var(dynRup->tpTheta)[ltsFace];
+      tpFace.sigma = layerData.var(dynRup->tpSigma)[ltsFace];
+      tpFace.halfWidthShearZone = layerData.var(dynRup->tpHalfWidthShearZone)[ltsFace];
+      tpFace.alphaHy = layerData.var(dynRup->alphaHy)[ltsFace];
+      std::copy(tpFace.pressure, tpFace.pressure + numPaddedPoints, porePressure);
+    }
+
+    real const invZ = impedances.invZs + impedances.invZsNeig;
+
+    double time = fullUpdateTime;
+    for (unsigned timeIndex = 0; timeIndex < CONVERGENCE_ORDER; ++timeIndex) {
+      real const dt = deltaT[timeIndex];
+      time += dt;
+      if (hasNucleation) {
+        this->adjustInitialStress(initialStress, nucleationStress, time, dt);
+      }
+
+      real const* xyStress = faultStresses.xyStress[timeIndex];
+      real const* xzStress = faultStresses.xzStress[timeIndex];
+#pragma omp simd
+      for (unsigned point = 0; point < numberOfPoints; ++point) {
+        real const totalXY = initialStress[3][point] + xyStress[point];
+        real const totalXZ = initialStress[5][point] + xzStress[point];
+        shearStress[point] = std::sqrt(totalXY * totalXY + totalXZ * totalXZ);
+        totalNormalStress[point] = faultStresses.normalStress[timeIndex][point] + initialStress[0][point];
+        // effective normal stress including initial stresses and pore pressure
+        normalStress[point] = std::min(static_cast<real>(0.0), totalNormalStress[point] - porePressure[point]);
+        // the state variable must always be corrected using stateVariable0
+        stateVariable0[point] = localStateVariable[point];
+        slipRateMagnitude[point] = std::max(
+            almostZero, std::sqrt(slipRate1[point] * slipRate1[point] + slipRate2[point] * slipRate2[point]));
+        slipRateForStateUpdate[point] = slipRateMagnitude[point];
+      }
+      if (isThermalPressureOn) {
+        // the diffusion over dt does not depend on the slip rate, hence it is evaluated once per time step
+        thermalPressurization.computeSums(tpFace, dt, tpSums);
+      }
+
+      for (unsigned j = 0; j < numberOfStateVariableUpdates; ++j) {
+        // 1. update state variable using the slip rate of the previous iteration
+#pragma omp simd
+        for (unsigned point = 0; point < numberOfPoints; ++point) {
+          localStateVariable[point] = StateLaw::updateStateVariable(
+              rs, point, stateVariable0[point], slipRateForStateUpdate[point], dt);
+        }
+        if (isThermalPressureOn) {
+          // pore pressure from the fault strength of the previous iteration
+          updatePorePressure(tpFace, tpSums, localMu, slipRateMagnitude, totalNormalStress, porePressure, heating,
+                             normalStress);
+        }
+        // 2. solve for the new slip rate with the Newton-Raphson algorithm
+        invertSlipRateIterative(rs, slipRateMagnitude, localStateVariable, normalStress, shearStress, invZ, slipRateTest);
+#pragma omp simd
+        for (unsigned point = 0; point < numberOfPoints; ++point) {
+          // 3. use the mean slip rate for the next state variable update (Kaneko et al. 2008, step 6)
+          slipRateForStateUpdate[point] = 0.5 * (slipRateMagnitude[point] + std::abs(slipRateTest[point]));
+          // 4. accept the new slip rate
+          slipRateMagnitude[point] = std::abs(slipRateTest[point]);
+        }
+        if (isThermalPressureOn) {
+#pragma omp simd
+          for (unsigned point = 0; point < numberOfPoints; ++point) {
+            real const prefactor = StateLaw::frictionPrefactor(rs, point, localStateVariable[point]);
+            localMu[point] = rs.a[point] * std::asinh(slipRateMagnitude[point] * prefactor);
+          }
+        }
+      }
+
+      // 5. final state variable, pore pressure, friction coefficient, traction and slip
+#pragma omp simd
+      for (unsigned point = 0; point < numberOfPoints; ++point) {
+        localStateVariable[point] = StateLaw::updateStateVariable(
+            rs, point, stateVariable0[point], slipRateForStateUpdate[point], dt);
+      }
+      if (isThermalPressureOn) {
+        updatePorePressure(tpFace, tpSums, localMu, slipRateMagnitude, totalNormalStress, porePressure, heating,
+                           normalStress);
+        thermalPressurization.updateSpectrum(tpFace, dt, heating);
+      }
+#pragma omp simd
+      for (unsigned point = 0; point < numberOfPoints; ++point) {
+        real const prefactor = StateLaw::frictionPrefactor(rs, point, localStateVariable[point]);
+        localMu[point] = rs.a[point] * std::asinh(slipRateMagnitude[point] * prefactor);
+
+        real const totalXY = initialStress[3][point] + xyStress[point];
+        real const totalXZ = initialStress[5][point] + xzStress[point];
+        tractionXY[point] = -(totalXY / shearStress[point]) * localMu[point] * normalStress[point] - initialStress[3][point];
+        tractionXZ[point] = -(totalXZ / shearStress[point]) * localMu[point] * normalStress[point] - initialStress[5][point];
+
+        slip[point] += slipRateMagnitude[point] * dt;
+
+        real sr1 = -invZ * (tractionXY[point] - xyStress[point]);
+        real sr2 = -invZ * (tractionXZ[point] - xzStress[point]);
+        // correct the slip rate components to avoid numerical errors
+        real const magnitude = std::sqrt(sr1 * sr1 + sr2 * sr2);
+        if (magnitude != 0.0) {
+          sr1 = slipRateMagnitude[point] * sr1 / magnitude;
+          sr2 = slipRateMagnitude[point] * sr2 / magnitude;
+        }
+        slipRate1[point] = sr1;
+        slipRate2[point] = sr2;
+        slip1[point] += sr1 * dt;
+        slip2[point] += sr2 * dt;
+
+        tractionResults.xy[timeIndex][point] = tractionXY[point];
+        tractionResults.xz[timeIndex][point] = tractionXZ[point];
+      }
+    }
+
+    for (unsigned point = 0; point < numberOfPoints; ++point) {
+      if (std::isnan(localStateVariable[point])) {
+        logError() << "NaN detected in the rate and state friction solver at time" << fullUpdateTime;
+      }
+    }
+
+    real* ruptureTime = layerData.var(dynRup->ruptureTime)[ltsFace];
+    real* dynStressTime = layerData.var(dynRup->dynStressTime)[ltsFace];
+    real* peakSlipRate = layerData.var(dynRup->peakSlipRate)[ltsFace];
+    bool* ruptureTimePending = layerData.var(dynRup->ruptureTimePending)[ltsFace];
+    bool* dynStressTimePending = layerData.var(dynRup->dynStressTimePending)[ltsFace];
+
+    this->saveRuptureFrontAndPeakSlipRate(
+        slipRateMagnitude, ruptureTime, ruptureTimePending, peakSlipRate, fullUpdateTime);
+
+    // time when the friction coefficient has dropped to the dynamic level after rupture arrived,
+    // evaluated with the friction coefficient of the previous time step
+    real const muThreshold = rs.muW + 0.05 * (rs.f0 - rs.muW);
+    for (unsigned point = 0; point < numberOfPoints; ++point) {
+      if (ruptureTime[point] > 0.0 && ruptureTime[point] <= fullUpdateTime && dynStressTimePending[point] &&
+          mu[point] <= muThreshold) {
+        dynStressTime[point] = fullUpdateTime;
+        dynStressTimePending[point] = false;
+      }
+    }
+
+    std::copy(localMu, localMu + numPaddedPoints, mu);
+    if constexpr (StateLaw::resampleStateVariable) {
+      alignas(ALIGNMENT) real deltaStateVariable[numPaddedPoints] = {};
+      alignas(ALIGNMENT) real resampledDeltaStateVariable[numPaddedPoints];
+      for (unsigned point = 0; point < numberOfPoints; ++point) {
+        deltaStateVariable[point] = localStateVariable[point] - stateVariable[point];
+      }
+      this->resample(deltaStateVariable, resampledDeltaStateVariable);
+      for (unsigned point = 0; point < numberOfPoints; ++point) {
+        stateVariable[point] =
+            std::max(static_cast<real>(0.0), stateVariable[point] + resampledDeltaStateVariable[point]);
+      }
+    } else {
+      std::copy(localStateVariable, localStateVariable + numPaddedPoints, stateVariable);
+    }
+
+    // The slip rate never vanishes with rate and state friction, hence a face is active once the rupture arrived
+    return *std::max_element(slipRateMagnitude, slipRateMagnitude + numberOfPoints) > this->ruptureSlipRate;
+  }
+
+  private:
+  ThermalPressurization thermalPressurization;
+
+  /**
+   * Updates the pore pressure with the shear heating of the fault strength and the slip rate
+   * and recomputes the effective normal stress.
+   **/
+  void updatePorePressure(ThermalPressurizationFace const& tpFace,
+                          ThermalPressurizationSums const& tpSums,
+                          real const localMu[numPaddedPoints],
+                          real const slipRateMagnitude[numPaddedPoints],
+                          real const totalNormalStress[numPaddedPoints],
+                          real porePressure[numPaddedPoints],
+                          real heating[numPaddedPoints],
+                          real normalStress[numPaddedPoints]) const {
+#pragma omp simd
+    for (unsigned point = 0; point < numberOfPoints; ++point) {
+      real const strength = -localMu[point] * std::min(static_cast<real>(0.0), totalNormalStress[point] - porePressure[point]);
+      heating[point] = strength * slipRateMagnitude[point];
+    }
+    thermalPressurization.updateTemperatureAndPressure(tpFace, tpSums, heating, porePressure);
+#pragma omp simd
+    for (unsigned point = 0; point < numberOfPoints; ++point) {
+      normalStress[point] = std::min(static_cast<real>(0.0), totalNormalStress[point] - porePressure[point]);
+    }
+  }
+
+  /**
+   * Solves -invZ * (|normalStress| * mu(slipRate) - shearStress) - slipRate = 0 for the slip rate.
+   * As in the Fortran implementation, all points are iterated until the largest residual is below the tolerance.
+   **/
+  static void invertSlipRateIterative(RateAndStateParameters const& rs,
+                                      real const slipRateMagnitude[numPaddedPoints],
+                                      real const localStateVariable[numPaddedPoints],
+                                      real const normalStress[numPaddedPoints],
+                                      real const shearStress[numPaddedPoints],
+                                      real invZ,
+                                      real slipRateTest[numPaddedPoints]) {
+    alignas(ALIGNMENT) real prefactor[numPaddedPoints];
+    alignas(ALIGNMENT) real correction[numPaddedPoints];
+
+#pragma omp simd
+    for (unsigned point = 0; point < numberOfPoints; ++point) {
+      slipRateTest[point] = slipRateMagnitude[point];
+      prefactor[point] = StateLaw::frictionPrefactor(rs, point, localStateVariable[point]);
+    }
+
+    for (unsigned i = 0; i < numberOfSlipRateUpdates; ++i) {
+      real maxResidual = 0.0;
+#pragma omp simd reduction(max:maxResidual)
+      for (unsigned point = 0; point < numberOfPoints; ++point) {
+        real const x = prefactor[point] * slipRateTest[point];
+        real const muF = rs.a[point] * std::asinh(x);
+        real const dMuF = rs.a[point] / std::sqrt(1.0 + x * x) * prefactor[point];
+        real const residual = -invZ * (std::abs(normalStress[point]) * muF - shearStress[point]) - slipRateTest[point];
+        real const dResidual = -invZ * (std::abs(normalStress[point]) * dMuF) - 1.0;
+        correction[point] = residual / dResidual;
+        maxResidual = std::max(maxResidual, std::abs(residual));
+      }
+      if (maxResidual < newtonTolerance) {
+        return;
+      }
+#pragma omp simd
+      for (unsigned point = 0; point < numberOfPoints; ++point) {
+        slipRateTest[point] = std::max(almostZero, slipRateTest[point] - correction[point]);
+      }
+    }
+  }
+};
+
+using AgingLawRateAndState = RateAndState<AgingLaw>;
+using SlipLawRateAndState = RateAndState<SlipLaw>;
+using FastVelocityWeakeningRateAndState = RateAndState<FastVelocityWeakeningLaw>;
+} // namespace seissol::dr::friction_law
+
+#endif // SEISSOL_DR_RATEANDSTATE_H
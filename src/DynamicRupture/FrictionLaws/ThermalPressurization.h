@@ -0,0 +1,159 @@
+#ifndef SEISSOL_DR_THERMALPRESSURIZATION_H
+#define SEISSOL_DR_THERMALPRESSURIZATION_H
+
+#include <cmath>
+
+#include <DynamicRupture/Misc.h>
+#include <DynamicRupture/Parameters.h>
+#include <Kernels/precision.hpp>
+
+namespace seissol::dr::friction_law {
+//! Thermal pressurization state and parameters of a single face
+struct ThermalPressurizationFace {
+  real* temperature;
+  real* pressure;
+  //! Fourier coefficients of the temperature
+  real (*theta)[numPaddedPoints];
+  //! Fourier coefficients of the pore pressure + lambda' * temperature
+  real (*sigma)[numPaddedPoints];
+  real const* halfWidthShearZone;
+  real const* alphaHy;
+};
+
+/**
+ * Temperature and pore pressure at the end of a time step, split into the diffusion of the stored
+ * Fourier coefficients and the contribution of a unit shear heating.
+ **/
+struct ThermalPressurizationSums {
+  alignas(ALIGNMENT) real temperatureDiffusion[numPaddedPoints];
+  alignas(ALIGNMENT) real temperatureSource[numPaddedPoints];
+  alignas(ALIGNMENT) real sigmaDiffusion[numPaddedPoints];
+  alignas(ALIGNMENT) real sigmaSource[numPaddedPoints];
+  alignas(ALIGNMENT) real lambdaPrime[numPaddedPoints];
+};
+
+/**
+ * Thermal pressurization following Noda and Lapusta (2010), see Calc_ThermalPressure in thermalpressure.f90.
+ *
+ * Temperature and pore pressure diffuse normal to the fault and are stored as Fourier coefficients.
+ * Within a time step, the diffused coefficients and the heat source only depend on the shear heating
+ * through a factor, hence computeSums reduces them once per time step and every evaluation of the
+ * pore pressure in the rate and state iterations is independent of the number of wavenumbers.
+ **/
+class ThermalPressurization {
+  public:
+  //! grid spacing of the logarithmic wavenumber grid (TP_log_dz in readpar.f90)
+  static constexpr double logGridSpacing = 0.3;
+  //! largest wavenumber (TP_max_wavenumber in readpar.f90)
+  static constexpr double maxWavenumber = 10.0;
+
+  explicit ThermalPressurization(DRParameters const& drParameters)
+      : alphaTh(drParameters.tpAlphaTh), rhoC(drParameters.tpRhoC), lambda(drParameters.tpLambda),
+        initialTemperature(drParameters.tpInitialTemperature), initialPressure(drParameters.tpInitialPressure) {
+    // see thermalPress_init in ini_model_DR.f90 and heat_source in thermalpressure.f90
+    double const pi = std::acos(-1.0);
+    for (unsigned z = 0; z < numberOfTPGridPoints; ++z) {
+      double const k = maxWavenumber * std::exp(-logGridSpacing * (numberOfTPGridPoints - 1 - z));
+      double weight = logGridSpacing;
+      if (z == 0) {
+        weight = 1.0 + 0.5 * logGridSpacing;
+      } else if (z == numberOfTPGridPoints - 1) {
+        weight = 0.5 * logGridSpacing;
+      }
+      wavenumber[z] = k;
+      inverseFourierCoefficient[z] = std::sqrt(2.0 / pi) * k * weight;
+      heatSource[z] = std::exp(-0.5 * k * k) / std::sqrt(2.0 * pi);
+    }
+  }
+
+  /**
+   * Diffuses the stored Fourier coefficients over dt and transforms them back to the fault, separately for the
+   * stored coefficients and a unit heat source.
+   **/
+  void computeSums(ThermalPressurizationFace const& face, real dt, ThermalPressurizationSums& sums) const {
+#pragma omp simd
+    for (unsigned point = 0; point < numberOfPoints; ++point) {
+      sums.temperatureDiffusion[point] = 0.0;
+      sums.temperatureSource[point] = 0.0;
+      sums.sigmaDiffusion[point] = 0.0;
+      sums.sigmaSource[point] = 0.0;
+      sums.lambdaPrime[point] = lambda * alphaTh / (face.alphaHy[point] - alphaTh);
+    }
+    for (unsigned z = 0; z < numberOfTPGridPoints; ++z) {
+#pragma omp simd
+      for (unsigned point = 0; point < numberOfPoints; ++point) {
+        real const invWidth = 1.0 / face.halfWidthShearZone[point];
+        real const k2 = wavenumber[z] * wavenumber[z] * invWidth * invWidth;
+        // expm1 avoids the cancellation of 1 - exp(-x) in the heat source for small wavenumbers
+        real const decayTh = std::expm1(-alphaTh * dt * k2);
+        real const decayHy = std::expm1(-face.alphaHy[point] * dt * k2);
+        real const coefficient = inverseFourierCoefficient[z] * invWidth;
+        sums.temperatureDiffusion[point] += coefficient * face.theta[z][point] * (1.0 + decayTh);
+        sums.sigmaDiffusion[point] += coefficient * face.sigma[z][point] * (1.0 + decayHy);
+        sums.temperatureSource[point] -= coefficient * heatSource[z] / (alphaTh * k2 * rhoC) * decayTh;
+        sums.sigmaSource[point] -= coefficient * heatSource[z] / (face.alphaHy[point] * k2 * rhoC) * decayHy;
+      }
+    }
+#pragma omp simd
+    for (unsigned point = 0; point < numberOfPoints; ++point) {
+      sums.sigmaSource[point] *= lambda + sums.lambdaPrime[point];
+    }
+  }
+
+  /**
+   * Stores temperature and pore pressure at the end of the time step for the shear heating
+   * (shear stress times slip rate) and returns the pore pressure in porePressure.
+   **/
+  void updateTemperatureAndPressure(ThermalPressurizationFace const& face,
+                                    ThermalPressurizationSums const& sums,
+                                    real const heating[numPaddedPoints],
+                                    real porePressure[numPaddedPoints]) const {
+#pragma omp simd
+    for (unsigned point = 0; point < numberOfPoints; ++point) {
+      real const temperatureChange = sums.temperatureDiffusion[point] + heating[point] * sums.temperatureSource[point];
+      real const pressureChange = sums.sigmaDiffusion[point] + heating[point] * sums.sigmaSource[point] -
+                                  sums.lambdaPrime[point] * temperatureChange;
+      face.temperature[point] = temperatureChange + initialTemperature;
+      face.pressure[point] = -pressureChange + initialPressure;
+      porePressure[point] = face.pressure[point];
+    }
+  }
+
+  //! Advances the stored Fourier coefficients over dt with the final shear heating of the time step.
+  void updateSpectrum(ThermalPressurizationFace const& face, real dt, real const heating[numPaddedPoints]) const {
+    alignas(ALIGNMENT) real lambdaSum[numPaddedPoints];
+#pragma omp simd
+    for (unsigned point = 0; point < numberOfPoints; ++point) {
+      lambdaSum[point] = lambda + lambda * alphaTh / (face.alphaHy[point] - alphaTh);
+    }
+    for (unsigned z = 0; z < numberOfTPGridPoints; ++z) {
+#pragma omp simd
+      for (unsigned point = 0; point < numberOfPoints; ++point) {
+        real const invWidth = 1.0 / face.halfWidthShearZone[point];
+        real const k2 = wavenumber[z] * wavenumber[z] * invWidth * invWidth;
+        real const decayTh = std::expm1(-alphaTh * dt * k2);
+        real const decayHy = std::expm1(-face.alphaHy[point] * dt * k2);
+        real const sourceTh = -heatSource[z] / (alphaTh * k2 * rhoC) * decayTh;
+        real const sourceHy = -lambdaSum[point] * heatSource[z] / (face.alphaHy[point] * k2 * rhoC) * decayHy;
+        face.theta[z][point] = face.theta[z][point] * (1.0 + decayTh) + heating[point] * sourceTh;
+        face.sigma[z][point] = face.sigma[z][point] * (1.0 + decayHy) + heating[point] * sourceHy;
+      }
+    }
+  }
+
+  private:
+  real alphaTh;
+  real rhoC;
+  real lambda;
+  real initialTemperature;
+  real initialPressure;
+  //! wavenumbers normalized by the half width of the shear zone (TP_grid)
+  real wavenumber[numberOfTPGridPoints];
+  //! weights of the inverse Fourier transform (TP_DFinv)
+  real inverseFourierCoefficient[numberOfTPGridPoints];
+  //! Gaussian shear zone in the wavenumber domain
+  real heatSource[numberOfTPGridPoints];
+};
+} // namespace seissol::dr::friction_law
+
+#endif // SEISSOL_DR_THERMALPRESSURIZATION_H
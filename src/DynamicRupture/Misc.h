@@ -0,0 +1,65 @@
+#ifndef SEISSOL_DR_MISC_H
+#define SEISSOL_DR_MISC_H
+
+#include <cmath>
+#include <generated_code/init.h>
+#include <generated_code/tensor.h>
+
+namespace seissol::dr {
+//! number of Gauss points on a fault face
+constexpr unsigned numberOfPoints = tensor::QInterpolated::Shape[0];
+//! leading dimension of QInterpolated and of all per-face friction arrays
+constexpr unsigned numPaddedPoints = init::QInterpolated::Stop[0] - init::QInterpolated::Start[0];
+
+static_assert(numPaddedPoints >= numberOfPoints, "Padded number of points must not be smaller than number of points.");
+
+//! number of wavenumbers of the thermal pressurization solver (TP_grid_nz in readpar.f90)
+constexpr unsigned numberOfTPGridPoints = 60;
+
+namespace misc {
+/**
+ * Smooth step function which is zero for t <= 0 and one for t >= tau.
+ * Corresponds to Calc_SmoothStep in NucleationFunctions.f90.
+ **/
+inline double smoothStep(double time, double tau) {
+  if (time <= 0.0) {
+    return 0.0;
+  }
+  if (time < tau) {
+    return std::exp((time - tau) * (time - tau) / (time * (time - 2.0 * tau)));
+  }
+  return 1.0;
+}
+
+/**
+ * Increment of the smooth step function in [time - dt, time].
+ * Corresponds to Calc_SmoothStepIncrement in NucleationFunctions.f90.
+ **/
+inline double smoothStepIncrement(double time, double tau, double dt) {
+  if (time <= 0.0 || time > tau) {
+    return 0.0;
+  }
+  double increment = smoothStep(time, tau);
+  const double previousTime = time - dt;
+  if (previousTime > 0.0) {
+    increment -= smoothStep(previousTime, tau);
+  }
+  return increment;
+}
+
+/**
+ * Computes the time step widths between the temporal quadrature points.
+ * The last segment is extended such that the widths add up to the time step width.
+ **/
+template <unsigned N>
+inline void computeDeltaT(double const timePoints[N], double deltaT[N]) {
+  deltaT[0] = timePoints[0];
+  for (unsigned timeIndex = 1; timeIndex < N; ++timeIndex) {
+    deltaT[timeIndex] = timePoints[timeIndex] - timePoints[timeIndex - 1];
+  }
+  deltaT[N - 1] += deltaT[0];
+}
+} // namespace misc
+} // namespace seissol::dr
+
+#endif // SEISSOL_DR_MISC_H
@@ -0,0 +1,41 @@
+#ifndef SEISSOL_DR_PARAMETERS_H
+#define SEISSOL_DR_PARAMETERS_H
+
+namespace seissol::dr {
+/**
+ * Friction law settings of the DynamicRupture namelist which are needed by the C++ friction solvers.
+ **/
+struct DRParameters {
+  //! friction law (FL in the parameter file)
+  int frictionLaw = 0;
+  //! nucleation time (FL 2, 3, 4, 103) or forced rupture decay time (FL 16)
+  double t0 = 0.0;
+  //! reference friction coefficient of rate and state friction
+  double rsF0 = 0.0;
+  //! reference slip rate of rate and state friction
+  double rsSr0 = 0.0;
+  //! evolution effect of rate and state friction
+  double rsB = 0.0;
+  //! weakening friction coefficient of fast velocity weakening
+  double muW = 0.0;
+  //! thermal diffusivity of thermal pressurization
+  double tpAlphaTh = 0.0;
+  //! specific heat of thermal pressurization
+  double tpRhoC = 0.0;
+  //! pore pressure change per unit temperature of thermal pressurization
+  double tpLambda = 0.0;
+  //! initial temperature of thermal pressurization
+  double tpInitialTemperature = 0.0;
+  //! initial pore pressure of thermal pressurization
+  double tpInitialPressure = 0.0;
+  bool isInstantaneousHealingOn = false;
+  bool isThermalPressureOn = false;
+  bool isRuptureFrontOutputOn = false;
+  bool isDynamicStressOutputOn = false;
+  bool isMagnitudeOutputOn = false;
+  //! true if the friction law is evaluated by the C++ friction solvers instead of Fortran
+  bool isNativeSolverEnabled = false;
+};
+} // namespace seissol::dr
+
+#endif // SEISSOL_DR_PARAMETERS_H
@@ -43,8 +43,12 @@
 
 #include <Eigen/Eigen>
 #include <Eigen/Eigenvalues>
+#include <algorithm>
+#include <cmath>
+#include <limits>
 
 #include <Model/common.hpp>
+#include <Equations/elastic/Model/ElasticSetup.h>
 #include <Kernels/common.hpp>
 #include <Numerical_aux/Transformation.h>
 #include <generated_code/init.h>
@@ -250,12 +254,41 @@ namespace seissol {
         -eigenvectorsLocal*lambdaLocal, Matrix33::Zero(),      eigenvectorsNeighbor*lambdaNeighbor;
     }
 
-    template<>
-    inline void getTransposedGodunovState( AnisotropicMaterial const&       local,
-                                           AnisotropicMaterial const&       neighbor,
-                                           FaceType                         faceType,
-                                           init::QgodLocal::view::type&     QgodLocal,
-                                           init::QgodNeighbor::view::type&  QgodNeighbor )
+    /**
+     * Checks whether the stiffness tensor is isotropic up to the precision of real
+     * (independent of the orientation, thus also for rotated materials).
+     * On success, elastic holds the equivalent isotropic material.
+     **/
+    inline bool getIsotropicMaterial( AnisotropicMaterial const& material,
+                                      ElasticMaterial&           elastic )
+      {
+        const double lambda = material.c12;
+        const double mu = material.c44;
+        const double scale = std::max(std::abs(material.c11), std::abs(material.c44));
+        const double tolerance = std::sqrt(std::numeric_limits<real>::epsilon()) * scale;
+        auto equals = [&](double value, double expected) { return std::abs(value - expected) <= tolerance; };
+
+        const bool isotropic = equals(material.c11, lambda + 2*mu) && equals(material.c22, lambda + 2*mu) &&
+                               equals(material.c33, lambda + 2*mu) && equals(material.c13, lambda) &&
+                               equals(material.c23, lambda) && equals(material.c55, mu) && equals(material.c66, mu) &&
+                               equals(material.c14, 0) && equals(material.c15, 0) && equals(material.c16, 0) &&
+                               equals(material.c24, 0) && equals(material.c25, 0) && equals(material.c26, 0) &&
+                               equals(material.c34, 0) && equals(material.c35, 0) && equals(material.c36, 0) &&
+                               equals(material.c45, 0) && equals(material.c46, 0) && equals(material.c56, 0);
+        if (isotropic) {
+          elastic.rho = material.rho;
+          elastic.lambda = lambda;
+          elastic.mu = mu;
+        }
+        return isotropic;
+      }
+
+    //! Godunov state from the eigen decomposition of the anisotropic coefficient matrices
+    inline void getTransposedAnisotropicGodunovState( AnisotropicMaterial const&       local,
+                                                      AnisotropicMaterial const&       neighbor,
+                                                      FaceType                         faceType,
+                                                      init::QgodLocal::view::type&     QgodLocal,
+                                                      init::QgodNeighbor::view::type&  QgodNeighbor )
       {
 
         Matrix99 R = Matrix99::Zero();
@@ -285,6 +318,24 @@ namespace seissol {
         }
       }
 
+    template<>
+    inline void getTransposedGodunovState( AnisotropicMaterial const&       local,
+                                           AnisotropicMaterial const&       neighbor,
+                                           FaceType                         faceType,
+                                           init::QgodLocal::view::type&     QgodLocal,
+                                           init::QgodNeighbor::view::type&  QgodNeighbor )
+      {
+        // Most faces of weakly anisotropic models are isotropic on both sides,
+        // where the eigenvectors are known in closed form
+        ElasticMaterial localIsotropic;
+        ElasticMaterial neighborIsotropic;
+        if (getIsotropicMaterial(local, localIsotropic) && getIsotropicMaterial(neighbor, neighborIsotropic)) {
+          getTransposedGodunovState(localIsotropic, neighborIsotropic, faceType, QgodLocal, QgodNeighbor);
+        } else {
+          getTransposedAnisotropicGodunovState(local, neighbor, faceType, QgodLocal, QgodNeighbor);
+        }
+      }
+
     inline AnisotropicMaterial getRotatedMaterialCoefficients(real rotationParameters[36], AnisotropicMaterial& material) {
         AnisotropicMaterial rotatedMaterial;
         rotatedMaterial.rho = material.rho;
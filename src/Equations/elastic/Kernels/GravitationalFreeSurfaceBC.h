@@ -80,11 +80,7 @@ public:
     rotateFaceDisplacementKrnl.rotatedFaceDisplacement = rotatedFaceDisplacementData;
     rotateFaceDisplacementKrnl.execute();
 
-    // Temporary buffer to store dofs at some time t
-    alignas(ALIGNMENT) real dofsVolumeInteriorModalStorage[tensor::I::size()];
-    auto dofsVolumeInteriorModal = init::I::view::create(dofsVolumeInteriorModalStorage);
-
-    // Temporary buffer to store nodal face dofs at some time t
+    // Temporary buffer to store nodal face dofs at some time t (overwritten by the projection kernel)
     alignas(ALIGNMENT) real dofsFaceNodalStorage[tensor::INodal::size()];
     auto dofsFaceNodal = init::INodal::view::create(dofsFaceNodalStorage);
 
@@ -119,9 +115,6 @@ public:
 
     // Note: Probably need to increase CONVERGENCE_ORDER by 1 here!
     for (int order = 1; order < CONVERGENCE_ORDER+1; ++order) {
-      dofsVolumeInteriorModal.setZero();
-      dofsFaceNodal.setZero();
-
       projectKernel.execute(order - 1, faceIdx);
 
       factorEvaluated *= deltaT / (1.0 * order);
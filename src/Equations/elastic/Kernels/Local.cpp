@@ -44,6 +44,7 @@
 #include <yateto.h>
 
 
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <stdint.h>
@@ -55,9 +56,27 @@
 #pragma GCC diagnostic pop
 
 #include <Kernels/common.hpp>
+#include <Kernels/StarMatrices.h>
+
+#ifdef ACL_DEVICE
+#include <Kernels/DeviceContext.h>
+#endif
+
 GENERATE_HAS_MEMBER(ET)
 GENERATE_HAS_MEMBER(sourceMatrix)
 
+namespace {
+bool useFusedIntegral([[maybe_unused]] FaceType const faceTypes[4]) {
+#ifdef USE_FUSED_LOCAL_INTEGRAL
+  return std::none_of(faceTypes, faceTypes + 4, [](FaceType faceType) {
+    return faceType == FaceType::dynamicRupture;
+  });
+#else
+  return false;
+#endif
+}
+} // namespace
+
 void seissol::kernels::LocalBase::checkGlobalData(GlobalData const* global, size_t alignment) {
 #ifndef NDEBUG
   for (unsigned stiffness = 0; stiffness < 3; ++stiffness) {
@@ -75,6 +94,11 @@ void seissol::kernels::Local::setHostGlobalData(GlobalData const* global) {
   m_volumeKernelPrototype.kDivM = global->stiffnessMatrices;
   m_localFluxKernelPrototype.rDivM = global->changeOfBasisMatrices;
   m_localFluxKernelPrototype.fMrT = global->localChangeOfBasisMatricesTransposed;
+#ifdef USE_FUSED_LOCAL_INTEGRAL
+  m_volumeLocalFluxKernelPrototype.kDivM = global->stiffnessMatrices;
+  m_volumeLocalFluxKernelPrototype.rDivM = global->changeOfBasisMatrices;
+  m_volumeLocalFluxKernelPrototype.fMrT = global->localChangeOfBasisMatricesTransposed;
+#endif
 
   m_nodalLfKrnlPrototype.project2nFaceTo3m = global->project2nFaceTo3m;
 
@@ -108,38 +132,67 @@ void seissol::kernels::Local::computeIntegral(real i_timeIntegratedDegreesOfFree
   assert(reinterpret_cast<uintptr_t>(i_timeIntegratedDegreesOfFreedom) % ALIGNMENT == 0);
   assert(reinterpret_cast<uintptr_t>(data.dofs) % ALIGNMENT == 0);
 
-  kernel::volume volKrnl = m_volumeKernelPrototype;
-  volKrnl.Q = data.dofs;
-  volKrnl.I = i_timeIntegratedDegreesOfFreedom;
-  for (unsigned i = 0; i < yateto::numFamilyMembers<tensor::star>(); ++i) {
-    volKrnl.star(i) = data.localIntegration.starMatrices[i];
-  }
-
-  // Optional source term
-  set_ET(volKrnl, get_ptr_sourceMatrix(data.localIntegration.specific));
+  alignas(ALIGNMENT) kernels::StarMatrices starMatricesBuffer;
+  const auto& starMatrices = kernels::starMatricesOf(data.localIntegration, data.material, starMatricesBuffer);
 
   kernel::localFlux lfKrnl = m_localFluxKernelPrototype;
   lfKrnl.Q = data.dofs;
   lfKrnl.I = i_timeIntegratedDegreesOfFreedom;
   lfKrnl._prefetch.I = i_timeIntegratedDegreesOfFreedom + tensor::I::size();
   lfKrnl._prefetch.Q = data.dofs + tensor::Q::size();
-  
-  volKrnl.execute();
+
+  // The fused kernel applies the local flux of all four faces, hence it is restricted to cells without dynamic rupture faces
+  const bool fused = useFusedIntegral(data.cellInformation.faceTypes);
+#ifdef USE_FUSED_LOCAL_INTEGRAL
+  if (fused) {
+    kernel::volumeLocalFlux fusedKrnl = m_volumeLocalFluxKernelPrototype;
+    fusedKrnl.Q = data.dofs;
+    fusedKrnl.I = i_timeIntegratedDegreesOfFreedom;
+    for (unsigned i = 0; i < yateto::numFamilyMembers<tensor::star>(); ++i) {
+      fusedKrnl.star(i) = starMatrices[i];
+    }
+    set_ET(fusedKrnl, get_ptr_sourceMatrix(data.localIntegration.specific));
+    alignas(ALIGNMENT) real fluxSolvers[4][tensor::AplusT::size()];
+    for (unsigned face = 0; face < 4; ++face) {
+      fusedKrnl.AplusTFace(face) = fluxSolverOf(data.localIntegration.nApNm1[face], fluxSolvers[face]);
+    }
+    fusedKrnl.execute();
+  }
+#endif
+  if (!fused) {
+    kernel::volume volKrnl = m_volumeKernelPrototype;
+    volKrnl.Q = data.dofs;
+    volKrnl.I = i_timeIntegratedDegreesOfFreedom;
+    for (unsigned i = 0; i < yateto::numFamilyMembers<tensor::star>(); ++i) {
+      volKrnl.star(i) = starMatrices[i];
+    }
+
+    // Optional source term
+    set_ET(volKrnl, get_ptr_sourceMatrix(data.localIntegration.specific));
+
+    volKrnl.execute();
+  }
 
   for (int face = 0; face < 4; ++face) {
     // no element local contribution in the case of dynamic rupture boundary conditions
-    if (data.cellInformation.faceTypes[face] != FaceType::dynamicRupture) {
-      lfKrnl.AplusT = data.localIntegration.nApNm1[face];
+    if (!fused && data.cellInformation.faceTypes[face] != FaceType::dynamicRupture) {
+      alignas(ALIGNMENT) real fluxSolver[tensor::AplusT::size()];
+      lfKrnl.AplusT = fluxSolverOf(data.localIntegration.nApNm1[face], fluxSolver);
       lfKrnl.execute(face);
     }
 
     alignas(ALIGNMENT) real dofsFaceBoundaryNodal[tensor::INodal::size()];
+    alignas(ALIGNMENT) real neighborFluxSolver[tensor::AminusT::size()];
     auto nodalLfKrnl = m_nodalLfKrnlPrototype;
     nodalLfKrnl.Q = data.dofs;
     nodalLfKrnl.INodal = dofsFaceBoundaryNodal;
     nodalLfKrnl._prefetch.I = i_timeIntegratedDegreesOfFreedom + tensor::I::size();
     nodalLfKrnl._prefetch.Q = data.dofs + tensor::Q::size();
-    nodalLfKrnl.AminusT = data.neighboringIntegration.nAmNm1[face];
+    // only the boundary conditions below use the flux solver
+    const bool hasNodalFlux = data.cellInformation.faceTypes[face] == FaceType::freeSurfaceGravity ||
+                              data.cellInformation.faceTypes[face] == FaceType::dirichlet ||
+                              data.cellInformation.faceTypes[face] == FaceType::analytical;
+    nodalLfKrnl.AminusT = hasNodalFlux ? fluxSolverOf(data.neighboringIntegration.nAmNm1[face], neighborFluxSolver) : nullptr;
 
     // Include some boundary conditions here.
     switch (data.cellInformation.faceTypes[face]) {
@@ -209,18 +262,15 @@ void seissol::kernels::Local::computeIntegral(real i_timeIntegratedDegreesOfFree
       case FaceType::analytical:
       {
       assert(cellBoundaryMapping != nullptr);
-      auto applyAnalyticalSolution = [materialData, this](const real* nodes,
+      // The nodes do not depend on time, hence they are converted once for all time points
+      const real* nodes = (*cellBoundaryMapping)[face].nodes;
+      auto nodesVec = std::vector<std::array<double, 3>>(tensor::INodal::Shape[0]);
+      for (unsigned int i = 0; i < tensor::INodal::Shape[0]; ++i) {
+        nodesVec[i] = {nodes[3 * i], nodes[3 * i + 1], nodes[3 * i + 2]};
+      }
+      auto applyAnalyticalSolution = [materialData, &nodesVec, this](const real*, // nodes are converted above
                                                     double time,
                                                     init::INodal::view::type& boundaryDofs) {
-          auto nodesVec = std::vector<std::array<double, 3>>{};
-          int offset = 0;
-          for (unsigned int i = 0; i < tensor::INodal::Shape[0]; ++i) {
-            auto curNode = std::array<double, 3>{};
-            curNode[0] = nodes[offset++];
-            curNode[1] = nodes[offset++];
-            curNode[2] = nodes[offset++];
-            nodesVec.push_back(curNode);
-          }
           assert(initConds != nullptr);
           // TODO(Lukas) Support multiple init. conds?
           assert(initConds->size() == 1);
@@ -263,7 +313,7 @@ void seissol::kernels::Local::computeBatchedIntegral(ConditionalBatchTableT &tab
     volKrnl.numElements = maxNumElements;
 
     // volume kernel always contains more elements than any local one
-    tmpMem = (real*)(device.api->getStackMemory(MAX_TMP_MEM * maxNumElements));
+    tmpMem = (real*)(DeviceContext::current().getTemporaryMemory(MAX_TMP_MEM * maxNumElements));
 
     volKrnl.Q = (entry.content[*EntityId::Dofs])->getPointers();
     volKrnl.I = const_cast<const real **>((entry.content[*EntityId::Idofs])->getPointers());
@@ -274,8 +324,11 @@ void seissol::kernels::Local::computeBatchedIntegral(ConditionalBatchTableT &tab
       volKrnl.extraOffset_star(i) = starOffset;
       starOffset += tensor::star::size(i);
     }
+#ifdef USE_POROELASTIC
+    volKrnl.ET = const_cast<const real **>((entry.content[*EntityId::SourceMatrix])->getPointers());
+#endif
     volKrnl.linearAllocator.initialize(tmpMem);
-    volKrnl.streamPtr = device.api->getDefaultStream();
+    volKrnl.streamPtr = DeviceContext::current().stream();
     volKrnl.execute();
   }
 
@@ -290,12 +343,12 @@ void seissol::kernels::Local::computeBatchedIntegral(ConditionalBatchTableT &tab
       localFluxKrnl.I = const_cast<const real **>((entry.content[*EntityId::Idofs])->getPointers());
       localFluxKrnl.AplusT = const_cast<const real **>(entry.content[*EntityId::AplusT]->getPointers());
       localFluxKrnl.linearAllocator.initialize(tmpMem);
-      localFluxKrnl.streamPtr = device.api->getDefaultStream();
+      localFluxKrnl.streamPtr = DeviceContext::current().stream();
       localFluxKrnl.execute(face);
     }
   }
   if (tmpMem != nullptr) {
-    device.api->popStackMemory();
+    DeviceContext::current().popTemporaryMemory();
   }
 #else
   assert(false && "no implementation provided");
@@ -306,13 +359,22 @@ void seissol::kernels::Local::flopsIntegral(FaceType const i_faceTypes[4],
                                             unsigned int &o_nonZeroFlops,
                                             unsigned int &o_hardwareFlops)
 {
-  o_nonZeroFlops = seissol::kernel::volume::NonZeroFlops;
-  o_hardwareFlops = seissol::kernel::volume::HardwareFlops;
+  const bool fused = useFusedIntegral(i_faceTypes);
+#ifdef USE_FUSED_LOCAL_INTEGRAL
+  if (fused) {
+    o_nonZeroFlops = seissol::kernel::volumeLocalFlux::NonZeroFlops;
+    o_hardwareFlops = seissol::kernel::volumeLocalFlux::HardwareFlops;
+  }
+#endif
+  if (!fused) {
+    o_nonZeroFlops = seissol::kernel::volume::NonZeroFlops;
+    o_hardwareFlops = seissol::kernel::volume::HardwareFlops;
+  }
 
   for( unsigned int face = 0; face < 4; ++face ) {
     // Local flux is executed for all faces that are not dynamic rupture.
     // For those cells, the flux is taken into account during the neighbor kernel.
-    if (i_faceTypes[face] != FaceType::dynamicRupture) {
+    if (!fused && i_faceTypes[face] != FaceType::dynamicRupture) {
       o_nonZeroFlops += seissol::kernel::localFlux::nonZeroFlops(face);
       o_hardwareFlops += seissol::kernel::localFlux::hardwareFlops(face);
     }
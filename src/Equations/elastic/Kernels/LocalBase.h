@@ -66,6 +66,9 @@ class seissol::kernels::LocalBase {
     kernel::volume m_volumeKernelPrototype;
     kernel::localFlux m_localFluxKernelPrototype;
     kernel::localFluxNodal m_nodalLfKrnlPrototype;
+#ifdef USE_FUSED_LOCAL_INTEGRAL
+    kernel::volumeLocalFlux m_volumeLocalFluxKernelPrototype;
+#endif
 
     kernel::projectToNodalBoundary m_projectKrnlPrototype;
     kernel::projectToNodalBoundaryRotated m_projectRotatedKrnlPrototype;
@@ -71,6 +71,10 @@
 
 #include "Kernels/Neighbor.h"
 
+#ifdef ACL_DEVICE
+#include <Kernels/DeviceContext.h>
+#endif
+
 #include <cassert>
 #include <stdint.h>
 
@@ -137,7 +141,8 @@ void seissol::kernels::Neighbor::computeNeighborsIntegral(NeighborData& data,
       kernel::neighboringFlux nfKrnl = m_nfKrnlPrototype;
       nfKrnl.Q = data.dofs;
       nfKrnl.I = i_timeIntegrated[l_face];
-      nfKrnl.AminusT = data.neighboringIntegration.nAmNm1[l_face];
+      alignas(ALIGNMENT) real fluxSolver[tensor::AminusT::size()];
+      nfKrnl.AminusT = fluxSolverOf(data.neighboringIntegration.nAmNm1[l_face], fluxSolver);
       nfKrnl._prefetch.I = faceNeighbors_prefetch[l_face];
       nfKrnl.execute(data.cellInformation.faceRelations[l_face][1],
 		     data.cellInformation.faceRelations[l_face][0],
@@ -171,16 +176,27 @@ void seissol::kernels::Neighbor::computeBatchedNeighborsIntegral(ConditionalBatc
   dynamicRupture::kernel::gpu_nodalFlux drKrnl = deviceDrKrnlPrototype;
 
   real* tmpMem = nullptr;
+  // a cluster with an own stream keeps all kernels in its stream, such that the host does not need to wait
+  auto& context = DeviceContext::current();
+  const bool useCircularStreams = !context.hasOwnStream();
+  auto nextStream = [&]() {
+    return useCircularStreams ? device.api->getNextCircularStream() : context.stream();
+  };
+
   device.api->resetCircularStreamCounter();
-  auto resetDeviceCurrentState = [this](size_t counter) {
+  auto resetDeviceCurrentState = [&](size_t counter) {
     for (size_t i = 0; i < counter; ++i) {
-      this->device.api->popStackMemory();
+      context.popTemporaryMemory();
+    }
+    if (useCircularStreams) {
+      this->device.api->fastStreamsSync();
+      this->device.api->resetCircularStreamCounter();
     }
-    this->device.api->fastStreamsSync();
-    this->device.api->resetCircularStreamCounter();
   };
 
-  device.api->fastStreamsSync(); // finish all previous work in the default stream
+  if (useCircularStreams) {
+    device.api->fastStreamsSync(); // finish all previous work in the default stream
+  }
   for(size_t face = 0; face < 4; face++) {
     size_t streamCounter{0};
 
@@ -202,10 +218,10 @@ void seissol::kernels::Neighbor::computeBatchedNeighborsIntegral(ConditionalBatc
         neighFluxKrnl.I = const_cast<const real **>((entry.content[*EntityId::Idofs])->getPointers());
         neighFluxKrnl.AminusT = const_cast<const real **>((entry.content[*EntityId::AminusT])->getPointers());
 
-        tmpMem = (real*)(device.api->getStackMemory(neighFluxKrnl.TmpMaxMemRequiredInBytes * NUM_ELEMENTS));
+        tmpMem = (real*)(context.getTemporaryMemory(neighFluxKrnl.TmpMaxMemRequiredInBytes * NUM_ELEMENTS));
         neighFluxKrnl.linearAllocator.initialize(tmpMem);
 
-        neighFluxKrnl.streamPtr = device.api->getNextCircularStream();
+        neighFluxKrnl.streamPtr = nextStream();
         (neighFluxKrnl.*neighFluxKrnl.ExecutePtrs[faceRelation])();
         ++streamCounter;
       }
@@ -229,10 +245,10 @@ void seissol::kernels::Neighbor::computeBatchedNeighborsIntegral(ConditionalBatc
         drKrnl.QInterpolated = const_cast<real const**>((entry.content[*EntityId::Godunov])->getPointers());
         drKrnl.Q = (entry.content[*EntityId::Dofs])->getPointers();
 
-        tmpMem = (real*)(device.api->getStackMemory(drKrnl.TmpMaxMemRequiredInBytes * NUM_ELEMENTS));
+        tmpMem = (real*)(context.getTemporaryMemory(drKrnl.TmpMaxMemRequiredInBytes * NUM_ELEMENTS));
         drKrnl.linearAllocator.initialize(tmpMem);
 
-        drKrnl.streamPtr = device.api->getNextCircularStream();
+        drKrnl.streamPtr = nextStream();
         (drKrnl.*drKrnl.ExecutePtrs[faceRelation])();
         ++streamCounter;
       }
@@ -245,7 +261,7 @@ void seissol::kernels::Neighbor::computeBatchedNeighborsIntegral(ConditionalBatc
 }
 
 void seissol::kernels::Neighbor::flopsNeighborsIntegral(const FaceType i_faceTypes[4],
-                                                        const int i_neighboringIndices[4][2],
+                                                        const std::int8_t i_neighboringIndices[4][2],
                                                         CellDRMapping const (&cellDrMapping)[4],
                                                         unsigned int &o_nonZeroFlops,
                                                         unsigned int &o_hardwareFlops,
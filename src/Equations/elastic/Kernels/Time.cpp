@@ -84,6 +84,14 @@ extern long long libxsmm_num_total_flops;
 
 #include <Kernels/common.hpp>
 #include <Kernels/denseMatrixOps.hpp>
+#include <Kernels/StarMatrices.h>
+
+#ifdef ACL_DEVICE
+#include <Kernels/DeviceContext.h>
+#ifdef USE_RECOMPUTED_STAR_MATRICES
+#include <Kernels/DeviceAux/StarMatricesAux.h>
+#endif
+#endif
 
 #include <cstring>
 #include <cassert>
@@ -95,6 +103,30 @@ extern long long libxsmm_num_total_flops;
 GENERATE_HAS_MEMBER(ET)
 GENERATE_HAS_MEMBER(sourceMatrix)
 
+#if defined(ACL_DEVICE) && defined(USE_RECOMPUTED_STAR_MATRICES)
+namespace {
+using namespace seissol::kernels::device::aux::star_matrices;
+
+//! Positions of the entries of A^T, B^T and C^T in the storage of a star matrix
+StarMatrixLayout starMatrixLayout() {
+  // (row, column) of the entries, in the order of getTransposedCoefficientMatrix in Equations/elastic/Model/ElasticSetup.h
+  constexpr unsigned Entries[3][NUM_ENTRIES][2] = {{{6, 0}, {6, 1}, {6, 2}, {7, 3}, {8, 5}, {0, 6}, {3, 7}, {5, 8}},
+                                                   {{7, 0}, {7, 1}, {7, 2}, {6, 3}, {8, 4}, {1, 7}, {3, 6}, {4, 8}},
+                                                   {{8, 0}, {8, 1}, {8, 2}, {7, 4}, {6, 5}, {2, 8}, {5, 6}, {4, 7}}};
+  StarMatrixLayout layout{};
+  layout.size = seissol::tensor::star::size(0);
+  real starData[seissol::tensor::star::size(0)];
+  auto star = seissol::init::star::view<0>::create(starData);
+  for (unsigned matrix = 0; matrix < 3; ++matrix) {
+    for (unsigned entry = 0; entry < NUM_ENTRIES; ++entry) {
+      layout.index[matrix][entry] = &star(Entries[matrix][entry][0], Entries[matrix][entry][1]) - starData;
+    }
+  }
+  return layout;
+}
+} // namespace
+#endif
+
 seissol::kernels::TimeBase::TimeBase() {
   m_derivativesOffsets[0] = 0;
   for (int order = 0; order < CONVERGENCE_ORDER; ++order) {
@@ -171,8 +203,10 @@ void seissol::kernels::Time::computeAder(double i_timeStepWidth,
   alignas(PAGESIZE_STACK) real stpRhs[tensor::spaceTimePredictor::size()];
   alignas(PAGESIZE_STACK) real stp[tensor::spaceTimePredictor::size()]{};
   kernel::spaceTimePredictor krnl = m_krnlPrototype;
+  alignas(ALIGNMENT) kernels::StarMatrices starMatricesBuffer;
+  const auto& starMatrices = kernels::starMatricesOf(data.localIntegration, data.material, starMatricesBuffer);
   for (unsigned i = 0; i < yateto::numFamilyMembers<tensor::star>(); ++i) {
-    krnl.star(i) = data.localIntegration.starMatrices[i];
+    krnl.star(i) = starMatrices[i];
   }
   krnl.Q = const_cast<real*>(data.dofs);
   krnl.I = o_timeIntegrated;
@@ -181,12 +215,16 @@ void seissol::kernels::Time::computeAder(double i_timeStepWidth,
   krnl.spaceTimePredictorRhs = stpRhs;
   krnl.execute();
 #else //USE_STP
+  // The derivatives are always computed in the (cache resident) stack buffer. Only cells which provide derivatives
+  // to other cells (see ltsSetup) stream them out afterwards, which avoids the read-for-ownership of the stores.
   alignas(PAGESIZE_STACK) real temporaryBuffer[yateto::computeFamilySize<tensor::dQ>()];
-  auto* derivativesBuffer = (o_timeDerivatives != nullptr) ? o_timeDerivatives : temporaryBuffer;
+  auto* derivativesBuffer = temporaryBuffer;
 
   kernel::derivative krnl = m_krnlPrototype;
+  alignas(ALIGNMENT) kernels::StarMatrices starMatricesBuffer;
+  const auto& starMatrices = kernels::starMatricesOf(data.localIntegration, data.material, starMatricesBuffer);
   for (unsigned i = 0; i < yateto::numFamilyMembers<tensor::star>(); ++i) {
-    krnl.star(i) = data.localIntegration.starMatrices[i];
+    krnl.star(i) = starMatrices[i];
   }
 
   // Optional source term
@@ -210,10 +248,11 @@ void seissol::kernels::Time::computeAder(double i_timeStepWidth,
   if (updateDisplacement) {
     // First derivative if needed later in kernel
     std::copy_n(data.dofs, tensor::dQ::size(0), derivativesBuffer);
-  } else if (o_timeDerivatives != nullptr) {
+  }
+  if (o_timeDerivatives != nullptr) {
     // First derivative is not needed here but later
     // Hence stream it out
-    streamstore(tensor::dQ::size(0), data.dofs, derivativesBuffer);
+    streamstore(tensor::dQ::size(0), data.dofs, o_timeDerivatives);
   }
 
   for (unsigned der = 1; der < CONVERGENCE_ORDER; ++der) {
@@ -224,6 +263,14 @@ void seissol::kernels::Time::computeAder(double i_timeStepWidth,
     intKrnl.execute(der);
   }
 
+  if (o_timeDerivatives != nullptr) {
+    for (unsigned der = 1; der < CONVERGENCE_ORDER; ++der) {
+      streamstore(tensor::dQ::size(der),
+                  derivativesBuffer + m_derivativesOffsets[der],
+                  o_timeDerivatives + m_derivativesOffsets[der]);
+    }
+  }
+
   // Do not compute it like this if at interface
   // Compute integrated displacement over time step if needed.
   if (updateDisplacement) {
@@ -267,6 +314,17 @@ void seissol::kernels::Time::computeBatchedAder(double i_timeStepWidth,
 
     intKrnl.I = (entry.content[*EntityId::Idofs])->getPointers();
 
+#ifdef USE_RECOMPUTED_STAR_MATRICES
+    // the volume kernel reads the same star matrices, see Local::computeBatchedIntegral
+    static const auto layout = starMatrixLayout();
+    device::aux::star_matrices::recomputeStarMatrices((entry.content[*EntityId::Star])->getPointers(),
+                                                      (entry.content[*EntityId::StarGradients])->getPointers(),
+                                                      (entry.content[*EntityId::StarCoefficients])->getPointers(),
+                                                      layout,
+                                                      NUM_ELEMENTS,
+                                                      DeviceContext::current().stream());
+#endif
+
     unsigned starOffset = 0;
     for (unsigned i = 0; i < yateto::numFamilyMembers<tensor::star>(); ++i) {
       derivativesKrnl.star(i) = const_cast<const real **>((entry.content[*EntityId::Star])->getPointers());
@@ -290,29 +348,29 @@ void seissol::kernels::Time::computeBatchedAder(double i_timeStepWidth,
                                         (entry.content[*EntityId::Derivatives])->getPointers(),
                                         tensor::Q::Size,
                                         derivativesKrnl.numElements,
-                                        device.api->getDefaultStream());
+                                        DeviceContext::current().stream());
 
     constexpr size_t MAX_TMP_MEM = (intKrnl.TmpMaxMemRequiredInBytes > derivativesKrnl.TmpMaxMemRequiredInBytes) \
                                    ? intKrnl.TmpMaxMemRequiredInBytes : derivativesKrnl.TmpMaxMemRequiredInBytes;
-    real* tmpMem = (real*)(device.api->getStackMemory(MAX_TMP_MEM * NUM_ELEMENTS));
+    real* tmpMem = (real*)(DeviceContext::current().getTemporaryMemory(MAX_TMP_MEM * NUM_ELEMENTS));
 
     intKrnl.power = i_timeStepWidth;
     intKrnl.linearAllocator.initialize(tmpMem);
-    intKrnl.streamPtr = device.api->getDefaultStream();
+    intKrnl.streamPtr = DeviceContext::current().stream();
     intKrnl.execute0();
 
     for (unsigned Der = 1; Der < CONVERGENCE_ORDER; ++Der) {
       derivativesKrnl.linearAllocator.initialize(tmpMem);
-      derivativesKrnl.streamPtr = device.api->getDefaultStream();
+      derivativesKrnl.streamPtr = DeviceContext::current().stream();
       derivativesKrnl.execute(Der);
 
       // update scalar for this derivative
       intKrnl.power *= i_timeStepWidth / real(Der + 1);
       intKrnl.linearAllocator.initialize(tmpMem);
-      intKrnl.streamPtr = device.api->getDefaultStream();
+      intKrnl.streamPtr = DeviceContext::current().stream();
       intKrnl.execute(Der);
     }
-    device.api->popStackMemory();
+    DeviceContext::current().popTemporaryMemory();
   }
 #else
   assert(false && "no implementation provided");
@@ -426,7 +484,7 @@ void seissol::kernels::Time::computeBatchedIntegral(double i_expansionPoint,
 
   kernel::gpu_derivativeTaylorExpansion intKrnl;
   intKrnl.numElements = numElements;
-  real* tmpMem = (real*)(device.api->getStackMemory(intKrnl.TmpMaxMemRequiredInBytes * numElements));
+  real* tmpMem = (real*)(DeviceContext::current().getTemporaryMemory(intKrnl.TmpMaxMemRequiredInBytes * numElements));
 
   intKrnl.I = o_timeIntegratedDofs;
 
@@ -446,10 +504,10 @@ void seissol::kernels::Time::computeBatchedIntegral(double i_expansionPoint,
     intKrnl.power = firstTerm - secondTerm;
     intKrnl.power /= factorial;
     intKrnl.linearAllocator.initialize(tmpMem);
-    intKrnl.streamPtr = device.api->getDefaultStream();
+    intKrnl.streamPtr = DeviceContext::current().stream();
     intKrnl.execute(der);
   }
-  device.api->popStackMemory();
+  DeviceContext::current().popTemporaryMemory();
 #else
   assert(false && "no implementation provided");
 #endif
@@ -510,7 +568,7 @@ void seissol::kernels::Time::computeBatchedTaylorExpansion(real time,
   const real deltaT = time - expansionPoint;
   intKrnl.power = 1.0;
   for(int derivative = 0; derivative < CONVERGENCE_ORDER; ++derivative) {
-    intKrnl.streamPtr = device.api->getDefaultStream();
+    intKrnl.streamPtr = DeviceContext::current().stream();
     intKrnl.execute(derivative);
     intKrnl.power *= deltaT / static_cast<real>(derivative + 1);
   }
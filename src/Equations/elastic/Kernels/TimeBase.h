@@ -107,7 +107,13 @@ class seissol::kernels::TimeBase {
   unsigned int m_derivativesOffsets[CONVERGENCE_ORDER];
 
 #ifdef ACL_DEVICE
+#ifdef USE_POROELASTIC
+    kernel::gpu_spaceTimePredictor deviceKrnlPrototype;
+    //! Whether the batched space-time predictor uses cachedZinv, see Time::prepareBatchedAder
+    bool m_useCachedZinvOnDevice{false};
+#else
     kernel::gpu_derivative deviceKrnlPrototype;
+#endif
     device::DeviceInstance& device = device::DeviceInstance::getInstance();
 #endif
 
@@ -7,7 +7,13 @@ extern long long libxsmm_num_total_flops;
 
 #include <Kernels/common.hpp>
 #include <Kernels/denseMatrixOps.hpp>
+#include <Kernels/StarMatrices.h>
 
+#ifdef ACL_DEVICE
+#include <Kernels/DeviceContext.h>
+#endif
+
+#include <cstddef>
 #include <cstring>
 #include <cassert>
 #include <stdint.h>
@@ -21,6 +27,51 @@ extern long long libxsmm_num_total_flops;
 GENERATE_HAS_MEMBER(ET)
 GENERATE_HAS_MEMBER(sourceMatrix)
 
+#ifdef ACL_DEVICE
+namespace {
+//! Copies values to the device once; the memory is kept until the end of the program like the global data.
+real const* deviceCopyOf(real const* values, std::size_t size) {
+  auto& device = device::DeviceInstance::getInstance();
+  auto* memory = static_cast<real*>(device.api->allocGlobMem(size * sizeof(real)));
+  device.api->copyTo(memory, values, size * sizeof(real));
+  return memory;
+}
+
+//! The constant matrices of the space-time predictor, which are not part of the global data
+struct DeviceStpMatrices {
+  real const* kDivMTSub[3][CONVERGENCE_ORDER]{};
+  real const* selectModes[CONVERGENCE_ORDER]{};
+  real const* selectQuantity[NUMBER_OF_QUANTITIES]{};
+  real const* timeInt{nullptr};
+  real const* wHat{nullptr};
+};
+
+DeviceStpMatrices const& deviceStpMatrices() {
+  static const DeviceStpMatrices matrices = [] {
+    DeviceStpMatrices copies;
+    for (int n = 0; n < CONVERGENCE_ORDER; ++n) {
+      if (n > 0) {
+        for (int d = 0; d < 3; ++d) {
+          copies.kDivMTSub[d][n] = deviceCopyOf(init::kDivMTSub::Values[tensor::kDivMTSub::index(d,n)],
+                                                tensor::kDivMTSub::size(d,n));
+        }
+      }
+      copies.selectModes[n] = deviceCopyOf(init::selectModes::Values[tensor::selectModes::index(n)],
+                                           tensor::selectModes::size(n));
+    }
+    for (int k = 0; k < NUMBER_OF_QUANTITIES; k++) {
+      copies.selectQuantity[k] = deviceCopyOf(init::selectQuantity::Values[tensor::selectQuantity::index(k)],
+                                              tensor::selectQuantity::size(k));
+    }
+    copies.timeInt = deviceCopyOf(init::timeInt::Values, tensor::timeInt::size());
+    copies.wHat = deviceCopyOf(init::wHat::Values, tensor::wHat::size());
+    return copies;
+  }();
+  return matrices;
+}
+} // namespace
+#endif
+
 seissol::kernels::TimeBase::TimeBase(){
   m_derivativesOffsets[0] = 0;
   for (int order = 0; order < CONVERGENCE_ORDER; ++order) {
@@ -51,7 +102,20 @@ void seissol::kernels::Time::setGlobalData(const CompoundGlobalData& global) {
   setHostGlobalData(global.onHost);
 
 #ifdef ACL_DEVICE
-  logError() << "Poroelasticity does not work on GPUs.";
+  const auto& matrices = deviceStpMatrices();
+  for (int n = 0; n < CONVERGENCE_ORDER; ++n) {
+    if (n > 0) {
+      for (int d = 0; d < 3; ++d) {
+        deviceKrnlPrototype.kDivMTSub(d,n) = matrices.kDivMTSub[d][n];
+      }
+    }
+    deviceKrnlPrototype.selectModes(n) = matrices.selectModes[n];
+  }
+  for (int k = 0; k < NUMBER_OF_QUANTITIES; k++) {
+    deviceKrnlPrototype.selectQuantity(k) = matrices.selectQuantity[k];
+  }
+  deviceKrnlPrototype.timeInt = matrices.timeInt;
+  deviceKrnlPrototype.wHat = matrices.wHat;
 #endif
 }
 
@@ -72,10 +136,12 @@ void seissol::kernels::Time::executeSTP( double                      i_timeStepW
   real A_values[init::star::size(0)];
   real B_values[init::star::size(1)];
   real C_values[init::star::size(2)];
+  alignas(ALIGNMENT) kernels::StarMatrices starMatricesBuffer;
+  const auto& starMatrices = kernels::starMatricesOf(data.localIntegration, data.material, starMatricesBuffer);
   for (size_t i = 0; i < init::star::size(0); i++) {
-    A_values[i] = i_timeStepWidth * data.localIntegration.starMatrices[0][i];
-    B_values[i] = i_timeStepWidth * data.localIntegration.starMatrices[1][i];
-    C_values[i] = i_timeStepWidth * data.localIntegration.starMatrices[2][i];
+    A_values[i] = i_timeStepWidth * starMatrices[0][i];
+    B_values[i] = i_timeStepWidth * starMatrices[1][i];
+    C_values[i] = i_timeStepWidth * starMatrices[2][i];
   }
   krnl.star(0) = A_values;
   krnl.star(1) = B_values;
@@ -83,13 +149,17 @@ void seissol::kernels::Time::executeSTP( double                      i_timeStepW
 
   //The matrix Zinv depends on the timestep
   //If the timestep is not as expected e.g. when approaching a sync point
-  //we have to recalculate it
-  if (i_timeStepWidth != data.localIntegration.specific.typicalTimeStepWidth) {
-    auto sourceMatrix = init::ET::view::create(data.localIntegration.specific.sourceMatrix);
-    real ZinvData[NUMBER_OF_QUANTITIES][CONVERGENCE_ORDER*CONVERGENCE_ORDER];
-    model::zInvInitializerForLoop<0, NUMBER_OF_QUANTITIES, decltype(sourceMatrix)>(ZinvData, sourceMatrix, i_timeStepWidth);
+  //we have to recalculate it. The last step before a sync point usually has the
+  //same width in every sync interval, hence the recalculated matrix is kept.
+  auto& specific = data.localIntegration.specific;
+  if (i_timeStepWidth != specific.typicalTimeStepWidth) {
+    if (i_timeStepWidth != specific.cachedTimeStepWidth) {
+      auto sourceMatrix = init::ET::view::create(specific.sourceMatrix);
+      model::zInvInitializerForLoop<0, NUMBER_OF_QUANTITIES, decltype(sourceMatrix)>(specific.cachedZinv, sourceMatrix, i_timeStepWidth);
+      specific.cachedTimeStepWidth = i_timeStepWidth;
+    }
     for (size_t i = 0; i < NUMBER_OF_QUANTITIES; i++) {
-      krnl.Zinv(i) = ZinvData[i];
+      krnl.Zinv(i) = specific.cachedZinv[i];
     }
   } else {
     for (size_t i = 0; i < NUMBER_OF_QUANTITIES; i++) {
@@ -129,6 +199,98 @@ void seissol::kernels::Time::computeAder( double i_timeStepWidth,
   executeSTP( i_timeStepWidth, data, o_timeIntegrated, stpBuffer );
 }
 
+void seissol::kernels::Time::prepareBatchedAder(double i_timeStepWidth,
+                                                initializers::Layer& layer,
+                                                initializers::LTS const& lts) {
+#ifdef ACL_DEVICE
+  auto* localIntegration = layer.var(lts.localIntegration);
+  const auto numberOfCells = layer.getNumberOfCells();
+
+  // the cells of a layer share the typical time step width of their time cluster
+  m_useCachedZinvOnDevice = numberOfCells > 0 && i_timeStepWidth != localIntegration[0].specific.typicalTimeStepWidth;
+  if (!m_useCachedZinvOnDevice) {
+    return;
+  }
+
+  bool recomputed = false;
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static) reduction(||: recomputed)
+#endif
+  for (unsigned cell = 0; cell < numberOfCells; ++cell) {
+    auto& specific = localIntegration[cell].specific;
+    if (i_timeStepWidth != specific.cachedTimeStepWidth) {
+      auto sourceMatrix = init::ET::view::create(specific.sourceMatrix);
+      model::zInvInitializerForLoop<0, NUMBER_OF_QUANTITIES, decltype(sourceMatrix)>(specific.cachedZinv, sourceMatrix, i_timeStepWidth);
+      specific.cachedTimeStepWidth = i_timeStepWidth;
+      recomputed = true;
+    }
+  }
+
+  // happens once per distinct time step width, e.g. for the last time step before a synchronization point
+  if (recomputed) {
+    device.api->copyTo(layer.var(lts.localIntegrationOnDevice),
+                       localIntegration,
+                       numberOfCells * sizeof(LocalIntegrationData));
+  }
+#endif
+}
+
+void seissol::kernels::Time::computeBatchedAder(double i_timeStepWidth,
+                                                LocalTmp& tmp,
+                                                ConditionalBatchTableT &table) {
+#ifdef ACL_DEVICE
+  kernel::gpu_spaceTimePredictor krnl = deviceKrnlPrototype;
+
+  ConditionalKey key(KernelNames::Time || KernelNames::Volume);
+  if(table.find(key) != table.end()) {
+    BatchTable &entry = table[key];
+
+    const auto NUM_ELEMENTS = (entry.content[*EntityId::Dofs])->getSize();
+    krnl.numElements = NUM_ELEMENTS;
+
+    krnl.Q = const_cast<const real **>((entry.content[*EntityId::Dofs])->getPointers());
+    krnl.I = (entry.content[*EntityId::Idofs])->getPointers();
+    krnl.spaceTimePredictor = (entry.content[*EntityId::Derivatives])->getPointers();
+    krnl.spaceTimePredictorRhs = (entry.content[*EntityId::StpRhs])->getPointers();
+    krnl.Gmatrix = const_cast<const real **>((entry.content[*EntityId::Gmatrix])->getPointers());
+    krnl.timestep = i_timeStepWidth;
+
+    // the kernel scales the star matrices with the time step width itself
+    unsigned starOffset = 0;
+    for (unsigned i = 0; i < yateto::numFamilyMembers<tensor::star>(); ++i) {
+      krnl.star(i) = const_cast<const real **>((entry.content[*EntityId::Star])->getPointers());
+      krnl.extraOffset_star(i) = starOffset;
+      starOffset += tensor::star::size(i);
+    }
+
+    // the Zinv of an atypical time step width are stored in cachedZinv, see prepareBatchedAder
+    using model::PoroelasticLocalData;
+    constexpr unsigned cachedZinvOffset =
+        (offsetof(PoroelasticLocalData, cachedZinv) - offsetof(PoroelasticLocalData, Zinv)) / sizeof(real);
+    const unsigned zinvOffset = m_useCachedZinvOnDevice ? cachedZinvOffset : 0;
+    for (unsigned i = 0; i < yateto::numFamilyMembers<tensor::Zinv>(); ++i) {
+      krnl.Zinv(i) = const_cast<const real **>((entry.content[*EntityId::Zinv])->getPointers());
+      krnl.extraOffset_Zinv(i) = zinvOffset + i * CONVERGENCE_ORDER * CONVERGENCE_ORDER;
+    }
+
+    // the kernel accumulates the space-time predictor, which has to start from zero
+    device.algorithms.touchBatchedMemory((entry.content[*EntityId::Derivatives])->getPointers(),
+                                         tensor::spaceTimePredictor::size(),
+                                         NUM_ELEMENTS,
+                                         true,
+                                         DeviceContext::current().stream());
+
+    real* tmpMem = (real*)(DeviceContext::current().getTemporaryMemory(krnl.TmpMaxMemRequiredInBytes * NUM_ELEMENTS));
+    krnl.linearAllocator.initialize(tmpMem);
+    krnl.streamPtr = DeviceContext::current().stream();
+    krnl.execute();
+    DeviceContext::current().popTemporaryMemory();
+  }
+#else
+  assert(false && "no implementation provided");
+#endif
+}
+
 void seissol::kernels::Time::flopsAder( unsigned int        &o_nonZeroFlops,
                                         unsigned int        &o_hardwareFlops ) {
   // reset flops
@@ -206,6 +368,60 @@ void seissol::kernels::Time::computeIntegral( double
   }
 }
 
+void seissol::kernels::Time::computeBatchedIntegral(double i_expansionPoint,
+                                                    double i_integrationStart,
+                                                    double i_integrationEnd,
+                                                    const real** i_timeDerivatives,
+                                                    real ** o_timeIntegratedDofs,
+                                                    unsigned numElements) {
+#ifdef ACL_DEVICE
+  // assert that this is a forwared integration in time
+  assert( i_integrationStart + (real) 1.E-10 > i_expansionPoint   );
+  assert( i_integrationEnd                   > i_integrationStart );
+
+  /*
+   * compute time integral.
+   */
+  // compute lengths of integration intervals
+  real deltaTLower = i_integrationStart - i_expansionPoint;
+  real deltaTUpper = i_integrationEnd - i_expansionPoint;
+
+  // initialization of scalars in the taylor series expansion (0th term)
+  real firstTerm  = static_cast<real>(1.0);
+  real secondTerm = static_cast<real>(1.0);
+  real factorial  = static_cast<real>(1.0);
+
+  kernel::gpu_derivativeTaylorExpansion intKrnl;
+  intKrnl.numElements = numElements;
+  real* tmpMem = (real*)(DeviceContext::current().getTemporaryMemory(intKrnl.TmpMaxMemRequiredInBytes * numElements));
+
+  intKrnl.I = o_timeIntegratedDofs;
+
+  unsigned derivativesOffset = 0;
+  for (size_t i = 0; i < yateto::numFamilyMembers<tensor::dQ>(); ++i) {
+    intKrnl.dQ(i) = i_timeDerivatives;
+    intKrnl.extraOffset_dQ(i) = derivativesOffset;
+    derivativesOffset += tensor::dQ::size(i);
+  }
+
+  // iterate over time derivatives
+  for(int der = 0; der < CONVERGENCE_ORDER; ++der) {
+    firstTerm *= deltaTUpper;
+    secondTerm *= deltaTLower;
+    factorial *= static_cast<real>(der + 1);
+
+    intKrnl.power = firstTerm - secondTerm;
+    intKrnl.power /= factorial;
+    intKrnl.linearAllocator.initialize(tmpMem);
+    intKrnl.streamPtr = DeviceContext::current().stream();
+    intKrnl.execute(der);
+  }
+  DeviceContext::current().popTemporaryMemory();
+#else
+  assert(false && "no implementation provided");
+#endif
+}
+
 void seissol::kernels::Time::computeTaylorExpansion( real         time,
                                                      real         expansionPoint,
                                                      real const*  timeDerivatives,
@@ -237,6 +453,39 @@ void seissol::kernels::Time::computeTaylorExpansion( real         time,
   }
 }
 
+void seissol::kernels::Time::computeBatchedTaylorExpansion(real time,
+                                                           real expansionPoint,
+                                                           real** timeDerivatives,
+                                                           real** timeEvaluated,
+                                                           size_t numElements) {
+#ifdef ACL_DEVICE
+  assert( timeDerivatives != nullptr );
+  assert( timeEvaluated != nullptr );
+  assert( time >= expansionPoint );
+  static_assert(tensor::I::size() == tensor::Q::size(), "Sizes of tensors I and Q must match");
+  static_assert(kernel::gpu_derivativeTaylorExpansion::TmpMaxMemRequiredInBytes == 0);
+
+  kernel::gpu_derivativeTaylorExpansion intKrnl;
+  intKrnl.numElements = numElements;
+  intKrnl.I = timeEvaluated;
+  for (unsigned i = 0; i < yateto::numFamilyMembers<tensor::dQ>(); ++i) {
+    intKrnl.dQ(i) = const_cast<const real **>(timeDerivatives);
+    intKrnl.extraOffset_dQ(i) = m_derivativesOffsets[i];
+  }
+
+  // iterate over time derivatives
+  const real deltaT = time - expansionPoint;
+  intKrnl.power = 1.0;
+  for(int derivative = 0; derivative < CONVERGENCE_ORDER; ++derivative) {
+    intKrnl.streamPtr = DeviceContext::current().stream();
+    intKrnl.execute(derivative);
+    intKrnl.power *= deltaT / static_cast<real>(derivative + 1);
+  }
+#else
+  assert(false && "no implementation provided");
+#endif
+}
+
 void seissol::kernels::Time::flopsTaylorExpansion(long long& nonZeroFlops, long long& hardwareFlops) {
   // reset flops
   nonZeroFlops = 0; hardwareFlops = 0;
@@ -409,8 +409,14 @@ namespace seissol {
       localData->G[10] = sourceMatrix(10, 6);
       localData->G[11] = sourceMatrix(11, 7);
       localData->G[12] = sourceMatrix(12, 8);
+      auto Gmatrix = init::Gmatrix::view::create(localData->Gmatrix);
+      Gmatrix.setZero();
+      for (unsigned quantity = 10; quantity < NUMBER_OF_QUANTITIES; ++quantity) {
+        Gmatrix(quantity - 4, quantity) = localData->G[quantity];
+      }
 
       localData->typicalTimeStepWidth = timeStepWidth;
+      localData->cachedTimeStepWidth = 0.0;
     }
   }
 }
@@ -20,6 +20,6 @@ double seissol::model::PoroElasticMaterial::getPWaveSpeed() const {
 #else
 //Return an estimate which neglects fluid effects
 double seissol::model::PoroElasticMaterial::getPWaveSpeed() const {
-  return std::sqrt(lambda + 2*mu) / rho;
+  return std::sqrt((lambda + 2*mu) / rho);
 }
 #endif
@@ -44,6 +44,8 @@ namespace seissol {
         em.getFullStiffnessTensor(fullTensor);
       };
 
+      //! Only the hyperbolic part limits the time step: the space-time predictor integrates the stiff
+      //! Biot damping implicitly (see Zinv in PoroelasticSetup.h)
       double getMaxWaveSpeed() const final 
       {
         return getPWaveSpeed();
@@ -9,8 +9,13 @@ namespace seissol {
     struct PoroelasticLocalData {
       real sourceMatrix[seissol::tensor::ET::size()];
       real G[NUMBER_OF_QUANTITIES];
+      //! G as a matrix for the batched device kernel (the host kernel uses the scalars in G)
+      real Gmatrix[seissol::tensor::Gmatrix::size()];
       real typicalTimeStepWidth;
       real Zinv[NUMBER_OF_QUANTITIES][CONVERGENCE_ORDER*CONVERGENCE_ORDER];
+      //! Zinv for the last time step width which differed from the typical one (0 if none)
+      real cachedTimeStepWidth;
+      real cachedZinv[NUMBER_OF_QUANTITIES][CONVERGENCE_ORDER*CONVERGENCE_ORDER];
     };
     struct PoroelasticNeighborData {};
   }
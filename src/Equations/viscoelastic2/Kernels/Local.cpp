@@ -46,6 +46,7 @@
 #include <cstring>
 
 #include <yateto.h>
+#include <Kernels/StarMatrices.h>
 
 void seissol::kernels::Local::setHostGlobalData(GlobalData const* global) {
 #ifndef NDEBUG
@@ -89,8 +90,10 @@ void seissol::kernels::Local::computeIntegral(real i_timeIntegratedDegreesOfFree
   kernel::volumeExt volKrnl = m_volumeKernelPrototype;
   volKrnl.Qext = Qext;
   volKrnl.I = i_timeIntegratedDegreesOfFreedom;
+  alignas(ALIGNMENT) kernels::StarMatrices starMatricesBuffer;
+  const auto& starMatrices = kernels::starMatricesOf(data.localIntegration, data.material, starMatricesBuffer);
   for (unsigned i = 0; i < yateto::numFamilyMembers<tensor::star>(); ++i) {
-    volKrnl.star(i) = data.localIntegration.starMatrices[i];
+    volKrnl.star(i) = starMatrices[i];
   }
   
   kernel::localFluxExt lfKrnl = m_localFluxKernelPrototype;
@@ -104,7 +107,8 @@ void seissol::kernels::Local::computeIntegral(real i_timeIntegratedDegreesOfFree
   for( unsigned int face = 0; face < 4; ++face ) {
     // no element local contribution in the case of dynamic rupture boundary conditions
     if( data.cellInformation.faceTypes[face] != FaceType::dynamicRupture ) {
-      lfKrnl.AplusT = data.localIntegration.nApNm1[face];
+      alignas(ALIGNMENT) real fluxSolver[tensor::AplusT::size()];
+      lfKrnl.AplusT = fluxSolverOf(data.localIntegration.nApNm1[face], fluxSolver);
       lfKrnl.execute(face);
     }
   }
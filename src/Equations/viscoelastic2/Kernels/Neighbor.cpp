@@ -110,7 +110,8 @@ void seissol::kernels::Neighbor::computeNeighborsIntegral(  NeighborData&
         assert(data.cellInformation.faceRelations[l_face][0] < 4 && data.cellInformation.faceRelations[l_face][1] < 3);
 
         nfKrnl.I = i_timeIntegrated[l_face];
-        nfKrnl.AminusT = data.neighboringIntegration.nAmNm1[l_face];
+        alignas(ALIGNMENT) real fluxSolver[tensor::AminusT::size()];
+        nfKrnl.AminusT = fluxSolverOf(data.neighboringIntegration.nAmNm1[l_face], fluxSolver);
         nfKrnl._prefetch.I = faceNeighbors_prefetch[l_face];
         nfKrnl.execute(data.cellInformation.faceRelations[l_face][1], data.cellInformation.faceRelations[l_face][0], l_face);
       }
@@ -136,7 +137,7 @@ void seissol::kernels::Neighbor::computeNeighborsIntegral(  NeighborData&
 }
 
 void seissol::kernels::Neighbor::flopsNeighborsIntegral(const FaceType i_faceTypes[4],
-                                                        const int i_neighboringIndices[4][2],
+                                                        const std::int8_t i_neighboringIndices[4][2],
                                                         CellDRMapping const (&cellDrMapping)[4],
                                                         unsigned int &o_nonZeroFlops,
                                                         unsigned int &o_hardwareFlops,
@@ -52,6 +52,7 @@ extern long long libxsmm_num_total_flops;
 #include <yateto.h>
 
 #include <Kernels/denseMatrixOps.hpp>
+#include <Kernels/StarMatrices.h>
 #include <generated_code/init.h>
 
 void seissol::kernels::Time::setHostGlobalData(GlobalData const* global) {
@@ -121,8 +122,10 @@ void seissol::kernels::Time::computeAder(double i_timeStepWidth,
   intKrnl.I = o_timeIntegrated;
   intKrnl.Iane = tmp.timeIntegratedAne;
 
+  alignas(ALIGNMENT) kernels::StarMatrices starMatricesBuffer;
+  const auto& starMatrices = kernels::starMatricesOf(data.localIntegration, data.material, starMatricesBuffer);
   for (unsigned i = 0; i < yateto::numFamilyMembers<tensor::star>(); ++i) {
-    krnl.star(i) = data.localIntegration.starMatrices[i];
+    krnl.star(i) = starMatrices[i];
   }
   krnl.w = data.localIntegration.specific.w;
   krnl.W = data.localIntegration.specific.W;
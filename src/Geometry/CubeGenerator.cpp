@@ -0,0 +1,266 @@
+#include "CubeGenerator.h"
+
+#include <algorithm>
+#include <functional>
+#include <tuple>
+
+#include <utils/logger.h>
+
+namespace {
+using VertexCoords = std::array<unsigned, 3>;
+
+// Offsets of the vertices of the five tetrahedra of a cube with even and odd parity (x+y+z),
+// such that the faces of neighboring cubes match (see preprocessing/meshing/cube_c)
+constexpr unsigned TetVertices[2][5][4][3] = {{{{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {0, 0, 1}},
+                                               {{1, 0, 0}, {0, 1, 0}, {1, 1, 1}, {1, 1, 0}},
+                                               {{1, 0, 0}, {1, 1, 1}, {0, 0, 1}, {1, 0, 1}},
+                                               {{0, 1, 0}, {0, 1, 1}, {0, 0, 1}, {1, 1, 1}},
+                                               {{1, 0, 0}, {0, 1, 0}, {0, 0, 1}, {1, 1, 1}}},
+                                              {{{0, 0, 0}, {0, 1, 0}, {0, 1, 1}, {1, 1, 0}},
+                                               {{0, 0, 0}, {1, 1, 0}, {1, 0, 1}, {1, 0, 0}},
+                                               {{0, 0, 0}, {1, 0, 1}, {0, 1, 1}, {0, 0, 1}},
+                                               {{1, 1, 0}, {1, 0, 1}, {1, 1, 1}, {0, 1, 1}},
+                                               {{0, 0, 0}, {1, 1, 0}, {0, 1, 1}, {1, 0, 1}}}};
+
+std::array<VertexCoords, 3> faceVertices(std::array<VertexCoords, 4> const& tet, unsigned face) {
+  return {tet[MeshTools::FACE2NODES[face][0]], tet[MeshTools::FACE2NODES[face][1]], tet[MeshTools::FACE2NODES[face][2]]};
+}
+
+bool sameFace(std::array<VertexCoords, 3> a, std::array<VertexCoords, 3> b) {
+  std::sort(a.begin(), a.end());
+  std::sort(b.begin(), b.end());
+  return a == b;
+}
+
+//! Face of a rank, which is shared with another rank
+struct SharedFace {
+  unsigned long minGlobalId;
+  unsigned long maxGlobalId;
+  MPINeighborElement element;
+};
+} // namespace
+
+seissol::geometry::CubeGenerator::CubeGenerator(int rank,
+                                                int numberOfRanks,
+                                                std::array<unsigned, 3> const& numCubes,
+                                                std::array<unsigned, 3> const& numPartitions,
+                                                double scale,
+                                                int boundaryCondition)
+    : MeshReader(rank), m_numCubes(numCubes), m_numPartitions(partitionGrid(numberOfRanks, numPartitions)) {
+  const std::array<unsigned, 3> partition = {rank % m_numPartitions[0],
+                                             (rank / m_numPartitions[0]) % m_numPartitions[1],
+                                             rank / (m_numPartitions[0] * m_numPartitions[1])};
+  for (unsigned d = 0; d < 3; ++d) {
+    if (m_numCubes[d] < m_numPartitions[d]) {
+      logError() << "Cannot distribute" << m_numCubes[d] << "cubes in dimension" << d << "to" << m_numPartitions[d]
+                 << "partitions";
+    }
+    m_begin[d] = static_cast<unsigned long>(m_numCubes[d]) * partition[d] / m_numPartitions[d];
+    m_end[d] = static_cast<unsigned long>(m_numCubes[d]) * (partition[d] + 1) / m_numPartitions[d];
+  }
+  logInfo(rank) << "Generating a box of" << m_numCubes[0] << 'x' << m_numCubes[1] << 'x' << m_numCubes[2]
+                << "cubes on" << m_numPartitions[0] << 'x' << m_numPartitions[1] << 'x' << m_numPartitions[2]
+                << "partitions";
+
+  const std::array<unsigned, 3> size = {m_end[0] - m_begin[0], m_end[1] - m_begin[1], m_end[2] - m_begin[2]};
+  const unsigned numElements = 5 * size[0] * size[1] * size[2];
+
+  // Vertices
+  m_vertices.resize((size[0] + 1) * (size[1] + 1) * (size[2] + 1));
+  auto localVertexId = [&](VertexCoords const& v) {
+    return ((v[2] - m_begin[2]) * (size[1] + 1) + (v[1] - m_begin[1])) * (size[0] + 1) + (v[0] - m_begin[0]);
+  };
+  for (unsigned z = m_begin[2]; z <= m_end[2]; ++z) {
+    for (unsigned y = m_begin[1]; y <= m_end[1]; ++y) {
+      for (unsigned x = m_begin[0]; x <= m_end[0]; ++x) {
+        const VertexCoords v = {x, y, z};
+        for (unsigned d = 0; d < 3; ++d) {
+          m_vertices[localVertexId(v)].coords[d] = scale * (static_cast<double>(v[d]) / m_numCubes[d] - 0.5);
+        }
+      }
+    }
+  }
+
+  // Elements
+  m_elements.resize(numElements);
+  m_elementGlobalIds.resize(numElements);
+  std::vector<std::vector<SharedFace>> sharedFaces(numberOfRanks);
+  for (unsigned z = m_begin[2]; z < m_end[2]; ++z) {
+    for (unsigned y = m_begin[1]; y < m_end[1]; ++y) {
+      for (unsigned x = m_begin[0]; x < m_end[0]; ++x) {
+        const CubeCoords cube = {x, y, z};
+        for (unsigned tet = 0; tet < 5; ++tet) {
+          const int id = localElementId(cube, tet);
+          Element& element = m_elements[id];
+          element.localId = id;
+          element.rank = rank;
+          element.group = 0;
+          m_elementGlobalIds[id] = globalElementId(cube, tet);
+
+          const auto vertices = tetrahedron(cube, tet);
+          for (unsigned i = 0; i < 4; ++i) {
+            element.vertices[i] = localVertexId(vertices[i]);
+            m_vertices[element.vertices[i]].elements.push_back(id);
+          }
+
+          for (unsigned face = 0; face < 4; ++face) {
+            const auto local = faceVertices(vertices, face);
+            element.neighbors[face] = numElements;
+            element.neighborSides[face] = 0;
+            element.sideOrientations[face] = 0;
+            element.boundaries[face] = 0;
+            element.neighborRanks[face] = rank;
+            element.mpiIndices[face] = 0;
+            element.mpiFaultIndices[face] = 0;
+
+            // The neighbor is in the adjacent cube if the face lies on a face of the cube
+            CubeCoords neighborCube = cube;
+            bool outside = false;
+            for (unsigned d = 0; d < 3; ++d) {
+              if (local[0][d] == local[1][d] && local[1][d] == local[2][d]) {
+                if (local[0][d] == cube[d]) {
+                  outside = cube[d] == 0;
+                  --neighborCube[d];
+                } else {
+                  outside = cube[d] + 1 == m_numCubes[d];
+                  ++neighborCube[d];
+                }
+              }
+            }
+            if (outside) {
+              element.boundaries[face] = boundaryCondition;
+              element.faultTags[face] = boundaryCondition;
+              continue;
+            }
+            element.faultTags[face] = 0;
+
+            bool found = false;
+            for (unsigned neighborTet = 0; neighborTet < 5 && !found; ++neighborTet) {
+              if (neighborCube == cube && neighborTet == tet) {
+                continue;
+              }
+              const auto neighborVertices = tetrahedron(neighborCube, neighborTet);
+              for (unsigned neighborFace = 0; neighborFace < 4 && !found; ++neighborFace) {
+                const auto remote = faceVertices(neighborVertices, neighborFace);
+                if (!sameFace(local, remote)) {
+                  continue;
+                }
+                found = true;
+                element.neighborSides[face] = neighborFace;
+                // Position of the first vertex of the face in the face of the neighbor
+                element.sideOrientations[face] = std::find(remote.begin(), remote.end(), local[0]) - remote.begin();
+
+                const int neighborRank = owner(neighborCube);
+                element.neighborRanks[face] = neighborRank;
+                if (neighborRank == rank) {
+                  element.neighbors[face] = localElementId(neighborCube, neighborTet);
+                } else {
+                  const auto globalId = m_elementGlobalIds[id];
+                  const auto neighborGlobalId = globalElementId(neighborCube, neighborTet);
+                  MPINeighborElement shared;
+                  shared.localElement = id;
+                  shared.localSide = face;
+                  shared.neighborElement = neighborGlobalId;
+                  shared.neighborSide = neighborFace;
+                  sharedFaces[neighborRank].push_back(
+                      {std::min(globalId, neighborGlobalId), std::max(globalId, neighborGlobalId), shared});
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  // Both ranks order their shared faces by the global ids of the two elements
+  for (int neighborRank = 0; neighborRank < numberOfRanks; ++neighborRank) {
+    auto& faces = sharedFaces[neighborRank];
+    if (faces.empty()) {
+      continue;
+    }
+    std::sort(faces.begin(), faces.end(), [](SharedFace const& a, SharedFace const& b) {
+      return std::tie(a.minGlobalId, a.maxGlobalId) < std::tie(b.minGlobalId, b.maxGlobalId);
+    });
+    MPINeighbor& neighbor = m_MPINeighbors[neighborRank];
+    neighbor.localID = m_MPINeighbors.size() - 1;
+    for (unsigned i = 0; i < faces.size(); ++i) {
+      m_elements[faces[i].element.localElement].mpiIndices[faces[i].element.localSide] = i;
+      neighbor.elements.push_back(faces[i].element);
+    }
+  }
+}
+
+std::array<unsigned, 3> seissol::geometry::CubeGenerator::partitionGrid(int numberOfRanks,
+                                                                        std::array<unsigned, 3> numPartitions) {
+  unsigned remaining = numberOfRanks;
+  for (const unsigned partitions : numPartitions) {
+    if (partitions != 0) {
+      if (remaining % partitions != 0) {
+        logError() << "The partition grid" << numPartitions[0] << 'x' << numPartitions[1] << 'x' << numPartitions[2]
+                   << "does not match the number of ranks" << numberOfRanks;
+      }
+      remaining /= partitions;
+    }
+  }
+  const bool anyFree = std::count(numPartitions.begin(), numPartitions.end(), 0u) > 0;
+  if (!anyFree && remaining != 1) {
+    logError() << "The partition grid" << numPartitions[0] << 'x' << numPartitions[1] << 'x' << numPartitions[2]
+               << "does not match the number of ranks" << numberOfRanks;
+  }
+
+  // Distribute the prime factors (largest first) to the free dimension with the fewest partitions
+  std::vector<unsigned> factors;
+  for (unsigned factor = 2; remaining > 1; ++factor) {
+    while (remaining % factor == 0) {
+      factors.push_back(factor);
+      remaining /= factor;
+    }
+  }
+  std::array<unsigned, 3> grid = {1, 1, 1};
+  for (auto factor = factors.rbegin(); factor != factors.rend(); ++factor) {
+    unsigned smallest = 3;
+    for (unsigned d = 0; d < 3; ++d) {
+      if (numPartitions[d] == 0 && (smallest == 3 || grid[d] < grid[smallest])) {
+        smallest = d;
+      }
+    }
+    grid[smallest] *= *factor;
+  }
+  for (unsigned d = 0; d < 3; ++d) {
+    if (numPartitions[d] != 0) {
+      grid[d] = numPartitions[d];
+    }
+  }
+  return grid;
+}
+
+std::array<VertexCoords, 4> seissol::geometry::CubeGenerator::tetrahedron(CubeCoords const& cube, unsigned tet) const {
+  const unsigned parity = (cube[0] + cube[1] + cube[2]) % 2;
+  std::array<VertexCoords, 4> vertices;
+  for (unsigned i = 0; i < 4; ++i) {
+    for (unsigned d = 0; d < 3; ++d) {
+      vertices[i][d] = cube[d] + TetVertices[parity][tet][i][d];
+    }
+  }
+  return vertices;
+}
+
+int seissol::geometry::CubeGenerator::owner(CubeCoords const& cube) const {
+  // Inverse of the block distribution m_begin = numCubes * partition / numPartitions
+  std::array<unsigned, 3> partition;
+  for (unsigned d = 0; d < 3; ++d) {
+    partition[d] = ((static_cast<unsigned long>(cube[d]) + 1) * m_numPartitions[d] - 1) / m_numCubes[d];
+  }
+  return (partition[2] * m_numPartitions[1] + partition[1]) * m_numPartitions[0] + partition[0];
+}
+
+unsigned long seissol::geometry::CubeGenerator::globalElementId(CubeCoords const& cube, unsigned tet) const {
+  return 5 * ((static_cast<unsigned long>(cube[2]) * m_numCubes[1] + cube[1]) * m_numCubes[0] + cube[0]) + tet;
+}
+
+int seissol::geometry::CubeGenerator::localElementId(CubeCoords const& cube, unsigned tet) const {
+  const unsigned sizeX = m_end[0] - m_begin[0];
+  const unsigned sizeY = m_end[1] - m_begin[1];
+  return 5 * (((cube[2] - m_begin[2]) * sizeY + (cube[1] - m_begin[1])) * sizeX + (cube[0] - m_begin[0])) + tet;
+}
@@ -0,0 +1,53 @@
+#ifndef SEISSOL_GEOMETRY_CUBEGENERATOR_H
+#define SEISSOL_GEOMETRY_CUBEGENERATOR_H
+
+#include <array>
+
+#include "MeshReader.h"
+
+namespace seissol::geometry {
+/**
+ * Generates the partition of a rank of a tetrahedral box mesh in memory, without reading a file.
+ *
+ * The box [-scale/2, scale/2]^3 is split into numCubes[0] x numCubes[1] x numCubes[2] cubes of
+ * five tetrahedra each (as preprocessing/meshing/cube_c). The cubes are distributed in blocks over a
+ * grid of numPartitions[0] x numPartitions[1] x numPartitions[2] ranks, with the x index running fastest.
+ * All faces on the surface of the box get the same boundary condition.
+ *
+ * Each rank generates its part and the adjacent cubes of its neighbors independently, hence the
+ * setup needs no communication and scales to any number of ranks.
+ **/
+class CubeGenerator : public MeshReader {
+  public:
+  CubeGenerator(int rank,
+                int numberOfRanks,
+                std::array<unsigned, 3> const& numCubes,
+                std::array<unsigned, 3> const& numPartitions,
+                double scale,
+                int boundaryCondition);
+
+  /**
+   * Chooses a partition grid for the number of ranks (as balanced as possible, see MPI_Dims_create).
+   * Entries which are not zero are kept.
+   **/
+  static std::array<unsigned, 3> partitionGrid(int numberOfRanks, std::array<unsigned, 3> numPartitions);
+
+  private:
+  using CubeCoords = std::array<unsigned, 3>;
+  using VertexCoords = std::array<unsigned, 3>;
+
+  //! Global coordinates of the vertices of the tetrahedron of a cube
+  std::array<VertexCoords, 4> tetrahedron(CubeCoords const& cube, unsigned tet) const;
+  int owner(CubeCoords const& cube) const;
+  unsigned long globalElementId(CubeCoords const& cube, unsigned tet) const;
+  int localElementId(CubeCoords const& cube, unsigned tet) const;
+
+  std::array<unsigned, 3> m_numCubes;
+  std::array<unsigned, 3> m_numPartitions;
+  //! First and last (exclusive) cube of this rank
+  std::array<unsigned, 3> m_begin;
+  std::array<unsigned, 3> m_end;
+};
+} // namespace seissol::geometry
+
+#endif // SEISSOL_GEOMETRY_CUBEGENERATOR_H
@@ -0,0 +1,130 @@
+#include "ElementIndex.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "MeshTools.h"
+
+namespace {
+constexpr unsigned ElementsPerLeaf = 8;
+} // namespace
+
+seissol::geometry::ElementIndex::ElementIndex(std::vector<Element> const& elements,
+                                              std::vector<Vertex> const& vertices)
+    : m_elements(elements), m_vertices(vertices), m_order(elements.size()) {
+  std::vector<double> centers(3 * elements.size());
+  for (unsigned elem = 0; elem < elements.size(); ++elem) {
+    MeshTools::center(elements[elem], vertices, &centers[3 * elem]);
+    m_order[elem] = elem;
+  }
+  if (!elements.empty()) {
+    m_nodes.reserve(2 * (elements.size() / ElementsPerLeaf + 1));
+    build(0, elements.size(), centers);
+  }
+}
+
+unsigned seissol::geometry::ElementIndex::build(unsigned begin, unsigned end, std::vector<double> const& centers) {
+  unsigned const id = m_nodes.size();
+  m_nodes.emplace_back();
+
+  Node node;
+  double centerMin[3];
+  double centerMax[3];
+  for (unsigned i = 0; i < 3; ++i) {
+    node.min[i] = centerMin[i] = std::numeric_limits<double>::max();
+    node.max[i] = centerMax[i] = std::numeric_limits<double>::lowest();
+  }
+  for (unsigned k = begin; k < end; ++k) {
+    Element const& element = m_elements[m_order[k]];
+    for (unsigned v = 0; v < 4; ++v) {
+      double const* coords = m_vertices[element.vertices[v]].coords;
+      for (unsigned i = 0; i < 3; ++i) {
+        node.min[i] = std::min(node.min[i], coords[i]);
+        node.max[i] = std::max(node.max[i], coords[i]);
+      }
+    }
+    for (unsigned i = 0; i < 3; ++i) {
+      centerMin[i] = std::min(centerMin[i], centers[3 * m_order[k] + i]);
+      centerMax[i] = std::max(centerMax[i], centers[3 * m_order[k] + i]);
+    }
+  }
+  // The plane test in inside() accepts points on the faces up to round-off
+  for (unsigned i = 0; i < 3; ++i) {
+    double const tolerance = 1e-12 * std::max(node.max[i] - node.min[i], std::abs(node.max[i]));
+    node.min[i] -= tolerance;
+    node.max[i] += tolerance;
+  }
+
+  if (end - begin <= ElementsPerLeaf) {
+    node.first = begin;
+    node.second = end;
+    node.leaf = true;
+  } else {
+    // Median split along the largest extent of the element centers
+    unsigned axis = 0;
+    for (unsigned i = 1; i < 3; ++i) {
+      if (centerMax[i] - centerMin[i] > centerMax[axis] - centerMin[axis]) {
+        axis = i;
+      }
+    }
+    unsigned const middle = begin + (end - begin) / 2;
+    std::nth_element(m_order.begin() + begin,
+                     m_order.begin() + middle,
+                     m_order.begin() + end,
+                     [&](unsigned a, unsigned b) { return centers[3 * a + axis] < centers[3 * b + axis]; });
+    node.first = build(begin, middle, centers);
+    node.second = build(middle, end, centers);
+    node.leaf = false;
+  }
+  m_nodes[id] = node;
+  return id;
+}
+
+bool seissol::geometry::ElementIndex::inside(unsigned element, VrtxCoords const point) const {
+  for (int face = 0; face < 4; ++face) {
+    VrtxCoords n, p;
+    MeshTools::pointOnPlane(m_elements[element], face, m_vertices, p);
+    MeshTools::normal(m_elements[element], face, m_vertices, n);
+    // Same order of operations as the plane equation (n, -n.p) applied to (point, 1)
+    double result = 0.0;
+    for (unsigned i = 0; i < 3; ++i) {
+      result += n[i] * point[i];
+    }
+    result += -MeshTools::dot(n, p);
+    if (result > 0.0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+unsigned seissol::geometry::ElementIndex::findElement(VrtxCoords const point) const {
+  unsigned found = NotFound;
+  if (m_nodes.empty()) {
+    return found;
+  }
+
+  std::vector<unsigned> stack;
+  stack.push_back(0);
+  while (!stack.empty()) {
+    Node const& node = m_nodes[stack.back()];
+    stack.pop_back();
+    bool const overlaps = node.min[0] <= point[0] && point[0] <= node.max[0] && node.min[1] <= point[1] &&
+                          point[1] <= node.max[1] && node.min[2] <= point[2] && point[2] <= node.max[2];
+    if (!overlaps) {
+      continue;
+    }
+    if (node.leaf) {
+      for (unsigned k = node.first; k < node.second; ++k) {
+        unsigned const element = m_order[k];
+        if (element < found && inside(element, point)) {
+          found = element;
+        }
+      }
+    } else {
+      stack.push_back(node.second);
+      stack.push_back(node.first);
+    }
+  }
+  return found;
+}
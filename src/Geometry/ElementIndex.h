@@ -0,0 +1,50 @@
+#ifndef SEISSOL_GEOMETRY_ELEMENTINDEX_H
+#define SEISSOL_GEOMETRY_ELEMENTINDEX_H
+
+#include <limits>
+#include <vector>
+
+#include "MeshDefinition.h"
+
+namespace seissol::geometry {
+/**
+ * Bounding volume hierarchy over the tetrahedra of a mesh for point location queries.
+ *
+ * The index is built once in O(n log n) (see MeshReader::getElementIndex) and a query visits only the
+ * elements whose bounding box contains the point, i.e. O(log n) for a conforming mesh. Queries are
+ * read-only and may run concurrently. The index refers to the elements and vertices of the mesh,
+ * hence it must not outlive them and becomes invalid if the vertices move.
+ **/
+class ElementIndex {
+  public:
+  static constexpr unsigned NotFound = std::numeric_limits<unsigned>::max();
+
+  ElementIndex(std::vector<Element> const& elements, std::vector<Vertex> const& vertices);
+
+  /**
+   * Returns the element which contains the point or NotFound.
+   * A point on the boundary of several elements is assigned to the one with the lowest id.
+   **/
+  unsigned findElement(VrtxCoords const point) const;
+
+  private:
+  struct Node {
+    double min[3];
+    double max[3];
+    //! Children of an inner node or range in m_order of a leaf
+    unsigned first;
+    unsigned second;
+    bool leaf;
+  };
+
+  unsigned build(unsigned begin, unsigned end, std::vector<double> const& centers);
+  bool inside(unsigned element, VrtxCoords const point) const;
+
+  std::vector<Element> const& m_elements;
+  std::vector<Vertex> const& m_vertices;
+  std::vector<Node> m_nodes;
+  std::vector<unsigned> m_order;
+};
+} // namespace seissol::geometry
+
+#endif // SEISSOL_GEOMETRY_ELEMENTINDEX_H
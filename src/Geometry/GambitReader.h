@@ -52,6 +52,7 @@
 #include <cstdlib>
 #include <iostream>
 #include <fstream>
+#include <limits>
 #include <map>
 #include <string>
 #include <vector>
@@ -196,7 +197,6 @@ private:
 		m_elements.resize(m_g2lElements.size());
 		int k = 0;
 		for (int i = 0; i < m_nGlobElements; i++) {
-			std::string line;
 			int elementRank = nextRank();
 
 			if (elementRank == m_rank) {
@@ -215,19 +215,19 @@ private:
 					m_mesh >> m_elements[k].vertices[j];
 					m_elements[k].vertices[j]--;
 
-					if (m_g2lVertices.find(m_elements[k].vertices[j]) == m_g2lVertices.end()) {
+					const int nextVertex = m_g2lVertices.size();
+					const std::pair<std::map<int, int>::iterator, bool> vertex
+						= m_g2lVertices.insert(std::make_pair(m_elements[k].vertices[j], nextVertex));
+					if (vertex.second) {
 						// First time we see this vertex
-						// put it in the g2l map and resize the vertex list
-						int nextVertex = m_g2lVertices.size();
-						m_g2lVertices[m_elements[k].vertices[j]] = nextVertex;
-
+						// resize the vertex list
 						assert(m_vertices.size() == m_g2lVertices.size() - 1);
 
 						m_vertices.resize(m_g2lVertices.size());
 					}
 
 					// Add this element to the vertex list
-					m_vertices[m_g2lVertices[m_elements[k].vertices[j]]].elements.push_back(k);
+					m_vertices[vertex.first->second].elements.push_back(k);
 
 					m_elements[k].rank = m_rank;
 					m_elements[k].neighbors[j] = -1;
@@ -239,7 +239,7 @@ private:
 			} else if (elementRank >= numPartitions) {
 				logError() << "Invalid Partition file. Found element rank" << elementRank;
 			} else {
-				getline(m_mesh, line);
+				skipLine();
 			}
 
 #ifdef PARALLEL
@@ -300,7 +300,7 @@ private:
 				m_mesh >> std::ws; // Skip rest of the line
 			} else {
 				// Not your element, ignore the boundary information
-				getline(m_mesh, line);
+				skipLine();
 			}
 		}
 
@@ -330,8 +330,9 @@ private:
 		for (int i = 0; i < groupSize; i++) {
 			int element;
 			m_mesh >> element;
-			if (m_g2lElements.find(element-1) != m_g2lElements.end())
-				m_elements[m_g2lElements[element-1]].group = groupId;
+			std::map<int, int>::const_iterator e = m_g2lElements.find(element-1);
+			if (e != m_g2lElements.end())
+				m_elements[e->second].group = groupId;
 		}
 
 		m_mesh >> std::ws;
@@ -393,8 +394,7 @@ private:
 				m_mesh >> std::ws; // Skip rest of the line
 			} else {
 				// Ignore our elements
-				std::string line;
-				getline(m_mesh, line);
+				skipLine();
 			}
 		}
 
@@ -431,8 +431,7 @@ private:
 				m_mesh >> std::ws; // Skip rest of the line
 			} else {
 				// Ignore the vertex, not in one of our elements
-				std::string line;
-				getline(m_mesh, line);
+				skipLine();
 			}
 		}
 
@@ -449,7 +448,7 @@ private:
 		for (std::vector<Element>::iterator i = m_elements.begin();
 				i != m_elements.end(); i++) {
 			for (int j = 0; j < 4; j++)
-				i->vertices[j] = m_g2lVertices[i->vertices[j]];
+				i->vertices[j] = m_g2lVertices.find(i->vertices[j])->second;
 		}
 	}
 
@@ -605,6 +604,17 @@ private:
 		elem2.neighborRanks[side2] = elem1.rank;
 	}
 
+	/**
+	 * Skips the rest of the current line of the mesh file
+	 *
+	 * Most lines of the mesh file belong to other ranks; ignoring them avoids
+	 * copying each line into a string.
+	 */
+	void skipLine()
+	{
+		m_mesh.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+	}
+
 	/**
 	 * @return The next rank from the partition file or 0 if MPI not compiled with MPI
 	 */
@@ -41,12 +41,15 @@
 #ifndef MESH_READER_H
 #define MESH_READER_H
 
+#include "ElementIndex.h"
 #include "MeshDefinition.h"
 #include "MeshTools.h"
 
 #include <algorithm>
 #include <cmath>
 #include <map>
+#include <memory>
+#include <utility>
 #include <vector>
 
 class MeshReader
@@ -58,6 +61,9 @@ protected:
 
 	std::vector<Vertex> m_vertices;
 
+	/** Global ids (in the mesh file) of the local elements; empty if the reader does not provide them */
+	std::vector<unsigned long> m_elementGlobalIds;
+
 	/** Convert global element index to local */
 	std::map<int, int> m_g2lElements;
 
@@ -73,9 +79,15 @@ protected:
 	/** Fault information */
 	std::vector<Fault> m_fault;
 
+	/** Maximum stable time step width (CFL number 1) of the local elements; empty until the material is known */
+	std::vector<double> m_cellTimeSteps;
+
 	/** Has a plus fault side */
 	bool m_hasPlusFault;
 
+	/** Point location index, built on first use */
+	mutable std::unique_ptr<seissol::geometry::ElementIndex> m_elementIndex;
+
 protected:
 	MeshReader(int rank)
 		: m_rank(rank), m_hasPlusFault(false)
@@ -96,6 +108,11 @@ public:
 		return m_vertices;
 	}
 
+	const std::vector<unsigned long>& getElementGlobalIds() const
+	{
+		return m_elementGlobalIds;
+	}
+
 	const std::map<int, MPINeighbor>& getMPINeighbors() const
 	{
 		return m_MPINeighbors;
@@ -111,6 +128,16 @@ public:
 		return m_fault;
 	}
 
+	const std::vector<double>& getCellTimeSteps() const
+	{
+		return m_cellTimeSteps;
+	}
+
+	void setCellTimeSteps(std::vector<double> cellTimeSteps)
+	{
+		m_cellTimeSteps = std::move(cellTimeSteps);
+	}
+
 	bool hasFault() const
 	{
 		return m_fault.size() > 0;
@@ -121,8 +148,20 @@ public:
 		return m_hasPlusFault;
 	}
 
+	/**
+	 * Returns the point location index of the local elements.
+	 * The index is built on the first call, which must not happen concurrently.
+	 */
+	const seissol::geometry::ElementIndex& getElementIndex() const
+	{
+		if (!m_elementIndex)
+			m_elementIndex.reset(new seissol::geometry::ElementIndex(m_elements, m_vertices));
+		return *m_elementIndex;
+	}
+
   void displaceMesh(double const displacement[3])
   {
+    m_elementIndex.reset();
     for (unsigned vertexNo = 0; vertexNo < m_vertices.size(); ++vertexNo) {
       for (unsigned i = 0; i < 3; ++i) {
         m_vertices[vertexNo].coords[i] += displacement[i];
@@ -134,6 +173,8 @@ public:
   // scalingMatrix_ij = scalingMatrix[j][i]
   void scaleMesh(double const scalingMatrix[3][3])
   {
+    m_elementIndex.reset();
+    m_cellTimeSteps.clear();
     for (unsigned vertexNo = 0; vertexNo < m_vertices.size(); ++vertexNo) {
       double x = m_vertices[vertexNo].coords[0];
       double y = m_vertices[vertexNo].coords[1];
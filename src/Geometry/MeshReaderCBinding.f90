@@ -80,6 +80,18 @@ module MeshReaderCBinding
             real(kind=c_double), dimension(*), intent(in)      :: scalingMatrix
         end subroutine
 
+        subroutine read_mesh_cube_c(numCubes, numPartitions, scale, boundaryCondition, hasFault, displacement, scalingMatrix) bind(C, name="read_mesh_cube_c")
+            use, intrinsic :: iso_c_binding
+
+            integer( kind=c_int ), dimension(*), intent(in)    :: numCubes
+            integer( kind=c_int ), dimension(*), intent(in)    :: numPartitions
+            real( kind=c_double ), value                       :: scale
+            integer( kind=c_int ), value                       :: boundaryCondition
+            logical( kind=c_bool ), value                      :: hasFault
+            real(kind=c_double), dimension(*), intent(in)      :: displacement
+            real(kind=c_double), dimension(*), intent(in)      :: scalingMatrix
+        end subroutine
+
         subroutine read_mesh_puml_c(meshfile, &
                                     checkPointFile, &
                                     hasFault, &
@@ -91,7 +103,9 @@ module MeshReaderCBinding
                                     vertexWeightElement, &
                                     vertexWeightDynamicRupture, &
                                     vertexWeightFreeSurfaceWithGravity, &
+                                    edgeWeightDynamicRupture, &
                                     usePlasticity, &
+                                    communicationEdgeWeights, &
                                     maximumAllowedTimeStep) bind(C, name="read_mesh_puml_c")
             use, intrinsic :: iso_c_binding
 
@@ -102,7 +116,9 @@ module MeshReaderCBinding
             integer(kind=c_int), value, intent(in) :: clusterRate, ltsWeightsTypeId
             integer(kind=c_int), value, intent(in) :: vertexWeightElement, vertexWeightDynamicRupture
             integer(kind=c_int), value, intent(in) :: vertexWeightFreeSurfaceWithGravity
+            integer(kind=c_int), value, intent(in) :: edgeWeightDynamicRupture
             logical(kind=c_bool), value :: usePlasticity
+            logical(kind=c_bool), value :: communicationEdgeWeights
             real(kind=c_double), value :: maximumAllowedTimeStep
         end subroutine
     end interface
@@ -158,8 +174,18 @@ contains
                                     MESH%vertexWeightElement, &
                                     MESH%vertexWeightDynamicRupture, &
                                     MESH%vertexWeightFreeSurfaceWithGravity, &
+                                    MESH%edgeWeightDynamicRupture, &
                                     logical(EQN%Plasticity == 1, 1), &
+                                    logical(MESH%communicationEdgeWeights == 1, 1), &
                                     DISC%FixTimeStep)
+        elseif (io%meshgenerator .eq. 'CubeGenerator') then
+            call read_mesh_cube_c(  int(MESH%cubeSize(:), c_int),               &
+                                    int(MESH%cubePartitions(:), c_int),         &
+                                    real(MESH%cubeScale, c_double),             &
+                                    int(MESH%cubeBoundary, c_int),              &
+                                    hasFault,                                   &
+                                    MESH%Displacement(:),                       &
+                                    m_mesh%ScalingMatrix(:,:))
         else
             logError(*) 'Unknown mesh reader'
             call MPI_ABORT(m_mpi%commWorld, 134)
@@ -345,15 +371,12 @@ contains
         m_mpi => mpi
     end subroutine cBindingStructs
 
-    subroutine allocVertices(n, maxElements) bind(C)
+    subroutine allocVertices(n) bind(C)
         implicit none
 
         integer( kind=c_int ), value :: n
-        integer( kind=c_int ), value :: maxElements
 
         allocate(m_mesh%VRTX%xyNode(3, n))
-        allocate(m_mesh%VRTX%NrOfElementsConnected(n))
-        allocate(m_mesh%VRTX%Element(n, maxElements)) ! TODO swap rows/colomns
 
         ! Not required in our implementation, but will be freed by SeisSol
         allocate(m_mesh%VRTX%Reference(0))
@@ -369,13 +392,8 @@ contains
         allocate(m_mesh%ELEM%Reference(0:4, n))
         allocate(m_mesh%ELEM%MPIReference(0:4, n))
         allocate(m_mesh%ELEM%MPINumber(4, n))
-        if (m_eqn%DR .eq. 1) then
-            allocate(m_mesh%ELEM%MPINumber_DR(4, n))
-        endif
         allocate(m_mesh%ELEM%BoundaryToObject(4, n))
         allocate(m_mesh%ELEM%SideNeighbor(4, n))
-        allocate(m_mesh%ELEM%LocalNeighborSide(4, n))
-        allocate(m_mesh%ELEM%LocalNeighborVrtx(4, n))
     end subroutine allocElements
 
     subroutine allocBndObjs(n) bind (C)
@@ -431,26 +449,6 @@ contains
         ptr = c_loc(m_mesh%VRTX%xyNode(1,1))
     end subroutine getVerticesXY
 
-    subroutine getVerticesNElements(s, ptr) bind(C)
-        implicit none
-
-        integer( kind=c_int ), intent(out) :: s
-        type(c_ptr), intent(out) :: ptr
-
-        s = size(m_mesh%VRTX%NrOfElementsConnected)
-        ptr = c_loc(m_mesh%VRTX%NrOfElementsConnected(1))
-    end subroutine getVerticesNElements
-
-    subroutine getVerticesElements(s, ptr) bind(C)
-        implicit none
-
-        integer( kind=c_int ), intent(out) :: s
-        type(c_ptr), intent(out) :: ptr
-
-        s = size(m_mesh%VRTX%Element, 1)
-        ptr = c_loc(m_mesh%VRTX%Element(1,1))
-    end subroutine getVerticesElements
-
     subroutine getElementVertices(s, ptr) bind(C)
         implicit none
 
@@ -491,16 +489,6 @@ contains
         ptr = c_loc(m_mesh%ELEM%MPINumber(1,1))
     end subroutine getMPINumber
 
-    subroutine getMPINumberDR(s, ptr) bind(C)
-        implicit none
-
-        integer( kind=c_int ), intent(out) :: s
-        type(c_ptr), intent(out) :: ptr
-
-        s = size(m_mesh%ELEM%MPINumber_DR, 2)
-        ptr = c_loc(m_mesh%ELEM%MPINumber_DR(1,1))
-    end subroutine getMPINumberDR
-
     subroutine getBoundaryToObject(s, ptr) bind(C)
         implicit none
 
@@ -521,26 +509,6 @@ contains
         ptr = c_loc(m_mesh%ELEM%SideNeighbor(1,1))
     end subroutine getSideNeighbor
 
-    subroutine getLocalNeighborSide(s, ptr) bind(C)
-        implicit none
-
-        integer( kind=c_int ), intent(out) :: s
-        type(c_ptr), intent(out) :: ptr
-
-        s = size(m_mesh%ELEM%LocalNeighborSide, 2)
-        ptr = c_loc(m_mesh%ELEM%LocalNeighborSide(1, 1))
-    end subroutine getLocalNeighborSide
-
-    subroutine getLocalNeighborVrtx(s, ptr) bind(C)
-        implicit none
-
-        integer( kind=c_int ), intent(out) :: s
-        type(c_ptr), intent(out) :: ptr
-
-        s = size(m_mesh%ELEM%LocalNeighborVrtx, 2)
-        ptr = c_loc(m_mesh%ELEM%LocalNeighborVrtx(1, 1))
-    end subroutine getLocalNeighborVrtx
-
     subroutine getBndSize(s) bind(C)
         implicit none
 
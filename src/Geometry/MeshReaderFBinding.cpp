@@ -44,6 +44,7 @@
 
 #include "SeisSol.h"
 #include "MeshReaderFBinding.h"
+#include "CubeGenerator.h"
 #include "GambitReader.h"
 #ifdef USE_NETCDF
 #include "NetcdfReader.h"
@@ -60,6 +61,8 @@
 
 void read_mesh(int rank, MeshReader &meshReader, bool hasFault, double const displacement[3], double const scalingMatrix[3][3])
 {
+	seissol::SeisSol::main.startupProfiler().startPhase("mesh_setup");
+
 	logInfo(rank) << "Reading mesh. Done.";
 
 	meshReader.displaceMesh(displacement);
@@ -69,49 +72,31 @@ void read_mesh(int rank, MeshReader &meshReader, bool hasFault, double const dis
 	const std::vector<Vertex>& vertices = meshReader.getVertices();
 	const std::map<int, MPINeighbor>& mpiNeighbors = meshReader.getMPINeighbors();
 
-	// Compute maximum element for one vertex
-	size_t maxElements = 0;
-	for (std::vector<Vertex>::const_iterator i = vertices.begin();
-			i != vertices.end(); i++)
-		maxElements = std::max(maxElements, i->elements.size());
-
+	// Only the parts of the mesh which the Fortran code still reads are copied;
+	// the vertex-to-element connectivity and the neighbor orientations are only kept in the MeshReader
 	allocelements(elements.size());
-	allocvertices(vertices.size(), maxElements);
+	allocvertices(vertices.size());
 	allocbndobjs(mpiNeighbors.size());
 
 	// Set vertices
 	int size;
 	double* verticesXY;
-	int* verticesNElements;
-	int* verticesElements;
 	getverticesxy(&size, &verticesXY);
-	getverticesnelements(&size, &verticesNElements);
-	getverticeselements(&size, &verticesElements);
 	for (int i = 0; i < size; i++) {
 		for (int j = 0; j < 3; j++) {
 			verticesXY[i*3+j] = vertices[i].coords[j];
 		}
-
-		verticesNElements[i] = vertices[i].elements.size();
-
-		for (unsigned int j = 0; j < vertices[i].elements.size(); j++) {
-			verticesElements[i+j*vertices.size()] = vertices[i].elements[j] + 1;
-		}
 	}
 
 	// Set elements
 	int* elementVertices;
 	int* sideNeighbor;
-	int* localNeighborSide;
-	int* localNeighborVrtx;
 	int* reference;
 	int* mpiReference;
 	int* mpiNumber;
 	int* boundaryToObject;
 	getelementvertices(&size, &elementVertices);
 	getsideneighbor(&size, &sideNeighbor);
-	getlocalneighborside(&size, &localNeighborSide);
-	getlocalneighborvrtx(&size, &localNeighborVrtx);
 	getreference(&size, &reference);
 	getmpireference(&size, &mpiReference);
 	getmpinumber(&size, &mpiNumber);
@@ -130,13 +115,9 @@ void read_mesh(int rank, MeshReader &meshReader, bool hasFault, double const dis
 			case 0:
 			case 3:
 			case 6:
-				localNeighborSide[i*4+j] = elements[i].neighborSides[j] + 1;
-				localNeighborVrtx[i*4+j] = elements[i].sideOrientations[j] + 1;
 				boundaryToObject[i*4+j] = 0;
 				break;
 			default:
-				localNeighborSide[i*4+j] = 1;
-				localNeighborVrtx[i*4+j] = 1;
 				boundaryToObject[i*4+j] = 1;
 			}
 
@@ -174,18 +155,6 @@ void read_mesh(int rank, MeshReader &meshReader, bool hasFault, double const dis
 		getfaultreferencepoint(&center[0], &center[1], &center[2], &refPointMethod);
 		meshReader.findFault(center, refPointMethod);
 
-		int* mpiNumberDr;
-		getmpinumberdr(&size, &mpiNumberDr);
-
-		for (int i = 0; i < size; i++) {
-			for (int j = 0; j < 4; j++) {
-				if (elements[i].neighborRanks[j] == rank)
-					mpiNumberDr[i*4+j] = -1;
-				else
-					mpiNumberDr[i*4+j] = elements[i].mpiFaultIndices[j] + 1;
-			}
-		}
-
 		const std::vector<Fault>& fault = meshReader.getFault();
 		const std::map<int, std::vector<MPINeighborElement> >& mpiFaultNeighbors = meshReader.getMPIFaultNeighbors();
 
@@ -253,6 +222,7 @@ void read_mesh_gambitfast_c(int rank, const char* meshfile, const char* partitio
     seissol::Stopwatch watch;
 	watch.start();
 
+	seissol::SeisSol::main.startupProfiler().startPhase("mesh_read");
 	seissol::SeisSol::main.setMeshReader(new GambitReader(rank, meshfile, partitionfile));
 
 	read_mesh(rank, seissol::SeisSol::main.meshReader(), hasFault, displacement, scalingMatrix);
@@ -271,6 +241,7 @@ void read_mesh_netcdf_c(int rank, int nProcs, const char* meshfile, bool hasFaul
     seissol::Stopwatch watch;
 	watch.start();
 
+	seissol::SeisSol::main.startupProfiler().startPhase("mesh_read");
 	seissol::SeisSol::main.setMeshReader(new NetcdfReader(rank, nProcs, meshfile));
 
 	read_mesh(rank, seissol::SeisSol::main.meshReader(), hasFault, displacement, scalingMatrix);
@@ -284,6 +255,41 @@ void read_mesh_netcdf_c(int rank, int nProcs, const char* meshfile, bool hasFaul
 }
 
 
+void read_mesh_cube_c(int const numCubes[3],
+                      int const numPartitions[3],
+                      double scale,
+                      int boundaryCondition,
+                      bool hasFault,
+                      double const displacement[3],
+                      double const scalingMatrix[3][3]) {
+	SCOREP_USER_REGION("read_mesh", SCOREP_USER_REGION_TYPE_FUNCTION);
+
+	const int rank = seissol::MPI::mpi.rank();
+	logInfo(rank) << "Generating a cube mesh";
+
+	seissol::Stopwatch watch;
+	watch.start();
+
+	std::array<unsigned, 3> cubes;
+	std::array<unsigned, 3> partitions;
+	for (int i = 0; i < 3; i++) {
+		if (numCubes[i] <= 0 || numPartitions[i] < 0) {
+			logError() << "Invalid cube mesh: cubeX/Y/Z have to be positive and cubePx/y/z non-negative";
+		}
+		cubes[i] = numCubes[i];
+		partitions[i] = numPartitions[i];
+	}
+	seissol::SeisSol::main.startupProfiler().startPhase("mesh_read");
+	seissol::SeisSol::main.setMeshReader(new seissol::geometry::CubeGenerator(
+		rank, seissol::MPI::mpi.size(), cubes, partitions, scale, boundaryCondition));
+
+	read_mesh(rank, seissol::SeisSol::main.meshReader(), hasFault, displacement, scalingMatrix);
+
+	watch.pause();
+	watch.printTime("Mesh initialized in:");
+}
+
+
 void read_mesh_puml_c(const char* meshfile,
                       const char* checkPointFile,
                       bool hasFault,
@@ -295,7 +301,9 @@ void read_mesh_puml_c(const char* meshfile,
                       int vertexWeightElement,
                       int vertexWeightDynamicRupture,
                       int vertexWeightFreeSurfaceWithGravity,
+                      int edgeWeightDynamicRupture,
                       bool usePlasticity,
+                      bool communicationEdgeWeights,
                       double maximumAllowedTimeStep) {
 	SCOREP_USER_REGION("read_mesh", SCOREP_USER_REGION_TYPE_FUNCTION);
 
@@ -303,12 +311,11 @@ void read_mesh_puml_c(const char* meshfile,
 	const int rank = seissol::MPI::mpi.rank();
 	double tpwgt = 1.0;
 
-	if constexpr (!seissol::isDeviceOn()) {
 #ifdef USE_MINI_SEISSOL
     if (seissol::MPI::mpi.size() > 1) {
-      logInfo(rank) << "Running mini SeisSol to determine node weight";
-      tpwgt = 1.0 / seissol::miniSeisSol(seissol::SeisSol::main.getMemoryManager(),
-                                         usePlasticity);
+      seissol::SeisSol::main.startupProfiler().startPhase("mini_seissol");
+      tpwgt = 1.0 / seissol::cachedMiniSeisSol(seissol::SeisSol::main.getMemoryManager(),
+                                               usePlasticity);
 
       const auto summary = seissol::statistics::parallelSummary(tpwgt);
       logInfo(rank) << "Node weights: mean =" << summary.mean
@@ -320,7 +327,6 @@ void read_mesh_puml_c(const char* meshfile,
 #else
     logInfo(rank) << "Skipping mini SeisSol";
 #endif
-  }
 
 	logInfo(rank) << "Reading PUML mesh" << meshfile;
 
@@ -335,7 +341,10 @@ void read_mesh_puml_c(const char* meshfile,
 		static_cast<unsigned int>(clusterRate),
 		vertexWeightElement,
 		vertexWeightDynamicRupture,
-		vertexWeightFreeSurfaceWithGravity
+		vertexWeightFreeSurfaceWithGravity,
+		edgeWeightDynamicRupture,
+		usePlasticity,
+		communicationEdgeWeights
 	};
 
 	LtsWeightsTypes ltsWeightsType{};
@@ -39,7 +39,7 @@ extern "C" {
 
 // Functions implemented in Fortran
 void allocelements(int n);
-void allocvertices(int n, int maxElements);
+void allocvertices(int n);
 void allocbndobjs(int n);
 void allocbndobj(int i, int n);
 void allocbndobjfault(int i, int n);
@@ -48,18 +48,13 @@ void allocfault(int n);
 void hasplusfault();
 
 void getverticesxy(int* size, double** verticesXY);
-void getverticesnelements(int* size, int** nelements);
-void getverticeselements(int* size, int** elements);
 
 void getelementvertices(int* size, int** vertices);
 void getreference(int* size, int** reference);
 void getmpireference(int* size, int** mpireference);
 void getmpinumber(int* size, int** mpinumber);
-void getmpinumberdr(int* size, int** mpinumberdr);
 void getboundarytoobject(int* size, int** boundarytoobject);
 void getsideneighbor(int* size, int** sideneighbor);
-void getlocalneighborside(int* size, int** localneighborside);
-void getlocalneighborvrtx(int* size, int** localneighborvrtx);
 
 void getbndsize(int* size);
 void getbndrank(int i, int* rank);
@@ -37,6 +37,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <string>
 #include <unordered_map>
 
@@ -44,15 +45,29 @@
 #include "PUML/PartitionMetis.h"
 #include "PUML/Downward.h"
 #include "PUML/Neighbor.h"
+#include <parmetis.h>
 
 #include "PUMLReader.h"
+#include "PartitionMapping.h"
+#include "UniformRefinement.h"
 #include "Monitoring/instrumentation.fpp"
+#include "Monitoring/Stopwatch.h"
+#include "Numerical_aux/Statistics.h"
 
+#include "Initializer/Hash.h"
+#include "SeisSol.h"
 #include "Initializer/time_stepping/LtsWeights/LtsWeights.h"
+#include "utils/env.h"
 
 #include <hdf5.h>
+#include <iomanip>
 #include <sstream>
 #include <fstream>
+#include <sys/stat.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 class GlobalFaceSorter
 {
@@ -76,22 +91,55 @@ public:
 seissol::PUMLReader::PUMLReader(const char *meshFile, double maximumAllowedTimeStep,
                                 const char* checkPointFile, initializers::time_stepping::LtsWeights* ltsWeights,
                                 double tpwgt, bool readPartitionFromFile)
-	: MeshReader(MPI::mpi.rank())
+	: MeshReader(MPI::mpi.rank()), m_meshFile(meshFile), m_checkPointFile(checkPointFile),
+	  m_refinementLevels(utils::Env::get<unsigned int>("SEISSOL_MESH_REFINEMENT", 0))
 {
 	PUML::TETPUML puml;
 	puml.setComm(MPI::mpi.comm());
 
-	read(puml, meshFile);
-  
-	if (ltsWeights != nullptr) {
-		generatePUML(puml);
-		ltsWeights->computeWeights(puml, maximumAllowedTimeStep);
-	}
-	partition(puml, ltsWeights, tpwgt, meshFile, readPartitionFromFile, checkPointFile);
+	auto& profiler = SeisSol::main.startupProfiler();
 
+	Stopwatch watch;
+	profiler.startPhase("mesh_read");
+	watch.start();
+	read(puml, meshFile);
+	watch.pause();
+	watch.printTime("PUML: mesh read in:");
+
+	watch.reset();
+	profiler.startPhase("mesh_partition");
+	watch.start();
+	partition(puml, ltsWeights, maximumAllowedTimeStep, tpwgt, readPartitionFromFile, checkPointFile);
+	watch.pause();
+	watch.printTime("PUML: mesh partitioned in:");
+
+	watch.reset();
+	profiler.startPhase("mesh_generate");
+	watch.start();
 	generatePUML(puml);
+	watch.pause();
+	watch.printTime("PUML: partitioned mesh generated in:");
 
+	watch.reset();
+	profiler.startPhase("mesh_build");
+	watch.start();
 	getMesh(puml);
+	watch.pause();
+	watch.printTime("PUML: local mesh built in:");
+
+	if (m_refinementLevels > 0) {
+		watch.reset();
+		profiler.startPhase("mesh_refine");
+		watch.start();
+		for (unsigned int level = 0; level < m_refinementLevels; ++level) {
+			geometry::refineUniformly(MPI::mpi.rank(), m_elements, m_vertices, m_MPINeighbors, m_elementGlobalIds);
+		}
+		watch.pause();
+		watch.printTime("PUML: mesh refined in:");
+		logInfo(MPI::mpi.rank()) << "PUML: refined the mesh" << m_refinementLevels << "times to" << m_elements.size() << "local cells";
+	}
+
+	logCutDynamicRuptureFaces();
 }
 
 void seissol::PUMLReader::read(PUML::TETPUML &puml, const char* meshFile)
@@ -105,7 +153,7 @@ void seissol::PUMLReader::read(PUML::TETPUML &puml, const char* meshFile)
 	puml.addData((file + ":/boundary").c_str(), PUML::CELL);
 }
 
-int seissol::PUMLReader::readPartition(PUML::TETPUML &puml, int* partition, const char* checkPointFile)
+int seissol::PUMLReader::readPartition(PUML::TETPUML &puml, int* partition, const std::string &fname, uint64_t key)
 {
 	/*
 	write the partionning array to an hdf5 file using parallel access
@@ -136,13 +184,10 @@ int seissol::PUMLReader::readPartition(PUML::TETPUML &puml, int* partition, cons
 	hid_t plist_id = H5Pcreate(H5P_FILE_ACCESS);
 	H5Pset_fapl_mpio(plist_id, seissol::MPI::mpi.comm(), info);
 
-	std::ostringstream os;
-	os << checkPointFile<<"_partitions_o" <<CONVERGENCE_ORDER<<"_n"<< nrank << ".h5";
-	std::string fname = os.str();
-
 	std::ifstream ifile(fname.c_str());
 	if (!ifile) { 
 		logInfo(rank) <<fname.c_str()<<"does not exist";
+		H5Pclose(plist_id);
 		return -1;
 	}
 
@@ -150,6 +195,31 @@ int seissol::PUMLReader::readPartition(PUML::TETPUML &puml, int* partition, cons
 	H5Pclose(plist_id);
 
 	hid_t dataset = H5Dopen2(file, "/partition", H5P_DEFAULT);
+
+	/*
+	 Validate the partition against the mesh and, if the file has a key, against the partitioning parameters
+	*/
+	hsize_t dimFile[1] = {0};
+	hid_t space = H5Dget_space(dataset);
+	H5Sget_simple_extent_dims(space, dimFile, NULL);
+	H5Sclose(space);
+	bool valid = dimFile[0] == static_cast<hsize_t>(offsets[nrank-1] + num_cells[nrank-1]);
+	if (valid && key != 0 && H5Aexists(dataset, "key") > 0) {
+		uint64_t fileKey = 0;
+		hid_t attribute = H5Aopen(dataset, "key", H5P_DEFAULT);
+		H5Aread(attribute, H5T_NATIVE_UINT64, &fileKey);
+		H5Aclose(attribute);
+		valid = fileKey == key;
+	}
+	delete [] num_cells;
+	if (!valid) {
+		logWarning(rank) << fname.c_str() << "does not match the mesh or the LTS weights; the mesh is partitioned again.";
+		H5Dclose(dataset);
+		H5Fclose(file);
+		delete [] offsets;
+		return -1;
+	}
+
 	/* 
 	 Create memspace (portion of filespace) and read collectively the data
 	*/
@@ -167,15 +237,19 @@ int seissol::PUMLReader::readPartition(PUML::TETPUML &puml, int* partition, cons
 
 	if (status<0)
 		logError() << "An error occured when reading the partitionning with HDF5";
+	H5Pclose(plist_id);
+	H5Sclose(memspace);
+	H5Sclose(filespace);
 	H5Dclose(dataset);
 	H5Fclose(file);
+	delete [] offsets;
 
 	logInfo(rank)<<"partitionning was read successfully from "<<fname.c_str();
 	return 0;
 }
 
 
-void seissol::PUMLReader::writePartition(PUML::TETPUML &puml, int* partition, const char *checkPointFile)
+void seissol::PUMLReader::writePartition(PUML::TETPUML &puml, int* partition, const std::string &fname, uint64_t key)
 {
 	/*
 	write the partionning array to an hdf5 file using parallel access
@@ -209,10 +283,6 @@ void seissol::PUMLReader::writePartition(PUML::TETPUML &puml, int* partition, co
 	hid_t plist_id = H5Pcreate(H5P_FILE_ACCESS);
 	H5Pset_fapl_mpio(plist_id, seissol::MPI::mpi.comm(), info);
 
-	std::ostringstream os;
-	os << checkPointFile<<"_partitions_o" <<CONVERGENCE_ORDER<<"_n"<< nrank << ".h5";
-	std::string fname = os.str();
-
 	hid_t file = H5Fcreate(fname.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, plist_id);
 	H5Pclose(plist_id);
 
@@ -220,6 +290,14 @@ void seissol::PUMLReader::writePartition(PUML::TETPUML &puml, int* partition, co
 	hid_t dataset = H5Dcreate(file, "/partition", H5T_NATIVE_INT, filespace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
 	H5Sclose(filespace);
 
+	if (key != 0) {
+		hid_t keySpace = H5Screate(H5S_SCALAR);
+		hid_t attribute = H5Acreate2(dataset, "key", H5T_NATIVE_UINT64, keySpace, H5P_DEFAULT, H5P_DEFAULT);
+		H5Awrite(attribute, H5T_NATIVE_UINT64, &key);
+		H5Aclose(attribute);
+		H5Sclose(keySpace);
+	}
+
 	/* 
 	 Create memspace (portion of filespace) and write collectively the data
 	*/
@@ -243,14 +321,14 @@ void seissol::PUMLReader::writePartition(PUML::TETPUML &puml, int* partition, co
 
 void seissol::PUMLReader::partition(  PUML::TETPUML &puml,
                                       initializers::time_stepping::LtsWeights* ltsWeights,
+                                      double maximumAllowedTimeStep,
                                       double tpwgt,
-                                      const char *meshFile,
                                       bool readPartitionFromFile,
                                       const char *checkPointFile )
 {
 	SCOREP_USER_REGION("PUMLReader_partition", SCOREP_USER_REGION_TYPE_FUNCTION);
 
-	int* partition = new int[puml.numOriginalCells()];
+	std::vector<int> partition(puml.numOriginalCells());
 
   auto partitionMetis = [&] {
     PUML::TETPartitionMetis metis(puml.originalCells(), puml.numOriginalCells());
@@ -269,14 +347,18 @@ void seissol::PUMLReader::partition(  PUML::TETPUML &puml,
     double* nodeWeights = &tpwgt;
 #endif
 
-    auto status = metis.partition(partition,
-                                  ltsWeights->vertexWeights(),
-                                  ltsWeights->imbalances(),
-                                  ltsWeights->nWeightsPerVertex(),
-                                  nodeWeights);
-
-    if (status == PUML::TETPartitionMetis::Status::Error) {
-      logError() << "mesh partitioning step failed";
+    if (!ltsWeights->dualGraph().offsets.empty()) {
+      partitionDualGraph(puml, *ltsWeights, nodeWeights, partition.data());
+    } else {
+      auto status = metis.partition(partition.data(),
+                                    ltsWeights->vertexWeights(),
+                                    ltsWeights->imbalances(),
+                                    ltsWeights->nWeightsPerVertex(),
+                                    nodeWeights);
+
+      if (status == PUML::TETPartitionMetis::Status::Error) {
+        logError() << "mesh partitioning step failed";
+      }
     }
 
 #ifdef USE_MPI
@@ -284,18 +366,302 @@ void seissol::PUMLReader::partition(  PUML::TETPUML &puml,
 #endif
   };
 
+  // The weights require the mesh in the original distribution; they are not needed for a stored partition
+  auto computeWeights = [&] {
+    if (ltsWeights != nullptr) {
+      generatePUML(puml);
+      ltsWeights->computeWeights(puml, maximumAllowedTimeStep);
+    }
+  };
+
+  // Stored partitions: the one of the checkpoint and the one in the partition cache
+  static const std::string cacheDirectory = utils::Env::get("SEISSOL_PARTITION_CACHE", "");
+  std::vector<std::string> partitionFiles;
   if (readPartitionFromFile) {
-    int status = readPartition(puml, &partition[0], checkPointFile);
-    if (status < 0) {
-      partitionMetis();
-      writePartition(puml, partition, checkPointFile);
+    partitionFiles.push_back(partitionFileName(checkPointFile));
+  }
+  uint64_t key = 0;
+  if (readPartitionFromFile || !cacheDirectory.empty()) {
+    key = partitionKey(ltsWeights, maximumAllowedTimeStep, tpwgt);
+  }
+  if (!cacheDirectory.empty()) {
+    std::ostringstream prefix;
+    prefix << cacheDirectory << "/mesh-" << std::hex << std::setw(16) << std::setfill('0') << key;
+    partitionFiles.push_back(partitionFileName(prefix.str()));
+  }
+
+  bool found = false;
+  for (const auto& partitionFile : partitionFiles) {
+    if (readPartition(puml, partition.data(), partitionFile, key) == 0) {
+      found = true;
+      break;
     }
-  } else {
+  }
+  if (!found) {
+    computeWeights();
     partitionMetis();
+    for (const auto& partitionFile : partitionFiles) {
+      writePartition(puml, partition.data(), partitionFile, key);
+    }
+  }
+
+  static const bool usePartitionMapping = utils::Env::get<int>("SEISSOL_PARTITION_MAPPING", 0) != 0;
+  if (usePartitionMapping) {
+    mapPartitions(puml, ltsWeights, tpwgt, partition);
   }
 
-	puml.partition(partition);
-	delete [] partition;
+	puml.partition(partition.data());
+}
+
+void seissol::PUMLReader::partitionDualGraph(PUML::TETPUML &puml,
+                                            const initializers::time_stepping::LtsWeights &ltsWeights,
+                                            const double* nodeWeights,
+                                            int* partition)
+{
+	SCOREP_USER_REGION("PUMLReader_partitionDualGraph", SCOREP_USER_REGION_TYPE_FUNCTION);
+	const int rank = seissol::MPI::mpi.rank();
+	const int nrank = seissol::MPI::mpi.size();
+	const auto& graph = ltsWeights.dualGraph();
+
+	idx_t nCells = puml.numOriginalCells();
+	std::vector<idx_t> vtxdist(nrank + 1, 0);
+	MPI_Allgather(&nCells, 1, IDX_T, &vtxdist[1], 1, IDX_T, MPI::mpi.comm());
+	for (int rk = 0; rk < nrank; ++rk) {
+		vtxdist[rk+1] += vtxdist[rk];
+	}
+
+	idx_t ncon = ltsWeights.nWeightsPerVertex();
+	std::vector<idx_t> xadj(graph.offsets.begin(), graph.offsets.end());
+	std::vector<idx_t> adjncy(graph.neighbors.begin(), graph.neighbors.end());
+	std::vector<idx_t> adjwgt(graph.edgeWeights.begin(), graph.edgeWeights.end());
+	std::vector<idx_t> vwgt(ltsWeights.vertexWeights(), ltsWeights.vertexWeights() + nCells * ncon);
+	std::vector<real_t> tpwgts(nrank * ncon);
+	for (int rk = 0; rk < nrank; ++rk) {
+		for (idx_t i = 0; i < ncon; ++i) {
+			tpwgts[rk * ncon + i] = nodeWeights[rk];
+		}
+	}
+	std::vector<real_t> ubvec(ltsWeights.imbalances(), ltsWeights.imbalances() + ncon);
+
+	idx_t wgtflag = 3;
+	idx_t numflag = 0;
+	idx_t nparts = nrank;
+	idx_t options[3] = {0, 0, 0};
+	idx_t edgecut = 0;
+	std::vector<idx_t> part(nCells);
+	MPI_Comm comm = MPI::mpi.comm();
+
+	const int status = ParMETIS_V3_PartKway(vtxdist.data(), xadj.data(), adjncy.data(), vwgt.data(), adjwgt.data(),
+		&wgtflag, &numflag, &ncon, &nparts, tpwgts.data(), ubvec.data(), options, &edgecut, part.data(), &comm);
+	if (status != METIS_OK) {
+		logError() << "mesh partitioning step failed";
+	}
+	std::copy(part.begin(), part.end(), partition);
+
+	logInfo(rank) << "Partitioned the mesh with edge weights; weighted edge cut:" << edgecut;
+}
+
+void seissol::PUMLReader::mapPartitions(PUML::TETPUML &puml,
+                                        const initializers::time_stepping::LtsWeights* ltsWeights,
+                                        double tpwgt,
+                                        std::vector<int> &partition)
+{
+	SCOREP_USER_REGION("PUMLReader_mapPartitions", SCOREP_USER_REGION_TYPE_FUNCTION);
+	const int rank = seissol::MPI::mpi.rank();
+
+	// The partitions are sized for the node weights of their ranks
+	double minWeight = tpwgt;
+	double maxWeight = tpwgt;
+	MPI_Allreduce(MPI_IN_PLACE, &minWeight, 1, MPI_DOUBLE, MPI_MIN, MPI::mpi.comm());
+	MPI_Allreduce(MPI_IN_PLACE, &maxWeight, 1, MPI_DOUBLE, MPI_MAX, MPI::mpi.comm());
+	if (minWeight != maxWeight) {
+		logWarning(rank) << "Partitions are not mapped to ranks, since the node weights of the ranks differ.";
+		return;
+	}
+
+	Stopwatch watch;
+	watch.start();
+
+	// The cluster ids are only known if the weights were computed (i.e. not for a stored partition)
+	const int* clusterIds = nullptr;
+	unsigned rate = 1;
+	if (ltsWeights != nullptr && ltsWeights->clusterIds().size() == puml.numOriginalCells()) {
+		clusterIds = ltsWeights->clusterIds().data();
+		rate = ltsWeights->rate();
+	}
+
+	const auto edges = geometry::computePartitionGraph(puml.originalCells(), puml.numOriginalCells(),
+	                                                   partition.data(), clusterIds, rate, MPI::mpi.comm());
+	const auto nodeOfRank = geometry::computeNodeOfRanks(MPI::mpi.comm());
+	const auto rankOfPartition = geometry::mapPartitionsToRanks(edges, nodeOfRank);
+
+	std::vector<int> identity(nodeOfRank.size());
+	for (std::size_t partitionId = 0; partitionId < identity.size(); ++partitionId) {
+		identity[partitionId] = partitionId;
+	}
+	double totalWeight = 0.0;
+	for (const auto& edge : edges) {
+		totalWeight += edge.weight;
+	}
+	if (totalWeight > 0.0) {
+		logInfo(rank) << "Partition mapping: share of the communication within the nodes increased from"
+			<< geometry::intraNodeWeight(edges, identity, nodeOfRank) / totalWeight << "to"
+			<< geometry::intraNodeWeight(edges, rankOfPartition, nodeOfRank) / totalWeight;
+	}
+
+	for (auto& cellPartition : partition) {
+		cellPartition = rankOfPartition[cellPartition];
+	}
+
+	watch.pause();
+	watch.printTime("Partitions mapped to ranks in:");
+}
+
+std::string seissol::PUMLReader::partitionFileName(const std::string &prefix)
+{
+	std::ostringstream os;
+	os << prefix << "_partitions_o" << CONVERGENCE_ORDER << "_n" << seissol::MPI::mpi.size() << ".h5";
+	return os.str();
+}
+
+uint64_t seissol::PUMLReader::partitionKey(const initializers::time_stepping::LtsWeights* ltsWeights,
+                                           double maximumAllowedTimeStep,
+                                           double tpwgt) const
+{
+	const int nrank = seissol::MPI::mpi.size();
+	std::vector<double> nodeWeights(nrank);
+	MPI_Allgather(&tpwgt, 1, MPI_DOUBLE, nodeWeights.data(), 1, MPI_DOUBLE, MPI::mpi.comm());
+
+	// The mesh file is identified by its name, size and modification time (hashing the content would
+	// take as long as reading the mesh); rank 0 decides such that all ranks use the same file.
+	uint64_t key = 0;
+	if (seissol::MPI::mpi.rank() == 0) {
+		key = initializers::hashBytes(m_meshFile.data(), m_meshFile.size());
+		struct stat meshStat;
+		if (stat(m_meshFile.c_str(), &meshStat) == 0) {
+			key = initializers::hashValue(static_cast<int64_t>(meshStat.st_size), key);
+			key = initializers::hashValue(static_cast<int64_t>(meshStat.st_mtime), key);
+		}
+		if (ltsWeights != nullptr) {
+			key = ltsWeights->hash(key);
+		}
+		key = initializers::hashValue(maximumAllowedTimeStep, key);
+		key = initializers::hashBytes(nodeWeights.data(), nodeWeights.size() * sizeof(double), key);
+		key = initializers::hashValue(nrank, key);
+		key = initializers::hashValue(CONVERGENCE_ORDER, key);
+		// zero marks files without a key
+		key = std::max<uint64_t>(key, 1);
+	}
+	MPI_Bcast(&key, 1, MPI_UINT64_T, 0, MPI::mpi.comm());
+	return key;
+}
+
+void seissol::PUMLReader::writeSuggestedPartition(const std::vector<double> &cellCosts)
+{
+	SCOREP_USER_REGION("PUMLReader_writeSuggestedPartition", SCOREP_USER_REGION_TYPE_FUNCTION);
+	const int rank = seissol::MPI::mpi.rank();
+	const int nrank = seissol::MPI::mpi.size();
+	assert(cellCosts.size() == m_elementGlobalIds.size());
+
+	// The partitioner works on the original (contiguous) distribution of the cells in the mesh file
+	PUML::TETPUML puml;
+	puml.setComm(MPI::mpi.comm());
+	read(puml, m_meshFile.c_str());
+
+	unsigned long nOriginalCells = puml.numOriginalCells();
+	std::vector<unsigned long> offsets(nrank + 1, 0);
+	MPI_Allgather(&nOriginalCells, 1, MPI_UNSIGNED_LONG, &offsets[1], 1, MPI_UNSIGNED_LONG, MPI::mpi.comm());
+	for (int rk = 0; rk < nrank; ++rk) {
+		offsets[rk+1] += offsets[rk];
+	}
+
+	// Normalize the costs to a mean vertex weight of 100
+	double localCost = 0.0;
+	for (double cost : cellCosts) {
+		localCost += cost;
+	}
+	double costs[2] = {localCost, static_cast<double>(cellCosts.size())};
+	MPI_Allreduce(MPI_IN_PLACE, costs, 2, MPI_DOUBLE, MPI_SUM, MPI::mpi.comm());
+	const double meanCost = costs[0] / costs[1];
+	if (meanCost <= 0.0) {
+		logWarning(rank) << "No compute time was measured; not writing a suggested partition.";
+		return;
+	}
+
+	// Send the weights to the ranks which hold the cells in the original distribution
+	std::vector<std::vector<unsigned long>> sendGids(nrank);
+	std::vector<std::vector<int>> sendWeights(nrank);
+	for (unsigned int cell = 0; cell < cellCosts.size(); ++cell) {
+		// The partition of the mesh file refers to the cells before the refinement
+		const unsigned long gid = m_elementGlobalIds[cell] >> (3 * m_refinementLevels);
+		const int owner = std::upper_bound(offsets.begin(), offsets.end(), gid) - offsets.begin() - 1;
+		sendGids[owner].push_back(gid);
+		sendWeights[owner].push_back(std::max(1, static_cast<int>(std::lround(100.0 * cellCosts[cell] / meanCost))));
+	}
+
+	std::vector<int> sendCounts(nrank);
+	std::vector<int> sendDispls(nrank + 1, 0);
+	for (int rk = 0; rk < nrank; ++rk) {
+		sendCounts[rk] = sendGids[rk].size();
+		sendDispls[rk+1] = sendDispls[rk] + sendCounts[rk];
+	}
+	std::vector<int> recvCounts(nrank);
+	MPI_Alltoall(sendCounts.data(), 1, MPI_INT, recvCounts.data(), 1, MPI_INT, MPI::mpi.comm());
+	std::vector<int> recvDispls(nrank + 1, 0);
+	for (int rk = 0; rk < nrank; ++rk) {
+		recvDispls[rk+1] = recvDispls[rk] + recvCounts[rk];
+	}
+
+	std::vector<unsigned long> flatSendGids;
+	std::vector<int> flatSendWeights;
+	flatSendGids.reserve(sendDispls[nrank]);
+	flatSendWeights.reserve(sendDispls[nrank]);
+	for (int rk = 0; rk < nrank; ++rk) {
+		flatSendGids.insert(flatSendGids.end(), sendGids[rk].begin(), sendGids[rk].end());
+		flatSendWeights.insert(flatSendWeights.end(), sendWeights[rk].begin(), sendWeights[rk].end());
+	}
+	std::vector<unsigned long> recvGids(recvDispls[nrank]);
+	std::vector<int> recvWeights(recvDispls[nrank]);
+	MPI_Alltoallv(flatSendGids.data(), sendCounts.data(), sendDispls.data(), MPI_UNSIGNED_LONG,
+		recvGids.data(), recvCounts.data(), recvDispls.data(), MPI_UNSIGNED_LONG, MPI::mpi.comm());
+	MPI_Alltoallv(flatSendWeights.data(), sendCounts.data(), sendDispls.data(), MPI_INT,
+		recvWeights.data(), recvCounts.data(), recvDispls.data(), MPI_INT, MPI::mpi.comm());
+
+	// A refined cell gets the sum of the weights of its sub-cells
+	std::vector<int> vertexWeights(nOriginalCells, 0);
+	for (unsigned int i = 0; i < recvGids.size(); ++i) {
+		vertexWeights[recvGids[i] - offsets[rank]] += recvWeights[i];
+	}
+	for (int &weight : vertexWeights) {
+		weight = std::max(weight, 1);
+	}
+
+	std::vector<int> partition(nOriginalCells);
+	std::vector<double> nodeWeights(nrank, 1.0 / nrank);
+	constexpr double imbalance = 1.01;
+	PUML::TETPartitionMetis metis(puml.originalCells(), puml.numOriginalCells());
+	auto status = metis.partition(partition.data(), vertexWeights.data(), &imbalance, 1, nodeWeights.data());
+	if (status == PUML::TETPartitionMetis::Status::Error) {
+		logWarning(rank) << "Partitioning with the measured costs failed; not writing a suggested partition.";
+		return;
+	}
+
+	// Compare the load of the current and the suggested partition
+	std::vector<double> load(2 * nrank, 0.0);
+	load[rank] = localCost;
+	for (unsigned long cell = 0; cell < nOriginalCells; ++cell) {
+		load[nrank + partition[cell]] += vertexWeights[cell] * meanCost / 100.0;
+	}
+	MPI_Allreduce(MPI_IN_PLACE, load.data(), load.size(), MPI_DOUBLE, MPI_SUM, MPI::mpi.comm());
+	const double meanLoad = costs[0] / nrank;
+	const double currentMaxLoad = *std::max_element(load.begin(), load.begin() + nrank);
+	const double suggestedMaxLoad = *std::max_element(load.begin() + nrank, load.end());
+
+	const std::string suggestedFile = m_checkPointFile + "_suggested";
+	writePartition(puml, partition.data(), partitionFileName(suggestedFile), 0);
+	logInfo(rank) << "Wrote a suggested partition to" << suggestedFile + "_partitions_*.h5" << utils::nospace << ". Load imbalance:"
+		<< utils::space << 100.0 * (1.0 - meanLoad / currentMaxLoad) << "% (current)"
+		<< 100.0 * (1.0 - meanLoad / suggestedMaxLoad) << "% (suggested, predicted)";
 }
 
 void seissol::PUMLReader::generatePUML(PUML::TETPUML &puml)
@@ -320,10 +686,23 @@ void seissol::PUMLReader::getMesh(const PUML::TETPUML &puml)
 
 	std::unordered_map<int, std::vector<unsigned int> > neighborInfo; // List of shared local face ids
 
-	// Compute everything local
+	// Compute everything local (MPI boundary faces are collected per thread and merged afterwards)
 	m_elements.resize(cells.size());
+	m_elementGlobalIds.resize(cells.size());
+#ifdef _OPENMP
+	std::vector<std::vector<std::pair<int, unsigned int>>> sharedFaces(omp_get_max_threads());
+	#pragma omp parallel for schedule(static)
+#else
+	std::vector<std::vector<std::pair<int, unsigned int>>> sharedFaces(1);
+#endif
 	for (unsigned int i = 0; i < cells.size(); i++) {
+#ifdef _OPENMP
+		std::vector<std::pair<int, unsigned int>>& threadSharedFaces = sharedFaces[omp_get_thread_num()];
+#else
+		std::vector<std::pair<int, unsigned int>>& threadSharedFaces = sharedFaces[0];
+#endif
 		m_elements[i].localId = i;
+		m_elementGlobalIds[i] = cells[i].gid();
 
 		// Vertices
 		PUML::Downward::vertices(puml, cells[i], reinterpret_cast<unsigned int*>(m_elements[i].vertices));
@@ -342,7 +721,7 @@ void seissol::PUMLReader::getMesh(const PUML::TETPUML &puml)
 					m_elements[i].neighborRanks[FACE_PUML2SEISSOL[j]] = rank;
 				} else {
 					// MPI Boundary
-					neighborInfo[faces[faceids[j]].shared()[0]].push_back(faceids[j]);
+					threadSharedFaces.emplace_back(faces[faceids[j]].shared()[0], faceids[j]);
 
 					m_elements[i].neighborRanks[FACE_PUML2SEISSOL[j]] = faces[faceids[j]].shared()[0];
 				}
@@ -383,6 +762,11 @@ void seissol::PUMLReader::getMesh(const PUML::TETPUML &puml)
 
 		m_elements[i].group = group[i];
 	}
+	for (const auto& threadSharedFaces : sharedFaces) {
+		for (const auto& face : threadSharedFaces) {
+			neighborInfo[face.first].push_back(face.second);
+		}
+	}
 
 	// Exchange ghost layer information and generate neighbor list
 	char** copySide = new char*[neighborInfo.size()];
@@ -483,6 +867,9 @@ void seissol::PUMLReader::getMesh(const PUML::TETPUML &puml)
 
 	// Set vertices
 	m_vertices.resize(vertices.size());
+#ifdef _OPENMP
+	#pragma omp parallel for schedule(static)
+#endif
 	for (unsigned int i = 0; i < vertices.size(); i++) {
 		memcpy(m_vertices[i].coords, vertices[i].coordinate(), 3*sizeof(double));
 
@@ -490,6 +877,36 @@ void seissol::PUMLReader::getMesh(const PUML::TETPUML &puml)
 	}
 }
 
+void seissol::PUMLReader::logCutDynamicRuptureFaces() const
+{
+	const int rank = MPI::mpi.rank();
+
+	unsigned long cutFaces = 0;
+	unsigned long faces = 0;
+	for (const auto& element : m_elements) {
+		for (int side = 0; side < 4; ++side) {
+			if (element.boundaries[side] == 3) {
+				++faces;
+				if (element.neighborRanks[side] != rank) {
+					++cutFaces;
+				}
+			}
+		}
+	}
+
+	// Each face is counted on both sides
+	unsigned long globalFaces[2] = {cutFaces, faces};
+	MPI_Allreduce(MPI_IN_PLACE, globalFaces, 2, MPI_UNSIGNED_LONG, MPI_SUM, MPI::mpi.comm());
+	if (globalFaces[1] == 0) {
+		return;
+	}
+
+	const auto summary = statistics::parallelSummary(cutFaces);
+	logInfo(rank) << "Dynamic rupture faces on partition boundaries:" << globalFaces[0] / 2 << "of" << globalFaces[1] / 2;
+	logInfo(rank) << "Dynamic rupture faces on partition boundaries per rank: mean =" << summary.mean
+		<< " max =" << summary.max;
+}
+
 void seissol::PUMLReader::addMPINeighor(const PUML::TETPUML &puml, int rank, const std::vector<unsigned int> &faces)
 {
 	unsigned int id = m_MPINeighbors.size();
@@ -38,6 +38,10 @@
 #ifndef PUMLREADER_H
 #define PUMLREADER_H
 
+#include <cstdint>
+#include <string>
+#include <vector>
+
 #include "MeshReader.h"
 #include "Parallel/MPI.h"
 
@@ -64,6 +68,16 @@ public:
         PUMLReader(const char* meshFile, double maximumAllowedTimeStep, const char* checkPointFile,
             initializers::time_stepping::LtsWeights* ltsWeights = nullptr, double tpwgt = 1.0, bool readPartitionFromFile = false);
 
+	/**
+	 * Partitions the mesh such that the given costs of the local cells are balanced
+	 * and writes the partition to <checkPointFile>_suggested_partitions_o<order>_n<ranks>.h5.
+	 * After renaming the file to <checkPointFile>_partitions_o<order>_n<ranks>.h5, a new simulation
+	 * (not a restart from a checkpoint of this simulation) reads this partition.
+	 *
+	 * @param cellCosts measured costs of the local cells (e.g. seconds), in the order of the mesh reader
+	 */
+	void writeSuggestedPartition(const std::vector<double> &cellCosts);
+
 private:
 	/**
 	 * Read the mesh
@@ -71,11 +85,32 @@ private:
 	void read(PUML::TETPUML &puml, const char* meshFile);
 
 	/**
-	 * Create the partitioning
+	 * Create the partitioning; the LTS weights are only computed if the partition is not read from the file
+	 */
+	void partition(PUML::TETPUML &puml, initializers::time_stepping::LtsWeights* ltsWeights, double maximumAllowedTimeStep, double tpwgt, bool readPartitionFromFile, const char* checkPointFile);
+	/**
+	 * Reads a stored partition; returns -1 if the file does not exist or does not match the mesh or the key.
+	 * Files without a key (e.g. suggested partitions) are accepted if they match the mesh.
+	 */
+	int readPartition(PUML::TETPUML &puml, int* partition, const std::string &fname, uint64_t key);
+	/**
+	 * Writes the partition; a non-zero key is stored with it
+	 */
+	void writePartition(PUML::TETPUML &puml, int* partition, const std::string &fname, uint64_t key);
+	static std::string partitionFileName(const std::string &prefix);
+	/**
+	 * Identifies the partition by the mesh file, the LTS weights, their parameters and the number of ranks
+	 */
+	uint64_t partitionKey(const initializers::time_stepping::LtsWeights* ltsWeights, double maximumAllowedTimeStep, double tpwgt) const;
+	/**
+	 * Partitions the dual graph of the LTS weights (with edge weights) with ParMETIS
+	 */
+	void partitionDualGraph(PUML::TETPUML &puml, const initializers::time_stepping::LtsWeights &ltsWeights, const double* nodeWeights, int* partition);
+	/**
+	 * Maps the partitions to ranks, such that partitions which communicate heavily are on the same node
+	 * (SEISSOL_PARTITION_MAPPING=1); the stored partitions are not mapped
 	 */
-	void partition(PUML::TETPUML &puml, initializers::time_stepping::LtsWeights* ltsWeights, double tpwgt, const char *meshFile, bool readPartitionFromFile, const char* checkPointFile);
-	int readPartition(PUML::TETPUML &puml, int* partition, const char *checkPointFile);
-	void writePartition(PUML::TETPUML &puml, int* partition, const char *checkPointFile);
+	void mapPartitions(PUML::TETPUML &puml, const initializers::time_stepping::LtsWeights* ltsWeights, double tpwgt, std::vector<int> &partition);
 	/**
 	 * Generate the PUML data structure
 	 */
@@ -86,9 +121,19 @@ private:
 	 */
 	void getMesh(const PUML::TETPUML &puml);
 
+	/**
+	 * Logs the number of dynamic rupture faces on partition boundaries
+	 */
+	void logCutDynamicRuptureFaces() const;
+
 	void addMPINeighor(const PUML::TETPUML &puml, int rank, const std::vector<unsigned int> &faces);
 
 private:
+	std::string m_meshFile;
+	std::string m_checkPointFile;
+	//! Number of uniform refinements of the local mesh (SEISSOL_MESH_REFINEMENT)
+	unsigned int m_refinementLevels;
+
 	static int FACE_PUML2SEISSOL[4];
 	static int FACEVERTEX2ORIENTATION[4][4];
 	static int FIRST_FACE_VERTEX[4];
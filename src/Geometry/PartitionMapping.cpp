@@ -0,0 +1,232 @@
+#include "PartitionMapping.h"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <unordered_map>
+#include <utility>
+
+#ifdef USE_MPI
+#include "Initializer/Hash.h"
+#endif
+
+std::vector<int> seissol::geometry::mapPartitionsToRanks(std::vector<PartitionEdge> const& edges,
+                                                         std::vector<int> const& nodeOfRank) {
+  const int numberOfPartitions = nodeOfRank.size();
+
+  std::vector<std::vector<std::pair<int, double>>> neighbors(numberOfPartitions);
+  for (auto const& edge : edges) {
+    if (edge.weight > 0.0) {
+      neighbors[edge.first].emplace_back(edge.second, edge.weight);
+      neighbors[edge.second].emplace_back(edge.first, edge.weight);
+    }
+  }
+
+  // The ranks of each node; the nodes are ordered by their lowest rank
+  std::vector<std::vector<int>> ranksOfNodes;
+  std::unordered_map<int, std::size_t> nodeIndex;
+  for (int rank = 0; rank < numberOfPartitions; ++rank) {
+    auto node = nodeIndex.find(nodeOfRank[rank]);
+    if (node == nodeIndex.end()) {
+      node = nodeIndex.emplace(nodeOfRank[rank], ranksOfNodes.size()).first;
+      ranksOfNodes.emplace_back();
+    }
+    ranksOfNodes[node->second].push_back(rank);
+  }
+
+  std::vector<int> rankOfPartition(numberOfPartitions);
+  std::vector<bool> assigned(numberOfPartitions, false);
+  // Weight of the edges between an unassigned partition and the partitions of the current node
+  std::vector<double> connection(numberOfPartitions, 0.0);
+  int nextUnassigned = 0;
+  for (auto const& ranks : ranksOfNodes) {
+    std::vector<int> partitions;
+    std::vector<int> candidates;
+    auto addPartition = [&](int partition) {
+      assigned[partition] = true;
+      partitions.push_back(partition);
+      for (auto const& [neighbor, weight] : neighbors[partition]) {
+        if (!assigned[neighbor]) {
+          if (connection[neighbor] == 0.0) {
+            candidates.push_back(neighbor);
+          }
+          connection[neighbor] += weight;
+        }
+      }
+    };
+
+    while (partitions.size() < ranks.size()) {
+      int best = -1;
+      for (int candidate : candidates) {
+        if (!assigned[candidate] &&
+            (best < 0 || connection[candidate] > connection[best] ||
+             (connection[candidate] == connection[best] && candidate < best))) {
+          best = candidate;
+        }
+      }
+      if (best < 0) {
+        while (assigned[nextUnassigned]) {
+          ++nextUnassigned;
+        }
+        best = nextUnassigned;
+      }
+      addPartition(best);
+    }
+
+    for (int candidate : candidates) {
+      connection[candidate] = 0.0;
+    }
+    std::sort(partitions.begin(), partitions.end());
+    for (std::size_t i = 0; i < partitions.size(); ++i) {
+      rankOfPartition[partitions[i]] = ranks[i];
+    }
+  }
+
+  std::vector<int> identity(numberOfPartitions);
+  for (int partition = 0; partition < numberOfPartitions; ++partition) {
+    identity[partition] = partition;
+  }
+  if (intraNodeWeight(edges, rankOfPartition, nodeOfRank) > intraNodeWeight(edges, identity, nodeOfRank)) {
+    return rankOfPartition;
+  }
+  return identity;
+}
+
+double seissol::geometry::intraNodeWeight(std::vector<PartitionEdge> const& edges,
+                                          std::vector<int> const& rankOfPartition,
+                                          std::vector<int> const& nodeOfRank) {
+  double weight = 0.0;
+  for (auto const& edge : edges) {
+    if (nodeOfRank[rankOfPartition[edge.first]] == nodeOfRank[rankOfPartition[edge.second]]) {
+      weight += edge.weight;
+    }
+  }
+  return weight;
+}
+
+#ifdef USE_MPI
+namespace {
+struct FaceRecord {
+  unsigned long vertices[3];
+  int partition;
+  int clusterId;
+};
+} // namespace
+
+std::vector<seissol::geometry::PartitionEdge> seissol::geometry::computePartitionGraph(const unsigned long (*cells)[4],
+                                                                                     std::size_t numberOfCells,
+                                                                                     const int* partition,
+                                                                                     const int* clusterIds,
+                                                                                     unsigned rate,
+                                                                                     MPI_Comm comm) {
+  int size;
+  MPI_Comm_size(comm, &size);
+
+  // Send each face to the rank which matches it with the face of the neighboring cell
+  std::vector<std::vector<FaceRecord>> sendFaces(size);
+  for (std::size_t cell = 0; cell < numberOfCells; ++cell) {
+    for (int face = 0; face < 4; ++face) {
+      FaceRecord record{};
+      for (int vertex = 0, next = 0; vertex < 4; ++vertex) {
+        if (vertex != face) {
+          record.vertices[next++] = cells[cell][vertex];
+        }
+      }
+      std::sort(record.vertices, record.vertices + 3);
+      record.partition = partition[cell];
+      record.clusterId = clusterIds != nullptr ? clusterIds[cell] : 0;
+      const auto destination = initializers::hashBytes(record.vertices, sizeof(record.vertices)) % size;
+      sendFaces[destination].push_back(record);
+    }
+  }
+
+  MPI_Datatype recordType;
+  MPI_Type_contiguous(sizeof(FaceRecord), MPI_BYTE, &recordType);
+  MPI_Type_commit(&recordType);
+
+  std::vector<int> sendCounts(size);
+  std::vector<int> sendOffsets(size + 1, 0);
+  std::vector<FaceRecord> sendBuffer;
+  for (int rank = 0; rank < size; ++rank) {
+    sendCounts[rank] = sendFaces[rank].size();
+    sendOffsets[rank + 1] = sendOffsets[rank] + sendCounts[rank];
+    sendBuffer.insert(sendBuffer.end(), sendFaces[rank].begin(), sendFaces[rank].end());
+  }
+  sendFaces.clear();
+
+  std::vector<int> recvCounts(size);
+  MPI_Alltoall(sendCounts.data(), 1, MPI_INT, recvCounts.data(), 1, MPI_INT, comm);
+  std::vector<int> recvOffsets(size + 1, 0);
+  for (int rank = 0; rank < size; ++rank) {
+    recvOffsets[rank + 1] = recvOffsets[rank] + recvCounts[rank];
+  }
+  std::vector<FaceRecord> faces(recvOffsets[size]);
+  MPI_Alltoallv(sendBuffer.data(), sendCounts.data(), sendOffsets.data(), recordType,
+                faces.data(), recvCounts.data(), recvOffsets.data(), recordType, comm);
+  MPI_Type_free(&recordType);
+
+  // Both cells of an inner face are adjacent after sorting
+  std::sort(faces.begin(), faces.end(), [](FaceRecord const& a, FaceRecord const& b) {
+    return std::lexicographical_compare(a.vertices, a.vertices + 3, b.vertices, b.vertices + 3);
+  });
+  std::map<std::pair<int, int>, double> localEdges;
+  for (std::size_t i = 0; i + 1 < faces.size(); ++i) {
+    auto const& a = faces[i];
+    auto const& b = faces[i + 1];
+    if (std::equal(a.vertices, a.vertices + 3, b.vertices)) {
+      if (a.partition != b.partition) {
+        const double weight = std::pow(static_cast<double>(rate), -std::min(a.clusterId, b.clusterId));
+        localEdges[std::minmax(a.partition, b.partition)] += weight;
+      }
+      ++i;
+    }
+  }
+
+  std::vector<PartitionEdge> sendEdges;
+  for (auto const& [partitions, weight] : localEdges) {
+    sendEdges.push_back({partitions.first, partitions.second, weight});
+  }
+
+  MPI_Datatype edgeType;
+  MPI_Type_contiguous(sizeof(PartitionEdge), MPI_BYTE, &edgeType);
+  MPI_Type_commit(&edgeType);
+  const int numberOfEdges = sendEdges.size();
+  std::vector<int> edgeCounts(size);
+  MPI_Allgather(&numberOfEdges, 1, MPI_INT, edgeCounts.data(), 1, MPI_INT, comm);
+  std::vector<int> edgeOffsets(size + 1, 0);
+  for (int rank = 0; rank < size; ++rank) {
+    edgeOffsets[rank + 1] = edgeOffsets[rank] + edgeCounts[rank];
+  }
+  std::vector<PartitionEdge> allEdges(edgeOffsets[size]);
+  MPI_Allgatherv(sendEdges.data(), numberOfEdges, edgeType,
+                 allEdges.data(), edgeCounts.data(), edgeOffsets.data(), edgeType, comm);
+  MPI_Type_free(&edgeType);
+
+  // The faces between two partitions are matched on several ranks
+  std::map<std::pair<int, int>, double> globalEdges;
+  for (auto const& edge : allEdges) {
+    globalEdges[{edge.first, edge.second}] += edge.weight;
+  }
+  std::vector<PartitionEdge> edges;
+  for (auto const& [partitions, weight] : globalEdges) {
+    edges.push_back({partitions.first, partitions.second, weight});
+  }
+  return edges;
+}
+
+std::vector<int> seissol::geometry::computeNodeOfRanks(MPI_Comm comm) {
+  int rank, size;
+  MPI_Comm_rank(comm, &rank);
+  MPI_Comm_size(comm, &size);
+
+  MPI_Comm nodeComm;
+  MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &nodeComm);
+  int node = rank;
+  MPI_Bcast(&node, 1, MPI_INT, 0, nodeComm);
+  MPI_Comm_free(&nodeComm);
+
+  std::vector<int> nodeOfRank(size);
+  MPI_Allgather(&node, 1, MPI_INT, nodeOfRank.data(), 1, MPI_INT, comm);
+  return nodeOfRank;
+}
+#endif
@@ -0,0 +1,57 @@
+#ifndef SEISSOL_GEOMETRY_PARTITIONMAPPING_H
+#define SEISSOL_GEOMETRY_PARTITIONMAPPING_H
+
+#include <cstddef>
+#include <vector>
+
+#ifdef USE_MPI
+#include <mpi.h>
+#endif
+
+namespace seissol::geometry {
+
+//! Communication between two partitions (first < second), e.g. the exchanges per time step of the largest cluster
+struct PartitionEdge {
+  int first;
+  int second;
+  double weight;
+};
+
+/**
+ * Assigns the partitions to ranks such that partitions which communicate heavily are on the same node.
+ *
+ * nodeOfRank contains an identifier of the node of each rank; the number of partitions is the number of ranks.
+ * The nodes are filled one after the other: each node starts with the unassigned partition with the lowest id
+ * and adds the unassigned partition with the heaviest edges to the partitions of the node, until all ranks of the node
+ * have a partition. The partitions of a node are given to its ranks in increasing order.
+ * Returns the rank of each partition; the identity, if the mapping does not increase the weight within the nodes.
+ **/
+std::vector<int> mapPartitionsToRanks(std::vector<PartitionEdge> const& edges, std::vector<int> const& nodeOfRank);
+
+//! Sum of the weights of the edges whose partitions are on the same node
+double intraNodeWeight(std::vector<PartitionEdge> const& edges,
+                       std::vector<int> const& rankOfPartition,
+                       std::vector<int> const& nodeOfRank);
+
+#ifdef USE_MPI
+/**
+ * Computes the communication graph of the partitions of a mesh in its original (contiguous) distribution;
+ * collective over comm. The result is identical on all ranks.
+ *
+ * Each face between two partitions contributes the update rate of the faster cell, rate^-clusterId
+ * (or 1 without clusterIds), i.e. the ghost region sizes weighted by the LTS update rate.
+ * The faces are matched by their (global) vertex ids on the rank given by the hash of the vertex ids.
+ **/
+std::vector<PartitionEdge> computePartitionGraph(const unsigned long (*cells)[4],
+                                                 std::size_t numberOfCells,
+                                                 const int* partition,
+                                                 const int* clusterIds,
+                                                 unsigned rate,
+                                                 MPI_Comm comm);
+
+//! Returns an identifier of the node (the lowest rank on the node) of each rank; collective over comm.
+std::vector<int> computeNodeOfRanks(MPI_Comm comm);
+#endif
+} // namespace seissol::geometry
+
+#endif // SEISSOL_GEOMETRY_PARTITIONMAPPING_H
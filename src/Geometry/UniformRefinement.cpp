@@ -0,0 +1,342 @@
+#include "UniformRefinement.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+
+#include <Eigen/Dense>
+
+#include "MeshTools.h"
+#include "Parallel/MPI.h"
+#include "refinement/RefinerUtils.h"
+
+namespace {
+
+constexpr unsigned int SubCells = 8;
+//! Sub-faces of a face of a cell
+constexpr unsigned int SubFaces = 4;
+//! The vertices of the sub-cells: the corners 0-3 of the cell followed by the midpoints of ab, ac, ad, bc, bd and cd
+constexpr unsigned int RefinedVertices = 10;
+constexpr int EdgeCorners[6][2] = {{0, 1}, {0, 2}, {0, 3}, {1, 2}, {1, 3}, {2, 3}};
+
+//! Corners of the cell which span a vertex of the refinement
+unsigned int cornerMask(unsigned int vertex) {
+  if (vertex < 4) {
+    return 1u << vertex;
+  }
+  return (1u << EdgeCorners[vertex - 4][0]) | (1u << EdgeCorners[vertex - 4][1]);
+}
+
+unsigned int sideMask(int side) {
+  return (1u << MeshTools::FACE2NODES[side][0]) | (1u << MeshTools::FACE2NODES[side][1]) |
+         (1u << MeshTools::FACE2NODES[side][2]);
+}
+
+/**
+ * The sub-cells of DivideTetrahedronBy8 in terms of the vertices of the refinement and the relations of their sides
+ **/
+struct RefinementPattern {
+  unsigned int vertices[SubCells][4];
+  //! The side of the cell on which a side of a sub-cell lies; -1 inside the cell
+  int cellSide[SubCells][4];
+  //! Neighbor and its side for sides inside the cell
+  unsigned int neighbor[SubCells][4];
+  int neighborSide[SubCells][4];
+  //! Sub-cells and their sides on each side of the cell
+  std::pair<unsigned int, int> subFaces[4][SubFaces];
+
+  RefinementPattern() {
+    using Vector = Eigen::Matrix<double, 3, 1>;
+    const auto unit = seissol::refinement::Tetrahedron<double>::unitTetrahedron();
+    const seissol::refinement::Tetrahedron<double> cell(unit.a, unit.b, unit.c, unit.d, 0, 1, 2, 3);
+    const seissol::refinement::DivideTetrahedronBy8<double> refiner;
+    seissol::refinement::Tetrahedron<double> subCells[SubCells];
+    Vector midpoints[6];
+    refiner.refine(cell, 4, subCells, midpoints);
+
+    const auto positive = [](const Vector& a, const Vector& b, const Vector& c, const Vector& d) {
+      return (b - a).cross(c - a).dot(d - a) > 0.0;
+    };
+    const bool cellOrientation = positive(cell.a, cell.b, cell.c, cell.d);
+    for (unsigned int s = 0; s < SubCells; ++s) {
+      const auto& sub = subCells[s];
+      vertices[s][0] = sub.i;
+      vertices[s][1] = sub.j;
+      vertices[s][2] = sub.k;
+      vertices[s][3] = sub.l;
+      // The sub-cells keep the orientation of the cell
+      if (positive(sub.a, sub.b, sub.c, sub.d) != cellOrientation) {
+        std::swap(vertices[s][2], vertices[s][3]);
+      }
+    }
+
+    unsigned int numSubFaces[4] = {0, 0, 0, 0};
+    for (unsigned int s = 0; s < SubCells; ++s) {
+      for (int j = 0; j < 4; ++j) {
+        const auto face = sortedFace(s, j);
+        unsigned int mask = 0;
+        for (const auto vertex : face) {
+          mask |= cornerMask(vertex);
+        }
+        cellSide[s][j] = -1;
+        for (int side = 0; side < 4; ++side) {
+          if (mask == sideMask(side)) {
+            cellSide[s][j] = side;
+            subFaces[side][numSubFaces[side]++] = {s, j};
+          }
+        }
+        if (cellSide[s][j] >= 0) {
+          continue;
+        }
+        for (unsigned int n = 0; n < SubCells; ++n) {
+          for (int k = 0; k < 4; ++k) {
+            if (n != s && sortedFace(n, k) == face) {
+              neighbor[s][j] = n;
+              neighborSide[s][j] = k;
+            }
+          }
+        }
+      }
+    }
+  }
+
+  std::array<unsigned int, 3> sortedFace(unsigned int subCell, int side) const {
+    std::array<unsigned int, 3> face = {vertices[subCell][MeshTools::FACE2NODES[side][0]],
+                                        vertices[subCell][MeshTools::FACE2NODES[side][1]],
+                                        vertices[subCell][MeshTools::FACE2NODES[side][2]]};
+    std::sort(face.begin(), face.end());
+    return face;
+  }
+};
+
+const RefinementPattern& refinementPattern() {
+  static const RefinementPattern Pattern;
+  return Pattern;
+}
+
+std::array<int, 3> sortedFace(const Element& element, int side) {
+  std::array<int, 3> face = {element.vertices[MeshTools::FACE2NODES[side][0]],
+                             element.vertices[MeshTools::FACE2NODES[side][1]],
+                             element.vertices[MeshTools::FACE2NODES[side][2]]};
+  std::sort(face.begin(), face.end());
+  return face;
+}
+
+//! Position of the first vertex of the side in the vertices of the neighbor's side
+int sideOrientation(const Element& element, int side, const Element& neighbor, int neighborSide) {
+  const int firstVertex = element.vertices[MeshTools::FACE2NODES[side][0]];
+  for (int i = 0; i < 3; ++i) {
+    if (neighbor.vertices[MeshTools::FACE2NODES[neighborSide][i]] == firstVertex) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+//! A sub-face on a partition boundary
+struct MPISubFace {
+  unsigned int element;
+  int side;
+  //! The vertices of the side, given by the corners of the face (ordered by their coordinates) spanning them
+  char vertexCorners[3];
+};
+
+} // namespace
+
+void seissol::geometry::refineUniformly(int rank,
+                                        std::vector<Element>& elements,
+                                        std::vector<Vertex>& vertices,
+                                        std::map<int, MPINeighbor>& mpiNeighbors,
+                                        std::vector<unsigned long>& elementGlobalIds) {
+  const auto& pattern = refinementPattern();
+  const std::size_t numCells = elements.size();
+  const std::size_t numSubCells = SubCells * numCells;
+
+  // The vertices of the cells followed by one vertex per edge
+  std::vector<Vertex> refinedVertices(vertices.size());
+  for (std::size_t i = 0; i < vertices.size(); ++i) {
+    std::memcpy(refinedVertices[i].coords, vertices[i].coords, sizeof(VrtxCoords));
+  }
+  std::vector<std::array<unsigned int, RefinedVertices>> cellVertices(numCells);
+  std::unordered_map<std::uint64_t, unsigned int> edgeVertices;
+  edgeVertices.reserve(2 * numCells);
+  for (std::size_t c = 0; c < numCells; ++c) {
+    for (int i = 0; i < 4; ++i) {
+      cellVertices[c][i] = elements[c].vertices[i];
+    }
+    for (int e = 0; e < 6; ++e) {
+      const unsigned int first = elements[c].vertices[EdgeCorners[e][0]];
+      const unsigned int second = elements[c].vertices[EdgeCorners[e][1]];
+      const std::uint64_t key = (static_cast<std::uint64_t>(std::min(first, second)) << 32) | std::max(first, second);
+      const auto [edge, inserted] = edgeVertices.emplace(key, refinedVertices.size());
+      if (inserted) {
+        const Eigen::Vector3d midpoint = refinement::middle(Eigen::Vector3d(vertices[first].coords),
+                                                            Eigen::Vector3d(vertices[second].coords));
+        refinedVertices.emplace_back();
+        std::copy_n(midpoint.data(), 3, refinedVertices.back().coords);
+      }
+      cellVertices[c][4 + e] = edge->second;
+    }
+  }
+
+  std::vector<Element> subCells(numSubCells);
+  for (std::size_t c = 0; c < numCells; ++c) {
+    const Element& cell = elements[c];
+    for (unsigned int s = 0; s < SubCells; ++s) {
+      Element& subCell = subCells[SubCells * c + s];
+      subCell.localId = SubCells * c + s;
+      subCell.rank = cell.rank;
+      subCell.group = cell.group;
+      for (int i = 0; i < 4; ++i) {
+        subCell.vertices[i] = cellVertices[c][pattern.vertices[s][i]];
+      }
+    }
+  }
+
+  // Neighbors within the rank; the sub-faces on partition boundaries are collected per neighbor rank
+  std::map<int, std::vector<MPISubFace>> mpiSubFaces;
+  for (const auto& [neighborRank, neighbor] : mpiNeighbors) {
+    mpiSubFaces[neighborRank].resize(SubFaces * neighbor.elements.size());
+  }
+  for (std::size_t c = 0; c < numCells; ++c) {
+    const Element& cell = elements[c];
+    for (unsigned int s = 0; s < SubCells; ++s) {
+      const unsigned int id = SubCells * c + s;
+      Element& subCell = subCells[id];
+      for (int j = 0; j < 4; ++j) {
+        subCell.mpiIndices[j] = 0;
+        subCell.mpiFaultIndices[j] = 0;
+        const int side = pattern.cellSide[s][j];
+        if (side < 0) {
+          subCell.neighbors[j] = SubCells * c + pattern.neighbor[s][j];
+          subCell.neighborSides[j] = pattern.neighborSide[s][j];
+          subCell.neighborRanks[j] = rank;
+          subCell.boundaries[j] = 0;
+          subCell.faultTags[j] = 0;
+          continue;
+        }
+
+        subCell.boundaries[j] = cell.boundaries[side];
+        subCell.faultTags[j] = cell.faultTags[side];
+        subCell.neighborRanks[j] = cell.neighborRanks[side];
+        subCell.neighbors[j] = numSubCells;
+        subCell.neighborSides[j] = cell.neighborSides[side];
+        subCell.sideOrientations[j] = cell.sideOrientations[side];
+        if (cell.neighborRanks[side] == rank && cell.neighbors[side] < static_cast<int>(numCells)) {
+          // The sub-face of the neighboring cell with the same vertices
+          const unsigned int neighborCell = cell.neighbors[side];
+          const auto face = sortedFace(subCell, j);
+          for (const auto& [neighborSubCell, neighborSide] : pattern.subFaces[cell.neighborSides[side]]) {
+            const unsigned int neighbor = SubCells * neighborCell + neighborSubCell;
+            if (sortedFace(subCells[neighbor], neighborSide) == face) {
+              subCell.neighbors[j] = neighbor;
+              subCell.neighborSides[j] = neighborSide;
+            }
+          }
+        } else if (cell.neighborRanks[side] != rank) {
+          // Both ranks order the corners of the face by their coordinates
+          int corners[3] = {MeshTools::FACE2NODES[side][0], MeshTools::FACE2NODES[side][1],
+                            MeshTools::FACE2NODES[side][2]};
+          std::sort(corners, corners + 3, [&](int a, int b) {
+            const double* first = vertices[cell.vertices[a]].coords;
+            const double* second = vertices[cell.vertices[b]].coords;
+            return std::lexicographical_compare(first, first + 3, second, second + 3);
+          });
+          const auto faceCorners = [&](unsigned int vertex) {
+            const unsigned int mask = cornerMask(vertex);
+            char result = 0;
+            for (int i = 0; i < 3; ++i) {
+              if (mask & (1u << corners[i])) {
+                result |= static_cast<char>(1 << i);
+              }
+            }
+            return result;
+          };
+
+          // The sub-face at a corner follows the one in the center
+          MPISubFace subFace = {id, j, {}};
+          unsigned int index = 0;
+          for (int i = 0; i < 3; ++i) {
+            const unsigned int vertex = pattern.vertices[s][MeshTools::FACE2NODES[j][i]];
+            subFace.vertexCorners[i] = faceCorners(vertex);
+            if (vertex < 4) {
+              index = 1 + (std::find(corners, corners + 3, static_cast<int>(vertex)) - corners);
+            }
+          }
+          const unsigned int mpiIndex = SubFaces * cell.mpiIndices[side] + index;
+          subCell.mpiIndices[j] = mpiIndex;
+          mpiSubFaces[cell.neighborRanks[side]][mpiIndex] = subFace;
+        }
+      }
+    }
+  }
+  for (auto& subCell : subCells) {
+    for (int j = 0; j < 4; ++j) {
+      if (subCell.neighbors[j] < static_cast<int>(numSubCells)) {
+        subCell.sideOrientations[j] =
+            sideOrientation(subCell, j, subCells[subCell.neighbors[j]], subCell.neighborSides[j]);
+      }
+    }
+  }
+
+  // Exchange the sides and the first vertices of the sub-faces on partition boundaries
+  for (auto& [neighborRank, neighbor] : mpiNeighbors) {
+    const auto& subFaces = mpiSubFaces[neighborRank];
+    neighbor.elements.assign(subFaces.size(), MPINeighborElement{});
+    for (std::size_t i = 0; i < subFaces.size(); ++i) {
+      neighbor.elements[i].localElement = subFaces[i].element;
+      neighbor.elements[i].localSide = subFaces[i].side;
+    }
+  }
+#ifdef USE_MPI
+  std::vector<std::vector<char>> copySides;
+  std::vector<std::vector<char>> ghostSides;
+  std::vector<MPI_Request> requests;
+  for (const auto& [neighborRank, subFaces] : mpiSubFaces) {
+    copySides.emplace_back(2 * subFaces.size());
+    ghostSides.emplace_back(2 * subFaces.size());
+    for (std::size_t i = 0; i < subFaces.size(); ++i) {
+      copySides.back()[2 * i] = static_cast<char>(subFaces[i].side);
+      copySides.back()[2 * i + 1] = subFaces[i].vertexCorners[0];
+    }
+    requests.emplace_back();
+    MPI_Irecv(ghostSides.back().data(), ghostSides.back().size(), MPI_CHAR, neighborRank, 0,
+              seissol::MPI::mpi.comm(), &requests.back());
+    requests.emplace_back();
+    MPI_Isend(copySides.back().data(), copySides.back().size(), MPI_CHAR, neighborRank, 0,
+              seissol::MPI::mpi.comm(), &requests.back());
+  }
+  MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+
+  std::size_t k = 0;
+  for (const auto& [neighborRank, subFaces] : mpiSubFaces) {
+    for (std::size_t i = 0; i < subFaces.size(); ++i) {
+      Element& subCell = subCells[subFaces[i].element];
+      const int side = subFaces[i].side;
+      subCell.neighborSides[side] = ghostSides[k][2 * i];
+      // Position of the neighbor's first vertex in the vertices of the side
+      const char* first = std::find(subFaces[i].vertexCorners, subFaces[i].vertexCorners + 3, ghostSides[k][2 * i + 1]);
+      subCell.sideOrientations[side] = first - subFaces[i].vertexCorners;
+    }
+    ++k;
+  }
+#endif // USE_MPI
+
+  for (std::size_t i = 0; i < numSubCells; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      refinedVertices[subCells[i].vertices[j]].elements.push_back(i);
+    }
+  }
+
+  if (!elementGlobalIds.empty()) {
+    std::vector<unsigned long> subCellGlobalIds(numSubCells);
+    for (std::size_t i = 0; i < numSubCells; ++i) {
+      subCellGlobalIds[i] = SubCells * elementGlobalIds[i / SubCells] + i % SubCells;
+    }
+    elementGlobalIds.swap(subCellGlobalIds);
+  }
+  elements.swap(subCells);
+  vertices.swap(refinedVertices);
+}
@@ -0,0 +1,30 @@
+#ifndef SEISSOL_GEOMETRY_UNIFORMREFINEMENT_H
+#define SEISSOL_GEOMETRY_UNIFORMREFINEMENT_H
+
+#include <map>
+#include <vector>
+
+#include "MeshDefinition.h"
+
+namespace seissol::geometry {
+
+/**
+ * Divides every tetrahedron of a partitioned mesh into 8 (refinement::DivideTetrahedronBy8), such that large meshes
+ * can be generated in memory from a coarse mesh file. Collective over MPI::mpi.comm().
+ *
+ * The sub-cells keep the orientation, material group and global id (times 8 plus the sub-cell) of their cell.
+ * Faces on a face of the cell inherit its boundary condition and fault tag. The four sub-faces of a face on a
+ * partition boundary replace it in the MPI neighbor list, ordered by the corners of the face (sorted by their
+ * coordinates), such that both ranks agree on the order without global vertex ids.
+ * The vertex coordinates of the same face must therefore be identical on both ranks (as they are, if read from
+ * the same mesh file).
+ **/
+void refineUniformly(int rank,
+                     std::vector<Element>& elements,
+                     std::vector<Vertex>& vertices,
+                     std::map<int, MPINeighbor>& mpiNeighbors,
+                     std::vector<unsigned long>& elementGlobalIds);
+
+} // namespace seissol::geometry
+
+#endif // SEISSOL_GEOMETRY_UNIFORMREFINEMENT_H
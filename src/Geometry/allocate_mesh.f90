@@ -98,8 +98,6 @@ CONTAINS
               MESH%ELEM%MPIreference(     0:MESH%nVertexMax, MESH%nElem), &  
               MESH%ELEM%BoundaryToObject( MESH%nVertexMax,   MESH%nElem), &
               MESH%ELEM%SideNeighbor(     MESH%nVertexMax,   MESH%nElem), & 
-              MESH%ELEM%LocalNeighborSide(MESH%nVertexMax,   MESH%nElem), & 
-              MESH%ELEM%LocalNeighborVrtx(MESH%nVertexMax,   MESH%nElem), & 
               MESH%ELEM%xyBary(           MESH%Dimension,    MESH%nElem), & 
               MESH%ELEM%Volume(           MESH%nElem                   ), &
               MESH%ELEM%MinDistBarySide(  MESH%nElem                   ), &
@@ -122,8 +120,6 @@ CONTAINS
                MESH%ELEM%MPIreference         , &
                MESH%ELEM%BoundaryToObject     , &               
                MESH%ELEM%SideNeighbor         , &
-               MESH%ELEM%LocalNeighborSide    , &
-               MESH%ELEM%LocalNeighborVrtx    , & 
                MESH%ELEM%xyBary               , &
                MESH%ELEM%Volume               , &
                MESH%ELEM%MinDistBarySide         )
@@ -186,8 +182,6 @@ CONTAINS
 
     ALLOCATE( MESH%VRTX%xyNode(                EQN%Dimension, MESH%nNode            ), &
               MESH%VRTX%Reference(             MESH%nNode                           ), &
-              MESH%VRTX%NrOfElementsConnected( MESH%nNode                           ), &
-              MESH%VRTX%Element(               MESH%nNode, MESH%MaxElementsOnVertex ), &
               MESH%VRTX%BoundaryToObject(      MESH%nNode                           ), &
               STAT=allocStat                                                           )
 
@@ -198,8 +192,6 @@ CONTAINS
     
     MESH%VRTX%xyNode                = 0                                                !
     MESH%VRTX%Reference             = 0                                                !
-    MESH%VRTX%NrOfElementsConnected = 0                                                !
-    MESH%VRTX%Element               = 0                                                !
     MESH%VRTX%BoundaryToObject      = 0                                                !
 
   END SUBROUTINE allocate_mesh_level0_2
@@ -210,8 +202,6 @@ CONTAINS
     !--------------------------------------------------------------------------
     DEALLOCATE(MESH%VRTX%xyNode               , &
                MESH%VRTX%Reference            , &
-               MESH%VRTX%NrOfElementsConnected, &
-               MESH%VRTX%Element              , &
                MESH%VRTX%BoundaryToObject        )
 
   END SUBROUTINE destruct_mesh_level0_2
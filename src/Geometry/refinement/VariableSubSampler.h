@@ -42,6 +42,7 @@
 
 #include <cassert>
 #include <algorithm>
+#include <vector>
 
 #include <Eigen/Dense>
 
@@ -60,8 +61,13 @@ template<class T>
 class VariableSubsampler
 {
 private:
+    using Matrix = Eigen::Matrix<real, Eigen::Dynamic, Eigen::Dynamic>;
+
     std::vector<basisFunction::SampledBasisFunctions<T> > m_BasisFunctions;
 
+    /** The sampled basis functions, [sub cell][basis function] */
+    Matrix m_basisMatrix;
+
     /** The original number of cells (without refinement) */
     const unsigned int m_numCells;
 
@@ -92,6 +98,43 @@ public:
 
     void get(const real* inData, const unsigned int* cellMap,
             int variable, real* outData) const;
+
+    /**
+     * Same as get for a single cell, where cellData points to the
+     * degrees of freedom of the cell (e.g. in a staging buffer)
+     */
+    void getCell(const real* cellData, unsigned int cell,
+            int variable, real* outData) const;
+
+    /**
+     * Same as get for several variables, where outData[i] receives
+     * variables[i]. The variables of a cell are evaluated with a single
+     * matrix-matrix product of the sampled basis functions and the
+     * degrees of freedom.
+     */
+    void get(const real* inData, const unsigned int* cellMap,
+            const std::vector<unsigned int>& variables,
+            const std::vector<real*>& outData) const;
+
+    /**
+     * Same as get for several variables and a single cell, see getCell
+     */
+    void getCell(const real* cellData, unsigned int cell,
+            const std::vector<unsigned int>& variables,
+            const std::vector<real*>& outData) const;
+
+    /**
+     * Copies the first numBasisFunctions modal coefficients of a variable,
+     * outData[basisFunction * numCells + cell].
+     */
+    void getCoefficients(const real* inData, const unsigned int* cellMap,
+            int variable, unsigned int numBasisFunctions, real* outData) const;
+
+    /**
+     * Same as getCoefficients for a single cell, see getCell
+     */
+    void getCellCoefficients(const real* cellData, unsigned int cell,
+            int variable, unsigned int numBasisFunctions, real* outData) const;
 };
 
 //------------------------------------------------------------------------------
@@ -124,6 +167,15 @@ VariableSubsampler<T>::VariableSubsampler(
 
     delete [] subCells;
     delete [] additionalVertices;
+
+    const unsigned int numBasisFunctions = m_BasisFunctions.front().getSize();
+    assert(numBasisFunctions <= kNumAlignedDOF);
+    m_basisMatrix.resize(kSubCellsPerCell, numBasisFunctions);
+    for (unsigned int sc = 0; sc < kSubCellsPerCell; ++sc) {
+        for (unsigned int b = 0; b < numBasisFunctions; ++b) {
+            m_basisMatrix(sc, b) = m_BasisFunctions[sc].m_data[b];
+        }
+    }
 }
 
 //------------------------------------------------------------------------------
@@ -137,10 +189,83 @@ void VariableSubsampler<T>::get(const real* inData,  const unsigned int* cellMap
 #endif
     // Iterate over original Cells
     for (unsigned int c = 0; c < m_numCells; ++c) {
-        for (unsigned int sc = 0; sc < kSubCellsPerCell; ++sc) {
-            outData[getOutVarOffset(c, sc)] =
-            		m_BasisFunctions[sc].evalWithCoeffs(&inData[getInVarOffset(c, variable, cellMap)]);
-        }
+        getCell(&inData[getInVarOffset(c, 0, cellMap)], c, variable, outData);
+    }
+}
+
+//------------------------------------------------------------------------------
+
+template<typename T>
+void VariableSubsampler<T>::getCell(const real* cellData, unsigned int cell,
+        int variable, real* outData) const
+{
+    for (unsigned int sc = 0; sc < kSubCellsPerCell; ++sc) {
+        outData[getOutVarOffset(cell, sc)] =
+        		m_BasisFunctions[sc].evalWithCoeffs(&cellData[variable * kNumAlignedDOF]);
+    }
+}
+
+//------------------------------------------------------------------------------
+
+template<typename T>
+void VariableSubsampler<T>::get(const real* inData, const unsigned int* cellMap,
+        const std::vector<unsigned int>& variables,
+        const std::vector<real*>& outData) const
+{
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+#endif
+    for (unsigned int c = 0; c < m_numCells; ++c) {
+        getCell(&inData[getInVarOffset(c, 0, cellMap)], c, variables, outData);
+    }
+}
+
+//------------------------------------------------------------------------------
+
+template<typename T>
+void VariableSubsampler<T>::getCell(const real* cellData, unsigned int cell,
+        const std::vector<unsigned int>& variables,
+        const std::vector<real*>& outData) const
+{
+    assert(variables.size() == outData.size());
+    const Eigen::Map<const Matrix, Eigen::Unaligned, Eigen::OuterStride<>> dofs(
+            cellData, m_basisMatrix.cols(), kNumVariables, Eigen::OuterStride<>(kNumAlignedDOF));
+
+    // [sub cell][variable], reused by all cells of a thread
+    thread_local Matrix values;
+    values.resize(kSubCellsPerCell, kNumVariables);
+    values.noalias() = m_basisMatrix * dofs;
+
+    for (std::size_t i = 0; i < variables.size(); ++i) {
+        std::copy_n(values.col(variables[i]).data(), kSubCellsPerCell,
+                &outData[i][getOutVarOffset(cell, 0)]);
+    }
+}
+
+//------------------------------------------------------------------------------
+
+template<typename T>
+void VariableSubsampler<T>::getCoefficients(const real* inData, const unsigned int* cellMap,
+        int variable, unsigned int numBasisFunctions, real* outData) const
+{
+    assert(numBasisFunctions <= kNumAlignedDOF);
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+#endif
+    for (unsigned int c = 0; c < m_numCells; ++c) {
+        getCellCoefficients(&inData[getInVarOffset(c, 0, cellMap)], c, variable, numBasisFunctions, outData);
+    }
+}
+
+//------------------------------------------------------------------------------
+
+template<typename T>
+void VariableSubsampler<T>::getCellCoefficients(const real* cellData, unsigned int cell,
+        int variable, unsigned int numBasisFunctions, real* outData) const
+{
+    const real* coefficients = &cellData[variable * kNumAlignedDOF];
+    for (unsigned int b = 0; b < numBasisFunctions; ++b) {
+        outData[b * m_numCells + cell] = coefficients[b];
     }
 }
 
@@ -3,6 +3,8 @@
 
 #include <Kernels/precision.hpp>
 
+#include <cstdint>
+
 enum mpiTag {
   localIntegrationData = 0,
   neighboringIntegrationData = 1,
@@ -24,7 +26,8 @@ enum TimeClustering {
 // Note: When introducting new types also change
 // int seissol::initializers::time_stepping::LtsWeights::getBoundaryCondition
 // and PUMLReader. Otherwise it might become a DR face...
-enum class FaceType {
+// The face types are stored per face of every cell, hence one byte suffices.
+enum class FaceType : std::uint8_t {
   // regular: inside the computational domain
   regular = 0,
 
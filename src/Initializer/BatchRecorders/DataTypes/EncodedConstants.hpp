@@ -30,6 +30,12 @@ enum struct EntityId : size_t {
   DrQInterpolatedPlus,
   DrQInterpolatedMinus,
   DrTinvT,
+  SourceMatrix,
+  Zinv,
+  Gmatrix,
+  StpRhs, // right-hand side of the space-time predictor
+  StarGradients, // gradients of the reference coordinates, for recomputing the star matrices
+  StarCoefficients,
   Count
 };
 
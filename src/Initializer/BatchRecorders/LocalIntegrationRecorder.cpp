@@ -36,6 +36,18 @@ void LocalIntegrationRecorder::recordTimeAndVolumeIntegrals() {
     std::vector<real *> dQPtrs(size, nullptr);
     std::vector<real *> ltsBuffers{};
     std::vector<real *> idofsForLtsBuffers{};
+#ifdef USE_POROELASTIC
+    std::vector<real *> sourceMatrixPtrs(size, nullptr);
+    std::vector<real *> zinvPtrs(size, nullptr);
+    std::vector<real *> gPtrs(size, nullptr);
+    std::vector<real *> stpRhsPtrs(size, nullptr);
+    real *stpRhsScratch = static_cast<real *>(currentLayer->getScratchpadMemory(currentHandler->stpRhsScratch));
+#endif
+#ifdef USE_RECOMPUTED_STAR_MATRICES
+    std::vector<real *> starGradientsPtrs(size, nullptr);
+    std::vector<real *> starCoefficientsPtrs(size, nullptr);
+    real *starMatricesScratch = static_cast<real *>(currentLayer->getScratchpadMemory(currentHandler->starMatricesScratch));
+#endif
 
     idofsPtrs.reserve(size);
 
@@ -76,7 +88,22 @@ void LocalIntegrationRecorder::recordTimeAndVolumeIntegrals() {
       }
 
       // stars
+#ifdef USE_RECOMPUTED_STAR_MATRICES
+      // recomputed before the time integration, see Time::computeBatchedAder
+      starPtrs[cell] = &starMatricesScratch[cell * yateto::computeFamilySize<tensor::star>()];
+      starGradientsPtrs[cell] = data.localIntegrationOnDevice.gradients[0];
+      starCoefficientsPtrs[cell] = data.localIntegrationOnDevice.starCoefficients;
+#else
       starPtrs[cell] = static_cast<real *>(data.localIntegrationOnDevice.starMatrices[0]);
+#endif
+
+#ifdef USE_POROELASTIC
+      // source term and space-time predictor, see the poroelastic Time::computeBatchedAder
+      sourceMatrixPtrs[cell] = data.localIntegrationOnDevice.specific.sourceMatrix;
+      zinvPtrs[cell] = data.localIntegrationOnDevice.specific.Zinv[0];
+      gPtrs[cell] = data.localIntegrationOnDevice.specific.Gmatrix;
+      stpRhsPtrs[cell] = &stpRhsScratch[cell * tensor::spaceTimePredictorRhs::size()];
+#endif
 
       // derivatives
       bool isDerivativesProvided = ((data.cellInformation.ltsSetup >> 9) % 2) == 1;
@@ -98,6 +125,16 @@ void LocalIntegrationRecorder::recordTimeAndVolumeIntegrals() {
     (*currentTable)[key].content[*EntityId::Star] = new BatchPointers(starPtrs);
     (*currentTable)[key].content[*EntityId::Idofs] = new BatchPointers(idofsPtrs);
     (*currentTable)[key].content[*EntityId::Derivatives] = new BatchPointers(dQPtrs);
+#ifdef USE_POROELASTIC
+    (*currentTable)[key].content[*EntityId::SourceMatrix] = new BatchPointers(sourceMatrixPtrs);
+    (*currentTable)[key].content[*EntityId::Zinv] = new BatchPointers(zinvPtrs);
+    (*currentTable)[key].content[*EntityId::Gmatrix] = new BatchPointers(gPtrs);
+    (*currentTable)[key].content[*EntityId::StpRhs] = new BatchPointers(stpRhsPtrs);
+#endif
+#ifdef USE_RECOMPUTED_STAR_MATRICES
+    (*currentTable)[key].content[*EntityId::StarGradients] = new BatchPointers(starGradientsPtrs);
+    (*currentTable)[key].content[*EntityId::StarCoefficients] = new BatchPointers(starCoefficientsPtrs);
+#endif
 
 
     if (!idofsForLtsBuffers.empty()) {
@@ -41,7 +41,12 @@
 
 #include "CellLocalMatrices.h"
 
+#include <algorithm>
+#include <array>
 #include <cassert>
+#include <functional>
+#include <type_traits>
+#include <unordered_map>
 
 #include <Initializer/ParameterDB.h>
 #include "Initializer/MemoryManager.h"
@@ -49,31 +54,150 @@
 #include <Equations/Setup.h>
 #include <Model/common.hpp>
 #include <Geometry/MeshTools.h>
+#include <Kernels/StarMatrices.h>
 #include <generated_code/tensor.h>
 #include <generated_code/kernel.h>
 #include <utils/logger.h>
 #ifdef ACL_DEVICE
+#include <Parallel/MPI.h>
 #include <device.h>
 #endif
 
-void setStarMatrix( real* i_AT,
-                    real* i_BT,
-                    real* i_CT,
-                    real  i_grad[3],
-                    real* o_starMatrix )
-{
-  for (unsigned idx = 0; idx < seissol::tensor::star::size(0); ++idx) {
-    o_starMatrix[idx] = i_grad[0] * i_AT[idx];
+namespace {
+/**
+ * The parameters of an isotropic material which determine its Godunov states. Materials without a specialization
+ * (e.g. anisotropic materials, whose states depend on the orientation of the face) are not cached.
+ **/
+template <typename MaterialT, typename Enable = void>
+struct GodunovStateParameters {
+  static constexpr std::size_t Size = 0;
+};
+
+template <typename MaterialT>
+struct GodunovStateParameters<
+    MaterialT,
+    std::enable_if_t<std::is_base_of<seissol::model::ElasticMaterial, MaterialT>::value>> {
+  // Viscoelastic materials only use their elastic parameters for the Godunov state
+  static constexpr std::size_t Size = 3;
+  static std::array<double, Size> get(MaterialT const& material) {
+    return {material.rho, material.mu, material.lambda};
+  }
+};
+
+#ifdef USE_POROELASTIC
+template <>
+struct GodunovStateParameters<seissol::model::PoroElasticMaterial> {
+  static constexpr std::size_t Size = 10;
+  static std::array<double, Size> get(seissol::model::PoroElasticMaterial const& material) {
+    return {material.bulkSolid,
+            material.rho,
+            material.lambda,
+            material.mu,
+            material.porosity,
+            material.permeability,
+            material.tortuosity,
+            material.bulkFluid,
+            material.rhoFluid,
+            material.viscosity};
   }
+};
+#endif
 
-  for (unsigned idx = 0; idx < seissol::tensor::star::size(1); ++idx) {
-    o_starMatrix[idx] += i_grad[1] * i_BT[idx];
+/**
+ * The Godunov states of isotropic materials are computed in the face-aligned coordinate system, i.e. they only depend
+ * on the parameters of both materials and on the face type. Most meshes consist of few distinct materials, hence each
+ * thread caches the states it computed, which saves the eigendecompositions of poroelastic materials in particular.
+ * The cache is cleared when it grows too large for heterogeneous models.
+ **/
+template <typename MaterialT>
+class GodunovStateCache {
+  public:
+  static constexpr std::size_t NumParameters = GodunovStateParameters<MaterialT>::Size;
+  static constexpr bool Enabled = NumParameters > 0;
+
+  void compute(MaterialT const& local,
+               MaterialT const& neighbor,
+               FaceType faceType,
+               init::QgodLocal::view::type& QgodLocal,
+               init::QgodNeighbor::view::type& QgodNeighbor) {
+    if constexpr (!Enabled) {
+      seissol::model::getTransposedGodunovState(local, neighbor, faceType, QgodLocal, QgodNeighbor);
+    } else {
+      computeCached(local, neighbor, faceType, QgodLocal, QgodNeighbor);
+    }
   }
 
-  for (unsigned idx = 0; idx < seissol::tensor::star::size(2); ++idx) {
-    o_starMatrix[idx] += i_grad[2] * i_CT[idx];
+  private:
+  static constexpr std::size_t MaxEntries = 4096;
+
+  void computeCached(MaterialT const& local,
+                     MaterialT const& neighbor,
+                     FaceType faceType,
+                     init::QgodLocal::view::type& QgodLocal,
+                     init::QgodNeighbor::view::type& QgodNeighbor) {
+    Key key{};
+    auto const localParameters = GodunovStateParameters<MaterialT>::get(local);
+    auto const neighborParameters = GodunovStateParameters<MaterialT>::get(neighbor);
+    std::copy(localParameters.begin(), localParameters.end(), key.parameters.begin());
+    std::copy(neighborParameters.begin(), neighborParameters.end(), key.parameters.begin() + NumParameters);
+    key.faceType = static_cast<int>(faceType);
+    auto cached = m_states.find(key);
+    if (cached != m_states.end()) {
+      std::copy(cached->second.local.begin(), cached->second.local.end(), QgodLocal.data());
+      std::copy(cached->second.neighbor.begin(), cached->second.neighbor.end(), QgodNeighbor.data());
+      return;
+    }
+
+    seissol::model::getTransposedGodunovState(local, neighbor, faceType, QgodLocal, QgodNeighbor);
+    if (m_states.size() >= MaxEntries) {
+      m_states.clear();
+    }
+    State& state = m_states[key];
+    std::copy(QgodLocal.data(), QgodLocal.data() + state.local.size(), state.local.begin());
+    std::copy(QgodNeighbor.data(), QgodNeighbor.data() + state.neighbor.size(), state.neighbor.begin());
   }
+
+  struct Key {
+    std::array<double, 2 * NumParameters> parameters;
+    int faceType;
+
+    bool operator==(Key const& other) const {
+      return faceType == other.faceType && parameters == other.parameters;
+    }
+  };
+
+  struct KeyHash {
+    std::size_t operator()(Key const& key) const {
+      std::size_t hash = std::hash<int>()(key.faceType);
+      for (double parameter : key.parameters) {
+        hash ^= std::hash<double>()(parameter) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+      }
+      return hash;
+    }
+  };
+
+  struct State {
+    std::array<real, tensor::QgodLocal::size()> local;
+    std::array<real, tensor::QgodNeighbor::size()> neighbor;
+  };
+
+  std::unordered_map<Key, State, KeyHash> m_states;
+};
+
+#ifdef ACL_DEVICE
+void copyLayerMatricesToDevice(seissol::initializers::Layer& layer, seissol::initializers::LTS const& lts) {
+  device::DeviceInstance& device = device::DeviceInstance::getInstance();
+  // the current device is thread-local
+  device.api->setDevice(seissol::MPI::mpi.getDeviceID());
+  device.api->copyTo(layer.var(lts.localIntegrationOnDevice),
+                     layer.var(lts.localIntegration),
+                     layer.getNumberOfCells() * sizeof(LocalIntegrationData));
+  device.api->copyTo(layer.var(lts.neighIntegrationOnDevice),
+                     layer.var(lts.neighboringIntegration),
+                     layer.getNumberOfCells() * sizeof(NeighboringIntegrationData));
 }
+#endif
+} // namespace
 
 void seissol::initializers::initializeCellLocalMatrices( MeshReader const&      i_meshReader,
                                                          LTSTree*               io_ltsTree,
@@ -96,16 +220,20 @@ void seissol::initializers::initializeCellLocalMatrices( MeshReader const&
   assert(ltsToMesh      == i_ltsLut->getLtsToMeshLut(i_lts->localIntegration.mask));
   assert(ltsToMesh      == i_ltsLut->getLtsToMeshLut(i_lts->neighboringIntegration.mask));
 
+  // One parallel region for all layers, such that the Godunov state cache of each thread lives across layers
+#ifdef _OPENMP
+  #pragma omp parallel
+#endif
+  {
+  GodunovStateCache<decltype(CellMaterialData::local)> godunovStateCache;
+  unsigned const* layerLtsToMesh = ltsToMesh;
+
   for (LTSTree::leaf_iterator it = io_ltsTree->beginLeaf(LayerMask(Ghost)); it != io_ltsTree->endLeaf(); ++it) {
     CellMaterialData*           material                = it->var(i_lts->material);
     LocalIntegrationData*       localIntegration        = it->var(i_lts->localIntegration);
     NeighboringIntegrationData* neighboringIntegration  = it->var(i_lts->neighboringIntegration);
     CellLocalInformation*       cellInformation         = it->var(i_lts->cellInformation);
 
-#ifdef _OPENMP
-  #pragma omp parallel
-    {
-#endif
     real ATData[tensor::star::size(0)];
     real ATtildeData[tensor::star::size(0)];
     real BTData[tensor::star::size(1)];
@@ -127,12 +255,17 @@ void seissol::initializers::initializeCellLocalMatrices( MeshReader const&
     auto QgodNeighbor = init::QgodNeighbor::view::create(QgodNeighborData);
     
 #ifdef _OPENMP
+#ifdef ACL_DEVICE
+    // dynamic, as one thread may still copy the previous layer to the device
+    #pragma omp for schedule(dynamic, 64)
+#else
     #pragma omp for schedule(static)
+#endif
 #endif
     for (unsigned cell = 0; cell < it->getNumberOfCells(); ++cell) {
       unsigned clusterId = cellInformation[cell].clusterId;
       auto timeStepWidth = timeStepping.globalCflTimeStepWidths[clusterId];
-      unsigned meshId = ltsToMesh[cell];
+      unsigned meshId = layerLtsToMesh[cell];
 
       real x[4];
       real y[4];
@@ -151,22 +284,26 @@ void seissol::initializers::initializeCellLocalMatrices( MeshReader const&
 
       seissol::transformations::tetrahedronGlobalToReferenceJacobian( x, y, z, gradXi, gradEta, gradZeta );
 
+#ifdef USE_RECOMPUTED_STAR_MATRICES
+      // the star matrices are recomputed from the material and the gradients in the kernels
+      std::copy(gradXi, gradXi + 3, localIntegration[cell].gradients[0]);
+      std::copy(gradEta, gradEta + 3, localIntegration[cell].gradients[1]);
+      std::copy(gradZeta, gradZeta + 3, localIntegration[cell].gradients[2]);
+#ifdef ACL_DEVICE
+      kernels::setStarCoefficients(material[cell].local, localIntegration[cell].starCoefficients);
+#endif
+#else
       seissol::model::getTransposedCoefficientMatrix( material[cell].local, 0, AT );
       seissol::model::getTransposedCoefficientMatrix( material[cell].local, 1, BT );
       seissol::model::getTransposedCoefficientMatrix( material[cell].local, 2, CT );
-      setStarMatrix(ATData, BTData, CTData, gradXi, localIntegration[cell].starMatrices[0]);
-      setStarMatrix(ATData, BTData, CTData, gradEta, localIntegration[cell].starMatrices[1]);
-      setStarMatrix(ATData, BTData, CTData, gradZeta, localIntegration[cell].starMatrices[2]);
+      kernels::setStarMatrix(ATData, BTData, CTData, gradXi, localIntegration[cell].starMatrices[0]);
+      kernels::setStarMatrix(ATData, BTData, CTData, gradEta, localIntegration[cell].starMatrices[1]);
+      kernels::setStarMatrix(ATData, BTData, CTData, gradZeta, localIntegration[cell].starMatrices[2]);
+#endif
 
       double volume = MeshTools::volume(elements[meshId], vertices);
 
       for (unsigned side = 0; side < 4; ++side) {
-        seissol::model::getTransposedGodunovState(  material[cell].local,
-                                                    material[cell].neighbor[side],
-                                                    cellInformation[cell].faceTypes[side],
-                                                    QgodLocal,
-                                                    QgodNeighbor );
-
         VrtxCoords normal;
         VrtxCoords tangent1;
         VrtxCoords tangent2;
@@ -179,18 +316,19 @@ void seissol::initializers::initializeCellLocalMatrices( MeshReader const&
         real NLocalData[6*6];
         seissol::model::getBondMatrix(normal, tangent1, tangent2, NLocalData);
         if (material[cell].local.getMaterialType() == seissol::model::MaterialType::anisotropic) {
-          seissol::model::getTransposedGodunovState(  seissol::model::getRotatedMaterialCoefficients(NLocalData, *dynamic_cast<seissol::model::AnisotropicMaterial*>(&material[cell].local)),
+          const auto rotatedLocal = seissol::model::getRotatedMaterialCoefficients(NLocalData, *dynamic_cast<seissol::model::AnisotropicMaterial*>(&material[cell].local));
+          seissol::model::getTransposedGodunovState(  rotatedLocal,
                                                       seissol::model::getRotatedMaterialCoefficients(NLocalData, *dynamic_cast<seissol::model::AnisotropicMaterial*>(&material[cell].neighbor[side])),
                                                       cellInformation[cell].faceTypes[side],
                                                       QgodLocal,
                                                       QgodNeighbor );
-          seissol::model::getTransposedCoefficientMatrix( seissol::model::getRotatedMaterialCoefficients(NLocalData, *dynamic_cast<seissol::model::AnisotropicMaterial*>(&material[cell].local)), 0, ATtilde );
+          seissol::model::getTransposedCoefficientMatrix( rotatedLocal, 0, ATtilde );
         } else {
-          seissol::model::getTransposedGodunovState(  material[cell].local,
-                                                      material[cell].neighbor[side],     
-                                                      cellInformation[cell].faceTypes[side],
-                                                      QgodLocal,
-                                                      QgodNeighbor );
+          godunovStateCache.compute(  material[cell].local,
+                                      material[cell].neighbor[side],
+                                      cellInformation[cell].faceTypes[side],
+                                      QgodLocal,
+                                      QgodNeighbor );
           seissol::model::getTransposedCoefficientMatrix( material[cell].local, 0, ATtilde );
         }
 
@@ -201,9 +339,12 @@ void seissol::initializers::initializeCellLocalMatrices( MeshReader const&
         // must be subtracted.
         real fluxScale = -2.0 * surface / (6.0 * volume);
 
+        alignas(ALIGNMENT) real AplusT[tensor::AplusT::size()];
+        alignas(ALIGNMENT) real AminusT[tensor::AminusT::size()];
+
         kernel::computeFluxSolverLocal localKrnl;
         localKrnl.fluxScale = fluxScale;
-        localKrnl.AplusT = localIntegration[cell].nApNm1[side];
+        localKrnl.AplusT = kernels::fluxSolverTarget(localIntegration[cell].nApNm1[side], AplusT);
         localKrnl.QgodLocal = QgodLocalData;
         localKrnl.T = TData;
         localKrnl.Tinv = TinvData;
@@ -212,7 +353,7 @@ void seissol::initializers::initializeCellLocalMatrices( MeshReader const&
         
         kernel::computeFluxSolverNeighbor neighKrnl;
         neighKrnl.fluxScale = fluxScale;
-        neighKrnl.AminusT = neighboringIntegration[cell].nAmNm1[side];
+        neighKrnl.AminusT = kernels::fluxSolverTarget(neighboringIntegration[cell].nAmNm1[side], AminusT);
         neighKrnl.QgodNeighbor = QgodNeighborData;
         neighKrnl.T = TData;
         neighKrnl.Tinv = TinvData;
@@ -223,6 +364,8 @@ void seissol::initializers::initializeCellLocalMatrices( MeshReader const&
           neighKrnl.Tinv = init::identityT::Values;
         }
         neighKrnl.execute();
+        kernels::storeFluxSolver(AplusT, localIntegration[cell].nApNm1[side]);
+        kernels::storeFluxSolver(AminusT, neighboringIntegration[cell].nAmNm1[side]);
       }
 
       seissol::model::initializeSpecificLocalData(  material[cell].local,
@@ -233,10 +376,17 @@ void seissol::initializers::initializeCellLocalMatrices( MeshReader const&
                                                       &neighboringIntegration[cell].specific );
 
     }
+    layerLtsToMesh += it->getNumberOfCells();
+
+#ifdef ACL_DEVICE
+    // The layer is complete after the implicit barrier of the loop. One thread copies it to the device, while the
+    // others continue with the next layer.
 #ifdef _OPENMP
-    }
+    #pragma omp single nowait
 #endif
-    ltsToMesh += it->getNumberOfCells();
+    copyLayerMatricesToDevice(*it, *i_lts);
+#endif
+  }
   }
 }
 
@@ -448,6 +598,7 @@ void seissol::initializers::initializeDynamicRuptureMatrices( MeshReader const&
       assert(timeDerivativePlus[ltsFace] != NULL && timeDerivativeMinus[ltsFace] != NULL);
 
       /// DR mapping for elements
+      // Every side of a cell belongs to at most one fault face, hence no two faces write the same mapping
       for (unsigned duplicate = 0; duplicate < Lut::MaxDuplicates; ++duplicate) {
         unsigned plusLtsId = (fault[meshFace].element >= 0)          ? i_ltsLut->ltsId(i_lts->drMapping.mask, fault[meshFace].element, duplicate) : std::numeric_limits<unsigned>::max();
         unsigned minusLtsId = (fault[meshFace].neighborElement >= 0) ? i_ltsLut->ltsId(i_lts->drMapping.mask, fault[meshFace].neighborElement, duplicate) : std::numeric_limits<unsigned>::max();
@@ -455,28 +606,18 @@ void seissol::initializers::initializeDynamicRuptureMatrices( MeshReader const&
         assert(duplicate != 0 || plusLtsId != std::numeric_limits<unsigned>::max() || minusLtsId != std::numeric_limits<unsigned>::max());
 
         if (plusLtsId != std::numeric_limits<unsigned>::max()) {
-#ifdef _OPENMP
-#pragma omp critical
-#endif // _OPENMP
-{
           CellDRMapping& mapping = drMapping[plusLtsId][ faceInformation[ltsFace].plusSide ];
           mapping.side = faceInformation[ltsFace].plusSide;
           mapping.faceRelation = 0;
           mapping.godunov = &imposedStatePlus[ltsFace][0];
           mapping.fluxSolver = &fluxSolverPlus[ltsFace][0];
-}
         }
         if (minusLtsId != std::numeric_limits<unsigned>::max()) {
-#ifdef _OPENMP
-#pragma omp critical
-#endif // _OPENMP
-{
           CellDRMapping& mapping = drMapping[minusLtsId][ faceInformation[ltsFace].minusSide ];
           mapping.side = faceInformation[ltsFace].minusSide;
           mapping.faceRelation = faceInformation[ltsFace].faceRelation;
           mapping.godunov = &imposedStateMinus[ltsFace][0];
           mapping.fluxSolver = &fluxSolverMinus[ltsFace][0];
-}
         }
       }
 
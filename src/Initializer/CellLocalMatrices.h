@@ -54,6 +54,7 @@ namespace seissol {
       class EasiBoundary;
       /**
       * Computes the star matrices A*, B*, and C*, and solves the Riemann problems at the interfaces.
+      * In device builds, each layer is copied to the device as soon as it is complete.
       **/
      void initializeCellLocalMatrices( MeshReader const&      i_meshReader,                                                    
                                        LTSTree*               io_ltsTree,
@@ -77,6 +78,10 @@ namespace seissol {
                                             GlobalData const&      global,
                                             TimeStepping const&    timeStepping );
 
+      /**
+      * Copies the cell matrices to the device, if they were not computed by initializeCellLocalMatrices
+      * (e.g. loaded from a setup snapshot).
+      **/
       void copyCellMatricesToDevice(LTSTree*          ltsTree,
                                     LTS*              lts,
                                     LTSTree*          dynRupTree,
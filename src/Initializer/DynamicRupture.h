@@ -43,6 +43,8 @@
 #include <Initializer/typedefs.hpp>
 #include <Initializer/tree/LTSTree.hpp>
 #include <generated_code/tensor.h>
+#include <DynamicRupture/Misc.h>
+#include <DynamicRupture/Parameters.h>
 
 namespace seissol {
   namespace initializers {
@@ -54,10 +56,12 @@ namespace seissol {
 #	define MEMKIND_NEIGHBOUR_INTEGRATION seissol::memory::Standard
 #	define MEMKIND_Q_INTERPOLATED seissol::memory::Standard
 #	define MEMKIND_IMPOSED_STATE seissol::memory::Standard
+#	define MEMKIND_FRICTION_STATE seissol::memory::Standard
 #else
 #	define MEMKIND_NEIGHBOUR_INTEGRATION seissol::memory::DeviceUnifiedMemory
 #	define MEMKIND_Q_INTERPOLATED seissol::memory::PinnedMemory
 #	define MEMKIND_IMPOSED_STATE seissol::memory::DeviceGlobalMemory
+#	define MEMKIND_FRICTION_STATE seissol::memory::DeviceUnifiedMemory
 #endif
 
 struct seissol::initializers::DynamicRupture {
@@ -72,6 +76,43 @@ struct seissol::initializers::DynamicRupture {
   Variable<model::IsotropicWaveSpeeds>                              waveSpeedsPlus;
   Variable<model::IsotropicWaveSpeeds>                              waveSpeedsMinus;
   Variable<DROutput>                                                drOutput;
+
+  // friction law state and parameters, allocated only if the C++ friction solvers are used
+  // (accessible by host and device on GPUs)
+  Variable<real[dr::numPaddedPoints]>                               mu;
+  Variable<real[dr::numPaddedPoints]>                               slip;
+  Variable<real[dr::numPaddedPoints]>                               slip1;
+  Variable<real[dr::numPaddedPoints]>                               slip2;
+  Variable<real[dr::numPaddedPoints]>                               slipRate1;
+  Variable<real[dr::numPaddedPoints]>                               slipRate2;
+  Variable<real[dr::numPaddedPoints]>                               tractionXY;
+  Variable<real[dr::numPaddedPoints]>                               tractionXZ;
+  Variable<real[dr::numPaddedPoints]>                               peakSlipRate;
+  Variable<real[dr::numPaddedPoints]>                               ruptureTime;
+  Variable<real[dr::numPaddedPoints]>                               dynStressTime;
+  Variable<bool[dr::numPaddedPoints]>                               ruptureTimePending;
+  Variable<bool[dr::numPaddedPoints]>                               dynStressTimePending;
+  Variable<real[6][dr::numPaddedPoints]>                            initialStressInFaultCS;
+  Variable<real[6][dr::numPaddedPoints]>                            nucleationStressInFaultCS;
+  Variable<DRNucleationWindow>                                      nucleationWindow;
+  // linear slip weakening
+  Variable<real[dr::numPaddedPoints]>                               dC;
+  Variable<real[dr::numPaddedPoints]>                               muS;
+  Variable<real[dr::numPaddedPoints]>                               muD;
+  Variable<real[dr::numPaddedPoints]>                               cohesion;
+  Variable<real[dr::numPaddedPoints]>                               forcedRuptureTime;
+  // rate and state
+  Variable<real[dr::numPaddedPoints]>                               stateVariable;
+  Variable<real[dr::numPaddedPoints]>                               rsA;
+  Variable<real[dr::numPaddedPoints]>                               rsSl0;
+  Variable<real[dr::numPaddedPoints]>                               rsSrW;
+  // thermal pressurization
+  Variable<real[dr::numPaddedPoints]>                               temperature;
+  Variable<real[dr::numPaddedPoints]>                               pressure;
+  Variable<real[dr::numberOfTPGridPoints][dr::numPaddedPoints]>     tpTheta;
+  Variable<real[dr::numberOfTPGridPoints][dr::numPaddedPoints]>     tpSigma;
+  Variable<real[dr::numPaddedPoints]>                               tpHalfWidthShearZone;
+  Variable<real[dr::numPaddedPoints]>                               alphaHy;
 #ifdef ACL_DEVICE
   ScratchpadMemory                        idofsPlusOnDevice;
   ScratchpadMemory                        idofsMinusOnDevice;
@@ -84,8 +125,18 @@ struct seissol::initializers::DynamicRupture {
   ScratchpadMemory                        imposedStateMinusOnHost;
 #endif
   
-  void addTo(LTSTree& tree) {
+  void addTo(LTSTree& tree, dr::DRParameters const& drParameters) {
     LayerMask mask = LayerMask(Ghost);
+    LayerMask const allMasked = LayerMask(Ghost) | LayerMask(Copy) | LayerMask(Interior);
+    int const fl = drParameters.frictionLaw;
+    LayerMask const frictionMask = drParameters.isNativeSolverEnabled ? mask : allMasked;
+    LayerMask const lswMask = (drParameters.isNativeSolverEnabled && (fl == 2 || fl == 16)) ? mask : allMasked;
+    LayerMask const rsMask = (drParameters.isNativeSolverEnabled && (fl == 3 || fl == 4 || fl == 103)) ? mask : allMasked;
+    LayerMask const rsSrWMask = (drParameters.isNativeSolverEnabled && fl == 103) ? mask : allMasked;
+    LayerMask const tpMask =
+        (drParameters.isNativeSolverEnabled && drParameters.isThermalPressureOn && (fl == 3 || fl == 4 || fl == 103))
+            ? mask
+            : allMasked;
     tree.addVar(      timeDerivativePlus,             mask,                 1,      seissol::memory::Standard );
     tree.addVar(     timeDerivativeMinus,             mask,                 1,      seissol::memory::Standard );
     tree.addVar(        imposedStatePlus,             mask,     PAGESIZE_HEAP,      MEMKIND_IMPOSED_STATE );
@@ -94,9 +145,41 @@ struct seissol::initializers::DynamicRupture {
     tree.addVar(          fluxSolverPlus,             mask,                 1,      MEMKIND_NEIGHBOUR_INTEGRATION );
     tree.addVar(         fluxSolverMinus,             mask,                 1,      MEMKIND_NEIGHBOUR_INTEGRATION );
     tree.addVar(         faceInformation,             mask,                 1,      seissol::memory::Standard );
-    tree.addVar(          waveSpeedsPlus,             mask,                 1,      seissol::memory::Standard );
-    tree.addVar(         waveSpeedsMinus,             mask,                 1,      seissol::memory::Standard );
+    tree.addVar(          waveSpeedsPlus,             mask,                 1,      MEMKIND_FRICTION_STATE );
+    tree.addVar(         waveSpeedsMinus,             mask,                 1,      MEMKIND_FRICTION_STATE );
     tree.addVar(                drOutput,             mask,         ALIGNMENT,      seissol::memory::Standard );
+
+    tree.addVar(                      mu,     frictionMask,         ALIGNMENT,      MEMKIND_FRICTION_STATE );
+    tree.addVar(                    slip,     frictionMask,         ALIGNMENT,      MEMKIND_FRICTION_STATE );
+    tree.addVar(                   slip1,     frictionMask,         ALIGNMENT,      MEMKIND_FRICTION_STATE );
+    tree.addVar(                   slip2,     frictionMask,         ALIGNMENT,      MEMKIND_FRICTION_STATE );
+    tree.addVar(               slipRate1,     frictionMask,         ALIGNMENT,      MEMKIND_FRICTION_STATE );
+    tree.addVar(               slipRate2,     frictionMask,         ALIGNMENT,      MEMKIND_FRICTION_STATE );
+    tree.addVar(              tractionXY,     frictionMask,         ALIGNMENT,      MEMKIND_FRICTION_STATE );
+    tree.addVar(              tractionXZ,     frictionMask,         ALIGNMENT,      MEMKIND_FRICTION_STATE );
+    tree.addVar(            peakSlipRate,     frictionMask,         ALIGNMENT,      MEMKIND_FRICTION_STATE );
+    tree.addVar(             ruptureTime,     frictionMask,         ALIGNMENT,      MEMKIND_FRICTION_STATE );
+    tree.addVar(           dynStressTime,     frictionMask,         ALIGNMENT,      MEMKIND_FRICTION_STATE );
+    tree.addVar(      ruptureTimePending,     frictionMask,                 1,      MEMKIND_FRICTION_STATE );
+    tree.addVar(    dynStressTimePending,     frictionMask,                 1,      MEMKIND_FRICTION_STATE );
+    tree.addVar(  initialStressInFaultCS,     frictionMask,         ALIGNMENT,      MEMKIND_FRICTION_STATE );
+    tree.addVar(nucleationStressInFaultCS,    frictionMask,         ALIGNMENT,      MEMKIND_FRICTION_STATE );
+    tree.addVar(        nucleationWindow,     frictionMask,                 1,      MEMKIND_FRICTION_STATE );
+    tree.addVar(                      dC,          lswMask,         ALIGNMENT,      MEMKIND_FRICTION_STATE );
+    tree.addVar(                     muS,          lswMask,         ALIGNMENT,      MEMKIND_FRICTION_STATE );
+    tree.addVar(                     muD,          lswMask,         ALIGNMENT,      MEMKIND_FRICTION_STATE );
+    tree.addVar(                cohesion,          lswMask,         ALIGNMENT,      MEMKIND_FRICTION_STATE );
+    tree.addVar(       forcedRuptureTime,          lswMask,         ALIGNMENT,      MEMKIND_FRICTION_STATE );
+    tree.addVar(           stateVariable,           rsMask,         ALIGNMENT,      MEMKIND_FRICTION_STATE );
+    tree.addVar(                     rsA,           rsMask,         ALIGNMENT,      MEMKIND_FRICTION_STATE );
+    tree.addVar(                   rsSl0,           rsMask,         ALIGNMENT,      MEMKIND_FRICTION_STATE );
+    tree.addVar(                   rsSrW,        rsSrWMask,         ALIGNMENT,      MEMKIND_FRICTION_STATE );
+    tree.addVar(             temperature,           tpMask,         ALIGNMENT,      MEMKIND_FRICTION_STATE );
+    tree.addVar(                pressure,           tpMask,         ALIGNMENT,      MEMKIND_FRICTION_STATE );
+    tree.addVar(                 tpTheta,           tpMask,         ALIGNMENT,      MEMKIND_FRICTION_STATE );
+    tree.addVar(                 tpSigma,           tpMask,         ALIGNMENT,      MEMKIND_FRICTION_STATE );
+    tree.addVar(    tpHalfWidthShearZone,           tpMask,         ALIGNMENT,      MEMKIND_FRICTION_STATE );
+    tree.addVar(                 alphaHy,           tpMask,         ALIGNMENT,      MEMKIND_FRICTION_STATE );
 #ifdef ACL_DEVICE
     tree.addScratchpadMemory(  idofsPlusOnDevice,              1,      seissol::memory::DeviceGlobalMemory);
     tree.addScratchpadMemory(  idofsMinusOnDevice,             1,      seissol::memory::DeviceGlobalMemory);
@@ -40,6 +40,7 @@
 #include "GlobalData.h"
 #include <generated_code/init.h>
 #include <yateto.h>
+#include <algorithm>
 #include <type_traits>
 
 #ifdef _OPENMP
@@ -55,6 +56,16 @@ namespace seissol::initializers {
       return MemoryProperties();
     }
 
+    bool OnHost::HostCopyPolicy::writeMemory = true;
+
+    real* OnHost::HostCopyPolicy::copy(real const* first, real const* last, real*& mem) {
+      if (writeMemory) {
+        std::copy(first, last, mem);
+      }
+      mem += (last - first);
+      return mem;
+    }
+
     void OnHost::negateStiffnessMatrix(GlobalData &globalData) {
       for (unsigned transposedStiffness = 0; transposedStiffness < 3; ++transposedStiffness) {
         real *matrix = const_cast<real *>(globalData.stiffnessMatricesTransposed(transposedStiffness));
@@ -136,6 +147,16 @@ namespace seissol::initializers {
       copyManager.template copyTensorToMemAndSetPtr<init::replicateInitialLoadingM>(plasticityStressReplication,
                                                                                     globalData.replicateStresses,
                                                                                     alignment);
+
+      const size_t resampleSize = yateto::alignedUpper(tensor::resample::size(),
+                                                       yateto::alignedReals<real>(alignment));
+      real* resampleMatrix = static_cast<real*>(allocator.allocateMemory(resampleSize * sizeof(real),
+                                                                         alignment,
+                                                                         memkind));
+
+      copyManager.template copyTensorToMemAndSetPtr<init::resample>(resampleMatrix,
+                                                                    globalData.resampleMatrix,
+                                                                    alignment);
 #endif // ACL_DEVICE
     }
 
@@ -157,9 +178,33 @@ namespace seissol::initializers {
 template<typename MatrixManipPolicyT>
 void GlobalDataInitializer<MatrixManipPolicyT>::init(GlobalData& globalData,
                                                      memory::ManagedAllocator& memoryAllocator,
-                                                     enum seissol::memory::Memkind memkind) {
+                                                     enum seissol::memory::Memkind memkind,
+                                                     SharedMemoryT* sharedMemory) {
   MemoryProperties prop = MatrixManipPolicyT::getProperties();
 
+  // The global matrices are written by the first rank of the node if they are shared;
+  // the other ranks only set their pointers.
+  bool writeMemory = true;
+  if constexpr (std::is_same_v<MatrixManipPolicyT, matrixmanip::OnHost>) {
+#ifdef USE_MPI
+    if (sharedMemory != nullptr) {
+      writeMemory = sharedMemory->isWriter();
+    }
+#endif
+    matrixmanip::OnHost::HostCopyPolicy::writeMemory = writeMemory;
+  } else {
+    // Only the global matrices on the host can be shared by the ranks of a node.
+    assert(sharedMemory == nullptr);
+  }
+  auto allocateGlobalMatrices = [&](unsigned size) {
+#ifdef USE_MPI
+    if (sharedMemory != nullptr) {
+      return static_cast<real*>(sharedMemory->allocate(size * sizeof(real), prop.pagesizeHeap));
+    }
+#endif
+    return static_cast<real*>(memoryAllocator.allocateMemory(size * sizeof(real), prop.pagesizeHeap, memkind));
+  };
+
   // We ensure that global matrices always start at an aligned memory address,
   // such that mixed cases with aligned and non-aligned global matrices do also work.
   unsigned globalMatrixMemSize = 0;
@@ -175,9 +220,7 @@ void GlobalDataInitializer<MatrixManipPolicyT>::init(GlobalData& globalData,
   globalMatrixMemSize += yateto::alignedUpper(tensor::evalAtQP::size(),  yateto::alignedReals<real>(prop.alignment));
   globalMatrixMemSize += yateto::alignedUpper(tensor::projectQP::size(), yateto::alignedReals<real>(prop.alignment));
 
-  real* globalMatrixMem = static_cast<real*>(memoryAllocator.allocateMemory(globalMatrixMemSize * sizeof(real),
-                                                                            prop.pagesizeHeap,
-                                                                            memkind));
+  real* globalMatrixMem = allocateGlobalMatrices(globalMatrixMemSize);
 
   real* globalMatrixMemPtr = globalMatrixMem;
   typename MatrixManipPolicyT::CopyManagerT copyManager;
@@ -196,16 +239,16 @@ void GlobalDataInitializer<MatrixManipPolicyT>::init(GlobalData& globalData,
   assert(globalMatrixMemPtr == globalMatrixMem + globalMatrixMemSize);
 
   // @TODO Integrate this step into the code generator
-  MatrixManipPolicyT::negateStiffnessMatrix(globalData);
+  if (writeMemory) {
+    MatrixManipPolicyT::negateStiffnessMatrix(globalData);
+  }
 
   // Dynamic Rupture global matrices
   unsigned drGlobalMatrixMemSize = 0;
   drGlobalMatrixMemSize += yateto::computeFamilySize<init::V3mTo2nTWDivM>(yateto::alignedReals<real>(prop.alignment));
   drGlobalMatrixMemSize += yateto::computeFamilySize<init::V3mTo2n>(yateto::alignedReals<real>(prop.alignment));
 
-  real* drGlobalMatrixMem = static_cast<real*>(memoryAllocator.allocateMemory(drGlobalMatrixMemSize  * sizeof(real),
-                                                                              prop.pagesizeHeap,
-                                                                              memkind));
+  real* drGlobalMatrixMem = allocateGlobalMatrices(drGlobalMatrixMemSize);
 
   real* drGlobalMatrixMemPtr = drGlobalMatrixMem;
   copyManager.template copyFamilyToMemAndSetPtr<init::V3mTo2nTWDivM>(drGlobalMatrixMemPtr, globalData.nodalFluxMatrices, prop.alignment);
@@ -218,10 +261,7 @@ void GlobalDataInitializer<MatrixManipPolicyT>::init(GlobalData& globalData,
   plasticityGlobalMatrixMemSize += yateto::alignedUpper(tensor::v::size(),    yateto::alignedReals<real>(prop.alignment));
   plasticityGlobalMatrixMemSize += yateto::alignedUpper(tensor::vInv::size(), yateto::alignedReals<real>(prop.alignment));
 
-  real* plasticityGlobalMatrixMem
-      = static_cast<real*>(memoryAllocator.allocateMemory(plasticityGlobalMatrixMemSize * sizeof(real),
-                                                          prop.pagesizeHeap,
-                                                          memkind));
+  real* plasticityGlobalMatrixMem = allocateGlobalMatrices(plasticityGlobalMatrixMemSize);
 
   real* plasticityGlobalMatrixMemPtr = plasticityGlobalMatrixMem;
   copyManager.template copyTensorToMemAndSetPtr<init::v>(plasticityGlobalMatrixMemPtr, globalData.vandermondeMatrix, prop.alignment);
@@ -229,6 +269,15 @@ void GlobalDataInitializer<MatrixManipPolicyT>::init(GlobalData& globalData,
 
   assert(plasticityGlobalMatrixMemPtr == plasticityGlobalMatrixMem + plasticityGlobalMatrixMemSize);
 
+#ifdef USE_MPI
+  if (sharedMemory != nullptr) {
+    sharedMemory->synchronize();
+  }
+#endif
+  if constexpr (std::is_same_v<MatrixManipPolicyT, matrixmanip::OnHost>) {
+    matrixmanip::OnHost::HostCopyPolicy::writeMemory = true;
+  }
+
   MatrixManipPolicyT::initSpecificGlobalData(globalData,
                                              memoryAllocator,
                                              copyManager,
@@ -238,10 +287,12 @@ void GlobalDataInitializer<MatrixManipPolicyT>::init(GlobalData& globalData,
 
 template void GlobalDataInitializer<matrixmanip::OnHost>::init(GlobalData& globalData,
                                                                memory::ManagedAllocator& memoryAllocator,
-                                                               enum memory::Memkind memkind);
+                                                               enum memory::Memkind memkind,
+                                                               SharedMemoryT* sharedMemory);
 
 template void GlobalDataInitializer<matrixmanip::OnDevice>::init(GlobalData& globalData,
                                                                  memory::ManagedAllocator& memoryAllocator,
-                                                                 enum memory::Memkind memkind);
+                                                                 enum memory::Memkind memkind,
+                                                                 SharedMemoryT* sharedMemory);
 
 } // namespace seissol::initializers
@@ -42,6 +42,7 @@
 
 #include "MemoryAllocator.h"
 #include "typedefs.hpp"
+#include <Parallel/NodeSharedMemory.h>
 #include <yateto.h>
 
 #ifdef ACL_DEVICE
@@ -52,7 +53,12 @@ namespace seissol {
   namespace initializers {
     namespace matrixmanip {
       struct OnHost {
-        using CopyManagerT = typename yateto::DefaultCopyManager<real>;
+        struct HostCopyPolicy {
+          //! False on the ranks which attach to the global matrices of another rank of the node
+          static bool writeMemory;
+          real* copy(real const* first, real const* last, real*& mem);
+        };
+        using CopyManagerT = typename yateto::CopyManager<real, HostCopyPolicy>;
         static MemoryProperties getProperties();
         static void negateStiffnessMatrix(GlobalData& globalData);
         static void initSpecificGlobalData(GlobalData& globalData,
@@ -81,9 +87,19 @@ namespace seissol {
     // Generalized Global data initializers of SeisSol.
     template<typename MatrixManipPolicyT>
     struct GlobalDataInitializer {
+#ifdef USE_MPI
+      using SharedMemoryT = parallel::NodeSharedMemory;
+#else
+      using SharedMemoryT = void;
+#endif
+      /**
+       * With sharedMemory, the global matrices are stored once per node (host only);
+       * the thread-local buffers are allocated by each rank nevertheless.
+       **/
       static void init(GlobalData &globalData,
                        memory::ManagedAllocator &memoryAllocator,
-                       enum memory::Memkind memkind);
+                       enum memory::Memkind memkind,
+                       SharedMemoryT* sharedMemory = nullptr);
     };
 
     // Specific Global data initializers of SeisSol.
@@ -0,0 +1,29 @@
+#ifndef SEISSOL_INITIALIZER_HASH_H
+#define SEISSOL_INITIALIZER_HASH_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace seissol::initializers {
+constexpr uint64_t HashSeed = 14695981039346656037ull;
+
+/**
+ * FNV-1a hash of the given bytes, continued from hash.
+ * Used for the keys of the on-disk caches, which are not security-relevant.
+ **/
+inline uint64_t hashBytes(void const* data, std::size_t size, uint64_t hash = HashSeed) {
+  unsigned char const* bytes = static_cast<unsigned char const*>(data);
+  for (std::size_t i = 0; i < size; ++i) {
+    hash ^= bytes[i];
+    hash *= 1099511628211ull;
+  }
+  return hash;
+}
+
+template <typename T>
+uint64_t hashValue(T const& value, uint64_t hash) {
+  return hashBytes(&value, sizeof(T), hash);
+}
+} // namespace seissol::initializers
+
+#endif // SEISSOL_INITIALIZER_HASH_H
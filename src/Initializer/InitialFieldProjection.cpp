@@ -69,9 +69,7 @@ void seissol::initializers::projectInitialField(std::vector<std::unique_ptr<phys
   constexpr auto quadPolyDegree = CONVERGENCE_ORDER+1;
   constexpr auto numQuadPoints = quadPolyDegree * quadPolyDegree * quadPolyDegree;
 
-  double quadraturePoints[numQuadPoints][3];
-  double quadratureWeights[numQuadPoints];
-  seissol::quadrature::TetrahedronQuadrature(quadraturePoints, quadratureWeights, quadPolyDegree);
+  auto const& quadraturePoints = seissol::quadrature::tetrahedronQuadratureRule<quadPolyDegree>().points;
 
 #ifdef _OPENMP
   #pragma omp parallel
@@ -99,7 +99,14 @@ struct seissol::initializers::LTS {
   Variable<CellDRMapping[4]>              drMapping;
   Variable<CellBoundaryMapping[4]>        boundaryMapping;
   Variable<real[7 * NUMBER_OF_ALIGNED_BASIS_FUNCTIONS]> pstrain;
+  //! Displacements of the faces which require them (see requiresDisplacement), nullptr otherwise.
+  //! The pointers address faceDisplacementsBuffer, which holds the faces of a layer contiguously;
+  //! the surface tree of the FreeSurfaceIntegrator references the same memory.
   Variable<real*[4]>                      faceDisplacements;
+  //! Damping rate of the absorbing layer, see physics::AbsorbingLayer
+  Variable<real>                          absorbingDamping;
+  //! Low-order bits of the degrees of freedom lost in their updates, see kernels::compensatedAdd
+  Variable<real[tensor::Q::size()]>       dofsCompensation;
   Bucket                                  buffersDerivatives;
   Bucket                                  faceDisplacementsBuffer;
 
@@ -108,42 +115,68 @@ struct seissol::initializers::LTS {
   Variable<NeighboringIntegrationData>    neighIntegrationOnDevice;
   ScratchpadMemory                        idofsScratch;
   ScratchpadMemory                        derivativesScratch;
+#ifdef USE_POROELASTIC
+  ScratchpadMemory                        stpRhsScratch;
+#endif
+#ifdef USE_RECOMPUTED_STAR_MATRICES
+  ScratchpadMemory                        starMatricesScratch;
+#endif
 #endif
   
-  /// \todo Memkind
-  void addTo(LTSTree& tree, bool usePlasticity) {
+  /// The memory kinds can be changed at runtime with a memory policy, see seissol::memory::memkindOf
+  void addTo(LTSTree& tree, bool usePlasticity, bool useAbsorbingLayer = false, bool useCompensatedDofs = false) {
     LayerMask plasticityMask;
     if (usePlasticity) {
       plasticityMask = LayerMask(Ghost);
     } else {
       plasticityMask = LayerMask(Ghost) | LayerMask(Copy) | LayerMask(Interior);
     }
+    LayerMask absorbingLayerMask;
+    if (useAbsorbingLayer) {
+      absorbingLayerMask = LayerMask(Ghost);
+    } else {
+      absorbingLayerMask = LayerMask(Ghost) | LayerMask(Copy) | LayerMask(Interior);
+    }
+    LayerMask compensationMask;
+    if (useCompensatedDofs) {
+      compensationMask = LayerMask(Ghost);
+    } else {
+      compensationMask = LayerMask(Ghost) | LayerMask(Copy) | LayerMask(Interior);
+    }
 
-    tree.addVar(                    dofs, LayerMask(Ghost),     PAGESIZE_HEAP,      MEMKIND_DOFS );
+    tree.addVar(                    dofs, LayerMask(Ghost),     PAGESIZE_HEAP,      seissol::memory::memkindOf("dofs", MEMKIND_DOFS), "dofs" );
     if (kernels::size<tensor::Qane>() > 0) {
-      tree.addVar(                 dofsAne, LayerMask(Ghost),     PAGESIZE_HEAP,      MEMKIND_DOFS );
+      tree.addVar(                 dofsAne, LayerMask(Ghost),     PAGESIZE_HEAP,      seissol::memory::memkindOf("dofsAne", MEMKIND_DOFS), "dofsAne" );
     }
-    tree.addVar(                 buffers,      LayerMask(),                 1,      MEMKIND_TIMEDOFS );
-    tree.addVar(             derivatives,      LayerMask(),                 1,      MEMKIND_TIMEDOFS );
-    tree.addVar(         cellInformation,      LayerMask(),                 1,      MEMKIND_CONSTANT );
-    tree.addVar(           faceNeighbors, LayerMask(Ghost),                 1,      MEMKIND_TIMEDOFS );
-    tree.addVar(        localIntegration, LayerMask(Ghost),                 1,      MEMKIND_CONSTANT );
-    tree.addVar(  neighboringIntegration, LayerMask(Ghost),                 1,      MEMKIND_CONSTANT );
-    tree.addVar(                material, LayerMask(Ghost),                 1,      seissol::memory::Standard );
-    tree.addVar(              plasticity,   plasticityMask,                 1,      MEMKIND_UNIFIED );
-    tree.addVar(               drMapping, LayerMask(Ghost),                 1,      MEMKIND_CONSTANT );
-    tree.addVar(         boundaryMapping, LayerMask(Ghost),                 1,      MEMKIND_CONSTANT );
-    tree.addVar(                 pstrain,   plasticityMask,     PAGESIZE_HEAP,      MEMKIND_UNIFIED );
-    tree.addVar(       faceDisplacements, LayerMask(Ghost),     PAGESIZE_HEAP,      seissol::memory::Standard );
+    tree.addVar(                 buffers,      LayerMask(),                 1,      seissol::memory::memkindOf("buffers", MEMKIND_TIMEDOFS), "buffers" );
+    tree.addVar(             derivatives,      LayerMask(),                 1,      seissol::memory::memkindOf("derivatives", MEMKIND_TIMEDOFS), "derivatives" );
+    tree.addVar(         cellInformation,      LayerMask(),                 1,      seissol::memory::memkindOf("cellInformation", MEMKIND_CONSTANT), "cellInformation" );
+    tree.addVar(           faceNeighbors, LayerMask(Ghost),                 1,      seissol::memory::memkindOf("faceNeighbors", MEMKIND_TIMEDOFS), "faceNeighbors" );
+    tree.addVar(        localIntegration, LayerMask(Ghost),                 1,      seissol::memory::memkindOf("localIntegration", MEMKIND_CONSTANT), "localIntegration" );
+    tree.addVar(  neighboringIntegration, LayerMask(Ghost),                 1,      seissol::memory::memkindOf("neighboringIntegration", MEMKIND_CONSTANT), "neighboringIntegration" );
+    tree.addVar(                material, LayerMask(Ghost),                 1,      seissol::memory::memkindOf("material", seissol::memory::Standard), "material" );
+    tree.addVar(              plasticity,   plasticityMask,                 1,      seissol::memory::memkindOf("plasticity", MEMKIND_UNIFIED), "plasticity" );
+    tree.addVar(               drMapping, LayerMask(Ghost),                 1,      seissol::memory::memkindOf("drMapping", MEMKIND_CONSTANT), "drMapping" );
+    tree.addVar(         boundaryMapping, LayerMask(Ghost),                 1,      seissol::memory::memkindOf("boundaryMapping", MEMKIND_CONSTANT), "boundaryMapping" );
+    tree.addVar(                 pstrain,   plasticityMask,     PAGESIZE_HEAP,      seissol::memory::memkindOf("pstrain", MEMKIND_UNIFIED), "pstrain" );
+    tree.addVar(       faceDisplacements, LayerMask(Ghost),     PAGESIZE_HEAP,      seissol::memory::memkindOf("faceDisplacements", seissol::memory::Standard), "faceDisplacements" );
+    tree.addVar(        absorbingDamping, absorbingLayerMask,               1,      seissol::memory::memkindOf("absorbingDamping", MEMKIND_CONSTANT), "absorbingDamping" );
+    tree.addVar(        dofsCompensation,   compensationMask,   PAGESIZE_HEAP,      seissol::memory::memkindOf("dofsCompensation", MEMKIND_DOFS), "dofsCompensation" );
 
-    tree.addBucket(buffersDerivatives,                          PAGESIZE_HEAP,      MEMKIND_TIMEDOFS );
-    tree.addBucket(faceDisplacementsBuffer,                     PAGESIZE_HEAP,      MEMKIND_TIMEDOFS );
+    tree.addBucket(buffersDerivatives,                          PAGESIZE_HEAP,      seissol::memory::memkindOf("buffersDerivatives", MEMKIND_TIMEDOFS), "buffersDerivatives" );
+    tree.addBucket(faceDisplacementsBuffer,                     PAGESIZE_HEAP,      seissol::memory::memkindOf("faceDisplacementsBuffer", MEMKIND_TIMEDOFS), "faceDisplacementsBuffer" );
 
 #ifdef ACL_DEVICE
-    tree.addVar(   localIntegrationOnDevice,   LayerMask(Ghost),  1,      seissol::memory::DeviceGlobalMemory );
-    tree.addVar(   neighIntegrationOnDevice,   LayerMask(Ghost),  1,      seissol::memory::DeviceGlobalMemory );
-    tree.addScratchpadMemory(  idofsScratch,                      1,      seissol::memory::DeviceGlobalMemory);
-    tree.addScratchpadMemory(derivativesScratch,                  1,      seissol::memory::DeviceGlobalMemory);
+    tree.addVar(   localIntegrationOnDevice,   LayerMask(Ghost),  1,      seissol::memory::deviceCellMemkind(), "localIntegrationOnDevice" );
+    tree.addVar(   neighIntegrationOnDevice,   LayerMask(Ghost),  1,      seissol::memory::deviceCellMemkind(), "neighIntegrationOnDevice" );
+    tree.addScratchpadMemory(  idofsScratch,                      1,      seissol::memory::deviceCellMemkind());
+    tree.addScratchpadMemory(derivativesScratch,                  1,      seissol::memory::deviceCellMemkind());
+#ifdef USE_POROELASTIC
+    tree.addScratchpadMemory(     stpRhsScratch,                  1,      seissol::memory::deviceCellMemkind());
+#endif
+#ifdef USE_RECOMPUTED_STAR_MATRICES
+    tree.addScratchpadMemory(starMatricesScratch,                 1,      seissol::memory::deviceCellMemkind());
+#endif
 #endif
   }
 };
@@ -71,12 +71,146 @@
 #include "MemoryAllocator.h"
 #include <Parallel/MPI.h>
 
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+#include <sys/mman.h>
+
+#include <utils/env.h>
 #include <utils/logger.h>
+#include <utils/stringutils.h>
 
 #ifdef ACL_DEVICE
 #include "device.h"
 #endif
 
+namespace {
+constexpr size_t HugePageSize = 2ul * 1024 * 1024;
+constexpr size_t GiganticPageSize = 1024ul * 1024 * 1024;
+
+//! sizes of the mappings of gigantic pages, required for munmap
+std::unordered_map<void*, size_t> giganticMappings;
+std::mutex giganticMappingsMutex;
+
+void* allocateHugePages(size_t size, size_t alignment, seissol::memory::Memkind memkind) {
+  if (memkind == seissol::memory::GiganticPages && alignment <= GiganticPageSize) {
+#if defined(MAP_HUGETLB) && defined(MAP_HUGE_SHIFT)
+    const size_t mappedSize = (size + GiganticPageSize - 1) / GiganticPageSize * GiganticPageSize;
+    void* mapping = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | (30 << MAP_HUGE_SHIFT), -1, 0);
+    if (mapping != MAP_FAILED) {
+      std::lock_guard<std::mutex> lock(giganticMappingsMutex);
+      giganticMappings[mapping] = mappedSize;
+      return mapping;
+    }
+#endif
+    static std::once_flag warned;
+    std::call_once(warned, [] {
+      logWarning(seissol::MPI::mpi.rank()) << "No 1 GiB huge pages are available, using transparent huge pages instead.";
+    });
+  }
+
+  void* pointer = nullptr;
+  if (posix_memalign(&pointer, std::max(alignment, HugePageSize), size) != 0) {
+    return nullptr;
+  }
+#ifdef MADV_HUGEPAGE
+  // only a hint, fails if transparent huge pages are disabled
+  madvise(pointer, size, MADV_HUGEPAGE);
+#endif
+  return pointer;
+}
+
+void freeHugePages(void* pointer) {
+  {
+    std::lock_guard<std::mutex> lock(giganticMappingsMutex);
+    auto mapping = giganticMappings.find(pointer);
+    if (mapping != giganticMappings.end()) {
+      munmap(pointer, mapping->second);
+      giganticMappings.erase(mapping);
+      return;
+    }
+  }
+  ::free(pointer);
+}
+
+//! Reads the memory policy file: one "<variable or bucket> = <tier>" per line, # starts a comment.
+std::map<std::string, seissol::memory::Memkind> readMemoryPolicy(const std::string& fileName) {
+  std::map<std::string, seissol::memory::Memkind> policy;
+  const std::map<std::string, seissol::memory::Memkind> tiers = {
+      {"standard", seissol::memory::Standard},
+      {"ddr", seissol::memory::Standard},
+      {"hbm", seissol::memory::HighBandwidth},
+      {"hugepages", seissol::memory::HugePages},
+      {"hugepages-2m", seissol::memory::HugePages},
+      {"hugepages-1g", seissol::memory::GiganticPages}};
+
+  std::ifstream file(fileName);
+  if (!file) {
+    logError() << "Could not open the memory policy" << fileName;
+  }
+  std::string line;
+  unsigned lineNumber = 0;
+  while (std::getline(file, line)) {
+    ++lineNumber;
+    line = line.substr(0, line.find('#'));
+    const auto separator = line.find('=');
+    std::string name = line.substr(0, separator);
+    utils::StringUtils::trim(name);
+    if (name.empty() && separator == std::string::npos) {
+      continue;
+    }
+    std::string tier = (separator == std::string::npos) ? "" : line.substr(separator + 1);
+    utils::StringUtils::trim(tier);
+    utils::StringUtils::toLower(tier);
+    auto memkind = tiers.find(tier);
+    if (name.empty() || memkind == tiers.end()) {
+      logError() << "Invalid entry in line" << lineNumber << "of the memory policy" << fileName
+                 << "; expected <variable> = standard|ddr|hbm|hugepages|hugepages-2m|hugepages-1g.";
+    }
+#ifndef USE_MEMKIND
+    if (memkind->second == seissol::memory::HighBandwidth) {
+      logWarning(seissol::MPI::mpi.rank()) << "The memory policy places" << name
+          << "in high-bandwidth memory, but SeisSol was compiled without memkind; using standard memory.";
+    }
+#endif
+    policy[name] = memkind->second;
+  }
+  return policy;
+}
+} // namespace
+
+seissol::memory::Memkind seissol::memory::memkindOf(const std::string& i_name, enum Memkind i_default) {
+  static const std::map<std::string, Memkind> policy = [] {
+    const std::string fileName = utils::Env::get<std::string>("SEISSOL_MEMORY_POLICY", "");
+    return fileName.empty() ? std::map<std::string, Memkind>() : readMemoryPolicy(fileName);
+  }();
+
+  auto entry = policy.find(i_name);
+  if (entry == policy.end()) {
+    return i_default;
+  }
+  if (i_default == DeviceGlobalMemory || i_default == DeviceUnifiedMemory || i_default == PinnedMemory) {
+    logWarning(seissol::MPI::mpi.rank()) << "The memory policy for" << i_name << "is ignored, as it resides on the device.";
+    return i_default;
+  }
+  logInfo(seissol::MPI::mpi.rank()) << "Memory policy:" << i_name << "uses memory kind" << entry->second;
+  return entry->second;
+}
+
+seissol::memory::Memkind seissol::memory::deviceCellMemkind() {
+  static const bool severalDevices = utils::Env::get<int>("SEISSOL_DEVICES_PER_RANK", 1) > 1;
+  return (severalDevices || isDeviceMemoryOversubscribed()) ? DeviceUnifiedMemory : DeviceGlobalMemory;
+}
+
+bool seissol::memory::isDeviceMemoryOversubscribed() {
+  static const bool oversubscribed = utils::Env::get<int>("SEISSOL_DEVICE_OVERSUBSCRIPTION", 0) != 0;
+  return oversubscribed;
+}
+
 void* seissol::memory::allocate(size_t i_size, size_t i_alignment, enum Memkind i_memkind)
 {
     void* l_ptrBuffer{nullptr};
@@ -89,6 +223,10 @@ void* seissol::memory::allocate(size_t i_size, size_t i_alignment, enum Memkind
       return l_ptrBuffer;
     }
 
+  if (i_memkind == HugePages || i_memkind == GiganticPages) {
+    l_ptrBuffer = allocateHugePages(i_size, i_alignment, i_memkind);
+    error = (l_ptrBuffer == nullptr);
+  } else {
 #if defined(USE_MEMKIND) || defined(ACL_DEVICE)
   if( i_memkind == 0 ) {
 #endif
@@ -127,6 +265,7 @@ void* seissol::memory::allocate(size_t i_size, size_t i_alignment, enum Memkind
     logError() << "unknown memkind type used (" << i_memkind << "). Please, refer to the documentation";
   }
 #endif
+  }
     
     if (error) {
       logError() << "The malloc failed (bytes: " << i_size << ", alignment: " << i_alignment << ", memkind: " << i_memkind << ").";
@@ -136,6 +275,10 @@ void* seissol::memory::allocate(size_t i_size, size_t i_alignment, enum Memkind
 }
 
 void seissol::memory::free(void* i_pointer, enum Memkind i_memkind) {
+  if (i_memkind == HugePages || i_memkind == GiganticPages) {
+    freeHugePages(i_pointer);
+    return;
+  }
 #if defined(USE_MEMKIND) || defined(ACL_DEVICE)
   if (i_memkind == Standard) {
 #endif
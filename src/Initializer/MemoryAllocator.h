@@ -75,6 +75,7 @@
 #include <cassert>
 #include <cstdlib>
 #include <iostream>
+#include <string>
 #include <vector>
 
 #ifdef USE_MEMKIND
@@ -88,11 +89,38 @@ namespace seissol {
       HighBandwidth = 1,
       DeviceGlobalMemory = 3,
       DeviceUnifiedMemory = 4,
-      PinnedMemory = 5
+      PinnedMemory = 5,
+      //! transparent huge pages (2 MiB)
+      HugePages = 6,
+      //! huge pages of 1 GiB from hugetlbfs, falls back to HugePages if none are available
+      GiganticPages = 7
     };
     void* allocate(size_t i_size, size_t i_alignment = 1, enum Memkind i_memkind = Standard);
     void free(void* i_pointer, enum Memkind i_memkind = Standard);   
 
+    /**
+     * Returns the memory kind of an LTS variable or bucket.
+     * The compile-time default can be overwritten at runtime by the memory policy file given in SEISSOL_MEMORY_POLICY.
+     *
+     * @param i_name name of the variable or bucket, e.g. "dofs" or "buffersDerivatives".
+     * @param i_default memory kind if the policy does not contain the variable.
+     **/
+    enum Memkind memkindOf(const std::string& i_name, enum Memkind i_default);
+
+    /**
+     * Returns the memory kind of the cell data and scratchpads which only the device kernels access.
+     * If a rank drives several devices (SEISSOL_DEVICES_PER_RANK > 1), they are unified, such that they can move to the
+     * device of their time cluster; else they reside in the global memory of the device.
+     **/
+    enum Memkind deviceCellMemkind();
+
+    /**
+     * True if the cell data may exceed the device memory (SEISSOL_DEVICE_OVERSUBSCRIPTION=1). The cell data then
+     * resides in unified memory, which the driver evicts to the host on demand, and each time cluster prefetches its
+     * data to the device before it computes.
+     **/
+    bool isDeviceMemoryOversubscribed();
+
     /**
      * Prints the memory alignment of in terms of relative start and ends in bytes.
      *
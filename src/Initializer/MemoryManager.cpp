@@ -72,9 +72,14 @@
 #include "InternalState.h"
 #include "GlobalData.h"
 #include <yateto.h>
+#include <utils/env.h>
 
 #include <Kernels/common.hpp>
 #include <generated_code/tensor.h>
+#include <Parallel/Pin.h>
+#include <Parallel/SharedHalo.h>
+#include <DynamicRupture/Factory.h>
+#include <algorithm>
 #include <unordered_set>
 #include <cmath>
 #include <type_traits>
@@ -85,16 +90,40 @@
 
 #ifdef ACL_DEVICE
 #include "BatchRecorders/Recorders.h"
+#include <Kernels/DeviceContext.h>
 #include <Solver/Pipeline/DrPipeline.h>
+#include <map>
 #endif //ACL_DEVICE
 
 void seissol::initializers::MemoryManager::initialize()
 {
   // initialize global matrices
+#ifdef USE_MPI
+  if (useSharedGlobalData()) {
+    m_sharedGlobalData.initialize(seissol::MPI::mpi.comm());
+    GlobalDataInitializerOnHost::init(m_globalDataOnHost, m_memoryAllocator, MEMKIND_GLOBAL, &m_sharedGlobalData);
+    logInfo(seissol::MPI::mpi.rank()) << "The global matrices are shared by" << m_sharedGlobalData.numberOfRanks()
+                                      << "ranks per node.";
+  } else {
+    GlobalDataInitializerOnHost::init(m_globalDataOnHost, m_memoryAllocator, MEMKIND_GLOBAL);
+  }
+#else
   GlobalDataInitializerOnHost::init(m_globalDataOnHost, m_memoryAllocator, MEMKIND_GLOBAL);
+#endif
   if constexpr (seissol::isDeviceOn()) {
     GlobalDataInitializerOnDevice::init(m_globalDataOnDevice, m_memoryAllocator, memory::DeviceGlobalMemory);
   }
+#ifdef ACL_DEVICE
+  // The clusters on the further devices read the global matrices from their own copy. The copies are unified, such
+  // that they migrate to their device on the first access and stay there, as no other device touches them.
+  const auto& deviceIds = seissol::MPI::mpi.getDeviceIDs();
+  if (deviceIds.size() > 1) {
+    m_globalDataOnFurtherDevices.resize(deviceIds.size() - 1);
+    for (auto& globalData : m_globalDataOnFurtherDevices) {
+      GlobalDataInitializerOnDevice::init(globalData, m_memoryAllocator, memory::DeviceUnifiedMemory);
+    }
+  }
+#endif
 }
 
 void seissol::initializers::MemoryManager::correctGhostRegionSetups()
@@ -128,6 +157,115 @@ void seissol::initializers::MemoryManager::correctGhostRegionSetups()
   }
 }
 
+namespace {
+//! Boundaries whose neighboring contribution works on the data of the cell itself
+bool isFakeNeighbor(FaceType faceType) {
+  return faceType == FaceType::freeSurface || faceType == FaceType::freeSurfaceGravity ||
+         faceType == FaceType::dirichlet || faceType == FaceType::analytical;
+}
+} // namespace
+
+void seissol::initializers::MemoryManager::compactBuffers() {
+  unsigned long removedBuffers = 0;
+  if (utils::Env::get<int>("SEISSOL_COMPACT_BUFFERS", 0) != 0) {
+    CellLocalInformation* globalCellInformation = m_ltsTree.var(m_lts.cellInformation);
+    for (unsigned tc = 0; tc < m_ltsTree.numChildren(); ++tc) {
+      Layer& interior = m_ltsTree.child(tc).child<Interior>();
+      CellLocalInformation* cellInformation = interior.var(m_lts.cellInformation);
+      const unsigned ltsOffset = static_cast<unsigned>(cellInformation - globalCellInformation);
+
+      for (unsigned cell = 0; cell < interior.getNumberOfCells(); ++cell) {
+        unsigned short& ltsSetup = cellInformation[cell].ltsSetup;
+        const bool hasBuffer = (ltsSetup >> 8) % 2 == 1;
+        const bool hasDerivatives = (ltsSetup >> 9) % 2 == 1;
+        const bool hasLtsBuffer = (ltsSetup >> 10) % 2 == 1;
+        // LTS buffers accumulate several time steps, which cannot be recovered from the derivatives
+        if (!hasBuffer || !hasDerivatives || hasLtsBuffer) {
+          continue;
+        }
+
+        /*
+         * The neighbors which read the buffer switch to the derivatives. The cluster-wide start time of the neighbor
+         * integration is the offset in the step of the next slower cluster, which is only correct for derivatives of
+         * slower neighbors. The derivatives of this cell are expanded at the start of the current step, hence they have
+         * to be integrated from 0, which the GTS bit of the face provides (see TimeCommon::computeIntegrals).
+         * Faces without it would integrate over the wrong interval under LTS, so such cells keep their buffer.
+         */
+        auto isReadingFace = [&](CellLocalInformation const& neighbor, unsigned neighborFace) {
+          return (neighbor.faceTypes[neighborFace] == FaceType::regular ||
+                  neighbor.faceTypes[neighborFace] == FaceType::periodic) &&
+                 neighbor.faceNeighborIds[neighborFace] == ltsOffset + cell &&
+                 (neighbor.ltsSetup >> neighborFace) % 2 == 0;
+        };
+        bool isCompactable = true;
+        for (unsigned face = 0; face < 4; ++face) {
+          const FaceType faceType = cellInformation[cell].faceTypes[face];
+          if (faceType == FaceType::regular || faceType == FaceType::periodic) {
+            CellLocalInformation const& neighbor = globalCellInformation[cellInformation[cell].faceNeighborIds[face]];
+            for (unsigned neighborFace = 0; neighborFace < 4; ++neighborFace) {
+              if (isReadingFace(neighbor, neighborFace) && (neighbor.ltsSetup >> (neighborFace + 4)) % 2 == 0) {
+                isCompactable = false;
+              }
+            }
+          } else if (isFakeNeighbor(faceType) && (ltsSetup >> (face + 4)) % 2 == 0) {
+            isCompactable = false;
+          }
+        }
+        if (!isCompactable) {
+          continue;
+        }
+
+        for (unsigned face = 0; face < 4; ++face) {
+          const FaceType faceType = cellInformation[cell].faceTypes[face];
+          if (faceType == FaceType::regular || faceType == FaceType::periodic) {
+            // neighbors in the same cluster read the buffer, those in faster clusters the derivatives already
+            CellLocalInformation& neighbor = globalCellInformation[cellInformation[cell].faceNeighborIds[face]];
+            for (unsigned neighborFace = 0; neighborFace < 4; ++neighborFace) {
+              if (isReadingFace(neighbor, neighborFace)) {
+                neighbor.ltsSetup |= (1 << neighborFace);
+              }
+            }
+          } else if (isFakeNeighbor(faceType)) {
+            // the fake neighbor works on the derivatives, see getLtsSetup
+            ltsSetup |= (1 << face);
+          }
+        }
+        ltsSetup &= ~(1 << 8);
+        ++removedBuffers;
+      }
+    }
+  }
+  printBuffersDerivativesMemory(removedBuffers);
+}
+
+void seissol::initializers::MemoryManager::printBuffersDerivativesMemory(unsigned long removedBuffers) {
+  unsigned long numbers[3] = {removedBuffers, 0, 0}; // removed buffers, buffers, derivatives
+  for (unsigned tc = 0; tc < m_ltsTree.numChildren(); ++tc) {
+    TimeCluster& cluster = m_ltsTree.child(tc);
+    for (Layer* layer : {&cluster.child<Copy>(), &cluster.child<Interior>()}) {
+      CellLocalInformation* cellInformation = layer->var(m_lts.cellInformation);
+      for (unsigned cell = 0; cell < layer->getNumberOfCells(); ++cell) {
+        numbers[1] += (cellInformation[cell].ltsSetup >> 8) % 2;
+        numbers[2] += (cellInformation[cell].ltsSetup >> 9) % 2;
+      }
+    }
+  }
+#ifdef USE_MPI
+  MPI_Allreduce(MPI_IN_PLACE, numbers, 3, MPI_UNSIGNED_LONG, MPI_SUM, seissol::MPI::mpi.comm());
+#endif
+
+  constexpr double GiB = 1024.0 * 1024.0 * 1024.0;
+  const double bufferSize = sizeof(real) * tensor::Q::size() / GiB;
+  const double derivativesSize = sizeof(real) * yateto::computeFamilySize<tensor::dQ>() / GiB;
+  logInfo(seissol::MPI::mpi.rank()) << "Time buffers:" << numbers[1] << "cells," << numbers[1] * bufferSize << "GiB;"
+                                    << "time derivatives:" << numbers[2] << "cells," << numbers[2] * derivativesSize << "GiB"
+                                    << "(without the ghost layers)";
+  if (numbers[0] > 0) {
+    logInfo(seissol::MPI::mpi.rank()) << "Compaction removed the time buffers of" << numbers[0] << "cells, saving"
+                                      << numbers[0] * bufferSize << "GiB.";
+  }
+}
+
 void seissol::initializers::MemoryManager::deriveLayerLayouts() {
   // initialize memory
 #ifdef USE_MPI
@@ -291,6 +429,209 @@ void seissol::initializers::MemoryManager::initializeCommunicationStructure() {
       l_offset += m_meshStructure[tc].numberOfCopyRegionCells[l_region];
     }
   }
+
+  /*
+   * single precision staging buffers
+   */
+  const bool compressHalo = useCompressedHalo();
+  for (unsigned tc = 0; tc < m_ltsTree.numChildren(); ++tc) {
+    MeshStructure& meshStructure = m_meshStructure[tc];
+    meshStructure.compressedCopyRegions = nullptr;
+    meshStructure.compressedGhostRegions = nullptr;
+    if (!compressHalo) {
+      continue;
+    }
+    const unsigned numberOfRegions = meshStructure.numberOfRegions;
+    meshStructure.compressedCopyRegions = static_cast<float**>(m_memoryAllocator.allocateMemory(numberOfRegions * sizeof(float*), 1));
+    meshStructure.compressedGhostRegions = static_cast<float**>(m_memoryAllocator.allocateMemory(numberOfRegions * sizeof(float*), 1));
+    for (unsigned int l_region = 0; l_region < numberOfRegions; l_region++) {
+      meshStructure.compressedCopyRegions[l_region] = static_cast<float*>(
+          m_memoryAllocator.allocateMemory(meshStructure.copyRegionSizes[l_region] * sizeof(float), ALIGNMENT));
+      meshStructure.compressedGhostRegions[l_region] = static_cast<float*>(
+          m_memoryAllocator.allocateMemory(meshStructure.ghostRegionSizes[l_region] * sizeof(float), ALIGNMENT));
+    }
+  }
+  if (compressHalo) {
+    logInfo(seissol::MPI::mpi.rank()) << "Exchanging the ghost layers in single precision.";
+  }
+
+  /*
+   * device staging buffers
+   */
+  const bool useDeviceBuffers = useDeviceBuffersForMpi();
+  for (unsigned tc = 0; tc < m_ltsTree.numChildren(); ++tc) {
+    MeshStructure& meshStructure = m_meshStructure[tc];
+    meshStructure.deviceCopyRegions = nullptr;
+    meshStructure.deviceGhostRegions = nullptr;
+    if (!useDeviceBuffers) {
+      continue;
+    }
+    const unsigned numberOfRegions = meshStructure.numberOfRegions;
+    meshStructure.deviceCopyRegions = static_cast<real**>(m_memoryAllocator.allocateMemory(numberOfRegions * sizeof(real*), 1));
+    meshStructure.deviceGhostRegions = static_cast<real**>(m_memoryAllocator.allocateMemory(numberOfRegions * sizeof(real*), 1));
+    for (unsigned int l_region = 0; l_region < numberOfRegions; l_region++) {
+      meshStructure.deviceCopyRegions[l_region] = static_cast<real*>(
+          m_memoryAllocator.allocateMemory(meshStructure.copyRegionSizes[l_region] * sizeof(real), ALIGNMENT, memory::DeviceGlobalMemory));
+      meshStructure.deviceGhostRegions[l_region] = static_cast<real*>(
+          m_memoryAllocator.allocateMemory(meshStructure.ghostRegionSizes[l_region] * sizeof(real), ALIGNMENT, memory::DeviceGlobalMemory));
+    }
+  }
+  if (useDeviceBuffers) {
+    logInfo(seissol::MPI::mpi.rank()) << "Exchanging the ghost layers directly from device memory (requires a GPU-aware MPI).";
+  }
+
+  /*
+   * shared memory window of the regions exchanged within the node
+   */
+  const bool useSharedMemory = useSharedMemoryHalo();
+  for (unsigned tc = 0; tc < m_ltsTree.numChildren(); ++tc) {
+    m_meshStructure[tc].sharedCopySlots = nullptr;
+    m_meshStructure[tc].sharedGhostSlots = nullptr;
+  }
+  if (useSharedMemory) {
+    m_sharedHaloWindow.allocate(m_meshStructure, m_ltsTree.numChildren(), seissol::MPI::mpi.comm(), timeData);
+    logInfo(seissol::MPI::mpi.rank()) << "Exchanging" << m_sharedHaloWindow.numberOfSharedRegions()
+                                      << "copy regions with ranks on the same node through shared memory.";
+  }
+
+  /*
+   * persistent requests
+   */
+  // the aggregated regions are sent and received by the message aggregator
+  const bool usePersistentRequests = utils::Env::get<int>("SEISSOL_MPI_PERSISTENT", 0) != 0 && !useMessageAggregation();
+  for (unsigned tc = 0; tc < m_ltsTree.numChildren(); ++tc) {
+    MeshStructure& meshStructure = m_meshStructure[tc];
+    meshStructure.hasPersistentRequests = usePersistentRequests;
+    if (!usePersistentRequests) {
+      continue;
+    }
+    for (unsigned int l_region = 0; l_region < meshStructure.numberOfRegions; l_region++) {
+      if (useSharedMemory && meshStructure.sharedCopySlots[l_region] != nullptr) {
+        continue;
+      }
+      void* copyRegion = meshStructure.copyRegions[l_region];
+      void* ghostRegion = meshStructure.ghostRegions[l_region];
+      MPI_Datatype datatype = MPI_C_REAL;
+      if (compressHalo) {
+        copyRegion = meshStructure.compressedCopyRegions[l_region];
+        ghostRegion = meshStructure.compressedGhostRegions[l_region];
+        datatype = MPI_FLOAT;
+      } else if (useDeviceBuffers) {
+        copyRegion = meshStructure.deviceCopyRegions[l_region];
+        ghostRegion = meshStructure.deviceGhostRegions[l_region];
+      }
+      MPI_Send_init(copyRegion,
+                    static_cast<int>(meshStructure.copyRegionSizes[l_region]),
+                    datatype,
+                    meshStructure.neighboringClusters[l_region][0],
+                    timeData + meshStructure.sendIdentifiers[l_region],
+                    seissol::MPI::mpi.comm(),
+                    meshStructure.sendRequests + l_region);
+      MPI_Recv_init(ghostRegion,
+                    static_cast<int>(meshStructure.ghostRegionSizes[l_region]),
+                    datatype,
+                    meshStructure.neighboringClusters[l_region][0],
+                    timeData + meshStructure.receiveIdentifiers[l_region],
+                    seissol::MPI::mpi.comm(),
+                    meshStructure.receiveRequests + l_region);
+    }
+  }
+  if (usePersistentRequests) {
+    logInfo(seissol::MPI::mpi.rank()) << "Using persistent MPI requests for the ghost layer communication.";
+  }
+}
+
+bool seissol::initializers::MemoryManager::useCompressedHalo() {
+  static const bool compressHalo = [] {
+    const std::string precision = utils::Env::get<std::string>("SEISSOL_HALO_PRECISION", "native");
+    if (precision == "native") {
+      return false;
+    }
+    if (precision != "single") {
+      logError() << "Unknown value for SEISSOL_HALO_PRECISION:" << precision << "(valid values: native, single)";
+    }
+    if (!std::is_same_v<real, double> || isDeviceOn()) {
+      logWarning(seissol::MPI::mpi.rank()) << "SEISSOL_HALO_PRECISION=single is only supported by double precision builds on CPUs; ignoring it.";
+      return false;
+    }
+    return true;
+  }();
+  return compressHalo;
+}
+
+bool seissol::initializers::MemoryManager::useSharedMemoryHalo() {
+  static const bool useSharedMemory = [] {
+    if (utils::Env::get<int>("SEISSOL_MPI_SHARED_MEMORY", 0) == 0) {
+      return false;
+    }
+    if (useCompressedHalo() || useDeviceBuffersForMpi() || isDeviceOn()) {
+      logWarning(seissol::MPI::mpi.rank()) << "SEISSOL_MPI_SHARED_MEMORY=1 is only supported on CPUs without SEISSOL_HALO_PRECISION=single; ignoring it.";
+      return false;
+    }
+    return true;
+  }();
+  return useSharedMemory;
+}
+
+bool seissol::initializers::MemoryManager::useMessageAggregation() {
+  static const bool useAggregation = [] {
+    if (utils::Env::get<int>("SEISSOL_MPI_AGGREGATION", 0) == 0) {
+      return false;
+    }
+    if (useCompressedHalo() || useDeviceBuffersForMpi() || isDeviceOn()) {
+      logWarning(seissol::MPI::mpi.rank()) << "SEISSOL_MPI_AGGREGATION=1 is only supported on CPUs without SEISSOL_HALO_PRECISION=single; ignoring it.";
+      return false;
+    }
+    return true;
+  }();
+  return useAggregation;
+}
+
+bool seissol::initializers::MemoryManager::useSharedGlobalData() {
+  static const bool useSharedGlobalData = utils::Env::get<int>("SEISSOL_SHARED_GLOBAL_DATA", 0) != 0;
+  return useSharedGlobalData;
+}
+
+bool seissol::initializers::MemoryManager::useDeviceBuffersForMpi() {
+  static const bool useDeviceBuffers = [] {
+    if (utils::Env::get<int>("SEISSOL_MPI_DEVICE_BUFFERS", 0) == 0) {
+      return false;
+    }
+    if (!isDeviceOn()) {
+      logWarning(seissol::MPI::mpi.rank()) << "SEISSOL_MPI_DEVICE_BUFFERS=1 is only supported by GPU builds; ignoring it.";
+      return false;
+    }
+    return true;
+  }();
+  return useDeviceBuffers;
+}
+
+void seissol::initializers::MemoryManager::freeCommunicationStructure() {
+  int isFinalized = 0;
+  MPI_Finalized(&isFinalized);
+  if (m_meshStructure == nullptr || isFinalized) {
+    return;
+  }
+  for (unsigned tc = 0; tc < m_ltsTree.numChildren(); ++tc) {
+    MeshStructure& meshStructure = m_meshStructure[tc];
+    if (!meshStructure.hasPersistentRequests) {
+      continue;
+    }
+    for (unsigned int l_region = 0; l_region < meshStructure.numberOfRegions; l_region++) {
+      if (meshStructure.sendRequests[l_region] != MPI_REQUEST_NULL) {
+        MPI_Request_free(meshStructure.sendRequests + l_region);
+      }
+      if (meshStructure.receiveRequests[l_region] != MPI_REQUEST_NULL) {
+        MPI_Request_free(meshStructure.receiveRequests + l_region);
+      }
+    }
+    meshStructure.hasPersistentRequests = false;
+  }
+  for (unsigned tc = 0; tc < m_ltsTree.numChildren(); ++tc) {
+    m_meshStructure[tc].sharedCopySlots = nullptr;
+    m_meshStructure[tc].sharedGhostSlots = nullptr;
+  }
+  m_sharedHaloWindow.free();
 }
 #endif
 
@@ -397,26 +738,63 @@ void seissol::initializers::MemoryManager::initializeBuffersDerivatives() {
 void seissol::initializers::MemoryManager::touchBuffersDerivatives( Layer& layer ) {
   real** buffers = layer.var(m_lts.buffers);
   real** derivatives = layer.var(m_lts.derivatives);
+  const bool bindToNumaNode = seissol::parallel::Pinning::useNumaAwareMemory();
 #ifdef _OPENMP
-  #pragma omp parallel for schedule(static)
+  #pragma omp parallel
 #endif
-  for (unsigned cell = 0; cell < layer.getNumberOfCells(); ++cell) {
-    // touch buffers
-    real* buffer = buffers[cell];
-    if (buffer != NULL) {
-      for (unsigned dof = 0; dof < tensor::Q::size(); ++dof) {
-          // zero time integration buffers
-          buffer[dof] = (real) 0;
+  {
+    /*
+     * Buffers and derivatives of consecutive cells are consecutive within a region of the layer, but the buffers
+     * and the derivatives of a region lie in separate blocks of the bucket. Hence each thread binds the contiguous
+     * runs of its buffers and derivatives separately, such that it only moves pages which it touched itself.
+     */
+    struct Run {
+      char* first = nullptr;
+      char* last = nullptr;
+
+      void extend(real* begin, real* end, bool bind) {
+        char* b = reinterpret_cast<char*>(begin);
+        if (b != last) {
+          flush(bind);
+          first = b;
+        }
+        last = reinterpret_cast<char*>(end);
+      }
+
+      void flush(bool bind) {
+        if (bind && first != nullptr) {
+          seissol::parallel::Pinning::bindToLocalNumaNode(first, last);
+        }
+        first = last = nullptr;
+      }
+    };
+    Run bufferRun;
+    Run derivativeRun;
+#ifdef _OPENMP
+    #pragma omp for schedule(static)
+#endif
+    for (unsigned cell = 0; cell < layer.getNumberOfCells(); ++cell) {
+      // touch buffers
+      real* buffer = buffers[cell];
+      if (buffer != NULL) {
+        for (unsigned dof = 0; dof < tensor::Q::size(); ++dof) {
+            // zero time integration buffers
+            buffer[dof] = (real) 0;
+        }
+        bufferRun.extend(buffer, buffer + tensor::Q::size(), bindToNumaNode);
       }
-    }
 
-    // touch derivatives
-    real* derivative = derivatives[cell];
-    if (derivative != NULL) {
-      for (unsigned dof = 0; dof < yateto::computeFamilySize<tensor::dQ>(); ++dof ) {
-        derivative[dof] = (real) 0;
+      // touch derivatives
+      real* derivative = derivatives[cell];
+      if (derivative != NULL) {
+        for (unsigned dof = 0; dof < yateto::computeFamilySize<tensor::dQ>(); ++dof ) {
+          derivative[dof] = (real) 0;
+        }
+        derivativeRun.extend(derivative, derivative + yateto::computeFamilySize<tensor::dQ>(), bindToNumaNode);
       }
     }
+    bufferRun.flush(bindToNumaNode);
+    derivativeRun.flush(bindToNumaNode);
   }
 }
 
@@ -429,7 +807,18 @@ void seissol::initializers::MemoryManager::fixateLtsTree(struct TimeStepping& i_
   m_meshStructure = i_meshStructure;
 
   // Setup tree variables
-  m_lts.addTo(m_ltsTree, usePlasticity);
+  // SEISSOL_COMPENSATED_DOFS=1 keeps the rounding errors of the updates of the degrees of freedom
+  bool useCompensatedDofs = utils::Env::get<bool>("SEISSOL_COMPENSATED_DOFS", false);
+#ifdef ACL_DEVICE
+  if (useCompensatedDofs) {
+    logWarning(seissol::MPI::mpi.rank()) << "Compensated degrees of freedom are not supported on devices.";
+    useCompensatedDofs = false;
+  }
+#endif
+  if (useCompensatedDofs) {
+    logInfo(seissol::MPI::mpi.rank()) << "Updating the degrees of freedom with compensated summation.";
+  }
+  m_lts.addTo(m_ltsTree, usePlasticity, seissol::SeisSol::main.getAbsorbingLayer().isEnabled(), useCompensatedDofs);
   seissol::SeisSol::main.postProcessor().allocateMemory(&m_ltsTree);
   m_ltsTree.setNumberOfTimeClusters(i_timeStepping.numberOfLocalClusters);
 
@@ -448,7 +837,9 @@ void seissol::initializers::MemoryManager::fixateLtsTree(struct TimeStepping& i_
   m_ltsTree.touchVariables();
 
   /// Dynamic rupture tree
-  m_dynRup.addTo(m_dynRupTree);
+  auto const& drParameters = seissol::SeisSol::main.getDRParameters();
+  m_dynRup.addTo(m_dynRupTree, drParameters);
+  m_frictionSolver = dr::factory::getFrictionSolver(drParameters);
   m_dynRupTree.setNumberOfTimeClusters(i_timeStepping.numberOfLocalClusters);
   m_dynRupTree.fixate();
 
@@ -473,14 +864,16 @@ void seissol::initializers::MemoryManager::fixateLtsTree(struct TimeStepping& i_
     layer->setScratchpadSize(m_dynRup.idofsPlusOnDevice, idofsSize * layerSize);
     layer->setScratchpadSize(m_dynRup.idofsMinusOnDevice, idofsSize * layerSize);
 
-    constexpr auto UpperStageFactor = dr::pipeline::DrPipeline::TailSize * dr::pipeline::DrPipeline::DefaultBatchSize;
-    constexpr auto LowerStageFactor = dr::pipeline::DrPipeline::NumStages * dr::pipeline::DrPipeline::DefaultBatchSize;
-    layer->setScratchpadSize(m_dynRup.QInterpolatedPlusOnHost, UpperStageFactor * QInterpolatedSize);
-    layer->setScratchpadSize(m_dynRup.QInterpolatedMinusOnHost, UpperStageFactor * QInterpolatedSize);
-    layer->setScratchpadSize(m_dynRup.imposedStatePlusOnHost, LowerStageFactor * imposedStateSize);
-    layer->setScratchpadSize(m_dynRup.imposedStateMinusOnHost, LowerStageFactor *  imposedStateSize);
+    // host staging buffers of the DR pipeline are not needed if the friction law is evaluated on the device
+    if (m_frictionSolver == nullptr) {
+      constexpr auto UpperStageFactor = dr::pipeline::DrPipeline::TailSize * dr::pipeline::DrPipeline::DefaultBatchSize;
+      constexpr auto LowerStageFactor = dr::pipeline::DrPipeline::NumStages * dr::pipeline::DrPipeline::DefaultBatchSize;
+      layer->setScratchpadSize(m_dynRup.QInterpolatedPlusOnHost, UpperStageFactor * QInterpolatedSize);
+      layer->setScratchpadSize(m_dynRup.QInterpolatedMinusOnHost, UpperStageFactor * QInterpolatedSize);
+      layer->setScratchpadSize(m_dynRup.imposedStatePlusOnHost, LowerStageFactor * imposedStateSize);
+      layer->setScratchpadSize(m_dynRup.imposedStateMinusOnHost, LowerStageFactor *  imposedStateSize);
+    }
   }
-  m_dynRupTree.allocateScratchPads();
 #endif
 }
 
@@ -585,6 +978,33 @@ void seissol::initializers::MemoryManager::deriveFaceDisplacementsBucket()
 }
 
 #ifdef ACL_DEVICE
+void seissol::initializers::MemoryManager::allocateScratchpadPool() {
+  // the dynamic rupture always runs while the host waits (see TimeCluster::correct), but its kernels
+  // may overlap with the layers which run in their own streams
+  const bool concurrentLayers = kernels::DeviceContext::clusterStreamsEnabled();
+
+  LTSTree::ScratchpadPoolSizes ltsSizes;
+  LTSTree::ScratchpadPoolSizes dynRupSizes;
+  m_ltsTree.addScratchpadPoolSizes(ltsSizes, concurrentLayers);
+  m_dynRupTree.addScratchpadPoolSizes(dynRupSizes, false);
+
+  LTSTree::ScratchpadPoolSizes poolSizes = ltsSizes;
+  for (auto const& [memkind, bytes] : dynRupSizes) {
+    poolSizes[memkind] = concurrentLayers ? poolSizes[memkind] + bytes : std::max(poolSizes[memkind], bytes);
+  }
+
+  std::map<memory::Memkind, char*> pool;
+  for (auto const& [memkind, bytes] : poolSizes) {
+    pool[memkind] = static_cast<char*>(m_memoryAllocator.allocateMemory(bytes, 1, memkind));
+    logInfo(seissol::MPI::mpi.rank()) << "Scratchpad pool (memory kind" << memkind << "):" << bytes << "bytes.";
+  }
+
+  auto ltsPool = pool;
+  m_ltsTree.assignScratchpadPool(ltsPool, concurrentLayers);
+  // without concurrent layers, the dynamic rupture reuses the memory of the LTS scratchpads
+  m_dynRupTree.assignScratchpadPool(concurrentLayers ? ltsPool : pool, false);
+}
+
 void seissol::initializers::MemoryManager::deriveRequiredScratchpadMemory() {
   constexpr size_t totalDerivativesSize = yateto::computeFamilySize<tensor::dQ>();
 
@@ -631,6 +1051,14 @@ void seissol::initializers::MemoryManager::deriveRequiredScratchpadMemory() {
                              idofsCounter * tensor::I::size() * sizeof(real));
     layer->setScratchpadSize(m_lts.derivativesScratch,
                              derivativesCounter * totalDerivativesSize * sizeof(real));
+#ifdef USE_POROELASTIC
+    layer->setScratchpadSize(m_lts.stpRhsScratch,
+                             layer->getNumberOfCells() * tensor::spaceTimePredictorRhs::size() * sizeof(real));
+#endif
+#ifdef USE_RECOMPUTED_STAR_MATRICES
+    layer->setScratchpadSize(m_lts.starMatricesScratch,
+                             layer->getNumberOfCells() * yateto::computeFamilySize<tensor::star>() * sizeof(real));
+#endif
   }
 }
 #endif
@@ -670,6 +1098,9 @@ void seissol::initializers::MemoryManager::initializeMemoryLayout(bool enableFre
   // correct LTS-information in the ghost layer
   correctGhostRegionSetups();
 
+  // remove time buffers which can be recovered from the derivatives
+  compactBuffers();
+
   // derive the layouts of the layers
   deriveLayerLayouts();
 
@@ -725,7 +1156,7 @@ void seissol::initializers::MemoryManager::initializeMemoryLayout(bool enableFre
 
 #ifdef ACL_DEVICE
   deriveRequiredScratchpadMemory();
-  m_ltsTree.allocateScratchPads();
+  allocateScratchpadPool();
 #endif
 }
 
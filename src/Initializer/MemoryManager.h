@@ -76,15 +76,22 @@
 #endif
 
 #include <utils/logger.h>
+#include <memory>
+#include <vector>
 
 #include <Initializer/typedefs.hpp>
 #include "MemoryAllocator.h"
+#ifdef USE_MPI
+#include <Parallel/NodeSharedMemory.h>
+#include <Parallel/SharedHalo.h>
+#endif
 
 #include <Initializer/LTS.h>
 #include <Initializer/tree/LTSTree.hpp>
 #include <Initializer/DynamicRupture.h>
 #include <Initializer/Boundary.h>
 #include <Initializer/ParameterDB.h>
+#include <DynamicRupture/FrictionLaws/FrictionSolver.h>
 
 namespace seissol {
   namespace initializers {
@@ -101,7 +108,15 @@ class seissol::initializers::MemoryManager {
     seissol::memory::ManagedAllocator m_memoryAllocator;
 
     //! LTS mesh structure
-    struct MeshStructure *m_meshStructure;
+    struct MeshStructure *m_meshStructure{nullptr};
+
+#ifdef USE_MPI
+    //! shared memory window of the copy regions exchanged within the node (SEISSOL_MPI_SHARED_MEMORY=1)
+    seissol::parallel::SharedHaloWindow m_sharedHaloWindow;
+
+    //! shared memory of the global matrices, which are stored once per node (SEISSOL_SHARED_GLOBAL_DATA=1)
+    seissol::parallel::NodeSharedMemory m_sharedGlobalData;
+#endif
 
     /*
      * Interior
@@ -150,6 +165,10 @@ class seissol::initializers::MemoryManager {
     //! global data
     GlobalData            m_globalDataOnHost;
     GlobalData            m_globalDataOnDevice;
+#ifdef ACL_DEVICE
+    //! Copies of the global data on the further devices of this rank, see MPI::getDeviceIDs
+    std::vector<GlobalData> m_globalDataOnFurtherDevices;
+#endif
 
     //! Memory organisation tree
     LTSTree               m_ltsTree;
@@ -158,6 +177,9 @@ class seissol::initializers::MemoryManager {
     LTSTree               m_dynRupTree;
     DynamicRupture        m_dynRup;
 
+    //! C++ friction solver; nullptr if the friction law is evaluated in Fortran
+    std::unique_ptr<dr::friction_law::FrictionSolver> m_frictionSolver;
+
     LTSTree m_boundaryTree;
     Boundary m_boundary;
 
@@ -168,6 +190,19 @@ class seissol::initializers::MemoryManager {
      **/
     void correctGhostRegionSetups(); 
 
+    /**
+     * Removes the time buffers of interior cells which also provide derivatives and whose buffers are not used in LTS fashion.
+     * Their neighbors integrate the derivatives instead (SEISSOL_COMPACT_BUFFERS=1).
+     **/
+    void compactBuffers();
+
+    /**
+     * Logs the memory of the time buffers and derivatives.
+     *
+     * @param removedBuffers number of buffers removed by compactBuffers.
+     **/
+    void printBuffersDerivativesMemory(unsigned long removedBuffers);
+
     /**
      * Derives the layouts -- number of buffers and derivatives -- of the layers.
      **/
@@ -199,6 +234,13 @@ class seissol::initializers::MemoryManager {
      * Derives the sizes of scratch memory required during the computations
      */
     void deriveRequiredScratchpadMemory();
+
+    /**
+     * Allocates one pool per memory kind for the scratchpads of the LTS and the dynamic rupture tree.
+     * Without separate streams per time cluster, only one layer is updated at a time, i.e. all layers of both
+     * trees share the same memory of the pool. Otherwise, every LTS layer gets its own part of the pool.
+     */
+    void allocateScratchpadPool();
 #endif
     
     /**
@@ -221,8 +263,17 @@ class seissol::initializers::MemoryManager {
 #ifdef USE_MPI
     /**
      * Initializes the communication structure.
+     * With SEISSOL_MPI_PERSISTENT=1, persistent send and receive requests are created for all regions.
+     * With SEISSOL_MPI_SHARED_MEMORY=1, the regions exchanged with ranks on the same node get slots
+     * in a shared memory window instead.
      **/
     void initializeCommunicationStructure();
+
+    /**
+     * Frees the persistent requests and the shared memory window of the communication structure
+     * (if MPI is not finalized yet).
+     **/
+    void freeCommunicationStructure();
 #endif
 
   public:
@@ -234,7 +285,44 @@ class seissol::initializers::MemoryManager {
     /**
      * Destructor, memory is freed by managed allocator
      **/
-    ~MemoryManager() {}
+    ~MemoryManager() {
+#ifdef USE_MPI
+      freeCommunicationStructure();
+      m_sharedGlobalData.free();
+#endif
+    }
+
+#ifdef USE_MPI
+    /**
+     * True if the copy and ghost regions are exchanged in single precision (SEISSOL_HALO_PRECISION=single).
+     * Only supported for double precision builds on CPUs.
+     **/
+    static bool useCompressedHalo();
+
+    /**
+     * True if the copy and ghost regions are staged in device global memory and passed to MPI directly
+     * (SEISSOL_MPI_DEVICE_BUFFERS=1). Requires a GPU-aware MPI implementation.
+     **/
+    static bool useDeviceBuffersForMpi();
+
+    /**
+     * True if the copy and ghost regions of neighbors on the same node are exchanged through an MPI shared memory
+     * window (SEISSOL_MPI_SHARED_MEMORY=1). Only supported on CPUs without compressed ghost layers.
+     **/
+    static bool useSharedMemoryHalo();
+
+    /**
+     * True if the global matrices on the host are stored once per node in an MPI shared memory window
+     * (SEISSOL_SHARED_GLOBAL_DATA=1).
+     **/
+    static bool useSharedGlobalData();
+
+    /**
+     * True if the copy regions, which are sent to the same rank in the same sweep over the ghost clusters, are
+     * aggregated into one message (SEISSOL_MPI_AGGREGATION=1). Only supported on CPUs without compressed ghost layers.
+     **/
+    static bool useMessageAggregation();
+#endif
     
     /**
      * Initialization function, which allocates memory for the global matrices and initializes them.
@@ -289,6 +377,19 @@ class seissol::initializers::MemoryManager {
       return global;
     }
 
+#ifdef ACL_DEVICE
+    /**
+     * Gets the global data on the host and on the device with the given index in MPI::getDeviceIDs.
+     **/
+    CompoundGlobalData getGlobalData(unsigned deviceIndex) {
+      CompoundGlobalData global = getGlobalData();
+      if (deviceIndex > 0) {
+        global.onDevice = &m_globalDataOnFurtherDevices.at(deviceIndex - 1);
+      }
+      return global;
+    }
+#endif
+
     /**
      * Gets the memory layout of a time cluster.
      *
@@ -316,6 +417,10 @@ class seissol::initializers::MemoryManager {
       return &m_dynRup;
     }
 
+    inline dr::friction_law::FrictionSolver* getFrictionSolver() {
+      return m_frictionSolver.get();
+    }
+
     inline LTSTree* getBoundaryTree() {
       return &m_boundaryTree;
     }
@@ -46,15 +46,359 @@
 #include "PUML/Downward.h"
 #endif
 #include "ParameterDB.h"
+#include "Hash.h"
 
 #include "easi/YAMLParser.h"
 #include "easi/ResultAdapter.h"
+#include "Numerical_aux/Quadrature.h"
 #include "Numerical_aux/Transformation.h"
 #ifdef USE_ASAGI
 #include "Reader/AsagiReader.h"
 #endif
+#include "utils/env.h"
 #include "utils/logger.h"
+#include "Parallel/MPI.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#include <typeinfo>
+#include <utility>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+
+namespace {
+  /**
+   * Number of threads which evaluate the material model; 0 uses all OpenMP threads.
+   * Serial by default, since some easi components (ASAGI, Lua and impalajit functions) are not thread-safe.
+   */
+  int easiThreads() {
+    static int const threads = utils::Env::get<int>("SEISSOL_EASI_THREADS", 1);
+#ifdef _OPENMP
+    return threads > 0 ? threads : omp_get_max_threads();
+#else
+    return 1;
+#endif
+  }
+
+  //! Number of points of the sub-queries which are evaluated by one thread at a time
+  unsigned easiChunkSize() {
+    static unsigned const chunkSize = utils::Env::get<unsigned>("SEISSOL_EASI_CHUNK_SIZE", 4096u);
+    return std::max(chunkSize, 1u);
+  }
+
+  easi::Query subQuery(easi::Query& query, unsigned begin, unsigned end) {
+    easi::Query sub(end - begin, query.dimDomain());
+    for (unsigned point = begin; point < end; ++point) {
+      for (unsigned dim = 0; dim < query.dimDomain(); ++dim) {
+        sub.x(point - begin, dim) = query.x(point, dim);
+      }
+      sub.group(point - begin) = query.group(point);
+    }
+    return sub;
+  }
+
+  /**
+   * Order of the query points along a Morton (Z-order) curve through their bounding box, or an empty vector if
+   * SEISSOL_EASI_SORT_POINTS is disabled.
+   * Points which are close in space then end up in the same chunk, such that gridded data (e.g. the blocks of
+   * ASAGI) is fetched once per region instead of once per point in mesh order.
+   */
+  std::vector<unsigned> spatialOrder(easi::Query& query) {
+    static bool const enabled = utils::Env::get<bool>("SEISSOL_EASI_SORT_POINTS", false);
+    unsigned const numPoints = query.numPoints();
+    if (!enabled || numPoints == 0) {
+      return {};
+    }
+
+    unsigned const dims = std::min(query.dimDomain(), 3u);
+    double lower[3] = {0.0, 0.0, 0.0};
+    double scale[3] = {0.0, 0.0, 0.0};
+    for (unsigned dim = 0; dim < dims; ++dim) {
+      double minimum = query.x(0, dim);
+      double maximum = query.x(0, dim);
+      for (unsigned point = 1; point < numPoints; ++point) {
+        minimum = std::min(minimum, query.x(point, dim));
+        maximum = std::max(maximum, query.x(point, dim));
+      }
+      lower[dim] = minimum;
+      // 21 bits per dimension fit into a 64 bit code
+      scale[dim] = maximum > minimum ? ((1u << 21) - 1) / (maximum - minimum) : 0.0;
+    }
+
+    std::vector<std::pair<uint64_t, unsigned>> codes(numPoints);
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+#endif
+    for (unsigned point = 0; point < numPoints; ++point) {
+      uint64_t code = 0;
+      for (unsigned dim = 0; dim < dims; ++dim) {
+        auto const cell = static_cast<uint64_t>((query.x(point, dim) - lower[dim]) * scale[dim]);
+        for (unsigned bit = 0; bit < 21; ++bit) {
+          code |= ((cell >> bit) & 1u) << (3 * bit + dim);
+        }
+      }
+      codes[point] = {code, point};
+    }
+    std::sort(codes.begin(), codes.end());
+
+    std::vector<unsigned> order(numPoints);
+    for (unsigned i = 0; i < numPoints; ++i) {
+      order[i] = codes[i].second;
+    }
+    return order;
+  }
+
+  //! The points of the query in the given order
+  easi::Query permutedQuery(easi::Query& query, std::vector<unsigned> const& order) {
+    easi::Query permuted(order.size(), query.dimDomain());
+    for (unsigned point = 0; point < order.size(); ++point) {
+      for (unsigned dim = 0; dim < query.dimDomain(); ++dim) {
+        permuted.x(point, dim) = query.x(order[point], dim);
+      }
+      permuted.group(point) = query.group(order[point]);
+    }
+    return permuted;
+  }
+
+  /**
+   * Evaluates the model on chunks of the query in parallel; makeAdapter(begin) returns the result adapter
+   * whose first entry belongs to point begin.
+   * easi reports errors with exceptions, which must not leave the parallel region, hence the first one is
+   * re-thrown afterwards.
+   */
+  template<typename MakeAdapter>
+  void evaluateInChunks(easi::Component* model, easi::Query& query, MakeAdapter makeAdapter) {
+    unsigned const numPoints = query.numPoints();
+    unsigned const chunkSize = easiChunkSize();
+    unsigned const numChunks = (numPoints + chunkSize - 1) / chunkSize;
+
+    std::atomic<bool> failed(false);
+    std::string error;
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(dynamic, 1) num_threads(easiThreads())
+#endif
+    for (unsigned chunk = 0; chunk < numChunks; ++chunk) {
+      if (failed) {
+        continue;
+      }
+      unsigned const begin = chunk * chunkSize;
+      unsigned const end = std::min(begin + chunkSize, numPoints);
+      try {
+        easi::Query sub = subQuery(query, begin, end);
+        auto adapter = makeAdapter(begin);
+        model->evaluate(sub, adapter);
+      } catch (std::exception const& e) {
+#ifdef _OPENMP
+        #pragma omp critical
+#endif
+        {
+          if (!failed) {
+            error = e.what();
+          }
+          failed = true;
+        }
+      }
+    }
+    if (failed) {
+      throw std::runtime_error(error);
+    }
+  }
+
+  struct MaterialCacheHeader {
+    char magic[8];
+    uint64_t numPoints;
+    uint64_t numParameters;
+  };
+
+  constexpr char MaterialCacheMagic[8] = "SSMATC1";
+  constexpr char FaultCacheMagic[8] = "SSFLTC1";
+
+  uint64_t modelCacheKey(std::string const& fileName, easi::Query& query, char const* tag) {
+    std::ifstream file(fileName, std::ios::binary);
+    std::string const content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    uint64_t key = seissol::initializers::hashBytes(content.data(), content.size());
+    key = seissol::initializers::hashBytes(tag, std::strlen(tag), key);
+    // The query contains the points and groups of the local cells or fault faces, i.e. it identifies mesh and partition
+    for (unsigned point = 0; point < query.numPoints(); ++point) {
+      for (unsigned dim = 0; dim < query.dimDomain(); ++dim) {
+        double const x = query.x(point, dim);
+        key = seissol::initializers::hashValue(x, key);
+      }
+      int const group = query.group(point);
+      key = seissol::initializers::hashValue(group, key);
+    }
+    return key;
+  }
+
+  /** Returns the cache file of this rank in directory or an empty string if the cache is disabled. */
+  std::string modelCacheFile(std::string const& directory,
+                             char const* prefix,
+                             std::string const& fileName,
+                             easi::Query& query,
+                             char const* tag) {
+    if (directory.empty()) {
+      return "";
+    }
+    uint64_t key = modelCacheKey(fileName, query, tag);
+    int const rank = seissol::MPI::mpi.rank();
+    int const size = seissol::MPI::mpi.size();
+    key = seissol::initializers::hashValue(rank, key);
+    key = seissol::initializers::hashValue(size, key);
+
+    std::ostringstream name;
+    name << directory << "/" << prefix << "-" << std::hex << std::setw(16) << std::setfill('0') << key << std::dec
+         << "-" << rank << "of" << size << ".bin";
+    return name.str();
+  }
+
+  std::string materialCacheFile(std::string const& fileName, easi::Query& query, char const* materialType) {
+    static std::string const directory = utils::Env::get("SEISSOL_MATERIAL_CACHE", "");
+    return modelCacheFile(directory, "material", fileName, query, materialType);
+  }
+
+  std::string faultCacheFile(std::string const& fileName, easi::Query& query, std::vector<std::string> const& names) {
+    static std::string const directory = utils::Env::get("SEISSOL_FAULT_CACHE", "");
+    std::string tag = "fault";
+    for (auto const& name : names) {
+      tag += "," + name;
+    }
+    return modelCacheFile(directory, "fault", fileName, query, tag.c_str());
+  }
+
+  template<class T>
+  bool loadMaterialCache(std::string const& cacheFile,
+                         std::vector<std::pair<std::string, double T::*>> const& bindingPoints,
+                         std::vector<T>& materials) {
+    std::ifstream file(cacheFile, std::ios::binary);
+    if (!file) {
+      return false;
+    }
+    MaterialCacheHeader header;
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!file || std::memcmp(header.magic, MaterialCacheMagic, sizeof(header.magic)) != 0
+        || header.numPoints != materials.size() || header.numParameters != bindingPoints.size()) {
+      logWarning(seissol::MPI::mpi.rank()) << "Ignoring invalid material cache" << cacheFile;
+      return false;
+    }
+    std::vector<double> values(materials.size() * bindingPoints.size());
+    file.read(reinterpret_cast<char*>(values.data()), values.size() * sizeof(double));
+    if (!file) {
+      logWarning(seissol::MPI::mpi.rank()) << "Ignoring truncated material cache" << cacheFile;
+      return false;
+    }
+    for (std::size_t point = 0; point < materials.size(); ++point) {
+      for (std::size_t parameter = 0; parameter < bindingPoints.size(); ++parameter) {
+        materials[point].*(bindingPoints[parameter].second) = values[point * bindingPoints.size() + parameter];
+      }
+    }
+    logInfo(seissol::MPI::mpi.rank()) << "Material parameters read from" << cacheFile;
+    return true;
+  }
+
+  template<class T>
+  void storeMaterialCache(std::string const& cacheFile,
+                          std::vector<std::pair<std::string, double T::*>> const& bindingPoints,
+                          std::vector<T> const& materials) {
+    std::vector<double> values(materials.size() * bindingPoints.size());
+    for (std::size_t point = 0; point < materials.size(); ++point) {
+      for (std::size_t parameter = 0; parameter < bindingPoints.size(); ++parameter) {
+        values[point * bindingPoints.size() + parameter] = materials[point].*(bindingPoints[parameter].second);
+      }
+    }
+    MaterialCacheHeader header;
+    std::memcpy(header.magic, MaterialCacheMagic, sizeof(header.magic));
+    header.numPoints = materials.size();
+    header.numParameters = bindingPoints.size();
+
+    // Write to a temporary file first such that an aborted run does not leave a broken cache behind
+    std::string const temporaryFile = cacheFile + ".tmp";
+    {
+      std::ofstream file(temporaryFile, std::ios::binary | std::ios::trunc);
+      file.write(reinterpret_cast<char const*>(&header), sizeof(header));
+      file.write(reinterpret_cast<char const*>(values.data()), values.size() * sizeof(double));
+      if (!file) {
+        logWarning(seissol::MPI::mpi.rank()) << "Could not write the material cache" << cacheFile;
+        return;
+      }
+    }
+    if (std::rename(temporaryFile.c_str(), cacheFile.c_str()) != 0) {
+      logWarning(seissol::MPI::mpi.rank()) << "Could not write the material cache" << cacheFile;
+    }
+  }
 
+  using FaultParameters = std::vector<std::pair<std::string, std::pair<double*, unsigned>>>;
+
+  bool loadFaultCache(std::string const& cacheFile, FaultParameters const& parameters, std::size_t numPoints) {
+    std::ifstream file(cacheFile, std::ios::binary);
+    if (!file) {
+      return false;
+    }
+    MaterialCacheHeader header;
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!file || std::memcmp(header.magic, FaultCacheMagic, sizeof(header.magic)) != 0
+        || header.numPoints != numPoints || header.numParameters != parameters.size()) {
+      logWarning(seissol::MPI::mpi.rank()) << "Ignoring invalid fault cache" << cacheFile;
+      return false;
+    }
+    // The parameters are stored one after the other, hence each can be copied to its strided destination
+    std::vector<double> values(numPoints * parameters.size());
+    file.read(reinterpret_cast<char*>(values.data()), values.size() * sizeof(double));
+    if (!file) {
+      logWarning(seissol::MPI::mpi.rank()) << "Ignoring truncated fault cache" << cacheFile;
+      return false;
+    }
+    for (std::size_t parameter = 0; parameter < parameters.size(); ++parameter) {
+      double* memory = parameters[parameter].second.first;
+      unsigned const stride = parameters[parameter].second.second;
+      for (std::size_t point = 0; point < numPoints; ++point) {
+        memory[point * stride] = values[parameter * numPoints + point];
+      }
+    }
+    logInfo(seissol::MPI::mpi.rank()) << "Fault parameters read from" << cacheFile;
+    return true;
+  }
+
+  void storeFaultCache(std::string const& cacheFile, FaultParameters const& parameters, std::size_t numPoints) {
+    std::vector<double> values(numPoints * parameters.size());
+    for (std::size_t parameter = 0; parameter < parameters.size(); ++parameter) {
+      double const* memory = parameters[parameter].second.first;
+      unsigned const stride = parameters[parameter].second.second;
+      for (std::size_t point = 0; point < numPoints; ++point) {
+        values[parameter * numPoints + point] = memory[point * stride];
+      }
+    }
+    MaterialCacheHeader header;
+    std::memcpy(header.magic, FaultCacheMagic, sizeof(header.magic));
+    header.numPoints = numPoints;
+    header.numParameters = parameters.size();
+
+    std::string const temporaryFile = cacheFile + ".tmp";
+    {
+      std::ofstream file(temporaryFile, std::ios::binary | std::ios::trunc);
+      file.write(reinterpret_cast<char const*>(&header), sizeof(header));
+      file.write(reinterpret_cast<char const*>(values.data()), values.size() * sizeof(double));
+      if (!file) {
+        logWarning(seissol::MPI::mpi.rank()) << "Could not write the fault cache" << cacheFile;
+        return;
+      }
+    }
+    if (std::rename(temporaryFile.c_str(), cacheFile.c_str()) != 0) {
+      logWarning(seissol::MPI::mpi.rank()) << "Could not write the fault cache" << cacheFile;
+    }
+  }
+} // namespace
 
 easi::Query seissol::initializers::ElementBarycentreGenerator::generate() const {
   std::vector<Element> const& elements = m_meshReader.getElements();
@@ -80,6 +424,42 @@ easi::Query seissol::initializers::ElementBarycentreGenerator::generate() const
   return query;
 }
 
+seissol::initializers::ElementAverageGenerator::ElementAverageGenerator(MeshReader const& meshReader, unsigned numberOfPoints)
+  : m_meshReader(meshReader), m_points(3 * numberOfPoints * numberOfPoints * numberOfPoints), m_weights(numberOfPoints * numberOfPoints * numberOfPoints) {
+  seissol::quadrature::TetrahedronQuadrature(reinterpret_cast<double(*)[3]>(m_points.data()), m_weights.data(), numberOfPoints);
+  // The weights sum up to the volume 1/6 of the reference tetrahedron, but the average needs a sum of 1
+  for (auto& weight : m_weights) {
+    weight *= 6.0;
+  }
+}
+
+easi::Query seissol::initializers::ElementAverageGenerator::generate() const {
+  std::vector<Element> const& elements = m_meshReader.getElements();
+  std::vector<Vertex> const& vertices = m_meshReader.getVertices();
+
+  unsigned const numSamples = m_weights.size();
+  easi::Query query(elements.size() * numSamples, 3);
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (unsigned elem = 0; elem < elements.size(); ++elem) {
+    double const* coords[4];
+    for (unsigned v = 0; v < 4; ++v) {
+      coords[v] = vertices[ elements[elem].vertices[ v ] ].coords;
+    }
+    for (unsigned point = 0; point < numSamples; ++point) {
+      unsigned const q = elem * numSamples + point;
+      double xyz[3];
+      seissol::transformations::tetrahedronReferenceToGlobal(coords[0], coords[1], coords[2], coords[3], &m_points[3 * point], xyz);
+      for (unsigned dim = 0; dim < 3; ++dim) {
+        query.x(q,dim) = xyz[dim];
+      }
+      query.group(q) = elements[elem].group;
+    }
+  }
+  return query;
+}
+
 #ifdef USE_HDF
 easi::Query seissol::initializers::ElementBarycentreGeneratorPUML::generate() const {
   std::vector<PUML::TETPUML::cell_t> const& cells = m_mesh.cells();
@@ -179,89 +559,154 @@ easi::Query seissol::initializers::FaultGPGenerator::generate() const {
 namespace seissol {
   namespace initializers {
     template<>
-    void MaterialParameterDB<seissol::model::ElasticMaterial>::addBindingPoints(easi::ArrayOfStructsAdapter<seissol::model::ElasticMaterial> &adapter) {
-      adapter.addBindingPoint("rho", &seissol::model::ElasticMaterial::rho);
-      adapter.addBindingPoint("mu", &seissol::model::ElasticMaterial::mu);
-      adapter.addBindingPoint("lambda", &seissol::model::ElasticMaterial::lambda);
+    std::vector<std::pair<std::string, double seissol::model::ElasticMaterial::*>> MaterialParameterDB<seissol::model::ElasticMaterial>::bindingPoints() {
+      return {
+        {"rho", &seissol::model::ElasticMaterial::rho},
+        {"mu", &seissol::model::ElasticMaterial::mu},
+        {"lambda", &seissol::model::ElasticMaterial::lambda}
+      };
     }
 
     template<>
-    void MaterialParameterDB<seissol::model::ViscoElasticMaterial>::addBindingPoints(easi::ArrayOfStructsAdapter<seissol::model::ViscoElasticMaterial> &adapter) {
-      adapter.addBindingPoint("rho", &seissol::model::ViscoElasticMaterial::rho);
-      adapter.addBindingPoint("mu", &seissol::model::ViscoElasticMaterial::mu);
-      adapter.addBindingPoint("lambda", &seissol::model::ViscoElasticMaterial::lambda);
-      adapter.addBindingPoint("Qp", &seissol::model::ViscoElasticMaterial::Qp);
-      adapter.addBindingPoint("Qs", &seissol::model::ViscoElasticMaterial::Qs);
+    std::vector<std::pair<std::string, double seissol::model::ViscoElasticMaterial::*>> MaterialParameterDB<seissol::model::ViscoElasticMaterial>::bindingPoints() {
+      return {
+        {"rho", &seissol::model::ViscoElasticMaterial::rho},
+        {"mu", &seissol::model::ViscoElasticMaterial::mu},
+        {"lambda", &seissol::model::ViscoElasticMaterial::lambda},
+        {"Qp", &seissol::model::ViscoElasticMaterial::Qp},
+        {"Qs", &seissol::model::ViscoElasticMaterial::Qs}
+      };
     }
 
     template<>
-    void MaterialParameterDB<seissol::model::PoroElasticMaterial>::addBindingPoints(easi::ArrayOfStructsAdapter<seissol::model::PoroElasticMaterial> &adapter) {
-      adapter.addBindingPoint("bulk_solid", &seissol::model::PoroElasticMaterial::bulkSolid);
-      adapter.addBindingPoint("rho", &seissol::model::PoroElasticMaterial::rho);
-      adapter.addBindingPoint("lambda", &seissol::model::PoroElasticMaterial::lambda);
-      adapter.addBindingPoint("mu", &seissol::model::PoroElasticMaterial::mu);
-      adapter.addBindingPoint("porosity", &seissol::model::PoroElasticMaterial::porosity);
-      adapter.addBindingPoint("permeability", &seissol::model::PoroElasticMaterial::permeability);
-      adapter.addBindingPoint("tortuosity", &seissol::model::PoroElasticMaterial::tortuosity);
-      adapter.addBindingPoint("bulk_fluid", &seissol::model::PoroElasticMaterial::bulkFluid);
-      adapter.addBindingPoint("rho_fluid", &seissol::model::PoroElasticMaterial::rhoFluid);
-      adapter.addBindingPoint("viscosity", &seissol::model::PoroElasticMaterial::viscosity);
+    std::vector<std::pair<std::string, double seissol::model::PoroElasticMaterial::*>> MaterialParameterDB<seissol::model::PoroElasticMaterial>::bindingPoints() {
+      return {
+        {"bulk_solid", &seissol::model::PoroElasticMaterial::bulkSolid},
+        {"rho", &seissol::model::PoroElasticMaterial::rho},
+        {"lambda", &seissol::model::PoroElasticMaterial::lambda},
+        {"mu", &seissol::model::PoroElasticMaterial::mu},
+        {"porosity", &seissol::model::PoroElasticMaterial::porosity},
+        {"permeability", &seissol::model::PoroElasticMaterial::permeability},
+        {"tortuosity", &seissol::model::PoroElasticMaterial::tortuosity},
+        {"bulk_fluid", &seissol::model::PoroElasticMaterial::bulkFluid},
+        {"rho_fluid", &seissol::model::PoroElasticMaterial::rhoFluid},
+        {"viscosity", &seissol::model::PoroElasticMaterial::viscosity}
+      };
     }
 
     template<>
-    void MaterialParameterDB<seissol::model::Plasticity>::addBindingPoints(easi::ArrayOfStructsAdapter<seissol::model::Plasticity> &adapter) {
-      adapter.addBindingPoint("bulkFriction", &seissol::model::Plasticity::bulkFriction);
-      adapter.addBindingPoint("plastCo", &seissol::model::Plasticity::plastCo);
-      adapter.addBindingPoint("s_xx", &seissol::model::Plasticity::s_xx);
-      adapter.addBindingPoint("s_yy", &seissol::model::Plasticity::s_yy);
-      adapter.addBindingPoint("s_zz", &seissol::model::Plasticity::s_zz);
-      adapter.addBindingPoint("s_xy", &seissol::model::Plasticity::s_xy);
-      adapter.addBindingPoint("s_yz", &seissol::model::Plasticity::s_yz);
-      adapter.addBindingPoint("s_xz", &seissol::model::Plasticity::s_xz);
+    std::vector<std::pair<std::string, double seissol::model::Plasticity::*>> MaterialParameterDB<seissol::model::Plasticity>::bindingPoints() {
+      return {
+        {"bulkFriction", &seissol::model::Plasticity::bulkFriction},
+        {"plastCo", &seissol::model::Plasticity::plastCo},
+        {"s_xx", &seissol::model::Plasticity::s_xx},
+        {"s_yy", &seissol::model::Plasticity::s_yy},
+        {"s_zz", &seissol::model::Plasticity::s_zz},
+        {"s_xy", &seissol::model::Plasticity::s_xy},
+        {"s_yz", &seissol::model::Plasticity::s_yz},
+        {"s_xz", &seissol::model::Plasticity::s_xz}
+      };
     }
 
     template<>
-    void MaterialParameterDB<seissol::model::AnisotropicMaterial>::addBindingPoints(easi::ArrayOfStructsAdapter<seissol::model::AnisotropicMaterial> &adapter) {
-      adapter.addBindingPoint("rho", &seissol::model::AnisotropicMaterial::rho);
-      adapter.addBindingPoint("c11", &seissol::model::AnisotropicMaterial::c11);
-      adapter.addBindingPoint("c12", &seissol::model::AnisotropicMaterial::c12);
-      adapter.addBindingPoint("c13", &seissol::model::AnisotropicMaterial::c13);
-      adapter.addBindingPoint("c14", &seissol::model::AnisotropicMaterial::c14);
-      adapter.addBindingPoint("c15", &seissol::model::AnisotropicMaterial::c15);
-      adapter.addBindingPoint("c16", &seissol::model::AnisotropicMaterial::c16);
-      adapter.addBindingPoint("c22", &seissol::model::AnisotropicMaterial::c22);
-      adapter.addBindingPoint("c23", &seissol::model::AnisotropicMaterial::c23);
-      adapter.addBindingPoint("c24", &seissol::model::AnisotropicMaterial::c24);
-      adapter.addBindingPoint("c25", &seissol::model::AnisotropicMaterial::c25);
-      adapter.addBindingPoint("c26", &seissol::model::AnisotropicMaterial::c26);
-      adapter.addBindingPoint("c33", &seissol::model::AnisotropicMaterial::c33);
-      adapter.addBindingPoint("c34", &seissol::model::AnisotropicMaterial::c34);
-      adapter.addBindingPoint("c35", &seissol::model::AnisotropicMaterial::c35);
-      adapter.addBindingPoint("c36", &seissol::model::AnisotropicMaterial::c36);
-      adapter.addBindingPoint("c44", &seissol::model::AnisotropicMaterial::c44);
-      adapter.addBindingPoint("c45", &seissol::model::AnisotropicMaterial::c45);
-      adapter.addBindingPoint("c46", &seissol::model::AnisotropicMaterial::c46);
-      adapter.addBindingPoint("c55", &seissol::model::AnisotropicMaterial::c55);
-      adapter.addBindingPoint("c56", &seissol::model::AnisotropicMaterial::c56);
-      adapter.addBindingPoint("c66", &seissol::model::AnisotropicMaterial::c66);
+    std::vector<std::pair<std::string, double seissol::model::AnisotropicMaterial::*>> MaterialParameterDB<seissol::model::AnisotropicMaterial>::bindingPoints() {
+      return {
+        {"rho", &seissol::model::AnisotropicMaterial::rho},
+        {"c11", &seissol::model::AnisotropicMaterial::c11},
+        {"c12", &seissol::model::AnisotropicMaterial::c12},
+        {"c13", &seissol::model::AnisotropicMaterial::c13},
+        {"c14", &seissol::model::AnisotropicMaterial::c14},
+        {"c15", &seissol::model::AnisotropicMaterial::c15},
+        {"c16", &seissol::model::AnisotropicMaterial::c16},
+        {"c22", &seissol::model::AnisotropicMaterial::c22},
+        {"c23", &seissol::model::AnisotropicMaterial::c23},
+        {"c24", &seissol::model::AnisotropicMaterial::c24},
+        {"c25", &seissol::model::AnisotropicMaterial::c25},
+        {"c26", &seissol::model::AnisotropicMaterial::c26},
+        {"c33", &seissol::model::AnisotropicMaterial::c33},
+        {"c34", &seissol::model::AnisotropicMaterial::c34},
+        {"c35", &seissol::model::AnisotropicMaterial::c35},
+        {"c36", &seissol::model::AnisotropicMaterial::c36},
+        {"c44", &seissol::model::AnisotropicMaterial::c44},
+        {"c45", &seissol::model::AnisotropicMaterial::c45},
+        {"c46", &seissol::model::AnisotropicMaterial::c46},
+        {"c55", &seissol::model::AnisotropicMaterial::c55},
+        {"c56", &seissol::model::AnisotropicMaterial::c56},
+        {"c66", &seissol::model::AnisotropicMaterial::c66}
+      };
     }                                                               
     
     template<class T>
     void MaterialParameterDB<T>::evaluateModel(std::string const& fileName, QueryGenerator const& queryGen) {
-      easi::Component* model = loadEasiModel(fileName);
       easi::Query query = queryGen.generate();
 
-      easi::ArrayOfStructsAdapter<T> adapter(m_materials->data());
-      addBindingPoints(adapter);
-      model->evaluate(query, adapter); 
-      
+      std::string const cacheFile = materialCacheFile(fileName, query, typeid(T).name());
+      if (!cacheFile.empty() && loadMaterialCache(cacheFile, bindingPoints(), *m_materials)) {
+        return;
+      }
+
+      easi::Component* model = loadEasiModel(fileName);
+      std::vector<double> const* weights = queryGen.sampleWeights();
+      std::vector<unsigned> const order = spatialOrder(query);
+      if (weights == nullptr && order.empty()) {
+        evaluateQuery(model, query, *m_materials);
+      } else {
+        std::vector<T> samples(query.numPoints());
+        if (order.empty()) {
+          evaluateQuery(model, query, samples);
+        } else {
+          easi::Query sortedQuery = permutedQuery(query, order);
+          std::vector<T> sortedSamples(query.numPoints());
+          evaluateQuery(model, sortedQuery, sortedSamples);
+          for (unsigned point = 0; point < order.size(); ++point) {
+            samples[order[point]] = sortedSamples[point];
+          }
+        }
+        if (weights != nullptr) {
+          averageSamples(samples, *weights);
+        } else {
+          std::copy(samples.begin(), samples.end(), m_materials->begin());
+        }
+      }
       delete model;
+
+      if (!cacheFile.empty()) {
+        storeMaterialCache(cacheFile, bindingPoints(), *m_materials);
+      }
+    }
+
+    template<class T>
+    void MaterialParameterDB<T>::evaluateQuery(easi::Component* model, easi::Query& query, std::vector<T>& materials) {
+      evaluateInChunks(model, query, [&](unsigned begin) {
+        easi::ArrayOfStructsAdapter<T> adapter(materials.data() + begin);
+        addBindingPoints(adapter);
+        return adapter;
+      });
+    }
+
+    template<class T>
+    void MaterialParameterDB<T>::averageSamples(std::vector<T> const& samples, std::vector<double> const& weights) {
+      auto const parameters = bindingPoints();
+      std::size_t const numElements = m_materials->size();
+      assert(samples.size() == numElements * weights.size());
+#ifdef _OPENMP
+      #pragma omp parallel for schedule(static)
+#endif
+      for (std::size_t elem = 0; elem < numElements; ++elem) {
+        T& material = (*m_materials)[elem];
+        material = samples[elem * weights.size()];
+        for (auto const& parameter : parameters) {
+          double average = 0.0;
+          for (std::size_t sample = 0; sample < weights.size(); ++sample) {
+            average += weights[sample] * samples[elem * weights.size() + sample].*(parameter.second);
+          }
+          material.*(parameter.second) = average;
+        }
+      }
     }
     
     template<>
-    void MaterialParameterDB<seissol::model::AnisotropicMaterial>::evaluateModel(std::string const& fileName, QueryGenerator const& queryGen) {
-      easi::Component* model = loadEasiModel(fileName);
-      easi::Query query = queryGen.generate();
+    void MaterialParameterDB<seissol::model::AnisotropicMaterial>::evaluateQuery(easi::Component* model, easi::Query& query, std::vector<seissol::model::AnisotropicMaterial>& materials) {
       auto suppliedParameters = model->suppliedParameters();
       //TODO(Sebastian): inhomogeneous materials, where in some parts only mu and lambda are given
       //                 and in other parts the full elastic tensor is given
@@ -270,28 +715,42 @@ namespace seissol {
       //assume isotropic behavior and calculate the parameters accordingly
       if (suppliedParameters.find("mu") != suppliedParameters.end() && suppliedParameters.find("lambda") != suppliedParameters.end()) {
         std::vector<seissol::model::ElasticMaterial> elasticMaterials(query.numPoints());
-        easi::ArrayOfStructsAdapter<seissol::model::ElasticMaterial> adapter(elasticMaterials.data());
-        MaterialParameterDB<seissol::model::ElasticMaterial>().addBindingPoints(adapter);
         unsigned numPoints = query.numPoints();
-        model->evaluate(query, adapter);
+        evaluateInChunks(model, query, [&](unsigned begin) {
+          easi::ArrayOfStructsAdapter<seissol::model::ElasticMaterial> adapter(elasticMaterials.data() + begin);
+          MaterialParameterDB<seissol::model::ElasticMaterial>().addBindingPoints(adapter);
+          return adapter;
+        });
 
         for(unsigned i = 0; i < numPoints; i++) {
-          m_materials->at(i) = seissol::model::AnisotropicMaterial(elasticMaterials[i]);
+          materials.at(i) = seissol::model::AnisotropicMaterial(elasticMaterials[i]);
         }
       }
       else {
-        easi::ArrayOfStructsAdapter<seissol::model::AnisotropicMaterial> arrayOfStructsAdapter(m_materials->data());
-        addBindingPoints(arrayOfStructsAdapter);
-        model->evaluate(query, arrayOfStructsAdapter);  
-        
+        evaluateInChunks(model, query, [&](unsigned begin) {
+          easi::ArrayOfStructsAdapter<seissol::model::AnisotropicMaterial> arrayOfStructsAdapter(materials.data() + begin);
+          addBindingPoints(arrayOfStructsAdapter);
+          return arrayOfStructsAdapter;
+        });
       }
-      delete model;
     }
 
     void FaultParameterDB::evaluateModel(std::string const& fileName, QueryGenerator const& queryGen) {
-      easi::Component* model = loadEasiModel(fileName);
       easi::Query query = queryGen.generate();
 
+      // Sorted by name, such that the layout of the cache does not depend on the hash map
+      FaultParameters parameters(m_parameters.begin(), m_parameters.end());
+      std::sort(parameters.begin(), parameters.end(), [](auto const& a, auto const& b) { return a.first < b.first; });
+      std::vector<std::string> names;
+      for (auto const& parameter : parameters) {
+        names.push_back(parameter.first);
+      }
+      std::string const cacheFile = faultCacheFile(fileName, query, names);
+      if (!cacheFile.empty() && loadFaultCache(cacheFile, parameters, query.numPoints())) {
+        return;
+      }
+
+      easi::Component* model = loadEasiModel(fileName);
       easi::ArraysAdapter<double> adapter;
       for (auto& kv : m_parameters) {
         adapter.addBindingPoint(kv.first, kv.second.first, kv.second.second);
@@ -299,6 +758,10 @@ namespace seissol {
       model->evaluate(query, adapter); 
       
       delete model;
+
+      if (!cacheFile.empty()) {
+        storeFaultCache(cacheFile, parameters, query.numPoints());
+      }
     }
 
   }
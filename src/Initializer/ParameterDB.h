@@ -46,6 +46,8 @@
 #include <string>
 #include <unordered_map>
 #include <set>
+#include <utility>
+#include <vector>
 
 #include "Geometry/MeshReader.h"
 #include "Kernels/precision.hpp"
@@ -67,6 +69,7 @@ namespace seissol {
   namespace initializers {
     class QueryGenerator;
     class ElementBarycentreGenerator;
+    class ElementAverageGenerator;
     class ElementBarycentreGeneratorPUML;
     class FaultBarycentreGenerator;
     class FaultGPGenerator;
@@ -83,6 +86,10 @@ namespace seissol {
 class seissol::initializers::QueryGenerator {
 public:
   virtual easi::Query generate() const = 0;
+  /** Weights (summing up to 1) if the query samples every element at several points, element after element.
+   *  MaterialParameterDB then stores the weighted average of the samples of each element.
+   */
+  virtual std::vector<double> const* sampleWeights() const { return nullptr; }
 };
 
 class seissol::initializers::ElementBarycentreGenerator : public seissol::initializers::QueryGenerator {
@@ -93,6 +100,20 @@ private:
   MeshReader const& m_meshReader;
 };
 
+/** Samples each element at the points of the tetrahedron quadrature with
+ *  numberOfPoints points per direction (see Numerical_aux/Quadrature.h).
+ */
+class seissol::initializers::ElementAverageGenerator : public seissol::initializers::QueryGenerator {
+public:
+  ElementAverageGenerator(MeshReader const& meshReader, unsigned numberOfPoints);
+  virtual easi::Query generate() const;
+  virtual std::vector<double> const* sampleWeights() const { return &m_weights; }
+private:
+  MeshReader const& m_meshReader;
+  std::vector<double> m_points;
+  std::vector<double> m_weights;
+};
+
 #ifdef USE_HDF
 class seissol::initializers::ElementBarycentreGeneratorPUML : public seissol::initializers::QueryGenerator {
 public:
@@ -133,11 +154,24 @@ public:
 template<class T>
 class seissol::initializers::MaterialParameterDB : seissol::initializers::ParameterDB {
 public: 
+  /** Evaluates the model in parallel chunks of the query (see QueryGenerator::sampleWeights for averaging).
+   *  With SEISSOL_MATERIAL_CACHE, the result is stored on disk and reused by later runs with the
+   *  same query (i.e. the same mesh and partition) and the same easi file.
+   */
   virtual void evaluateModel(std::string const& fileName, QueryGenerator const& queryGen);
   void setMaterialVector(std::vector<T>* materials) { m_materials = materials; }
-  void addBindingPoints(easi::ArrayOfStructsAdapter<T> &adapter) {};
+  /** Parameters supplied by easi and the corresponding members of T */
+  static std::vector<std::pair<std::string, double T::*>> bindingPoints();
+  void addBindingPoints(easi::ArrayOfStructsAdapter<T> &adapter) {
+    for (auto const& bindingPoint : bindingPoints()) {
+      adapter.addBindingPoint(bindingPoint.first, bindingPoint.second);
+    }
+  }
   
 private:
+  void evaluateQuery(easi::Component* model, easi::Query& query, std::vector<T>& materials);
+  void averageSamples(std::vector<T> const& samples, std::vector<double> const& weights);
+
   std::vector<T>* m_materials;
 };
 
@@ -0,0 +1,183 @@
+#include "SetupSnapshot.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <Initializer/Hash.h>
+#include <Parallel/MPI.h>
+#include <utils/env.h>
+#include <utils/logger.h>
+
+#include "version.h"
+
+namespace {
+constexpr char SnapshotMagic[8] = "SSSNAP1";
+
+//! Describes the build, since the matrices depend on the order, precision, equations and the code itself.
+std::string buildConfiguration() {
+  std::string const version = VERSION_STRING;
+  std::ostringstream configuration;
+  configuration << "version=" << version << ";order=" << CONVERGENCE_ORDER << ";real=" << sizeof(real)
+                << ";quantities=" << NUMBER_OF_QUANTITIES << ";mechanisms=" << NUMBER_OF_RELAXATION_MECHANISMS
+                << ";equations=";
+#if defined USE_ANISOTROPIC
+  configuration << "anisotropic";
+#elif defined USE_VISCOELASTIC
+  configuration << "viscoelastic";
+#elif defined USE_VISCOELASTIC2
+  configuration << "viscoelastic2";
+#elif defined USE_POROELASTIC
+  configuration << "poroelastic";
+#else
+  configuration << "elastic";
+#endif
+#ifdef MULTIPLE_SIMULATIONS
+  configuration << ";simulations=" << MULTIPLE_SIMULATIONS;
+#endif
+#ifdef USE_RECOMPUTED_STAR_MATRICES
+  configuration << ";recomputedStarMatrices";
+#endif
+  return configuration.str();
+}
+
+//! Hashes the parameters of a material; the virtual table pointer differs between runs and is skipped.
+template <typename MaterialT>
+uint64_t hashMaterial(MaterialT const& material, uint64_t hash) {
+  static_assert(std::is_polymorphic<MaterialT>::value, "Materials are expected to start with a virtual table pointer.");
+  char const* bytes = reinterpret_cast<char const*>(&material);
+  return seissol::initializers::hashBytes(bytes + sizeof(void*), sizeof(MaterialT) - sizeof(void*), hash);
+}
+} // namespace
+
+seissol::initializers::SetupSnapshot::SetupSnapshot(MeshReader const& meshReader,
+                                                    LTSTree* ltsTree,
+                                                    LTS* lts,
+                                                    Lut* ltsLut,
+                                                    TimeStepping const& timeStepping)
+    : m_meshReader(meshReader),
+      m_ltsTree(ltsTree),
+      m_lts(lts),
+      m_ltsLut(ltsLut),
+      m_timeStepping(timeStepping),
+      m_numberOfCells(0) {
+  static std::string const directory = utils::Env::get("SEISSOL_SETUP_SNAPSHOT", "");
+  if (directory.empty()) {
+    return;
+  }
+
+  for (auto it = m_ltsTree->beginLeaf(LayerMask(Ghost)); it != m_ltsTree->endLeaf(); ++it) {
+    m_numberOfCells += it->getNumberOfCells();
+  }
+
+  int const rank = seissol::MPI::mpi.rank();
+  int const size = seissol::MPI::mpi.size();
+  std::ostringstream name;
+  name << directory << "/setup-" << std::hex << std::setw(16) << std::setfill('0') << computeKey() << std::dec << "-"
+       << rank << "of" << size << ".bin";
+  m_fileName = name.str();
+}
+
+uint64_t seissol::initializers::SetupSnapshot::computeKey() const {
+  std::vector<Element> const& elements = m_meshReader.getElements();
+  std::vector<Vertex> const& vertices = m_meshReader.getVertices();
+  unsigned const* ltsToMesh = m_ltsLut->getLtsToMeshLut(m_lts->material.mask);
+  CellMaterialData const* material = m_ltsTree->var(m_lts->material);
+  CellLocalInformation const* cellInformation = m_ltsTree->var(m_lts->cellInformation);
+
+  // Everything initializeCellLocalMatrices depends on, hashed per cell in parallel
+  std::vector<uint64_t> cellHashes(m_numberOfCells);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (std::size_t cell = 0; cell < m_numberOfCells; ++cell) {
+    uint64_t hash = HashSeed;
+    for (unsigned vertex = 0; vertex < 4; ++vertex) {
+      VrtxCoords const& coords = vertices[elements[ltsToMesh[cell]].vertices[vertex]].coords;
+      hash = hashBytes(coords, sizeof(VrtxCoords), hash);
+    }
+    hash = hashMaterial(material[cell].local, hash);
+    for (unsigned side = 0; side < 4; ++side) {
+      hash = hashMaterial(material[cell].neighbor[side], hash);
+      hash = hashValue(cellInformation[cell].faceTypes[side], hash);
+    }
+    hash = hashValue(cellInformation[cell].clusterId, hash);
+    cellHashes[cell] = hash;
+  }
+
+  Header const snapshotHeader = header();
+  uint64_t key = hashBytes(&snapshotHeader, sizeof(snapshotHeader));
+  std::string const configuration = buildConfiguration();
+  key = hashBytes(configuration.data(), configuration.size(), key);
+  key = hashBytes(m_timeStepping.globalCflTimeStepWidths,
+                  m_timeStepping.numberOfGlobalClusters * sizeof(m_timeStepping.globalCflTimeStepWidths[0]),
+                  key);
+  return hashBytes(cellHashes.data(), cellHashes.size() * sizeof(uint64_t), key);
+}
+
+seissol::initializers::SetupSnapshot::Header seissol::initializers::SetupSnapshot::header() const {
+  Header snapshotHeader;
+  std::memcpy(snapshotHeader.magic, SnapshotMagic, sizeof(snapshotHeader.magic));
+  snapshotHeader.numberOfCells = m_numberOfCells;
+  snapshotHeader.localIntegrationSize = sizeof(LocalIntegrationData);
+  snapshotHeader.neighboringIntegrationSize = sizeof(NeighboringIntegrationData);
+  return snapshotHeader;
+}
+
+bool seissol::initializers::SetupSnapshot::load() {
+  if (m_fileName.empty()) {
+    return false;
+  }
+  std::ifstream file(m_fileName, std::ios::binary);
+  if (!file) {
+    return false;
+  }
+
+  Header const expected = header();
+  Header snapshotHeader;
+  file.read(reinterpret_cast<char*>(&snapshotHeader), sizeof(snapshotHeader));
+  if (!file || std::memcmp(&snapshotHeader, &expected, sizeof(Header)) != 0) {
+    logWarning(seissol::MPI::mpi.rank()) << "Ignoring invalid setup snapshot" << m_fileName;
+    return false;
+  }
+  file.read(reinterpret_cast<char*>(m_ltsTree->var(m_lts->localIntegration)),
+            m_numberOfCells * sizeof(LocalIntegrationData));
+  file.read(reinterpret_cast<char*>(m_ltsTree->var(m_lts->neighboringIntegration)),
+            m_numberOfCells * sizeof(NeighboringIntegrationData));
+  if (!file) {
+    // the matrices are recomputed completely, hence partially read data does not matter
+    logWarning(seissol::MPI::mpi.rank()) << "Ignoring truncated setup snapshot" << m_fileName;
+    return false;
+  }
+  logInfo(seissol::MPI::mpi.rank()) << "Cell-local matrices read from" << m_fileName;
+  return true;
+}
+
+void seissol::initializers::SetupSnapshot::store() const {
+  if (m_fileName.empty()) {
+    return;
+  }
+  Header const snapshotHeader = header();
+  // Write to a temporary file first such that an aborted run does not leave a broken snapshot behind
+  std::string const temporaryFile = m_fileName + ".tmp";
+  {
+    std::ofstream file(temporaryFile, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<char const*>(&snapshotHeader), sizeof(snapshotHeader));
+    file.write(reinterpret_cast<char const*>(m_ltsTree->var(m_lts->localIntegration)),
+               m_numberOfCells * sizeof(LocalIntegrationData));
+    file.write(reinterpret_cast<char const*>(m_ltsTree->var(m_lts->neighboringIntegration)),
+               m_numberOfCells * sizeof(NeighboringIntegrationData));
+    if (!file) {
+      logWarning(seissol::MPI::mpi.rank()) << "Could not write the setup snapshot" << m_fileName;
+      return;
+    }
+  }
+  if (std::rename(temporaryFile.c_str(), m_fileName.c_str()) != 0) {
+    logWarning(seissol::MPI::mpi.rank()) << "Could not write the setup snapshot" << m_fileName;
+  }
+}
@@ -0,0 +1,58 @@
+#ifndef SEISSOL_INITIALIZER_SETUPSNAPSHOT_H
+#define SEISSOL_INITIALIZER_SETUPSNAPSHOT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include <Geometry/MeshReader.h>
+#include <Initializer/LTS.h>
+#include <Initializer/tree/LTSTree.hpp>
+#include <Initializer/tree/Lut.hpp>
+#include <Initializer/typedefs.hpp>
+
+namespace seissol::initializers {
+/**
+ * Per-rank snapshot of the cell-local matrices, i.e. of the local and neighboring integration data.
+ *
+ * With SEISSOL_SETUP_SNAPSHOT set to a directory, the matrices are stored after they were computed and read back
+ * by later runs whose cells, geometry, materials and time step widths are identical, which skips their computation.
+ * Everything which contains pointers (mappings, buffers, dynamic rupture) is set up as usual.
+ **/
+class SetupSnapshot {
+  public:
+  SetupSnapshot(MeshReader const& meshReader,
+                LTSTree* ltsTree,
+                LTS* lts,
+                Lut* ltsLut,
+                TimeStepping const& timeStepping);
+
+  //! Reads the matrices if a matching snapshot exists; returns false otherwise (or if snapshots are disabled).
+  bool load();
+
+  //! Writes the matrices if snapshots are enabled.
+  void store() const;
+
+  private:
+  struct Header {
+    char magic[8];
+    uint64_t numberOfCells;
+    uint64_t localIntegrationSize;
+    uint64_t neighboringIntegrationSize;
+  };
+
+  uint64_t computeKey() const;
+  Header header() const;
+
+  MeshReader const& m_meshReader;
+  LTSTree* m_ltsTree;
+  LTS* m_lts;
+  Lut* m_ltsLut;
+  TimeStepping const& m_timeStepping;
+  std::size_t m_numberOfCells;
+  //! Empty if snapshots are disabled
+  std::string m_fileName;
+};
+} // namespace seissol::initializers
+
+#endif // SEISSOL_INITIALIZER_SETUPSNAPSHOT_H
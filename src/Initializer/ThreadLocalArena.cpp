@@ -0,0 +1,43 @@
+#include "ThreadLocalArena.h"
+
+#include <algorithm>
+
+#include <Initializer/MemoryAllocator.h>
+#include <Parallel/MPI.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+std::size_t seissol::memory::ThreadLocalArena::s_reserved = 0;
+
+seissol::memory::ThreadLocalArena::State::~State() {
+  seissol::memory::free(base);
+}
+
+void seissol::memory::ThreadLocalArena::reserve(std::size_t bytes) {
+  s_reserved = std::max(s_reserved, bytes);
+}
+
+bool seissol::memory::ThreadLocalArena::grow(State& arena) {
+  if (arena.capacity >= s_reserved) {
+    return false;
+  }
+  seissol::memory::free(arena.base);
+  arena.base = static_cast<char*>(seissol::memory::allocate(s_reserved, PAGESIZE_STACK));
+  arena.capacity = s_reserved;
+  return true;
+}
+
+void seissol::memory::ThreadLocalArena::initialize() {
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+  {
+    State& arena = state();
+    grow(arena);
+    // first touch by the owning thread
+    std::fill(arena.base, arena.base + arena.capacity, 0);
+  }
+  logInfo(seissol::MPI::mpi.rank()) << "Thread-local arenas:" << s_reserved << "bytes per thread.";
+}
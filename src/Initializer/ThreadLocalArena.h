@@ -0,0 +1,85 @@
+#ifndef SEISSOL_INITIALIZER_THREADLOCALARENA_H
+#define SEISSOL_INITIALIZER_THREADLOCALARENA_H
+
+#include <cstddef>
+
+#include <Kernels/precision.hpp>
+#include <utils/logger.h>
+
+namespace seissol::memory {
+/**
+ * Per-thread bump allocator for the temporaries of the cell and face loops.
+ *
+ * The components reserve the (maximum) amount of scratch memory they need during the setup, and
+ * ThreadLocalArena::initialize allocates one arena per OpenMP thread. In the loops, a Scope hands out
+ * aligned chunks of the arena of the calling thread and releases them at the end of the scope, i.e.
+ * no heap allocation takes place and the temporaries do not live on the (limited) thread stack.
+ * Scopes may nest, but the memory of a scope must not be used after the scope ends.
+ **/
+class ThreadLocalArena {
+  public:
+  class Scope {
+    public:
+    Scope() : m_mark(state().offset) {}
+    ~Scope() { state().offset = m_mark; }
+    Scope(Scope const&) = delete;
+    Scope& operator=(Scope const&) = delete;
+
+    //! Returns uninitialized memory for count objects of type T.
+    template <typename T>
+    T* allocate(std::size_t count, std::size_t alignment = ALIGNMENT) {
+      return static_cast<T*>(allocateBytes(count * sizeof(T), alignment));
+    }
+
+    private:
+    std::size_t m_mark;
+  };
+
+  //! Upper bound of the arena memory taken by Scope::allocate<T>(count, alignment).
+  template <typename T>
+  static constexpr std::size_t bytesFor(std::size_t count, std::size_t alignment = ALIGNMENT) {
+    return count * sizeof(T) + alignment - 1;
+  }
+
+  //! Ensures that the arena of every thread holds at least the given number of bytes, see bytesFor.
+  static void reserve(std::size_t bytes);
+
+  //! Allocates the arenas of all OpenMP threads; must be called outside of a parallel region after all reservations.
+  static void initialize();
+
+  private:
+  struct State {
+    char* base = nullptr;
+    std::size_t capacity = 0;
+    std::size_t offset = 0;
+    ~State();
+  };
+
+  static State& state() {
+    static thread_local State s_state;
+    return s_state;
+  }
+
+  static void* allocateBytes(std::size_t bytes, std::size_t alignment) {
+    State& arena = state();
+    std::size_t const begin = (arena.offset + alignment - 1) / alignment * alignment;
+    if (begin + bytes > arena.capacity) {
+      // arenas of threads which were not part of initialize() are allocated on first use
+      if (arena.offset == 0 && grow(arena)) {
+        return allocateBytes(bytes, alignment);
+      }
+      logError() << "Thread-local arena exhausted:" << begin + bytes << "bytes requested, but only" << arena.capacity
+                 << "bytes were reserved.";
+    }
+    arena.offset = begin + bytes;
+    return arena.base + begin;
+  }
+
+  //! Reallocates an empty arena with the reserved size; returns false if the arena is already large enough.
+  static bool grow(State& arena);
+
+  static std::size_t s_reserved;
+};
+} // namespace seissol::memory
+
+#endif // SEISSOL_INITIALIZER_THREADLOCALARENA_H
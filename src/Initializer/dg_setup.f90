@@ -369,7 +369,35 @@ CONTAINS
                                               )
     enddo
 
+    IF(EQN%DR.EQ.1) THEN
+      IF(DISC%DynRup%thermalPress.EQ.1) THEN
+        call c_interoperability_setThermalPressurizationParameters( &
+                alphaTh            = DISC%DynRup%alpha_th,          &
+                rhoC               = DISC%DynRup%rho_c,             &
+                lambda             = DISC%DynRup%TP_lambda,         &
+                initialTemperature = EQN%Temp_0,                    &
+                initialPressure    = EQN%Pressure_0 )
+      ENDIF
+      ! friction law settings are required to set up the dynamic rupture storage
+      call c_interoperability_setFrictionLawParameters(         &
+              frictionLaw       = EQN%FL,                       &
+              t0                = DISC%DynRup%t_0,              &
+              rsF0              = DISC%DynRup%RS_f0,            &
+              rsSr0             = DISC%DynRup%RS_sr0,           &
+              rsB               = DISC%DynRup%RS_b,             &
+              muW               = DISC%DynRup%Mu_W,             &
+              instHealing       = DISC%DynRup%inst_healing,     &
+              thermalPress      = DISC%DynRup%thermalPress,     &
+              ruptureTimeOn     = DISC%DynRup%RFtime_on,        &
+              dynStressOutputOn = DISC%DynRup%DS_output_on,     &
+              magnitudeOutputOn = DISC%DynRup%magnitude_output_on )
+    ENDIF
+
     enableFreeSurfaceIntegration = (io%surfaceOutput > 0)
+    ! the damping of the absorbing layer is stored in the LTS tree
+    call c_interoperability_setAbsorbingLayer( width      = BND%AbsorbingLayerWidth,      &
+                                               reflection = BND%AbsorbingLayerReflection, &
+                                               interior   = BND%AbsorbingLayerInterior )
     ! put the clusters under control of the time manager
     call c_interoperability_initializeClusteredLts(&
             i_clustering = disc%galerkin%clusteredLts, &
@@ -544,29 +572,48 @@ CONTAINS
           DISC%DynRup%dynStress_time(:,i) = 0.0
       END DO
 
-      allocate(disc%DynRup%output_Mu(DISC%Galerkin%nBndGP,MESH%Fault%nSide))
-      allocate(disc%DynRup%output_Strength(DISC%Galerkin%nBndGP,MESH%Fault%nSide))
-      allocate(disc%DynRup%output_Slip(DISC%Galerkin%nBndGP,MESH%Fault%nSide))
-      allocate(disc%DynRup%output_Slip1(DISC%Galerkin%nBndGP,MESH%Fault%nSide))
-      allocate(disc%DynRup%output_Slip2(DISC%Galerkin%nBndGP,MESH%Fault%nSide))
-      allocate(disc%DynRup%output_rupture_time(DISC%Galerkin%nBndGP,MESH%Fault%nSide))
-      allocate(disc%DynRup%output_PeakSR(DISC%Galerkin%nBndGP,MESH%Fault%nSide))
-      allocate(disc%DynRup%output_dynStress_time(DISC%Galerkin%nBndGP,MESH%Fault%nSide))      
-      allocate(disc%DynRup%output_StateVar(DISC%Galerkin%nBndGP,MESH%Fault%nSide))
+      ! pass the fault state to the C++ friction solvers (no-op if the Fortran friction solver is used)
+      if (allocated(EQN%NucleationStressInFaultCS) .and. (EQN%FL .ne. 33) .and. (EQN%FL .ne. 34)) then
+        call c_interoperability_initializeFrictionSolver(DISC%DynRup%Mu, DISC%DynRup%SlipRate1, DISC%DynRup%SlipRate2, &
+                DISC%DynRup%Slip, DISC%DynRup%Slip1, DISC%DynRup%Slip2, DISC%DynRup%TracXY, DISC%DynRup%TracXZ, &
+                DISC%DynRup%StateVar, DISC%DynRup%PeakSR, DISC%DynRup%rupture_time, DISC%DynRup%dynStress_time, &
+                EQN%InitialStressInFaultCS, EQN%NucleationStressInFaultCS, logical(.true., c_bool))
+      else
+        call c_interoperability_initializeFrictionSolver(DISC%DynRup%Mu, DISC%DynRup%SlipRate1, DISC%DynRup%SlipRate2, &
+                DISC%DynRup%Slip, DISC%DynRup%Slip1, DISC%DynRup%Slip2, DISC%DynRup%TracXY, DISC%DynRup%TracXZ, &
+                DISC%DynRup%StateVar, DISC%DynRup%PeakSR, DISC%DynRup%rupture_time, DISC%DynRup%dynStress_time, &
+                EQN%InitialStressInFaultCS, EQN%InitialStressInFaultCS, logical(.false., c_bool))
+      endif
+      if (DISC%DynRup%thermalPress == 1) then
+        call c_interoperability_initializeThermalPressurization(DISC%DynRup%TP, MESH%Fault%nSide)
+      endif
 
-      ! Initialize w/ first-touch
-      !$omp parallel do schedule(static)
-      DO i=1,MESH%fault%nSide
-          disc%DynRup%output_Mu(:,i) = 0.0
-          disc%DynRup%output_Strength(:,i) = 0.0
-          disc%DynRup%output_Slip(:,i) = 0.0
-          disc%DynRup%output_Slip1(:,i) = 0.0
-          disc%DynRup%output_Slip2(:,i) = 0.0
-          disc%DynRup%output_rupture_time(:,i) = 0.0
-          disc%DynRup%output_PeakSR(:,i) = 0.0
-          disc%DynRup%output_dynStress_time(:,i) = 0.0
-          disc%DynRup%output_StateVar(:,i) = 0.0
-      END DO
+      ! The output arrays already point to the fault state if the C++ friction solvers are used
+      if (.not. associated(disc%DynRup%output_Mu)) then
+        allocate(disc%DynRup%output_Mu(DISC%Galerkin%nBndGP,MESH%Fault%nSide))
+        allocate(disc%DynRup%output_Strength(DISC%Galerkin%nBndGP,MESH%Fault%nSide))
+        allocate(disc%DynRup%output_Slip(DISC%Galerkin%nBndGP,MESH%Fault%nSide))
+        allocate(disc%DynRup%output_Slip1(DISC%Galerkin%nBndGP,MESH%Fault%nSide))
+        allocate(disc%DynRup%output_Slip2(DISC%Galerkin%nBndGP,MESH%Fault%nSide))
+        allocate(disc%DynRup%output_rupture_time(DISC%Galerkin%nBndGP,MESH%Fault%nSide))
+        allocate(disc%DynRup%output_PeakSR(DISC%Galerkin%nBndGP,MESH%Fault%nSide))
+        allocate(disc%DynRup%output_dynStress_time(DISC%Galerkin%nBndGP,MESH%Fault%nSide))
+        allocate(disc%DynRup%output_StateVar(DISC%Galerkin%nBndGP,MESH%Fault%nSide))
+
+        ! Initialize w/ first-touch
+        !$omp parallel do schedule(static)
+        DO i=1,MESH%fault%nSide
+            disc%DynRup%output_Mu(:,i) = 0.0
+            disc%DynRup%output_Strength(:,i) = 0.0
+            disc%DynRup%output_Slip(:,i) = 0.0
+            disc%DynRup%output_Slip1(:,i) = 0.0
+            disc%DynRup%output_Slip2(:,i) = 0.0
+            disc%DynRup%output_rupture_time(:,i) = 0.0
+            disc%DynRup%output_PeakSR(:,i) = 0.0
+            disc%DynRup%output_dynStress_time(:,i) = 0.0
+            disc%DynRup%output_StateVar(:,i) = 0.0
+        END DO
+      endif
 
     else
         ! Allocate dummy arrays to avoid debug errors
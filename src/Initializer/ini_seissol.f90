@@ -187,7 +187,8 @@ CONTAINS
     ! This has to be done before the LTS setup!
     if( io%format .eq. 6 ) then
       call c_interoperability_enableWaveFieldOutput( i_waveFieldInterval = io%outInterval%timeInterval, &
-                                                     i_waveFieldFilename = trim(io%OutputFile) // c_null_char )
+                                                     i_waveFieldFilename = trim(io%OutputFile) // c_null_char, &
+                                                     i_outputRegionsFilename = trim(io%OutputRegionsFile) // c_null_char )
     endif
 
     if( io%checkpoint%interval .gt. 0 ) then
@@ -0,0 +1,17 @@
+#include "CellTimeSteps.h"
+
+std::vector<double>
+    seissol::initializers::time_stepping::computeCellTimeSteps(std::vector<Element> const& elements,
+                                                               std::vector<Vertex> const& vertices,
+                                                               double const* maxWaveSpeeds) {
+  std::vector<double> timeSteps(elements.size());
+#pragma omp parallel for schedule(static)
+  for (std::size_t cell = 0; cell < elements.size(); ++cell) {
+    Eigen::Vector3d x[4];
+    for (unsigned vtx = 0; vtx < 4; ++vtx) {
+      x[vtx] = Eigen::Vector3d(vertices[elements[cell].vertices[vtx]].coords);
+    }
+    timeSteps[cell] = cflTimeStep(insphereRadius(x), maxWaveSpeeds[cell]);
+  }
+  return timeSteps;
+}
@@ -0,0 +1,42 @@
+#ifndef SEISSOL_INITIALIZER_TIMESTEPPING_CELLTIMESTEPS_H
+#define SEISSOL_INITIALIZER_TIMESTEPPING_CELLTIMESTEPS_H
+
+#include <cmath>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include "Geometry/MeshDefinition.h"
+
+namespace seissol::initializers::time_stepping {
+
+/**
+ * Radius of the insphere of a tetrahedron, i.e. 3 * volume / surface area.
+ * This is the minimal distance between the barycentre and the faces used by the CFL condition.
+ **/
+inline double insphereRadius(Eigen::Vector3d const x[4]) {
+  const double volume6 = std::fabs((x[1] - x[0]).dot((x[2] - x[0]).cross(x[3] - x[0])));
+  const double area2 = ((x[1] - x[0]).cross(x[2] - x[0])).norm() + ((x[1] - x[0]).cross(x[3] - x[0])).norm() +
+                       ((x[2] - x[0]).cross(x[3] - x[0])).norm() + ((x[2] - x[1]).cross(x[3] - x[1])).norm();
+  return volume6 / area2;
+}
+
+/**
+ * Maximum stable time step width of a cell with CFL number 1.
+ **/
+inline double cflTimeStep(double insphere, double maxWaveSpeed) {
+  return 2.0 * insphere / (maxWaveSpeed * (2 * CONVERGENCE_ORDER - 1));
+}
+
+/**
+ * Computes the maximum stable time step widths (CFL number 1) of all elements in parallel.
+ *
+ * @param maxWaveSpeeds maximum wave speed of every element.
+ **/
+std::vector<double> computeCellTimeSteps(std::vector<Element> const& elements,
+                                         std::vector<Vertex> const& vertices,
+                                         double const* maxWaveSpeeds);
+
+} // namespace seissol::initializers::time_stepping
+
+#endif // SEISSOL_INITIALIZER_TIMESTEPPING_CELLTIMESTEPS_H
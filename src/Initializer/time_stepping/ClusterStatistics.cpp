@@ -0,0 +1,138 @@
+#include "ClusterStatistics.h"
+
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+#include "Initializer/LTS.h"
+#include "Initializer/tree/LTSTree.hpp"
+#include "Initializer/typedefs.hpp"
+#include "Parallel/MPI.h"
+#include <utils/env.h>
+#include <utils/logger.h>
+
+namespace {
+constexpr const char* Header = "cluster,layer,time_step_width,cells,cells_with_derivatives,derivative_faces,"
+                               "regular,free_surface,free_surface_gravity,dynamic_rupture,dirichlet,outflow,periodic,"
+                               "analytical,dr_faces,ghost_cells,regions,plasticity";
+} // namespace
+
+std::vector<seissol::initializers::time_stepping::ClusterLayerStatistics>
+    seissol::initializers::time_stepping::collectClusterStatistics(TimeStepping const& timeStepping,
+                                                                   MeshStructure const* meshStructure,
+                                                                   LTSTree& ltsTree,
+                                                                   LTS& lts,
+                                                                   LTSTree& dynRupTree,
+                                                                   bool usePlasticity) {
+  std::vector<ClusterLayerStatistics> statistics;
+  for (unsigned tc = 0; tc < timeStepping.numberOfLocalClusters; ++tc) {
+    for (const bool copy : {false, true}) {
+      Layer& layer = copy ? ltsTree.child(tc).child<Copy>() : ltsTree.child(tc).child<Interior>();
+      Layer& dynRupLayer = copy ? dynRupTree.child(tc).child<Copy>() : dynRupTree.child(tc).child<Interior>();
+      CellLocalInformation const* cellInformation = layer.var(lts.cellInformation);
+
+      ClusterLayerStatistics entry;
+      entry.globalClusterId = timeStepping.clusterIds[tc];
+      entry.copy = copy;
+      entry.timeStepWidth = timeStepping.globalCflTimeStepWidths[timeStepping.clusterIds[tc]];
+      entry.numberOfCells = layer.getNumberOfCells();
+      for (unsigned cell = 0; cell < layer.getNumberOfCells(); ++cell) {
+        const unsigned short ltsSetup = cellInformation[cell].ltsSetup;
+        entry.numberOfCellsWithDerivatives += (ltsSetup >> 9) % 2;
+        for (unsigned face = 0; face < 4; ++face) {
+          const FaceType faceType = cellInformation[cell].faceTypes[face];
+          ++entry.numberOfFaces[static_cast<unsigned>(faceType)];
+          if (faceType != FaceType::outflow && faceType != FaceType::dynamicRupture) {
+            entry.numberOfDerivativeFaces += (ltsSetup >> face) % 2;
+          }
+        }
+      }
+      entry.numberOfDynamicRuptureFaces = dynRupLayer.getNumberOfCells();
+      if (copy) {
+        entry.numberOfGhostCells = meshStructure[tc].numberOfGhostCells;
+        entry.numberOfRegions = meshStructure[tc].numberOfRegions;
+      }
+      entry.plasticity = usePlasticity;
+      statistics.push_back(entry);
+    }
+  }
+  return statistics;
+}
+
+std::string seissol::initializers::time_stepping::formatClusterStatistics(
+    std::vector<ClusterLayerStatistics> const& statistics) {
+  std::ostringstream stream;
+  stream.precision(17);
+  stream << Header << '\n';
+  for (const auto& entry : statistics) {
+    stream << entry.globalClusterId << ',' << (entry.copy ? "copy" : "interior") << ',' << entry.timeStepWidth << ','
+           << entry.numberOfCells << ',' << entry.numberOfCellsWithDerivatives << ',' << entry.numberOfDerivativeFaces;
+    for (const unsigned faces : entry.numberOfFaces) {
+      stream << ',' << faces;
+    }
+    stream << ',' << entry.numberOfDynamicRuptureFaces << ',' << entry.numberOfGhostCells << ','
+           << entry.numberOfRegions << ',' << (entry.plasticity ? 1 : 0) << '\n';
+  }
+  return stream.str();
+}
+
+std::vector<seissol::initializers::time_stepping::ClusterLayerStatistics>
+    seissol::initializers::time_stepping::parseClusterStatistics(std::istream& stream) {
+  std::string line;
+  if (!std::getline(stream, line) || line != Header) {
+    throw std::runtime_error("No cluster statistics (the header does not match)");
+  }
+
+  std::vector<ClusterLayerStatistics> statistics;
+  unsigned lineNumber = 1;
+  while (std::getline(stream, line)) {
+    ++lineNumber;
+    if (line.empty()) {
+      continue;
+    }
+    std::istringstream fields(line);
+    std::string layer;
+    ClusterLayerStatistics entry;
+    unsigned plasticity = 0;
+    char separator = 0;
+    bool valid = static_cast<bool>(fields >> entry.globalClusterId >> separator) && separator == ',' &&
+                 static_cast<bool>(std::getline(fields, layer, ',')) && (layer == "interior" || layer == "copy") &&
+                 static_cast<bool>(fields >> entry.timeStepWidth >> separator >> entry.numberOfCells >> separator >>
+                                   entry.numberOfCellsWithDerivatives >> separator >> entry.numberOfDerivativeFaces);
+    for (unsigned& faces : entry.numberOfFaces) {
+      valid = valid && static_cast<bool>(fields >> separator >> faces);
+    }
+    valid = valid && static_cast<bool>(fields >> separator >> entry.numberOfDynamicRuptureFaces >> separator >>
+                                       entry.numberOfGhostCells >> separator >> entry.numberOfRegions >> separator >>
+                                       plasticity);
+    if (!valid) {
+      throw std::runtime_error("Invalid cluster statistics in line " + std::to_string(lineNumber));
+    }
+    entry.copy = layer == "copy";
+    entry.plasticity = plasticity != 0;
+    statistics.push_back(entry);
+  }
+  return statistics;
+}
+
+void seissol::initializers::time_stepping::writeClusterStatistics(TimeStepping const& timeStepping,
+                                                                  MeshStructure const* meshStructure,
+                                                                  LTSTree& ltsTree,
+                                                                  LTS& lts,
+                                                                  LTSTree& dynRupTree,
+                                                                  bool usePlasticity) {
+  const auto prefix = utils::Env::get<std::string>("SEISSOL_CLUSTER_STATISTICS_PREFIX", "");
+  if (prefix.empty()) {
+    return;
+  }
+  const int rank = seissol::MPI::mpi.rank();
+  const std::string fileName = prefix + "." + std::to_string(rank) + ".csv";
+  std::ofstream file(fileName);
+  file << formatClusterStatistics(
+      collectClusterStatistics(timeStepping, meshStructure, ltsTree, lts, dynRupTree, usePlasticity));
+  if (!file) {
+    logWarning(rank) << "Could not write the cluster statistics to" << fileName;
+  } else {
+    logInfo(rank) << "Wrote the cluster statistics to" << prefix + ".*.csv";
+  }
+}
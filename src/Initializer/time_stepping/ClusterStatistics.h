@@ -0,0 +1,66 @@
+#ifndef SEISSOL_INITIALIZER_TIMESTEPPING_CLUSTERSTATISTICS_H
+#define SEISSOL_INITIALIZER_TIMESTEPPING_CLUSTERSTATISTICS_H
+
+#include <array>
+#include <istream>
+#include <string>
+#include <vector>
+
+#include "Initializer/BasicTypedefs.hpp"
+
+namespace seissol::initializers {
+class LTSTree;
+struct LTS;
+} // namespace seissol::initializers
+
+struct MeshStructure;
+struct TimeStepping;
+
+namespace seissol::initializers::time_stepping {
+
+constexpr unsigned NumberOfFaceTypes = static_cast<unsigned>(FaceType::analytical) + 1;
+
+//! Composition of a layer (interior or copy) of a time cluster of a rank
+struct ClusterLayerStatistics {
+  unsigned globalClusterId = 0;
+  bool copy = false;
+  double timeStepWidth = 0.0;
+  unsigned numberOfCells = 0;
+  //! Cells which store their time derivatives for neighbors in faster clusters
+  unsigned numberOfCellsWithDerivatives = 0;
+  //! Faces whose neighbor data is integrated in time from derivatives
+  unsigned numberOfDerivativeFaces = 0;
+  //! Number of faces per FaceType
+  std::array<unsigned, NumberOfFaceTypes> numberOfFaces{};
+  unsigned numberOfDynamicRuptureFaces = 0;
+  //! Ghost cells and communication regions of the cluster (copy layer only)
+  unsigned numberOfGhostCells = 0;
+  unsigned numberOfRegions = 0;
+  bool plasticity = false;
+};
+
+std::vector<ClusterLayerStatistics> collectClusterStatistics(TimeStepping const& timeStepping,
+                                                             MeshStructure const* meshStructure,
+                                                             LTSTree& ltsTree,
+                                                             LTS& lts,
+                                                             LTSTree& dynRupTree,
+                                                             bool usePlasticity);
+
+std::string formatClusterStatistics(std::vector<ClusterLayerStatistics> const& statistics);
+
+//! Throws std::runtime_error if the input is no cluster statistics file.
+std::vector<ClusterLayerStatistics> parseClusterStatistics(std::istream& stream);
+
+/**
+ * Writes the statistics of the clusters of this rank to <prefix>.<rank>.csv, if
+ * SEISSOL_CLUSTER_STATISTICS_PREFIX is set. The proxy replays the clusters from this file (kernel lts).
+ **/
+void writeClusterStatistics(TimeStepping const& timeStepping,
+                            MeshStructure const* meshStructure,
+                            LTSTree& ltsTree,
+                            LTS& lts,
+                            LTSTree& dynRupTree,
+                            bool usePlasticity);
+} // namespace seissol::initializers::time_stepping
+
+#endif // SEISSOL_INITIALIZER_TIMESTEPPING_CLUSTERSTATISTICS_H
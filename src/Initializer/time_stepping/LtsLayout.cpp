@@ -43,12 +43,22 @@
 #include "Parallel/MPI.h"
 
 #include "utils/logger.h"
+#include "Monitoring/Stopwatch.h"
 
 #include "LtsLayout.h"
 #include "MultiRate.hpp"
+#include <utils/env.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <iterator>
+#include <limits>
+#include <numeric>
+#include <string>
+#include <vector>
 
 seissol::initializers::time_stepping::LtsLayout::LtsLayout():
+ m_vertices(                 NULL ),
  m_cellTimeStepWidths(       NULL ),
  m_cellClusterIds(           NULL ),
  m_globalTimeStepWidths(     NULL ),
@@ -77,6 +87,7 @@ void seissol::initializers::time_stepping::LtsLayout::setMesh( const MeshReader
   // TODO: remove the copy by a pointer once the mesh stays constant
   m_cells = i_mesh.getElements();
   m_fault = i_mesh.getFault();
+  m_vertices = &i_mesh.getVertices();
 
   m_cellTimeStepWidths = new double[       m_cells.size() ];
   m_cellClusterIds     = new unsigned int[ m_cells.size() ];
@@ -522,60 +533,83 @@ unsigned int seissol::initializers::time_stepping::LtsLayout::enforceMaximumDiff
   // get up-to-date cluster ids of the ghost layer before starting
   synchronizePlainGhostClusterIds();
 
-  // number of reductions per iteration
-  unsigned int l_numberOfReductions      = 1;
-
-  // total number of reductions
-  unsigned int l_totalNumberOfReductions = 0;
-
-  while( l_numberOfReductions != 0 ) {
-    l_numberOfReductions = 0;
-
-    // iterate over mesh
-    for( unsigned int l_cell = 0; l_cell < m_cells.size(); l_cell++ ) {
-      unsigned int l_minimumNeighborId = std::numeric_limits<unsigned int>::max();
-
-      // get the ids
-      for( unsigned int l_face = 0; l_face < 4; l_face++ ) {
-        FaceType l_faceType = getFaceType( m_cells[l_cell].boundaries[l_face] );
-        if (l_faceType == FaceType::regular ||
+  /*
+   * The normalized ids are the largest ids which do not exceed the current ones and differ from the ids of all face
+   * neighbors by at most i_difference, i.e. the shortest distances from the (fixed) ghost ids and the current ids
+   * with edge weight i_difference. Instead of sweeping over the mesh until nothing changes, we compute them in one
+   * pass with a bucket queue over the cluster ids (Dial's algorithm).
+   */
+  auto const isNeighbor = [&]( unsigned int i_cell, unsigned int i_face ) {
+    FaceType l_faceType = getFaceType( m_cells[i_cell].boundaries[i_face] );
+    return l_faceType == FaceType::regular ||
            l_faceType == FaceType::periodic ||
-           l_faceType == FaceType::dynamicRupture) {
-          // neighbor cell is part of copy layer/interior
-          if( m_cells[l_cell].neighborRanks[l_face] == rank ) {
-            unsigned int l_neighborId = m_cells[l_cell].neighbors[l_face];
-            l_minimumNeighborId = std::min( l_minimumNeighborId, m_cellClusterIds[l_neighborId] );
-          }
-          // cell is part of the ghost layer
-          else {
-            // derive id of the ghost region
-            unsigned int l_region = getPlainRegion( m_cells[l_cell].neighborRanks[l_face] );
-
-            // local id in the ghost region
-            unsigned int l_localGhostCell = m_cells[l_cell].mpiIndices[l_face];
+           l_faceType == FaceType::dynamicRupture;
+  };
+
+  // seeds: own ids, lowered by the ghost neighbors
+  std::vector<unsigned int> l_seedIds( m_cells.size() );
+  unsigned int l_maximumId = 0;
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static) reduction(max: l_maximumId)
+#endif
+  for( unsigned int l_cell = 0; l_cell < m_cells.size(); l_cell++ ) {
+    unsigned int l_id = m_cellClusterIds[l_cell];
+    for( unsigned int l_face = 0; l_face < 4; l_face++ ) {
+      if( isNeighbor( l_cell, l_face ) && m_cells[l_cell].neighborRanks[l_face] != rank ) {
+        unsigned int l_region = getPlainRegion( m_cells[l_cell].neighborRanks[l_face] );
+        unsigned int l_localGhostCell = m_cells[l_cell].mpiIndices[l_face];
+        assert( l_localGhostCell < m_numberOfPlainGhostCells[l_region] );
+        l_id = std::min( l_id, m_plainGhostCellClusterIds[l_region][l_localGhostCell] + i_difference );
+      }
+    }
+    l_seedIds[l_cell] = l_id;
+    l_maximumId = std::max( l_maximumId, l_id );
+  }
 
-            assert( l_localGhostCell < m_numberOfPlainGhostCells[l_region] );
+  std::vector< std::vector<unsigned int> > l_buckets( l_maximumId + 1 );
+  for( unsigned int l_cell = 0; l_cell < m_cells.size(); l_cell++ ) {
+    l_buckets[ l_seedIds[l_cell] ].push_back( l_cell );
+  }
 
-            l_minimumNeighborId = std::min( l_minimumNeighborId, m_plainGhostCellClusterIds[l_region][l_localGhostCell] );
+  // ids only decrease, hence every bucket is final once it is reached; with i_difference = 0 it grows while being processed
+  for( unsigned int l_id = 0; l_id < l_buckets.size(); l_id++ ) {
+    for( std::size_t l_entry = 0; l_entry < l_buckets[l_id].size(); l_entry++ ) {
+      unsigned int l_cell = l_buckets[l_id][l_entry];
+      if( l_seedIds[l_cell] != l_id ) {
+        // outdated entry, the cell was lowered after it was queued
+        continue;
+      }
+      unsigned int l_neighborBound = l_id + i_difference;
+      if( l_neighborBound >= l_buckets.size() ) {
+        continue;
+      }
+      for( unsigned int l_face = 0; l_face < 4; l_face++ ) {
+        if( isNeighbor( l_cell, l_face ) && m_cells[l_cell].neighborRanks[l_face] == rank ) {
+          unsigned int l_neighborId = m_cells[l_cell].neighbors[l_face];
+          if( l_seedIds[l_neighborId] > l_neighborBound ) {
+            l_seedIds[l_neighborId] = l_neighborBound;
+            l_buckets[l_neighborBound].push_back( l_neighborId );
           }
         }
       }
-
-      // assert we have a face neighbor
-      assert( l_minimumNeighborId != std::numeric_limits<unsigned int>::max() );
-
-      // lower id of the cell if required
-      if( m_cellClusterIds[l_cell] > l_minimumNeighborId + i_difference ) {
-        m_cellClusterIds[l_cell] = l_minimumNeighborId + i_difference;
-        l_numberOfReductions++;
-      }
-
     }
+    // release the memory of processed buckets
+    std::vector<unsigned int>().swap( l_buckets[l_id] );
+  }
 
-    l_totalNumberOfReductions += l_numberOfReductions;
+  // number of lowered cells
+  unsigned int l_numberOfReductions = 0;
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static) reduction(+: l_numberOfReductions)
+#endif
+  for( unsigned int l_cell = 0; l_cell < m_cells.size(); l_cell++ ) {
+    if( l_seedIds[l_cell] != m_cellClusterIds[l_cell] ) {
+      m_cellClusterIds[l_cell] = l_seedIds[l_cell];
+      l_numberOfReductions++;
+    }
   }
 
-  return l_totalNumberOfReductions;
+  return l_numberOfReductions;
 }
 
 unsigned int seissol::initializers::time_stepping::LtsLayout::enforceSingleBuffer() {
@@ -600,9 +634,13 @@ void seissol::initializers::time_stepping::LtsLayout::normalizeClustering() {
   unsigned int l_totalSingleBuffer      = 0;
 
   int l_globalContinue = 1;
+  unsigned int l_numberOfRounds = 0;
 
   // continue until all ranks converged to a normalized mesh
+  // (each round normalizes the local cells completely, i.e. further rounds are only required across partitions)
   while( l_globalContinue ) {
+    l_numberOfRounds++;
+
     // get up-to-date cluster ids of the ghost layer before starting
     synchronizePlainGhostClusterIds();
 
@@ -635,6 +673,12 @@ void seissol::initializers::time_stepping::LtsLayout::normalizeClustering() {
 #endif
   }
 
+  logInfo(rank) << "Normalized the clustering in" << l_numberOfRounds << "rounds.";
+
+  if( m_clusteringStrategy == multiRate ) {
+    mergeClusters();
+  }
+
   //logInfo() << "Performed a total of" << l_totalMaximumDifference << "reductions (max. diff.) for" << m_cells.size() << "cells," << l_totalDynamicRupture << "reductions (dyn. rup.) for" << m_fault.size() << "faces.";
   
   int* localClusterHistogram = new int[m_numberOfGlobalClusters];
@@ -659,13 +703,158 @@ void seissol::initializers::time_stepping::LtsLayout::normalizeClustering() {
     for (unsigned cluster = 0; cluster < m_numberOfGlobalClusters; ++cluster) {
       logInfo(rank) << utils::nospace << cluster << ":" << utils::space << globalClusterHistogram[cluster];
     }
+  }
+  reportSlivers( globalClusterHistogram );
 #ifdef USE_MPI
+  if (rank == 0) {
     delete[] globalClusterHistogram;
-#endif
   }
+#endif
   delete[] localClusterHistogram;
 }
 
+void seissol::initializers::time_stepping::LtsLayout::reportSlivers( const int *i_globalClusterHistogram ) {
+  const int rank = seissol::MPI::mpi.rank();
+
+  if( rank == 0 && m_numberOfGlobalClusters > 1 ) {
+    const std::vector<double> l_clusterSizes( i_globalClusterHistogram, i_globalClusterHistogram + m_numberOfGlobalClusters );
+    const double l_numberOfCells = std::accumulate( l_clusterSizes.begin(), l_clusterSizes.end(), 0.0 );
+    logInfo(rank) << "Cluster 0 holds" << 100.0 * l_clusterSizes[0] / l_numberOfCells << "% of the cells;"
+                  << "with the time step width of cluster 1, the cell updates would drop by a factor of"
+                  << MultiRate::fastestClusterSpeedup( l_clusterSizes, m_globalTimeStepRates ) << ".";
+  }
+
+  const unsigned int l_numberOfReported = utils::Env::get<unsigned int>("SEISSOL_LTS_SLIVER_REPORT", 0);
+  if( l_numberOfReported == 0 ) {
+    return;
+  }
+
+  // per cell: time step width, barycenter, rank and local id; padded with infinite time step widths
+  constexpr unsigned int l_entries = 6;
+  std::vector<unsigned int> l_cells( m_cells.size() );
+  std::iota( l_cells.begin(), l_cells.end(), 0 );
+  const unsigned int l_numberOfLocal = std::min<std::size_t>( l_numberOfReported, m_cells.size() );
+  std::partial_sort( l_cells.begin(), l_cells.begin() + l_numberOfLocal, l_cells.end(), [&](unsigned int a, unsigned int b) {
+    return m_cellTimeStepWidths[a] < m_cellTimeStepWidths[b];
+  });
+
+  std::vector<double> l_local( l_entries * l_numberOfReported, std::numeric_limits<double>::infinity() );
+  for( unsigned int l_index = 0; l_index < l_numberOfLocal; l_index++ ) {
+    const Element &l_element = m_cells[ l_cells[l_index] ];
+    double *l_entry = &l_local[ l_entries * l_index ];
+    l_entry[0] = m_cellTimeStepWidths[ l_cells[l_index] ];
+    for( unsigned int l_dim = 0; l_dim < 3; l_dim++ ) {
+      l_entry[1+l_dim] = 0.0;
+      for( unsigned int l_vertex = 0; l_vertex < 4; l_vertex++ ) {
+        l_entry[1+l_dim] += 0.25 * (*m_vertices)[ l_element.vertices[l_vertex] ].coords[l_dim];
+      }
+    }
+    l_entry[4] = rank;
+    l_entry[5] = l_cells[l_index];
+  }
+
+  std::vector<double> l_global;
+#ifdef USE_MPI
+  if( rank == 0 ) {
+    l_global.resize( l_local.size() * seissol::MPI::mpi.size() );
+  }
+  MPI_Gather( l_local.data(), l_local.size(), MPI_DOUBLE, l_global.data(), l_local.size(), MPI_DOUBLE, 0, seissol::MPI::mpi.comm() );
+#else
+  l_global = l_local;
+#endif
+  if( rank != 0 ) {
+    return;
+  }
+
+  std::vector<unsigned int> l_order( l_global.size() / l_entries );
+  std::iota( l_order.begin(), l_order.end(), 0 );
+  std::sort( l_order.begin(), l_order.end(), [&](unsigned int a, unsigned int b) {
+    return l_global[l_entries * a] < l_global[l_entries * b];
+  });
+
+  logInfo(rank) << "Cells with the smallest time step widths (time step width, barycenter, rank, local id):";
+  for( unsigned int l_index = 0; l_index < std::min<std::size_t>( l_numberOfReported, l_order.size() ); l_index++ ) {
+    const double *l_entry = &l_global[ l_entries * l_order[l_index] ];
+    if( l_entry[0] == std::numeric_limits<double>::infinity() ) {
+      break;
+    }
+    logInfo(rank) << l_entry[0] << "(" << l_entry[1] << l_entry[2] << l_entry[3] << ")"
+                  << static_cast<int>(l_entry[4]) << static_cast<unsigned int>(l_entry[5]);
+  }
+}
+
+void seissol::initializers::time_stepping::LtsLayout::mergeClusters() {
+  if( utils::Env::get<int>("SEISSOL_LTS_AUTO_MERGE", 0) == 0 || m_numberOfGlobalClusters < 2 ) {
+    return;
+  }
+  const int rank = seissol::MPI::mpi.rank();
+  const double overhead = utils::Env::get<double>("SEISSOL_LTS_AUTO_MERGE_OVERHEAD", 0.0);
+  if( overhead <= 0.0 ) {
+    logWarning(rank) << "SEISSOL_LTS_AUTO_MERGE requires a positive SEISSOL_LTS_AUTO_MERGE_OVERHEAD"
+                     << "(see the regression analysis of the compute kernels); not merging any clusters.";
+    return;
+  }
+
+  std::vector<double> localClusterSizes( m_numberOfGlobalClusters, 0.0 );
+  for( unsigned int l_cell = 0; l_cell < m_cells.size(); l_cell++ ) {
+    localClusterSizes[ m_cellClusterIds[l_cell] ] += 1.0;
+  }
+
+  // updates of each cluster during one update of the cluster with the largest time step
+  std::vector<double> updates( m_numberOfGlobalClusters, 1.0 );
+  for( int l_cluster = static_cast<int>(m_numberOfGlobalClusters) - 2; l_cluster >= 0; l_cluster-- ) {
+    updates[l_cluster] = updates[l_cluster+1] * m_globalTimeStepRates[l_cluster];
+  }
+
+  // expected cost of this rank if all clusters above l_maxCluster are merged into l_maxCluster
+  std::vector<double> costs( m_numberOfGlobalClusters, 0.0 );
+  for( unsigned int l_maxCluster = 0; l_maxCluster < m_numberOfGlobalClusters; l_maxCluster++ ) {
+    double l_mergedCells = 0.0;
+    for( unsigned int l_cluster = 0; l_cluster < m_numberOfGlobalClusters; l_cluster++ ) {
+      if( l_cluster < l_maxCluster ) {
+        costs[l_maxCluster] += updates[l_cluster] * localClusterSizes[l_cluster];
+        costs[l_maxCluster] += (localClusterSizes[l_cluster] > 0.0) ? updates[l_cluster] * overhead : 0.0;
+      } else {
+        l_mergedCells += localClusterSizes[l_cluster];
+      }
+    }
+    costs[l_maxCluster] += updates[l_maxCluster] * l_mergedCells;
+    costs[l_maxCluster] += (l_mergedCells > 0.0) ? updates[l_maxCluster] * overhead : 0.0;
+  }
+
+#ifdef USE_MPI
+  // the slowest rank determines the wall time
+  MPI_Allreduce( MPI_IN_PLACE, costs.data(), costs.size(), MPI_DOUBLE, MPI_MAX, seissol::MPI::mpi.comm() );
+#endif
+
+  unsigned int l_bestMaxCluster = m_numberOfGlobalClusters - 1;
+  for( int l_maxCluster = static_cast<int>(m_numberOfGlobalClusters) - 2; l_maxCluster >= 0; l_maxCluster-- ) {
+    if( costs[l_maxCluster] < costs[l_bestMaxCluster] ) {
+      l_bestMaxCluster = l_maxCluster;
+    }
+  }
+
+  if( l_bestMaxCluster == m_numberOfGlobalClusters - 1 ) {
+    logInfo(rank) << "Merging time clusters does not lower the expected wall time; keeping all"
+                  << m_numberOfGlobalClusters << "clusters.";
+    return;
+  }
+
+  logInfo(rank) << "Merging time clusters" << l_bestMaxCluster << "to" << m_numberOfGlobalClusters - 1
+                << "into cluster" << l_bestMaxCluster << "(predicted speedup:"
+                << costs[m_numberOfGlobalClusters - 1] / costs[l_bestMaxCluster] << ").";
+
+  for( unsigned int l_cell = 0; l_cell < m_cells.size(); l_cell++ ) {
+    m_cellClusterIds[l_cell] = std::min( m_cellClusterIds[l_cell], l_bestMaxCluster );
+  }
+  m_numberOfGlobalClusters = l_bestMaxCluster + 1;
+  // last cluster has a rate of 1 (resets buffers in every time step)
+  m_globalTimeStepRates[m_numberOfGlobalClusters - 1] = 1;
+
+  // the cluster ids of the ghost layer changed as well
+  synchronizePlainGhostClusterIds();
+}
+
 void seissol::initializers::time_stepping::LtsLayout::getTheoreticalSpeedup( double &o_perCellTimeStepWidths,
                                                                              double &o_clustering  ) {
   // use khan sum
@@ -690,14 +879,15 @@ void seissol::initializers::time_stepping::LtsLayout::getTheoreticalSpeedup( dou
     l_localClusteringSpeedup[0] = l_t;
   }
 
-  unsigned int l_localNumberOfCells = m_cells.size();
-  unsigned int l_globalNumberOfCells = 0;
+  // the global number of cells may exceed 32 bit
+  unsigned long l_localNumberOfCells = m_cells.size();
+  unsigned long l_globalNumberOfCells = 0;
 
   // derive global number of cells
 #ifdef USE_MPI
   // TODO please check if this ifdef is correct
 
-  MPI_Allreduce( &l_localNumberOfCells, &l_globalNumberOfCells, 1, MPI_UNSIGNED, MPI_SUM, seissol::MPI::mpi.comm() );
+  MPI_Allreduce( &l_localNumberOfCells, &l_globalNumberOfCells, 1, MPI_UNSIGNED_LONG, MPI_SUM, seissol::MPI::mpi.comm() );
 #else // USE_MPI
   l_globalNumberOfCells = l_localNumberOfCells;
 #endif // USE_MPI
@@ -895,6 +1085,24 @@ void seissol::initializers::time_stepping::LtsLayout::deriveClusteredCopyInterio
     }
   }
 
+  // store the positions of the interior cells for the neighbor search
+  m_clusteredInteriorPositions.assign( m_cells.size(), std::numeric_limits<unsigned int>::max() );
+  for( unsigned int l_cluster = 0; l_cluster < m_localClusters.size(); l_cluster++ ) {
+    for( unsigned int l_interiorCell = 0; l_interiorCell < m_clusteredInterior[l_cluster].size(); l_interiorCell++ ) {
+      m_clusteredInteriorPositions[ m_clusteredInterior[l_cluster][l_interiorCell] ] = l_interiorCell;
+    }
+  }
+
+  /*
+   * Optionally reorder the interior for the locality of the neighbor accesses.
+   */
+  const std::string l_cellOrdering = utils::Env::get<std::string>( "SEISSOL_CELL_ORDERING", "mesh" );
+  if( l_cellOrdering == "rcm" ) {
+    reorderClusteredInterior();
+  } else if( l_cellOrdering != "mesh" ) {
+    logError() << "Unknown cell ordering" << l_cellOrdering << "(SEISSOL_CELL_ORDERING), expected mesh or rcm.";
+  }
+
   /*
    * Sort GTS regions: DR and "GTS on der" comes first.
    */
@@ -953,6 +1161,109 @@ void seissol::initializers::time_stepping::LtsLayout::deriveClusteredCopyInterio
   }
 }
 
+double seissol::initializers::time_stepping::LtsLayout::getClusteredInteriorNeighborDistance() {
+  const int rank = seissol::MPI::mpi.rank();
+
+  double l_distance = 0;
+  unsigned long l_numberOfPairs = 0;
+  for( unsigned int l_cluster = 0; l_cluster < m_localClusters.size(); l_cluster++ ) {
+    for( unsigned int l_interiorCell = 0; l_interiorCell < m_clusteredInterior[l_cluster].size(); l_interiorCell++ ) {
+      const Element &l_element = m_cells[ m_clusteredInterior[l_cluster][l_interiorCell] ];
+      for( unsigned int l_face = 0; l_face < 4; l_face++ ) {
+        const FaceType l_faceType = getFaceType( l_element.boundaries[l_face] );
+        if( l_faceType != FaceType::regular && l_faceType != FaceType::periodic && l_faceType != FaceType::dynamicRupture ) continue;
+
+        const unsigned int l_neighbor = l_element.neighbors[l_face];
+        if( l_element.neighborRanks[l_face] != rank || m_cellClusterIds[l_neighbor] != m_localClusters[l_cluster] ) continue;
+
+        const unsigned int l_neighborPosition = m_clusteredInteriorPositions[l_neighbor];
+        if( l_neighborPosition == std::numeric_limits<unsigned int>::max() ) continue;
+
+        l_distance += std::abs( static_cast<double>(l_neighborPosition) - static_cast<double>(l_interiorCell) );
+        l_numberOfPairs++;
+      }
+    }
+  }
+
+  return (l_numberOfPairs > 0) ? l_distance / l_numberOfPairs : 0;
+}
+
+void seissol::initializers::time_stepping::LtsLayout::reorderClusteredInterior() {
+  const int rank = seissol::MPI::mpi.rank();
+
+  const double l_distanceBefore = getClusteredInteriorNeighborDistance();
+
+  for( unsigned int l_cluster = 0; l_cluster < m_localClusters.size(); l_cluster++ ) {
+    std::vector< clusterCell > &l_interior = m_clusteredInterior[l_cluster];
+    const unsigned int l_numberOfCells = l_interior.size();
+
+    // face neighbors in the same interior cluster (local positions)
+    std::vector< std::array<unsigned int, 4> > l_neighbors( l_numberOfCells );
+    std::vector< unsigned int > l_degrees( l_numberOfCells, 0 );
+    for( unsigned int l_interiorCell = 0; l_interiorCell < l_numberOfCells; l_interiorCell++ ) {
+      const Element &l_element = m_cells[ l_interior[l_interiorCell] ];
+      for( unsigned int l_face = 0; l_face < 4; l_face++ ) {
+        const FaceType l_faceType = getFaceType( l_element.boundaries[l_face] );
+        if( l_faceType != FaceType::regular && l_faceType != FaceType::periodic && l_faceType != FaceType::dynamicRupture ) continue;
+
+        const unsigned int l_neighbor = l_element.neighbors[l_face];
+        if( l_element.neighborRanks[l_face] != rank || m_cellClusterIds[l_neighbor] != m_localClusters[l_cluster] ) continue;
+
+        const unsigned int l_neighborPosition = m_clusteredInteriorPositions[l_neighbor];
+        if( l_neighborPosition == std::numeric_limits<unsigned int>::max() ) continue;
+
+        l_neighbors[l_interiorCell][ l_degrees[l_interiorCell]++ ] = l_neighborPosition;
+      }
+    }
+
+    // Cuthill-McKee: breadth-first search starting at a cell of minimal degree in every connected component,
+    // neighbors are visited in the order of increasing degree
+    std::vector< unsigned int > l_startCells( l_numberOfCells );
+    std::iota( l_startCells.begin(), l_startCells.end(), 0 );
+    std::stable_sort( l_startCells.begin(), l_startCells.end(), [&]( unsigned int a, unsigned int b ) {
+      return l_degrees[a] < l_degrees[b];
+    } );
+
+    std::vector< unsigned int > l_order;
+    l_order.reserve( l_numberOfCells );
+    std::vector< bool > l_visited( l_numberOfCells, false );
+    for( unsigned int l_start : l_startCells ) {
+      if( l_visited[l_start] ) continue;
+      l_visited[l_start] = true;
+      std::size_t l_next = l_order.size();
+      l_order.push_back( l_start );
+
+      for( ; l_next < l_order.size(); l_next++ ) {
+        const unsigned int l_current = l_order[l_next];
+        std::sort( l_neighbors[l_current].begin(), l_neighbors[l_current].begin() + l_degrees[l_current], [&]( unsigned int a, unsigned int b ) {
+          return l_degrees[a] < l_degrees[b];
+        } );
+        for( unsigned int l_neighbor = 0; l_neighbor < l_degrees[l_current]; l_neighbor++ ) {
+          const unsigned int l_candidate = l_neighbors[l_current][l_neighbor];
+          if( !l_visited[l_candidate] ) {
+            l_visited[l_candidate] = true;
+            l_order.push_back( l_candidate );
+          }
+        }
+      }
+    }
+    assert( l_order.size() == l_numberOfCells );
+
+    // reverse the order and update the positions
+    std::vector< clusterCell > l_reordered( l_numberOfCells );
+    for( unsigned int l_interiorCell = 0; l_interiorCell < l_numberOfCells; l_interiorCell++ ) {
+      l_reordered[l_interiorCell] = l_interior[ l_order[l_numberOfCells - 1 - l_interiorCell] ];
+    }
+    l_interior.swap( l_reordered );
+    for( unsigned int l_interiorCell = 0; l_interiorCell < l_numberOfCells; l_interiorCell++ ) {
+      m_clusteredInteriorPositions[ l_interior[l_interiorCell] ] = l_interiorCell;
+    }
+  }
+
+  logInfo(rank) << "Reordered the interior cells (reverse Cuthill-McKee), average distance of face neighbors:"
+                << l_distanceBefore << "->" << getClusteredInteriorNeighborDistance();
+}
+
 void seissol::initializers::time_stepping::LtsLayout::deriveClusteredGhost() {
   /*
    * Get sizes of the ghost regions
@@ -1155,6 +1466,10 @@ void seissol::initializers::time_stepping::LtsLayout::deriveLayout( enum TimeClu
 
   m_clusteringStrategy = i_timeClustering;
 
+  // every phase is timed (collectively), the slowest rank determines the setup time
+  seissol::Stopwatch l_watch;
+  l_watch.start();
+
   // derive time stepping clusters and per-cell cluster ids (w/o normalizations)
   if( m_clusteringStrategy == single ) {
     MultiRate::deriveClusterIds( m_cells.size(),
@@ -1174,18 +1489,38 @@ void seissol::initializers::time_stepping::LtsLayout::deriveLayout( enum TimeClu
                                  m_globalTimeStepWidths,
                                  m_globalTimeStepRates );
   }
+  l_watch.pause();
+  l_watch.printTime("LTS layout: cluster ids derived in:");
+  l_watch.reset();
+  l_watch.start();
 
   // derive plain copy and the interior
   derivePlainCopyInterior();
+  l_watch.pause();
+  l_watch.printTime("LTS layout: plain copy layer and interior derived in:");
+  l_watch.reset();
+  l_watch.start();
 
   // derive plain ghost regions
   derivePlainGhost();
+  l_watch.pause();
+  l_watch.printTime("LTS layout: plain ghost layer derived in:");
+  l_watch.reset();
+  l_watch.start();
 
   // normalize mpi indices
   normalizeMpiIndices();
+  l_watch.pause();
+  l_watch.printTime("LTS layout: MPI indices normalized in:");
+  l_watch.reset();
+  l_watch.start();
 
   // normalize clustering
   normalizeClustering();
+  l_watch.pause();
+  l_watch.printTime("LTS layout: clustering normalized in:");
+  l_watch.reset();
+  l_watch.start();
 
   // get maximum speedups compared to GTS
   double l_perCellSpeedup, l_clusteringSpeedup;
@@ -1197,12 +1532,22 @@ void seissol::initializers::time_stepping::LtsLayout::deriveLayout( enum TimeClu
 
   // derive clustered copy and interior layout
   deriveClusteredCopyInterior();
+  l_watch.pause();
+  l_watch.printTime("LTS layout: clustered copy layer and interior derived in:");
+  l_watch.reset();
+  l_watch.start();
 
   // derive the region sizes of the ghost layer
   deriveClusteredGhost();
+  l_watch.pause();
+  l_watch.printTime("LTS layout: clustered ghost layer derived in:");
+  l_watch.reset();
+  l_watch.start();
   
   // derive dynamic rupture layers
   deriveDynamicRupturePlainCopyInterior();
+  l_watch.pause();
+  l_watch.printTime("LTS layout: dynamic rupture layers derived in:");
 }
 
 void seissol::initializers::time_stepping::LtsLayout::getCrossClusterTimeStepping( struct TimeStepping &o_timeStepping ) {
@@ -73,6 +73,9 @@ class seissol::initializers::time_stepping::LtsLayout {
     //! fault in the local domain
     std::vector<Fault> m_fault;
 
+    //! vertices of the mesh (owned by the mesh reader, only used for diagnostics)
+    const std::vector<Vertex> *m_vertices;
+
     //! time step widths of the cells (cfl)
     double       *m_cellTimeStepWidths;
 
@@ -159,6 +162,11 @@ class seissol::initializers::time_stepping::LtsLayout {
      **/
     std::vector< std::vector< clusterCell > > m_clusteredInterior;
 
+    /**
+     * position of the interior cells in their interior cluster (indexed by mesh id).
+     **/
+    std::vector< unsigned int > m_clusteredInteriorPositions;
+
     /**
      * copy region of a time stepping cluster.
      * first[0]: mpi rank of the neighboring cluster
@@ -289,6 +297,23 @@ class seissol::initializers::time_stepping::LtsLayout {
      **/
     void normalizeClustering();
 
+    /**
+     * Merges the clusters with the largest time steps into a single cluster if this lowers the expected wall time
+     * (SEISSOL_LTS_AUTO_MERGE=1).
+     * The expected wall time of a rank is the number of cell updates plus SEISSOL_LTS_AUTO_MERGE_OVERHEAD cell updates
+     * for each update of a non-empty cluster; the maximum over all ranks is minimized.
+     * Merging keeps the maximum difference of neighboring cluster ids and the clustering of dynamic rupture faces intact.
+     **/
+    void mergeClusters();
+
+    /**
+     * Reports the cost of the fastest cluster, which is often caused by a few sliver cells, and lists the
+     * SEISSOL_LTS_SLIVER_REPORT cells with the smallest time step widths of all ranks.
+     *
+     * @param i_globalClusterHistogram global number of cells of the clusters (only on rank 0).
+     **/
+    void reportSlivers( const int *i_globalClusterHistogram );
+
     /**
      * Gets the maximum possible speedups.
      *
@@ -339,6 +364,17 @@ class seissol::initializers::time_stepping::LtsLayout {
      **/
     void deriveClusteredCopyInterior();
 
+    /**
+     * Reorders the cells of the interior clusters with a reverse Cuthill-McKee ordering of the face neighbor graph,
+     * such that face neighbors are close in memory (SEISSOL_CELL_ORDERING=rcm).
+     **/
+    void reorderClusteredInterior();
+
+    /**
+     * Average distance of the positions of face neighbors in the interior clusters.
+     **/
+    double getClusteredInteriorNeighborDistance();
+
     /**
      * Derives the clustered ghost region (cell ids in then neighboring domain).
      **/
@@ -444,14 +480,11 @@ class seissol::initializers::time_stepping::LtsLayout {
       o_localClusterId = m_cellClusterIds[ i_meshId ];
       o_localClusterId = getLocalClusterId( o_localClusterId );
 
-      std::vector< unsigned int >::iterator l_searchResult = std::lower_bound( m_clusteredInterior[o_localClusterId].begin(), // start of the search
-                                                                               m_clusteredInterior[o_localClusterId].end(),   // end of the search
-                                                                               i_meshId );                                    // value to search for
-      o_localCellId = l_searchResult - m_clusteredInterior[o_localClusterId].begin();
+      o_localCellId = m_clusteredInteriorPositions[ i_meshId ];
 
       // ensure a valid value
-      if( o_localCellId > m_clusteredInterior[o_localClusterId].size() - 1 ||
-          *l_searchResult != i_meshId ) logError() << "no matching neighboring interior cell";
+      if( o_localCellId >= m_clusteredInterior[o_localClusterId].size() ||
+          m_clusteredInterior[o_localClusterId][o_localCellId] != i_meshId ) logError() << "no matching neighboring interior cell";
     }
 
   public:
@@ -497,6 +530,16 @@ class seissol::initializers::time_stepping::LtsLayout {
      **/
     void getCrossClusterTimeStepping( struct TimeStepping &o_timeStepping );
 
+    /**
+     * Gets the global cluster id of a cell.
+     *
+     * @param i_cellId id of the cell in the mesh.
+     * @return global cluster id of the cell.
+     **/
+    unsigned int getGlobalClusterId( unsigned int i_cellId ) const {
+      return m_cellClusterIds[i_cellId];
+    }
+
     /**
      * Initializes the data structures required for computation.
      *
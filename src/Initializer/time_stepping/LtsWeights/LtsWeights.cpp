@@ -38,6 +38,11 @@
  * @section DESCRIPTION
  * 
  **/
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <typeinfo>
+
 #include <Eigen/Eigenvalues>
 #include <Kernels/precision.hpp>
 #include <Initializer/typedefs.hpp>
@@ -48,9 +53,14 @@
 #include "LtsWeights.h"
 
 #include <Initializer/ParameterDB.h>
+#include <Initializer/Hash.h>
+#include <Initializer/time_stepping/CellTimeSteps.h>
+#include <Initializer/time_stepping/MultiRate.hpp>
 #include <Parallel/MPI.h>
 
 #include <generated_code/init.h>
+#include <generated_code/tensor.h>
+#include <yateto.h>
 
 namespace seissol::initializers::time_stepping {
 
@@ -72,6 +82,8 @@ void LtsWeights::computeWeights(PUML::TETPUML const &mesh, double maximumAllowed
   // Note: Return value optimization is guaranteed while returning temp. objects in C++17
   m_mesh = &mesh;
   m_details = collectGlobalTimeStepDetails(maximumAllowedTimeStep);
+  m_details.globalMinTimeStep *= MultiRate::deriveWiggleFactor(
+      m_details.timeSteps.size(), m_details.timeSteps.data(), m_details.globalMinTimeStep, m_rate);
   m_clusterIds = computeClusterIds();
   m_ncon = evaluateNumberOfConstraints();
   auto totalNumberOfReductions = enforceMaximumDifference();
@@ -84,6 +96,10 @@ void LtsWeights::computeWeights(PUML::TETPUML const &mesh, double maximumAllowed
   setVertexWeights();
   setAllowedImbalances();
 
+  if (m_edgeWeightDynamicRupture != 1 || m_communicationEdgeWeights) {
+    m_dualGraph = computeDualGraph();
+  }
+
   logInfo(seissol::MPI::mpi.rank()) << "Computing LTS weights. Done. " << utils::nospace << '('
                                     << totalNumberOfReductions << " reductions.)";
 }
@@ -103,14 +119,29 @@ int LtsWeights::nWeightsPerVertex() const {
   return m_ncon;
 }
 
+uint64_t LtsWeights::hash(uint64_t hash) const {
+  char const* model = typeid(*this).name();
+  hash = hashBytes(model, std::strlen(model), hash);
+  std::ifstream file(m_velocityModel, std::ios::binary);
+  std::string const content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  hash = hashBytes(content.data(), content.size(), hash);
+  hash = hashValue(m_rate, hash);
+  hash = hashValue(MultiRate::minimumWiggleFactor(), hash);
+  hash = hashValue(m_vertexWeightElement, hash);
+  hash = hashValue(m_vertexWeightDynamicRupture, hash);
+  hash = hashValue(m_vertexWeightFreeSurfaceWithGravity, hash);
+  hash = hashValue(m_edgeWeightDynamicRupture, hash);
+  hash = hashValue(m_communicationEdgeWeights, hash);
+  return hashValue(m_usePlasticity, hash);
+}
+
 void LtsWeights::computeMaxTimesteps(std::vector<double> const &pWaveVel,
                                      std::vector<double> &timeSteps, double maximumAllowedTimeStep) {
   std::vector<PUML::TETPUML::cell_t> const &cells = m_mesh->cells();
   std::vector<PUML::TETPUML::vertex_t> const &vertices = m_mesh->vertices();
 
+#pragma omp parallel for schedule(static)
   for (unsigned cell = 0; cell < cells.size(); ++cell) {
-    // Compute insphere radius
-    Eigen::Vector3d barycentre(0., 0., 0.);
     Eigen::Vector3d x[4];
     unsigned vertLids[4];
     PUML::Downward::vertices(*m_mesh, cells[cell], vertLids);
@@ -119,21 +150,9 @@ void LtsWeights::computeMaxTimesteps(std::vector<double> const &pWaveVel,
         x[vtx](d) = vertices[vertLids[vtx]].coordinate()[d];
       }
     }
-    Eigen::Matrix4d A;
-    A << x[0](0), x[0](1), x[0](2), 1.0,
-        x[1](0), x[1](1), x[1](2), 1.0,
-        x[2](0), x[2](1), x[2](2), 1.0,
-        x[3](0), x[3](1), x[3](2), 1.0;
-
-    double alpha = A.determinant();
-    double Nabc = ((x[1] - x[0]).cross(x[2] - x[0])).norm();
-    double Nabd = ((x[1] - x[0]).cross(x[3] - x[0])).norm();
-    double Nacd = ((x[2] - x[0]).cross(x[3] - x[0])).norm();
-    double Nbcd = ((x[2] - x[1]).cross(x[3] - x[1])).norm();
-    double insphere = std::fabs(alpha) / (Nabc + Nabd + Nacd + Nbcd);
-
-    // Compute maximum timestep (CFL=1)
-    timeSteps[cell] = std::fmin(maximumAllowedTimeStep, 2.0 * insphere / (pWaveVel[cell] * (2 * CONVERGENCE_ORDER - 1)));
+    timeSteps[cell] = std::fmin(maximumAllowedTimeStep,
+                                seissol::initializers::time_stepping::cflTimeStep(
+                                    seissol::initializers::time_stepping::insphereRadius(x), pWaveVel[cell]));
   }
 }
 
@@ -377,4 +396,140 @@ int LtsWeights::enforceMaximumDifferenceLocal(int maxDifference) {
 
   return numberOfReductions;
 }
+
+DualGraph LtsWeights::computeDualGraph() {
+  std::vector<PUML::TETPUML::cell_t> const &cells = m_mesh->cells();
+  std::vector<PUML::TETPUML::face_t> const &faces = m_mesh->faces();
+  int const *boundaryCond = m_mesh->cellData(1);
+
+  int64_t numberOfCells = cells.size();
+  int64_t firstCell = 0;
+#ifdef USE_MPI
+  MPI_Exscan(&numberOfCells, &firstCell, 1, MPI_INT64_T, MPI_SUM, seissol::MPI::mpi.comm());
+  if (seissol::MPI::mpi.rank() == 0) {
+    firstCell = 0;
+  }
+#endif // USE_MPI
+
+  int maxClusterId = m_clusterIds.empty() ? 0 : *std::max_element(m_clusterIds.begin(), m_clusterIds.end());
+#ifdef USE_MPI
+  MPI_Allreduce(MPI_IN_PLACE, &maxClusterId, 1, MPI_INT, MPI_MAX, seissol::MPI::mpi.comm());
+#endif // USE_MPI
+
+  // A face is a dynamic rupture face if one of its sides says so, such that the graph stays symmetric
+  auto isDynamicRupture = [&](unsigned cell, unsigned face) {
+    return getBoundaryCondition(boundaryCond, cell, face) == 3;
+  };
+  auto edgeWeight = [&](int clusterA, int clusterB, bool dynamicRupture) -> int64_t {
+    int64_t weight = 1;
+    if (m_communicationEdgeWeights) {
+      // The number of reals exchanged across the face per time step of the largest cluster:
+      // the faster cell sends its buffers and the slower cell its derivatives (both derivatives for dynamic rupture),
+      // once per time step of the slower cell
+      const int64_t bufferSize = tensor::I::size();
+      const int64_t derivativesSize = yateto::computeFamilySize<tensor::dQ>();
+      int64_t volume = bufferSize + derivativesSize;
+      if (dynamicRupture) {
+        volume = 2 * derivativesSize;
+      } else if (clusterA == clusterB) {
+        volume = 2 * bufferSize;
+      }
+      for (int cluster = std::max(clusterA, clusterB); cluster < maxClusterId; ++cluster) {
+        volume *= m_rate;
+      }
+      weight = volume;
+    }
+    return dynamicRupture ? weight * m_edgeWeightDynamicRupture : weight;
+  };
+
+  std::vector<std::vector<std::pair<int64_t, int64_t>>> adjacency(cells.size());
+#ifdef USE_MPI
+  std::unordered_map<int, std::vector<int>> rankToSharedFaces;
+#endif // USE_MPI
+
+  for (unsigned cell = 0; cell < cells.size(); ++cell) {
+    unsigned int faceids[4];
+    PUML::Downward::faces(*m_mesh, cells[cell], faceids);
+    for (unsigned f = 0; f < 4; ++f) {
+      auto const &face = faces[faceids[f]];
+      if (!face.isShared()) {
+        int cellIds[2];
+        PUML::Upward::cells(*m_mesh, face, cellIds);
+        int neighbourCell = (cellIds[0] == static_cast<int>(cell)) ? cellIds[1] : cellIds[0];
+        if (neighbourCell < 0) {
+          continue;
+        }
+        int neighbourFace = PUML::Downward::faceSide(*m_mesh, cells[neighbourCell], faceids[f]);
+        bool dynamicRupture = isDynamicRupture(cell, f) || isDynamicRupture(neighbourCell, neighbourFace);
+        adjacency[cell].emplace_back(firstCell + neighbourCell,
+                                     edgeWeight(m_clusterIds[cell], m_clusterIds[neighbourCell], dynamicRupture));
+      }
+#ifdef USE_MPI
+      else {
+        rankToSharedFaces[face.shared()[0]].push_back(faceids[f]);
+      }
+#endif // USE_MPI
+    }
+  }
+
+#ifdef USE_MPI
+  FaceSorter faceSorter(faces);
+  for (auto &sharedFaces: rankToSharedFaces) {
+    std::sort(sharedFaces.second.begin(), sharedFaces.second.end(), faceSorter);
+  }
+
+  // Exchange the global id of the cell, its cluster and whether the face is a dynamic rupture face
+  auto numExchanges = rankToSharedFaces.size();
+  std::vector<MPI_Request> requests(2 * numExchanges);
+  std::vector<std::vector<int64_t>> ghost(numExchanges);
+  std::vector<std::vector<int64_t>> copy(numExchanges);
+
+  auto exchange = rankToSharedFaces.begin();
+  for (unsigned ex = 0; ex < numExchanges; ++ex) {
+    auto exchangeSize = exchange->second.size();
+    ghost[ex].resize(3 * exchangeSize);
+    copy[ex].resize(3 * exchangeSize);
+
+    for (unsigned n = 0; n < exchangeSize; ++n) {
+      int cellIds[2];
+      PUML::Upward::cells(*m_mesh, faces[exchange->second[n]], cellIds);
+      int cell = (cellIds[0] >= 0) ? cellIds[0] : cellIds[1];
+      copy[ex][3 * n] = firstCell + cell;
+      copy[ex][3 * n + 1] = m_clusterIds[cell];
+      copy[ex][3 * n + 2] = isDynamicRupture(cell, PUML::Downward::faceSide(*m_mesh, cells[cell], exchange->second[n]));
+    }
+    MPI_Isend(copy[ex].data(), 3 * exchangeSize, MPI_INT64_T, exchange->first, 0, seissol::MPI::mpi.comm(),
+              &requests[ex]);
+    MPI_Irecv(ghost[ex].data(), 3 * exchangeSize, MPI_INT64_T, exchange->first, 0, seissol::MPI::mpi.comm(),
+              &requests[numExchanges + ex]);
+    ++exchange;
+  }
+
+  MPI_Waitall(2 * numExchanges, requests.data(), MPI_STATUSES_IGNORE);
+
+  exchange = rankToSharedFaces.begin();
+  for (unsigned ex = 0; ex < numExchanges; ++ex) {
+    auto exchangeSize = exchange->second.size();
+    for (unsigned n = 0; n < exchangeSize; ++n) {
+      int64_t cell = copy[ex][3 * n] - firstCell;
+      bool dynamicRupture = copy[ex][3 * n + 2] != 0 || ghost[ex][3 * n + 2] != 0;
+      adjacency[cell].emplace_back(ghost[ex][3 * n],
+                                   edgeWeight(copy[ex][3 * n + 1], ghost[ex][3 * n + 1], dynamicRupture));
+    }
+    ++exchange;
+  }
+#endif // USE_MPI
+
+  DualGraph graph;
+  graph.offsets.reserve(cells.size() + 1);
+  graph.offsets.push_back(0);
+  for (auto const &neighbors : adjacency) {
+    for (auto const &[neighbor, weight] : neighbors) {
+      graph.neighbors.push_back(neighbor);
+      graph.edgeWeights.push_back(weight);
+    }
+    graph.offsets.push_back(graph.neighbors.size());
+  }
+  return graph;
+}
 } // namespace seissol::initializers::time_stepping
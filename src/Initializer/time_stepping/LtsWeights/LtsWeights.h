@@ -42,6 +42,7 @@
 #ifndef INITIALIZER_TIMESTEPPING_LTSWEIGHTS_H_
 #define INITIALIZER_TIMESTEPPING_LTSWEIGHTS_H_
 
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <limits>
@@ -52,12 +53,22 @@ namespace PUML { class TETPUML; }
 
 
 namespace seissol::initializers::time_stepping {
+//! Dual graph of the mesh in CSR format with the global ids of the neighboring cells and the edge weights
+struct DualGraph {
+  std::vector<int64_t> offsets{};
+  std::vector<int64_t> neighbors{};
+  std::vector<int64_t> edgeWeights{};
+};
+
 struct LtsWeightsConfig {
   std::string velocityModel{};
   unsigned rate{};
   int vertexWeightElement{};
   int vertexWeightDynamicRupture{};
   int vertexWeightFreeSurfaceWithGravity{};
+  int edgeWeightDynamicRupture{1};
+  bool usePlasticity{};
+  bool communicationEdgeWeights{};
 };
 
 
@@ -67,7 +78,10 @@ public:
                                                m_rate(config.rate),
                                                m_vertexWeightElement(config.vertexWeightElement),
                                                m_vertexWeightDynamicRupture(config.vertexWeightDynamicRupture),
-                                               m_vertexWeightFreeSurfaceWithGravity(config.vertexWeightFreeSurfaceWithGravity) {}
+                                               m_vertexWeightFreeSurfaceWithGravity(config.vertexWeightFreeSurfaceWithGravity),
+                                               m_edgeWeightDynamicRupture(config.edgeWeightDynamicRupture),
+                                               m_usePlasticity(config.usePlasticity),
+                                               m_communicationEdgeWeights(config.communicationEdgeWeights) {}
 
   virtual ~LtsWeights() = default;
   void computeWeights(PUML::TETPUML const &mesh, double maximumAllowedTimeStep);
@@ -76,6 +90,16 @@ public:
   const double *imbalances() const;
   int nWeightsPerVertex() const;
 
+  //! Time cluster of each cell of the mesh (empty before computeWeights) and the LTS rate
+  const std::vector<int>& clusterIds() const { return m_clusterIds; }
+  unsigned rate() const { return m_rate; }
+
+  //! Dual graph with the edge weights, if the faces have different edge weights; empty otherwise
+  const DualGraph& dualGraph() const { return m_dualGraph; }
+
+  //! Continues the hash with the weight model, its configuration and the content of the velocity model file.
+  uint64_t hash(uint64_t hash) const;
+
 protected:
   struct GlobalTimeStepDetails {
     double globalMinTimeStep{};
@@ -90,7 +114,8 @@ protected:
   std::vector<int> computeClusterIds();
   int enforceMaximumDifference();
   int enforceMaximumDifferenceLocal(int maxDifference = 1);
-  std::vector<int> computeCostsPerTimestep();
+  DualGraph computeDualGraph();
+  virtual std::vector<int> computeCostsPerTimestep();
 
   static int ipow(int x, int y);
 
@@ -106,9 +131,13 @@ protected:
   int m_vertexWeightElement{};
   int m_vertexWeightDynamicRupture{};
   int m_vertexWeightFreeSurfaceWithGravity{};
+  int m_edgeWeightDynamicRupture{1};
+  bool m_usePlasticity{};
+  bool m_communicationEdgeWeights{};
   int m_ncon{std::numeric_limits<int>::infinity()};
   const PUML::TETPUML * m_mesh{nullptr};
   std::vector<int> m_clusterIds{};
+  DualGraph m_dualGraph{};
 };
 }
 
@@ -13,6 +13,8 @@ enum class LtsWeightsTypes: int {
   ExponentialWeights = 0,
   ExponentialBalancedWeights,
   EncodedBalancedWeights,
+  KernelCostWeights,
+  DynamicRuptureBalancedWeights,
   Count
 };
 
@@ -42,6 +44,12 @@ std::unique_ptr<LtsWeights> getLtsWeightsImplementation(LtsWeightsTypes type, co
     case LtsWeightsTypes::EncodedBalancedWeights : {
       return std::make_unique<EncodedBalancedWeights>(config);
     }
+    case LtsWeightsTypes::KernelCostWeights : {
+      return std::make_unique<KernelCostWeights>(config);
+    }
+    case LtsWeightsTypes::DynamicRuptureBalancedWeights : {
+      return std::make_unique<DynamicRuptureBalancedWeights>(config);
+    }
     default : {
       return std::unique_ptr<LtsWeights>(nullptr);
     }
@@ -6,10 +6,21 @@
 
 #include <Initializer/typedefs.hpp>
 #include <Initializer/ParameterDB.h>
+#include <Kernels/DynamicRupture.h>
+#include <Kernels/Local.h>
+#include <Kernels/Neighbor.h>
+#include <Kernels/Plasticity.h>
+#include <Kernels/Time.h>
 #include <Parallel/MPI.h>
 
 #include <generated_code/init.h>
 
+#include <utils/env.h>
+#include <utils/logger.h>
+
+#include <algorithm>
+#include <cmath>
+
 
 namespace seissol::initializers::time_stepping {
 
@@ -82,4 +93,139 @@ void EncodedBalancedWeights::setAllowedImbalances() {
     m_imbalances[i] = mediumLtsWeightImbalance;
   }
 }
+
+
+std::vector<int> KernelCostWeights::computeCostsPerTimestep() {
+  seissol::kernels::Time timeKernel;
+  seissol::kernels::Local localKernel;
+  seissol::kernels::Neighbor neighborKernel;
+  seissol::kernels::DynamicRupture dynRupKernel;
+
+  // Hardware flops of a cell update with the given face types, without the friction law
+  auto cellFlops = [&](FaceType const faceTypes[4]) {
+    unsigned nonZeroFlops = 0, hardwareFlops = 0;
+    long long flops = 0;
+
+    timeKernel.flopsAder(nonZeroFlops, hardwareFlops);
+    flops += hardwareFlops;
+    localKernel.flopsIntegral(faceTypes, nonZeroFlops, hardwareFlops);
+    flops += hardwareFlops;
+
+    // The flops of the neighbor flux hardly depend on the face relations, see auto_tuning/proxy/src/flops_per_cell.cpp
+    std::int8_t faceRelations[4][2] = {};
+    CellDRMapping drMapping[4] = {};
+    long long drNonZeroFlops = 0, drHardwareFlops = 0;
+    neighborKernel.flopsNeighborsIntegral(faceTypes, faceRelations, drMapping,
+                                          nonZeroFlops, hardwareFlops, drNonZeroFlops, drHardwareFlops);
+    flops += hardwareFlops + drHardwareFlops;
+
+    for (unsigned face = 0; face < 4; ++face) {
+      if (faceTypes[face] == FaceType::freeSurfaceGravity) {
+        flops += GravitationalFreeSurfaceBc::getFlopsDisplacementFace(face, faceTypes[face]).second;
+      } else if (faceTypes[face] == FaceType::dynamicRupture) {
+        // The Godunov state is computed once per fault face, i.e. each side gets one half
+        long long godunovNonZeroFlops = 0, godunovHardwareFlops = 0;
+        DRFaceInformation faceInformation{};
+        faceInformation.plusSide = face;
+        dynRupKernel.flopsGodunovState(faceInformation, godunovNonZeroFlops, godunovHardwareFlops);
+        flops += godunovHardwareFlops / 2;
+      }
+    }
+
+    if (m_usePlasticity) {
+      // The yield flops are only spent in yielding cells; SEISSOL_LTS_WEIGHT_YIELD_FRACTION estimates their share
+      static const double yieldFraction = utils::Env::get<double>("SEISSOL_LTS_WEIGHT_YIELD_FRACTION", 1.0);
+      long long nonZeroFlopsCheck = 0, hardwareFlopsCheck = 0, nonZeroFlopsYield = 0, hardwareFlopsYield = 0;
+      seissol::kernels::Plasticity::flopsPlasticity(nonZeroFlopsCheck, hardwareFlopsCheck,
+                                                    nonZeroFlopsYield, hardwareFlopsYield);
+      flops += hardwareFlopsCheck + static_cast<long long>(yieldFraction * hardwareFlopsYield);
+    }
+    return flops;
+  };
+
+  const FaceType regularFaces[4] = {FaceType::regular, FaceType::regular, FaceType::regular, FaceType::regular};
+  const double referenceFlops = static_cast<double>(cellFlops(regularFaces));
+
+  const auto &cells = m_mesh->cells();
+  std::vector<int> cellCosts(cells.size());
+  int const *boundaryCond = m_mesh->cellData(1);
+  for (unsigned cell = 0; cell < cells.size(); ++cell) {
+    FaceType faceTypes[4];
+    int dynamicRupture = 0;
+    for (unsigned face = 0; face < 4; ++face) {
+      faceTypes[face] = static_cast<FaceType>(getBoundaryCondition(boundaryCond, cell, face));
+      dynamicRupture += (faceTypes[face] == FaceType::dynamicRupture) ? 1 : 0;
+    }
+
+    // The friction law is not covered by the flop counters and is weighted as in the static model
+    const double kernelCost = m_vertexWeightElement * cellFlops(faceTypes) / referenceFlops;
+    const int costDynamicRupture = m_vertexWeightDynamicRupture * dynamicRupture;
+    cellCosts[cell] = std::max(1, static_cast<int>(std::lround(kernelCost)) + costDynamicRupture);
+  }
+  return cellCosts;
+}
+
+void KernelCostWeights::setVertexWeights() {
+  assert(m_ncon == 1 && "single constraint partitioning");
+  int maxCluster = getCluster(m_details.globalMaxTimeStep, m_details.globalMinTimeStep, m_rate);
+
+  for (unsigned cell = 0; cell < m_cellCosts.size(); ++cell) {
+    int factor = LtsWeights::ipow(m_rate, maxCluster - m_clusterIds[cell]);
+    m_vertexWeights[m_ncon * cell] = factor * m_cellCosts[cell];
+  }
+}
+
+void KernelCostWeights::setAllowedImbalances() {
+  assert(m_ncon == 1 && "single constraint partitioning");
+  m_imbalances.resize(m_ncon);
+
+  constexpr double tinyLtsWeightImbalance{1.01};
+  m_imbalances[0] = tinyLtsWeightImbalance;
+}
+
+
+void DynamicRuptureBalancedWeights::setVertexWeights() {
+  assert(m_ncon == 2 && "binary constaints partitioning");
+  int maxCluster = getCluster(m_details.globalMaxTimeStep, m_details.globalMinTimeStep, m_rate);
+
+  const auto &cells = m_mesh->cells();
+  int const *boundaryCond = m_mesh->cellData(1);
+  long localDynamicRuptureFaces = 0;
+  for (unsigned cell = 0; cell < cells.size(); ++cell) {
+    int factor = LtsWeights::ipow(m_rate, maxCluster - m_clusterIds[cell]);
+    m_vertexWeights[m_ncon * cell] = factor * m_cellCosts[cell];
+
+    int dynamicRupture = 0;
+    for (unsigned face = 0; face < 4; ++face) {
+      dynamicRupture += (getBoundaryCondition(boundaryCond, cell, face) == static_cast<int>(FaceType::dynamicRupture)) ? 1 : 0;
+    }
+    m_vertexWeights[m_ncon * cell + 1] = factor * dynamicRupture;
+    localDynamicRuptureFaces += dynamicRupture;
+  }
+
+  long globalDynamicRuptureFaces = localDynamicRuptureFaces;
+#ifdef USE_MPI
+  MPI_Allreduce(&localDynamicRuptureFaces, &globalDynamicRuptureFaces, 1, MPI_LONG, MPI_SUM, seissol::MPI::mpi.comm());
+#endif // USE_MPI
+
+  // A constraint without any weight can not be balanced
+  if (globalDynamicRuptureFaces == 0) {
+    for (unsigned cell = 0; cell < cells.size(); ++cell) {
+      constexpr int memoryWeight{1};
+      m_vertexWeights[m_ncon * cell + 1] = memoryWeight;
+    }
+  }
+}
+
+
+void DynamicRuptureBalancedWeights::setAllowedImbalances() {
+  assert(m_ncon == 2 && "binary constaints partitioning");
+  m_imbalances.resize(m_ncon);
+
+  constexpr double tinyLtsWeightImbalance{1.01};
+  m_imbalances[0] = tinyLtsWeightImbalance;
+
+  constexpr double mediumDynamicRuptureImbalance{1.05};
+  m_imbalances[1] = mediumDynamicRuptureImbalance;
+}
 }
@@ -42,6 +42,42 @@ protected:
   void setVertexWeights() final;
   void setAllowedImbalances() final;
 };
+
+
+/**
+ * Like ExponentialWeights, but the cost of a cell is derived from the flops of the compute kernels
+ * of the compiled equation, i.e. it accounts for the boundary conditions of the cell, its dynamic rupture faces
+ * and plasticity.
+ * The costs are scaled such that a cell without special faces has the cost vertexWeightElement.
+ **/
+class KernelCostWeights : public LtsWeights {
+public:
+  explicit KernelCostWeights(const LtsWeightsConfig &config) : LtsWeights(config) {}
+  ~KernelCostWeights() override = default;
+
+protected:
+  int evaluateNumberOfConstraints() final { return 1; }
+  std::vector<int> computeCostsPerTimestep() final;
+  void setVertexWeights() final;
+  void setAllowedImbalances() final;
+};
+
+
+/**
+ * Like ExponentialWeights, with a second constraint for the dynamic rupture faces weighted by their update frequency,
+ * such that the friction law work of the fault is distributed on its own instead of being part of the cell costs only.
+ * Without dynamic rupture faces, the second constraint balances the number of cells.
+ **/
+class DynamicRuptureBalancedWeights : public LtsWeights {
+public:
+  explicit DynamicRuptureBalancedWeights(const LtsWeightsConfig &config) : LtsWeights(config) {}
+  ~DynamicRuptureBalancedWeights() override = default;
+
+protected:
+  int evaluateNumberOfConstraints() final { return 2; }
+  void setVertexWeights() final;
+  void setAllowedImbalances() final;
+};
 }
 
 #endif //SEISSOL_LTSWEIGHTSMODELS_H
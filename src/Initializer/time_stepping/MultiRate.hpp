@@ -42,7 +42,12 @@
 #include "Parallel/MPI.h"
 
 #include "common.hpp"
+#include <algorithm>
 #include <limits>
+#include <vector>
+
+#include <utils/env.h>
+#include <utils/logger.h>
 
 #ifndef MULTIRATE_HPP
 #define MULTIRATE_HPP
@@ -196,6 +201,121 @@ class seissol::initializers::time_stepping::MultiRate {
 
 
   public:
+    /**
+     * Smallest factor by which the global minimum time step width may be reduced (SEISSOL_LTS_WIGGLE_FACTOR_MIN);
+     * 1 disables the search.
+     **/
+    static double minimumWiggleFactor() {
+      static const double factor = std::min( 1.0, std::max( 0.5, utils::Env::get<double>("SEISSOL_LTS_WIGGLE_FACTOR_MIN", 1.0) ) );
+      return factor;
+    }
+
+    /**
+     * Derives the local costs of the clusterings with the candidate wiggle factors 1, 1-0.01, ..., i_minimumWiggleFactor.
+     * The cost of a clustering is the number of cell updates per global minimum time step width.
+     *
+     * @param i_numberOfCells local number of cells.
+     * @param i_cellTimeStepWidths time step widths of the cells.
+     * @param i_minimumTimeStepWidth global minimum time step width.
+     * @param i_multiRate rate of the multi-rate scheme.
+     * @param i_minimumWiggleFactor smallest candidate wiggle factor.
+     * @return local costs of the candidates.
+     **/
+    static std::vector<double> wiggleFactorCosts(       unsigned int  i_numberOfCells,
+                                                  const double       *i_cellTimeStepWidths,
+                                                        double        i_minimumTimeStepWidth,
+                                                        unsigned int  i_multiRate,
+                                                        double        i_minimumWiggleFactor ) {
+      const unsigned int l_numberOfCandidates = 1 + static_cast<unsigned int>( (1.0 - i_minimumWiggleFactor) / 0.01 + 1e-9 );
+      std::vector<double> l_costs( l_numberOfCandidates, 0.0 );
+
+      for( unsigned int l_candidate = 0; l_candidate < l_numberOfCandidates; l_candidate++ ) {
+        const double l_minimumTimeStepWidth = (1.0 - 0.01 * l_candidate) * i_minimumTimeStepWidth;
+        for( unsigned int l_cell = 0; l_cell < i_numberOfCells; l_cell++ ) {
+          double l_clusterTimeStepWidth;
+          unsigned int l_clusterId;
+          getMultiRateInfo( i_cellTimeStepWidths[l_cell],
+                            l_minimumTimeStepWidth,
+                            i_multiRate,
+                            l_clusterTimeStepWidth,
+                            l_clusterId );
+          l_costs[l_candidate] += i_minimumTimeStepWidth / l_clusterTimeStepWidth;
+        }
+      }
+
+      return l_costs;
+    }
+
+    /**
+     * Derives the factor by which the global minimum time step width is reduced.
+     * A slightly smaller minimum time step width moves cells, whose time step widths are just below a power of the
+     * rate, to the next cluster; the factor with the fewest global cell updates is chosen.
+     *
+     * @param i_numberOfCells local number of cells.
+     * @param i_cellTimeStepWidths time step widths of the cells.
+     * @param i_minimumTimeStepWidth global minimum time step width.
+     * @param i_multiRate rate of the multi-rate scheme.
+     * @return wiggle factor in [SEISSOL_LTS_WIGGLE_FACTOR_MIN, 1].
+     **/
+    static double deriveWiggleFactor(       unsigned int  i_numberOfCells,
+                                      const double       *i_cellTimeStepWidths,
+                                            double        i_minimumTimeStepWidth,
+                                            unsigned int  i_multiRate ) {
+      if( minimumWiggleFactor() >= 1.0 || i_multiRate < 2 || i_multiRate == std::numeric_limits<unsigned int>::max() ) {
+        return 1.0;
+      }
+
+      std::vector<double> l_costs = wiggleFactorCosts( i_numberOfCells,
+                                                       i_cellTimeStepWidths,
+                                                       i_minimumTimeStepWidth,
+                                                       i_multiRate,
+                                                       minimumWiggleFactor() );
+#ifdef USE_MPI
+      MPI_Allreduce( MPI_IN_PLACE, l_costs.data(), l_costs.size(), MPI_DOUBLE, MPI_SUM, seissol::MPI::mpi.comm() );
+#endif
+
+      // prefer larger factors if the costs are equal
+      unsigned int l_best = 0;
+      for( unsigned int l_candidate = 1; l_candidate < l_costs.size(); l_candidate++ ) {
+        if( l_costs[l_candidate] < l_costs[l_best] ) {
+          l_best = l_candidate;
+        }
+      }
+
+      const double l_wiggleFactor = 1.0 - 0.01 * l_best;
+      logInfo(seissol::MPI::mpi.rank()) << "LTS wiggle factor:" << l_wiggleFactor
+                                        << "predicted speedup:" << l_costs[0] / l_costs[l_best];
+      return l_wiggleFactor;
+    }
+
+    /**
+     * Derives the speedup if the cells of the fastest cluster could use the time step width of the second cluster,
+     * i.e. what the fastest cluster costs.
+     * The cost is the number of cell updates during one update of the cluster with the largest time step.
+     *
+     * @param i_clusterSizes number of cells of the clusters.
+     * @param i_clusterRates time step rates of the clusters.
+     * @return predicted speedup, 1 for a single cluster.
+     **/
+    static double fastestClusterSpeedup( const std::vector<double> &i_clusterSizes,
+                                         const unsigned int        *i_clusterRates ) {
+      if( i_clusterSizes.size() < 2 ) {
+        return 1.0;
+      }
+
+      double l_updates = 1.0;
+      double l_cost = 0.0;
+      for( int l_cluster = static_cast<int>(i_clusterSizes.size()) - 1; l_cluster > 0; l_cluster-- ) {
+        l_cost += l_updates * i_clusterSizes[l_cluster];
+        l_updates *= i_clusterRates[l_cluster-1];
+      }
+      const double l_secondClusterUpdates = l_updates / i_clusterRates[0];
+
+      const double l_reducedCost = l_cost + l_secondClusterUpdates * i_clusterSizes[0];
+      l_cost += l_updates * i_clusterSizes[0];
+      return (l_reducedCost > 0.0) ? l_cost / l_reducedCost : 1.0;
+    }
+
     /**
      * Derives the cluster ids of the cells.
      *
@@ -222,6 +342,11 @@ class seissol::initializers::time_stepping::MultiRate {
                                  l_minimumTimeStepWidth,
                                  l_maximumTimeStepWidth );
 
+      l_minimumTimeStepWidth *= deriveWiggleFactor( i_numberOfCells,
+                                                    i_timeStepWidths,
+                                                    l_minimumTimeStepWidth,
+                                                    i_multiRate );
+
       // derive the number and time step widths of the global clusters
       deriveGlobalClusters( l_minimumTimeStepWidth,
                             l_maximumTimeStepWidth,
@@ -46,6 +46,10 @@
 
 #include <Initializer/MemoryAllocator.h>
 
+#include <map>
+#include <string>
+#include <utility>
+
 namespace seissol {
   namespace initializers {
     class LTSTree;
@@ -64,9 +68,12 @@ private:
 
 #ifdef ACL_DEVICE
   std::vector<MemoryInfo> scratchpadMemInfo{};
-  std::vector<size_t> scratchpadMemSizes{};  /*!< sizes of variables within the entire tree in bytes */
-  void** scratchpadMemories;
-  std::vector<int> scratchpadMemIds{};
+
+  //! Bytes of a scratchpad in the pool, which keeps the alignment of separate device allocations
+  static size_t scratchpadPoolBytes(size_t bytes) {
+    constexpr size_t PoolAlignment = 256;
+    return (bytes + PoolAlignment - 1) / PoolAlignment * PoolAlignment;
+  }
 #endif  // ACL_DEVICE
 
 public:
@@ -111,8 +118,16 @@ public:
     return varInfo.size();
   }
   
+  MemoryInfo const& bucketMemoryInfo(unsigned index) const {
+    return bucketInfo[index];
+  }
+
+  inline unsigned getNumberOfBuckets() const {
+    return bucketInfo.size();
+  }
+  
   template<typename T>
-  void addVar(Variable<T>& handle, LayerMask mask, size_t alignment, seissol::memory::Memkind memkind) {
+  void addVar(Variable<T>& handle, LayerMask mask, size_t alignment, seissol::memory::Memkind memkind, std::string name = {}) {
     handle.index = varInfo.size();
     handle.mask = mask;
     MemoryInfo m;
@@ -120,14 +135,16 @@ public:
     m.alignment = alignment;
     m.mask = mask;
     m.memkind = memkind;
+    m.name = std::move(name);
     varInfo.push_back(m);
   }
   
-  void addBucket(Bucket& handle, size_t alignment, seissol::memory::Memkind memkind) {
+  void addBucket(Bucket& handle, size_t alignment, seissol::memory::Memkind memkind, std::string name = {}) {
     handle.index = bucketInfo.size();
     MemoryInfo m;
     m.alignment = alignment;
     m.memkind = memkind;
+    m.name = std::move(name);
     bucketInfo.push_back(m);
   }
 
@@ -180,30 +197,46 @@ public:
   }
 
 #ifdef ACL_DEVICE
-  // Walks through all leaves, computes the maximum amount of memory for each scratchpad entity,
-  // allocates all scratchpads based on evaluated max. scratchpad sizes, and, finally,
-  // redistributes scratchpads to all leaves.
-  //
-  // Note, all scratchpad entities are shared between leaves.
-  // Do not update leaves in parallel inside of the same MPI rank while using GPUs.
-  void allocateScratchPads() {
-    scratchpadMemories = new void*[scratchpadMemInfo.size()];
-    scratchpadMemSizes.resize(scratchpadMemInfo.size(), 0);
+  using ScratchpadPoolSizes = std::map<seissol::memory::Memkind, size_t>;
 
+  // Adds the bytes, which the scratchpads of this tree occupy in a pool, to sizes (per memory kind).
+  // If the leaves are never updated concurrently, they share their scratchpads, i.e. the pool has to hold the
+  // scratchpads of the largest leaf only. Otherwise, every leaf gets its own part of the pool.
+  void addScratchpadPoolSizes(ScratchpadPoolSizes& sizes, bool concurrentLeaves) {
+    ScratchpadPoolSizes treeSizes;
     for (LTSTree::leaf_iterator it = beginLeaf(); it != endLeaf(); ++it) {
-      it->findMaxScratchpadSizes(scratchpadMemSizes);
+      ScratchpadPoolSizes leafSizes;
+      for (size_t id = 0; id < scratchpadMemInfo.size(); ++id) {
+        leafSizes[scratchpadMemInfo[id].memkind] += scratchpadPoolBytes(it->getScratchpadSize(id));
+      }
+      for (auto const& [memkind, bytes] : leafSizes) {
+        treeSizes[memkind] = concurrentLeaves ? treeSizes[memkind] + bytes : std::max(treeSizes[memkind], bytes);
+      }
     }
-
-    for (size_t id = 0; id < scratchpadMemSizes.size(); ++id) {
-      // TODO {ravil}: check whether the assert makes sense
-      //assert((scratchpadMemSizes[id] > 0) && "ERROR: scratchpad mem. size is equal to zero");
-      scratchpadMemories[id] = m_allocator.allocateMemory(scratchpadMemSizes[id],
-                                                          scratchpadMemInfo[id].alignment,
-                                                          scratchpadMemInfo[id].memkind);
+    for (auto const& [memkind, bytes] : treeSizes) {
+      sizes[memkind] += bytes;
     }
+  }
 
+  // Hands out the scratchpads of all leaves from the pool, see addScratchpadPoolSizes;
+  // pool points to the first free byte per memory kind and is advanced past the memory of this tree.
+  void assignScratchpadPool(std::map<seissol::memory::Memkind, char*>& pool, bool concurrentLeaves) {
+    ScratchpadPoolSizes treeSizes;
+    addScratchpadPoolSizes(treeSizes, concurrentLeaves);
+
+    auto next = pool;
     for (LTSTree::leaf_iterator it = beginLeaf(); it != endLeaf(); ++it) {
-      it->setMemoryRegionsForScratchpads(scratchpadMemories, scratchpadMemInfo.size());
+      if (!concurrentLeaves) {
+        next = pool;
+      }
+      for (size_t id = 0; id < scratchpadMemInfo.size(); ++id) {
+        char*& memory = next[scratchpadMemInfo[id].memkind];
+        it->setMemoryRegionForScratchpad(id, memory);
+        memory += scratchpadPoolBytes(it->getScratchpadSize(id));
+      }
+    }
+    for (auto const& [memkind, bytes] : treeSizes) {
+      pool[memkind] += bytes;
     }
   }
 #endif
@@ -43,9 +43,12 @@
 #include "Node.hpp"
 #include <Initializer/MemoryAllocator.h>
 #include <Initializer/BatchRecorders/DataTypes/ConditionalTable.hpp>
+#include <Parallel/Pin.h>
+#include <algorithm>
 #include <bitset>
 #include <limits>
 #include <cstring>
+#include <string>
 
 
 enum LayerType {
@@ -92,6 +95,8 @@ struct seissol::initializers::MemoryInfo {
   size_t alignment;
   LayerMask mask;
   seissol::memory::Memkind memkind;
+  //! Name in reports, e.g. of the startup profiler; may be empty
+  std::string name;
 };
 
 class seissol::initializers::Layer : public seissol::initializers::Node {
@@ -186,6 +191,11 @@ public:
     assert(m_scratchpadSizes != NULL);
     m_scratchpadSizes[handle.index] = size;
   }
+
+  inline size_t getScratchpadSize(ScratchpadMemory const& handle) const {
+    assert(m_scratchpadSizes != nullptr);
+    return m_scratchpadSizes[handle.index];
+  }
 #endif
 
   inline size_t getBucketSize(Bucket const& handle) {
@@ -208,12 +218,9 @@ public:
   }
 
 #ifdef ACL_DEVICE
-  // Overrides array's elements; if the corresponding local
-  // scratchpad mem. size is bigger then the one inside of the array
-  void findMaxScratchpadSizes(std::vector<size_t>& bytes) {
-    for (size_t id = 0; id < bytes.size(); ++id) {
-      bytes[id] = std::max(bytes[id], m_scratchpadSizes[id]);
-    }
+  size_t getScratchpadSize(size_t id) const {
+    assert(m_scratchpadSizes != NULL);
+    return m_scratchpadSizes[id];
   }
 #endif
 
@@ -234,11 +241,9 @@ public:
   }
 
 #ifdef ACL_DEVICE
-  void setMemoryRegionsForScratchpads(void** memory, size_t numScratchPads) {
+  void setMemoryRegionForScratchpad(size_t id, void* memory) {
     assert(m_scratchpads != NULL);
-    for (size_t id = 0; id < numScratchPads; ++id) {
-      m_scratchpads[id] = static_cast<char*>(memory[id]);
-    }
+    m_scratchpads[id] = memory;
   }
 #endif
   
@@ -248,11 +253,28 @@ public:
       // NOTE: we don't touch device global memory because it is in a different address space
       // we will do deep-copy from the host to a device later on
       if (!isMasked(vars[var].mask) && (vars[var].memkind != seissol::memory::DeviceGlobalMemory)) {
+        char* data = static_cast<char*>(m_vars[var]);
+        const size_t bytes = vars[var].bytes;
+        const bool bindToNumaNode = seissol::parallel::Pinning::useNumaAwareMemory();
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+          // the cells are assigned to the threads as in the (static) cell loops of the time clusters
+          size_t firstCell = m_numberOfCells;
+          size_t lastCell = 0;
 #ifdef _OPENMP
-#pragma omp parallel for schedule(static)
+#pragma omp for schedule(static)
 #endif
-        for (unsigned cell = 0; cell < m_numberOfCells; ++cell) {
-          memset(static_cast<char*>(m_vars[var]) + cell * vars[var].bytes, 0, vars[var].bytes);
+          for (unsigned cell = 0; cell < m_numberOfCells; ++cell) {
+            memset(data + cell * bytes, 0, bytes);
+            firstCell = std::min(firstCell, static_cast<size_t>(cell));
+            lastCell = cell + 1;
+          }
+          // pages reused by the allocator were touched before, thus they are moved explicitly
+          if (bindToNumaNode && firstCell < lastCell) {
+            seissol::parallel::Pinning::bindToLocalNumaNode(data + firstCell * bytes, data + lastCell * bytes);
+          }
         }
       }
     }
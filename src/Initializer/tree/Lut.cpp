@@ -41,18 +41,14 @@
 #include "Lut.hpp"
 
 seissol::initializers::Lut::LutsForMask::LutsForMask()
-  : ltsToMesh(NULL), duplicatedMeshIds(NULL), numberOfDuplicatedMeshIds(0)
+  : ltsToMesh(NULL), meshToLts(NULL), duplicatedMeshIds(NULL), duplicatedLtsIds(NULL), numberOfDuplicatedMeshIds(0)
 {
-  for (unsigned dup = 0; dup < MaxDuplicates; ++dup) {
-    meshToLts[dup] = NULL;
-  }
 }
 seissol::initializers::Lut::LutsForMask::~LutsForMask()
 {
+  delete[] duplicatedLtsIds;
   delete[] duplicatedMeshIds;
-  for (unsigned dup = 0; dup < MaxDuplicates; ++dup) {
-    delete[] meshToLts[dup];
-  }
+  delete[] meshToLts;
   delete[] ltsToMesh;
 }
 
@@ -79,10 +75,8 @@ void seissol::initializers::Lut::LutsForMask::createLut(  LayerMask mask,
   }
 
   // meshToLts
-  for (unsigned dup = 0; dup < MaxDuplicates; ++dup) {
-    meshToLts[dup] = new unsigned[numberOfMeshIds];
-    std::fill(meshToLts[dup], meshToLts[dup] + numberOfMeshIds, std::numeric_limits<unsigned>::max());
-  }
+  meshToLts = new unsigned[numberOfMeshIds];
+  std::fill(meshToLts, meshToLts + numberOfMeshIds, std::numeric_limits<unsigned>::max());
 
   unsigned* numDuplicates = new unsigned[numberOfMeshIds];
   memset(numDuplicates, 0, numberOfMeshIds * sizeof(unsigned));
@@ -91,7 +85,9 @@ void seissol::initializers::Lut::LutsForMask::createLut(  LayerMask mask,
     unsigned meshId = ltsToMesh[ltsId];
     if (meshId != std::numeric_limits<unsigned int>::max()) {
       assert( numDuplicates[meshId] < MaxDuplicates);
-      meshToLts[ numDuplicates[meshId]++ ][meshId] = ltsId;
+      if (numDuplicates[meshId]++ == 0) {
+        meshToLts[meshId] = ltsId;
+      }
     }
   }
   
@@ -103,11 +99,31 @@ void seissol::initializers::Lut::LutsForMask::createLut(  LayerMask mask,
   }
   
   duplicatedMeshIds = new unsigned[numberOfDuplicatedMeshIds];
+  duplicatedLtsIds = new unsigned[numberOfDuplicatedMeshIds][MaxDuplicates];
   
   unsigned dupId = 0;
   for (unsigned meshId = 0; meshId < numberOfMeshIds; ++meshId) {
     if (numDuplicates[meshId] > 1) {
-      duplicatedMeshIds[dupId++] = meshId;
+      // Reuse numDuplicates as index into duplicatedMeshIds
+      numDuplicates[meshId] = dupId;
+      duplicatedMeshIds[dupId] = meshId;
+      std::fill(duplicatedLtsIds[dupId], duplicatedLtsIds[dupId] + MaxDuplicates, std::numeric_limits<unsigned>::max());
+      ++dupId;
+    } else {
+      numDuplicates[meshId] = std::numeric_limits<unsigned>::max();
+    }
+  }
+
+  // The ltsIds of a cell are ascending, hence the order of the duplicates is the same as before
+  for (unsigned ltsId = 0; ltsId < numberOfLtsIds; ++ltsId) {
+    unsigned meshId = ltsToMesh[ltsId];
+    if (meshId != std::numeric_limits<unsigned int>::max() && numDuplicates[meshId] != std::numeric_limits<unsigned>::max()) {
+      unsigned* ltsIds = duplicatedLtsIds[numDuplicates[meshId]];
+      unsigned dup = 0;
+      while (ltsIds[dup] != std::numeric_limits<unsigned>::max()) {
+        ++dup;
+      }
+      ltsIds[dup] = ltsId;
     }
   }
   
@@ -43,6 +43,9 @@
 
 #include "LTSTree.hpp"
 
+#include <algorithm>
+#include <limits>
+
 namespace seissol {
   namespace initializers {
     class Lut;
@@ -64,18 +67,30 @@ private:
   struct LutsForMask {
     /** ltsToMesh[ltsId] returns a meshId given a ltsId. */
     unsigned* ltsToMesh;
-    /** meshToLts[0][meshId] always returns a valid ltsId.
-     * meshToLts[1..3][meshId] might be invalid (== std::numeric_limits<unsigned>::max())
-     * and contains the ltsIds of duplicated cells.
-     */
-    unsigned* meshToLts[MaxDuplicates];
-    /** Contains meshIds where any of meshToLts[1..3][meshId] is valid. */
+    /** meshToLts[meshId] always returns a valid ltsId (of the first occurrence of the cell). */
+    unsigned* meshToLts;
+    /** Contains the meshIds of the cells which occur more than once, in ascending order. */
     unsigned* duplicatedMeshIds;
+    /** duplicatedLtsIds[i][dup] contains the ltsIds of duplicatedMeshIds[i];
+     * entries without a duplicate are invalid (== std::numeric_limits<unsigned>::max()).
+     * Only few cells are duplicated, hence they are not stored for all meshIds.
+     */
+    unsigned (*duplicatedLtsIds)[MaxDuplicates];
     /** Size of duplicatedMeshIds. */
     unsigned  numberOfDuplicatedMeshIds;
     
     LutsForMask();
     ~LutsForMask();
+
+    unsigned duplicateLtsId(unsigned meshId, unsigned duplicate) const {
+      unsigned const* begin = duplicatedMeshIds;
+      unsigned const* end = begin + numberOfDuplicatedMeshIds;
+      unsigned const* it = std::lower_bound(begin, end, meshId);
+      if (it == end || *it != meshId) {
+        return std::numeric_limits<unsigned>::max();
+      }
+      return duplicatedLtsIds[it - begin][duplicate];
+    }
     
     void createLut( LayerMask mask,
                     LTSTree*  ltsTree,
@@ -106,16 +121,28 @@ public:
   
   inline unsigned ltsId(LayerMask mask, unsigned meshId, unsigned duplicate = 0) const {
     assert(duplicate < MaxDuplicates);
-    return maskedLuts[mask.to_ulong()].meshToLts[duplicate][meshId];
+    LutsForMask const& lut = maskedLuts[mask.to_ulong()];
+    return duplicate == 0 ? lut.meshToLts[meshId] : lut.duplicateLtsId(meshId, duplicate);
+  }
+
+  //! True if ltsId is the first occurrence of its cell, i.e. the cell is neither invalid nor a duplicate
+  inline bool isFirstOccurrence(LayerMask mask, unsigned ltsId) const {
+    LutsForMask const& lut = maskedLuts[mask.to_ulong()];
+    unsigned meshId = lut.ltsToMesh[ltsId];
+    return meshId != std::numeric_limits<unsigned>::max() && lut.meshToLts[meshId] == ltsId;
   }
   
-  inline unsigned *const (&getMeshToLtsLut(LayerMask mask) const)[MaxDuplicates] {
+  inline unsigned* getMeshToLtsLut(LayerMask mask) const {
     return maskedLuts[mask.to_ulong()].meshToLts;
   }
   
   inline unsigned* getDuplicatedMeshIds(LayerMask mask) const {
     return maskedLuts[mask.to_ulong()].duplicatedMeshIds;
   }
+
+  inline unsigned const (*getDuplicatedLtsIds(LayerMask mask) const)[MaxDuplicates] {
+    return maskedLuts[mask.to_ulong()].duplicatedLtsIds;
+  }
   
   inline unsigned getNumberOfDuplicatedMeshIds(LayerMask mask) const {
     return maskedLuts[mask.to_ulong()].numberOfDuplicatedMeshIds;
@@ -54,6 +54,13 @@
 #include <generated_code/tensor.h>
 
 #include <cstddef>
+#include <cstdint>
+
+#ifdef USE_MPI
+namespace seissol::parallel {
+struct SharedHaloSlot;
+} // namespace seissol::parallel
+#endif
 
 // cross-cluster time stepping information
 struct TimeStepping {
@@ -94,7 +101,8 @@ struct CellLocalInformation {
   FaceType faceTypes[4];
 
   // mapping of the neighboring elements to the references element in relation to this element
-  int faceRelations[4][2];
+  // (local face 0..3 and orientation 0..2 of the neighbor, hence bytes)
+  std::int8_t faceRelations[4][2];
 
   // ids of the face neighbors
   unsigned int faceNeighborIds[4];
@@ -198,6 +206,33 @@ struct MeshStructure {
    * MPI receive requests.
    */
   MPI_Request *receiveRequests;
+
+  /*
+   * True if the send and receive requests are persistent requests, which are started in every time step.
+   */
+  bool hasPersistentRequests;
+
+  /*
+   * Single precision staging buffers of the copy and ghost regions.
+   * nullptr, unless the ghost layer exchange is compressed (SEISSOL_HALO_PRECISION=single).
+   */
+  float** compressedCopyRegions;
+  float** compressedGhostRegions;
+
+  /*
+   * Device global memory staging buffers of the copy and ghost regions, which are passed to a GPU-aware MPI.
+   * nullptr, unless the ghost layers are exchanged from the device (SEISSOL_MPI_DEVICE_BUFFERS=1).
+   */
+  real** deviceCopyRegions;
+  real** deviceGhostRegions;
+
+  /*
+   * Slots of the MPI shared memory window, through which the copy and ghost regions are exchanged with ranks
+   * on the same node. nullptr for regions which are exchanged with MPI messages;
+   * the arrays are nullptr, unless SEISSOL_MPI_SHARED_MEMORY=1.
+   */
+  seissol::parallel::SharedHaloSlot** sharedCopySlots;
+  seissol::parallel::SharedHaloSlot** sharedGhostSlots;
 #endif
 
 };
@@ -319,6 +354,10 @@ struct GlobalData {
   // A vector of ones. Note: It is only relevant for GPU computing.
   // It allows us to allocate this vector only once in the GPU memory
   real* replicateStresses{nullptr};
+
+  // Resampling matrix of the friction laws. Note: It is only relevant for GPU computing.
+  // (the host friction solvers use init::resample::Values directly)
+  real* resampleMatrix{nullptr};
 };
 
 struct CompoundGlobalData {
@@ -326,13 +365,29 @@ struct CompoundGlobalData {
   GlobalData* onDevice{nullptr};
 };
 
+#ifdef USE_SINGLE_PRECISION_FLUX_SOLVERS
+// the flux solvers of the cells are stored in single precision to reduce the memory traffic of the kernels
+using FluxSolverReal = float;
+#else
+using FluxSolverReal = real;
+#endif
+
 // data for the cell local integration
 struct LocalIntegrationData {
+#ifdef USE_RECOMPUTED_STAR_MATRICES
+  // gradients of (xi, eta, zeta) with respect to (x, y, z), see seissol::kernels::starMatricesOf
+  real gradients[3][3];
+#ifdef ACL_DEVICE
+  // lambda, mu, 1 / rho, and 1 / rho for solids (0 for acoustic cells), see seissol::kernels::setStarCoefficients
+  real starCoefficients[4];
+#endif
+#else
   // star matrices
   real starMatrices[3][seissol::tensor::star::size(0)];
+#endif
 
   // flux solver for element local contribution
-  real nApNm1[4][seissol::tensor::AplusT::size()];
+  FluxSolverReal nApNm1[4][seissol::tensor::AplusT::size()];
 
   // equation-specific data
   //TODO(Lukas/Sebastian):
@@ -351,7 +406,7 @@ struct LocalIntegrationData {
 // data for the neighboring boundary integration
 struct NeighboringIntegrationData {
   // flux solver for the contribution of the neighboring elements
-  real nAmNm1[4][seissol::tensor::AminusT::size()];
+  FluxSolverReal nAmNm1[4][seissol::tensor::AminusT::size()];
 
   // equation-specific data
   //TODO(Lukas/Sebastian):
@@ -423,6 +478,19 @@ struct DRFaceInformation {
   bool     plusSideOnThisRank;
 };
 
+/**
+ * Time span in which the nucleation changes the friction state of a face,
+ * such that the friction solvers skip the nucleation outside of it.
+ **/
+struct DRNucleationWindow {
+  //! false if the nucleation stress vanishes at all points of the face
+  bool hasNucleationStress;
+  //! forced rupture (FL 16) does not affect the face before the earliest forced rupture time
+  double forcedRuptureBegin;
+  //! all points of the face are fully weakened after the latest forced rupture time + t_0
+  double forcedRuptureEnd;
+};
+
 struct DRGodunovData {
   real TinvT[seissol::tensor::TinvT::size()];
   real tractionPlusMatrix[seissol::tensor::tractionPlusMatrix::size()];
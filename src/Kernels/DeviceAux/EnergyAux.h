@@ -0,0 +1,64 @@
+#ifndef SEISSOL_DEVICEAUX_ENERGY_H
+#define SEISSOL_DEVICEAUX_ENERGY_H
+
+#include <Initializer/BasicTypedefs.hpp>
+#include <stddef.h>
+
+// NOTE: using c++14 because of cuda@10
+namespace seissol {
+namespace kernels {
+namespace device {
+namespace aux {
+namespace energy {
+//! Per-cell volume energies, in this order, see seissol::writer::EnergiesStorage
+constexpr unsigned NumVolumeEnergies = 5;
+enum VolumeEnergy : unsigned {
+  AcousticEnergy = 0,
+  AcousticKineticEnergy,
+  ElasticEnergy,
+  ElasticKineticEnergy,
+  PlasticMoment
+};
+
+/**
+ * Device pointers to the cells of an LTS tree whose volume energies are integrated.
+ **/
+struct VolumeEnergiesLayer {
+  // [cell][tensor::Q::size()]
+  const real* dofs;
+  // init::evalAtQP
+  const real* evalAtQP;
+  // [quadrature point]
+  const real* quadratureWeights;
+  // [cell], 6 * volume (i.e. the Jacobian determinant) or 0 if the cell is counted elsewhere
+  const real* jacobiDets;
+  // [cell]
+  const real* rho;
+  const real* lambda;
+  const real* mu;
+  // equivalent plastic strain of cell 0, the one of a cell is at pstrain[cell * pstrainSize];
+  // nullptr without plasticity
+  const real* pstrain;
+  unsigned pstrainSize;
+};
+
+/**
+ * Integrates the volume energies of all cells into energies[NumVolumeEnergies],
+ * see seissol::writer::EnergyOutput::addCellEnergies.
+ *
+ * @param cellEnergies scratch of numCells * NumVolumeEnergies doubles
+ * @param energies result in device memory
+ **/
+void computeVolumeEnergies(VolumeEnergiesLayer layer,
+                           size_t numCells,
+                           double* cellEnergies,
+                           double* energies,
+                           void* streamPtr);
+} // namespace energy
+} // namespace aux
+} // namespace device
+} // namespace kernels
+} // namespace seissol
+
+
+#endif // SEISSOL_DEVICEAUX_ENERGY_H
@@ -0,0 +1,80 @@
+#ifndef SEISSOL_DEVICEAUX_FRICTIONLAW_H
+#define SEISSOL_DEVICEAUX_FRICTIONLAW_H
+
+#include <Initializer/BasicTypedefs.hpp>
+#include <Model/common_datastructures.hpp>
+#include <stddef.h>
+
+// NOTE: using c++14 because of cuda@10
+namespace seissol {
+namespace kernels {
+namespace device {
+namespace aux {
+namespace friction_law {
+/**
+ * Device pointers to the data of a dynamic rupture layer.
+ * All per-face arrays start at the first face of the layer; see seissol::initializers::DynamicRupture.
+ **/
+struct LinearSlipWeakeningLayer {
+  // [face][CONVERGENCE_ORDER][tensor::QInterpolated::size()]
+  const real* QInterpolatedPlus;
+  const real* QInterpolatedMinus;
+  // [face][tensor::QInterpolated::size()]
+  real* imposedStatePlus;
+  real* imposedStateMinus;
+  const model::IsotropicWaveSpeeds* waveSpeedsPlus;
+  const model::IsotropicWaveSpeeds* waveSpeedsMinus;
+  // [face][numPaddedPoints]
+  real* mu;
+  real* slip;
+  real* slip1;
+  real* slip2;
+  real* slipRate1;
+  real* slipRate2;
+  real* tractionXY;
+  real* tractionXZ;
+  real* peakSlipRate;
+  real* ruptureTime;
+  real* dynStressTime;
+  bool* ruptureTimePending;
+  bool* dynStressTimePending;
+  const real* dC;
+  const real* muS;
+  const real* muD;
+  const real* cohesion;
+  const real* forcedRuptureTime;
+  // [face][6][numPaddedPoints]
+  real* initialStressInFaultCS;
+  const real* nucleationStressInFaultCS;
+  // see init::resample
+  const real* resampleMatrix;
+};
+
+//! Quantities which are the same for all faces of a layer
+struct LinearSlipWeakeningSettings {
+  double fullUpdateTime;
+  double deltaT[CONVERGENCE_ORDER];
+  double timeWeights[CONVERGENCE_ORDER];
+  //! increment of the nucleation stress for each time point (zero without nucleation)
+  double nucleationIncrement[CONVERGENCE_ORDER];
+  double t0;
+  bool hasForcedRuptureTime;
+  bool isInstantaneousHealingOn;
+};
+
+/**
+ * Linear slip weakening friction (FL 2 and 16) on the device,
+ * see seissol::dr::friction_law::LinearSlipWeakening.
+ **/
+void evaluateLinearSlipWeakening(LinearSlipWeakeningLayer layer,
+                                 LinearSlipWeakeningSettings settings,
+                                 size_t numFaces,
+                                 void* streamPtr);
+} // namespace friction_law
+} // namespace aux
+} // namespace device
+} // namespace kernels
+} // namespace seissol
+
+
+#endif // SEISSOL_DEVICEAUX_FRICTIONLAW_H
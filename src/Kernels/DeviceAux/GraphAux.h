@@ -0,0 +1,29 @@
+#ifndef SEISSOL_DEVICEAUX_GRAPH_H
+#define SEISSOL_DEVICEAUX_GRAPH_H
+
+// NOTE: using c++14 because of cuda@10
+namespace seissol {
+namespace kernels {
+namespace device {
+namespace aux {
+namespace graph {
+//! Returns true if the backend can capture the kernels launched to a stream into a graph.
+bool isCapableOfGraphCapturing();
+
+//! Starts capturing the kernels launched to the stream; returns false if the stream cannot be captured.
+bool beginCapture(void* streamPtr);
+
+//! Ends the capture and returns the instantiated graph, or nullptr if the capture failed.
+void* endCapture(void* streamPtr);
+
+//! Replays an instantiated graph in the stream.
+void launchGraph(void* graphInstance, void* streamPtr);
+
+void destroyGraph(void* graphInstance);
+} // namespace graph
+} // namespace aux
+} // namespace device
+} // namespace kernels
+} // namespace seissol
+
+#endif // SEISSOL_DEVICEAUX_GRAPH_H
@@ -0,0 +1,32 @@
+#ifndef SEISSOL_DEVICEAUX_PEER_H
+#define SEISSOL_DEVICEAUX_PEER_H
+
+#include <stddef.h>
+
+// NOTE: using c++14 because of cuda@10
+namespace seissol {
+namespace kernels {
+namespace device {
+namespace aux {
+namespace peer {
+/**
+ * Lets the kernels on deviceId access the memory of peerDeviceId directly (e.g. via NVLink or xGMI).
+ * Returns false if the devices are not connected; the unified memory is then migrated on access.
+ **/
+bool enablePeerAccess(int deviceId, int peerDeviceId);
+
+//! Migrates the unified memory [ptr, ptr + bytes) to the device, ordered in the stream.
+void prefetch(const void* ptr, size_t bytes, int deviceId, void* streamPtr);
+
+/**
+ * Advises the driver that the unified memory [ptr, ptr + bytes) is hardly written. The devices which read it keep
+ * copies, which are dropped instead of written back when the memory is evicted.
+ **/
+void adviseReadMostly(const void* ptr, size_t bytes);
+} // namespace peer
+} // namespace aux
+} // namespace device
+} // namespace kernels
+} // namespace seissol
+
+#endif // SEISSOL_DEVICEAUX_PEER_H
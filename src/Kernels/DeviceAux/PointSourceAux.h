@@ -0,0 +1,57 @@
+#ifndef SEISSOL_DEVICEAUX_POINTSOURCE_H
+#define SEISSOL_DEVICEAUX_POINTSOURCE_H
+
+#include <Initializer/BasicTypedefs.hpp>
+#include <stddef.h>
+
+// NOTE: using c++14 because of cuda@10
+namespace seissol {
+namespace kernels {
+namespace device {
+namespace aux {
+namespace point_sources {
+/**
+ * Device pointers to the point sources of a time cluster, see seissol::sourceterm::PointSources.
+ * The sources are ordered by cells; the sources of cell (mapping) i are [sourceOffsets[i], sourceOffsets[i+1]).
+ **/
+struct PointSourcesLayer {
+  // [mapping]
+  real** dofs;
+  // [mapping + 1]
+  const unsigned* sourceOffsets;
+  // [source][tensor::mInvJInvPhisAtSources::size()]
+  const real* mInvJInvPhisAtSources;
+  // [source][tensorSize], fault basis (NRF) or moment tensor (FSRM)
+  const real* tensor;
+  unsigned tensorSize;
+  // [source], NRF only
+  const real* area;
+  // [source][81], NRF only
+  const real* stiffnessTensor;
+  // piecewise linear slip rates, [3 * source + direction]
+  const unsigned* pieceOffsets;  // [3 * source + direction + 1]
+  const real* onsetTimes;
+  const real* samplingIntervals;
+  // [piece]
+  const real* slopes;
+  const real* intercepts;
+};
+
+/**
+ * Adds the point sources integrated over [fromTime, toTime] to the dofs of their cells,
+ * see seissol::sourceterm::addTimeIntegratedPointSourceNRF and addTimeIntegratedPointSourceFSRM.
+ **/
+void addPointSources(PointSourcesLayer layer,
+                     bool isNRF,
+                     double fromTime,
+                     double toTime,
+                     size_t numMappings,
+                     void* streamPtr);
+} // namespace point_sources
+} // namespace aux
+} // namespace device
+} // namespace kernels
+} // namespace seissol
+
+
+#endif // SEISSOL_DEVICEAUX_POINTSOURCE_H
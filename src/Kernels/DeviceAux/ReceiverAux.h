@@ -0,0 +1,46 @@
+#ifndef SEISSOL_DEVICEAUX_RECEIVER_H
+#define SEISSOL_DEVICEAUX_RECEIVER_H
+
+#include <Initializer/BasicTypedefs.hpp>
+#include <stddef.h>
+
+// NOTE: using c++14 because of cuda@10
+namespace seissol {
+namespace kernels {
+namespace device {
+namespace aux {
+namespace receivers {
+/**
+ * Device pointers to the receivers of a receiver cluster, see seissol::kernels::Receiver.
+ * The receivers are sampled from the time evaluated dofs of their cells.
+ **/
+struct ReceiversLayer {
+  // [cell][tensor::Q::size()]
+  const real* timeEvaluated;
+  // [receiver]
+  const unsigned* cells;
+  // [receiver][tensor::Q::Shape[0]]
+  const real* basisFunctions;
+  // [quantity], indices of the sampled quantities
+  const unsigned* quantities;
+  unsigned numQuantities;
+};
+
+/**
+ * Evaluates the time evaluated dofs at the receivers and writes one sample, i.e. the time followed by the
+ * sampled quantities, per receiver to samples[receiver * (1 + numQuantities)],
+ * see seissol::kernels::ReceiverCluster::appendSample.
+ **/
+void sampleReceivers(ReceiversLayer layer,
+                     double time,
+                     real* samples,
+                     size_t numReceivers,
+                     void* streamPtr);
+} // namespace receivers
+} // namespace aux
+} // namespace device
+} // namespace kernels
+} // namespace seissol
+
+
+#endif // SEISSOL_DEVICEAUX_RECEIVER_H
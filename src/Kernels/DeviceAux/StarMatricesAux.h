@@ -0,0 +1,47 @@
+#ifndef SEISSOL_DEVICEAUX_STARMATRICES_H
+#define SEISSOL_DEVICEAUX_STARMATRICES_H
+
+#include <Initializer/BasicTypedefs.hpp>
+#include <stddef.h>
+
+// NOTE: using c++14 because of cuda@10
+namespace seissol {
+namespace kernels {
+namespace device {
+namespace aux {
+namespace star_matrices {
+//! Nonzero entries of one transposed coefficient matrix of the elastic equations
+constexpr unsigned NUM_ENTRIES = 8;
+
+/**
+ * Positions of the entries of A^T, B^T and C^T in the storage of a star matrix,
+ * see starMatrixLayout in Equations/elastic/Kernels/Time.cpp.
+ * The entries of matrix d are ordered as in seissol::model::getTransposedCoefficientMatrix: the three normal
+ * stresses (-lambda - 2 mu for stress d, -lambda otherwise), the two shear stresses (-mu), velocity d (-1 / rho)
+ * and the two other velocities (-1 / rho for solids).
+ **/
+struct StarMatrixLayout {
+  // reals of one star matrix
+  unsigned size;
+  unsigned index[3][NUM_ENTRIES];
+};
+
+/**
+ * Computes the star matrices [3][layout.size] of each cell from the gradients [3][3] of its reference coordinates and
+ * its coefficients (lambda, mu, 1 / rho, 1 / rho for solids and 0 for acoustic cells), see
+ * seissol::kernels::computeStarMatrices and seissol::kernels::setStarCoefficients.
+ **/
+void recomputeStarMatrices(real** starMatrices,
+                           real** gradients,
+                           real** coefficients,
+                           StarMatrixLayout layout,
+                           size_t numElements,
+                           void* streamPtr);
+} // namespace star_matrices
+} // namespace aux
+} // namespace device
+} // namespace kernels
+} // namespace seissol
+
+
+#endif // SEISSOL_DEVICEAUX_STARMATRICES_H
@@ -0,0 +1,43 @@
+#ifndef SEISSOL_DEVICEAUX_STREAM_H
+#define SEISSOL_DEVICEAUX_STREAM_H
+
+// NOTE: using c++14 because of cuda@10
+namespace seissol {
+namespace kernels {
+namespace device {
+namespace aux {
+namespace stream {
+//! Returns true if the backend can create additional streams and order them with events.
+bool isCapableOfStreamsAndEvents();
+
+/**
+ * Creates a stream which does not synchronize implicitly with other streams.
+ * The device schedules the pending kernels of high priority streams first, if the backend supports priorities.
+ **/
+void* createStream(bool highPriority = false);
+void destroyStream(void* streamPtr);
+
+void* createEvent();
+void destroyEvent(void* eventPtr);
+
+//! Marks the current end of the stream; the event completes once all previous work of the stream is done.
+void recordEvent(void* eventPtr, void* streamPtr);
+
+//! Delays all work launched to the stream afterwards until the last record of the event completed.
+void waitEvent(void* streamPtr, void* eventPtr);
+
+//! Blocks the host until the last record of the event completed.
+void synchronizeEvent(void* eventPtr);
+
+//! Returns true if the last record of the event completed, without blocking the host.
+bool queryEvent(void* eventPtr);
+
+//! Blocks the host until all work of the stream is done.
+void synchronizeStream(void* streamPtr);
+} // namespace stream
+} // namespace aux
+} // namespace device
+} // namespace kernels
+} // namespace seissol
+
+#endif // SEISSOL_DEVICEAUX_STREAM_H
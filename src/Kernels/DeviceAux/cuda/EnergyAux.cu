@@ -0,0 +1,138 @@
+#include <Kernels/DeviceAux/EnergyAux.h>
+#include <init.h>
+
+
+// NOTE: using c++14 because of cuda@10
+namespace seissol {
+namespace kernels {
+namespace device {
+namespace aux {
+namespace energy {
+
+constexpr unsigned reductionBlockSize = 256;
+
+template<typename T>
+__forceinline__ __device__ T absValue(T x) {
+  return x < 0 ? -x : x;
+}
+
+//--------------------------------------------------------------------------------------------------
+// one block per cell, one thread per quadrature point
+__global__ void kernel_computeCellEnergies(VolumeEnergiesLayer layer, double* cellEnergies) {
+  constexpr unsigned numQuadraturePoints = tensor::evalAtQP::Shape[0];
+  constexpr unsigned numBasisFunctions = tensor::Q::Shape[0];
+  constexpr unsigned numQuantities = tensor::Q::Shape[1];
+  constexpr unsigned ldQ = init::Q::Stop[0] - init::Q::Start[0];
+  constexpr unsigned ldEvalAtQP = init::evalAtQP::Stop[0] - init::evalAtQP::Start[0];
+  static_assert(tensor::evalAtQP::Size == ldEvalAtQP * tensor::evalAtQP::Shape[1], "evalAtQP must be dense");
+
+  __shared__ double qpEnergies[PlasticMoment][numQuadraturePoints];
+
+  const unsigned cell = blockIdx.x;
+  const unsigned qp = threadIdx.x;
+  const real* dofs = layer.dofs + cell * tensor::Q::Size;
+  const real jacobiDet = layer.jacobiDets[cell];
+  const real rho = layer.rho[cell];
+  const real lambda = layer.lambda[cell];
+  const real mu = layer.mu[cell];
+
+  real q[numQuantities];
+  #pragma unroll
+  for (unsigned p = 0; p < numQuantities; ++p) {
+    real value = 0.0;
+    for (unsigned l = 0; l < numBasisFunctions; ++l) {
+      value += layer.evalAtQP[qp + l * ldEvalAtQP] * dofs[l + p * ldQ];
+    }
+    q[p] = value;
+  }
+
+  const double weight = jacobiDet * layer.quadratureWeights[qp];
+  const double kineticEnergy = 0.5 * rho * (q[6] * q[6] + q[7] * q[7] + q[8] * q[8]);
+  double energies[PlasticMoment] = {0.0, 0.0, 0.0, 0.0};
+  if (absValue(mu) < 10e-14) {
+    // acoustic, lambda is the bulk modulus
+    energies[AcousticEnergy] = weight * q[0] * q[0] / (2 * lambda);
+    energies[AcousticKineticEnergy] = weight * kineticEnergy;
+  } else {
+    // sum_ij sigma_ij * epsilon_ij with the strain of the isotropic Hooke's law
+    const double trace = q[0] + q[1] + q[2];
+    const double squaredNorm = q[0] * q[0] + q[1] * q[1] + q[2] * q[2] +
+                               2.0 * (q[3] * q[3] + q[4] * q[4] + q[5] * q[5]);
+    const double factor = -1.0 * lambda / (2.0 * mu * (3.0 * lambda + 2.0 * mu));
+    energies[ElasticEnergy] = weight * 0.5 * (factor * trace * trace + squaredNorm / (2.0 * mu));
+    energies[ElasticKineticEnergy] = weight * kineticEnergy;
+  }
+  #pragma unroll
+  for (unsigned e = 0; e < PlasticMoment; ++e) {
+    qpEnergies[e][qp] = energies[e];
+  }
+  __syncthreads();
+
+  if (qp < PlasticMoment) {
+    double sum = 0.0;
+    for (unsigned i = 0; i < numQuadraturePoints; ++i) {
+      sum += qpEnergies[qp][i];
+    }
+    cellEnergies[cell * NumVolumeEnergies + qp] = sum;
+  } else if (qp == PlasticMoment) {
+    double plasticMoment = 0.0;
+    if (layer.pstrain != nullptr) {
+      plasticMoment = mu * jacobiDet / 6.0 * layer.pstrain[cell * layer.pstrainSize];
+    }
+    cellEnergies[cell * NumVolumeEnergies + PlasticMoment] = plasticMoment;
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// one block, tree reduction over the cells
+__global__ void kernel_reduceEnergies(const double* cellEnergies, size_t numCells, double* energies) {
+  __shared__ double partialEnergies[NumVolumeEnergies][reductionBlockSize];
+
+  const unsigned tid = threadIdx.x;
+  double sums[NumVolumeEnergies] = {0.0, 0.0, 0.0, 0.0, 0.0};
+  for (size_t cell = tid; cell < numCells; cell += reductionBlockSize) {
+    #pragma unroll
+    for (unsigned e = 0; e < NumVolumeEnergies; ++e) {
+      sums[e] += cellEnergies[cell * NumVolumeEnergies + e];
+    }
+  }
+  #pragma unroll
+  for (unsigned e = 0; e < NumVolumeEnergies; ++e) {
+    partialEnergies[e][tid] = sums[e];
+  }
+  __syncthreads();
+
+  for (unsigned stride = reductionBlockSize / 2; stride > 0; stride /= 2) {
+    if (tid < stride) {
+      #pragma unroll
+      for (unsigned e = 0; e < NumVolumeEnergies; ++e) {
+        partialEnergies[e][tid] += partialEnergies[e][tid + stride];
+      }
+    }
+    __syncthreads();
+  }
+
+  if (tid < NumVolumeEnergies) {
+    energies[tid] = partialEnergies[tid][0];
+  }
+}
+
+void computeVolumeEnergies(VolumeEnergiesLayer layer,
+                           size_t numCells,
+                           double* cellEnergies,
+                           double* energies,
+                           void* streamPtr) {
+  auto stream = reinterpret_cast<cudaStream_t>(streamPtr);
+  if (numCells > 0) {
+    dim3 block(tensor::evalAtQP::Shape[0], 1, 1);
+    dim3 grid(numCells, 1, 1);
+    kernel_computeCellEnergies<<<grid, block, 0, stream>>>(layer, cellEnergies);
+  }
+  kernel_reduceEnergies<<<dim3(1, 1, 1), dim3(reductionBlockSize, 1, 1), 0, stream>>>(cellEnergies, numCells, energies);
+}
+
+} // namespace energy
+} // namespace aux
+} // namespace device
+} // namespace kernels
+} // namespace seissol
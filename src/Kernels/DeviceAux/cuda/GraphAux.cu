@@ -0,0 +1,52 @@
+#include <Kernels/DeviceAux/GraphAux.h>
+
+
+// NOTE: using c++14 because of cuda@10
+namespace seissol {
+namespace kernels {
+namespace device {
+namespace aux {
+namespace graph {
+bool isCapableOfGraphCapturing() {
+  return true;
+}
+
+bool beginCapture(void* streamPtr) {
+  auto stream = reinterpret_cast<cudaStream_t>(streamPtr);
+  // other threads (e.g. the communication thread) may use the runtime meanwhile
+  return cudaStreamBeginCapture(stream, cudaStreamCaptureModeThreadLocal) == cudaSuccess;
+}
+
+void* endCapture(void* streamPtr) {
+  auto stream = reinterpret_cast<cudaStream_t>(streamPtr);
+  cudaGraph_t graph{};
+  if (cudaStreamEndCapture(stream, &graph) != cudaSuccess) {
+    cudaGetLastError();
+    return nullptr;
+  }
+  cudaGraphExec_t instance{};
+#if CUDART_VERSION >= 12000
+  const auto status = cudaGraphInstantiate(&instance, graph, 0);
+#else
+  const auto status = cudaGraphInstantiate(&instance, graph, nullptr, nullptr, 0);
+#endif
+  cudaGraphDestroy(graph);
+  if (status != cudaSuccess) {
+    cudaGetLastError();
+    return nullptr;
+  }
+  return reinterpret_cast<void*>(instance);
+}
+
+void launchGraph(void* graphInstance, void* streamPtr) {
+  cudaGraphLaunch(reinterpret_cast<cudaGraphExec_t>(graphInstance), reinterpret_cast<cudaStream_t>(streamPtr));
+}
+
+void destroyGraph(void* graphInstance) {
+  cudaGraphExecDestroy(reinterpret_cast<cudaGraphExec_t>(graphInstance));
+}
+} // namespace graph
+} // namespace aux
+} // namespace device
+} // namespace kernels
+} // namespace seissol
@@ -0,0 +1,47 @@
+#include <Kernels/DeviceAux/PeerAux.h>
+
+
+// NOTE: using c++14 because of cuda@10
+namespace seissol {
+namespace kernels {
+namespace device {
+namespace aux {
+namespace peer {
+bool enablePeerAccess(int deviceId, int peerDeviceId) {
+  int canAccessPeer = 0;
+  cudaDeviceCanAccessPeer(&canAccessPeer, deviceId, peerDeviceId);
+  if (canAccessPeer == 0) {
+    return false;
+  }
+
+  int currentDeviceId = 0;
+  cudaGetDevice(&currentDeviceId);
+  cudaSetDevice(deviceId);
+  const cudaError_t error = cudaDeviceEnablePeerAccess(peerDeviceId, 0);
+  cudaSetDevice(currentDeviceId);
+  if (error == cudaErrorPeerAccessAlreadyEnabled) {
+    // clears the error state
+    cudaGetLastError();
+    return true;
+  }
+  return error == cudaSuccess;
+}
+
+void prefetch(const void* ptr, size_t bytes, int deviceId, void* streamPtr) {
+  if (ptr != nullptr && bytes > 0) {
+    cudaMemPrefetchAsync(ptr, bytes, deviceId, reinterpret_cast<cudaStream_t>(streamPtr));
+  }
+}
+
+void adviseReadMostly(const void* ptr, size_t bytes) {
+  if (ptr != nullptr && bytes > 0) {
+    int deviceId = 0;
+    cudaGetDevice(&deviceId);
+    cudaMemAdvise(ptr, bytes, cudaMemAdviseSetReadMostly, deviceId);
+  }
+}
+} // namespace peer
+} // namespace aux
+} // namespace device
+} // namespace kernels
+} // namespace seissol
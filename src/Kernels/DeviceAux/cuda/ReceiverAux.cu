@@ -0,0 +1,52 @@
+#include <Kernels/DeviceAux/ReceiverAux.h>
+#include <init.h>
+
+
+// NOTE: using c++14 because of cuda@10
+namespace seissol {
+namespace kernels {
+namespace device {
+namespace aux {
+namespace receivers {
+
+//--------------------------------------------------------------------------------------------------
+// one block per receiver, one thread per sampled quantity
+__global__ void kernel_sampleReceivers(ReceiversLayer layer, double time, real* samples) {
+  constexpr unsigned numBasisFunctions = tensor::Q::Shape[0];
+  constexpr unsigned ldQ = init::Q::Stop[0] - init::Q::Start[0];
+
+  const unsigned receiver = blockIdx.x;
+  const real* dofs = layer.timeEvaluated + layer.cells[receiver] * tensor::Q::Size;
+  const real* phi = layer.basisFunctions + receiver * numBasisFunctions;
+  real* sample = samples + receiver * (1 + layer.numQuantities);
+
+  if (threadIdx.x == 0) {
+    sample[0] = time;
+  }
+  for (unsigned quantity = threadIdx.x; quantity < layer.numQuantities; quantity += blockDim.x) {
+    const real* dofsOfQuantity = dofs + layer.quantities[quantity] * ldQ;
+    real value = 0.0;
+    for (unsigned basisFunction = 0; basisFunction < numBasisFunctions; ++basisFunction) {
+      value += dofsOfQuantity[basisFunction] * phi[basisFunction];
+    }
+    sample[1 + quantity] = value;
+  }
+}
+
+void sampleReceivers(ReceiversLayer layer,
+                     double time,
+                     real* samples,
+                     size_t numReceivers,
+                     void* streamPtr) {
+  constexpr unsigned numQuantities = tensor::Q::Shape[1];
+  dim3 block(numQuantities, 1, 1);
+  dim3 grid(numReceivers, 1, 1);
+  auto stream = reinterpret_cast<cudaStream_t>(streamPtr);
+  kernel_sampleReceivers<<<grid, block, 0, stream>>>(layer, time, samples);
+}
+
+} // namespace receivers
+} // namespace aux
+} // namespace device
+} // namespace kernels
+} // namespace seissol
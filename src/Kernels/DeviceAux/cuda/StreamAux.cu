@@ -0,0 +1,64 @@
+#include <Kernels/DeviceAux/StreamAux.h>
+
+
+// NOTE: using c++14 because of cuda@10
+namespace seissol {
+namespace kernels {
+namespace device {
+namespace aux {
+namespace stream {
+bool isCapableOfStreamsAndEvents() {
+  return true;
+}
+
+void* createStream(bool highPriority) {
+  cudaStream_t stream{};
+  if (highPriority) {
+    int leastPriority = 0;
+    int greatestPriority = 0;
+    cudaDeviceGetStreamPriorityRange(&leastPriority, &greatestPriority);
+    cudaStreamCreateWithPriority(&stream, cudaStreamNonBlocking, greatestPriority);
+  } else {
+    cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking);
+  }
+  return reinterpret_cast<void*>(stream);
+}
+
+void destroyStream(void* streamPtr) {
+  cudaStreamDestroy(reinterpret_cast<cudaStream_t>(streamPtr));
+}
+
+void* createEvent() {
+  cudaEvent_t event{};
+  cudaEventCreateWithFlags(&event, cudaEventDisableTiming);
+  return reinterpret_cast<void*>(event);
+}
+
+void destroyEvent(void* eventPtr) {
+  cudaEventDestroy(reinterpret_cast<cudaEvent_t>(eventPtr));
+}
+
+void recordEvent(void* eventPtr, void* streamPtr) {
+  cudaEventRecord(reinterpret_cast<cudaEvent_t>(eventPtr), reinterpret_cast<cudaStream_t>(streamPtr));
+}
+
+void waitEvent(void* streamPtr, void* eventPtr) {
+  cudaStreamWaitEvent(reinterpret_cast<cudaStream_t>(streamPtr), reinterpret_cast<cudaEvent_t>(eventPtr), 0);
+}
+
+void synchronizeEvent(void* eventPtr) {
+  cudaEventSynchronize(reinterpret_cast<cudaEvent_t>(eventPtr));
+}
+
+bool queryEvent(void* eventPtr) {
+  return cudaEventQuery(reinterpret_cast<cudaEvent_t>(eventPtr)) == cudaSuccess;
+}
+
+void synchronizeStream(void* streamPtr) {
+  cudaStreamSynchronize(reinterpret_cast<cudaStream_t>(streamPtr));
+}
+} // namespace stream
+} // namespace aux
+} // namespace device
+} // namespace kernels
+} // namespace seissol
@@ -0,0 +1,226 @@
+#include "hip/hip_runtime.h"
+#include <Kernels/DeviceAux/FrictionLawAux.h>
+#include <init.h>
+#include <cmath>
+#include <type_traits>
+
+
+// NOTE: using c++14 because of cuda@10
+namespace seissol {
+namespace kernels {
+namespace device {
+namespace aux {
+namespace friction_law {
+
+template<typename T>
+__forceinline__ __device__ typename std::enable_if<std::is_floating_point<T>::value, T>::type
+squareRoot(T x) {
+  return std::is_same<T, double>::value ? sqrt(x) : sqrtf(x);
+}
+
+template<typename T>
+__forceinline__ __device__ typename std::enable_if<std::is_floating_point<T>::value, T>::type
+maxValue(T x, T y) {
+  return std::is_same<T, double>::value ? fmax(x, y) : fmaxf(x, y);
+}
+
+template<typename T>
+__forceinline__ __device__ typename std::enable_if<std::is_floating_point<T>::value, T>::type
+minValue(T x, T y) {
+  return std::is_same<T, double>::value ? fmin(x, y) : fminf(x, y);
+}
+
+template<typename T>
+__forceinline__ __device__ typename std::enable_if<std::is_floating_point<T>::value, T>::type
+absValue(T x) {
+  return std::is_same<T, double>::value ? fabs(x) : fabsf(x);
+}
+
+template<typename Tensor>
+__forceinline__  __device__
+constexpr size_t leadDim() {
+  return Tensor::Stop[0] - Tensor::Start[0];
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// one block per face, one thread per (padded) Gauss point
+__global__ void kernel_evaluateLinearSlipWeakening(LinearSlipWeakeningLayer layer,
+                                                   LinearSlipWeakeningSettings settings) {
+  constexpr unsigned numPoints = tensor::QInterpolated::Shape[0];
+  constexpr unsigned ld = leadDim<init::QInterpolated>();
+  constexpr unsigned qSize = tensor::QInterpolated::Size;
+  constexpr unsigned numQuantities = qSize / ld;
+  constexpr real healingThreshold = 10e-14;
+
+  const size_t face = blockIdx.x;
+  const unsigned point = threadIdx.x;
+  const bool isActive = point < numPoints;
+
+  __shared__ real slipRateMagnitude[ld];
+
+  const model::IsotropicWaveSpeeds& plus = layer.waveSpeedsPlus[face];
+  const model::IsotropicWaveSpeeds& minus = layer.waveSpeedsMinus[face];
+  const real invZp = 1.0 / (plus.density * plus.pWaveVelocity);
+  const real invZs = 1.0 / (plus.density * plus.sWaveVelocity);
+  const real invZpNeig = 1.0 / (minus.density * minus.pWaveVelocity);
+  const real invZsNeig = 1.0 / (minus.density * minus.sWaveVelocity);
+  const real etaP = 1.0 / (invZp + invZpNeig);
+  const real etaS = 1.0 / (invZs + invZsNeig);
+
+  const real* qPFace = layer.QInterpolatedPlus + face * CONVERGENCE_ORDER * qSize;
+  const real* qMFace = layer.QInterpolatedMinus + face * CONVERGENCE_ORDER * qSize;
+  const size_t p = face * ld + point;
+  real* initialStress = layer.initialStressInFaultCS + face * 6 * ld;
+  const real* nucleationStress = layer.nucleationStressInFaultCS + face * 6 * ld;
+
+  real imposedPlus[6] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+  real imposedMinus[6] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+  real slipRate = 0.0;
+
+  double time = settings.fullUpdateTime;
+  for (unsigned timeIndex = 0; timeIndex < CONVERGENCE_ORDER; ++timeIndex) {
+    const real dt = settings.deltaT[timeIndex];
+    time += settings.deltaT[timeIndex];
+
+    if (isActive) {
+      if (settings.nucleationIncrement[timeIndex] != 0.0) {
+        #pragma unroll
+        for (unsigned i = 0; i < 6; ++i) {
+          initialStress[i * ld + point] += nucleationStress[i * ld + point] * settings.nucleationIncrement[timeIndex];
+        }
+      }
+
+      // Godunov state
+      const real* qP = qPFace + timeIndex * qSize;
+      const real* qM = qMFace + timeIndex * qSize;
+      const real normalStress = etaP * (qM[6 * ld + point] - qP[6 * ld + point] +
+                                        qP[0 * ld + point] * invZp + qM[0 * ld + point] * invZpNeig);
+      const real xyStress = etaS * (qM[7 * ld + point] - qP[7 * ld + point] +
+                                    qP[3 * ld + point] * invZs + qM[3 * ld + point] * invZsNeig);
+      const real xzStress = etaS * (qM[8 * ld + point] - qP[8 * ld + point] +
+                                    qP[5 * ld + point] * invZs + qM[5 * ld + point] * invZsNeig);
+
+      // friction
+      const real pressure = initialStress[0 * ld + point] + normalStress;
+      const real strength =
+          -layer.cohesion[p] - layer.mu[p] * minValue(pressure, static_cast<real>(0.0));
+      const real totalXY = initialStress[3 * ld + point] + xyStress;
+      const real totalXZ = initialStress[5 * ld + point] + xzStress;
+      const real shearStress = squareRoot(totalXY * totalXY + totalXZ * totalXZ);
+
+      slipRate = maxValue(static_cast<real>(0.0), (shearStress - strength) / etaS);
+      const real slipRate1 = slipRate * totalXY / (strength + etaS * slipRate);
+      const real slipRate2 = slipRate * totalXZ / (strength + etaS * slipRate);
+      const real tractionXY = xyStress - etaS * slipRate1;
+      const real tractionXZ = xzStress - etaS * slipRate2;
+      layer.slipRate1[p] = slipRate1;
+      layer.slipRate2[p] = slipRate2;
+      layer.tractionXY[p] = tractionXY;
+      layer.tractionXZ[p] = tractionXZ;
+      layer.slip1[p] += slipRate1 * dt;
+      layer.slip2[p] += slipRate2 * dt;
+
+      // imposed state
+      const real weight = settings.timeWeights[timeIndex];
+      imposedMinus[0] += weight * normalStress;
+      imposedMinus[1] += weight * tractionXY;
+      imposedMinus[2] += weight * tractionXZ;
+      imposedMinus[3] += weight * (qM[6 * ld + point] - invZpNeig * (normalStress - qM[0 * ld + point]));
+      imposedMinus[4] += weight * (qM[7 * ld + point] - invZsNeig * (tractionXY - qM[3 * ld + point]));
+      imposedMinus[5] += weight * (qM[8 * ld + point] - invZsNeig * (tractionXZ - qM[5 * ld + point]));
+      imposedPlus[0] += weight * normalStress;
+      imposedPlus[1] += weight * tractionXY;
+      imposedPlus[2] += weight * tractionXZ;
+      imposedPlus[3] += weight * (qP[6 * ld + point] + invZp * (normalStress - qP[0 * ld + point]));
+      imposedPlus[4] += weight * (qP[7 * ld + point] + invZs * (tractionXY - qP[3 * ld + point]));
+      imposedPlus[5] += weight * (qP[8 * ld + point] + invZs * (tractionXZ - qP[5 * ld + point]));
+    }
+    slipRateMagnitude[point] = isActive ? slipRate : static_cast<real>(0.0);
+    __syncthreads();
+
+    if (isActive) {
+      // resample slip rate, such that the state (slip) lies in the same polynomial space as the degrees of freedom
+      real resampledSlipRate = 0.0;
+      for (unsigned j = 0; j < numPoints; ++j) {
+        resampledSlipRate += layer.resampleMatrix[point + j * numPoints] * slipRateMagnitude[j];
+      }
+      const real slip = maxValue(static_cast<real>(0.0), layer.slip[p] + resampledSlipRate * dt);
+
+      const real f1 = minValue(absValue(slip) / layer.dC[p], static_cast<real>(1.0));
+      real f2 = 0.0;
+      if (settings.hasForcedRuptureTime) {
+        if (settings.t0 == 0) {
+          f2 = (time >= layer.forcedRuptureTime[p]) ? 1.0 : 0.0;
+        } else {
+          f2 = maxValue(static_cast<real>(0.0),
+                        minValue(static_cast<real>((time - layer.forcedRuptureTime[p]) / settings.t0),
+                                 static_cast<real>(1.0)));
+        }
+      }
+      real mu = layer.muS[p] - (layer.muS[p] - layer.muD[p]) * maxValue(f1, f2);
+      layer.slip[p] = slip;
+
+      if (settings.isInstantaneousHealingOn && slipRate < healingThreshold) {
+        mu = layer.muS[p];
+        layer.slip[p] = 0.0;
+      }
+      layer.mu[p] = mu;
+    }
+    __syncthreads();
+  }
+
+  if (isActive) {
+    // rupture front, peak slip rate and dynamic stress time
+    if (layer.ruptureTimePending[p] && slipRate > 0.001) {
+      layer.ruptureTime[p] = settings.fullUpdateTime;
+      layer.ruptureTimePending[p] = false;
+    }
+    layer.peakSlipRate[p] = maxValue(layer.peakSlipRate[p], slipRate);
+
+    if (layer.ruptureTime[p] > 0.0 && layer.ruptureTime[p] <= settings.fullUpdateTime &&
+        layer.dynStressTimePending[p] && absValue(layer.slip[p]) >= layer.dC[p]) {
+      layer.dynStressTime[p] = settings.fullUpdateTime;
+      layer.dynStressTimePending[p] = false;
+    }
+  }
+
+  // write the imposed state, including the padding and the unaffected quantities
+  real* imposedStatePlus = layer.imposedStatePlus + face * qSize;
+  real* imposedStateMinus = layer.imposedStateMinus + face * qSize;
+  for (unsigned quantity = 0; quantity < numQuantities; ++quantity) {
+    imposedStatePlus[quantity * ld + point] = 0.0;
+    imposedStateMinus[quantity * ld + point] = 0.0;
+  }
+  if (isActive) {
+    const unsigned quantities[6] = {0, 3, 5, 6, 7, 8};
+    #pragma unroll
+    for (unsigned i = 0; i < 6; ++i) {
+      imposedStatePlus[quantities[i] * ld + point] = imposedPlus[i];
+      imposedStateMinus[quantities[i] * ld + point] = imposedMinus[i];
+    }
+  }
+}
+
+void evaluateLinearSlipWeakening(LinearSlipWeakeningLayer layer,
+                                 LinearSlipWeakeningSettings settings,
+                                 size_t numFaces,
+                                 void* streamPtr) {
+  constexpr unsigned numPaddedPoints = init::QInterpolated::Stop[0] - init::QInterpolated::Start[0];
+  dim3 block(numPaddedPoints, 1, 1);
+  dim3 grid(numFaces, 1, 1);
+  auto stream = reinterpret_cast<hipStream_t>(streamPtr);
+  hipLaunchKernelGGL(kernel_evaluateLinearSlipWeakening,
+                     dim3(grid),
+                     dim3(block),
+                     0,
+                     stream,
+                     layer,
+                     settings);
+}
+
+} // namespace friction_law
+} // namespace aux
+} // namespace device
+} // namespace kernels
+} // namespace seissol
@@ -0,0 +1,49 @@
+#include "hip/hip_runtime.h"
+#include <Kernels/DeviceAux/GraphAux.h>
+
+
+// NOTE: using c++14 because of cuda@10
+namespace seissol {
+namespace kernels {
+namespace device {
+namespace aux {
+namespace graph {
+bool isCapableOfGraphCapturing() {
+  return true;
+}
+
+bool beginCapture(void* streamPtr) {
+  auto stream = reinterpret_cast<hipStream_t>(streamPtr);
+  // other threads (e.g. the communication thread) may use the runtime meanwhile
+  return hipStreamBeginCapture(stream, hipStreamCaptureModeThreadLocal) == hipSuccess;
+}
+
+void* endCapture(void* streamPtr) {
+  auto stream = reinterpret_cast<hipStream_t>(streamPtr);
+  hipGraph_t graph{};
+  if (hipStreamEndCapture(stream, &graph) != hipSuccess) {
+    hipGetLastError();
+    return nullptr;
+  }
+  hipGraphExec_t instance{};
+  const auto status = hipGraphInstantiate(&instance, graph, nullptr, nullptr, 0);
+  hipGraphDestroy(graph);
+  if (status != hipSuccess) {
+    hipGetLastError();
+    return nullptr;
+  }
+  return reinterpret_cast<void*>(instance);
+}
+
+void launchGraph(void* graphInstance, void* streamPtr) {
+  hipGraphLaunch(reinterpret_cast<hipGraphExec_t>(graphInstance), reinterpret_cast<hipStream_t>(streamPtr));
+}
+
+void destroyGraph(void* graphInstance) {
+  hipGraphExecDestroy(reinterpret_cast<hipGraphExec_t>(graphInstance));
+}
+} // namespace graph
+} // namespace aux
+} // namespace device
+} // namespace kernels
+} // namespace seissol
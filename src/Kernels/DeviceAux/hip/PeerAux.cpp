@@ -0,0 +1,48 @@
+#include "hip/hip_runtime.h"
+#include <Kernels/DeviceAux/PeerAux.h>
+
+
+// NOTE: using c++14 because of cuda@10
+namespace seissol {
+namespace kernels {
+namespace device {
+namespace aux {
+namespace peer {
+bool enablePeerAccess(int deviceId, int peerDeviceId) {
+  int canAccessPeer = 0;
+  hipDeviceCanAccessPeer(&canAccessPeer, deviceId, peerDeviceId);
+  if (canAccessPeer == 0) {
+    return false;
+  }
+
+  int currentDeviceId = 0;
+  hipGetDevice(&currentDeviceId);
+  hipSetDevice(deviceId);
+  const hipError_t error = hipDeviceEnablePeerAccess(peerDeviceId, 0);
+  hipSetDevice(currentDeviceId);
+  if (error == hipErrorPeerAccessAlreadyEnabled) {
+    // clears the error state
+    hipGetLastError();
+    return true;
+  }
+  return error == hipSuccess;
+}
+
+void prefetch(const void* ptr, size_t bytes, int deviceId, void* streamPtr) {
+  if (ptr != nullptr && bytes > 0) {
+    hipMemPrefetchAsync(ptr, bytes, deviceId, reinterpret_cast<hipStream_t>(streamPtr));
+  }
+}
+
+void adviseReadMostly(const void* ptr, size_t bytes) {
+  if (ptr != nullptr && bytes > 0) {
+    int deviceId = 0;
+    hipGetDevice(&deviceId);
+    hipMemAdvise(ptr, bytes, hipMemAdviseSetReadMostly, deviceId);
+  }
+}
+} // namespace peer
+} // namespace aux
+} // namespace device
+} // namespace kernels
+} // namespace seissol
@@ -0,0 +1,156 @@
+#include "hip/hip_runtime.h"
+#include <Kernels/DeviceAux/PointSourceAux.h>
+#include <init.h>
+#include <cmath>
+#include <type_traits>
+
+
+// NOTE: using c++14 because of cuda@10
+namespace seissol {
+namespace kernels {
+namespace device {
+namespace aux {
+namespace point_sources {
+
+template<typename T>
+__forceinline__ __device__ typename std::enable_if<std::is_floating_point<T>::value, T>::type
+maxValue(T x, T y) {
+  return std::is_same<T, double>::value ? fmax(x, y) : fmaxf(x, y);
+}
+
+template<typename T>
+__forceinline__ __device__ typename std::enable_if<std::is_floating_point<T>::value, T>::type
+minValue(T x, T y) {
+  return std::is_same<T, double>::value ? fmin(x, y) : fminf(x, y);
+}
+
+template<typename Tensor>
+__forceinline__  __device__
+constexpr size_t leadDim() {
+  return Tensor::Stop[0] - Tensor::Start[0];
+}
+
+// see seissol::sourceterm::computePwLFTimeIntegral
+__device__ real computePwLFTimeIntegral(const PointSourcesLayer& layer,
+                                        unsigned function,
+                                        double fromTime,
+                                        double toTime) {
+  const unsigned firstPiece = layer.pieceOffsets[function];
+  const int numberOfPieces = layer.pieceOffsets[function + 1] - firstPiece;
+  const real onsetTime = layer.onsetTimes[function];
+  const real samplingInterval = layer.samplingIntervals[function];
+
+  int fromIndex = (fromTime - onsetTime) / samplingInterval;
+  int toIndex = (toTime - onsetTime) / samplingInterval;
+  fromIndex = max(0, fromIndex);
+  toIndex = min(numberOfPieces - 1, toIndex);
+
+  real time = onsetTime + fromIndex * samplingInterval;
+  real integral = 0.0;
+  for (int j = fromIndex; j <= toIndex; ++j) {
+    const real tFrom = maxValue(static_cast<real>(fromTime), time);
+    time += samplingInterval;
+    const real tTo = minValue(static_cast<real>(toTime), time);
+    integral += 0.5 * layer.slopes[firstPiece + j] * (tTo * tTo - tFrom * tFrom) +
+                layer.intercepts[firstPiece + j] * (tTo - tFrom);
+  }
+  return integral;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// one block per cell, one thread per (padded) basis function
+__global__ void kernel_addPointSources(PointSourcesLayer layer,
+                                       bool isNRF,
+                                       double fromTime,
+                                       double toTime) {
+  constexpr unsigned numBasisFunctions = tensor::Q::Shape[0];
+  constexpr unsigned numQuantities = tensor::Q::Shape[1];
+  constexpr unsigned ldQ = leadDim<init::Q>();
+  constexpr unsigned phiSize = tensor::mInvJInvPhisAtSources::Size;
+  // (p, q) of the entries of the moment tensor in SeisSol ordering (xx, yy, zz, xy, yz, xz), see init::momentToNRF
+  constexpr unsigned momentP[6] = {0, 1, 2, 0, 1, 0};
+  constexpr unsigned momentQ[6] = {0, 1, 2, 1, 2, 2};
+
+  __shared__ real slip[3];
+  __shared__ real rotatedSlip[3];
+  __shared__ real moment[numQuantities];
+
+  real* dofs = layer.dofs[blockIdx.x];
+  const unsigned tid = threadIdx.x;
+
+  for (unsigned source = layer.sourceOffsets[blockIdx.x]; source < layer.sourceOffsets[blockIdx.x + 1]; ++source) {
+    const real* sourceTensor = layer.tensor + source * layer.tensorSize;
+    if (tid < (isNRF ? 3 : 1)) {
+      slip[tid] = computePwLFTimeIntegral(layer, 3 * source + tid, fromTime, toTime);
+    }
+    __syncthreads();
+
+    if (isNRF) {
+      if (tid < 3) {
+        real rotated = 0.0;
+        for (unsigned i = 0; i < 3; ++i) {
+          rotated += sourceTensor[tid + 3 * i] * slip[i];
+        }
+        rotatedSlip[tid] = rotated;
+      }
+      __syncthreads();
+
+      if (tid < numQuantities) {
+        real value = 0.0;
+        if (tid < 6) {
+          const real* stiffness = layer.stiffnessTensor + 81 * source;
+          const real* normal = sourceTensor + 6;
+          const unsigned pq = momentP[tid] + 3 * momentQ[tid];
+          for (unsigned j = 0; j < 3; ++j) {
+            for (unsigned i = 0; i < 3; ++i) {
+              value += stiffness[pq + 9 * i + 27 * j] * rotatedSlip[i] * normal[j];
+            }
+          }
+          value *= -layer.area[source];
+        }
+        moment[tid] = value;
+      }
+    } else if (tid < numQuantities) {
+      moment[tid] = slip[0] * sourceTensor[tid];
+    }
+    __syncthreads();
+
+    if (tid < numBasisFunctions) {
+      const real phi = layer.mInvJInvPhisAtSources[source * phiSize + tid];
+      #pragma unroll
+      for (unsigned p = 0; p < numQuantities; ++p) {
+        dofs[tid + p * ldQ] += phi * moment[p];
+      }
+    }
+    __syncthreads();
+  }
+}
+
+void addPointSources(PointSourcesLayer layer,
+                     bool isNRF,
+                     double fromTime,
+                     double toTime,
+                     size_t numMappings,
+                     void* streamPtr) {
+  constexpr unsigned ldQ = init::Q::Stop[0] - init::Q::Start[0];
+  constexpr unsigned numQuantities = tensor::Q::Shape[1];
+  dim3 block(ldQ > numQuantities ? ldQ : numQuantities, 1, 1);
+  dim3 grid(numMappings, 1, 1);
+  auto stream = reinterpret_cast<hipStream_t>(streamPtr);
+  hipLaunchKernelGGL(kernel_addPointSources,
+                     dim3(grid),
+                     dim3(block),
+                     0,
+                     stream,
+                     layer,
+                     isNRF,
+                     fromTime,
+                     toTime);
+}
+
+} // namespace point_sources
+} // namespace aux
+} // namespace device
+} // namespace kernels
+} // namespace seissol
@@ -0,0 +1,73 @@
+#include "hip/hip_runtime.h"
+#include <Kernels/DeviceAux/StarMatricesAux.h>
+
+
+// NOTE: using c++14 because of cuda@10
+namespace seissol {
+namespace kernels {
+namespace device {
+namespace aux {
+namespace star_matrices {
+
+// entry of the transposed coefficient matrix, up to the sign, see StarMatrixLayout
+__forceinline__ __device__ real coefficientOf(const real* coefficient, unsigned matrix, unsigned entry) {
+  if (entry < 3) {
+    return entry == matrix ? coefficient[0] + 2 * coefficient[1] : coefficient[0];
+  }
+  if (entry < 5) {
+    return coefficient[1];
+  }
+  return entry == 5 ? coefficient[2] : coefficient[3];
+}
+
+
+//--------------------------------------------------------------------------------------------------
+// one block per cell
+__global__ void kernel_recomputeStarMatrices(real** starMatrices,
+                                             real** gradients,
+                                             real** coefficients,
+                                             StarMatrixLayout layout) {
+  real* star = starMatrices[blockIdx.x];
+  const real* gradient = gradients[blockIdx.x];
+  const real* coefficient = coefficients[blockIdx.x];
+
+  for (unsigned i = threadIdx.x; i < 3 * layout.size; i += blockDim.x) {
+    star[i] = 0.0;
+  }
+  __syncthreads();
+
+  // the entries of A^T, B^T and C^T do not overlap, i.e. every entry of a star matrix is set by one thread at most
+  for (unsigned i = threadIdx.x; i < 3 * 3 * NUM_ENTRIES; i += blockDim.x) {
+    const unsigned dim = i / (3 * NUM_ENTRIES);
+    const unsigned matrix = (i / NUM_ENTRIES) % 3;
+    const unsigned entry = i % NUM_ENTRIES;
+    star[dim * layout.size + layout.index[matrix][entry]] =
+        -gradient[3 * dim + matrix] * coefficientOf(coefficient, matrix, entry);
+  }
+}
+
+void recomputeStarMatrices(real** starMatrices,
+                           real** gradients,
+                           real** coefficients,
+                           StarMatrixLayout layout,
+                           size_t numElements,
+                           void* streamPtr) {
+  dim3 block(3 * 3 * NUM_ENTRIES, 1, 1);
+  dim3 grid(numElements, 1, 1);
+  auto stream = reinterpret_cast<hipStream_t>(streamPtr);
+  hipLaunchKernelGGL(kernel_recomputeStarMatrices,
+                     dim3(grid),
+                     dim3(block),
+                     0,
+                     stream,
+                     starMatrices,
+                     gradients,
+                     coefficients,
+                     layout);
+}
+
+} // namespace star_matrices
+} // namespace aux
+} // namespace device
+} // namespace kernels
+} // namespace seissol
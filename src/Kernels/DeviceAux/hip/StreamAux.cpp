@@ -0,0 +1,65 @@
+#include "hip/hip_runtime.h"
+#include <Kernels/DeviceAux/StreamAux.h>
+
+
+// NOTE: using c++14 because of cuda@10
+namespace seissol {
+namespace kernels {
+namespace device {
+namespace aux {
+namespace stream {
+bool isCapableOfStreamsAndEvents() {
+  return true;
+}
+
+void* createStream(bool highPriority) {
+  hipStream_t stream{};
+  if (highPriority) {
+    int leastPriority = 0;
+    int greatestPriority = 0;
+    hipDeviceGetStreamPriorityRange(&leastPriority, &greatestPriority);
+    hipStreamCreateWithPriority(&stream, hipStreamNonBlocking, greatestPriority);
+  } else {
+    hipStreamCreateWithFlags(&stream, hipStreamNonBlocking);
+  }
+  return reinterpret_cast<void*>(stream);
+}
+
+void destroyStream(void* streamPtr) {
+  hipStreamDestroy(reinterpret_cast<hipStream_t>(streamPtr));
+}
+
+void* createEvent() {
+  hipEvent_t event{};
+  hipEventCreateWithFlags(&event, hipEventDisableTiming);
+  return reinterpret_cast<void*>(event);
+}
+
+void destroyEvent(void* eventPtr) {
+  hipEventDestroy(reinterpret_cast<hipEvent_t>(eventPtr));
+}
+
+void recordEvent(void* eventPtr, void* streamPtr) {
+  hipEventRecord(reinterpret_cast<hipEvent_t>(eventPtr), reinterpret_cast<hipStream_t>(streamPtr));
+}
+
+void waitEvent(void* streamPtr, void* eventPtr) {
+  hipStreamWaitEvent(reinterpret_cast<hipStream_t>(streamPtr), reinterpret_cast<hipEvent_t>(eventPtr), 0);
+}
+
+void synchronizeEvent(void* eventPtr) {
+  hipEventSynchronize(reinterpret_cast<hipEvent_t>(eventPtr));
+}
+
+bool queryEvent(void* eventPtr) {
+  return hipEventQuery(reinterpret_cast<hipEvent_t>(eventPtr)) == hipSuccess;
+}
+
+void synchronizeStream(void* streamPtr) {
+  hipStreamSynchronize(reinterpret_cast<hipStream_t>(streamPtr));
+}
+} // namespace stream
+} // namespace aux
+} // namespace device
+} // namespace kernels
+} // namespace seissol
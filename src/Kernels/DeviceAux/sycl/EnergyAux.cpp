@@ -0,0 +1,123 @@
+#include <Kernels/DeviceAux/EnergyAux.h>
+#include <init.h>
+#include <CL/sycl.hpp>
+
+
+namespace seissol::kernels::device::aux::energy {
+
+constexpr unsigned reductionBlockSize = 256;
+
+void computeVolumeEnergies(VolumeEnergiesLayer layer,
+                           size_t numCells,
+                           double* cellEnergies,
+                           double* energies,
+                           void* queuePtr) {
+  constexpr unsigned numQuadraturePoints = tensor::evalAtQP::Shape[0];
+  constexpr unsigned numBasisFunctions = tensor::Q::Shape[0];
+  constexpr unsigned numQuantities = tensor::Q::Shape[1];
+  constexpr unsigned ldQ = init::Q::Stop[0] - init::Q::Start[0];
+  constexpr unsigned ldEvalAtQP = init::evalAtQP::Stop[0] - init::evalAtQP::Start[0];
+  static_assert(tensor::evalAtQP::Size == ldEvalAtQP * tensor::evalAtQP::Shape[1], "evalAtQP must be dense");
+
+  auto queue = reinterpret_cast<cl::sycl::queue*>(queuePtr);
+
+  // one work group per cell, one work item per quadrature point
+  if (numCells > 0) {
+    cl::sycl::nd_range rng{{numQuadraturePoints * numCells}, {numQuadraturePoints}};
+    queue->submit([&](cl::sycl::handler &cgh) {
+      cl::sycl::accessor<double, 2, cl::sycl::access::mode::read_write, cl::sycl::access::target::local>
+          qpEnergies({PlasticMoment, numQuadraturePoints}, cgh);
+
+      cgh.parallel_for(rng, [=](cl::sycl::nd_item<1> item) {
+        const size_t cell = item.get_group().get_id(0);
+        const unsigned qp = item.get_local_id(0);
+        const real* dofs = layer.dofs + cell * tensor::Q::Size;
+        const real jacobiDet = layer.jacobiDets[cell];
+        const real rho = layer.rho[cell];
+        const real lambda = layer.lambda[cell];
+        const real mu = layer.mu[cell];
+
+        real q[numQuantities];
+        #pragma unroll
+        for (unsigned p = 0; p < numQuantities; ++p) {
+          real value = 0.0;
+          for (unsigned l = 0; l < numBasisFunctions; ++l) {
+            value += layer.evalAtQP[qp + l * ldEvalAtQP] * dofs[l + p * ldQ];
+          }
+          q[p] = value;
+        }
+
+        const double weight = jacobiDet * layer.quadratureWeights[qp];
+        const double kineticEnergy = 0.5 * rho * (q[6] * q[6] + q[7] * q[7] + q[8] * q[8]);
+        double qpEnergy[PlasticMoment] = {0.0, 0.0, 0.0, 0.0};
+        if (cl::sycl::fabs(mu) < 10e-14) {
+          // acoustic, lambda is the bulk modulus
+          qpEnergy[AcousticEnergy] = weight * q[0] * q[0] / (2 * lambda);
+          qpEnergy[AcousticKineticEnergy] = weight * kineticEnergy;
+        } else {
+          // sum_ij sigma_ij * epsilon_ij with the strain of the isotropic Hooke's law
+          const double trace = q[0] + q[1] + q[2];
+          const double squaredNorm = q[0] * q[0] + q[1] * q[1] + q[2] * q[2] +
+                                     2.0 * (q[3] * q[3] + q[4] * q[4] + q[5] * q[5]);
+          const double factor = -1.0 * lambda / (2.0 * mu * (3.0 * lambda + 2.0 * mu));
+          qpEnergy[ElasticEnergy] = weight * 0.5 * (factor * trace * trace + squaredNorm / (2.0 * mu));
+          qpEnergy[ElasticKineticEnergy] = weight * kineticEnergy;
+        }
+        for (unsigned e = 0; e < PlasticMoment; ++e) {
+          qpEnergies[e][qp] = qpEnergy[e];
+        }
+        item.barrier();
+
+        if (qp < PlasticMoment) {
+          double sum = 0.0;
+          for (unsigned i = 0; i < numQuadraturePoints; ++i) {
+            sum += qpEnergies[qp][i];
+          }
+          cellEnergies[cell * NumVolumeEnergies + qp] = sum;
+        } else if (qp == PlasticMoment) {
+          double plasticMoment = 0.0;
+          if (layer.pstrain != nullptr) {
+            plasticMoment = mu * jacobiDet / 6.0 * layer.pstrain[cell * layer.pstrainSize];
+          }
+          cellEnergies[cell * NumVolumeEnergies + PlasticMoment] = plasticMoment;
+        }
+      });
+    });
+  }
+
+  // one work group, tree reduction over the cells
+  cl::sycl::nd_range reductionRng{{reductionBlockSize}, {reductionBlockSize}};
+  queue->submit([&](cl::sycl::handler &cgh) {
+    cl::sycl::accessor<double, 2, cl::sycl::access::mode::read_write, cl::sycl::access::target::local>
+        partialEnergies({NumVolumeEnergies, reductionBlockSize}, cgh);
+
+    cgh.parallel_for(reductionRng, [=](cl::sycl::nd_item<1> item) {
+      const unsigned tid = item.get_local_id(0);
+      double sums[NumVolumeEnergies] = {0.0, 0.0, 0.0, 0.0, 0.0};
+      for (size_t cell = tid; cell < numCells; cell += reductionBlockSize) {
+        for (unsigned e = 0; e < NumVolumeEnergies; ++e) {
+          sums[e] += cellEnergies[cell * NumVolumeEnergies + e];
+        }
+      }
+      for (unsigned e = 0; e < NumVolumeEnergies; ++e) {
+        partialEnergies[e][tid] = sums[e];
+      }
+      item.barrier();
+
+      for (unsigned stride = reductionBlockSize / 2; stride > 0; stride /= 2) {
+        if (tid < stride) {
+          for (unsigned e = 0; e < NumVolumeEnergies; ++e) {
+            partialEnergies[e][tid] += partialEnergies[e][tid + stride];
+          }
+        }
+        item.barrier();
+      }
+
+      if (tid < NumVolumeEnergies) {
+        energies[tid] = partialEnergies[tid][0];
+      }
+    });
+  });
+}
+
+} // namespace seissol::kernels::device::aux::energy
@@ -0,0 +1,182 @@
+#include <Kernels/DeviceAux/FrictionLawAux.h>
+#include <init.h>
+#include <cmath>
+#include <CL/sycl.hpp>
+
+
+namespace seissol::kernels::device::aux::friction_law {
+
+template<typename Tensor>
+constexpr size_t leadDim() {
+  return Tensor::Stop[0] - Tensor::Start[0];
+}
+
+
+// one work group per face, one work item per (padded) Gauss point
+void evaluateLinearSlipWeakening(LinearSlipWeakeningLayer layer,
+                                 LinearSlipWeakeningSettings settings,
+                                 size_t numFaces,
+                                 void *queuePtr) {
+  constexpr unsigned numPoints = tensor::QInterpolated::Shape[0];
+  constexpr unsigned ld = leadDim<init::QInterpolated>();
+  constexpr unsigned qSize = tensor::QInterpolated::Size;
+  constexpr unsigned numQuantities = qSize / ld;
+  constexpr real healingThreshold = 10e-14;
+
+  auto queue = reinterpret_cast<cl::sycl::queue*>(queuePtr);
+  cl::sycl::nd_range rng{{ld * numFaces}, {ld}};
+
+  queue->submit([&](cl::sycl::handler &cgh) {
+    cl::sycl::accessor<real, 1, cl::sycl::access::mode::read_write, cl::sycl::access::target::local> slipRateMagnitude(ld, cgh);
+
+    cgh.parallel_for(rng, [=](cl::sycl::nd_item<1> item) {
+      const size_t face = item.get_group().get_id(0);
+      const unsigned point = item.get_local_id(0);
+      const bool isActive = point < numPoints;
+
+      const model::IsotropicWaveSpeeds& plus = layer.waveSpeedsPlus[face];
+      const model::IsotropicWaveSpeeds& minus = layer.waveSpeedsMinus[face];
+      const real invZp = 1.0 / (plus.density * plus.pWaveVelocity);
+      const real invZs = 1.0 / (plus.density * plus.sWaveVelocity);
+      const real invZpNeig = 1.0 / (minus.density * minus.pWaveVelocity);
+      const real invZsNeig = 1.0 / (minus.density * minus.sWaveVelocity);
+      const real etaP = 1.0 / (invZp + invZpNeig);
+      const real etaS = 1.0 / (invZs + invZsNeig);
+
+      const real* qPFace = layer.QInterpolatedPlus + face * CONVERGENCE_ORDER * qSize;
+      const real* qMFace = layer.QInterpolatedMinus + face * CONVERGENCE_ORDER * qSize;
+      const size_t p = face * ld + point;
+      real* initialStress = layer.initialStressInFaultCS + face * 6 * ld;
+      const real* nucleationStress = layer.nucleationStressInFaultCS + face * 6 * ld;
+
+      real imposedPlus[6] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+      real imposedMinus[6] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+      real slipRate = 0.0;
+
+      double time = settings.fullUpdateTime;
+      for (unsigned timeIndex = 0; timeIndex < CONVERGENCE_ORDER; ++timeIndex) {
+        const real dt = settings.deltaT[timeIndex];
+        time += settings.deltaT[timeIndex];
+
+        if (isActive) {
+          if (settings.nucleationIncrement[timeIndex] != 0.0) {
+            #pragma unroll
+            for (unsigned i = 0; i < 6; ++i) {
+              initialStress[i * ld + point] += nucleationStress[i * ld + point] * settings.nucleationIncrement[timeIndex];
+            }
+          }
+
+          // Godunov state
+          const real* qP = qPFace + timeIndex * qSize;
+          const real* qM = qMFace + timeIndex * qSize;
+          const real normalStress = etaP * (qM[6 * ld + point] - qP[6 * ld + point] +
+                                            qP[0 * ld + point] * invZp + qM[0 * ld + point] * invZpNeig);
+          const real xyStress = etaS * (qM[7 * ld + point] - qP[7 * ld + point] +
+                                        qP[3 * ld + point] * invZs + qM[3 * ld + point] * invZsNeig);
+          const real xzStress = etaS * (qM[8 * ld + point] - qP[8 * ld + point] +
+                                        qP[5 * ld + point] * invZs + qM[5 * ld + point] * invZsNeig);
+
+          // friction
+          const real pressure = initialStress[0 * ld + point] + normalStress;
+          const real strength =
+              -layer.cohesion[p] - layer.mu[p] * cl::sycl::fmin(pressure, static_cast<real>(0.0));
+          const real totalXY = initialStress[3 * ld + point] + xyStress;
+          const real totalXZ = initialStress[5 * ld + point] + xzStress;
+          const real shearStress = cl::sycl::sqrt(totalXY * totalXY + totalXZ * totalXZ);
+
+          slipRate = cl::sycl::fmax(static_cast<real>(0.0), (shearStress - strength) / etaS);
+          const real slipRate1 = slipRate * totalXY / (strength + etaS * slipRate);
+          const real slipRate2 = slipRate * totalXZ / (strength + etaS * slipRate);
+          const real tractionXY = xyStress - etaS * slipRate1;
+          const real tractionXZ = xzStress - etaS * slipRate2;
+          layer.slipRate1[p] = slipRate1;
+          layer.slipRate2[p] = slipRate2;
+          layer.tractionXY[p] = tractionXY;
+          layer.tractionXZ[p] = tractionXZ;
+          layer.slip1[p] += slipRate1 * dt;
+          layer.slip2[p] += slipRate2 * dt;
+
+          // imposed state
+          const real weight = settings.timeWeights[timeIndex];
+          imposedMinus[0] += weight * normalStress;
+          imposedMinus[1] += weight * tractionXY;
+          imposedMinus[2] += weight * tractionXZ;
+          imposedMinus[3] += weight * (qM[6 * ld + point] - invZpNeig * (normalStress - qM[0 * ld + point]));
+          imposedMinus[4] += weight * (qM[7 * ld + point] - invZsNeig * (tractionXY - qM[3 * ld + point]));
+          imposedMinus[5] += weight * (qM[8 * ld + point] - invZsNeig * (tractionXZ - qM[5 * ld + point]));
+          imposedPlus[0] += weight * normalStress;
+          imposedPlus[1] += weight * tractionXY;
+          imposedPlus[2] += weight * tractionXZ;
+          imposedPlus[3] += weight * (qP[6 * ld + point] + invZp * (normalStress - qP[0 * ld + point]));
+          imposedPlus[4] += weight * (qP[7 * ld + point] + invZs * (tractionXY - qP[3 * ld + point]));
+          imposedPlus[5] += weight * (qP[8 * ld + point] + invZs * (tractionXZ - qP[5 * ld + point]));
+        }
+        slipRateMagnitude[point] = isActive ? slipRate : static_cast<real>(0.0);
+        item.barrier();
+
+        if (isActive) {
+          // resample slip rate, such that the state (slip) lies in the same polynomial space as the degrees of freedom
+          real resampledSlipRate = 0.0;
+          for (unsigned j = 0; j < numPoints; ++j) {
+            resampledSlipRate += layer.resampleMatrix[point + j * numPoints] * slipRateMagnitude[j];
+          }
+          const real slip = cl::sycl::fmax(static_cast<real>(0.0), layer.slip[p] + resampledSlipRate * dt);
+
+          const real f1 = cl::sycl::fmin(cl::sycl::fabs(slip) / layer.dC[p], static_cast<real>(1.0));
+          real f2 = 0.0;
+          if (settings.hasForcedRuptureTime) {
+            if (settings.t0 == 0) {
+              f2 = (time >= layer.forcedRuptureTime[p]) ? 1.0 : 0.0;
+            } else {
+              f2 = cl::sycl::fmax(static_cast<real>(0.0),
+                                  cl::sycl::fmin(static_cast<real>((time - layer.forcedRuptureTime[p]) / settings.t0),
+                                                 static_cast<real>(1.0)));
+            }
+          }
+          real mu = layer.muS[p] - (layer.muS[p] - layer.muD[p]) * cl::sycl::fmax(f1, f2);
+          layer.slip[p] = slip;
+
+          if (settings.isInstantaneousHealingOn && slipRate < healingThreshold) {
+            mu = layer.muS[p];
+            layer.slip[p] = 0.0;
+          }
+          layer.mu[p] = mu;
+        }
+        item.barrier();
+      }
+
+      if (isActive) {
+        // rupture front, peak slip rate and dynamic stress time
+        if (layer.ruptureTimePending[p] && slipRate > 0.001) {
+          layer.ruptureTime[p] = settings.fullUpdateTime;
+          layer.ruptureTimePending[p] = false;
+        }
+        layer.peakSlipRate[p] = cl::sycl::fmax(layer.peakSlipRate[p], slipRate);
+
+        if (layer.ruptureTime[p] > 0.0 && layer.ruptureTime[p] <= settings.fullUpdateTime &&
+            layer.dynStressTimePending[p] && cl::sycl::fabs(layer.slip[p]) >= layer.dC[p]) {
+          layer.dynStressTime[p] = settings.fullUpdateTime;
+          layer.dynStressTimePending[p] = false;
+        }
+      }
+
+      // write the imposed state, including the padding and the unaffected quantities
+      real* imposedStatePlus = layer.imposedStatePlus + face * qSize;
+      real* imposedStateMinus = layer.imposedStateMinus + face * qSize;
+      for (unsigned quantity = 0; quantity < numQuantities; ++quantity) {
+        imposedStatePlus[quantity * ld + point] = 0.0;
+        imposedStateMinus[quantity * ld + point] = 0.0;
+      }
+      if (isActive) {
+        const unsigned quantities[6] = {0, 3, 5, 6, 7, 8};
+        #pragma unroll
+        for (unsigned i = 0; i < 6; ++i) {
+          imposedStatePlus[quantities[i] * ld + point] = imposedPlus[i];
+          imposedStateMinus[quantities[i] * ld + point] = imposedMinus[i];
+        }
+      }
+    });
+  });
+}
+
+} // namespace seissol::kernels::device::aux::friction_law
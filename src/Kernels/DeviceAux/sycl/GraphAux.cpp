@@ -0,0 +1,21 @@
+#include <Kernels/DeviceAux/GraphAux.h>
+
+
+// SYCL queues cannot be captured into graphs; the kernels are always launched directly
+namespace seissol::kernels::device::aux::graph {
+bool isCapableOfGraphCapturing() {
+  return false;
+}
+
+bool beginCapture(void* streamPtr) {
+  return false;
+}
+
+void* endCapture(void* streamPtr) {
+  return nullptr;
+}
+
+void launchGraph(void* graphInstance, void* streamPtr) {}
+
+void destroyGraph(void* graphInstance) {}
+} // namespace seissol::kernels::device::aux::graph
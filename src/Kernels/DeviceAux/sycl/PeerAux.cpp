@@ -0,0 +1,13 @@
+#include <Kernels/DeviceAux/PeerAux.h>
+
+
+// The time clusters keep using the default queue with SYCL, hence a rank drives one device
+namespace seissol::kernels::device::aux::peer {
+bool enablePeerAccess(int deviceId, int peerDeviceId) {
+  return false;
+}
+
+void prefetch(const void* ptr, size_t bytes, int deviceId, void* streamPtr) {}
+
+void adviseReadMostly(const void* ptr, size_t bytes) {}
+} // namespace seissol::kernels::device::aux::peer
@@ -0,0 +1,119 @@
+#include <Kernels/DeviceAux/PointSourceAux.h>
+#include <init.h>
+#include <cmath>
+#include <CL/sycl.hpp>
+
+
+namespace seissol::kernels::device::aux::point_sources {
+
+template<typename Tensor>
+constexpr size_t leadDim() {
+  return Tensor::Stop[0] - Tensor::Start[0];
+}
+
+// see seissol::sourceterm::computePwLFTimeIntegral
+real computePwLFTimeIntegral(const PointSourcesLayer& layer, unsigned function, double fromTime, double toTime) {
+  const unsigned firstPiece = layer.pieceOffsets[function];
+  const int numberOfPieces = layer.pieceOffsets[function + 1] - firstPiece;
+  const real onsetTime = layer.onsetTimes[function];
+  const real samplingInterval = layer.samplingIntervals[function];
+
+  int fromIndex = (fromTime - onsetTime) / samplingInterval;
+  int toIndex = (toTime - onsetTime) / samplingInterval;
+  fromIndex = cl::sycl::max(0, fromIndex);
+  toIndex = cl::sycl::min(numberOfPieces - 1, toIndex);
+
+  real time = onsetTime + fromIndex * samplingInterval;
+  real integral = 0.0;
+  for (int j = fromIndex; j <= toIndex; ++j) {
+    const real tFrom = cl::sycl::fmax(static_cast<real>(fromTime), time);
+    time += samplingInterval;
+    const real tTo = cl::sycl::fmin(static_cast<real>(toTime), time);
+    integral += 0.5 * layer.slopes[firstPiece + j] * (tTo * tTo - tFrom * tFrom) +
+                layer.intercepts[firstPiece + j] * (tTo - tFrom);
+  }
+  return integral;
+}
+
+
+// one work group per cell, one work item per (padded) basis function
+void addPointSources(PointSourcesLayer layer,
+                     bool isNRF,
+                     double fromTime,
+                     double toTime,
+                     size_t numMappings,
+                     void* queuePtr) {
+  constexpr unsigned numBasisFunctions = tensor::Q::Shape[0];
+  constexpr unsigned numQuantities = tensor::Q::Shape[1];
+  constexpr unsigned ldQ = leadDim<init::Q>();
+  constexpr unsigned phiSize = tensor::mInvJInvPhisAtSources::Size;
+  constexpr unsigned groupSize = ldQ > numQuantities ? ldQ : numQuantities;
+
+  auto queue = reinterpret_cast<cl::sycl::queue*>(queuePtr);
+  cl::sycl::nd_range rng{{groupSize * numMappings}, {groupSize}};
+
+  queue->submit([&](cl::sycl::handler &cgh) {
+    cl::sycl::accessor<real, 1, cl::sycl::access::mode::read_write, cl::sycl::access::target::local> slip(3, cgh);
+    cl::sycl::accessor<real, 1, cl::sycl::access::mode::read_write, cl::sycl::access::target::local> rotatedSlip(3, cgh);
+    cl::sycl::accessor<real, 1, cl::sycl::access::mode::read_write, cl::sycl::access::target::local> moment(numQuantities, cgh);
+
+    cgh.parallel_for(rng, [=](cl::sycl::nd_item<1> item) {
+      // (p, q) of the entries of the moment tensor in SeisSol ordering (xx, yy, zz, xy, yz, xz), see init::momentToNRF
+      const unsigned momentP[6] = {0, 1, 2, 0, 1, 0};
+      const unsigned momentQ[6] = {0, 1, 2, 1, 2, 2};
+
+      const size_t mapping = item.get_group().get_id(0);
+      const unsigned tid = item.get_local_id(0);
+      real* dofs = layer.dofs[mapping];
+
+      for (unsigned source = layer.sourceOffsets[mapping]; source < layer.sourceOffsets[mapping + 1]; ++source) {
+        const real* sourceTensor = layer.tensor + source * layer.tensorSize;
+        if (tid < (isNRF ? 3u : 1u)) {
+          slip[tid] = computePwLFTimeIntegral(layer, 3 * source + tid, fromTime, toTime);
+        }
+        item.barrier();
+
+        if (isNRF) {
+          if (tid < 3) {
+            real rotated = 0.0;
+            for (unsigned i = 0; i < 3; ++i) {
+              rotated += sourceTensor[tid + 3 * i] * slip[i];
+            }
+            rotatedSlip[tid] = rotated;
+          }
+          item.barrier();
+
+          if (tid < numQuantities) {
+            real value = 0.0;
+            if (tid < 6) {
+              const real* stiffness = layer.stiffnessTensor + 81 * source;
+              const real* normal = sourceTensor + 6;
+              const unsigned pq = momentP[tid] + 3 * momentQ[tid];
+              for (unsigned j = 0; j < 3; ++j) {
+                for (unsigned i = 0; i < 3; ++i) {
+                  value += stiffness[pq + 9 * i + 27 * j] * rotatedSlip[i] * normal[j];
+                }
+              }
+              value *= -layer.area[source];
+            }
+            moment[tid] = value;
+          }
+        } else if (tid < numQuantities) {
+          moment[tid] = slip[0] * sourceTensor[tid];
+        }
+        item.barrier();
+
+        if (tid < numBasisFunctions) {
+          const real phi = layer.mInvJInvPhisAtSources[source * phiSize + tid];
+          #pragma unroll
+          for (unsigned p = 0; p < numQuantities; ++p) {
+            dofs[tid + p * ldQ] += phi * moment[p];
+          }
+        }
+        item.barrier();
+      }
+    });
+  });
+}
+
+} // namespace seissol::kernels::device::aux::point_sources
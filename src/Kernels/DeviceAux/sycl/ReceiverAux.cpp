@@ -0,0 +1,44 @@
+#include <Kernels/DeviceAux/ReceiverAux.h>
+#include <init.h>
+#include <CL/sycl.hpp>
+
+
+namespace seissol::kernels::device::aux::receivers {
+
+// one work group per receiver, one work item per sampled quantity
+void sampleReceivers(ReceiversLayer layer,
+                     double time,
+                     real* samples,
+                     size_t numReceivers,
+                     void* queuePtr) {
+  constexpr unsigned numBasisFunctions = tensor::Q::Shape[0];
+  constexpr unsigned numQuantities = tensor::Q::Shape[1];
+  constexpr unsigned ldQ = init::Q::Stop[0] - init::Q::Start[0];
+
+  auto queue = reinterpret_cast<cl::sycl::queue*>(queuePtr);
+  cl::sycl::nd_range rng{{numQuantities * numReceivers}, {numQuantities}};
+
+  queue->submit([&](cl::sycl::handler &cgh) {
+    cgh.parallel_for(rng, [=](cl::sycl::nd_item<1> item) {
+      const size_t receiver = item.get_group().get_id(0);
+      const unsigned tid = item.get_local_id(0);
+      const real* dofs = layer.timeEvaluated + layer.cells[receiver] * tensor::Q::Size;
+      const real* phi = layer.basisFunctions + receiver * numBasisFunctions;
+      real* sample = samples + receiver * (1 + layer.numQuantities);
+
+      if (tid == 0) {
+        sample[0] = time;
+      }
+      for (unsigned quantity = tid; quantity < layer.numQuantities; quantity += numQuantities) {
+        const real* dofsOfQuantity = dofs + layer.quantities[quantity] * ldQ;
+        real value = 0.0;
+        for (unsigned basisFunction = 0; basisFunction < numBasisFunctions; ++basisFunction) {
+          value += dofsOfQuantity[basisFunction] * phi[basisFunction];
+        }
+        sample[1 + quantity] = value;
+      }
+    });
+  });
+}
+
+} // namespace seissol::kernels::device::aux::receivers
@@ -0,0 +1,54 @@
+#include <Kernels/DeviceAux/StarMatricesAux.h>
+#include <CL/sycl.hpp>
+
+
+namespace seissol::kernels::device::aux::star_matrices {
+
+// entry of the transposed coefficient matrix, up to the sign, see StarMatrixLayout
+inline real coefficientOf(const real* coefficient, unsigned matrix, unsigned entry) {
+  if (entry < 3) {
+    return entry == matrix ? coefficient[0] + 2 * coefficient[1] : coefficient[0];
+  }
+  if (entry < 5) {
+    return coefficient[1];
+  }
+  return entry == 5 ? coefficient[2] : coefficient[3];
+}
+
+
+// one work group per cell
+void recomputeStarMatrices(real** starMatrices,
+                           real** gradients,
+                           real** coefficients,
+                           StarMatrixLayout layout,
+                           size_t numElements,
+                           void* queuePtr) {
+  constexpr unsigned groupSize = 3 * 3 * NUM_ENTRIES;
+
+  auto queue = reinterpret_cast<cl::sycl::queue*>(queuePtr);
+  cl::sycl::nd_range rng{{groupSize * numElements}, {groupSize}};
+
+  queue->submit([&](cl::sycl::handler &cgh) {
+    cgh.parallel_for(rng, [=](cl::sycl::nd_item<1> item) {
+      const size_t element = item.get_group().get_id(0);
+      const unsigned tid = item.get_local_id(0);
+      real* star = starMatrices[element];
+      const real* gradient = gradients[element];
+      const real* coefficient = coefficients[element];
+
+      for (unsigned i = tid; i < 3 * layout.size; i += groupSize) {
+        star[i] = 0.0;
+      }
+      item.barrier();
+
+      // the entries of A^T, B^T and C^T do not overlap, i.e. every entry of a star matrix is set by one item at most
+      const unsigned dim = tid / (3 * NUM_ENTRIES);
+      const unsigned matrix = (tid / NUM_ENTRIES) % 3;
+      const unsigned entry = tid % NUM_ENTRIES;
+      star[dim * layout.size + layout.index[matrix][entry]] =
+          -gradient[3 * dim + matrix] * coefficientOf(coefficient, matrix, entry);
+    });
+  });
+}
+
+} // namespace seissol::kernels::device::aux::star_matrices
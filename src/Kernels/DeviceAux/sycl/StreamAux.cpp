@@ -0,0 +1,33 @@
+#include <Kernels/DeviceAux/StreamAux.h>
+
+
+// The time clusters keep using the default queue with SYCL
+namespace seissol::kernels::device::aux::stream {
+bool isCapableOfStreamsAndEvents() {
+  return false;
+}
+
+void* createStream(bool highPriority) {
+  return nullptr;
+}
+
+void destroyStream(void* streamPtr) {}
+
+void* createEvent() {
+  return nullptr;
+}
+
+void destroyEvent(void* eventPtr) {}
+
+void recordEvent(void* eventPtr, void* streamPtr) {}
+
+void waitEvent(void* streamPtr, void* eventPtr) {}
+
+void synchronizeEvent(void* eventPtr) {}
+
+bool queryEvent(void* eventPtr) {
+  return true;
+}
+
+void synchronizeStream(void* streamPtr) {}
+} // namespace seissol::kernels::device::aux::stream
@@ -0,0 +1,106 @@
+#include "DeviceContext.h"
+
+#include <algorithm>
+
+#include <Kernels/DeviceAux/StreamAux.h>
+#include <device.h>
+#include <utils/env.h>
+
+thread_local seissol::kernels::DeviceContext* seissol::kernels::DeviceContext::s_current = nullptr;
+
+seissol::kernels::DeviceContext::DeviceContext(bool ownStream, StreamPriority priority) {
+  if (ownStream && device::aux::stream::isCapableOfStreamsAndEvents()) {
+    m_stream = device::aux::stream::createStream(priority == StreamPriority::High);
+    m_ownsStream = true;
+  } else {
+    m_stream = ::device::DeviceInstance::getInstance().api->getDefaultStream();
+  }
+}
+
+seissol::kernels::DeviceContext::DeviceContext(bool ownStream, int deviceId, StreamPriority priority)
+    : m_deviceId(deviceId) {
+  Scope scope(*this);
+  if (ownStream && device::aux::stream::isCapableOfStreamsAndEvents()) {
+    m_stream = device::aux::stream::createStream(priority == StreamPriority::High);
+    m_ownsStream = true;
+  } else {
+    m_stream = ::device::DeviceInstance::getInstance().api->getDefaultStream();
+  }
+}
+
+seissol::kernels::DeviceContext::~DeviceContext() {
+  Scope scope(*this);
+  if (m_ownsStream) {
+    device::aux::stream::synchronizeStream(m_stream);
+    device::aux::stream::destroyStream(m_stream);
+  }
+  for (auto& chunk : m_chunks) {
+    ::device::DeviceInstance::getInstance().api->freeMem(chunk.base);
+  }
+}
+
+seissol::kernels::DeviceContext::Scope::Scope(DeviceContext& context) : m_previous(s_current) {
+  s_current = &context;
+  if (context.m_deviceId >= 0) {
+    auto& api = *::device::DeviceInstance::getInstance().api;
+    const int currentDeviceId = api.getDeviceId();
+    if (currentDeviceId != context.m_deviceId) {
+      m_previousDeviceId = currentDeviceId;
+      api.setDevice(context.m_deviceId);
+    }
+  }
+}
+
+seissol::kernels::DeviceContext::Scope::~Scope() {
+  if (m_previousDeviceId >= 0) {
+    ::device::DeviceInstance::getInstance().api->setDevice(m_previousDeviceId);
+  }
+  s_current = m_previous;
+}
+
+seissol::kernels::DeviceContext& seissol::kernels::DeviceContext::current() {
+  if (s_current == nullptr) {
+    static DeviceContext defaultContext(false);
+    return defaultContext;
+  }
+  return *s_current;
+}
+
+bool seissol::kernels::DeviceContext::clusterStreamsEnabled() {
+  static const bool enabled = utils::Env::get<int>("SEISSOL_DEVICE_CLUSTER_STREAMS", 0) != 0 &&
+                              device::aux::stream::isCapableOfStreamsAndEvents();
+  return enabled;
+}
+
+void* seissol::kernels::DeviceContext::getTemporaryMemory(std::size_t bytes) {
+  auto& device = ::device::DeviceInstance::getInstance();
+  if (!m_ownsStream) {
+    return device.api->getStackMemory(bytes);
+  }
+
+  bytes = (bytes + TemporaryAlignment - 1) / TemporaryAlignment * TemporaryAlignment;
+  std::size_t chunk = m_temporaries.empty() ? 0 : m_temporaries.back().first;
+  while (chunk < m_chunks.size() && m_chunks[chunk].offset + bytes > m_chunks[chunk].capacity) {
+    ++chunk;
+  }
+  if (chunk == m_chunks.size()) {
+    // chunks are never moved, as the kernels of previous launches may still use them
+    const std::size_t capacity = std::max(bytes, m_chunks.empty() ? bytes : 2 * m_chunks.back().capacity);
+    m_chunks.push_back({static_cast<char*>(device.api->allocGlobMem(capacity)), capacity, 0});
+  }
+  m_temporaries.emplace_back(chunk, m_chunks[chunk].offset);
+  void* memory = m_chunks[chunk].base + m_chunks[chunk].offset;
+  m_chunks[chunk].offset += bytes;
+  return memory;
+}
+
+void seissol::kernels::DeviceContext::popTemporaryMemory() {
+  if (!m_ownsStream) {
+    ::device::DeviceInstance::getInstance().api->popStackMemory();
+    return;
+  }
+  // the memory may be reused right away: later kernels of the same stream start after the current ones
+  const auto [chunk, offset] = m_temporaries.back();
+  m_chunks[chunk].offset = offset;
+  m_temporaries.pop_back();
+}
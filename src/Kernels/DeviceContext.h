@@ -0,0 +1,83 @@
+#ifndef SEISSOL_KERNELS_DEVICECONTEXT_H
+#define SEISSOL_KERNELS_DEVICECONTEXT_H
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace seissol::kernels {
+/**
+ * Stream and temporary memory of the batched device kernels.
+ *
+ * By default, the kernels run in the default stream and take their temporaries from the stack memory of the
+ * device library. A time cluster may own a context with a separate stream, such that the kernels of independent
+ * clusters overlap on the device. The temporaries of such a context come from private buffers, as the shared stack
+ * memory could be handed to another stream while the kernels of this stream still use it.
+ * The kernels use the context which is active on the calling thread, see Scope.
+ **/
+class DeviceContext {
+  public:
+  //! Priority of an own stream; the kernels of high priority streams are scheduled first on the device
+  enum class StreamPriority { Normal, High };
+
+  //! Activates the context on the calling thread and, for a context of another device, switches to that device.
+  class Scope {
+    public:
+    explicit Scope(DeviceContext& context);
+    ~Scope();
+    Scope(Scope const&) = delete;
+    Scope& operator=(Scope const&) = delete;
+
+    private:
+    DeviceContext* m_previous;
+    //! Device before the scope; negative if the scope did not switch the device
+    int m_previousDeviceId = -1;
+  };
+
+  //! Creates a context with a separate stream if requested and supported by the backend, else of the default stream.
+  explicit DeviceContext(bool ownStream, StreamPriority priority = StreamPriority::Normal);
+
+  /**
+   * Creates a context with a separate stream on the given device, for ranks which drive several devices.
+   * The stream, the temporaries and the kernels of the context belong to this device.
+   **/
+  DeviceContext(bool ownStream, int deviceId, StreamPriority priority = StreamPriority::Normal);
+  ~DeviceContext();
+  DeviceContext(DeviceContext const&) = delete;
+  DeviceContext& operator=(DeviceContext const&) = delete;
+
+  //! Context of the calling thread; the default stream outside of a Scope.
+  static DeviceContext& current();
+
+  //! True if the time clusters run in separate streams (SEISSOL_DEVICE_CLUSTER_STREAMS=1 and supported by the backend).
+  static bool clusterStreamsEnabled();
+
+  [[nodiscard]] void* stream() const { return m_stream; }
+  [[nodiscard]] bool hasOwnStream() const { return m_ownsStream; }
+  //! Device of the context; negative for the current device of the calling thread
+  [[nodiscard]] int deviceId() const { return m_deviceId; }
+
+  //! Device memory for the kernels launched to stream(); released in reverse order with popTemporaryMemory.
+  void* getTemporaryMemory(std::size_t bytes);
+  void popTemporaryMemory();
+
+  private:
+  struct Chunk {
+    char* base;
+    std::size_t capacity;
+    std::size_t offset;
+  };
+  static constexpr std::size_t TemporaryAlignment = 256;
+
+  void* m_stream = nullptr;
+  bool m_ownsStream = false;
+  int m_deviceId = -1;
+  std::vector<Chunk> m_chunks;
+  //! (chunk, offset before the allocation) of the active temporaries
+  std::vector<std::pair<std::size_t, std::size_t>> m_temporaries;
+
+  static thread_local DeviceContext* s_current;
+};
+} // namespace seissol::kernels
+
+#endif // SEISSOL_KERNELS_DEVICECONTEXT_H
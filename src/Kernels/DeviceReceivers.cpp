@@ -0,0 +1,153 @@
+#include "DeviceReceivers.h"
+
+#include <Kernels/DeviceAux/StreamAux.h>
+#include <Kernels/DeviceContext.h>
+#include <Kernels/Receiver.h>
+#include <generated_code/tensor.h>
+
+#include <device.h>
+#include <utils/logger.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace seissol::kernels {
+using namespace initializers::recording;
+
+DeviceReceivers::DeviceReceivers(std::vector<ReceiverCell> const& cells,
+                                 std::vector<unsigned> const& quantities,
+                                 std::size_t capacity)
+    : m_numberOfCells(cells.size()), m_capacity(std::clamp<std::size_t>(capacity, 1, MaxCapacity)) {
+  std::vector<unsigned> receiverCells;
+  std::vector<real> basisFunctions;
+  std::vector<real*> dofsPtrs(m_numberOfCells);
+  std::vector<real*> starPtrs(m_numberOfCells);
+#ifdef USE_RECOMPUTED_STAR_MATRICES
+  // the ADER kernel recomputes the star matrices, see Time::computeBatchedAder
+  auto* starMatrices = upload(std::vector<real>(m_numberOfCells * yateto::computeFamilySize<tensor::star>()));
+  std::vector<real*> starGradientsPtrs(m_numberOfCells);
+  std::vector<real*> starCoefficientsPtrs(m_numberOfCells);
+#endif
+  for (std::size_t cell = 0; cell < m_numberOfCells; ++cell) {
+    // dofs are allocated in unified memory on devices, i.e. the host pointers are valid on the device
+    auto const& data = cells[cell].data;
+    dofsPtrs[cell] = static_cast<real*>(data.dofs);
+#ifdef USE_RECOMPUTED_STAR_MATRICES
+    starPtrs[cell] = starMatrices + cell * yateto::computeFamilySize<tensor::star>();
+    starGradientsPtrs[cell] = data.localIntegrationOnDevice.gradients[0];
+    starCoefficientsPtrs[cell] = data.localIntegrationOnDevice.starCoefficients;
+#else
+    starPtrs[cell] = static_cast<real*>(data.localIntegrationOnDevice.starMatrices[0]);
+#endif
+    m_receiverIds.insert(m_receiverIds.end(), cells[cell].receivers.begin(), cells[cell].receivers.end());
+    receiverCells.insert(receiverCells.end(), cells[cell].receivers.size(), cell);
+    basisFunctions.insert(basisFunctions.end(), cells[cell].basisFunctions.begin(), cells[cell].basisFunctions.end());
+  }
+
+  // the time integrated dofs of the ADER kernel are not needed, hence their scratch holds the time evaluated dofs
+  auto* derivatives = upload(std::vector<real>(m_numberOfCells * yateto::computeFamilySize<tensor::dQ>()));
+  auto* timeEvaluated = upload(std::vector<real>(m_numberOfCells * tensor::Q::size()));
+  std::vector<real*> derivativesPtrs(m_numberOfCells);
+  std::vector<real*> timeEvaluatedPtrs(m_numberOfCells);
+  for (std::size_t cell = 0; cell < m_numberOfCells; ++cell) {
+    derivativesPtrs[cell] = derivatives + cell * yateto::computeFamilySize<tensor::dQ>();
+    timeEvaluatedPtrs[cell] = timeEvaluated + cell * tensor::Q::size();
+  }
+
+  ConditionalKey key(KernelNames::Time || KernelNames::Volume);
+  m_table[key].content[*EntityId::Dofs] = new BatchPointers(dofsPtrs);
+  m_table[key].content[*EntityId::Star] = new BatchPointers(starPtrs);
+  m_table[key].content[*EntityId::Idofs] = new BatchPointers(timeEvaluatedPtrs);
+  m_table[key].content[*EntityId::Derivatives] = new BatchPointers(derivativesPtrs);
+#ifdef USE_RECOMPUTED_STAR_MATRICES
+  m_table[key].content[*EntityId::StarGradients] = new BatchPointers(starGradientsPtrs);
+  m_table[key].content[*EntityId::StarCoefficients] = new BatchPointers(starCoefficientsPtrs);
+#endif
+
+  m_layer.timeEvaluated = timeEvaluated;
+  m_layer.cells = upload(receiverCells);
+  m_layer.basisFunctions = upload(basisFunctions);
+  m_layer.quantities = upload(quantities);
+  m_layer.numQuantities = quantities.size();
+
+  m_samples = upload(std::vector<real>(m_capacity * sampleSize()));
+  m_hostSamples.resize(m_capacity * sampleSize());
+}
+
+DeviceReceivers::~DeviceReceivers() {
+  for (void* memory : m_memory) {
+    ::device::DeviceInstance::getInstance().api->freeMem(memory);
+  }
+}
+
+bool DeviceReceivers::isSupported() {
+#ifdef MULTIPLE_SIMULATIONS
+  // the kernel does not evaluate the fused simulations
+  return false;
+#elif defined(USE_POROELASTIC)
+  // the batched space-time predictor needs the source terms of the local integration recorder
+  return false;
+#else
+  return true;
+#endif
+}
+
+void DeviceReceivers::sample(Time& timeKernel,
+                             std::vector<double> const& times,
+                             double expansionPoint,
+                             double timeStepWidth,
+                             std::vector<Receiver>& receivers) {
+  m_stream = DeviceContext::current().stream();
+
+  LocalTmp tmp;
+  timeKernel.computeBatchedAder(timeStepWidth, tmp, m_table);
+
+  auto& entry = m_table[ConditionalKey(KernelNames::Time || KernelNames::Volume)];
+  real** derivatives = entry.content[*EntityId::Derivatives]->getPointers();
+  real** timeEvaluated = entry.content[*EntityId::Idofs]->getPointers();
+  for (double time : times) {
+    if (m_numberOfSamples == m_capacity) {
+      flush(receivers);
+    }
+    timeKernel.computeBatchedTaylorExpansion(time, expansionPoint, derivatives, timeEvaluated, m_numberOfCells);
+    device::aux::receivers::sampleReceivers(
+        m_layer, time, m_samples + m_numberOfSamples * sampleSize(), m_receiverIds.size(), m_stream);
+    ++m_numberOfSamples;
+  }
+}
+
+void DeviceReceivers::flush(std::vector<Receiver>& receivers) {
+  if (m_numberOfSamples == 0) {
+    return;
+  }
+  device::aux::stream::synchronizeStream(m_stream);
+  ::device::DeviceInstance::getInstance().api->copyFrom(
+      m_hostSamples.data(), m_samples, m_numberOfSamples * sampleSize() * sizeof(real));
+
+  const std::size_t ncols = 1 + m_layer.numQuantities;
+  for (std::size_t sample = 0; sample < m_numberOfSamples; ++sample) {
+    for (std::size_t receiver = 0; receiver < m_receiverIds.size(); ++receiver) {
+      real const* values = m_hostSamples.data() + sample * sampleSize() + receiver * ncols;
+      for (std::size_t col = 0; col < ncols; ++col) {
+        if (!std::isfinite(values[col])) {
+          logError() << "Detected Inf/NaN in receiver output. Aborting.";
+        }
+      }
+      receivers[m_receiverIds[receiver]].append(values[0], values + 1, ncols - 1);
+    }
+  }
+  m_numberOfSamples = 0;
+}
+
+template <typename T>
+T* DeviceReceivers::upload(std::vector<T> const& data) {
+  if (data.empty()) {
+    return nullptr;
+  }
+  auto& api = *::device::DeviceInstance::getInstance().api;
+  void* memory = api.allocGlobMem(data.size() * sizeof(T));
+  api.copyTo(memory, data.data(), data.size() * sizeof(T));
+  m_memory.push_back(memory);
+  return static_cast<T*>(memory);
+}
+} // namespace seissol::kernels
@@ -0,0 +1,73 @@
+#ifndef SEISSOL_KERNELS_DEVICERECEIVERS_H
+#define SEISSOL_KERNELS_DEVICERECEIVERS_H
+
+#include <Kernels/Time.h>
+#include <Initializer/BatchRecorders/DataTypes/ConditionalTable.hpp>
+#include <Kernels/DeviceAux/ReceiverAux.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace seissol::kernels {
+struct Receiver;
+struct ReceiverCell;
+
+/**
+ * Samples the receivers of a receiver cluster on the device.
+ *
+ * The time derivatives of all receiver cells are computed by one batched ADER kernel per time step, and each
+ * sampling time costs one batched Taylor expansion and one kernel which evaluates all receivers. The samples are
+ * buffered on the device and copied to the output of the receivers by flush, i.e. at the synchronization points
+ * of the receiver writer (or earlier if the buffer is full).
+ **/
+class DeviceReceivers {
+  public:
+  /**
+   * @param cells receivers grouped by their cell
+   * @param capacity number of samples per receiver which fit into the device buffer, at most MaxCapacity
+   **/
+  DeviceReceivers(std::vector<ReceiverCell> const& cells,
+                  std::vector<unsigned> const& quantities,
+                  std::size_t capacity);
+  ~DeviceReceivers();
+  DeviceReceivers(DeviceReceivers const&) = delete;
+  DeviceReceivers& operator=(DeviceReceivers const&) = delete;
+
+  //! Upper bound of the capacity; fuller buffers are flushed before the synchronization point
+  static constexpr std::size_t MaxCapacity = 4096;
+
+  //! False if the receivers are sampled on the host (fused simulations)
+  static bool isSupported();
+
+  //! Launches the sampling at the given times to the stream of the current device context.
+  void sample(Time& timeKernel,
+              std::vector<double> const& times,
+              double expansionPoint,
+              double timeStepWidth,
+              std::vector<Receiver>& receivers);
+
+  //! Waits for the sampling and appends the buffered samples to the output of the receivers.
+  void flush(std::vector<Receiver>& receivers);
+
+  private:
+  template <typename T>
+  T* upload(std::vector<T> const& data);
+
+  std::size_t sampleSize() const { return m_receiverIds.size() * (1 + m_layer.numQuantities); }
+
+  device::aux::receivers::ReceiversLayer m_layer{};
+  initializers::recording::ConditionalBatchTableT m_table;
+  //! receiver id of the receivers in the order of the device buffers
+  std::vector<size_t> m_receiverIds;
+  std::size_t m_numberOfCells;
+  std::size_t m_capacity;
+  std::size_t m_numberOfSamples = 0;
+  //! [sample][receiver][1 + quantity]
+  real* m_samples = nullptr;
+  std::vector<real> m_hostSamples;
+  void* m_stream = nullptr;
+  std::vector<void*> m_memory;
+};
+} // namespace seissol::kernels
+
+#endif // SEISSOL_KERNELS_DEVICERECEIVERS_H
@@ -40,6 +40,7 @@
 
 #include "DynamicRupture.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cstring>
 #include <stdint.h>
@@ -78,8 +79,8 @@ void seissol::kernels::DynamicRupture::setGlobalData(const CompoundGlobalData& g
   m_gpuKrnlPrototype.V3mTo2n = global.onDevice->faceToNodalMatrices;
   m_timeKernel.setGlobalData(global);
 #endif
-  real points[NUMBER_OF_SPACE_QUADRATURE_POINTS][2];
-  seissol::quadrature::TriangleQuadrature(points, spaceWeights, CONVERGENCE_ORDER+1);
+  auto const& rule = seissol::quadrature::triangleQuadratureRule<real, CONVERGENCE_ORDER+1>();
+  std::copy_n(rule.weights, NUMBER_OF_SPACE_QUADRATURE_POINTS, spaceWeights);
 }
 
 
@@ -94,7 +94,7 @@ class seissol::kernels::Neighbor : public NeighborBase {
     void computeBatchedNeighborsIntegral(ConditionalBatchTableT &table);
 
     void flopsNeighborsIntegral(const FaceType i_faceTypes[4],
-                                const int i_neighboringIndices[4][2],
+                                const std::int8_t i_neighboringIndices[4][2],
                                 CellDRMapping const (&cellDrMapping)[4],
                                 unsigned int &o_nonZeroFlops,
                                 unsigned int &o_hardwareFlops,
@@ -48,13 +48,152 @@
 #include <generated_code/init.h>
 #include "common.hpp"
 
+#include <utils/env.h>
+
 #ifdef ACL_DEVICE
 #include "device.h"
 #include "DeviceAux/PlasticityAux.h"
+#include "DeviceContext.h"
 using namespace device;
 #endif
 
+namespace {
+#ifdef MULTIPLE_SIMULATIONS
+  constexpr unsigned NumberOfSimulations = MULTIPLE_SIMULATIONS;
+#else
+  constexpr unsigned NumberOfSimulations = 1;
+#endif
+  //! The fused simulations are the leading dimension of the modal and nodal stresses
+  constexpr unsigned NodeDimension = NumberOfSimulations > 1 ? 1 : 0;
+  constexpr unsigned NumberOfNodes = tensor::QStressNodal::Shape[NodeDimension];
+
+  //! Element (i, j) of simulation sim
+  template <typename View>
+  auto& element(View& view, unsigned sim, unsigned i, unsigned j) {
+#ifdef MULTIPLE_SIMULATIONS
+    return view(sim, i, j);
+#else
+    return view(i, j);
+#endif
+  }
+
+  //! Values of the basis functions at the nodes, i.e. the Vandermonde matrix in a plain layout
+  struct NodalBasis {
+    real values[NumberOfNodes][NUMBER_OF_BASIS_FUNCTIONS];
+  };
+
+  NodalBasis computeNodalBasis(GlobalData const* global) {
+    NodalBasis basis{};
+    real unitStress[tensor::QStress::size()] __attribute__((aligned(ALIGNMENT)));
+    real unitStressNodal[tensor::QStressNodal::size()] __attribute__((aligned(ALIGNMENT)));
+    auto unitView = init::QStress::view::create(unitStress);
+    auto nodalView = init::QStressNodal::view::create(unitStressNodal);
+    for (unsigned k = 0; k < NUMBER_OF_BASIS_FUNCTIONS; ++k) {
+      std::fill(unitStress, unitStress + tensor::QStress::size(), 0.0);
+      element(unitView, 0, k, 0) = 1.0;
+
+      kernel::plConvertToNodalNoLoading m2nKrnl;
+      m2nKrnl.v = global->vandermondeMatrix;
+      m2nKrnl.QStress = unitStress;
+      m2nKrnl.QStressNodal = unitStressNodal;
+      m2nKrnl.execute();
+
+      for (unsigned i = 0; i < NumberOfNodes; ++i) {
+        basis.values[i][k] = element(nodalView, 0, i, 0);
+      }
+    }
+    return basis;
+  }
+
+  //! The basis functions and nodes are the same for all cells
+  NodalBasis const& nodalBasis(GlobalData const* global) {
+    static const NodalBasis basis = computeNodalBasis(global);
+    return basis;
+  }
+
+  //! Range [mid - halfRange, mid + halfRange] of each basis function at the nodes
+  struct NodalRange {
+    real mid[NUMBER_OF_BASIS_FUNCTIONS];
+    real halfRange[NUMBER_OF_BASIS_FUNCTIONS];
+  };
+
+  NodalRange computeNodalRange(GlobalData const* global) {
+    NodalBasis const& basis = nodalBasis(global);
+    NodalRange range{};
+    for (unsigned k = 0; k < NUMBER_OF_BASIS_FUNCTIONS; ++k) {
+      real minValue = std::numeric_limits<real>::max();
+      real maxValue = std::numeric_limits<real>::lowest();
+      for (unsigned i = 0; i < NumberOfNodes; ++i) {
+        minValue = std::min(minValue, basis.values[i][k]);
+        maxValue = std::max(maxValue, basis.values[i][k]);
+      }
+      range.mid[k] = 0.5 * (maxValue + minValue);
+      range.halfRange[k] = 0.5 * (maxValue - minValue);
+    }
+    return range;
+  }
+
+  template <typename View>
+  bool isYieldingPossibleForSimulation(NodalRange const& range,
+                                       PlasticityData const* plasticityData,
+                                       View const& dofs,
+                                       unsigned sim) {
+    /* Every nodal stress s_{ij} + sigma0_{ij} lies in [center - radius, center + radius]. */
+    real center[6];
+    real radius[6];
+    real magnitude = 0.0;
+    for (unsigned q = 0; q < 6; ++q) {
+      center[q] = plasticityData->initialLoading[q];
+      radius[q] = 0.0;
+      for (unsigned k = 0; k < NUMBER_OF_BASIS_FUNCTIONS; ++k) {
+        const real dof = element(dofs, sim, k, q);
+        center[q] += range.mid[k] * dof;
+        radius[q] += range.halfRange[k] * std::abs(dof);
+      }
+      magnitude += std::abs(center[q]) + radius[q];
+    }
+
+    /* sqrt(I_2) is a norm of the deviatoric stresses and the deviatoric part is a projection,
+     * hence tau <= sqrt(I_2(center)) + sqrt(0.5 r_{ij} r_{ij}) for every node. */
+    const real meanStress = (center[0] + center[1] + center[2]) / 3.0;
+    const real meanRadius = (radius[0] + radius[1] + radius[2]) / 3.0;
+    const real centerSecondInvariant =
+        0.5 * ((center[0] - meanStress) * (center[0] - meanStress) +
+               (center[1] - meanStress) * (center[1] - meanStress) +
+               (center[2] - meanStress) * (center[2] - meanStress)) +
+        center[3] * center[3] + center[4] * center[4] + center[5] * center[5];
+    const real radiusSecondInvariant =
+        0.5 * (radius[0] * radius[0] + radius[1] * radius[1] + radius[2] * radius[2]) +
+        radius[3] * radius[3] + radius[4] * radius[4] + radius[5] * radius[5];
+    const real maxTau = std::sqrt(centerSecondInvariant) + std::sqrt(radiusSecondInvariant);
+
+    const real minTaulim = std::max((real) 0.0, plasticityData->cohesionTimesCosAngularFriction -
+                                                meanStress * plasticityData->sinAngularFriction -
+                                                meanRadius * std::abs(plasticityData->sinAngularFriction));
+
+    // The nodal transform is subject to rounding errors relative to the magnitude of the stresses
+    const real roundingMargin = 100 * std::numeric_limits<real>::epsilon() * magnitude;
+    return maxTau + roundingMargin > minTaulim;
+  }
+} // namespace
+
 namespace seissol::kernels {
+  bool Plasticity::isYieldingPossible(GlobalData const* global,
+                                      PlasticityData const* plasticityData,
+                                      real const degreesOfFreedom[tensor::Q::size()]) {
+    // The basis functions and nodes are the same for all cells
+    static const NodalRange range = computeNodalRange(global);
+
+    // The fused simulations share the mesh, hence the cell is updated if any of them may yield
+    auto dofs = init::Q::view::create(const_cast<real*>(degreesOfFreedom));
+    for (unsigned sim = 0; sim < NumberOfSimulations; ++sim) {
+      if (isYieldingPossibleForSimulation(range, plasticityData, dofs, sim)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
   unsigned Plasticity::computePlasticity(double oneMinusIntegratingFactor,
                                          double timeStepWidth,
                                          double T_v,
@@ -243,6 +382,101 @@ namespace seissol::kernels {
     return 0;
   }
 
+  bool Plasticity::useCellBlocks() {
+    static const bool cellBlocks = utils::Env::get<int>("SEISSOL_PLASTICITY_CELL_BLOCKS", 0) != 0;
+    return cellBlocks;
+  }
+
+  unsigned Plasticity::computePlasticityBlock(double oneMinusIntegratingFactor,
+                                              double timeStepWidth,
+                                              double T_v,
+                                              GlobalData const *global,
+                                              unsigned numberOfCells,
+                                              PlasticityData const* const plasticityData[],
+                                              real* const degreesOfFreedom[],
+                                              real* const pstrain[]) {
+    assert(numberOfCells <= BlockSize);
+    bool mayYield[BlockSize] = {};
+#ifdef MULTIPLE_SIMULATIONS
+    // The interleaved check assumes one simulation per cell
+    for (unsigned cell = 0; cell < numberOfCells; ++cell) {
+      mayYield[cell] = isYieldingPossible(global, plasticityData[cell], degreesOfFreedom[cell]);
+    }
+#else
+    NodalBasis const& basis = nodalBasis(global);
+
+    // Interleaved layout: the cells are the fastest index, padded cells are zero
+    real modalStress[NUMBER_OF_BASIS_FUNCTIONS][6][BlockSize] __attribute__((aligned(ALIGNMENT))) = {};
+    real initialLoading[6][BlockSize] __attribute__((aligned(ALIGNMENT))) = {};
+    real cohesionTimesCosAngularFriction[BlockSize] __attribute__((aligned(ALIGNMENT))) = {};
+    real sinAngularFriction[BlockSize] __attribute__((aligned(ALIGNMENT))) = {};
+    for (unsigned cell = 0; cell < numberOfCells; ++cell) {
+      for (unsigned q = 0; q < 6; ++q) {
+        for (unsigned k = 0; k < NUMBER_OF_BASIS_FUNCTIONS; ++k) {
+          modalStress[k][q][cell] = degreesOfFreedom[cell][q * NUMBER_OF_ALIGNED_BASIS_FUNCTIONS + k];
+        }
+        initialLoading[q][cell] = plasticityData[cell]->initialLoading[q];
+      }
+      cohesionTimesCosAngularFriction[cell] = plasticityData[cell]->cohesionTimesCosAngularFriction;
+      sinAngularFriction[cell] = plasticityData[cell]->sinAngularFriction;
+    }
+
+    // Same steps as the yield check of computePlasticity, for all cells at once
+    unsigned yielding[BlockSize] __attribute__((aligned(ALIGNMENT))) = {};
+    for (unsigned i = 0; i < NumberOfNodes; ++i) {
+      real nodalStress[6][BlockSize] __attribute__((aligned(ALIGNMENT)));
+      for (unsigned q = 0; q < 6; ++q) {
+#pragma omp simd
+        for (unsigned cell = 0; cell < BlockSize; ++cell) {
+          nodalStress[q][cell] = initialLoading[q][cell];
+        }
+        for (unsigned k = 0; k < NUMBER_OF_BASIS_FUNCTIONS; ++k) {
+          const real value = basis.values[i][k];
+#pragma omp simd
+          for (unsigned cell = 0; cell < BlockSize; ++cell) {
+            nodalStress[q][cell] += value * modalStress[k][q][cell];
+          }
+        }
+      }
+
+#pragma omp simd
+      for (unsigned cell = 0; cell < BlockSize; ++cell) {
+        const real meanStress = (nodalStress[0][cell] + nodalStress[1][cell] + nodalStress[2][cell]) / 3.0;
+        const real s0 = nodalStress[0][cell] - meanStress;
+        const real s1 = nodalStress[1][cell] - meanStress;
+        const real s2 = nodalStress[2][cell] - meanStress;
+        const real secondInvariant = 0.5 * (s0 * s0 + s1 * s1 + s2 * s2) +
+                                     nodalStress[3][cell] * nodalStress[3][cell] +
+                                     nodalStress[4][cell] * nodalStress[4][cell] +
+                                     nodalStress[5][cell] * nodalStress[5][cell];
+        const real tau = std::sqrt(secondInvariant);
+        const real taulim = std::max((real) 0.0, cohesionTimesCosAngularFriction[cell] -
+                                                 meanStress * sinAngularFriction[cell]);
+        // The nodal stresses may be rounded differently than in plConvertToNodal
+        const real roundingMargin = 100 * std::numeric_limits<real>::epsilon() * (std::abs(meanStress) + tau);
+        yielding[cell] |= (tau + roundingMargin > taulim) ? 1 : 0;
+      }
+    }
+    for (unsigned cell = 0; cell < numberOfCells; ++cell) {
+      mayYield[cell] = yielding[cell] != 0;
+    }
+#endif // MULTIPLE_SIMULATIONS
+
+    unsigned numberOfYieldingCells = 0;
+    for (unsigned cell = 0; cell < numberOfCells; ++cell) {
+      if (mayYield[cell]) {
+        numberOfYieldingCells += computePlasticity(oneMinusIntegratingFactor,
+                                                   timeStepWidth,
+                                                   T_v,
+                                                   global,
+                                                   plasticityData[cell],
+                                                   degreesOfFreedom[cell],
+                                                   pstrain[cell]);
+      }
+    }
+    return numberOfYieldingCells;
+  }
+
   unsigned Plasticity::computePlasticityBatched(double oneMinusIntegratingFactor,
                                                 double timeStepWidth,
                                                 double T_v,
@@ -257,7 +491,7 @@ namespace seissol::kernels {
 
     DeviceInstance &device = DeviceInstance::getInstance();
     ConditionalKey key(*KernelNames::Plasticity);
-    auto defaultStream = device.api->getDefaultStream();
+    auto stream = DeviceContext::current().stream();
 
     if (table.find(key) != table.end()) {
       unsigned stackMemCounter{0};
@@ -267,11 +501,11 @@ namespace seissol::kernels {
       //copy dofs for later comparison, only first dof of stresses required
       constexpr unsigned dofsSize = tensor::Q::Size;
       const size_t prevDofsSize = dofsSize * numElements * sizeof(real);
-      real *prevDofs = reinterpret_cast<real*>(device.api->getStackMemory(prevDofsSize));
+      real *prevDofs = reinterpret_cast<real*>(DeviceContext::current().getTemporaryMemory(prevDofsSize));
       ++stackMemCounter;
 
       real** dofsPtrs = (entry.content[*EntityId::Dofs])->getPointers();
-      device.algorithms.copyScatterToUniform(dofsPtrs, prevDofs, dofsSize, dofsSize, numElements, defaultStream);
+      device.algorithms.copyScatterToUniform(dofsPtrs, prevDofs, dofsSize, dofsSize, numElements, stream);
 
 
       // Convert modal to nodal
@@ -287,13 +521,13 @@ namespace seissol::kernels {
       m2nKrnl.QStressNodal = nodalStressTensors;
       m2nKrnl.replicateInitialLoadingM = global->replicateStresses;
       m2nKrnl.initialLoadingM = const_cast<const real**>(initLoad);
-      m2nKrnl.streamPtr = defaultStream;
+      m2nKrnl.streamPtr = stream;
       m2nKrnl.numElements = numElements;
       m2nKrnl.execute();
 
       // adjust deviatoric tensors
       auto *isAdjustableVector =
-          reinterpret_cast<unsigned*>(device.api->getStackMemory(numElements * sizeof(unsigned)));
+          reinterpret_cast<unsigned*>(DeviceContext::current().getTemporaryMemory(numElements * sizeof(unsigned)));
       ++stackMemCounter;
 
       device::aux::plasticity::adjustDeviatoricTensors(nodalStressTensors,
@@ -301,13 +535,13 @@ namespace seissol::kernels {
                                                        plasticityData,
                                                        oneMinusIntegratingFactor,
                                                        numElements,
-                                                       defaultStream);
+                                                       stream);
 
       // count how many elements needs to be adjusted
       unsigned numAdjustedElements = device.algorithms.reduceVector(isAdjustableVector,
                                                                     numElements,
                                                                     ::device::ReductionType::Add,
-                                                                    defaultStream);
+                                                                    stream);
 
       // convert back to modal (taking into account the adjustment)
       static_assert(kernel::gpu_plConvertToModal::TmpMaxMemRequiredInBytes == 0);
@@ -315,7 +549,7 @@ namespace seissol::kernels {
       n2mKrnl.vInv = global->vandermondeMatrixInverse;
       n2mKrnl.QStressNodal = const_cast<const real**>(nodalStressTensors);
       n2mKrnl.QStress = modalStressTensors;
-      n2mKrnl.streamPtr = defaultStream;
+      n2mKrnl.streamPtr = stream;
       n2mKrnl.flags = isAdjustableVector;
       n2mKrnl.numElements = numElements;
       n2mKrnl.execute();
@@ -323,17 +557,17 @@ namespace seissol::kernels {
 
       // prepare memory
       const size_t QEtaNodalSize = tensor::QEtaNodal::Size * numElements * sizeof(real);
-      real *QEtaNodal = reinterpret_cast<real*>(device.api->getStackMemory(QEtaNodalSize));
-      real **QEtaNodalPtrs = reinterpret_cast<real**>(device.api->getStackMemory(numElements * sizeof(real*)));
+      real *QEtaNodal = reinterpret_cast<real*>(DeviceContext::current().getTemporaryMemory(QEtaNodalSize));
+      real **QEtaNodalPtrs = reinterpret_cast<real**>(DeviceContext::current().getTemporaryMemory(numElements * sizeof(real*)));
 
       const size_t QEtaModalSize = tensor::QEtaModal::Size * numElements * sizeof(real);
-      real *QEtaModal = reinterpret_cast<real*>(device.api->getStackMemory(QEtaModalSize));
-      real **QEtaModalPtrs = reinterpret_cast<real**>(device.api->getStackMemory(numElements * sizeof(real*)));
+      real *QEtaModal = reinterpret_cast<real*>(DeviceContext::current().getTemporaryMemory(QEtaModalSize));
+      real **QEtaModalPtrs = reinterpret_cast<real**>(DeviceContext::current().getTemporaryMemory(numElements * sizeof(real*)));
 
       static_assert(tensor::QStress::Size == tensor::QStressNodal::Size);
       const size_t dUdTpstrainSize = tensor::QStressNodal::Size * numElements * sizeof(real);
-      real *dUdTpstrain = reinterpret_cast<real*>(device.api->getStackMemory(dUdTpstrainSize));
-      real **dUdTpstrainPtrs = reinterpret_cast<real**>(device.api->getStackMemory(numElements * sizeof(real*)));
+      real *dUdTpstrain = reinterpret_cast<real*>(DeviceContext::current().getTemporaryMemory(dUdTpstrainSize));
+      real **dUdTpstrainPtrs = reinterpret_cast<real**>(DeviceContext::current().getTemporaryMemory(numElements * sizeof(real*)));
 
       stackMemCounter += 6;
 
@@ -344,7 +578,7 @@ namespace seissol::kernels {
                                               dUdTpstrain,
                                               dUdTpstrainPtrs,
                                               numElements,
-                                              defaultStream);
+                                              stream);
 
       // ------------------------------------------------------------------------------
       real **pstrains = entry.content[*EntityId::Pstrains]->getPointers();
@@ -359,7 +593,7 @@ namespace seissol::kernels {
                                                timeStepWidth,
                                                isAdjustableVector,
                                                numElements,
-                                               defaultStream);
+                                               stream);
 
 
       // Convert modal to nodal
@@ -368,7 +602,7 @@ namespace seissol::kernels {
       m2nKrnl_dudt_pstrain.v = global->vandermondeMatrix;
       m2nKrnl_dudt_pstrain.QStress = const_cast<const real**>(dUdTpstrainPtrs);
       m2nKrnl_dudt_pstrain.QStressNodal = nodalStressTensors;
-      m2nKrnl_dudt_pstrain.streamPtr = defaultStream;
+      m2nKrnl_dudt_pstrain.streamPtr = stream;
       m2nKrnl_dudt_pstrain.flags = isAdjustableVector;
       m2nKrnl_dudt_pstrain.numElements = numElements;
       m2nKrnl_dudt_pstrain.execute();
@@ -377,7 +611,7 @@ namespace seissol::kernels {
                                                   QEtaModalPtrs,
                                                   isAdjustableVector,
                                                   numElements,
-                                                  defaultStream);
+                                                  stream);
 
       // Convert modal to nodal
       static_assert(kernel::gpu_plConvertEtaModal2Nodal::TmpMaxMemRequiredInBytes == 0);
@@ -385,7 +619,7 @@ namespace seissol::kernels {
       m2n_eta_Krnl.v = global->vandermondeMatrix;
       m2n_eta_Krnl.QEtaModal = const_cast<const real**>(QEtaModalPtrs);
       m2n_eta_Krnl.QEtaNodal = QEtaNodalPtrs;
-      m2n_eta_Krnl.streamPtr = defaultStream;
+      m2n_eta_Krnl.streamPtr = stream;
       m2n_eta_Krnl.flags = isAdjustableVector;
       m2n_eta_Krnl.numElements = numElements;
       m2n_eta_Krnl.execute();
@@ -396,7 +630,7 @@ namespace seissol::kernels {
                                                timeStepWidth,
                                                isAdjustableVector,
                                                numElements,
-                                               defaultStream);
+                                               stream);
 
       // Convert nodal to modal
       static_assert(kernel::gpu_plConvertEtaNodal2Modal::TmpMaxMemRequiredInBytes == 0);
@@ -404,7 +638,7 @@ namespace seissol::kernels {
       n2m_eta_Krnl.vInv = global->vandermondeMatrixInverse;
       n2m_eta_Krnl.QEtaNodal = const_cast<const real**>(QEtaNodalPtrs);
       n2m_eta_Krnl.QEtaModal = QEtaModalPtrs;
-      n2m_eta_Krnl.streamPtr = defaultStream;
+      n2m_eta_Krnl.streamPtr = stream;
       n2m_eta_Krnl.flags = isAdjustableVector;
       n2m_eta_Krnl.numElements = numElements;
       n2m_eta_Krnl.execute();
@@ -414,7 +648,7 @@ namespace seissol::kernels {
                                                   pstrains,
                                                   isAdjustableVector,
                                                   numElements,
-                                                  defaultStream);
+                                                  stream);
 
 
       // NOTE: Temp memory must be properly clean after using negative signed integers
@@ -423,10 +657,10 @@ namespace seissol::kernels {
       device.algorithms.fillArray(reinterpret_cast<char*>(isAdjustableVector),
                                   static_cast<char>(0),
                                   numElements * sizeof(int),
-                                  defaultStream);
+                                  stream);
 
       for (unsigned i = 0; i < stackMemCounter; ++i) {
-        device.api->popStackMemory();
+        DeviceContext::current().popTemporaryMemory();
       }
       return numAdjustedElements;
     }
@@ -440,6 +674,15 @@ namespace seissol::kernels {
 #endif // ACL_DEVICE
   }
 
+  void Plasticity::flopsYieldingPossible(long long &o_nonZeroFlops,
+                                         long long &o_hardwareFlops) {
+    // center and radius (2 mul, 2 add, abs NOT counted)
+    o_nonZeroFlops = 4 * 6 * NUMBER_OF_BASIS_FUNCTIONS;
+    // mean and second invariants (27), tau (3, sqrt counted as 1), taulim and margin (6)
+    o_nonZeroFlops += 36;
+    o_hardwareFlops = o_nonZeroFlops;
+  }
+
   void Plasticity::flopsPlasticity(long long &o_NonZeroFlopsCheck,
                                    long long &o_HardwareFlopsCheck,
                                    long long &o_NonZeroFlopsYield,
@@ -65,6 +65,27 @@ public:
                                      real                        degreesOfFreedom[tensor::Q::size()],
                                      real*                       pstrain);
 
+  //! Number of cells whose yield check is vectorized in computePlasticityBlock
+  static constexpr unsigned BlockSize = ALIGNMENT / sizeof(real);
+
+  //! Returns true if the host uses computePlasticityBlock (SEISSOL_PLASTICITY_CELL_BLOCKS=1).
+  static bool useCellBlocks();
+
+  /**
+   * Like computePlasticity for up to BlockSize cells.
+   * The nodal stresses of all cells are computed in an interleaved layout, such that the yield check
+   * is vectorized over the cells; only the yielding cells are updated by computePlasticity.
+   * Returns the number of cells with plastic yielding.
+   **/
+  static unsigned computePlasticityBlock(double                      oneMinusIntegratingFactor,
+                                         double                      timeStepWidth,
+                                         double                      T_v,
+                                         GlobalData const*           global,
+                                         unsigned                    numberOfCells,
+                                         PlasticityData const* const plasticityData[],
+                                         real* const                 degreesOfFreedom[],
+                                         real* const                 pstrain[]);
+
   static unsigned computePlasticityBatched(double relaxTime,
                                            double timeStepWidth,
                                            double T_v,
@@ -72,6 +93,29 @@ public:
                                            initializers::recording::ConditionalBatchTableT &table,
                                            PlasticityData *plasticity);
 
+  //! Cohesions (times the cosine of the friction angle) from this value on are infinite
+  static constexpr real InfiniteCohesion = 1e30;
+
+  /**
+   * Returns false for elastic cells outside of the plastic regions, i.e. for an infinite cohesion
+   * (plastCo: .inf in the material file). Such cells never yield and skip all plasticity computations.
+   **/
+  static bool isPlasticCell(PlasticityData const* plasticityData) {
+    return plasticityData->cohesionTimesCosAngularFriction < InfiniteCohesion;
+  }
+
+  /**
+   * Returns false if no node of the cell can yield, such that computePlasticity can be skipped.
+   * The nodal stresses are bounded with the modal degrees of freedom and the range of the
+   * basis functions at the nodes, thus the check is conservative and much cheaper than the nodal transform.
+   **/
+  static bool isYieldingPossible(GlobalData const*           global,
+                                 PlasticityData const*       plasticityData,
+                                 real const                  degreesOfFreedom[tensor::Q::size()]);
+
+  static void flopsYieldingPossible(long long& o_nonZeroFlops,
+                                    long long& o_hardwareFlops);
+
   static void flopsPlasticity(  long long&  o_nonZeroFlopsCheck,
                                 long long&  o_hardwareFlopsCheck,
                                 long long&  o_nonZeroFlopsYield,
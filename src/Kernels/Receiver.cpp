@@ -44,8 +44,12 @@
 #include <Numerical_aux/Transformation.h>
 #include <Parallel/MPI.h>
 #include <Monitoring/FlopCounter.hpp>
+#include <Parallel/Tasking.h>
 #include <generated_code/kernel.h>
 
+#include <algorithm>
+#include <cassert>
+
 void seissol::kernels::ReceiverCluster::addReceiver(  unsigned                          meshId,
                                                       unsigned                          pointId,
                                                       Eigen::Vector3d const&            point,
@@ -61,120 +65,219 @@ void seissol::kernels::ReceiverCluster::addReceiver(  unsigned
   }
   auto xiEtaZeta = seissol::transformations::tetrahedronGlobalToReference(coords[0], coords[1], coords[2], coords[3], point);
 
-  // (time + number of quantities) * number of samples until sync point
-  size_t reserved = ncols() * (m_syncPointInterval / m_samplingInterval + 1);
-  m_receivers.emplace_back( pointId,
-                            xiEtaZeta[0],
-                            xiEtaZeta[1],
-                            xiEtaZeta[2],
-                            kernels::LocalData::lookup(lts, ltsLut, meshId),
-                            reserved);
+  addReceiver( pointId,
+               {xiEtaZeta[0], xiEtaZeta[1], xiEtaZeta[2]},
+               kernels::LocalData::lookup(lts, ltsLut, meshId),
+#if defined(USE_STP) || defined(ACL_DEVICE)
+               nullptr
+#else
+               ltsLut.lookup(lts.derivatives, meshId)
+#endif
+               );
 }
 
-double seissol::kernels::ReceiverCluster::calcReceivers(  double time,
-                                                          double expansionPoint,
-                                                          double timeStepWidth ) {
-#ifdef USE_STP
-  alignas(ALIGNMENT) real timeEvaluated[tensor::Q::size()];
-  alignas(PAGESIZE_STACK) real stp[tensor::spaceTimePredictor::size()];
-  alignas(ALIGNMENT) real timeEvaluatedAtPoint[tensor::QAtPoint::size()];
+void seissol::kernels::ReceiverCluster::addReceiver(  unsigned                      pointId,
+                                                      std::array<double, 3> const&  xiEtaZeta,
+                                                      kernels::LocalData const&     data,
+                                                      real const*                   derivatives ) {
+  // (time + number of quantities) * number of samples until sync point
+  const double outputInterval = (m_decimation != nullptr) ? m_decimation->outputInterval() : m_samplingInterval;
+  size_t reserved = ncols() * (m_syncPointInterval / outputInterval + 1);
+  m_receivers.emplace_back(pointId, reserved);
+  if (m_decimation != nullptr) {
+    m_receivers.back().decimation.emplace(m_decimation, ncols() - 1);
+  }
 
-  kernel::evaluateDOFSAtPointSTP krnl;
-  krnl.QAtPoint = timeEvaluatedAtPoint;
-  krnl.spaceTimePredictor = stp;
+  auto& cells = (derivatives != nullptr) ? m_cellsWithDerivatives : m_cellsWithoutDerivatives;
+  auto cell = m_cellOfDofs.find(data.dofs);
+  if (cell == m_cellOfDofs.end()) {
+    cell = m_cellOfDofs.emplace(data.dofs, cells.size()).first;
+    cells.emplace_back(data, derivatives);
+  }
+  auto& receiverCell = cells[cell->second];
+  receiverCell.receivers.push_back(m_receivers.size() - 1);
 
-  auto qAtPoint = init::QAtPoint::view::create(timeEvaluatedAtPoint);
+  basisFunction::SampledBasisFunctions<real> basisFunctions(CONVERGENCE_ORDER, xiEtaZeta[0], xiEtaZeta[1], xiEtaZeta[2]);
+  assert(basisFunctions.m_data.size() == tensor::Q::Shape[0]);
+  receiverCell.basisFunctions.insert(receiverCell.basisFunctions.end(),
+                                     basisFunctions.m_data.begin(),
+                                     basisFunctions.m_data.end());
+}
 
-  double receiverTime = time;
+std::vector<double> seissol::kernels::ReceiverCluster::samplingTimes( double time,
+                                                                     double expansionPoint,
+                                                                     double timeStepWidth ) const {
+  std::vector<double> times;
   if (time >= expansionPoint && time < expansionPoint + timeStepWidth) {
-    for (auto& receiver : m_receivers) {
-      krnl.basisFunctionsAtPoint = receiver.basisFunctions.m_data.data();
-
-      m_timeKernel.executeSTP(timeStepWidth, receiver.data, timeEvaluated, stp);
-      g_SeisSolNonZeroFlopsOther += m_nonZeroFlops;
-      g_SeisSolHardwareFlopsOther += m_hardwareFlops;
-
-      receiverTime = time;
-      while (receiverTime < expansionPoint + timeStepWidth) {
-        //eval time basis
-        double tau = (time - expansionPoint) / timeStepWidth;
-        seissol::basisFunction::SampledTimeBasisFunctions<real> timeBasisFunctions(CONVERGENCE_ORDER, tau);
-        krnl.timeBasisFunctionsAtPoint = timeBasisFunctions.m_data.data();
-        krnl.execute();
-
-        receiver.output.push_back(receiverTime);
+    for (double receiverTime = time; receiverTime < expansionPoint + timeStepWidth; receiverTime += m_samplingInterval) {
+      times.push_back(receiverTime);
+    }
+  }
+  return times;
+}
+
+void seissol::kernels::ReceiverCluster::appendSample( Receiver& receiver, double time, real const* timeEvaluatedAtPoint ) {
+  auto qAtPoint = init::QAtPoint::view::create(const_cast<real*>(timeEvaluatedAtPoint));
+
+  // at most the number of quantities per simulation times the number of simulations
+  std::array<real, tensor::QAtPoint::size()> values;
+  size_t numberOfValues = 0;
 #ifdef MULTIPLE_SIMULATIONS
-        for (unsigned sim = init::QAtPoint::Start[0]; sim < init::QAtPoint::Stop[0]; ++sim) {
-          for (auto quantity : m_quantities) {
-            receiver.output.push_back(qAtPoint(sim, quantity));
-          }
-        }
+  for (unsigned sim = init::QAtPoint::Start[0]; sim < init::QAtPoint::Stop[0]; ++sim) {
+    for (auto quantity : m_quantities) {
+      if (!std::isfinite(qAtPoint(sim, quantity))) {
+        logError() << "Detected Inf/NaN in receiver output. Aborting.";
+      }
+      values[numberOfValues++] = qAtPoint(sim, quantity);
+    }
+  }
 #else //MULTIPLE_SIMULATIONS
-        for (auto quantity : m_quantities) {
-          receiver.output.push_back(qAtPoint(quantity));
-        }
+  for (auto quantity : m_quantities) {
+    if (!std::isfinite(qAtPoint(quantity))) {
+      logError() << "Detected Inf/NaN in receiver output. Aborting.";
+    }
+    values[numberOfValues++] = qAtPoint(quantity);
+  }
 #endif //MULTITPLE_SIMULATIONS
+  receiver.append(time, values.data(), numberOfValues);
+}
 
-        receiverTime += m_samplingInterval;
-      }
+void seissol::kernels::ReceiverCluster::sampleCell( ReceiverCell&               cell,
+                                                    std::vector<double> const&  times,
+                                                    double                      expansionPoint,
+                                                    double                      timeStepWidth ) {
+  constexpr size_t numBasisFunctions = tensor::Q::Shape[0];
+#ifdef USE_STP
+  memory::ThreadLocalArena::Scope scratch;
+  real* timeEvaluated = scratch.allocate<real>(tensor::Q::size());
+  real* stp = scratch.allocate<real>(tensor::spaceTimePredictor::size(), PAGESIZE_STACK);
+  real* timeEvaluatedAtPoint = scratch.allocate<real>(tensor::QAtPoint::size());
+
+  kernel::evaluateDOFSAtPointSTP krnl;
+  krnl.QAtPoint = timeEvaluatedAtPoint;
+  krnl.spaceTimePredictor = stp;
+
+  m_timeKernel.executeSTP(timeStepWidth, cell.data, timeEvaluated, stp);
+  addFlops(g_SeisSolNonZeroFlopsOther, m_nonZeroFlops);
+  addFlops(g_SeisSolHardwareFlopsOther, m_hardwareFlops);
+
+  for (double receiverTime : times) {
+    //eval time basis
+    double tau = (receiverTime - expansionPoint) / timeStepWidth;
+    seissol::basisFunction::SampledTimeBasisFunctions<real> timeBasisFunctions(CONVERGENCE_ORDER, tau);
+    krnl.timeBasisFunctionsAtPoint = timeBasisFunctions.m_data.data();
+    for (size_t i = 0; i < cell.receivers.size(); ++i) {
+      krnl.basisFunctionsAtPoint = cell.basisFunctions.data() + i * numBasisFunctions;
+      krnl.execute();
+      appendSample(m_receivers[cell.receivers[i]], receiverTime, timeEvaluatedAtPoint);
     }
   }
-  return receiverTime;
 #else //USE_STP
-  real timeEvaluated[tensor::Q::size()] __attribute__((aligned(ALIGNMENT)));
-  real timeDerivatives[yateto::computeFamilySize<tensor::dQ>()] __attribute__((aligned(ALIGNMENT)));
-  real timeEvaluatedAtPoint[tensor::QAtPoint::size()] __attribute__((aligned(ALIGNMENT)));
+  memory::ThreadLocalArena::Scope scratch;
+  real* timeEvaluated = scratch.allocate<real>(tensor::Q::size());
+  real* timeDerivatives = scratch.allocate<real>(yateto::computeFamilySize<tensor::dQ>());
 
-  kernels::LocalTmp tmp;
+  real const* derivatives = cell.derivatives;
+  if (derivatives == nullptr) {
+    kernels::LocalTmp tmp;
+    m_timeKernel.computeAder( timeStepWidth,
+                              cell.data,
+                              tmp,
+                              timeEvaluated, // useless but the interface requires it
+                              timeDerivatives );
+    addFlops(g_SeisSolNonZeroFlopsOther, m_nonZeroFlops);
+    addFlops(g_SeisSolHardwareFlopsOther, m_hardwareFlops);
+    derivatives = timeDerivatives;
+  }
 
+#ifdef MULTIPLE_SIMULATIONS
+  real* timeEvaluatedAtPoint = scratch.allocate<real>(tensor::QAtPoint::size());
   kernel::evaluateDOFSAtPoint krnl;
   krnl.QAtPoint = timeEvaluatedAtPoint;
   krnl.Q = timeEvaluated;
 
-  auto qAtPoint = init::QAtPoint::view::create(timeEvaluatedAtPoint);
-
-  double receiverTime = time;
-  if (time >= expansionPoint && time < expansionPoint + timeStepWidth) {
-    for (auto& receiver : m_receivers) {
-      krnl.basisFunctionsAtPoint = receiver.basisFunctions.m_data.data();
-
-      m_timeKernel.computeAder( timeStepWidth,
-                                receiver.data,
-                                tmp,
-                                timeEvaluated, // useless but the interface requires it
-                                timeDerivatives );
-      g_SeisSolNonZeroFlopsOther += m_nonZeroFlops;
-      g_SeisSolHardwareFlopsOther += m_hardwareFlops;
-
-      receiverTime = time;
-      while (receiverTime < expansionPoint + timeStepWidth) {
-        m_timeKernel.computeTaylorExpansion(receiverTime, expansionPoint, timeDerivatives, timeEvaluated);
-        krnl.execute();
-
-        receiver.output.push_back(receiverTime);
-#ifdef MULTIPLE_SIMULATIONS
-        for (unsigned sim = init::QAtPoint::Start[0]; sim < init::QAtPoint::Stop[0]; ++sim) {
-          for (auto quantity : m_quantities) {
-           if (!std::isfinite(qAtPoint(sim, quantity))) {
-            logError() << "Detected Inf/NaN in receiver output. Aborting.";
-          }
-            receiver.output.push_back(qAtPoint(sim, quantity));
-          }
-        }
+  for (double receiverTime : times) {
+    m_timeKernel.computeTaylorExpansion(receiverTime, expansionPoint, derivatives, timeEvaluated);
+    for (size_t i = 0; i < cell.receivers.size(); ++i) {
+      krnl.basisFunctionsAtPoint = cell.basisFunctions.data() + i * numBasisFunctions;
+      krnl.execute();
+      appendSample(m_receivers[cell.receivers[i]], receiverTime, timeEvaluatedAtPoint);
+    }
+  }
 #else //MULTIPLE_SIMULATIONS
-        for (auto quantity : m_quantities) {
-          if (!std::isfinite(qAtPoint(quantity))) {
-            logError() << "Detected Inf/NaN in receiver output. Aborting.";
-          }
-          receiver.output.push_back(qAtPoint(quantity));
-        }
-#endif //MULTITPLE_SIMULATIONS
+  // All receivers of the cell are evaluated with one matrix product; the number of receivers per cell
+  // is only known at runtime, hence Eigen instead of a generated kernel.
+  using Matrix = Eigen::Matrix<real, Eigen::Dynamic, Eigen::Dynamic>;
+  constexpr size_t numQuantities = tensor::Q::Shape[1];
+  constexpr size_t ldQ = init::Q::Stop[0] - init::Q::Start[0];
+  const Eigen::Map<const Matrix, 0, Eigen::OuterStride<>> q(
+      timeEvaluated, numBasisFunctions, numQuantities, Eigen::OuterStride<>(ldQ));
+  const Eigen::Map<const Matrix> phi(cell.basisFunctions.data(), numBasisFunctions, cell.receivers.size());
+  // [receiver][quantity], i.e. the layout of QAtPoint per receiver
+  Matrix timeEvaluatedAtPoints(numQuantities, cell.receivers.size());
 
-        receiverTime += m_samplingInterval;
-      }
+  for (double receiverTime : times) {
+    m_timeKernel.computeTaylorExpansion(receiverTime, expansionPoint, derivatives, timeEvaluated);
+    timeEvaluatedAtPoints.noalias() = q.transpose() * phi;
+    for (size_t i = 0; i < cell.receivers.size(); ++i) {
+      appendSample(m_receivers[cell.receivers[i]], receiverTime, timeEvaluatedAtPoints.col(i).data());
     }
   }
-  return receiverTime;
+#endif //MULTIPLE_SIMULATIONS
 #endif //USE_STP
 }
 
+double seissol::kernels::ReceiverCluster::calcReceivers(  double time,
+                                                          double expansionPoint,
+                                                          double timeStepWidth ) {
+  const auto times = samplingTimes(time, expansionPoint, timeStepWidth);
+  if (times.empty()) {
+    return time;
+  }
+
+#ifdef ACL_DEVICE
+  if (m_numberOfDeviceReceivers != m_receivers.size()) {
+    flushSamples();
+    m_deviceReceivers.reset();
+    if (!m_cellsWithoutDerivatives.empty() && DeviceReceivers::isSupported()) {
+      // samples until the next synchronization point of the receiver writer
+      const double samplesPerSyncPoint = std::min(m_syncPointInterval / m_samplingInterval,
+                                                  static_cast<double>(DeviceReceivers::MaxCapacity));
+      const auto capacity = static_cast<size_t>(samplesPerSyncPoint) + 1;
+      m_deviceReceivers = std::make_unique<DeviceReceivers>(m_cellsWithoutDerivatives, m_quantities, capacity);
+    }
+    m_numberOfDeviceReceivers = m_receivers.size();
+  }
+  if (m_deviceReceivers != nullptr) {
+    m_deviceReceivers->sample(m_timeKernel, times, expansionPoint, timeStepWidth, m_receivers);
+    addFlops(g_SeisSolNonZeroFlopsOther, m_nonZeroFlops * m_cellsWithoutDerivatives.size());
+    addFlops(g_SeisSolHardwareFlopsOther, m_hardwareFlops * m_cellsWithoutDerivatives.size());
+    return times.back() + m_samplingInterval;
+  }
+#endif
+  parallel::forEachCell(m_cellsWithoutDerivatives.size(), [&](unsigned cell) {
+    sampleCell(m_cellsWithoutDerivatives[cell], times, expansionPoint, timeStepWidth);
+  });
+
+  return times.back() + m_samplingInterval;
+}
+
+void seissol::kernels::ReceiverCluster::calcReceiversFromDerivatives( double time,
+                                                                     double expansionPoint,
+                                                                     double timeStepWidth ) {
+  if (m_cellsWithDerivatives.empty()) {
+    return;
+  }
+  const auto times = samplingTimes(time, expansionPoint, timeStepWidth);
+  parallel::forEachCell(m_cellsWithDerivatives.size(), [&](unsigned cell) {
+    sampleCell(m_cellsWithDerivatives[cell], times, expansionPoint, timeStepWidth);
+  });
+}
+
+void seissol::kernels::ReceiverCluster::flushSamples() {
+#ifdef ACL_DEVICE
+  if (m_deviceReceivers != nullptr) {
+    m_deviceReceivers->flush(m_receivers);
+  }
+#endif
+}
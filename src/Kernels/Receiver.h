@@ -40,6 +40,10 @@
 #ifndef KERNELS_RECEIVER_H_
 #define KERNELS_RECEIVER_H_
 
+#include <array>
+#include <memory>
+#include <optional>
+#include <unordered_map>
 #include <vector>
 #include <Eigen/Dense>
 #include <Geometry/MeshReader.h>
@@ -47,25 +51,51 @@
 #include <Initializer/tree/Lut.hpp>
 #include <Initializer/LTS.h>
 #include <Initializer/PointMapper.h>
+#include <Initializer/ThreadLocalArena.h>
 #include <Kernels/Time.h>
 #include <Kernels/Interface.hpp>
+#include <Kernels/ReceiverDecimation.h>
 #include <generated_code/init.h>
+#ifdef ACL_DEVICE
+#include <Kernels/DeviceReceivers.h>
+#endif
 
 struct GlobalData;
 namespace seissol {
   namespace kernels {
     struct Receiver {
-      Receiver(unsigned pointId, double xi, double eta, double zeta, kernels::LocalData data, size_t reserved)
-        : pointId(pointId),
-          basisFunctions(CONVERGENCE_ORDER, xi, eta, zeta),
-          data(data)
+      Receiver(unsigned pointId, size_t reserved)
+        : pointId(pointId)
       {
         output.reserve(reserved);
       }
+      //! Appends a sample (time followed by the quantities) to the output, filtered and decimated if enabled
+      void append(double time, real const* values, size_t numberOfValues) {
+        if (decimation.has_value()) {
+          decimation->push(time, values, output);
+        } else {
+          output.push_back(time);
+          output.insert(output.end(), values, values + numberOfValues);
+        }
+      }
       unsigned pointId;
-      basisFunction::SampledBasisFunctions<real> basisFunctions;
-      kernels::LocalData data;
       std::vector<real> output;
+      std::optional<DecimatedSeries> decimation;
+    };
+
+    //! The receivers in one cell, which are sampled together
+    struct ReceiverCell {
+      ReceiverCell(kernels::LocalData data, real const* derivatives)
+        : data(data),
+          derivatives(derivatives)
+      {}
+      kernels::LocalData data;
+      //! time derivatives which the time cluster stores for the cell, or nullptr if they are recomputed
+      real const* derivatives;
+      //! ids of the receivers in the cluster
+      std::vector<size_t> receivers;
+      //! basis functions sampled at the receivers, [receiver][basis function]
+      std::vector<real> basisFunctions;
     };
 
     class ReceiverCluster {
@@ -75,14 +105,21 @@ namespace seissol {
           m_samplingInterval(1.0e99), m_syncPointInterval(0.0)
       {}
 
-      ReceiverCluster(  GlobalData const*             global,
+      /**
+       * @param decimation filter which decimates the samples of the receivers before they are stored,
+       *                   or nullptr to store all samples.
+       **/
+      ReceiverCluster(  CompoundGlobalData const&     global,
                         std::vector<unsigned> const&  quantities,
                         double                        samplingInterval,
-                        double                        syncPointInterval )
+                        double                        syncPointInterval,
+                        std::shared_ptr<DecimationFilter const> decimation = nullptr )
         : m_quantities(quantities),
-          m_samplingInterval(samplingInterval), m_syncPointInterval(syncPointInterval) {
-        m_timeKernel.setHostGlobalData(global);
+          m_samplingInterval(samplingInterval), m_syncPointInterval(syncPointInterval),
+          m_decimation(std::move(decimation)) {
+        m_timeKernel.setGlobalData(global);
         m_timeKernel.flopsAder(m_nonZeroFlops, m_hardwareFlops);
+        memory::ThreadLocalArena::reserve(scratchSize());
       }
 
       void addReceiver( unsigned          meshId,
@@ -92,11 +129,34 @@ namespace seissol {
                         seissol::initializers::Lut const& ltsLut,
                         seissol::initializers::LTS const& lts );
 
-      //! Returns new receiver time
+      //! Adds a receiver at the reference coordinates xiEtaZeta of the cell with the given data (e.g. for the proxy).
+      void addReceiver( unsigned                      pointId,
+                        std::array<double, 3> const&  xiEtaZeta,
+                        kernels::LocalData const&     data,
+                        real const*                   derivatives );
+
+      /**
+       * Samples the receivers in cells without stored time derivatives; must be called before the local integration.
+       * Returns new receiver time.
+       **/
       double calcReceivers( double time,
                             double expansionPoint,
                             double timeStepWidth );
 
+      /**
+       * Samples the receivers in cells whose time derivatives are stored by the time cluster; must be called after the
+       * local integration with the time passed to calcReceivers.
+       **/
+      void calcReceiversFromDerivatives( double time,
+                                         double expansionPoint,
+                                         double timeStepWidth );
+
+      /**
+       * Appends the samples which are still buffered on the device to the output of the receivers;
+       * must be called before the output is read.
+       **/
+      void flushSamples();
+
       std::vector<Receiver>::iterator begin() {
         return m_receivers.begin();
       }
@@ -114,13 +174,51 @@ namespace seissol {
       }
 
     private:
+      //! Size of the temporaries of calcReceivers in the thread-local arena
+      static constexpr size_t scratchSize() {
+        using Arena = memory::ThreadLocalArena;
+#ifdef USE_STP
+        return Arena::bytesFor<real>(tensor::Q::size()) +
+               Arena::bytesFor<real>(tensor::spaceTimePredictor::size(), PAGESIZE_STACK) +
+               Arena::bytesFor<real>(tensor::QAtPoint::size());
+#else
+        return Arena::bytesFor<real>(tensor::Q::size()) +
+               Arena::bytesFor<real>(yateto::computeFamilySize<tensor::dQ>()) +
+               Arena::bytesFor<real>(tensor::QAtPoint::size());
+#endif
+      }
+
+      //! Sampling times in [time, expansionPoint + timeStepWidth), if time is in the time step
+      std::vector<double> samplingTimes( double time,
+                                         double expansionPoint,
+                                         double timeStepWidth ) const;
+
+      //! Samples all receivers of one cell at the given times
+      void sampleCell( ReceiverCell&               cell,
+                       std::vector<double> const&  times,
+                       double                      expansionPoint,
+                       double                      timeStepWidth );
+
+      void appendSample( Receiver& receiver, double time, real const* timeEvaluatedAtPoint );
+
       std::vector<Receiver> m_receivers;
+      //! receivers grouped by their cell, split by the availability of stored derivatives
+      std::vector<ReceiverCell> m_cellsWithoutDerivatives;
+      std::vector<ReceiverCell> m_cellsWithDerivatives;
+      //! index of the cell of the dofs in m_cellsWithoutDerivatives or m_cellsWithDerivatives
+      std::unordered_map<real const*, size_t> m_cellOfDofs;
+#ifdef ACL_DEVICE
+      //! receivers in cells without stored derivatives, if they are sampled on the device
+      std::unique_ptr<DeviceReceivers> m_deviceReceivers;
+      size_t m_numberOfDeviceReceivers = 0;
+#endif
       seissol::kernels::Time m_timeKernel;
       std::vector<unsigned> m_quantities;
       unsigned m_nonZeroFlops;
       unsigned m_hardwareFlops;
       double m_samplingInterval;
       double m_syncPointInterval;
+      std::shared_ptr<DecimationFilter const> m_decimation;
 
     };
   }
@@ -0,0 +1,102 @@
+#include "ReceiverDecimation.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace {
+long floorDiv(long a, long b) { return a / b - (a % b != 0 && (a < 0) != (b < 0)); }
+long ceilDiv(long a, long b) { return -floorDiv(-a, b); }
+} // namespace
+
+seissol::kernels::DecimationFilter::DecimationFilter(double samplingInterval,
+                                                     unsigned factor,
+                                                     double cutoff,
+                                                     unsigned halfWidth)
+    : m_samplingInterval(samplingInterval), m_factor(std::max(factor, 1u)), m_halfWidth(halfWidth) {
+  // cutoff frequency in cycles per input sample
+  const double frequency = 0.5 * cutoff / m_factor;
+  const long width = delay();
+  m_coefficients.resize(2 * width + 1);
+  for (long k = -width; k <= width; ++k) {
+    const double x = 2.0 * M_PI * frequency * k;
+    const double sinc = (k == 0) ? 1.0 : std::sin(x) / x;
+    const double phase = (width > 0) ? M_PI * (k + width) / width : 0.0;
+    const double window = 0.42 - 0.5 * std::cos(phase) + 0.08 * std::cos(2.0 * phase);
+    m_coefficients[k + width] = sinc * window;
+  }
+  // unit gain for constant signals
+  const double sum = std::accumulate(m_coefficients.begin(), m_coefficients.end(), 0.0);
+  for (auto& coefficient : m_coefficients) {
+    coefficient /= sum;
+  }
+}
+
+seissol::kernels::DecimatedSeries::DecimatedSeries(std::shared_ptr<DecimationFilter const> filter,
+                                                   unsigned numberOfChannels)
+    : m_filter(std::move(filter)), m_numberOfChannels(numberOfChannels), m_lastValues(numberOfChannels),
+      m_partialSums(m_filter->numberOfPendingOutputs() * numberOfChannels, 0.0) {}
+
+double* seissol::kernels::DecimatedSeries::partialSums(long outputIndex) {
+  const long pending = m_filter->numberOfPendingOutputs();
+  const long slot = ((outputIndex % pending) + pending) % pending;
+  return m_partialSums.data() + slot * m_numberOfChannels;
+}
+
+void seissol::kernels::DecimatedSeries::add(long index, real const* values, std::vector<real>& output) {
+  const long factor = m_filter->factor();
+  const long delay = m_filter->delay();
+  for (long outputIndex = ceilDiv(index - delay, factor); outputIndex <= floorDiv(index + delay, factor);
+       ++outputIndex) {
+    const double coefficient = m_filter->coefficient(index - outputIndex * factor);
+    double* sums = partialSums(outputIndex);
+    for (unsigned channel = 0; channel < m_numberOfChannels; ++channel) {
+      sums[channel] += coefficient * values[channel];
+    }
+  }
+
+  if ((index - delay) % factor != 0) {
+    return;
+  }
+  const long completed = (index - delay) / factor;
+  double* sums = partialSums(completed);
+  // The output samples before the first sample only consist of its continuation
+  if (completed * factor >= m_firstIndex) {
+    output.push_back(completed * m_filter->outputInterval());
+    output.insert(output.end(), sums, sums + m_numberOfChannels);
+  }
+  std::fill_n(sums, m_numberOfChannels, 0.0);
+}
+
+void seissol::kernels::DecimatedSeries::push(double time, real const* values, std::vector<real>& output) {
+  const long factor = m_filter->factor();
+  const long delay = m_filter->delay();
+  const long index = std::lround(time / m_filter->samplingInterval());
+
+  if (!m_started) {
+    m_started = true;
+    m_firstIndex = index;
+    // continue the signal before the first sample by the first sample
+    for (long outputIndex = ceilDiv(index - delay, factor); outputIndex <= floorDiv(index - 1 + delay, factor);
+         ++outputIndex) {
+      double weight = 0.0;
+      for (long input = outputIndex * factor - delay; input < index; ++input) {
+        weight += m_filter->coefficient(input - outputIndex * factor);
+      }
+      double* sums = partialSums(outputIndex);
+      for (unsigned channel = 0; channel < m_numberOfChannels; ++channel) {
+        sums[channel] = weight * values[channel];
+      }
+    }
+  } else {
+    if (index <= m_lastIndex) {
+      return;
+    }
+    for (long missing = m_lastIndex + 1; missing < index; ++missing) {
+      add(missing, m_lastValues.data(), output);
+    }
+  }
+  add(index, values, output);
+  m_lastIndex = index;
+  std::copy_n(values, m_numberOfChannels, m_lastValues.begin());
+}
@@ -0,0 +1,79 @@
+#ifndef SEISSOL_KERNELS_RECEIVERDECIMATION_H
+#define SEISSOL_KERNELS_RECEIVERDECIMATION_H
+
+#include <memory>
+#include <vector>
+
+#include "Kernels/precision.hpp"
+
+namespace seissol::kernels {
+/**
+ * Linear-phase low-pass FIR filter (Blackman-windowed sinc) for decimating receiver samples by an integer factor.
+ * The filter extends halfWidth output intervals to both sides of an output sample, hence the output is complete
+ * halfWidth output intervals after its time. As the output is assigned to the center of the filter, it has no phase
+ * shift.
+ **/
+class DecimationFilter {
+  public:
+  /**
+   * @param samplingInterval interval of the input samples.
+   * @param factor number of input samples per output sample.
+   * @param cutoff cutoff frequency relative to the Nyquist frequency of the output.
+   * @param halfWidth half width of the filter in output samples.
+   **/
+  DecimationFilter(double samplingInterval, unsigned factor, double cutoff = 0.8, unsigned halfWidth = 16);
+
+  double samplingInterval() const { return m_samplingInterval; }
+  unsigned factor() const { return m_factor; }
+  double outputInterval() const { return m_factor * m_samplingInterval; }
+
+  //! Distance of the first (and last) input sample of an output sample, in input samples
+  long delay() const { return static_cast<long>(m_halfWidth) * m_factor; }
+
+  //! Number of output samples which overlap an input sample
+  unsigned numberOfPendingOutputs() const { return 2 * m_halfWidth + 1; }
+
+  //! Weight of the input sample at the given offset (in -delay()..delay()) from the output sample
+  double coefficient(long offset) const { return m_coefficients[offset + delay()]; }
+
+  private:
+  double m_samplingInterval;
+  unsigned m_factor;
+  unsigned m_halfWidth;
+  std::vector<double> m_coefficients;
+};
+
+/**
+ * Filters and decimates the samples of the channels of one receiver on the fly.
+ * Instead of the last input samples, it stores the partial sums of the output samples which overlap the current input
+ * sample (polyphase form), i.e. the memory does not depend on the decimation factor.
+ * Before the first sample, the signal is continued by the first sample. Missing samples are filled with the previous
+ * one and repeated samples are ignored.
+ **/
+class DecimatedSeries {
+  public:
+  DecimatedSeries(std::shared_ptr<DecimationFilter const> filter, unsigned numberOfChannels);
+
+  /**
+   * Adds the sample at time (a multiple of the sampling interval of the filter) and appends the completed output
+   * samples to output, each as time followed by the channels.
+   **/
+  void push(double time, real const* values, std::vector<real>& output);
+
+  private:
+  //! Adds the input sample with the given index and appends the output sample which it completes
+  void add(long index, real const* values, std::vector<real>& output);
+  double* partialSums(long outputIndex);
+
+  std::shared_ptr<DecimationFilter const> m_filter;
+  unsigned m_numberOfChannels;
+  bool m_started = false;
+  long m_firstIndex = 0;
+  long m_lastIndex = 0;
+  std::vector<real> m_lastValues;
+  //! [output sample modulo the number of pending outputs][channel]
+  std::vector<double> m_partialSums;
+};
+} // namespace seissol::kernels
+
+#endif // SEISSOL_KERNELS_RECEIVERDECIMATION_H
@@ -0,0 +1,85 @@
+#ifndef KERNELS_STARMATRICES_H_
+#define KERNELS_STARMATRICES_H_
+
+#include <Equations/Setup.h>
+#include <Initializer/typedefs.hpp>
+#include <generated_code/init.h>
+#include <generated_code/tensor.h>
+
+namespace seissol::kernels {
+using StarMatrices = real[3][tensor::star::size(0)];
+
+/**
+ * Sets the star matrix grad[0] * A^T + grad[1] * B^T + grad[2] * C^T.
+ *
+ * @param i_grad gradient of one reference coordinate with respect to (x, y, z).
+ **/
+inline void setStarMatrix(const real* i_AT,
+                          const real* i_BT,
+                          const real* i_CT,
+                          const real i_grad[3],
+                          real* o_starMatrix) {
+  for (unsigned idx = 0; idx < tensor::star::size(0); ++idx) {
+    o_starMatrix[idx] = i_grad[0] * i_AT[idx];
+  }
+
+  for (unsigned idx = 0; idx < tensor::star::size(1); ++idx) {
+    o_starMatrix[idx] += i_grad[1] * i_BT[idx];
+  }
+
+  for (unsigned idx = 0; idx < tensor::star::size(2); ++idx) {
+    o_starMatrix[idx] += i_grad[2] * i_CT[idx];
+  }
+}
+
+/**
+ * Computes the star matrices of a cell from its material and the gradients of the
+ * reference coordinates (xi, eta, zeta) with respect to (x, y, z).
+ **/
+template <typename MaterialT>
+void computeStarMatrices(const MaterialT& material, const real (&gradients)[3][3], StarMatrices& starMatrices) {
+  real ATData[tensor::star::size(0)];
+  real BTData[tensor::star::size(1)];
+  real CTData[tensor::star::size(2)];
+  auto AT = init::star::view<0>::create(ATData);
+  auto BT = init::star::view<0>::create(BTData);
+  auto CT = init::star::view<0>::create(CTData);
+  model::getTransposedCoefficientMatrix(material, 0, AT);
+  model::getTransposedCoefficientMatrix(material, 1, BT);
+  model::getTransposedCoefficientMatrix(material, 2, CT);
+  for (unsigned i = 0; i < 3; ++i) {
+    setStarMatrix(ATData, BTData, CTData, gradients[i], starMatrices[i]);
+  }
+}
+
+/**
+ * Returns the star matrices of a cell.
+ * With USE_RECOMPUTED_STAR_MATRICES, only the gradients of the reference coordinates are stored and
+ * the star matrices are recomputed into the buffer.
+ **/
+inline const StarMatrices& starMatricesOf(const LocalIntegrationData& localIntegration,
+                                          const CellMaterialData& material,
+                                          StarMatrices& buffer) {
+#ifdef USE_RECOMPUTED_STAR_MATRICES
+  computeStarMatrices(material.local, localIntegration.gradients, buffer);
+  return buffer;
+#else
+  return localIntegration.starMatrices;
+#endif
+}
+
+#if defined(USE_RECOMPUTED_STAR_MATRICES) && defined(ACL_DEVICE)
+/**
+ * Sets the coefficients from which the device kernels recompute the star matrices of an elastic cell,
+ * see seissol::model::getTransposedCoefficientMatrix.
+ **/
+inline void setStarCoefficients(const model::ElasticMaterial& material, real (&coefficients)[4]) {
+  coefficients[0] = material.lambda;
+  coefficients[1] = material.mu;
+  coefficients[2] = 1.0 / material.rho;
+  coefficients[3] = model::testIfAcoustic(material.mu) ? 0.0 : 1.0 / material.rho;
+}
+#endif
+} // namespace seissol::kernels
+
+#endif
@@ -108,6 +108,16 @@ class seissol::kernels::Time : public TimeBase {
                             LocalTmp& tmp,
                             ConditionalBatchTableT &table);
 
+#ifdef USE_POROELASTIC
+    /**
+     * Recomputes Zinv of the cells of the layer if the time step width differs from the typical one, as in
+     * executeSTP, and copies it to the device. Has to be called before computeBatchedAder.
+     **/
+    void prepareBatchedAder(double i_timeStepWidth,
+                            initializers::Layer& layer,
+                            initializers::LTS const& lts);
+#endif
+
     void flopsAder( unsigned int &o_nonZeroFlops,
                     unsigned int &o_hardwareFlops );
 
@@ -39,6 +39,7 @@
  **/
 
 #include "TimeCommon.h"
+#include <Kernels/denseMatrixOps.hpp>
 #include <stdint.h>
 
 void seissol::kernels::TimeCommon::computeIntegrals(Time& i_time,
@@ -89,6 +90,19 @@ void seissol::kernels::TimeCommon::computeIntegrals(Time& i_time,
   }
 }
 
+void seissol::kernels::TimeCommon::prefetchDerivatives(unsigned short i_ltsSetup,
+                                                       const FaceType i_faceTypes[4],
+                                                       real * const i_timeDofs[4])
+{
+  for (int l_neighbor = 0; l_neighbor < 4; ++l_neighbor) {
+    if (i_faceTypes[l_neighbor] != FaceType::outflow &&
+        i_faceTypes[l_neighbor] != FaceType::dynamicRupture &&
+        (i_ltsSetup >> l_neighbor) % 2 == 1) {
+      prefetch(tensor::Q::size(), i_timeDofs[l_neighbor]);
+    }
+  }
+}
+
 void seissol::kernels::TimeCommon::computeIntegrals(Time& i_time,
                                                     unsigned short i_ltsSetup,
                                                     const FaceType i_faceTypes[4],
@@ -101,6 +101,19 @@ namespace seissol {
                             real o_integrationBuffer[4][tensor::I::size()],
                             real * o_timeIntegrated[4]);
 
+      /**
+       * Prefetches the 0th time derivatives of the face neighbors which provide derivatives (bits 0-3 of the LTS setup).
+       * Issued for the next cell, this hides the latency of their unpredictable addresses in computeIntegrals;
+       * the time-integrated buffers are prefetched by the neighboring kernel.
+       *
+       * @param i_ltsSetup bitmask for the LTS setup.
+       * @param i_faceTypes face types of the neighboring cells.
+       * @param i_timeDofs pointers to time integrated buffers or time derivatives of the four neighboring cells.
+       **/
+      void prefetchDerivatives(unsigned short i_ltsSetup,
+                               const FaceType i_faceTypes[4],
+                               real * const i_timeDofs[4]);
+
       void computeBatchedIntegrals(Time& i_time,
                                    const double i_timeStepStart,
                                    const double i_timeStepWidth,
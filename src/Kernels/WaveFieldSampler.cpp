@@ -0,0 +1,115 @@
+#include "WaveFieldSampler.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include <Kernels/Interface.hpp>
+#include <Monitoring/FlopCounter.hpp>
+#include <Parallel/Tasking.h>
+
+#include "utils/logger.h"
+
+void seissol::kernels::WaveFieldSampler::init(GlobalData const* global,
+                                              double startTime,
+                                              double interval,
+                                              real const* dofs,
+                                              std::size_t numberOfCells) {
+#if defined(USE_STP) || defined(ACL_DEVICE)
+  logError() << "Sampling the wave field output in the time clusters is not supported with space-time "
+                "predictors or on devices.";
+#endif
+  m_timeKernel.setHostGlobalData(global);
+  m_timeKernel.flopsAder(m_nonZeroFlops, m_hardwareFlops);
+  memory::ThreadLocalArena::reserve(scratchSize());
+  m_startTime = startTime;
+  m_interval = interval;
+  m_dofs = dofs;
+  m_numberOfCells = numberOfCells;
+}
+
+unsigned seissol::kernels::WaveFieldSampler::addCluster() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_nextSteps.push_back(1);
+  return m_nextSteps.size() - 1;
+}
+
+void seissol::kernels::WaveFieldSampler::sample(unsigned cluster,
+                                                seissol::initializers::LTS const& lts,
+                                                seissol::initializers::Layer& layer,
+                                                double expansionPoint,
+                                                double timeStepWidth) {
+  std::vector<std::size_t> steps;
+  std::vector<real*> snapshots;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto& step = m_nextSteps[cluster];
+    for (; outputTime(step) < expansionPoint + timeStepWidth; ++step) {
+      if (step >= m_firstPendingStep) {
+        auto& snapshot = m_snapshots[step];
+        if (snapshot.dofs.empty()) {
+          snapshot.dofs.resize(m_numberOfCells * tensor::Q::size());
+        }
+        steps.push_back(step);
+        snapshots.push_back(snapshot.dofs.data());
+      }
+    }
+  }
+  if (steps.empty()) {
+    return;
+  }
+
+#if !defined(USE_STP) && !defined(ACL_DEVICE)
+  // The layer is a contiguous part of the dofs variable
+  real const* layerDofs = reinterpret_cast<real const*>(layer.var(lts.dofs));
+  std::size_t const offset = layerDofs - m_dofs;
+
+  kernels::LocalData::Loader loader;
+  loader.load(lts, layer);
+
+  parallel::forEachCell(layer.getNumberOfCells(), [&](unsigned cell) {
+    memory::ThreadLocalArena::Scope scratch;
+    real* timeEvaluated = scratch.allocate<real>(tensor::Q::size());
+    real* timeIntegrated = scratch.allocate<real>(tensor::I::size());
+    real* timeDerivatives = scratch.allocate<real>(yateto::computeFamilySize<tensor::dQ>());
+
+    kernels::LocalTmp tmp;
+    auto data = loader.entry(cell);
+    m_timeKernel.computeAder(timeStepWidth, data, tmp, timeIntegrated, timeDerivatives);
+
+    for (unsigned i = 0; i < steps.size(); ++i) {
+      m_timeKernel.computeTaylorExpansion(outputTime(steps[i]), expansionPoint, timeDerivatives, timeEvaluated);
+      std::memcpy(snapshots[i] + offset + cell * tensor::Q::size(), timeEvaluated, tensor::Q::size() * sizeof(real));
+    }
+  });
+  addFlops(g_SeisSolNonZeroFlopsOther, static_cast<long long>(m_nonZeroFlops) * layer.getNumberOfCells());
+  addFlops(g_SeisSolHardwareFlopsOther, static_cast<long long>(m_hardwareFlops) * layer.getNumberOfCells());
+#endif
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  for (auto step : steps) {
+    ++m_snapshots[step].numberOfSampledClusters;
+  }
+}
+
+bool seissol::kernels::WaveFieldSampler::popCompleteSnapshot(double& time, std::vector<real>& dofs) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (m_snapshots.empty() || m_snapshots.begin()->first != m_firstPendingStep ||
+      m_snapshots.begin()->second.numberOfSampledClusters != m_nextSteps.size()) {
+    return false;
+  }
+  time = outputTime(m_firstPendingStep);
+  dofs = std::move(m_snapshots.begin()->second.dofs);
+  m_snapshots.erase(m_snapshots.begin());
+  ++m_firstPendingStep;
+  return true;
+}
+
+void seissol::kernels::WaveFieldSampler::discardIncompleteSnapshots() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_snapshots.clear();
+  std::size_t nextStep = m_firstPendingStep;
+  for (auto step : m_nextSteps) {
+    nextStep = std::max(nextStep, step);
+  }
+  m_firstPendingStep = nextStep;
+}
@@ -0,0 +1,86 @@
+#ifndef SEISSOL_KERNELS_WAVEFIELDSAMPLER_H
+#define SEISSOL_KERNELS_WAVEFIELDSAMPLER_H
+
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include <Initializer/LTS.h>
+#include <Initializer/ThreadLocalArena.h>
+#include <Initializer/tree/Layer.hpp>
+#include <Kernels/Time.h>
+#include <generated_code/tensor.h>
+
+struct GlobalData;
+namespace seissol::kernels {
+/**
+ * Samples the degrees of freedom at the times of an output without a global synchronization:
+ * each time cluster evaluates the Taylor expansion of its time prediction at the output times
+ * in its time step. A snapshot is complete once all clusters passed its time.
+ *
+ * The snapshots have the layout of the dofs variable of the LTS tree.
+ **/
+class WaveFieldSampler {
+  public:
+  void init(GlobalData const* global,
+            double startTime,
+            double interval,
+            real const* dofs,
+            std::size_t numberOfCells);
+
+  //! Adds a time cluster and returns its id
+  unsigned addCluster();
+
+  /**
+   * Samples the cells of the layer at all output times in [expansionPoint, expansionPoint + timeStepWidth);
+   * must be called before the local integration. Thread-safe for different clusters.
+   **/
+  void sample(unsigned cluster,
+              seissol::initializers::LTS const& lts,
+              seissol::initializers::Layer& layer,
+              double expansionPoint,
+              double timeStepWidth);
+
+  /**
+   * Moves the earliest complete snapshot to dofs and returns true, or returns false if none is complete.
+   **/
+  bool popCompleteSnapshot(double& time, std::vector<real>& dofs);
+
+  //! Drops the snapshots which were only sampled by a part of the clusters (at the end of the simulation)
+  void discardIncompleteSnapshots();
+
+  private:
+  double outputTime(std::size_t step) const { return m_startTime + step * m_interval; }
+
+  struct Snapshot {
+    std::vector<real> dofs;
+    unsigned numberOfSampledClusters = 0;
+  };
+
+  //! Size of the temporaries of sample in the thread-local arena
+  static constexpr std::size_t scratchSize() {
+    using Arena = memory::ThreadLocalArena;
+    return Arena::bytesFor<real>(tensor::Q::size()) + Arena::bytesFor<real>(tensor::I::size()) +
+           Arena::bytesFor<real>(yateto::computeFamilySize<tensor::dQ>());
+  }
+
+  seissol::kernels::Time m_timeKernel;
+  unsigned m_nonZeroFlops = 0;
+  unsigned m_hardwareFlops = 0;
+
+  double m_startTime = 0.0;
+  double m_interval = 0.0;
+  real const* m_dofs = nullptr;
+  std::size_t m_numberOfCells = 0;
+
+  std::mutex m_mutex;
+  //! Next output step of each cluster
+  std::vector<std::size_t> m_nextSteps;
+  //! First step which was not written or discarded
+  std::size_t m_firstPendingStep = 1;
+  std::map<std::size_t, Snapshot> m_snapshots;
+};
+} // namespace seissol::kernels
+
+#endif // SEISSOL_KERNELS_WAVEFIELDSAMPLER_H
@@ -136,6 +136,40 @@ namespace seissol {
       }
     }
 
+    /**
+     * Returns the flux solver of a cell in the precision of the kernels.
+     * Flux solvers which are stored in reduced precision (USE_SINGLE_PRECISION_FLUX_SOLVERS) are converted into the buffer.
+     **/
+    template<std::size_t Size>
+    const real* fluxSolverOf(const FluxSolverReal (&fluxSolver)[Size], real (&buffer)[Size]) {
+      if constexpr (std::is_same_v<FluxSolverReal, real>) {
+        return fluxSolver;
+      } else {
+        std::copy(fluxSolver, fluxSolver + Size, buffer);
+        return buffer;
+      }
+    }
+
+    /**
+     * Returns the memory to which a kernel writes the flux solver of a cell; call storeFluxSolver afterwards.
+     **/
+    template<std::size_t Size>
+    real* fluxSolverTarget(FluxSolverReal (&fluxSolver)[Size], real (&buffer)[Size]) {
+      if constexpr (std::is_same_v<FluxSolverReal, real>) {
+        return fluxSolver;
+      } else {
+        return buffer;
+      }
+    }
+
+    //! Stores a flux solver computed in the memory returned by fluxSolverTarget.
+    template<std::size_t Size>
+    void storeFluxSolver(const real (&buffer)[Size], FluxSolverReal (&fluxSolver)[Size]) {
+      if constexpr (!std::is_same_v<FluxSolverReal, real>) {
+        std::copy(buffer, buffer + Size, fluxSolver);
+      }
+    }
+
     /**
      * uses SFINAE to check if class T has a size() function.
      */
@@ -82,6 +82,52 @@ namespace seissol {
       }
     }
     
+    /** Prefetches X into the cache (L2 on x86), one hint per cache line.
+     *
+     * @param numberOfReals The size of X.
+     * @param X
+     */
+    inline void prefetch( unsigned numberOfReals,
+                          real const* X )
+    {
+      constexpr unsigned realsPerCacheLine = 64 / sizeof(real);
+      for (unsigned i = 0; i < numberOfReals; i += realsPerCacheLine) {
+        DMO_PREFETCH(&X[i])
+      }
+    }
+
+    /** Adds X to Y with compensated (Kahan) summation: C carries the low-order bits of Y which were lost
+     * in previous additions. C starts at zero.
+     * Requires value-safe floating point arithmetic, which the pragma enforces for Intel and Clang-based compilers
+     * (but not for -ffast-math).
+     *
+     * @param numberOfReals The size of X, Y and C.
+     * @param X
+     * @param Y
+     * @param C
+     */
+#if defined(__INTEL_COMPILER) || defined(__clang__)
+#pragma float_control(precise, on, push)
+#endif
+    inline void compensatedAdd( unsigned numberOfReals,
+                                real const* X,
+                                real* Y,
+                                real* C )
+    {
+      for (unsigned i = 0; i < numberOfReals; ++i) {
+        const real increment = X[i] - C[i];
+        const real sum = Y[i] + increment;
+        C[i] = (sum - Y[i]) - increment;
+        Y[i] = sum;
+      }
+    }
+#if defined(__INTEL_COMPILER) || defined(__clang__)
+#pragma float_control(pop)
+#endif
+
+    //! True if streamstore bypasses the cache on this architecture
+    constexpr bool hasNonTemporalStores = DMO_NONTEMPORAL_STORES != 0;
+
     /**
      * Computes Y = scalar * X.
      * The number of rows must be a multiple of the alignment.
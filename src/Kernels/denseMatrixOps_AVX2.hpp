@@ -63,3 +63,7 @@
 #else
 #error no precision was defined
 #endif
+
+// Prefetch into L2: the data is read by the next cell
+#define DMO_PREFETCH(ADDR) _mm_prefetch(reinterpret_cast<const char*>(ADDR), _MM_HINT_T1);
+#define DMO_NONTEMPORAL_STORES 1
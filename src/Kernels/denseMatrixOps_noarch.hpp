@@ -47,3 +47,6 @@
 #define DMO_SXTYP(S, X, Y) *(Y) += (S) * *(X);
 #define DMO_XYMST(S, X, Y, Z) *(Z) = (*(X)-*(Y)) * (S);
 #define DMO_XYMSTZP(S, X, Y, Z) *(Z) += (*(X)-*(Y)) * (S);
+#define DMO_PREFETCH(ADDR) __builtin_prefetch(ADDR, 0, 2);
+// DMO_STREAM is a regular store
+#define DMO_NONTEMPORAL_STORES 0
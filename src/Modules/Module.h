@@ -40,11 +40,13 @@
 #ifndef MODULE_H
 #define MODULE_H
 
+#include <algorithm>
 #include <cassert>
 #include <climits>
 #include <cmath>
 #include <limits>
 
+#include "utils/env.h"
 #include "utils/logger.h"
 #include "Parallel/MPI.h"
 
@@ -66,6 +68,9 @@ private:
   /** The last time when syncPoint was called */
 	double m_lastSyncPoint;
 
+	/** The synchronization point may be taken up to this time earlier to share it with other modules */
+	double m_syncWindow;
+
 public:
 	/**
 	 * Possible priorites for modules
@@ -88,7 +93,8 @@ public:
 
 public:
 	Module()
-		: m_syncInterval(0), m_nextSyncPoint(0), m_lastSyncPoint(-std::numeric_limits<double>::infinity())
+		: m_syncInterval(0), m_nextSyncPoint(0), m_lastSyncPoint(-std::numeric_limits<double>::infinity()),
+		  m_syncWindow(0)
 	{ }
 
 	/**
@@ -104,7 +110,8 @@ public:
     if (std::abs(currentTime - m_lastSyncPoint) < timeTolerance) {
       int const rank = seissol::MPI::mpi.rank();
       logInfo(rank) << "Ignoring duplicate synchronisation point at time" << currentTime << "; the last sync point was at " << m_lastSyncPoint;
-    } else if (forceSyncPoint || std::abs(currentTime - m_nextSyncPoint) < timeTolerance) {
+    } else if (forceSyncPoint || (currentTime > m_nextSyncPoint - m_syncWindow - timeTolerance
+                                  && currentTime < m_nextSyncPoint + timeTolerance)) {
 			syncPoint(currentTime);
       m_lastSyncPoint = currentTime;
 			m_nextSyncPoint += m_syncInterval;
@@ -113,6 +120,14 @@ public:
 		return m_nextSyncPoint;
 	}
 
+	/**
+	 * @return The next (nominal) synchronization point for this module
+	 */
+	double nextSyncPoint() const
+	{
+		return m_nextSyncPoint;
+	}
+
 	/**
 	 * Called by {@link Modules} before the simulation starts to set the synchronization point.
 	 *
@@ -195,6 +210,22 @@ protected:
 		if (m_syncInterval != 0)
 			logError() << "Synchronization interval is already set";
 		m_syncInterval = interval;
+
+		static const double fraction = utils::Env::get<double>("SEISSOL_SYNC_WINDOW", 0.0);
+		setSyncWindow(fraction * interval);
+	}
+
+	/**
+	 * Allow to take the synchronization point up to <code>window</code> earlier, such that it coincides
+	 * with the synchronization point of another module. The following synchronization points are not shifted.
+	 *
+	 * The window is limited to half of the synchronization interval.
+	 */
+	void setSyncWindow(double window)
+	{
+		if (m_syncInterval >= std::numeric_limits<double>::max())
+			window = 0;
+		m_syncWindow = std::max(0.0, std::min(window, 0.5 * m_syncInterval));
 	}
 };
 
@@ -45,6 +45,7 @@
 #include <limits>
 #include <map>
 #include <utility>
+#include <vector>
 
 #include "utils/logger.h"
 
@@ -101,9 +102,15 @@ private:
 	/** The hook that should be called next */
 	Hook m_nextHook;
 
+	/** Number of synchronization points at which at least one module synchronized */
+	unsigned long m_syncPoints;
+
+	/** Number of synchronization points which were saved by synchronizing modules early */
+	unsigned long m_savedSyncPoints;
+
 private:
 	Modules()
-		: m_nextHook(FIRST_HOOK)
+		: m_nextHook(FIRST_HOOK), m_syncPoints(0), m_savedSyncPoints(0)
 	{
 	}
 
@@ -129,10 +136,30 @@ private:
 	double _callSyncHook(double currentTime, double timeTolerance, bool forceSyncPoint)
 	{
 		double nextSyncTime = std::numeric_limits<double>::max();
+		// the synchronization points of the modules which synchronized at this time
+		std::vector<double> syncedPoints;
 
 		for (std::multimap<int, Module*>::iterator it = m_hooks[SYNCHRONIZATION_POINT].begin();
 				it != m_hooks[SYNCHRONIZATION_POINT].end(); it++) {
-			nextSyncTime = std::min(nextSyncTime, it->second->potentialSyncPoint(currentTime, timeTolerance, forceSyncPoint));
+			const double syncPoint = it->second->nextSyncPoint();
+			const double next = it->second->potentialSyncPoint(currentTime, timeTolerance, forceSyncPoint);
+			if (next != syncPoint)
+				syncedPoints.push_back(syncPoint);
+			nextSyncTime = std::min(nextSyncTime, next);
+		}
+
+		if (forceSyncPoint) {
+			logInfo(seissol::MPI::mpi.rank()) << "Synchronization points of the modules:" << m_syncPoints
+				<< "(saved by synchronizing early:" << m_savedSyncPoints << ")";
+		} else if (!syncedPoints.empty()) {
+			std::sort(syncedPoints.begin(), syncedPoints.end());
+			unsigned long distinctPoints = 1;
+			for (unsigned i = 1; i < syncedPoints.size(); i++) {
+				if (syncedPoints[i] - syncedPoints[i-1] >= timeTolerance)
+					distinctPoints++;
+			}
+			m_syncPoints++;
+			m_savedSyncPoints += distinctPoints - 1;
 		}
 
 		return nextSyncTime;
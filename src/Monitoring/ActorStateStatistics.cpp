@@ -0,0 +1,151 @@
+#include "ActorStateStatistics.h"
+
+#include <algorithm>
+
+#include "Monitoring/Stopwatch.h"
+#include "Numerical_aux/Statistics.h"
+#include <utils/logger.h>
+
+namespace {
+using seissol::TimeInterval;
+
+bool isEarlier(timespec const& a, timespec const& b) {
+  return a.tv_sec < b.tv_sec || (a.tv_sec == b.tv_sec && a.tv_nsec < b.tv_nsec);
+}
+
+//! Sorts the intervals and merges the overlapping ones.
+std::vector<TimeInterval> unite(std::vector<TimeInterval> intervals) {
+  std::sort(intervals.begin(), intervals.end(), [](TimeInterval const& a, TimeInterval const& b) {
+    return isEarlier(a.begin, b.begin);
+  });
+  std::vector<TimeInterval> united;
+  for (auto const& interval : intervals) {
+    if (!united.empty() && !isEarlier(united.back().end, interval.begin)) {
+      if (isEarlier(united.back().end, interval.end)) {
+        united.back().end = interval.end;
+      }
+    } else {
+      united.push_back(interval);
+    }
+  }
+  return united;
+}
+
+long long length(std::vector<TimeInterval> const& intervals) {
+  long long total = 0;
+  for (auto const& interval : intervals) {
+    total += seissol::difftime(interval.begin, interval.end);
+  }
+  return total;
+}
+
+//! Length of the intersection of two sets of disjoint, sorted intervals
+long long intersectionLength(std::vector<TimeInterval> const& a, std::vector<TimeInterval> const& b) {
+  long long total = 0;
+  auto first = a.begin();
+  auto second = b.begin();
+  while (first != a.end() && second != b.end()) {
+    timespec const& begin = isEarlier(first->begin, second->begin) ? second->begin : first->begin;
+    timespec const& end = isEarlier(first->end, second->end) ? first->end : second->end;
+    if (isEarlier(begin, end)) {
+      total += seissol::difftime(begin, end);
+    }
+    if (isEarlier(first->end, second->end)) {
+      ++first;
+    } else {
+      ++second;
+    }
+  }
+  return total;
+}
+
+seissol::OverlapAccumulator::Times measure(std::vector<TimeInterval> computations,
+                                          std::vector<TimeInterval> communications) {
+  computations = unite(std::move(computations));
+  communications = unite(std::move(communications));
+  seissol::OverlapAccumulator::Times times;
+  times.computation = length(computations);
+  times.communication = length(communications);
+  times.exposedCommunication = times.communication - intersectionLength(communications, computations);
+  return times;
+}
+} // namespace
+
+void seissol::OverlapAccumulator::addComputation(TimeInterval const& interval) {
+  std::lock_guard<std::mutex> lock(mutex);
+  computations.push_back(interval);
+  if (computations.size() >= BatchSize) {
+    fold();
+  }
+}
+
+void seissol::OverlapAccumulator::addCommunication(TimeInterval const& interval) {
+  std::lock_guard<std::mutex> lock(mutex);
+  communications.push_back(interval);
+  if (communications.size() >= BatchSize) {
+    fold();
+  }
+}
+
+seissol::OverlapAccumulator::Times seissol::OverlapAccumulator::take() {
+  std::lock_guard<std::mutex> lock(mutex);
+  fold();
+  const Times times = timesSinceTake;
+  timesSinceTake = Times();
+  return times;
+}
+
+seissol::OverlapAccumulator::Times seissol::OverlapAccumulator::total() const {
+  std::lock_guard<std::mutex> lock(mutex);
+  Times times = totalTimes;
+  times += measure(computations, communications);
+  return times;
+}
+
+void seissol::OverlapAccumulator::fold() {
+  const Times batch = measure(std::move(computations), std::move(communications));
+  totalTimes += batch;
+  timesSinceTake += batch;
+  computations.clear();
+  communications.clear();
+}
+
+std::pair<double, double> seissol::ActorStateStatisticsManager::takeCommunicationTime() {
+  const auto times = overlap->take();
+  return {seconds(times.communication), seconds(times.exposedCommunication)};
+}
+
+std::tuple<double, double, double> seissol::ActorStateStatisticsManager::getTotalTimes() const {
+  const auto times = overlap->total();
+  return {seconds(times.computation), seconds(times.communication), seconds(times.exposedCommunication)};
+}
+
+void seissol::ActorStateStatisticsManager::printOverlap(int rank) const {
+  const auto [computationTime, communicationTime, exposedTime] = getTotalTimes();
+  const double overlap = communicationTime > 0.0 ? 1.0 - exposedTime / communicationTime : 1.0;
+
+  const auto summary = seissol::statistics::parallelSummary(100.0 * overlap);
+  logInfo(rank) << "Communication overlapped by computation: mean =" << summary.mean << "%"
+                << " min =" << summary.min << "%"
+                << " max =" << summary.max << "%";
+}
+
+void seissol::ActorStateStatisticsManager::reportRegionCommunication(std::string const& fileName) const {
+  std::vector<RegionCommunication> regions;
+  for (auto const& statistics : ghostStatistics) {
+    auto const& ghostRegions = statistics.getRegionCommunications();
+    regions.insert(regions.end(), ghostRegions.begin(), ghostRegions.end());
+  }
+  seissol::reportRegionCommunication(regions, fileName);
+}
+
+void seissol::ActorStateStatisticsManager::printHaloCompressionError(int rank) const {
+  double maxError = 0.0;
+  for (auto const& statistics : ghostStatistics) {
+    maxError = std::max(maxError, statistics.getMaxHaloCompressionError());
+  }
+
+  const auto summary = seissol::statistics::parallelSummary(maxError);
+  logInfo(rank) << "Relative error of the ghost layers sent in single precision: max =" << summary.max
+                << " mean over ranks =" << summary.mean;
+}
@@ -1,17 +1,125 @@
 #ifndef SEISSOL_ACTORSTATESTATISTICS_H
 #define SEISSOL_ACTORSTATESTATISTICS_H
 
+#include <algorithm>
+#include <list>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 #include <optional>
+#include <string>
+#include <tuple>
+#include <time.h>
+#include "Monitoring/LoopStatistics.h"
+#include "Monitoring/RegionCommunication.h"
 #include "Solver/time_stepping/ActorState.h"
 
 namespace seissol {
+struct TimeInterval {
+  timespec begin;
+  timespec end;
+};
+
+/**
+ * Overlap of the computations and the communications of all clusters of a rank.
+ * The intervals are folded into running sums in batches, such that the memory stays bounded.
+ * Overlaps of intervals of different batches are not detected, which only affects the few intervals
+ * at the boundaries of the batches.
+ **/
+class OverlapAccumulator {
+public:
+  //! Times in nanoseconds
+  struct Times {
+    //! Time in which at least one cluster computed
+    long long computation = 0;
+    //! Time in which MPI requests were in flight
+    long long communication = 0;
+    //! Part of the communication time which was not covered by computations
+    long long exposedCommunication = 0;
+
+    Times& operator+=(Times const& other) {
+      computation += other.computation;
+      communication += other.communication;
+      exposedCommunication += other.exposedCommunication;
+      return *this;
+    }
+  };
+
+  //! Number of intervals after which a batch is folded
+  static constexpr std::size_t BatchSize = 1 << 16;
+
+  //! May be called concurrently.
+  void addComputation(TimeInterval const& interval);
+
+  //! May be called concurrently.
+  void addCommunication(TimeInterval const& interval);
+
+  //! Returns the times of the intervals which were recorded since the last call.
+  Times take();
+
+  //! Returns the times of all intervals.
+  [[nodiscard]] Times total() const;
+
+private:
+  //! Folds the current batch into the sums; the caller holds the mutex.
+  void fold();
+
+  mutable std::mutex mutex;
+  std::vector<TimeInterval> computations;
+  std::vector<TimeInterval> communications;
+  Times totalTimes;
+  Times timesSinceTake;
+};
+
 class ActorStateStatistics {
 public:
   ActorStateStatistics() : currentSample(time_stepping::ActorState::Synced) {
   }
 
+  void setOverlapAccumulator(OverlapAccumulator* accumulator) {
+    overlap = accumulator;
+  }
+
+  //! Records the duration of an action which computed something (predict or correct).
+  void addComputation(timespec begin, timespec end) {
+    if (overlap != nullptr) {
+      overlap->addComputation({begin, end});
+    }
+  }
+
+  //! Records a time span in which the MPI requests of a ghost cluster were in flight.
+  void addCommunication(timespec begin, timespec end) {
+    if (overlap != nullptr) {
+      overlap->addCommunication({begin, end});
+    }
+  }
+
+  //! Adds a region of a ghost cluster and returns its index for recordRegionMessage.
+  std::size_t addRegionCommunication(RegionCommunication const& region) {
+    regionCommunications.push_back(region);
+    return regionCommunications.size() - 1;
+  }
+
+  //! Records the latency (in nanoseconds) of a message of a region.
+  void recordRegionMessage(std::size_t region, bool isReceive, long long latency) {
+    regionCommunications[region].addMessage(isReceive, latency);
+  }
+
+  [[nodiscard]] std::vector<RegionCommunication> const& getRegionCommunications() const {
+    return regionCommunications;
+  }
+
+  //! Records the conversion error of a ghost layer message which was sent in single precision.
+  void addHaloCompressionError(double maxError, double maxValue) {
+    maxHaloCompressionError = std::max(maxHaloCompressionError, maxValue > 0.0 ? maxError / maxValue : 0.0);
+  }
+
+  [[nodiscard]] double getMaxHaloCompressionError() const {
+    return maxHaloCompressionError;
+  }
+
   void enter(time_stepping::ActorState actorState) {
     if (actorState == currentSample.state) {
       ++currentSample.numEnteredRegion;
@@ -57,6 +165,10 @@ private:
 
   Sample currentSample;
   std::vector<Sample> samples;
+  OverlapAccumulator* overlap = nullptr;
+  std::vector<RegionCommunication> regionCommunications;
+  //! Maximum relative error (in the max norm) of all messages
+  double maxHaloCompressionError = 0.0;
 
 
 };
@@ -65,9 +177,42 @@ class ActorStateStatisticsManager {
 public:
   ActorStateStatisticsManager() = default;
   ActorStateStatistics& addCluster(unsigned globalClusterId) {
-    return stateStatisticsMap[globalClusterId];
+    auto& statistics = stateStatisticsMap[globalClusterId];
+    statistics.setOverlapAccumulator(overlap.get());
+    return statistics;
+  }
+
+  //! Ghost clusters only record their communication.
+  ActorStateStatistics& addGhostCluster() {
+    auto& statistics = ghostStatistics.emplace_back();
+    statistics.setOverlapAccumulator(overlap.get());
+    return statistics;
   }
 
+  /**
+   * Prints which fraction of the time, in which MPI requests were in flight,
+   * was covered by computations of the time clusters.
+   **/
+  void printOverlap(int rank) const;
+
+  //! Reports the latency and bandwidth of the messages of all regions of the ghost clusters. Collective.
+  void reportRegionCommunication(std::string const& fileName) const;
+
+  //! Prints the maximum relative conversion error of the ghost layer exchange in single precision.
+  void printHaloCompressionError(int rank) const;
+
+  /**
+   * Returns the time in which MPI requests were in flight and the part of it which was not covered
+   * by computations (in seconds) of the intervals which were recorded since the last call.
+   **/
+  std::pair<double, double> takeCommunicationTime();
+
+  /**
+   * Returns the time in which at least one cluster computed, the time in which MPI requests were in flight
+   * and the part of it which was not covered by computations (in seconds) of the whole run.
+   **/
+  std::tuple<double, double, double> getTotalTimes() const;
+
   void addToLoopStatistics(LoopStatistics& loopStatistics) {
     loopStatistics.addRegion(time_stepping::actorStateToString(time_stepping::ActorState::Synced), false);
     loopStatistics.addRegion(time_stepping::actorStateToString(time_stepping::ActorState::Corrected), false);
@@ -79,6 +224,9 @@ public:
   }
 private:
   std::unordered_map<unsigned, ActorStateStatistics> stateStatisticsMap{};
+  std::list<ActorStateStatistics> ghostStatistics{};
+  //! A pointer, such that the manager stays movable
+  std::unique_ptr<OverlapAccumulator> overlap = std::make_unique<OverlapAccumulator>();
 };
 }
 
@@ -0,0 +1,79 @@
+#include "ActorTrace.h"
+
+#include <fstream>
+
+#include "Monitoring/Stopwatch.h"
+#include "Parallel/MPI.h"
+#include <utils/env.h>
+#include <utils/logger.h>
+
+namespace {
+const char* eventTypeName(seissol::ActorTraceEventType type) {
+  switch (type) {
+  case seissol::ActorTraceEventType::Action:
+    return "action";
+  case seissol::ActorTraceEventType::Send:
+    return "send";
+  case seissol::ActorTraceEventType::Receive:
+    return "receive";
+  default:
+    return "unknown";
+  }
+}
+
+const char* eventKindName(seissol::ActorTraceEventType type, int kind) {
+  if (type != seissol::ActorTraceEventType::Action) {
+    return kind == 0 ? "prediction" : "correction";
+  }
+  // time_stepping::ActorAction
+  const char* actions[] = {"nothing", "correct", "predict", "sync", "restart", "correct-predict"};
+  return kind >= 0 && kind < 6 ? actions[kind] : "unknown";
+}
+} // namespace
+
+void seissol::ActorTraceRecorder::writeActor(std::ostream& stream) const {
+  stream << m_actorId << "," << m_kind << "," << m_globalClusterId << "," << m_otherGlobalClusterId << "\n";
+}
+
+void seissol::ActorTraceRecorder::writeEvents(std::ostream& stream, timespec start) const {
+  for (const auto& event : m_events) {
+    stream << m_actorId << "," << eventTypeName(event.type) << "," << eventKindName(event.type, event.kind) << ","
+           << difftime(start, event.begin) << "," << difftime(start, event.end) << "," << event.message << "\n";
+  }
+}
+
+seissol::ActorTrace::ActorTrace() {
+  m_prefix = utils::Env::get<std::string>("SEISSOL_ACTOR_TRACE_PREFIX", "");
+  clock_gettime(CLOCK_MONOTONIC, &m_start);
+}
+
+seissol::ActorTraceRecorder&
+    seissol::ActorTrace::addActor(std::string kind, int globalClusterId, int otherGlobalClusterId) {
+  return m_recorders.emplace_back(m_recorders.size(), std::move(kind), globalClusterId, otherGlobalClusterId);
+}
+
+void seissol::ActorTrace::write() const {
+  if (!enabled()) {
+    return;
+  }
+  const auto rank = seissol::MPI::mpi.rank();
+  const std::string prefix = m_prefix + "." + std::to_string(rank);
+
+  std::ofstream actors(prefix + ".actors.csv");
+  actors << "actor,kind,cluster,other_cluster\n";
+  for (const auto& recorder : m_recorders) {
+    recorder.writeActor(actors);
+  }
+
+  // Times in nanoseconds since the construction of the trace
+  std::ofstream events(prefix + ".events.csv");
+  events << "actor,type,kind,begin,end,message\n";
+  for (const auto& recorder : m_recorders) {
+    recorder.writeEvents(events, m_start);
+  }
+  if (!actors || !events) {
+    logWarning(rank) << "Could not write the actor trace to" << prefix;
+  } else {
+    logInfo(rank) << "Wrote the actor trace to" << prefix + ".*.csv";
+  }
+}
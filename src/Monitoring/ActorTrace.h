@@ -0,0 +1,95 @@
+#ifndef SEISSOL_MONITORING_ACTORTRACE_H
+#define SEISSOL_MONITORING_ACTORTRACE_H
+
+#include <cstdint>
+#include <list>
+#include <ostream>
+#include <string>
+#include <time.h>
+#include <utility>
+#include <vector>
+
+namespace seissol {
+
+enum class ActorTraceEventType { Action, Send, Receive };
+
+struct ActorTraceEvent {
+  ActorTraceEventType type;
+  //! Action events: the time_stepping::ActorAction; messages: 0 for predictions, 1 for corrections
+  int kind;
+  timespec begin;
+  timespec end;
+  //! Identifies a message on the rank (0 for actions)
+  std::uint64_t message;
+};
+
+/**
+ * Events of a single actor. An actor is never executed by two threads at the same time,
+ * hence no synchronization is required.
+ **/
+class ActorTraceRecorder {
+  public:
+  ActorTraceRecorder(unsigned actorId, std::string kind, int globalClusterId, int otherGlobalClusterId)
+      : m_actorId(actorId), m_kind(std::move(kind)), m_globalClusterId(globalClusterId),
+        m_otherGlobalClusterId(otherGlobalClusterId) {}
+
+  void addAction(int action, timespec begin, timespec end) {
+    m_events.push_back({ActorTraceEventType::Action, action, begin, end, 0});
+  }
+
+  //! Returns the id which has to be passed with the message.
+  std::uint64_t addSend(int kind) {
+    const std::uint64_t message = (static_cast<std::uint64_t>(m_actorId) << 40) | ++m_numberOfSends;
+    timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    m_events.push_back({ActorTraceEventType::Send, kind, now, now, message});
+    return message;
+  }
+
+  void addReceive(int kind, std::uint64_t message) {
+    timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    m_events.push_back({ActorTraceEventType::Receive, kind, now, now, message});
+  }
+
+  void writeActor(std::ostream& stream) const;
+  void writeEvents(std::ostream& stream, timespec start) const;
+
+  private:
+  unsigned m_actorId;
+  std::string m_kind;
+  int m_globalClusterId;
+  int m_otherGlobalClusterId;
+  std::uint64_t m_numberOfSends = 0;
+  std::vector<ActorTraceEvent> m_events;
+};
+
+/**
+ * Trace of the actions and messages of the LTS actors (SEISSOL_ACTOR_TRACE_PREFIX).
+ *
+ * Each rank writes its actors to <prefix>.<rank>.actors.csv and their events to
+ * <prefix>.<rank>.events.csv at the end of the run; postprocessing/performance/scripts/
+ * actor_critical_path.py reconstructs the critical path from these files.
+ **/
+class ActorTrace {
+  public:
+  ActorTrace();
+
+  bool enabled() const { return !m_prefix.empty(); }
+
+  /**
+   * @param kind "copy", "interior" or "ghost"
+   * @param otherGlobalClusterId The cluster on the neighboring ranks for ghost clusters, -1 otherwise
+   **/
+  ActorTraceRecorder& addActor(std::string kind, int globalClusterId, int otherGlobalClusterId = -1);
+
+  void write() const;
+
+  private:
+  std::string m_prefix;
+  timespec m_start;
+  std::list<ActorTraceRecorder> m_recorders;
+};
+} // namespace seissol
+
+#endif // SEISSOL_MONITORING_ACTORTRACE_H
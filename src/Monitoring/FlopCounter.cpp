@@ -60,15 +60,20 @@ long long g_SeisSolNonZeroFlopsDynamicRupture = 0;
 long long g_SeisSolHardwareFlopsDynamicRupture = 0;
 long long g_SeisSolNonZeroFlopsPlasticity = 0;
 long long g_SeisSolHardwareFlopsPlasticity = 0;
+long long g_SeisSolPlasticityCells = 0;
+long long g_SeisSolPlasticitySkippedCells = 0;
+
+long long hardwareFlops() {
+  return g_SeisSolHardwareFlopsLocal
+       + g_SeisSolHardwareFlopsNeighbor
+       + g_SeisSolHardwareFlopsOther
+       + g_SeisSolHardwareFlopsDynamicRupture
+       + g_SeisSolHardwareFlopsPlasticity;
+}
 
 void printPerformance(double wallTime) {
   const int rank = seissol::MPI::mpi.rank();
-  const long long flops = g_SeisSolHardwareFlopsLocal
-                    + g_SeisSolHardwareFlopsNeighbor
-                    + g_SeisSolHardwareFlopsOther
-                    + g_SeisSolHardwareFlopsDynamicRupture
-                    + g_SeisSolHardwareFlopsPlasticity;
-  const double gflopsPerSecond = flops * 1.e-9 / wallTime;
+  const double gflopsPerSecond = hardwareFlops() * 1.e-9 / wallTime;
 
 
   double flopsSum = 0;
@@ -102,6 +107,8 @@ void printFlops() {
     DRHardwareFlops,
     PLNonZeroFlops,
     PLHardwareFlops,
+    PLCells,
+    PLSkippedCells,
     NUM_COUNTERS
   };
 
@@ -114,6 +121,8 @@ void printFlops() {
   flops[DRHardwareFlops]  = g_SeisSolHardwareFlopsDynamicRupture;
   flops[PLNonZeroFlops]   = g_SeisSolNonZeroFlopsPlasticity;
   flops[PLHardwareFlops]  = g_SeisSolHardwareFlopsPlasticity;
+  flops[PLCells]          = g_SeisSolPlasticityCells;
+  flops[PLSkippedCells]   = g_SeisSolPlasticitySkippedCells;
 
 #ifdef USE_MPI
   double totalFlops[NUM_COUNTERS];
@@ -131,4 +140,7 @@ void printFlops() {
   logInfo(rank) << "DR calculated NZ-GFLOP: " << (totalFlops[DRNonZeroFlops])  * 1.e-9;
   logInfo(rank) << "PL calculated HW-GFLOP: " << (totalFlops[PLHardwareFlops]) * 1.e-9;
   logInfo(rank) << "PL calculated NZ-GFLOP: " << (totalFlops[PLNonZeroFlops])  * 1.e-9;
+  if (totalFlops[PLCells] > 0) {
+    logInfo(rank) << "PL skipped yield checks:" << 100.0 * totalFlops[PLSkippedCells] / totalFlops[PLCells] << "%";
+  }
 }
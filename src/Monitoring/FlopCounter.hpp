@@ -57,6 +57,20 @@ extern long long g_SeisSolNonZeroFlopsDynamicRupture;
 extern long long g_SeisSolHardwareFlopsDynamicRupture;
 extern long long g_SeisSolNonZeroFlopsPlasticity;
 extern long long g_SeisSolHardwareFlopsPlasticity;
+//! number of plasticity updates of cells and how many of them were skipped by Plasticity::isYieldingPossible
+extern long long g_SeisSolPlasticityCells;
+extern long long g_SeisSolPlasticitySkippedCells;
+
+//! Adds to one of the counters above; the time clusters might be updated concurrently (tasking mode).
+inline void addFlops(long long& counter, long long flops) {
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+  counter += flops;
+}
+
+//! Sum of the calculated hardware flops of this rank
+long long hardwareFlops();
 
 void printPerformance(double wallTime);
 void printFlops();
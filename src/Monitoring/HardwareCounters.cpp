@@ -0,0 +1,294 @@
+#include "HardwareCounters.h"
+
+#include <algorithm>
+#include <cctype>
+#include <sstream>
+#include <stdexcept>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "Parallel/MPI.h"
+#include <utils/env.h>
+#include <utils/logger.h>
+
+namespace {
+constexpr unsigned MaxEvents = 16;
+
+#ifdef __linux__
+constexpr std::uint32_t TypeHardware = PERF_TYPE_HARDWARE;
+constexpr std::uint32_t TypeCache = PERF_TYPE_HW_CACHE;
+constexpr std::uint32_t TypeRaw = PERF_TYPE_RAW;
+
+constexpr std::uint64_t cacheReadMiss(std::uint64_t cache) {
+  return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+}
+
+struct GenericEvent {
+  const char* name;
+  std::uint32_t type;
+  std::uint64_t config;
+};
+
+const GenericEvent GenericEvents[] = {
+    {"cycles", TypeHardware, PERF_COUNT_HW_CPU_CYCLES},
+    {"instructions", TypeHardware, PERF_COUNT_HW_INSTRUCTIONS},
+    {"cache-references", TypeHardware, PERF_COUNT_HW_CACHE_REFERENCES},
+    {"cache-misses", TypeHardware, PERF_COUNT_HW_CACHE_MISSES},
+    {"branch-misses", TypeHardware, PERF_COUNT_HW_BRANCH_MISSES},
+    {"l1d-misses", TypeCache, cacheReadMiss(PERF_COUNT_HW_CACHE_L1D)},
+    {"llc-misses", TypeCache, cacheReadMiss(PERF_COUNT_HW_CACHE_LL)},
+};
+
+int perfEventOpen(perf_event_attr& attr, int groupFd) {
+  // pid = 0, cpu = -1: the calling thread on any CPU
+  return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, groupFd, 0));
+}
+#else
+constexpr std::uint32_t TypeRaw = 4;
+
+struct GenericEvent {
+  const char* name;
+  std::uint32_t type;
+  std::uint64_t config;
+};
+
+const GenericEvent GenericEvents[] = {{"cycles", 0, 0}, {"instructions", 0, 1}};
+#endif
+
+unsigned numberOfThreads() {
+#ifdef _OPENMP
+  return omp_get_max_threads();
+#else
+  return 1;
+#endif
+}
+} // namespace
+
+seissol::HardwareCounters::HardwareCounters() {
+  const auto list = utils::Env::get<std::string>("SEISSOL_HARDWARE_COUNTERS", "");
+  if (list.empty()) {
+    return;
+  }
+  try {
+    m_events = parseEvents(list);
+  } catch (const std::invalid_argument& error) {
+    logError() << "SEISSOL_HARDWARE_COUNTERS:" << error.what();
+  }
+  if (m_events.size() > MaxEvents) {
+    logError() << "SEISSOL_HARDWARE_COUNTERS: at most" << MaxEvents << "events are supported.";
+  }
+}
+
+seissol::HardwareCounters::~HardwareCounters() {
+#ifdef __linux__
+  for (const int fd : m_fds) {
+    close(fd);
+  }
+#endif
+}
+
+std::vector<seissol::HardwareEvent> seissol::HardwareCounters::parseEvents(const std::string& list) {
+  std::vector<HardwareEvent> events;
+  std::istringstream stream(list);
+  std::string name;
+  while (std::getline(stream, name, ',')) {
+    name.erase(std::remove_if(name.begin(), name.end(), [](char c) { return c == ' ' || c == '\t'; }),
+               name.end());
+    if (name.empty()) {
+      continue;
+    }
+    std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) { return std::tolower(c); });
+
+    HardwareEvent event;
+    event.name = name;
+    const auto generic = std::find_if(std::begin(GenericEvents), std::end(GenericEvents),
+                                      [&](const GenericEvent& e) { return name == e.name; });
+    if (generic != std::end(GenericEvents)) {
+      event.type = generic->type;
+      event.config = generic->config;
+    } else if (name.size() > 1 && name[0] == 'r' &&
+               name.find_first_not_of("0123456789abcdef", 1) == std::string::npos) {
+      event.type = TypeRaw;
+      event.config = std::stoull(name.substr(1), nullptr, 16);
+    } else {
+      throw std::invalid_argument("unknown event " + name);
+    }
+    events.push_back(event);
+  }
+  return events;
+}
+
+void seissol::HardwareCounters::addRegion(unsigned numberOfThreads) {
+  m_begin.emplace_back(numberOfThreads, std::vector<std::uint64_t>(m_leaders.size() * m_events.size()));
+  m_counts.emplace_back(numberOfThreads);
+}
+
+void seissol::HardwareCounters::open() {
+  if (m_events.empty() || m_enabled) {
+    return;
+  }
+#ifdef __linux__
+  const unsigned nThreads = numberOfThreads();
+  const unsigned nEvents = m_events.size();
+  m_leaders.assign(nThreads, -1);
+  m_fds.assign(nThreads * nEvents, -1);
+  bool failed = false;
+
+  // perf_event_open with pid = 0 counts the calling thread, hence each thread opens its own group.
+#ifdef _OPENMP
+#pragma omp parallel reduction(|| : failed)
+#endif
+  {
+#ifdef _OPENMP
+    const unsigned thread = omp_get_thread_num();
+#else
+    const unsigned thread = 0;
+#endif
+    for (unsigned e = 0; e < nEvents && !failed; ++e) {
+      perf_event_attr attr{};
+      attr.size = sizeof(perf_event_attr);
+      attr.type = m_events[e].type;
+      attr.config = m_events[e].config;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+      attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+      const int fd = perfEventOpen(attr, e == 0 ? -1 : m_leaders[thread]);
+      if (fd < 0) {
+        failed = true;
+      } else {
+        m_fds[thread * nEvents + e] = fd;
+        if (e == 0) {
+          m_leaders[thread] = fd;
+        }
+      }
+    }
+  }
+
+  if (failed) {
+    logWarning(seissol::MPI::mpi.rank())
+        << "Could not open the hardware counters (check /proc/sys/kernel/perf_event_paranoid"
+        << "and the number of counters of the CPU); they are disabled.";
+    for (const int fd : m_fds) {
+      if (fd >= 0) {
+        close(fd);
+      }
+    }
+    m_fds.clear();
+    m_leaders.clear();
+    return;
+  }
+
+  for (auto& perRegion : m_begin) {
+    for (auto& snapshot : perRegion) {
+      snapshot.resize(nThreads * nEvents);
+    }
+  }
+  m_scratch.assign(nThreads, std::vector<std::uint64_t>(nThreads * nEvents));
+  m_enabled = true;
+#else
+  logWarning(seissol::MPI::mpi.rank()) << "Hardware counters require Linux; they are disabled.";
+#endif
+}
+
+void seissol::HardwareCounters::read(std::vector<std::uint64_t>& values) {
+#ifdef __linux__
+  const unsigned nEvents = m_events.size();
+  // nr, time_enabled, time_running, values
+  std::uint64_t buffer[3 + MaxEvents];
+  for (unsigned thread = 0; thread < m_leaders.size(); ++thread) {
+    const auto bytes = ::read(m_leaders[thread], buffer, (3 + nEvents) * sizeof(std::uint64_t));
+    if (bytes < static_cast<ssize_t>((3 + nEvents) * sizeof(std::uint64_t))) {
+      continue;
+    }
+    if (buffer[2] < buffer[1]) {
+      m_multiplexed.store(true, std::memory_order_relaxed);
+    }
+    std::copy_n(buffer + 3, nEvents, values.begin() + thread * nEvents);
+  }
+#endif
+}
+
+void seissol::HardwareCounters::end(unsigned region, unsigned subRegion, unsigned thread) {
+  if (!m_enabled) {
+    return;
+  }
+  auto& now = m_scratch[thread];
+  read(now);
+
+  const unsigned nEvents = m_events.size();
+  auto const& before = m_begin[region][thread];
+  auto& counts = m_counts[region][thread];
+  if ((subRegion + 1) * nEvents > counts.size()) {
+    counts.resize((subRegion + 1) * nEvents, 0.0);
+  }
+  for (unsigned t = 0; t < m_leaders.size(); ++t) {
+    for (unsigned e = 0; e < nEvents; ++e) {
+      counts[subRegion * nEvents + e] += static_cast<double>(now[t * nEvents + e] - before[t * nEvents + e]);
+    }
+  }
+}
+
+#ifdef USE_MPI
+void seissol::HardwareCounters::printSummary(const std::vector<std::string>& regions, MPI_Comm comm) {
+  if (!m_enabled) {
+    return;
+  }
+  const unsigned nEvents = m_events.size();
+  int rank;
+  MPI_Comm_rank(comm, &rank);
+
+  for (unsigned region = 0; region < m_counts.size(); ++region) {
+    unsigned long size = 0;
+    for (auto const& counts : m_counts[region]) {
+      size = std::max<unsigned long>(size, counts.size());
+    }
+    MPI_Allreduce(MPI_IN_PLACE, &size, 1, MPI_UNSIGNED_LONG, MPI_MAX, comm);
+    if (size == 0) {
+      continue;
+    }
+
+    auto sums = std::vector<double>(size, 0.0);
+    for (auto const& counts : m_counts[region]) {
+      for (unsigned i = 0; i < counts.size(); ++i) {
+        sums[i] += counts[i];
+      }
+    }
+    MPI_Allreduce(MPI_IN_PLACE, sums.data(), sums.size(), MPI_DOUBLE, MPI_SUM, comm);
+
+    if (rank == 0) {
+      for (unsigned subRegion = 0; subRegion < size / nEvents; ++subRegion) {
+        std::stringstream line;
+        double cycles = 0.0;
+        double instructions = 0.0;
+        for (unsigned e = 0; e < nEvents; ++e) {
+          const double count = sums[subRegion * nEvents + e];
+          line << " " << m_events[e].name << "=" << count;
+          if (m_events[e].name == "cycles") {
+            cycles = count;
+          } else if (m_events[e].name == "instructions") {
+            instructions = count;
+          }
+        }
+        if (cycles > 0.0 && instructions > 0.0) {
+          line << " ipc=" << instructions / cycles;
+        }
+        logInfo(rank) << "Hardware counters of" << regions[region] << "in cluster" << subRegion << ":" << line.str();
+      }
+    }
+  }
+
+  int multiplexed = m_multiplexed.load() ? 1 : 0;
+  MPI_Allreduce(MPI_IN_PLACE, &multiplexed, 1, MPI_INT, MPI_LOR, comm);
+  if (multiplexed) {
+    logWarning(rank) << "The hardware counters were multiplexed; reduce the number of events in SEISSOL_HARDWARE_COUNTERS.";
+  }
+}
+#endif
@@ -0,0 +1,85 @@
+#ifndef SEISSOL_MONITORING_HARDWARECOUNTERS_H
+#define SEISSOL_MONITORING_HARDWARECOUNTERS_H
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#ifdef USE_MPI
+#include <mpi.h>
+#endif
+
+namespace seissol {
+
+struct HardwareEvent {
+  std::string name;
+  //! perf_event_attr type and config
+  std::uint32_t type = 0;
+  std::uint64_t config = 0;
+};
+
+/**
+ * Hardware performance counters of the loop statistics regions per sub region (time cluster).
+ *
+ * With SEISSOL_HARDWARE_COUNTERS (a comma-separated list of events), one perf_event group is
+ * opened for each OpenMP thread. The counters of all threads are read at the begin and the end
+ * of a region, such that a region accounts for the work of the whole team. In tasking mode,
+ * regions run concurrently and their counts overlap.
+ **/
+class HardwareCounters {
+  public:
+  HardwareCounters();
+  ~HardwareCounters();
+
+  HardwareCounters(const HardwareCounters&) = delete;
+  HardwareCounters& operator=(const HardwareCounters&) = delete;
+
+  //! True once the counters have been opened
+  bool enabled() const { return m_enabled; }
+
+  void addRegion(unsigned numberOfThreads);
+
+  //! Opens the counters of all OpenMP threads; has to be called outside of a parallel region.
+  void open();
+
+  void begin(unsigned region, unsigned thread) {
+    if (m_enabled) {
+      read(m_begin[region][thread]);
+    }
+  }
+
+  void end(unsigned region, unsigned subRegion, unsigned thread);
+
+#ifdef USE_MPI
+  //! Sums the counts of all ranks and logs them per region and sub region on rank 0.
+  void printSummary(const std::vector<std::string>& regions, MPI_Comm comm);
+#endif
+
+  /**
+   * Parses a comma-separated list of generic event names (cycles, instructions, cache-references,
+   * cache-misses, branch-misses, l1d-misses, llc-misses) and raw events (r<hex>).
+   * Throws std::invalid_argument for unknown events.
+   **/
+  static std::vector<HardwareEvent> parseEvents(const std::string& list);
+
+  private:
+  //! Reads the counters of all threads into values (thread-major)
+  void read(std::vector<std::uint64_t>& values);
+
+  bool m_enabled = false;
+  std::vector<HardwareEvent> m_events;
+  //! File descriptors of the group leaders (one group per thread) and of all events
+  std::vector<int> m_leaders;
+  std::vector<int> m_fds;
+  std::atomic<bool> m_multiplexed{false};
+
+  //! Snapshots at the begin of a region per thread
+  std::vector<std::vector<std::vector<std::uint64_t>>> m_begin;
+  //! Counts per region and thread; indexed by subRegion * number of events + event
+  std::vector<std::vector<std::vector<double>>> m_counts;
+  std::vector<std::vector<std::uint64_t>> m_scratch;
+};
+} // namespace seissol
+
+#endif // SEISSOL_MONITORING_HARDWARECOUNTERS_H
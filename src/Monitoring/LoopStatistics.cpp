@@ -39,7 +39,10 @@
  
 #include "LoopStatistics.h"
 
+#include <chrono>
 #include <cmath>
+#include <fstream>
+#include <sstream>
 #ifdef USE_NETCDF
 #include <netcdf.h>
 #ifdef USE_MPI
@@ -50,6 +53,27 @@
 #include "Numerical_aux/Statistics.h"
 #include "Monitoring/Stopwatch.h"
 #include <utils/env.h>
+#include <utils/stringutils.h>
+
+seissol::LoopStatistics::LoopStatistics() {
+  static std::atomic<std::uint64_t> instances{0};
+  m_instance = ++instances;
+  const auto mode = utils::StringUtils::toLower(utils::Env::get<std::string>("SEISSOL_LOOP_STAT_MODE", "samples"));
+  if (mode == "stream") {
+    m_mode = Mode::Stream;
+  } else if (mode == "histogram") {
+    m_mode = Mode::Histogram;
+  } else {
+    m_mode = Mode::Samples;
+  }
+  m_prefix = utils::Env::get<std::string>("SEISSOL_LOOP_STAT_PREFIX", "");
+  m_ringCapacity = std::max(1ul, utils::Env::get<unsigned long>("SEISSOL_LOOP_STAT_BUFFER_SIZE", 16384));
+  m_flushInterval = utils::Env::get<double>("SEISSOL_LOOP_STAT_FLUSH_INTERVAL", 1.0);
+}
+
+seissol::LoopStatistics::~LoopStatistics() {
+  stopStreaming();
+}
 
 #ifdef USE_MPI  
 void seissol::LoopStatistics::printSummary(MPI_Comm comm) {
@@ -58,18 +82,14 @@ void seissol::LoopStatistics::printSummary(MPI_Comm comm) {
   double totalTimePerRank = 0.0;
   for (unsigned region = 0; region < nRegions; ++region) {
     double x = 0.0, x2 = 0.0, xy = 0.0, y = 0.0;
-    unsigned N = 0;
-  
-    for (auto const& sample : m_times[region]) {
-      if (sample.numIters > 0) {
-        double time = seconds(difftime(sample.begin, sample.end));
-        x  += sample.numIters;
-        x2 += static_cast<double>(sample.numIters) * static_cast<double>(sample.numIters);
-        xy += static_cast<double>(sample.numIters) * time;
-        y  += time;
-        ++N;
-      }
-    }
+    unsigned long N = 0;
+    forEachAccumulator(region, [&](Accumulator const& acc) {
+      x += acc.x;
+      x2 += acc.x2;
+      xy += acc.xy;
+      y += acc.y;
+      N += acc.N;
+    });
 
     sums[5*region + 0] = x;
     sums[5*region + 1] = x2;
@@ -112,13 +132,11 @@ void seissol::LoopStatistics::printSummary(MPI_Comm comm) {
     regressionCoeffs[2 * region + 0] = constant;
     regressionCoeffs[2 * region + 1] = slope;
 
-    for (auto const& sample : m_times[region]) {
-      if (sample.numIters > 0) {
-        double const error = seconds(difftime(sample.begin, sample.end))
-                                - (constant + slope * sample.numIters);
-        stderror[region] += error * error;
-      }
-    }
+    // sum of the squared residuals of the local samples, expanded in terms of the local sums
+    forEachAccumulator(region, [&](Accumulator const& acc) {
+      stderror[region] += acc.y2 - 2.0 * constant * acc.y - 2.0 * slope * acc.xy + constant * constant * acc.N +
+                          2.0 * constant * slope * acc.x + slope * slope * acc.x2;
+    });
   }
 
   if (rank == 0) {
@@ -153,10 +171,60 @@ void seissol::LoopStatistics::printSummary(MPI_Comm comm) {
     }
 
     logInfo(rank) << "Total time spent in compute kernels:" << totalTime;
+
+    // Every update of a cluster integrates its copy and its interior layer.
+    double constant = 0.0;
+    double perElement = 0.0;
+    for (auto const* name : {"computeLocalIntegration", "computeNeighboringIntegration"}) {
+      auto it = std::find(m_regions.cbegin(), m_regions.cend(), name);
+      if (it != m_regions.cend()) {
+        const auto region = std::distance(m_regions.cbegin(), it);
+        constant += 2.0 * regressionCoeffs[2 * region + 0];
+        perElement += regressionCoeffs[2 * region + 1];
+      }
+    }
+    if (perElement > 0.0 && constant > 0.0) {
+      logInfo(rank) << "Overhead of a cluster update (SEISSOL_LTS_AUTO_MERGE_OVERHEAD):"
+                    << constant / perElement << "element updates";
+    }
   }
+
+  std::vector<unsigned long> counts(2 * m_counters.size());
+  for (unsigned counter = 0; counter < m_counters.size(); ++counter) {
+    counts[2 * counter + 0] = m_counters[counter].active.load();
+    counts[2 * counter + 1] = m_counters[counter].total.load();
+  }
+  MPI_Allreduce(MPI_IN_PLACE, counts.data(), counts.size(), MPI_UNSIGNED_LONG, MPI_SUM, comm);
+  for (unsigned counter = 0; counter < m_counters.size(); ++counter) {
+    if (counts[2 * counter + 1] > 0) {
+      logInfo(rank) << m_counters[counter].name << ":"
+                    << 100.0 * counts[2 * counter + 0] / counts[2 * counter + 1] << "% active"
+                    << "(" << counts[2 * counter + 0] << "of" << counts[2 * counter + 1] << ")";
+    }
+  }
+
+  m_hardwareCounters.printSummary(m_regions, comm);
 }
 #endif
 
+std::vector<double> seissol::LoopStatistics::getTimePerSubRegion(unsigned region, unsigned numberOfSubRegions) {
+  auto times = std::vector<double>(numberOfSubRegions, 0.0);
+  forEachAccumulator(region, [&](Accumulator const& acc) {
+    for (unsigned subRegion = 0; subRegion < std::min<std::size_t>(numberOfSubRegions, acc.timePerSubRegion.size()); ++subRegion) {
+      times[subRegion] += acc.timePerSubRegion[subRegion];
+    }
+  });
+  return times;
+}
+
+double seissol::LoopStatistics::getNumberOfIterations(unsigned region) {
+  double iterations = 0.0;
+  forEachAccumulator(region, [&](Accumulator const& acc) {
+    iterations += acc.x;
+  });
+  return iterations;
+}
+
 #ifdef USE_NETCDF
 static void check_err(const int stat, const int line, const char *file) {
   if (stat != NC_NOERR) {
@@ -180,7 +248,21 @@ template <> struct type2nc<uint64_t> {
 #endif
   
 void seissol::LoopStatistics::writeSamples() {
-  std::string loopStatFile = utils::Env::get<std::string>("SEISSOL_LOOP_STAT_PREFIX", "");
+  switch (m_mode) {
+    case Mode::Samples:
+      writeNetcdfSamples();
+      break;
+    case Mode::Stream:
+      stopStreaming();
+      break;
+    case Mode::Histogram:
+      writeHistograms();
+      break;
+  }
+}
+
+void seissol::LoopStatistics::writeNetcdfSamples() {
+  std::string const& loopStatFile = m_prefix;
   if (!loopStatFile.empty()) {
 #if defined(USE_NETCDF) && defined(USE_MPI)
     unsigned nRegions = m_times.size();
@@ -208,12 +290,12 @@ void seissol::LoopStatistics::writeSamples() {
         stat = nc_insert_compound(ncid, timespectyp, "nsec", NC_COMPOUND_OFFSET(timespec,tv_nsec), type2nc<decltype(timespec::tv_nsec)>::type); check_err(stat,__LINE__,__FILE__);
       }
 
-      stat = nc_def_compound(ncid, sizeof(Sample), "Sample", &sampletyp); check_err(stat,__LINE__,__FILE__);
+      stat = nc_def_compound(ncid, sizeof(LoopSample), "Sample", &sampletyp); check_err(stat,__LINE__,__FILE__);
       {
-        stat = nc_insert_compound(ncid, sampletyp, "begin", NC_COMPOUND_OFFSET(Sample,begin), timespectyp); check_err(stat,__LINE__,__FILE__);
-        stat = nc_insert_compound(ncid, sampletyp, "end", NC_COMPOUND_OFFSET(Sample,end), timespectyp); check_err(stat,__LINE__,__FILE__);
-        stat = nc_insert_compound(ncid, sampletyp, "loopLength", NC_COMPOUND_OFFSET(Sample,numIters), NC_UINT); check_err(stat,__LINE__,__FILE__);
-        stat = nc_insert_compound(ncid, sampletyp, "subRegion", NC_COMPOUND_OFFSET(Sample,subRegion), NC_UINT); check_err(stat,__LINE__,__FILE__);
+        stat = nc_insert_compound(ncid, sampletyp, "begin", NC_COMPOUND_OFFSET(LoopSample,begin), timespectyp); check_err(stat,__LINE__,__FILE__);
+        stat = nc_insert_compound(ncid, sampletyp, "end", NC_COMPOUND_OFFSET(LoopSample,end), timespectyp); check_err(stat,__LINE__,__FILE__);
+        stat = nc_insert_compound(ncid, sampletyp, "loopLength", NC_COMPOUND_OFFSET(LoopSample,numIters), NC_UINT); check_err(stat,__LINE__,__FILE__);
+        stat = nc_insert_compound(ncid, sampletyp, "subRegion", NC_COMPOUND_OFFSET(LoopSample,subRegion), NC_UINT); check_err(stat,__LINE__,__FILE__);
       }
       
       stat = nc_def_var(ncid, "offset", NC_INT,   1, &rankdim,   &offsetid); check_err(stat,__LINE__,__FILE__);
@@ -248,3 +330,100 @@ void seissol::LoopStatistics::writeSamples() {
 #endif
   }
 }
+
+void seissol::LoopStatistics::startStreaming() {
+  if (m_prefix.empty()) {
+    logWarning(seissol::MPI::mpi.rank()) << "SEISSOL_LOOP_STAT_MODE=stream requires SEISSOL_LOOP_STAT_PREFIX; no samples are written.";
+    return;
+  }
+  m_streaming = true;
+  m_streamThread = std::thread([this]() {
+    std::unique_lock<std::mutex> lock(m_streamMutex);
+    while (!m_stopStreaming) {
+      m_streamCondition.wait_for(lock, std::chrono::duration<double>(m_flushInterval));
+      flushRings();
+    }
+  });
+}
+
+void seissol::LoopStatistics::stopStreaming() {
+  if (!m_streaming) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(m_streamMutex);
+    m_stopStreaming = true;
+  }
+  m_streamCondition.notify_one();
+  m_streamThread.join();
+  m_streaming = false;
+
+  std::lock_guard<std::mutex> lock(m_streamMutex);
+  flushRings();
+  if (m_dropped > 0) {
+    logWarning(seissol::MPI::mpi.rank()) << "Dropped" << m_dropped.load() << "loop statistics samples;"
+                                         << "increase SEISSOL_LOOP_STAT_BUFFER_SIZE or decrease SEISSOL_LOOP_STAT_FLUSH_INTERVAL.";
+  }
+  for (auto* file : m_streamFiles) {
+    if (file != nullptr) {
+      std::fclose(file);
+    }
+  }
+  m_streamFiles.clear();
+}
+
+void seissol::LoopStatistics::flushRings() {
+  m_streamFiles.resize(m_rings.size(), nullptr);
+  for (unsigned region = 0; region < m_rings.size(); ++region) {
+    if (m_streamFiles[region] == nullptr) {
+      std::string const fileName = m_prefix + m_regions[region] + "." + std::to_string(seissol::MPI::mpi.rank()) + ".bin";
+      m_streamFiles[region] = std::fopen(fileName.c_str(), "wb");
+      if (m_streamFiles[region] == nullptr) {
+        logError() << "Could not open" << fileName;
+      }
+    }
+    std::FILE* file = m_streamFiles[region];
+    m_rings[region]->drain([file](LoopSample const& sample) {
+      std::fwrite(&sample, sizeof(LoopSample), 1, file);
+    });
+    std::fflush(file);
+  }
+}
+
+void seissol::LoopStatistics::writeHistograms() {
+  constexpr unsigned NumberOfBins = Histogram::NumberOfBins;
+  unsigned const nRegions = m_histograms.size();
+  auto counts = std::vector<unsigned long>(NumberOfBins * nRegions);
+  for (unsigned region = 0; region < nRegions; ++region) {
+    for (unsigned b = 0; b < NumberOfBins; ++b) {
+      counts[NumberOfBins * region + b] = m_histograms[region]->counts[b].load();
+    }
+  }
+  int const rank = seissol::MPI::mpi.rank();
+#ifdef USE_MPI
+  MPI_Allreduce(MPI_IN_PLACE, counts.data(), counts.size(), MPI_UNSIGNED_LONG, MPI_SUM, seissol::MPI::mpi.comm());
+#endif
+  if (rank != 0) {
+    return;
+  }
+
+  if (m_prefix.empty()) {
+    for (unsigned region = 0; region < nRegions; ++region) {
+      std::stringstream line;
+      for (unsigned b = 0; b < NumberOfBins; ++b) {
+        if (counts[NumberOfBins * region + b] > 0) {
+          line << " [" << (1ul << b) << "us):" << counts[NumberOfBins * region + b];
+        }
+      }
+      logInfo(rank) << "Histogram of" << m_regions[region] << line.str();
+    }
+  } else {
+    std::ofstream file(m_prefix + "histogram.csv");
+    file << "region,lower_bound_us,count\n";
+    for (unsigned region = 0; region < nRegions; ++region) {
+      for (unsigned b = 0; b < NumberOfBins; ++b) {
+        file << m_regions[region] << "," << (b == 0 ? 0ul : (1ul << b)) << "," << counts[NumberOfBins * region + b] << "\n";
+      }
+    }
+  }
+}
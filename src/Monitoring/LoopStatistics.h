@@ -42,24 +42,110 @@
 
 #include <cassert>
 #include <algorithm>
-#include <unordered_map>
-#include <fstream>
-#include <iomanip>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
 #include <time.h>
 #include <vector>
 
+#include "Monitoring/HardwareCounters.h"
+#include "Monitoring/Stopwatch.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #ifdef USE_MPI
 #include <mpi.h>
 #endif
 
 namespace seissol {
+struct LoopSample {
+  timespec begin;
+  timespec end;
+  unsigned numIters;
+  unsigned subRegion;
+};
+
+//! Bounded multi-producer, single-consumer queue of samples.
+class SampleRing {
+public:
+  explicit SampleRing(std::size_t capacity) : m_capacity(capacity), m_slots(new Slot[capacity]) {}
+
+  //! Returns false if the ring is full.
+  bool push(LoopSample const& sample) {
+    std::uint64_t head = m_head.load(std::memory_order_relaxed);
+    do {
+      if (head - m_tail.load(std::memory_order_acquire) >= m_capacity) {
+        return false;
+      }
+    } while (!m_head.compare_exchange_weak(head, head + 1, std::memory_order_relaxed));
+    Slot& slot = m_slots[head % m_capacity];
+    slot.sample = sample;
+    slot.sequence.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  //! Calls consume(sample) for all published samples in order; must only be called by one thread at a time.
+  template <typename F>
+  void drain(F&& consume) {
+    std::uint64_t tail = m_tail.load(std::memory_order_relaxed);
+    while (m_slots[tail % m_capacity].sequence.load(std::memory_order_acquire) == tail + 1) {
+      consume(m_slots[tail % m_capacity].sample);
+      ++tail;
+      m_tail.store(tail, std::memory_order_release);
+    }
+  }
+
+private:
+  struct Slot {
+    std::atomic<std::uint64_t> sequence{0};
+    LoopSample sample;
+  };
+
+  std::size_t m_capacity;
+  std::unique_ptr<Slot[]> m_slots;
+  alignas(64) std::atomic<std::uint64_t> m_head{0};
+  alignas(64) std::atomic<std::uint64_t> m_tail{0};
+};
+
 class LoopStatistics {
 public:
+  /**
+   * Storage of the samples (SEISSOL_LOOP_STAT_MODE):
+   * Samples keeps all samples and writes them to NetCDF files at the end (if SEISSOL_LOOP_STAT_PREFIX is set),
+   * Stream writes them periodically from a bounded ring buffer per region to binary files,
+   * Histogram only keeps a histogram of the durations per region.
+   * The summary and the time per sub region are available in all modes.
+   **/
+  enum class Mode { Samples, Stream, Histogram };
+
+  LoopStatistics();
+  ~LoopStatistics();
+
+  //! Regions must be added while no samples are recorded, i.e. before or after the time stepping.
   void addRegion(std::string const& name, bool includeInSummary = true) {
+    std::lock_guard<std::mutex> lock(m_streamMutex);
     m_regions.push_back(name);
-    m_begin.push_back(timespec{});
+    {
+      std::lock_guard<std::mutex> threadsLock(m_threadsMutex);
+      for (auto& state : m_threads) {
+        state.begin.emplace_back();
+        state.accumulators.emplace_back();
+      }
+    }
     m_times.emplace_back();
+    m_rings.push_back(m_mode == Mode::Stream ? std::make_unique<SampleRing>(m_ringCapacity) : nullptr);
+    m_histograms.push_back(m_mode == Mode::Histogram ? std::make_unique<Histogram>() : nullptr);
     m_includeInSummary.push_back(includeInSummary);
+    m_hardwareCounters.addRegion(numberOfThreads());
   }
   
   unsigned getRegion(std::string const& name) {
@@ -69,47 +155,244 @@ public:
     return std::distance(first, it);
   }
   
+  // Regions may be timed concurrently by different threads in tasking mode,
+  // hence the begin timestamps are kept per thread.
   void begin(unsigned region) {
-    clock_gettime(CLOCK_MONOTONIC, &m_begin[region]);
+#ifdef USE_HARDWARE_COUNTERS
+    m_hardwareCounters.begin(region, threadId());
+#endif
+    clock_gettime(CLOCK_MONOTONIC, &threadState().begin[region]);
   }
   
   void end(unsigned region, unsigned numIterations, unsigned subRegion) {
-    Sample sample;
+    LoopSample sample;
     clock_gettime(CLOCK_MONOTONIC, &sample.end);
-    sample.begin = m_begin[region];
+#ifdef USE_HARDWARE_COUNTERS
+    m_hardwareCounters.end(region, subRegion, threadId());
+#endif
+    sample.begin = threadState().begin[region];
     sample.numIters = numIterations;
     sample.subRegion = subRegion;
-    m_times[region].push_back(sample);
+    record(region, sample, false);
   }
 
   void addSample(unsigned region, unsigned numIters, unsigned subRegion,
                  timespec begin, timespec end) {
-    Sample sample;
-    sample.begin = std::move(begin);
-    sample.end = std::move(end);
+    LoopSample sample;
+    sample.begin = begin;
+    sample.end = end;
     sample.numIters = numIters;
     sample.subRegion = subRegion;
-    m_times[region].push_back(sample);
+    record(region, sample, true);
   }
 
 #ifdef USE_MPI  
   void printSummary(MPI_Comm comm);
 #endif
 
+  //! Starts the hardware counters (SEISSOL_HARDWARE_COUNTERS) of the regions timed with begin and end.
+  void openHardwareCounters() {
+#ifdef USE_HARDWARE_COUNTERS
+    m_hardwareCounters.open();
+#endif
+  }
+
+  //! Sums up the durations of the samples of a region for each sub region (e.g. the global time cluster).
+  std::vector<double> getTimePerSubRegion(unsigned region, unsigned numberOfSubRegions);
+
+  //! Counters report the fraction of active items (e.g. slipping fault faces) in the summary; add them like regions.
+  void addCounter(std::string const& name) {
+    m_counters.emplace_back();
+    m_counters.back().name = name;
+  }
+
+  unsigned getCounter(std::string const& name) const {
+    auto it = std::find_if(m_counters.cbegin(), m_counters.cend(), [&](Counter const& c) { return c.name == name; });
+    assert(it != m_counters.cend());
+    return std::distance(m_counters.cbegin(), it);
+  }
+
+  //! May be called concurrently.
+  void count(unsigned counter, unsigned long active, unsigned long total) {
+    m_counters[counter].active.fetch_add(active, std::memory_order_relaxed);
+    m_counters[counter].total.fetch_add(total, std::memory_order_relaxed);
+  }
+
+  //! Sums up the iterations (e.g. element updates) of the samples of a region.
+  double getNumberOfIterations(unsigned region);
+
+  std::vector<std::string> const& getRegions() const { return m_regions; }
+
   void writeSamples();
   
 private:
-  struct Sample {
-    timespec begin;
-    timespec end;
-    unsigned numIters;
-    unsigned subRegion;
+  static unsigned numberOfThreads() {
+#ifdef _OPENMP
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+  }
+
+  static unsigned threadId() {
+#ifdef _OPENMP
+    return omp_get_thread_num();
+#else
+    return 0;
+#endif
+  }
+
+  //! Sums of the regression analysis; each thread only updates its own accumulator.
+  struct Accumulator {
+    double x = 0.0;
+    double x2 = 0.0;
+    double xy = 0.0;
+    double y = 0.0;
+    double y2 = 0.0;
+    unsigned long N = 0;
+    std::vector<double> timePerSubRegion;
   };
-  
-  std::vector<timespec> m_begin;
+
+  //! Bin b counts the durations in [2^b, 2^(b+1)) microseconds (the first bin also counts shorter durations).
+  struct Histogram {
+    static constexpr unsigned NumberOfBins = 40;
+    std::array<std::atomic<unsigned long>, NumberOfBins> counts{};
+
+    static unsigned bin(long long nanoseconds) {
+      unsigned b = 0;
+      for (long long t = nanoseconds / 1000; t > 1 && b < NumberOfBins - 1; t >>= 1) {
+        ++b;
+      }
+      return b;
+    }
+  };
+
+  //! State of one thread which records samples, including threads outside of OpenMP (e.g. communication threads).
+  struct ThreadState {
+    std::vector<timespec> begin;
+    //! Indexed by the region
+    std::vector<Accumulator> accumulators;
+  };
+
+  struct Counter {
+    std::string name;
+    std::atomic<unsigned long> active{0};
+    std::atomic<unsigned long> total{0};
+  };
+
+  //! In stream mode, a sample is dropped if the ring of its region is full, unless mayWait is set.
+  void record(unsigned region, LoopSample const& sample, bool mayWait) {
+    const auto duration = difftime(sample.begin, sample.end);
+    if (sample.numIters > 0) {
+      Accumulator& acc = threadState().accumulators[region];
+      const double time = seconds(duration);
+      const double n = sample.numIters;
+      acc.x += n;
+      acc.x2 += n * n;
+      acc.xy += n * time;
+      acc.y += time;
+      acc.y2 += time * time;
+      ++acc.N;
+    }
+    addTimePerSubRegion(region, sample.subRegion, seconds(duration));
+
+    switch (m_mode) {
+      case Mode::Samples:
+        if (!m_prefix.empty()) {
+          std::lock_guard<std::mutex> lock(m_mutex);
+          m_times[region].push_back(sample);
+        }
+        break;
+      case Mode::Stream:
+        std::call_once(m_streamingStarted, [this]() { startStreaming(); });
+        if (m_streaming && !m_rings[region]->push(sample)) {
+          if (mayWait) {
+            do {
+              m_streamCondition.notify_one();
+              std::this_thread::yield();
+            } while (!m_rings[region]->push(sample));
+          } else {
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+          }
+        }
+        break;
+      case Mode::Histogram:
+        m_histograms[region]->counts[Histogram::bin(duration)].fetch_add(1, std::memory_order_relaxed);
+        break;
+    }
+  }
+
+  void addTimePerSubRegion(unsigned region, unsigned subRegion, double time) {
+    auto& times = threadState().accumulators[region].timePerSubRegion;
+    if (subRegion >= times.size()) {
+      times.resize(subRegion + 1, 0.0);
+    }
+    times[subRegion] += time;
+  }
+
+  /**
+   * The state of the calling thread, which is created on its first sample.
+   * omp_get_thread_num() does not work as the index, as all threads outside of OpenMP parallel regions are thread 0.
+   **/
+  ThreadState& threadState() {
+    thread_local std::uint64_t owner = 0;
+    thread_local ThreadState* state = nullptr;
+    if (owner != m_instance) {
+      std::lock_guard<std::mutex> lock(m_threadsMutex);
+      m_threads.emplace_back();
+      m_threads.back().begin.resize(m_regions.size());
+      m_threads.back().accumulators.resize(m_regions.size());
+      state = &m_threads.back();
+      owner = m_instance;
+    }
+    return *state;
+  }
+
+  //! Calls f(accumulator) for the accumulators of a region of all threads.
+  template <typename F>
+  void forEachAccumulator(unsigned region, F&& f) {
+    std::lock_guard<std::mutex> lock(m_threadsMutex);
+    for (auto const& state : m_threads) {
+      f(state.accumulators[region]);
+    }
+  }
+
+  void startStreaming();
+  void stopStreaming();
+  //! Writes all samples in the rings to the files; the caller holds m_streamMutex.
+  void flushRings();
+
+  void writeNetcdfSamples();
+  void writeHistograms();
+
+  Mode m_mode;
+  std::string m_prefix;
+  std::size_t m_ringCapacity;
+  double m_flushInterval;
+
+  //! Identifies this object in the thread-local caches of threadState(); never 0
+  std::uint64_t m_instance;
+  //! A deque, as the threads keep pointers to their state
+  std::deque<ThreadState> m_threads;
+  std::mutex m_threadsMutex;
+  std::mutex m_mutex;
   std::vector<std::string> m_regions;
-  std::vector<std::vector<Sample>> m_times;
+  std::vector<std::vector<LoopSample>> m_times;
+  std::vector<std::unique_ptr<SampleRing>> m_rings;
+  std::vector<std::unique_ptr<Histogram>> m_histograms;
   std::vector<bool> m_includeInSummary;
+  //! A deque, as the atomic counters can not be moved
+  std::deque<Counter> m_counters;
+  HardwareCounters m_hardwareCounters;
+
+  std::once_flag m_streamingStarted;
+  bool m_streaming = false;
+  bool m_stopStreaming = false;
+  std::atomic<unsigned long> m_dropped{0};
+  std::mutex m_streamMutex;
+  std::condition_variable m_streamCondition;
+  std::thread m_streamThread;
+  std::vector<std::FILE*> m_streamFiles;
 };
 }
 
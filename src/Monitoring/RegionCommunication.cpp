@@ -0,0 +1,131 @@
+#include "RegionCommunication.h"
+
+#include <fstream>
+#include <sstream>
+
+#include "Monitoring/Stopwatch.h"
+#include "Parallel/MPI.h"
+#include <utils/logger.h>
+
+namespace seissol {
+
+namespace {
+//! Number of doubles per region in the gather
+constexpr int PackedSize = 10;
+
+void pack(RegionCommunication const& region, double* packed) {
+  packed[0] = region.rank;
+  packed[1] = region.neighborRank;
+  packed[2] = region.globalClusterId;
+  packed[3] = region.neighborClusterId;
+  packed[4] = static_cast<double>(region.sendBytes);
+  packed[5] = static_cast<double>(region.receiveBytes);
+  packed[6] = static_cast<double>(region.numberOfSends);
+  packed[7] = static_cast<double>(region.numberOfReceives);
+  packed[8] = static_cast<double>(region.sendTime);
+  packed[9] = static_cast<double>(region.receiveTime);
+}
+
+RegionCommunication unpack(double const* packed) {
+  RegionCommunication region;
+  region.rank = static_cast<int>(packed[0]);
+  region.neighborRank = static_cast<int>(packed[1]);
+  region.globalClusterId = static_cast<int>(packed[2]);
+  region.neighborClusterId = static_cast<int>(packed[3]);
+  region.sendBytes = static_cast<std::uint64_t>(packed[4]);
+  region.receiveBytes = static_cast<std::uint64_t>(packed[5]);
+  region.numberOfSends = static_cast<std::uint64_t>(packed[6]);
+  region.numberOfReceives = static_cast<std::uint64_t>(packed[7]);
+  region.sendTime = static_cast<long long>(packed[8]);
+  region.receiveTime = static_cast<long long>(packed[9]);
+  return region;
+}
+} // namespace
+
+double RegionCommunication::meanLatency(bool isReceive) const {
+  const auto messages = isReceive ? numberOfReceives : numberOfSends;
+  return messages > 0 ? seconds(isReceive ? receiveTime : sendTime) / messages : 0.0;
+}
+
+double RegionCommunication::bandwidth(bool isReceive) const {
+  const double time = seconds(isReceive ? receiveTime : sendTime);
+  const auto bytes = isReceive ? receiveBytes * numberOfReceives : sendBytes * numberOfSends;
+  return time > 0.0 ? bytes / time : 0.0;
+}
+
+std::string formatRegionCommunication(std::vector<RegionCommunication> const& regions) {
+  std::ostringstream csv;
+  csv << "rank,neighbor_rank,cluster,neighbor_cluster,direction,messages,bytes_per_message,mean_latency,bandwidth\n";
+  for (auto const& region : regions) {
+    for (const bool isReceive : {false, true}) {
+      csv << region.rank << "," << region.neighborRank << "," << region.globalClusterId << ","
+          << region.neighborClusterId << "," << (isReceive ? "receive" : "send") << ","
+          << (isReceive ? region.numberOfReceives : region.numberOfSends) << ","
+          << (isReceive ? region.receiveBytes : region.sendBytes) << "," << region.meanLatency(isReceive) << ","
+          << region.bandwidth(isReceive) << "\n";
+    }
+  }
+  return csv.str();
+}
+
+void reportRegionCommunication(std::vector<RegionCommunication> const& regions, std::string const& fileName) {
+  const int rank = MPI::mpi.rank();
+  std::vector<double> packed(PackedSize * regions.size());
+  for (std::size_t i = 0; i < regions.size(); ++i) {
+    pack(regions[i], &packed[PackedSize * i]);
+  }
+
+  std::vector<double> allPacked;
+#ifdef USE_MPI
+  int size = static_cast<int>(packed.size());
+  std::vector<int> sizes(MPI::mpi.size());
+  MPI_Gather(&size, 1, MPI_INT, sizes.data(), 1, MPI_INT, 0, MPI::mpi.comm());
+  std::vector<int> displacements(MPI::mpi.size() + 1, 0);
+  for (int i = 0; i < MPI::mpi.size(); ++i) {
+    displacements[i + 1] = displacements[i] + sizes[i];
+  }
+  if (rank == 0) {
+    allPacked.resize(displacements.back());
+  }
+  MPI_Gatherv(packed.data(),
+              size,
+              MPI_DOUBLE,
+              allPacked.data(),
+              sizes.data(),
+              displacements.data(),
+              MPI_DOUBLE,
+              0,
+              MPI::mpi.comm());
+#else
+  allPacked = packed;
+#endif
+  if (rank != 0) {
+    return;
+  }
+
+  std::vector<RegionCommunication> allRegions;
+  RegionCommunication total;
+  for (std::size_t i = 0; i < allPacked.size(); i += PackedSize) {
+    allRegions.push_back(unpack(&allPacked[i]));
+    auto const& region = allRegions.back();
+    total.sendBytes += region.sendBytes * region.numberOfSends;
+    total.receiveBytes += region.receiveBytes * region.numberOfReceives;
+    total.numberOfSends += region.numberOfSends;
+    total.numberOfReceives += region.numberOfReceives;
+    total.sendTime += region.sendTime;
+    total.receiveTime += region.receiveTime;
+  }
+  // The bytes of the total are the sums over all messages
+  logInfo(rank) << "Ghost layer messages:" << total.numberOfSends << "sends, mean latency"
+                << total.meanLatency(false) << "s," << (total.sendTime > 0 ? total.sendBytes / seconds(total.sendTime) : 0.0)
+                << "B/s;" << total.numberOfReceives << "receives, mean latency" << total.meanLatency(true) << "s,"
+                << (total.receiveTime > 0 ? total.receiveBytes / seconds(total.receiveTime) : 0.0) << "B/s.";
+
+  if (!fileName.empty()) {
+    std::ofstream file(fileName);
+    file << formatRegionCommunication(allRegions);
+    logInfo(rank) << "Wrote the communication of" << allRegions.size() << "regions to" << fileName;
+  }
+}
+
+} // namespace seissol
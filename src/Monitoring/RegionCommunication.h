@@ -0,0 +1,57 @@
+#ifndef SEISSOL_MONITORING_REGIONCOMMUNICATION_H
+#define SEISSOL_MONITORING_REGIONCOMMUNICATION_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace seissol {
+
+/**
+ * Messages of one region of a ghost cluster, i.e. with one neighboring rank and one neighboring cluster.
+ * The latency of a message is the time from posting its request until the completion was detected by the actor,
+ * which includes the time in which the neighbor was still busy.
+ **/
+struct RegionCommunication {
+  int rank = 0;
+  int neighborRank = 0;
+  int globalClusterId = 0;
+  int neighborClusterId = 0;
+  //! Bytes of one message
+  std::uint64_t sendBytes = 0;
+  std::uint64_t receiveBytes = 0;
+  std::uint64_t numberOfSends = 0;
+  std::uint64_t numberOfReceives = 0;
+  //! Sums of the latencies in nanoseconds
+  long long sendTime = 0;
+  long long receiveTime = 0;
+
+  void addMessage(bool isReceive, long long latency) {
+    if (isReceive) {
+      ++numberOfReceives;
+      receiveTime += latency;
+    } else {
+      ++numberOfSends;
+      sendTime += latency;
+    }
+  }
+
+  //! Mean latency in seconds
+  [[nodiscard]] double meanLatency(bool isReceive) const;
+
+  //! Bytes per second of latency
+  [[nodiscard]] double bandwidth(bool isReceive) const;
+};
+
+//! CSV with one line per region and direction
+std::string formatRegionCommunication(std::vector<RegionCommunication> const& regions);
+
+/**
+ * Gathers the regions of all ranks on rank 0, which logs the mean latency and bandwidth of all messages and writes
+ * the regions to fileName (unless it is empty). Collective.
+ **/
+void reportRegionCommunication(std::vector<RegionCommunication> const& regions, std::string const& fileName);
+
+} // namespace seissol
+
+#endif // SEISSOL_MONITORING_REGIONCOMMUNICATION_H
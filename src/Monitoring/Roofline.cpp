@@ -0,0 +1,118 @@
+#include "Roofline.h"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+#include "Parallel/MPI.h"
+#include <utils/env.h>
+#include <utils/logger.h>
+
+namespace {
+double rate(double value, double time) { return time > 0.0 ? 1.e-9 * value / time : 0.0; }
+
+double intensity(const seissol::RooflineCounters& counters) {
+  return counters.bytes > 0.0 ? counters.hardwareFlops / counters.bytes : 0.0;
+}
+} // namespace
+
+const char* seissol::rooflineKernelName(RooflineKernel kernel) {
+  switch (kernel) {
+  case RooflineKernel::Local:
+    return "local";
+  case RooflineKernel::Neighbor:
+    return "neighbor";
+  default:
+    return "unknown";
+  }
+}
+
+seissol::Roofline::Roofline() {
+  m_peakGflops = utils::Env::get<double>("SEISSOL_ROOFLINE_PEAK_GFLOPS", 0.0);
+  m_peakBandwidth = utils::Env::get<double>("SEISSOL_ROOFLINE_PEAK_BANDWIDTH", 0.0);
+  m_prefix = utils::Env::get<std::string>("SEISSOL_ROOFLINE_PREFIX", "");
+}
+
+const char* seissol::Roofline::bound(double intensity, double peakGflops, double peakBandwidth) {
+  if (!(peakGflops > 0.0 && peakBandwidth > 0.0)) {
+    return "unknown";
+  }
+  // Ridge point of the machine in flop/byte
+  return intensity < peakGflops / peakBandwidth ? "bandwidth" : "compute";
+}
+
+double seissol::Roofline::efficiency(const RooflineCounters& counters, double peakGflops, double peakBandwidth) {
+  const double attainable = std::min(peakGflops, intensity(counters) * peakBandwidth);
+  return attainable > 0.0 ? rate(counters.hardwareFlops, counters.time) / attainable : 0.0;
+}
+
+std::string seissol::Roofline::formatCsv(const std::vector<RooflineEntry>& entries,
+                                         double peakGflops,
+                                         double peakBandwidth) {
+  std::ostringstream stream;
+  stream.precision(10);
+  stream << "cluster,layer,kernel,time,hardware_flops,bytes,gflops,gbytes_per_second,intensity,bound,efficiency\n";
+  for (const auto& entry : entries) {
+    const auto& counters = entry.counters;
+    stream << entry.cluster << ',' << entry.layer << ',' << rooflineKernelName(entry.kernel) << ',' << counters.time
+           << ',' << counters.hardwareFlops << ',' << counters.bytes << ','
+           << rate(counters.hardwareFlops, counters.time) << ',' << rate(counters.bytes, counters.time) << ','
+           << intensity(counters) << ',' << bound(intensity(counters), peakGflops, peakBandwidth) << ','
+           << efficiency(counters, peakGflops, peakBandwidth) << '\n';
+  }
+  return stream.str();
+}
+
+void seissol::Roofline::report(std::vector<RooflineEntry> entries) const {
+  const int rank = seissol::MPI::mpi.rank();
+#ifdef USE_MPI
+  std::vector<double> values;
+  values.reserve(3 * entries.size());
+  for (const auto& entry : entries) {
+    values.insert(values.end(), {entry.counters.time, entry.counters.hardwareFlops, entry.counters.bytes});
+  }
+  MPI_Reduce(rank == 0 ? MPI_IN_PLACE : values.data(),
+             values.data(),
+             values.size(),
+             MPI_DOUBLE,
+             MPI_SUM,
+             0,
+             seissol::MPI::mpi.comm());
+  for (unsigned i = 0; i < entries.size(); ++i) {
+    entries[i].counters = {values[3 * i], values[3 * i + 1], values[3 * i + 2]};
+  }
+#endif // USE_MPI
+  if (rank != 0) {
+    return;
+  }
+
+  // The times are summed over the ranks, hence the rates are averages per rank
+  logInfo(rank) << "Roofline (per rank, hardware flops):";
+  for (const auto& entry : entries) {
+    const auto& counters = entry.counters;
+    if (counters.time <= 0.0) {
+      continue;
+    }
+    std::ostringstream line;
+    line << "Cluster " << entry.cluster << ' ' << entry.layer << ' ' << rooflineKernelName(entry.kernel) << ": "
+         << rate(counters.hardwareFlops, counters.time) << " GFLOPS, " << rate(counters.bytes, counters.time)
+         << " GB/s, " << intensity(counters) << " flop/byte";
+    if (peaksKnown()) {
+      line << ", " << bound(intensity(counters), m_peakGflops, m_peakBandwidth) << "-bound ("
+           << 100.0 * efficiency(counters, m_peakGflops, m_peakBandwidth) << "% of the attainable performance)";
+    }
+    logInfo(rank) << line.str();
+  }
+  if (!peaksKnown()) {
+    logInfo(rank) << "Set SEISSOL_ROOFLINE_PEAK_GFLOPS and SEISSOL_ROOFLINE_PEAK_BANDWIDTH to classify the kernels.";
+  }
+
+  if (!m_prefix.empty()) {
+    const std::string fileName = m_prefix + ".csv";
+    std::ofstream file(fileName);
+    file << formatCsv(entries, m_peakGflops, m_peakBandwidth);
+    if (!file) {
+      logWarning(rank) << "Could not write the roofline report to" << fileName;
+    }
+  }
+}
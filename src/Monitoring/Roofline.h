@@ -0,0 +1,74 @@
+#ifndef SEISSOL_MONITORING_ROOFLINE_H
+#define SEISSOL_MONITORING_ROOFLINE_H
+
+#include <string>
+#include <vector>
+
+namespace seissol {
+
+enum class RooflineKernel { Local = 0, Neighbor, NUM_KERNELS };
+
+const char* rooflineKernelName(RooflineKernel kernel);
+
+//! Accumulated measurements of a kernel of a time cluster
+struct RooflineCounters {
+  double time = 0.0;
+  double hardwareFlops = 0.0;
+  //! Estimated traffic from and to the memory
+  double bytes = 0.0;
+
+  void add(double kernelTime, double kernelHardwareFlops, double kernelBytes) {
+    time += kernelTime;
+    hardwareFlops += kernelHardwareFlops;
+    bytes += kernelBytes;
+  }
+};
+
+struct RooflineEntry {
+  unsigned cluster = 0;
+  std::string layer;
+  RooflineKernel kernel = RooflineKernel::Local;
+  RooflineCounters counters;
+};
+
+/**
+ * Places the kernels of each time cluster and layer in the roofline model at the end of the run.
+ *
+ * The byte traffic is estimated from the sizes of the matrices and tensors the kernels load and
+ * store (as in the proxy). With SEISSOL_ROOFLINE_PEAK_GFLOPS and SEISSOL_ROOFLINE_PEAK_BANDWIDTH
+ * (GB/s, both per MPI rank), each kernel is classified as bandwidth- or compute-bound by the
+ * ridge point of the machine; with SEISSOL_ROOFLINE_PREFIX, the report is also written to
+ * <prefix>.csv.
+ **/
+class Roofline {
+  public:
+  Roofline();
+
+  bool peaksKnown() const { return m_peakGflops > 0.0 && m_peakBandwidth > 0.0; }
+
+  /**
+   * Sums the entries of all ranks (which have to be in the same order), logs the report on rank 0
+   * and writes the CSV file, if requested.
+   **/
+  void report(std::vector<RooflineEntry> entries) const;
+
+  /**
+   * @param intensity Arithmetic intensity in flop/byte
+   * @return "bandwidth" or "compute", or "unknown" without the peaks
+   **/
+  static const char* bound(double intensity, double peakGflops, double peakBandwidth);
+
+  //! Fraction of the attainable performance at the arithmetic intensity of the entry
+  static double efficiency(const RooflineCounters& counters, double peakGflops, double peakBandwidth);
+
+  static std::string formatCsv(const std::vector<RooflineEntry>& entries, double peakGflops, double peakBandwidth);
+
+  private:
+  double m_peakGflops = 0.0;
+  //! GB/s
+  double m_peakBandwidth = 0.0;
+  std::string m_prefix;
+};
+} // namespace seissol
+
+#endif // SEISSOL_MONITORING_ROOFLINE_H
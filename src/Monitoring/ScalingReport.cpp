@@ -0,0 +1,141 @@
+#include "ScalingReport.h"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+#include "Parallel/MPI.h"
+#include <utils/env.h>
+#include <utils/logger.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace {
+constexpr unsigned ValuesPerSample = 6;
+
+struct Summary {
+  double min = 0.0;
+  double mean = 0.0;
+  double max = 0.0;
+};
+
+template <typename Value>
+Summary summarize(std::vector<seissol::ScalingSample> const& samples, Value value) {
+  Summary summary;
+  if (samples.empty()) {
+    return summary;
+  }
+  summary.min = value(samples.front());
+  summary.max = summary.min;
+  for (auto const& sample : samples) {
+    summary.min = std::min(summary.min, value(sample));
+    summary.max = std::max(summary.max, value(sample));
+    summary.mean += value(sample);
+  }
+  summary.mean /= samples.size();
+  return summary;
+}
+
+void writeSummary(std::ostream& stream, const char* name, Summary const& summary) {
+  stream << "  \"" << name << "\": {\"min\": " << summary.min << ", \"mean\": " << summary.mean
+         << ", \"max\": " << summary.max << "},\n";
+}
+} // namespace
+
+seissol::ScalingReport::ScalingReport() {
+  m_fileName = utils::Env::get<std::string>("SEISSOL_SCALING_REPORT", "");
+}
+
+std::string seissol::ScalingReport::formatJson(std::vector<ScalingSample> const& samples,
+                                               unsigned long timeSteps,
+                                               double simulatedTime,
+                                               unsigned clusters,
+                                               unsigned threads) {
+  unsigned long cells = 0;
+  double cellUpdates = 0.0;
+  for (auto const& sample : samples) {
+    cells += sample.cells;
+    cellUpdates += sample.cellUpdates;
+  }
+  const auto wallTime = summarize(samples, [](auto const& s) { return s.wallTime; });
+  const auto computeTime = summarize(samples, [](auto const& s) { return s.computeTime; });
+  const auto cellsPerRank = summarize(samples, [](auto const& s) { return static_cast<double>(s.cells); });
+  const double imbalance = computeTime.mean > 0.0 ? computeTime.max / computeTime.mean - 1.0 : 0.0;
+
+  std::ostringstream stream;
+  stream.precision(10);
+  stream << "{\n"
+         << "  \"ranks\": " << samples.size() << ",\n"
+         << "  \"threads_per_rank\": " << threads << ",\n"
+         << "  \"cells\": " << cells << ",\n"
+         << "  \"clusters\": " << clusters << ",\n"
+         << "  \"time_steps\": " << timeSteps << ",\n"
+         << "  \"simulated_time\": " << simulatedTime << ",\n"
+         << "  \"wall_time\": " << wallTime.max << ",\n"
+         << "  \"time_per_step\": " << (timeSteps > 0 ? wallTime.max / timeSteps : 0.0) << ",\n"
+         << "  \"cell_updates_per_second\": " << (wallTime.max > 0.0 ? cellUpdates / wallTime.max : 0.0) << ",\n";
+  writeSummary(stream, "cells_per_rank", cellsPerRank);
+  writeSummary(stream, "compute_time", computeTime);
+  writeSummary(stream, "communication_time", summarize(samples, [](auto const& s) { return s.communicationTime; }));
+  writeSummary(stream, "communication_wait", summarize(samples, [](auto const& s) { return s.communicationWait; }));
+  stream << "  \"imbalance\": " << imbalance << ",\n"
+         << "  \"per_rank\": [\n";
+  for (unsigned rank = 0; rank < samples.size(); ++rank) {
+    auto const& sample = samples[rank];
+    stream << "    {\"rank\": " << rank << ", \"cells\": " << sample.cells << ", \"wall_time\": " << sample.wallTime
+           << ", \"compute_time\": " << sample.computeTime << ", \"communication_time\": " << sample.communicationTime
+           << ", \"communication_wait\": " << sample.communicationWait << "}"
+           << (rank + 1 < samples.size() ? ",\n" : "\n");
+  }
+  stream << "  ]\n"
+         << "}\n";
+  return stream.str();
+}
+
+void seissol::ScalingReport::write(ScalingSample const& sample,
+                                   unsigned long timeSteps,
+                                   double simulatedTime,
+                                   unsigned clusters) const {
+  if (!enabled()) {
+    return;
+  }
+  const int rank = seissol::MPI::mpi.rank();
+  const double values[ValuesPerSample] = {static_cast<double>(sample.cells),
+                                          sample.cellUpdates,
+                                          sample.wallTime,
+                                          sample.computeTime,
+                                          sample.communicationTime,
+                                          sample.communicationWait};
+  std::vector<double> allValues(ValuesPerSample * seissol::MPI::mpi.size());
+#ifdef USE_MPI
+  MPI_Gather(values, ValuesPerSample, MPI_DOUBLE, allValues.data(), ValuesPerSample, MPI_DOUBLE, 0,
+             seissol::MPI::mpi.comm());
+#else
+  std::copy_n(values, ValuesPerSample, allValues.begin());
+#endif // USE_MPI
+  if (rank != 0) {
+    return;
+  }
+
+  std::vector<ScalingSample> samples(seissol::MPI::mpi.size());
+  for (unsigned i = 0; i < samples.size(); ++i) {
+    const double* rankValues = &allValues[ValuesPerSample * i];
+    samples[i] = {static_cast<unsigned long>(rankValues[0]), rankValues[1], rankValues[2], rankValues[3],
+                  rankValues[4], rankValues[5]};
+  }
+#ifdef _OPENMP
+  const unsigned threads = omp_get_max_threads();
+#else
+  const unsigned threads = 1;
+#endif
+
+  std::ofstream file(m_fileName);
+  file << formatJson(samples, timeSteps, simulatedTime, clusters, threads);
+  if (!file) {
+    logWarning(rank) << "Could not write the scaling report to" << m_fileName;
+  } else {
+    logInfo(rank) << "Wrote the scaling report to" << m_fileName;
+  }
+}
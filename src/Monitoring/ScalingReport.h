@@ -0,0 +1,56 @@
+#ifndef SEISSOL_MONITORING_SCALINGREPORT_H
+#define SEISSOL_MONITORING_SCALINGREPORT_H
+
+#include <string>
+#include <vector>
+
+namespace seissol {
+
+//! Measurements of one rank over the time loop
+struct ScalingSample {
+  unsigned long cells = 0;
+  double cellUpdates = 0.0;
+  double wallTime = 0.0;
+  //! Time in which at least one time cluster computed
+  double computeTime = 0.0;
+  //! Time in which MPI requests of the ghost clusters were in flight
+  double communicationTime = 0.0;
+  //! Part of the communication time which was not covered by computations
+  double communicationWait = 0.0;
+};
+
+/**
+ * Machine-readable summary of a run for the tracking of the weak and strong scaling
+ * (postprocessing/performance/scripts/scaling_benchmark.py).
+ *
+ * With SEISSOL_SCALING_REPORT=<file>, rank 0 writes the report as JSON at the end of the simulation.
+ **/
+class ScalingReport {
+  public:
+  ScalingReport();
+
+  bool enabled() const { return !m_fileName.empty(); }
+
+  /**
+   * Gathers the samples of all ranks and writes the report on rank 0; collective.
+   *
+   * @param timeSteps Number of time steps of the fastest cluster
+   **/
+  void write(ScalingSample const& sample, unsigned long timeSteps, double simulatedTime, unsigned clusters) const;
+
+  /**
+   * The imbalance is the maximum compute time over the mean compute time minus one,
+   * i.e. the fraction of the time the ranks wait for the slowest rank on average.
+   **/
+  static std::string formatJson(std::vector<ScalingSample> const& samples,
+                                unsigned long timeSteps,
+                                double simulatedTime,
+                                unsigned clusters,
+                                unsigned threads);
+
+  private:
+  std::string m_fileName;
+};
+} // namespace seissol
+
+#endif // SEISSOL_MONITORING_SCALINGREPORT_H
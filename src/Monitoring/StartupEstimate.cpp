@@ -0,0 +1,98 @@
+#include "StartupEstimate.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "Parallel/MPI.h"
+#include <utils/env.h>
+#include <utils/logger.h>
+
+namespace {
+constexpr unsigned ValuesPerSample = 6;
+} // namespace
+
+void seissol::StartupEstimate::addCluster(double timeStepWidth,
+                                          unsigned long cells,
+                                          double hardwareFlopsPerUpdate,
+                                          double communicatedBytesPerUpdate) {
+  if (m_sample.minTimeStepWidth == 0.0 || timeStepWidth < m_sample.minTimeStepWidth) {
+    m_sample.minTimeStepWidth = timeStepWidth;
+  }
+  m_sample.cells += cells;
+  m_sample.flopsPerStep += hardwareFlopsPerUpdate;
+  m_sample.cellUpdates += cells / timeStepWidth;
+  m_sample.flops += hardwareFlopsPerUpdate / timeStepWidth;
+  m_sample.communicatedBytes += communicatedBytesPerUpdate / timeStepWidth;
+}
+
+seissol::StartupSummary seissol::StartupEstimate::summarize(std::vector<StartupSample> const& samples,
+                                                            double gflopsPerRank) {
+  StartupSummary summary;
+  if (samples.empty()) {
+    return summary;
+  }
+  double minTimeStepWidth = std::numeric_limits<double>::max();
+  double flopsPerStep = 0.0;
+  double maxFlops = 0.0;
+  for (auto const& sample : samples) {
+    // ranks without cells do not limit the time step width
+    if (sample.minTimeStepWidth > 0.0) {
+      minTimeStepWidth = std::min(minTimeStepWidth, sample.minTimeStepWidth);
+    }
+    flopsPerStep += sample.flopsPerStep;
+    summary.cellUpdates += sample.cellUpdates;
+    summary.flops += sample.flops;
+    summary.communicatedBytes += sample.communicatedBytes;
+    summary.maxCommunicatedBytes = std::max(summary.maxCommunicatedBytes, sample.communicatedBytes);
+    maxFlops = std::max(maxFlops, sample.flops);
+  }
+  if (summary.flops > 0.0) {
+    summary.ltsSpeedup = flopsPerStep / minTimeStepWidth / summary.flops;
+    summary.imbalance = maxFlops / (summary.flops / samples.size()) - 1.0;
+  }
+  if (gflopsPerRank > 0.0) {
+    summary.timePerSimulatedSecond = maxFlops * 1.e-9 / gflopsPerRank;
+  }
+  return summary;
+}
+
+void seissol::StartupEstimate::report() const {
+  const int rank = seissol::MPI::mpi.rank();
+  const double values[ValuesPerSample] = {static_cast<double>(m_sample.cells),
+                                          m_sample.minTimeStepWidth,
+                                          m_sample.flopsPerStep,
+                                          m_sample.cellUpdates,
+                                          m_sample.flops,
+                                          m_sample.communicatedBytes};
+  std::vector<double> allValues(ValuesPerSample * seissol::MPI::mpi.size());
+#ifdef USE_MPI
+  MPI_Gather(values, ValuesPerSample, MPI_DOUBLE, allValues.data(), ValuesPerSample, MPI_DOUBLE, 0,
+             seissol::MPI::mpi.comm());
+#else
+  std::copy_n(values, ValuesPerSample, allValues.begin());
+#endif // USE_MPI
+  if (rank != 0) {
+    return;
+  }
+
+  std::vector<StartupSample> samples(seissol::MPI::mpi.size());
+  for (unsigned i = 0; i < samples.size(); ++i) {
+    const double* rankValues = &allValues[ValuesPerSample * i];
+    samples[i] = {static_cast<unsigned long>(rankValues[0]), rankValues[1], rankValues[2], rankValues[3],
+                  rankValues[4], rankValues[5]};
+  }
+  const double gflopsPerRank = utils::Env::get<double>("SEISSOL_STARTUP_GFLOPS", 0.0);
+  const auto summary = summarize(samples, gflopsPerRank);
+
+  logInfo(rank) << "Startup estimate per simulated second:" << summary.cellUpdates << "element updates,"
+                << summary.flops * 1.e-9 << "HW-GFLOP";
+  logInfo(rank) << "Theoretical speedup of the clustering over global time stepping:" << summary.ltsSpeedup;
+  logInfo(rank) << "Predicted load imbalance (max/mean flops - 1):" << summary.imbalance;
+  logInfo(rank) << "Predicted communication volume per simulated second:" << summary.communicatedBytes * 1.e-9
+                << "GB (max. per rank:" << summary.maxCommunicatedBytes * 1.e-9 << "GB)";
+  if (summary.timePerSimulatedSecond > 0.0) {
+    logInfo(rank) << "Predicted wall time per simulated second:" << summary.timePerSimulatedSecond << "s";
+  } else {
+    logInfo(rank) << "Set SEISSOL_STARTUP_GFLOPS to the sustained HW-GFLOP/s per rank to predict the wall time.";
+  }
+}
@@ -0,0 +1,65 @@
+#ifndef SEISSOL_MONITORING_STARTUPESTIMATE_H
+#define SEISSOL_MONITORING_STARTUPESTIMATE_H
+
+#include <vector>
+
+namespace seissol {
+
+//! Predicted work of one rank per simulated second
+struct StartupSample {
+  unsigned long cells = 0;
+  double minTimeStepWidth = 0.0;
+  //! Hardware flops of one update of all local clusters, i.e. of a time step with global time stepping
+  double flopsPerStep = 0.0;
+  double cellUpdates = 0.0;
+  double flops = 0.0;
+  //! Bytes sent to other ranks
+  double communicatedBytes = 0.0;
+};
+
+struct StartupSummary {
+  //! Ratio of the flops with global time stepping to the flops with the clustering
+  double ltsSpeedup = 1.0;
+  double cellUpdates = 0.0;
+  double flops = 0.0;
+  //! Wall time per simulated second; 0 if SEISSOL_STARTUP_GFLOPS is not set
+  double timePerSimulatedSecond = 0.0;
+  //! Maximum flops over the mean flops of the ranks minus one
+  double imbalance = 0.0;
+  double communicatedBytes = 0.0;
+  double maxCommunicatedBytes = 0.0;
+};
+
+/**
+ * Estimate of the costs of the time loop before the first time step, derived from the clustering and the flops
+ * of the kernels, such that a bad mesh or partition can be rejected early.
+ *
+ * The predicted wall time requires the sustained hardware GFLOP/s of a rank (SEISSOL_STARTUP_GFLOPS), which is
+ * printed at the end of a previous simulation on the same machine ("average over ranks").
+ * Data-dependent flops (plasticity, point sources) are not included.
+ **/
+class StartupEstimate {
+  public:
+  /**
+   * @param timeStepWidth time step width of the cluster.
+   * @param hardwareFlopsPerUpdate flops of one update of the cluster.
+   * @param communicatedBytesPerUpdate bytes sent to other ranks after one update of the cluster.
+   **/
+  void addCluster(double timeStepWidth,
+                  unsigned long cells,
+                  double hardwareFlopsPerUpdate,
+                  double communicatedBytesPerUpdate);
+
+  StartupSample const& sample() const { return m_sample; }
+
+  static StartupSummary summarize(std::vector<StartupSample> const& samples, double gflopsPerRank);
+
+  //! Gathers the samples of all ranks and logs the summary on rank 0; collective.
+  void report() const;
+
+  private:
+  StartupSample m_sample;
+};
+} // namespace seissol
+
+#endif // SEISSOL_MONITORING_STARTUPESTIMATE_H
@@ -0,0 +1,191 @@
+#include "StartupProfiler.h"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <utility>
+
+#include <sys/resource.h>
+
+#include "Parallel/MPI.h"
+#include <utils/env.h>
+#include <utils/logger.h>
+
+namespace {
+struct Summary {
+  double min = 0.0;
+  double mean = 0.0;
+  double max = 0.0;
+};
+
+Summary summarize(std::vector<seissol::StartupProfile> const& profiles,
+                  std::vector<double> seissol::StartupProfile::*values,
+                  unsigned index) {
+  Summary summary;
+  if (profiles.empty()) {
+    return summary;
+  }
+  summary.min = (profiles.front().*values)[index];
+  summary.max = summary.min;
+  for (auto const& profile : profiles) {
+    const double value = (profile.*values)[index];
+    summary.min = std::min(summary.min, value);
+    summary.max = std::max(summary.max, value);
+    summary.mean += value;
+  }
+  summary.mean /= profiles.size();
+  return summary;
+}
+
+void writeSummary(std::ostream& stream, const char* name, Summary const& summary) {
+  stream << "\"" << name << "\": {\"min\": " << summary.min << ", \"mean\": " << summary.mean
+         << ", \"max\": " << summary.max << "}";
+}
+
+void writeValues(std::ostream& stream,
+                 std::vector<seissol::StartupProfile> const& profiles,
+                 std::vector<double> seissol::StartupProfile::*values,
+                 unsigned index) {
+  stream << "\"per_rank\": [";
+  for (unsigned rank = 0; rank < profiles.size(); ++rank) {
+    stream << (profiles[rank].*values)[index] << (rank + 1 < profiles.size() ? ", " : "");
+  }
+  stream << "]";
+}
+} // namespace
+
+seissol::StartupProfiler::StartupProfiler() {
+  m_fileName = utils::Env::get<std::string>("SEISSOL_STARTUP_REPORT", "");
+}
+
+void seissol::StartupProfiler::startPhase(std::string const& name) {
+  if (!enabled()) {
+    return;
+  }
+  endPhase();
+
+  const auto phase = std::find(m_phases.begin(), m_phases.end(), name);
+  m_currentPhase = phase - m_phases.begin();
+  if (phase == m_phases.end()) {
+    m_phases.push_back(name);
+    m_profile.wallTimes.push_back(0.0);
+    m_profile.memoryHighWaterMarks.push_back(0.0);
+  }
+  m_watch.reset();
+  m_watch.start();
+}
+
+void seissol::StartupProfiler::endPhase() {
+  if (m_currentPhase < 0) {
+    return;
+  }
+  m_profile.wallTimes[m_currentPhase] += m_watch.pause();
+  m_profile.memoryHighWaterMarks[m_currentPhase] = memoryHighWaterMark();
+  m_currentPhase = -1;
+}
+
+void seissol::StartupProfiler::addMemory(std::string const& name, std::size_t bytes) {
+  if (!enabled()) {
+    return;
+  }
+  const auto entry = std::find(m_memoryEntries.begin(), m_memoryEntries.end(), name);
+  if (entry == m_memoryEntries.end()) {
+    m_memoryEntries.push_back(name);
+    m_profile.allocatedBytes.push_back(bytes);
+  } else {
+    m_profile.allocatedBytes[entry - m_memoryEntries.begin()] += bytes;
+  }
+}
+
+std::size_t seissol::StartupProfiler::memoryHighWaterMark() {
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) {
+    return 0;
+  }
+  // ru_maxrss is given in kilobytes
+  return static_cast<std::size_t>(usage.ru_maxrss) * 1024;
+}
+
+std::string seissol::StartupProfiler::formatJson(std::vector<std::string> const& phases,
+                                                 std::vector<std::string> const& memoryEntries,
+                                                 std::vector<StartupProfile> const& profiles) {
+  std::ostringstream stream;
+  stream.precision(10);
+  double totalTime = 0.0;
+  for (unsigned phase = 0; phase < phases.size(); ++phase) {
+    totalTime += summarize(profiles, &StartupProfile::wallTimes, phase).max;
+  }
+  stream << "{\n"
+         << "  \"ranks\": " << profiles.size() << ",\n"
+         << "  \"wall_time\": " << totalTime << ",\n"
+         << "  \"phases\": [\n";
+  for (unsigned phase = 0; phase < phases.size(); ++phase) {
+    const auto wallTime = summarize(profiles, &StartupProfile::wallTimes, phase);
+    const double imbalance = wallTime.mean > 0.0 ? wallTime.max / wallTime.mean - 1.0 : 0.0;
+    stream << "    {\"name\": \"" << phases[phase] << "\", ";
+    writeSummary(stream, "wall_time", wallTime);
+    stream << ", \"imbalance\": " << imbalance << ", ";
+    writeSummary(stream, "memory_high_water_mark", summarize(profiles, &StartupProfile::memoryHighWaterMarks, phase));
+    stream << ", ";
+    writeValues(stream, profiles, &StartupProfile::wallTimes, phase);
+    stream << "}" << (phase + 1 < phases.size() ? ",\n" : "\n");
+  }
+  stream << "  ],\n"
+         << "  \"memory\": [\n";
+  for (unsigned entry = 0; entry < memoryEntries.size(); ++entry) {
+    stream << "    {\"name\": \"" << memoryEntries[entry] << "\", ";
+    writeSummary(stream, "bytes", summarize(profiles, &StartupProfile::allocatedBytes, entry));
+    stream << ", ";
+    writeValues(stream, profiles, &StartupProfile::allocatedBytes, entry);
+    stream << "}" << (entry + 1 < memoryEntries.size() ? ",\n" : "\n");
+  }
+  stream << "  ]\n"
+         << "}\n";
+  return stream.str();
+}
+
+void seissol::StartupProfiler::finish() {
+  if (!enabled()) {
+    return;
+  }
+  endPhase();
+
+  const int rank = seissol::MPI::mpi.rank();
+  const unsigned numberOfPhases = m_phases.size();
+  const unsigned numberOfEntries = m_memoryEntries.size();
+  const unsigned valuesPerRank = 2 * numberOfPhases + numberOfEntries;
+  std::vector<double> values;
+  values.insert(values.end(), m_profile.wallTimes.begin(), m_profile.wallTimes.end());
+  values.insert(values.end(), m_profile.memoryHighWaterMarks.begin(), m_profile.memoryHighWaterMarks.end());
+  values.insert(values.end(), m_profile.allocatedBytes.begin(), m_profile.allocatedBytes.end());
+
+  std::vector<double> allValues(valuesPerRank * seissol::MPI::mpi.size());
+#ifdef USE_MPI
+  MPI_Gather(values.data(), valuesPerRank, MPI_DOUBLE, allValues.data(), valuesPerRank, MPI_DOUBLE, 0,
+             seissol::MPI::mpi.comm());
+#else
+  allValues = values;
+#endif // USE_MPI
+
+  // The report is written once
+  const std::string fileName = std::exchange(m_fileName, "");
+  if (rank != 0) {
+    return;
+  }
+
+  std::vector<StartupProfile> profiles(seissol::MPI::mpi.size());
+  for (unsigned i = 0; i < profiles.size(); ++i) {
+    const auto rankValues = allValues.begin() + valuesPerRank * i;
+    profiles[i].wallTimes.assign(rankValues, rankValues + numberOfPhases);
+    profiles[i].memoryHighWaterMarks.assign(rankValues + numberOfPhases, rankValues + 2 * numberOfPhases);
+    profiles[i].allocatedBytes.assign(rankValues + 2 * numberOfPhases, rankValues + valuesPerRank);
+  }
+
+  std::ofstream file(fileName);
+  file << formatJson(m_phases, m_memoryEntries, profiles);
+  if (!file) {
+    logWarning(rank) << "Could not write the startup report to" << fileName;
+  } else {
+    logInfo(rank) << "Wrote the startup report to" << fileName;
+  }
+}
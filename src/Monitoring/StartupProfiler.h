@@ -0,0 +1,69 @@
+#ifndef SEISSOL_MONITORING_STARTUPPROFILER_H
+#define SEISSOL_MONITORING_STARTUPPROFILER_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "Monitoring/Stopwatch.h"
+
+namespace seissol {
+
+//! Measurements of one rank over the startup, in the order of the phases and memory entries
+struct StartupProfile {
+  std::vector<double> wallTimes;
+  //! Resident memory high-water mark of the process at the end of each phase (bytes)
+  std::vector<double> memoryHighWaterMarks;
+  //! Allocated bytes of each memory entry, e.g. of the variables of the LTS tree
+  std::vector<double> allocatedBytes;
+};
+
+/**
+ * Wall time and resident memory high-water mark of the phases of the startup
+ * (mesh reading, partitioning, LTS layout, memory layout, material, cell local matrices, dynamic rupture, output).
+ *
+ * A phase lasts until the next phase starts; phases which start several times accumulate their time.
+ * All ranks have to pass through the same phases in the same order.
+ * With SEISSOL_STARTUP_REPORT=<file>, rank 0 writes the report as JSON before the time loop.
+ **/
+class StartupProfiler {
+  public:
+  StartupProfiler();
+
+  bool enabled() const { return !m_fileName.empty(); }
+
+  //! Ends the current phase and starts the phase name.
+  void startPhase(std::string const& name);
+
+  //! Records the allocated bytes of a memory entry; the breakdown is reported per entry.
+  void addMemory(std::string const& name, std::size_t bytes);
+
+  //! Ends the current phase, gathers the profiles of all ranks and writes the report on rank 0; collective.
+  void finish();
+
+  //! Resident memory high-water mark of this process in bytes
+  static std::size_t memoryHighWaterMark();
+
+  /**
+   * The imbalance of a phase is the maximum wall time over the mean wall time minus one.
+   *
+   * @param profiles Profiles of all ranks
+   **/
+  static std::string formatJson(std::vector<std::string> const& phases,
+                                std::vector<std::string> const& memoryEntries,
+                                std::vector<StartupProfile> const& profiles);
+
+  private:
+  void endPhase();
+
+  std::string m_fileName;
+  std::vector<std::string> m_phases;
+  std::vector<std::string> m_memoryEntries;
+  StartupProfile m_profile;
+  //! Index of the current phase; -1 if no phase is running
+  int m_currentPhase = -1;
+  Stopwatch m_watch;
+};
+} // namespace seissol
+
+#endif // SEISSOL_MONITORING_STARTUPPROFILER_H
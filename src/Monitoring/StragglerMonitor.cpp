@@ -0,0 +1,63 @@
+#include "StragglerMonitor.h"
+
+#include <limits>
+#include <unistd.h>
+
+#include "Parallel/MPI.h"
+#include <utils/env.h>
+#include <utils/logger.h>
+
+seissol::StragglerMonitor::StragglerMonitor()
+    : StragglerMonitor(utils::Env::get<unsigned>("SEISSOL_STRAGGLER_INTERVAL", 0),
+                       utils::Env::get<double>("SEISSOL_STRAGGLER_THRESHOLD", 0.25)) {}
+
+seissol::StragglerMonitor::StragglerMonitor(unsigned interval, double threshold)
+    : m_interval(interval), m_threshold(threshold) {}
+
+bool seissol::StragglerMonitor::check(double computeTime, double cellUpdates) {
+  if (!enabled() || ++m_calls % m_interval != 0) {
+    return false;
+  }
+
+  const double elapsedTime = computeTime - m_computeTime;
+  const double elapsedUpdates = cellUpdates - m_cellUpdates;
+  m_computeTime = computeTime;
+  m_cellUpdates = cellUpdates;
+  // Ranks without updates (e.g. all cells in a slow cluster which did not advance) do not take part
+  const bool active = elapsedUpdates > 0.0;
+  m_timePerCellUpdate = active ? elapsedTime / elapsedUpdates : 0.0;
+
+  constexpr double Lowest = std::numeric_limits<double>::lowest();
+  double extrema[2] = {active ? m_timePerCellUpdate : Lowest, active ? -m_timePerCellUpdate : Lowest};
+  double sums[2] = {m_timePerCellUpdate, active ? 1.0 : 0.0};
+#ifdef USE_MPI
+  MPI_Allreduce(MPI_IN_PLACE, extrema, 2, MPI_DOUBLE, MPI_MAX, seissol::MPI::mpi.comm());
+  MPI_Allreduce(MPI_IN_PLACE, sums, 2, MPI_DOUBLE, MPI_SUM, seissol::MPI::mpi.comm());
+#endif // USE_MPI
+  if (sums[1] == 0.0) {
+    return false;
+  }
+  const double max = extrema[0];
+  const double min = -extrema[1];
+  const double mean = sums[0] / sums[1];
+
+  const int rank = seissol::MPI::mpi.rank();
+  if (isStraggler(max, mean, m_threshold)) {
+    logInfo(rank) << "Slow ranks detected: time per cell update min =" << min << "mean =" << mean
+                  << "max =" << max;
+  }
+  if (!active || !isStraggler(m_timePerCellUpdate, mean, m_threshold)) {
+    return false;
+  }
+
+  constexpr size_t HostNameMaxLength = 100;
+  char hostname[HostNameMaxLength + 1] = {};
+  if (gethostname(hostname, HostNameMaxLength + 1) != 0) {
+    hostname[0] = '\0';
+  }
+  hostname[HostNameMaxLength] = '\0';
+  logWarning() << "Rank" << rank << "on" << hostname << "is slow: time per cell update"
+               << m_timePerCellUpdate << "exceeds the mean" << mean << "by"
+               << 100.0 * (m_timePerCellUpdate / mean - 1.0) << "%";
+  return true;
+}
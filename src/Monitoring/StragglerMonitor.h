@@ -0,0 +1,47 @@
+#ifndef SEISSOL_MONITORING_STRAGGLERMONITOR_H
+#define SEISSOL_MONITORING_STRAGGLERMONITOR_H
+
+namespace seissol {
+
+/**
+ * Detects slow ranks (e.g. nodes with degraded memory or thermal throttling) during the time loop.
+ *
+ * With SEISSOL_STRAGGLER_INTERVAL=N, the ranks compare their compute time per cell update since the last comparison
+ * at every N-th synchronization point (two small allreduces for the minimum, maximum and mean).
+ * A rank whose time per cell update exceeds the mean by more than SEISSOL_STRAGGLER_THRESHOLD (default 0.25,
+ * i.e. 25%) logs a warning with its host name, such that the node can be excluded from the next job.
+ **/
+class StragglerMonitor {
+  public:
+  StragglerMonitor();
+  StragglerMonitor(unsigned interval, double threshold);
+
+  bool enabled() const { return m_interval > 0; }
+
+  /**
+   * Called at every synchronization point; compares the ranks at every interval-th call. Collective.
+   *
+   * @param computeTime compute time of the rank since the start of the time loop
+   * @param cellUpdates cell updates of the rank since the start of the time loop
+   * @return true if the ranks were compared and this rank is a straggler
+   **/
+  bool check(double computeTime, double cellUpdates);
+
+  //! Compute time per cell update of this rank in the last comparison
+  double timePerCellUpdate() const { return m_timePerCellUpdate; }
+
+  static bool isStraggler(double timePerCellUpdate, double meanTimePerCellUpdate, double threshold) {
+    return meanTimePerCellUpdate > 0.0 && timePerCellUpdate > (1.0 + threshold) * meanTimePerCellUpdate;
+  }
+
+  private:
+  unsigned m_interval = 0;
+  double m_threshold = 0.25;
+  unsigned m_calls = 0;
+  double m_computeTime = 0.0;
+  double m_cellUpdates = 0.0;
+  double m_timePerCellUpdate = 0.0;
+};
+} // namespace seissol
+
+#endif // SEISSOL_MONITORING_STRAGGLERMONITOR_H
@@ -0,0 +1,168 @@
+#include "Telemetry.h"
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#include "Monitoring/Stopwatch.h"
+#include "Parallel/MPI.h"
+#include "Parallel/Pin.h"
+#include <utils/env.h>
+#include <utils/logger.h>
+
+namespace {
+class MetricWriter {
+  public:
+  MetricWriter(std::ostringstream& stream, int rank) : m_stream(stream), m_rank(std::to_string(rank)) {}
+
+  void family(const char* name, const char* type, const char* unit, const char* help) {
+    m_stream << "# TYPE " << name << ' ' << type << '\n';
+    if (unit[0] != '\0') {
+      m_stream << "# UNIT " << name << ' ' << unit << '\n';
+    }
+    m_stream << "# HELP " << name << ' ' << help << '\n';
+  }
+
+  //! Counters get the suffix _total
+  void value(const char* name, bool counter, double value, const std::string& labels = "") {
+    m_stream << name << (counter ? "_total" : "") << "{rank=\"" << m_rank << '"' << labels << "} " << value << '\n';
+  }
+
+  private:
+  std::ostringstream& m_stream;
+  std::string m_rank;
+};
+
+double rate(double current, double previous, double time) { return time > 0.0 ? (current - previous) / time : 0.0; }
+} // namespace
+
+seissol::Telemetry::Telemetry() {
+  m_prefix = utils::Env::get<std::string>("SEISSOL_TELEMETRY_PREFIX", "");
+  m_interval = utils::Env::get<double>("SEISSOL_TELEMETRY_INTERVAL", 10.0);
+}
+
+seissol::Telemetry::~Telemetry() { stop(); }
+
+void seissol::Telemetry::start(const parallel::Pinning& pinning) {
+  if (!enabled() || m_running) {
+    return;
+  }
+  clock_gettime(CLOCK_MONOTONIC, &m_published);
+  logInfo(seissol::MPI::mpi.rank()) << "Writing telemetry to" << m_prefix + ".<rank>.prom every" << m_interval
+                                    << "seconds.";
+
+  m_running = true;
+  m_stop = false;
+  const auto freeCpus = pinning.getFreeCPUsMask();
+  m_thread = std::thread([this, freeCpus]() {
+    if (!parallel::Pinning::freeCPUsMaskEmpty(freeCpus)) {
+      parallel::Pinning::pinToCPUs(freeCpus);
+    }
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_stop) {
+      m_condition.wait_for(lock, std::chrono::duration<double>(m_interval));
+      // Do not block the solver while writing
+      const TelemetrySample sample = m_sample;
+      const TelemetrySample previous = m_previous;
+      const timespec published = m_published;
+      lock.unlock();
+      write(sample, previous, published);
+      lock.lock();
+    }
+  });
+}
+
+void seissol::Telemetry::publish(const TelemetrySample& sample) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_previous = std::move(m_sample);
+  m_sample = sample;
+  clock_gettime(CLOCK_MONOTONIC, &m_published);
+}
+
+void seissol::Telemetry::stop() {
+  if (!m_running) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stop = true;
+  }
+  m_condition.notify_one();
+  m_thread.join();
+  m_running = false;
+}
+
+void seissol::Telemetry::write(const TelemetrySample& sample,
+                               const TelemetrySample& previous,
+                               const timespec& published) const {
+  timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  const double age = seconds(difftime(published, now));
+
+  const int rank = seissol::MPI::mpi.rank();
+  const std::string fileName = m_prefix + "." + std::to_string(rank) + ".prom";
+  const std::string temporaryFile = fileName + ".tmp";
+  {
+    std::ofstream file(temporaryFile);
+    file << format(sample, previous, age, rank);
+    if (!file) {
+      logWarning(rank) << "Could not write the telemetry to" << temporaryFile;
+      return;
+    }
+  }
+  // Readers never see an incomplete file
+  std::rename(temporaryFile.c_str(), fileName.c_str());
+}
+
+std::string seissol::Telemetry::format(const TelemetrySample& sample,
+                                       const TelemetrySample& previous,
+                                       double age,
+                                       int rank) {
+  std::ostringstream stream;
+  stream.precision(10);
+  MetricWriter writer(stream, rank);
+  const double interval = sample.wallTime - previous.wallTime;
+
+  writer.family("seissol_simulation_time_seconds", "gauge", "seconds",
+                "Simulated time at the last synchronization point.");
+  writer.value("seissol_simulation_time_seconds", false, sample.simulationTime);
+  writer.family("seissol_wall_time_seconds", "gauge", "seconds",
+                "Wall time of the time stepping at the last synchronization point.");
+  writer.value("seissol_wall_time_seconds", false, sample.wallTime);
+  writer.family("seissol_sample_age_seconds", "gauge", "seconds", "Wall time since the last synchronization point.");
+  writer.value("seissol_sample_age_seconds", false, age);
+
+  writer.family("seissol_region_time_seconds", "counter", "seconds",
+                "Time spent in a loop statistics region per time cluster.");
+  for (unsigned region = 0; region < sample.regions.size(); ++region) {
+    for (unsigned cluster = 0; cluster < sample.timePerCluster[region].size(); ++cluster) {
+      writer.value("seissol_region_time_seconds",
+                   true,
+                   sample.timePerCluster[region][cluster],
+                   ",region=\"" + sample.regions[region] + "\",cluster=\"" + std::to_string(cluster) + '"');
+    }
+  }
+
+  writer.family("seissol_cell_updates", "counter", "", "Number of element updates.");
+  writer.value("seissol_cell_updates", true, sample.cellUpdates);
+  writer.family("seissol_cell_updates_per_second", "gauge", "",
+                "Element updates per second since the previous synchronization point.");
+  writer.value("seissol_cell_updates_per_second", false, rate(sample.cellUpdates, previous.cellUpdates, interval));
+  writer.family("seissol_hardware_flops", "counter", "", "Calculated hardware floating point operations.");
+  writer.value("seissol_hardware_flops", true, sample.hardwareFlops);
+  writer.family("seissol_gflops", "gauge", "", "Hardware GFLOPS since the previous synchronization point.");
+  writer.value("seissol_gflops", false, 1.e-9 * rate(sample.hardwareFlops, previous.hardwareFlops, interval));
+
+  writer.family("seissol_communication_seconds", "counter", "seconds", "Time in which MPI requests were in flight.");
+  writer.value("seissol_communication_seconds", true, sample.communicationTime);
+  writer.family("seissol_exposed_communication_seconds", "counter", "seconds",
+                "Time in which MPI requests were in flight and no cluster computed.");
+  writer.value("seissol_exposed_communication_seconds", true, sample.exposedCommunicationTime);
+  writer.family("seissol_output_seconds", "counter", "seconds",
+                "Time the solver spent in outputs and checkpoints (grows if asynchronous outputs fall behind).");
+  writer.value("seissol_output_seconds", true, sample.outputTime);
+
+  stream << "# EOF\n";
+  return stream.str();
+}
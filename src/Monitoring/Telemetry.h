@@ -0,0 +1,83 @@
+#ifndef SEISSOL_MONITORING_TELEMETRY_H
+#define SEISSOL_MONITORING_TELEMETRY_H
+
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <time.h>
+#include <vector>
+
+namespace seissol {
+namespace parallel {
+class Pinning;
+} // namespace parallel
+
+//! Performance counters of a rank at a synchronization point; all times are accumulated since the start.
+struct TelemetrySample {
+  double simulationTime = 0.0;
+  //! Wall time since the start of the time stepping
+  double wallTime = 0.0;
+  std::vector<std::string> regions;
+  //! Time of each loop statistics region (summed over the threads) per global time cluster
+  std::vector<std::vector<double>> timePerCluster;
+  double cellUpdates = 0.0;
+  double hardwareFlops = 0.0;
+  //! Time in which MPI requests of the ghost clusters were in flight
+  double communicationTime = 0.0;
+  //! Part of the communication time which was not covered by computations
+  double exposedCommunicationTime = 0.0;
+  //! Time the solver spent in the outputs and checkpoints (grows if asynchronous outputs fall behind)
+  double outputTime = 0.0;
+};
+
+/**
+ * Live performance metrics: with SEISSOL_TELEMETRY_PREFIX, a thread on the free CPUs writes the
+ * last published sample of each rank every SEISSOL_TELEMETRY_INTERVAL seconds to
+ * <prefix>.<rank>.prom in the OpenMetrics text format (e.g. for the textfile collector of the
+ * Prometheus node exporter).
+ *
+ * The samples are published by the solver at the synchronization points; the age of the last
+ * sample reveals a stalled run between them.
+ **/
+class Telemetry {
+  public:
+  Telemetry();
+  ~Telemetry();
+
+  bool enabled() const { return !m_prefix.empty(); }
+
+  void start(const parallel::Pinning& pinning);
+
+  void publish(const TelemetrySample& sample);
+
+  //! Writes the last sample and stops the thread
+  void stop();
+
+  /**
+   * Formats a sample in the OpenMetrics text format.
+   *
+   * @param previous The sample before (used for the rates)
+   * @param age Seconds since the sample was published
+   **/
+  static std::string format(const TelemetrySample& sample, const TelemetrySample& previous, double age, int rank);
+
+  private:
+  void write(const TelemetrySample& sample, const TelemetrySample& previous, const timespec& published) const;
+
+  std::string m_prefix;
+  double m_interval = 10.0;
+
+  TelemetrySample m_sample;
+  TelemetrySample m_previous;
+  timespec m_published{};
+
+  bool m_running = false;
+  bool m_stop = false;
+  std::mutex m_mutex;
+  std::condition_variable m_condition;
+  std::thread m_thread;
+};
+} // namespace seissol
+
+#endif // SEISSOL_MONITORING_TELEMETRY_H
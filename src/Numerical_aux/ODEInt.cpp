@@ -1,6 +1,7 @@
 #include "ODEInt.h"
 #include <algorithm>
 #include <cassert>
+#include <stdexcept>
 
 namespace seissol::ode {
 
@@ -11,7 +12,8 @@ int getNumberOfStages(RungeKuttaVariant variant) {
       {RungeKuttaVariant::RK4_3_8,       4},
       {RungeKuttaVariant::RK6_Butcher_1, 7},
       {RungeKuttaVariant::RK6_Butcher_2, 7},
-      {RungeKuttaVariant::RK7_VernerMostEfficient, 9}
+      {RungeKuttaVariant::RK7_VernerMostEfficient, 9},
+      {RungeKuttaVariant::RK5_DormandPrince, 7}
   };
   return variantToNumberOfStages[variant];
 }
@@ -227,6 +229,64 @@ void initializeRungeKuttaScheme(RungeKuttaVariant variant,
       c(7) = 0.925;
       c(8) = 1.0;
       break;
+    case RungeKuttaVariant::RK5_DormandPrince:
+      // J.R. Dormand and P.J. Prince, 1980, with embedded 4th order solution
+      // (see initializeEmbeddedWeights). The last stage is evaluated at the new solution (FSAL).
+      a(1, 0) = 1.0 / 5.0;
+      a(2, 0) = 3.0 / 40.0;
+      a(2, 1) = 9.0 / 40.0;
+      a(3, 0) = 44.0 / 45.0;
+      a(3, 1) = -56.0 / 15.0;
+      a(3, 2) = 32.0 / 9.0;
+      a(4, 0) = 19372.0 / 6561.0;
+      a(4, 1) = -25360.0 / 2187.0;
+      a(4, 2) = 64448.0 / 6561.0;
+      a(4, 3) = -212.0 / 729.0;
+      a(5, 0) = 9017.0 / 3168.0;
+      a(5, 1) = -355.0 / 33.0;
+      a(5, 2) = 46732.0 / 5247.0;
+      a(5, 3) = 49.0 / 176.0;
+      a(5, 4) = -5103.0 / 18656.0;
+      a(6, 0) = 35.0 / 384.0;
+      a(6, 1) = 0.0;
+      a(6, 2) = 500.0 / 1113.0;
+      a(6, 3) = 125.0 / 192.0;
+      a(6, 4) = -2187.0 / 6784.0;
+      a(6, 5) = 11.0 / 84.0;
+
+      b(0) = 35.0 / 384.0;
+      b(1) = 0.0;
+      b(2) = 500.0 / 1113.0;
+      b(3) = 125.0 / 192.0;
+      b(4) = -2187.0 / 6784.0;
+      b(5) = 11.0 / 84.0;
+      b(6) = 0.0;
+
+      c(0) = 0.0;
+      c(1) = 1.0 / 5.0;
+      c(2) = 3.0 / 10.0;
+      c(3) = 4.0 / 5.0;
+      c(4) = 8.0 / 9.0;
+      c(5) = 1.0;
+      c(6) = 1.0;
+      break;
+  }
+}
+
+bool initializeEmbeddedWeights(RungeKuttaVariant variant, Eigen::VectorXd& bEmbedded) {
+  bEmbedded = Eigen::VectorXd::Zero(getNumberOfStages(variant));
+  switch (variant) {
+    case RungeKuttaVariant::RK5_DormandPrince:
+      bEmbedded(0) = 5179.0 / 57600.0;
+      bEmbedded(1) = 0.0;
+      bEmbedded(2) = 7571.0 / 16695.0;
+      bEmbedded(3) = 393.0 / 640.0;
+      bEmbedded(4) = -92097.0 / 339200.0;
+      bEmbedded(5) = 187.0 / 2100.0;
+      bEmbedded(6) = 1.0 / 40.0;
+      return true;
+    default:
+      return false;
   }
 }
 
@@ -234,9 +294,13 @@ RungeKuttaODESolver::RungeKuttaODESolver(const std::vector<std::size_t>& storage
                                                        ODESolverConfig config)
     : config(config) {
   initializeRungeKuttaScheme(config.solver, numberOfStages, a, b, c);
+  const bool hasEmbeddedWeights = initializeEmbeddedWeights(config.solver, bEmbedded);
+  if (config.adaptive && !hasEmbeddedWeights) {
+    throw std::invalid_argument("The Runge-Kutta variant has no error estimate for adaptive time steps.");
+  }
   // Initialize storages for stages
   stages.reserve(numberOfStages);
-  storages.reserve((numberOfStages + 1) * storageSizes.size()); // +1 due to buffer
+  storages.reserve((numberOfStages + 2) * storageSizes.size()); // +2 due to buffer and error estimate
   auto curStoragePtrs = std::vector<real*>(storageSizes.size());
   for (auto i = 0; i < numberOfStages; ++i) {
     curStoragePtrs.clear();
@@ -252,10 +316,20 @@ RungeKuttaODESolver::RungeKuttaODESolver(const std::vector<std::size_t>& storage
     curStoragePtrs.push_back(storages.emplace_back(std::vector<real>(storageSize)).data());
   }
   buffer.updateStoragesAndSizes(curStoragePtrs, storageSizes);
+
+  // Initialize error estimate
+  curStoragePtrs.clear();
+  for (unsigned long storageSize : storageSizes) {
+    curStoragePtrs.push_back(storages.emplace_back(std::vector<real>(storageSize)).data());
+  }
+  errorEstimate.updateStoragesAndSizes(curStoragePtrs, storageSizes);
 }
 
 
 void RungeKuttaODESolver::setConfig(ODESolverConfig newConfig) {
+  if (newConfig.adaptive && bEmbedded.isZero()) {
+    throw std::invalid_argument("The Runge-Kutta variant has no error estimate for adaptive time steps.");
+  }
   config = newConfig;
 }
 
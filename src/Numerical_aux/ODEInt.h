@@ -1,6 +1,10 @@
 #ifndef SEISSOL_ODEINT_H
 #define SEISSOL_ODEINT_H
 
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
 #include "Eigen/Dense"
 
 #include "ODEVector.h"
@@ -19,12 +23,17 @@ enum class RungeKuttaVariant {
   RK4_Ralston,
   RK6_Butcher_1,
   RK6_Butcher_2,
-  RK7_VernerMostEfficient
+  RK7_VernerMostEfficient,
+  RK5_DormandPrince
 };
 
 struct ODESolverConfig {
   RungeKuttaVariant solver = RungeKuttaVariant::RK7_VernerMostEfficient;
   double initialDt;
+  //! Adapts the time step to the embedded error estimate, requires e.g. RK5_DormandPrince
+  bool adaptive = false;
+  double absoluteTolerance = 1e-10;
+  double relativeTolerance = 1e-8;
 
   ODESolverConfig() = delete;
 
@@ -39,6 +48,12 @@ void initializeRungeKuttaScheme(RungeKuttaVariant variant,
                                 Eigen::VectorXd& b,
                                 Eigen::VectorXd& c);
 
+/*!
+ * Sets the weights of the embedded lower order solution in bEmbedded.
+ * @return false if the variant has no embedded solution, i.e. does not support adaptive time steps
+ */
+bool initializeEmbeddedWeights(RungeKuttaVariant variant, Eigen::VectorXd& bEmbedded);
+
 class RungeKuttaODESolver {
 private:
   ODESolverConfig config;
@@ -48,11 +63,30 @@ private:
   Eigen::MatrixXd a;
   Eigen::VectorXd b;
   Eigen::VectorXd c;
+  Eigen::VectorXd bEmbedded;
 
   // Temporary storage
   std::vector<ODEVector> stages;
   std::vector<std::vector<real>> storages{};
   ODEVector buffer;
+  ODEVector errorEstimate;
+
+  template<typename Func>
+  void computeStages(Func& f, ODEVector& curValue, double curTime, double dt) {
+    for (auto i = 0U; i < stages.size(); ++i) {
+      buffer = curValue;
+      // j < i due to explict RK scheme
+      for (auto j = 0U; j < i; ++j) {
+        if (a(i,j) != 0.0) {
+          const auto curWeight = a(i, j) * dt;
+          buffer.weightedAddInplace(curWeight, stages[j]);
+        }
+      }
+
+      const double tEval = curTime + c[i] * dt;
+      f(stages[i], buffer, tEval);
+    }
+  }
 
 public:
   RungeKuttaODESolver(const std::vector<std::size_t>& storageSizes,
@@ -77,19 +111,30 @@ public:
     double dt = config.initialDt;
     while (curTime < timeSpan.end) {
       const double adjustedDt = std::min(dt, timeSpan.end - curTime);
-
-      for (auto i = 0U; i < stages.size(); ++i) {
-        buffer = curValue;
-        // j < i due to explict RK scheme
-        for (auto j = 0U; j < i; ++j) {
-          if (a(i,j) != 0.0) {
-            const auto curWeight = a(i, j) * adjustedDt;
-            buffer.weightedAddInplace(curWeight, stages[j]);
+      computeStages(f, curValue, curTime, adjustedDt);
+
+      if (config.adaptive) {
+        // The difference of both solutions estimates the local error of the embedded one.
+        // Independent systems (e.g. one per face) stored in one ODEVector share the step size,
+        // which is hence controlled by their worst component.
+        errorEstimate *= 0.0;
+        for (auto i = 0; i < numberOfStages; ++i) {
+          const auto curWeight = (b[i] - bEmbedded[i]) * adjustedDt;
+          if (curWeight != 0.0) {
+            errorEstimate.weightedAddInplace(curWeight, stages[i]);
           }
         }
-
-        const double tEval = curTime + c[i] * adjustedDt;
-        f(stages[i], buffer, tEval);
+        const double errorNorm = errorEstimate.scaledMaxNorm(
+            curValue, config.absoluteTolerance, config.relativeTolerance);
+        // Standard step size controller with safety factor 0.9 for a 4th order error estimate
+        const double factor = errorNorm > 0.0 ? 0.9 * std::pow(errorNorm, -1.0 / 5.0) : 5.0;
+        dt = adjustedDt * std::clamp(factor, 0.2, 5.0);
+        if (curTime + dt == curTime) {
+          throw std::runtime_error("The adaptive ODE solver can not reach the requested tolerance.");
+        }
+        if (errorNorm > 1.0) {
+          continue;
+        }
       }
 
       for (auto i = 0; i < numberOfStages; ++i) {
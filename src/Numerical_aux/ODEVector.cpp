@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <iostream>
@@ -125,6 +126,19 @@ real ODEVector::l2Norm() {
   return std::sqrt(norm);
 }
 
+real ODEVector::scaledMaxNorm(const ODEVector& reference, real absoluteTolerance, real relativeTolerance) const {
+  real norm = 0.0;
+  for (std::size_t i = 0; i < storages.size(); ++i) {
+    assert(sizes[i] == reference.sizes[i]);
+#pragma omp simd reduction(max:norm)
+    for (std::size_t j = 0; j < sizes[i]; ++j) {
+      const real scale = absoluteTolerance + relativeTolerance * std::abs(reference.storages[i][j]);
+      norm = std::max(norm, std::abs(storages[i][j]) / scale);
+    }
+  }
+  return norm;
+}
+
 void ODEVector::print() {
   const auto delim = "----------- print() -----------";
   for (std::size_t i = 0; i < storages.size(); ++i) {
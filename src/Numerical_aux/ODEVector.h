@@ -100,6 +100,12 @@ public:
    */
   real l2Norm();
 
+  /**
+   * @return max_i |this_i| / (absoluteTolerance + relativeTolerance * |reference_i|), i.e. the norm
+   * of an error estimate which step size controllers compare to 1
+   */
+  real scaledMaxNorm(const ODEVector& reference, real absoluteTolerance, real relativeTolerance) const;
+
   /**
    * Prints out entries of this. For debugging.
    */
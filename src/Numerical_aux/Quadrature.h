@@ -209,6 +209,46 @@ namespace seissol {
 	logError() << "Sum of tetrahedron quadrature weights are " << sumWeights << " /= " << 1./6.;
       }
     }
+
+    template<typename float_t, unsigned N>
+    struct TriangleQuadratureRule {
+      static constexpr unsigned NumberOfPoints = N*N;
+      float_t points[NumberOfPoints][2];
+      float_t weights[NumberOfPoints];
+    };
+
+    template<unsigned N>
+    struct TetrahedronQuadratureRule {
+      static constexpr unsigned NumberOfPoints = N*N*N;
+      double points[NumberOfPoints][3];
+      double weights[NumberOfPoints];
+    };
+
+    /** Returns the rule of TriangleQuadrature for polynomial degree N.
+     *  It is computed once per process and shared by all callers, e.g. for quadratures in every time step.
+     */
+    template<typename float_t, unsigned N>
+    inline TriangleQuadratureRule<float_t, N> const& triangleQuadratureRule()
+    {
+      static const auto rule = [] {
+        TriangleQuadratureRule<float_t, N> rule{};
+        TriangleQuadrature(rule.points, rule.weights, N);
+        return rule;
+      }();
+      return rule;
+    }
+
+    /** Returns the rule of TetrahedronQuadrature for polynomial degree N, see triangleQuadratureRule. */
+    template<unsigned N>
+    inline TetrahedronQuadratureRule<N> const& tetrahedronQuadratureRule()
+    {
+      static const auto rule = [] {
+        TetrahedronQuadratureRule<N> rule{};
+        TetrahedronQuadrature(rule.points, rule.weights, N);
+        return rule;
+      }();
+      return rule;
+    }
   }
 }
 
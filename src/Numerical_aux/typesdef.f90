@@ -169,8 +169,6 @@ MODULE TypesDef
 !     REAL                         , POINTER :: ncVrtx(:,:,:)                    !<Vertices of mirrored element
 !<     INTEGER                      , POINTER :: nSide(:)                         !< Number of Sides per Element
 !<     INTEGER                      , POINTER :: nEdge(:)                         !< Number of Edges per Element
-     INTEGER                      , POINTER :: LocalNeighborSide(:,:)           !<Which are the local sides of the neighbor connected to the local sides of the element ?
-     INTEGER                      , POINTER :: LocalNeighborVrtx(:,:)           !<Local neighbor side vertex number at local side vertex 1 for each element and each side
 !<     INTEGER                      , POINTER :: VertexNeighbor(:,:)              !< Connection index to element's vertex neighbors
 !<     INTEGER                      , POINTER :: NrOfVertexNeighbors(:)           !< Number of vertex neighbors for all elements
 !<     INTEGER                      , POINTER :: FluxSign(:,:)                    !< Obsolete, sign contained in UpdateCoeff
@@ -182,7 +180,6 @@ MODULE TypesDef
      INTEGER                      , POINTER :: MPI_NCNumber(:,:)                !<Index into MPI communication structure for non-conforming elements
      INTEGER                      , POINTER :: BoundaryToObject(:,:)            !<Mapping from element and side index to boundary object nr
      INTEGER                      , POINTER :: NC_BoundaryToObject(:,:)         !<Mapping from element, side and Gausspoint index to boundary object nr
-     INTEGER                      , POINTER :: MPINumber_DR(:,:)                  !<Index into MPI communication structure for dynamic rupture
      END TYPE tElement
 
   !< Dynamic rupture mesh-based information on the fault
@@ -209,14 +206,12 @@ MODULE TypesDef
      REAL                         , POINTER :: temp_xyzNode(:,:)                !<temporary storage of nodes
      REAL                         , POINTER :: mdca(:)                          !<median dual cell area around a node (RD-Schemes)
      REAL                         , POINTER :: inwNormals(:,:,:,:)              !<side scaled inward normal of the opposite side of a node
-     INTEGER                      , POINTER :: Element(:,:)                     !<Connection index to elements containing a node
      INTEGER                      , POINTER :: NrOfEdgesConnected(:)            !<Number of edges connected to each node
      INTEGER                      , POINTER :: AddressOfEdgesConnected(:)       !<Address of first connected edge index in AddressOfElementsConnected
      INTEGER                      , POINTER :: IndexOfEdgesConnected(:)         !<List runs from 1 to AddressOfEdgesConnected(MESH%nElementsToNodes)
      INTEGER                      , POINTER :: NrOfSidesConnected(:)            !<Number of sides on each node
      INTEGER                      , POINTER :: AddressOfSidesConnected(:)       !<Address of first connected side index in AddressOfElementsConnected
      INTEGER                      , POINTER :: IndexOfSidesConnected(:)         !<List runs from 1 to AddressOfSidesConnected(MESH%nElementsToNodes)
-     INTEGER                      , POINTER :: NrOfElementsConnected(:)         !<Number of elements on each node
      INTEGER                      , POINTER :: AddressOfElementsConnected(:)    !<Address of first connected element index in AddressOfElementsConnected
      INTEGER                      , POINTER :: IndexOfElementsConnected(:)      !<List runs from 1 to AddressOfElementsConnected(MESH%nElementsToNodes)
      INTEGER                      , POINTER :: Reference(:)                     !<Reference code for boundary conditions
@@ -306,6 +301,13 @@ MODULE TypesDef
       INTEGER                    :: vertexWeightElement ! Base parmetis vertex weight for each element
       INTEGER                    :: vertexWeightDynamicRupture ! Additional parmetis vertex weight for each dynamic rupture face
       INTEGER                    :: vertexWeightFreeSurfaceWithGravity ! Additional parmetis vertex weight for each displacement face
+      INTEGER                    :: edgeWeightDynamicRupture ! Parmetis edge weight of dynamic rupture faces (other faces: 1)
+      INTEGER                    :: communicationEdgeWeights ! Parmetis edge weights by the LTS communication volume (0/1)
+      ! For meshgenerator = 'CubeGenerator'
+      INTEGER                    :: cubeSize(3)                              ! Number of cubes in x, y and z direction
+      INTEGER                    :: cubePartitions(3)                        ! Partitions in x, y and z direction (0 = automatic)
+      REAL                       :: cubeScale                                ! Size of the domain [-cubeScale/2, cubeScale/2]^3
+      INTEGER                    :: cubeBoundary                             ! Boundary condition of the surface of the domain
   END TYPE tUnstructMesh
 
   TYPE tDGSponge
@@ -624,15 +626,16 @@ MODULE TypesDef
 
   TYPE tDynRup
      character(LEN=600)                     :: ModelFileName
-     real, allocatable                      :: output_Mu(:,:)
-     real, allocatable                      :: output_StateVar(:,:)
-     real, allocatable                      :: output_Strength(:,:)
-     real, allocatable                      :: output_Slip(:,:)
-     real, allocatable                      :: output_Slip1(:,:)
-     real, allocatable                      :: output_Slip2(:,:)
-     real, allocatable                      :: output_rupture_time(:,:)
-     real, allocatable                      :: output_PeakSR(:,:)
-     real, allocatable                      :: output_dynStress_time(:,:)
+     ! Snapshot of the fault state for the fault output; points to the fault state itself if the C++ friction solvers are used
+     real, pointer                          :: output_Mu(:,:) => NULL()
+     real, pointer                          :: output_StateVar(:,:) => NULL()
+     real, pointer                          :: output_Strength(:,:) => NULL()
+     real, pointer                          :: output_Slip(:,:) => NULL()
+     real, pointer                          :: output_Slip1(:,:) => NULL()
+     real, pointer                          :: output_Slip2(:,:) => NULL()
+     real, pointer                          :: output_rupture_time(:,:) => NULL()
+     real, pointer                          :: output_PeakSR(:,:) => NULL()
+     real, pointer                          :: output_dynStress_time(:,:) => NULL()
      REAL, allocatable                      :: Slip(:,:)               !< Slip path at given fault node
      REAL, allocatable                      :: Slip1(:,:)                      !< Slip at given fault node along loc dir 1
      REAL, allocatable                      :: Slip2(:,:)                      !< Slip at given fault node along loc dir 2
@@ -1074,6 +1077,7 @@ MODULE TypesDef
      CHARACTER(LEN=20)                      :: meshgenerator                    !< ='emc2_am_fmt' or 'emc2_ftq'
                                                                                 !<  or 'triangle'
      CHARACTER(LEN=200)                     :: RFileName                        !< Receiver file name
+     CHARACTER(LEN=600)                     :: OutputRegionsFile                !< Additional wave field output regions
      REAL,POINTER                           :: MaterialVal(:,:)                 !< Read in lines of (x,y,z,rho,mu,lamda) of material property structured grid
      CHARACTER(LEN=35)                      :: DATAFile                         !< Cfd Solver interface filename,
      CHARACTER(LEN=35)                      :: ObsFile                          !< File where the observations are found for adjoint inversions
@@ -1222,6 +1226,9 @@ MODULE TypesDef
      TYPE(tInflow)                , POINTER :: ObjInflow(:)                     !< Data objects for inflow
      TYPE(tOutflow)               , POINTER :: ObjOutflow(:)                    !< Data objects for outflow
      TYPE(tMPIBoundary)           , POINTER :: ObjMPI(:)                        !< Data objects for MPI boundary
+     REAL                                   :: AbsorbingLayerWidth              !< Thickness of the absorbing layer (0: none)
+     REAL                                   :: AbsorbingLayerReflection         !< Reflection coefficient of the absorbing layer
+     REAL                                   :: AbsorbingLayerInterior(6)        !< Region (xmin,xmax,ymin,ymax,zmin,zmax) enclosed by the layer
      !<                                                                          !<
      !<                                                                          !<
      INTEGER, POINTER                       :: VirtualToCouple(:,:)             !< Index into the coupling structured, based on virtual element numbers
@@ -0,0 +1,87 @@
+#include "HostArch.h"
+
+#include <Parallel/MPI.h>
+#include <utils/logger.h>
+
+namespace {
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define SEISSOL_HAS_CPU_DETECTION
+// ordered by the width of the vector ISA
+int vectorLevel(std::string const& arch) {
+  if (arch == "wsm") {
+    return 1;
+  }
+  if (arch == "snb") {
+    return 2;
+  }
+  if (arch == "hsw" || arch == "rome") {
+    return 3;
+  }
+  if (arch == "knl" || arch == "skx") {
+    return 4;
+  }
+  return 0;
+}
+
+bool supports(std::string const& arch) {
+  __builtin_cpu_init();
+  if (arch == "wsm") {
+    return __builtin_cpu_supports("sse3");
+  }
+  if (arch == "snb") {
+    return __builtin_cpu_supports("avx");
+  }
+  if (arch == "hsw" || arch == "rome") {
+    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+  }
+  if (arch == "knl") {
+    return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512er");
+  }
+  if (arch == "skx") {
+    return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") &&
+           __builtin_cpu_supports("avx512vl") && __builtin_cpu_supports("avx512dq");
+  }
+  return arch == "noarch";
+}
+#endif
+} // namespace
+
+std::string seissol::parallel::compiledHostArch() {
+  return SEISSOL_HOST_ARCH;
+}
+
+std::string seissol::parallel::detectedHostArch() {
+#ifdef SEISSOL_HAS_CPU_DETECTION
+  for (char const* arch : {"skx", "knl", "hsw", "snb", "wsm"}) {
+    if (supports(arch)) {
+      // Zen 2/3 run the Haswell kernels, but have their own compiler tuning
+      if (std::string(arch) == "hsw" && __builtin_cpu_is("amd")) {
+        return "rome";
+      }
+      return arch;
+    }
+  }
+  return "noarch";
+#else
+  return "";
+#endif
+}
+
+void seissol::parallel::checkHostArch() {
+  const int rank = seissol::MPI::mpi.rank();
+  const std::string compiled = compiledHostArch();
+  const std::string detected = detectedHostArch();
+  logInfo(rank) << "Kernels compiled for HOST_ARCH" << compiled << "; best HOST_ARCH of this CPU:"
+                << (detected.empty() ? std::string("unknown") : detected);
+
+#ifdef SEISSOL_HAS_CPU_DETECTION
+  if (vectorLevel(compiled) > 0 && !supports(compiled)) {
+    logError() << "This CPU does not support the instructions of HOST_ARCH" << compiled
+               << "the kernels were compiled for. Use a build with HOST_ARCH" << detected << "on this node.";
+  }
+  if (vectorLevel(detected) > vectorLevel(compiled)) {
+    logWarning(rank) << "This CPU supports a wider vector ISA than the build uses; a build with HOST_ARCH" << detected
+                     << "is likely faster on this node.";
+  }
+#endif
+}
@@ -0,0 +1,21 @@
+#ifndef SEISSOL_PARALLEL_HOSTARCH_H
+#define SEISSOL_PARALLEL_HOSTARCH_H
+
+#include <string>
+
+namespace seissol::parallel {
+//! HOST_ARCH the kernels were generated and compiled for.
+std::string compiledHostArch();
+
+//! Widest HOST_ARCH (x86 vector ISA) the CPU of this process supports, or an empty string if unknown.
+std::string detectedHostArch();
+
+/**
+ * Compares the ISA of the build with the CPU on every rank.
+ * Fails if the CPU lacks instructions the kernels were compiled for (instead of a SIGILL later on),
+ * and warns if the CPU supports a wider vector ISA than the build uses.
+ **/
+void checkHostArch();
+} // namespace seissol::parallel
+
+#endif // SEISSOL_PARALLEL_HOSTARCH_H
@@ -52,10 +52,14 @@
 #include "MPIBasic.h"
 
 #ifdef ACL_DEVICE
+#include <algorithm>
 #include <cstdlib>
 #include <string>
 #include <sstream>
+#include <vector>
 #include <device.h>
+#include <Kernels/DeviceAux/PeerAux.h>
+#include "utils/env.h"
 #endif  // ACL_DEVICE
 
 #endif // USE_MPI
@@ -81,6 +85,7 @@ private:
     int m_localRank{};
     int m_localSize{};
     int m_deviceId{};
+    std::vector<int> m_deviceIds;
 #endif // ACL_DEVICE
 
 private:
@@ -147,6 +152,10 @@ public:
      * GPU/CPU affinity. Note, one can improve the current binding strategy using hwloc.
      * See, Professional CUDA programming, subsection Affinity on MPI-CUDA Programs as a reference.
      *
+     * With SEISSOL_DEVICES_PER_RANK=n, a rank drives n devices, i.e. localRank=2 uses the deviceIds 2n, ..., 3n-1.
+     * The first one is the primary device of the rank; the time clusters are distributed among all of them,
+     * see TimeManager::assignDevices.
+     *
      * The function supports the following MPI implementations: OpenMPI, MVAPICH2, IntelMPI
      * */
     void  bindRankToDevice() {
@@ -171,13 +180,29 @@ public:
 
       device::DeviceInstance& device = device::DeviceInstance::getInstance();
       int m_numDevices = device.api->getNumDevices();
-      if (m_localSize > m_numDevices) {
-        logError() << "Local mpi size (in a compute node) is greater than the number of avaliable devices."
+      const int devicesPerRank = std::max(1, utils::Env::get<int>("SEISSOL_DEVICES_PER_RANK", 1));
+      if (m_localSize * devicesPerRank > m_numDevices) {
+        logError() << "Local mpi size (in a compute node) times the devices per rank is greater than the number of avaliable devices."
                    << "Over-subscription of devices is currently not supported in Seissol."
-                   << "Adjust num. local mpi rank and num. local devices.\n"
+                   << "Adjust num. local mpi rank, SEISSOL_DEVICES_PER_RANK and num. local devices.\n"
                    << "File: " << __FILE__ << ", line: " << __LINE__;
       }
-      m_deviceId = m_localRank;
+      m_deviceIds.clear();
+      for (int i = 0; i < devicesPerRank; ++i) {
+        m_deviceIds.push_back(m_localRank * devicesPerRank + i);
+      }
+      m_deviceId = m_deviceIds.front();
+
+      // the kernels of a cluster read the batch tables and the halo of the other devices directly
+      for (int deviceId : m_deviceIds) {
+        for (int peerDeviceId : m_deviceIds) {
+          if (deviceId != peerDeviceId &&
+              !seissol::kernels::device::aux::peer::enablePeerAccess(deviceId, peerDeviceId)) {
+            logError() << "Device" << deviceId << "can not access device" << peerDeviceId << "directly."
+                       << "SEISSOL_DEVICES_PER_RANK requires peer access (e.g. NVLink or xGMI) between the devices of a rank.";
+          }
+        }
+      }
 
 #ifdef _OPENMP
 #pragma omp parallel
@@ -192,6 +217,8 @@ public:
 #endif
     }
     int getDeviceID() { return m_deviceId; }
+    //! Devices of this rank; the first one is the primary device (getDeviceID)
+    const std::vector<int>& getDeviceIDs() { return m_deviceIds; }
 #endif // ACL_DEVICE
 
 	/**
@@ -0,0 +1,55 @@
+#include "NodeSharedMemory.h"
+
+#ifdef USE_MPI
+void seissol::parallel::NodeSharedMemory::initialize(MPI_Comm comm) {
+  int rank;
+  MPI_Comm_rank(comm, &rank);
+  MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &m_nodeComm);
+  MPI_Comm_rank(m_nodeComm, &m_nodeRank);
+  MPI_Comm_size(m_nodeComm, &m_nodeSize);
+}
+
+void* seissol::parallel::NodeSharedMemory::allocate(std::size_t size, std::size_t alignment) {
+  // only the writer contributes memory; the window is not aligned beyond the page size
+  const std::size_t segmentSize = isWriter() ? size + alignment : 0;
+  char* base = nullptr;
+  MPI_Win window;
+  MPI_Win_allocate_shared(static_cast<MPI_Aint>(segmentSize), 1, MPI_INFO_NULL, m_nodeComm, &base, &window);
+
+  MPI_Aint writerSize;
+  int dispUnit;
+  MPI_Win_shared_query(window, 0, &writerSize, &dispUnit, &base);
+
+  // The window stays locked (passively) until it is freed.
+  MPI_Win_lock_all(MPI_MODE_NOCHECK, window);
+  m_windows.push_back(window);
+
+  return alignAddress(base, alignment);
+}
+
+void seissol::parallel::NodeSharedMemory::synchronize() {
+  for (MPI_Win window : m_windows) {
+    MPI_Win_sync(window);
+  }
+  MPI_Barrier(m_nodeComm);
+  for (MPI_Win window : m_windows) {
+    MPI_Win_sync(window);
+  }
+}
+
+void seissol::parallel::NodeSharedMemory::free() {
+  int isFinalized = 0;
+  MPI_Finalized(&isFinalized);
+  if (isFinalized) {
+    return;
+  }
+  for (MPI_Win& window : m_windows) {
+    MPI_Win_unlock_all(window);
+    MPI_Win_free(&window);
+  }
+  m_windows.clear();
+  if (m_nodeComm != MPI_COMM_NULL) {
+    MPI_Comm_free(&m_nodeComm);
+  }
+}
+#endif
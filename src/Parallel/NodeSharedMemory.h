@@ -0,0 +1,66 @@
+#ifndef SEISSOL_PARALLEL_NODESHAREDMEMORY_H
+#define SEISSOL_PARALLEL_NODESHAREDMEMORY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#ifdef USE_MPI
+#include <mpi.h>
+#endif
+
+namespace seissol::parallel {
+
+//! Rounds the address up to a multiple of alignment (a power of two)
+inline void* alignAddress(void* address, std::size_t alignment) {
+  const auto value = reinterpret_cast<std::uintptr_t>(address);
+  return reinterpret_cast<void*>((value + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1));
+}
+
+#ifdef USE_MPI
+/**
+ * Read-only data which is stored once per node in MPI-3 shared memory windows
+ * (SEISSOL_SHARED_GLOBAL_DATA=1), e.g. the global matrices.
+ *
+ * The first rank of the node (the writer) owns the memory of all windows and initializes it;
+ * the other ranks only attach to it. After synchronize, all ranks of the node may read the data.
+ **/
+class NodeSharedMemory {
+  public:
+  NodeSharedMemory() = default;
+  NodeSharedMemory(const NodeSharedMemory&) = delete;
+  NodeSharedMemory& operator=(const NodeSharedMemory&) = delete;
+
+  //! Groups the ranks of comm by node; collective over comm.
+  void initialize(MPI_Comm comm);
+
+  [[nodiscard]] bool isInitialized() const { return m_nodeComm != MPI_COMM_NULL; }
+
+  //! True on the rank which writes the shared data
+  [[nodiscard]] bool isWriter() const { return m_nodeRank == 0; }
+
+  //! Number of ranks which share the data
+  [[nodiscard]] int numberOfRanks() const { return m_nodeSize; }
+
+  /**
+   * Allocates size bytes with the given alignment, which are shared by all ranks of the node;
+   * collective over the ranks of the node.
+   **/
+  void* allocate(std::size_t size, std::size_t alignment);
+
+  //! Makes the data written by the writer visible to all ranks of the node; collective over the ranks of the node.
+  void synchronize();
+
+  //! Frees all windows (if MPI is not finalized yet); collective over the ranks of the node.
+  void free();
+
+  private:
+  MPI_Comm m_nodeComm = MPI_COMM_NULL;
+  int m_nodeRank = 0;
+  int m_nodeSize = 1;
+  std::vector<MPI_Win> m_windows;
+};
+#endif
+} // namespace seissol::parallel
+
+#endif // SEISSOL_PARALLEL_NODESHAREDMEMORY_H
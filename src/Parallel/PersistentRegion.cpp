@@ -0,0 +1,89 @@
+#include "PersistentRegion.h"
+
+#include <thread>
+
+#include <utils/env.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+bool seissol::parallel::PersistentRegion::enabled() {
+#ifdef _OPENMP
+  static const bool persistent = utils::Env::get<bool>("SEISSOL_PERSISTENT_REGION", false);
+  return persistent;
+#else
+  return false;
+#endif
+}
+
+void seissol::parallel::PersistentRegion::runImpl(Schedule schedule, void* context) {
+#ifdef _OPENMP
+  const unsigned start = generation.load(std::memory_order_acquire);
+#pragma omp parallel default(shared)
+  {
+#pragma omp single
+    {
+      threads = omp_get_num_threads();
+      stop = false;
+    }
+    const int thread = omp_get_thread_num();
+    if (thread == 0) {
+      active = true;
+      schedule(context);
+      active = false;
+      stop = true;
+      generation.fetch_add(1, std::memory_order_release);
+    } else {
+      wait(thread, start);
+    }
+  }
+  threads = 1;
+#else
+  active = true;
+  schedule(context);
+  active = false;
+#endif
+}
+
+void seissol::parallel::PersistentRegion::wait(int thread, unsigned generationSeen) {
+  while (true) {
+    unsigned current = generation.load(std::memory_order_acquire);
+    for (unsigned spin = 0; current == generationSeen; ++spin) {
+      if (spin >= 1024) {
+        std::this_thread::yield();
+        spin = 0;
+      }
+      current = generation.load(std::memory_order_acquire);
+    }
+    generationSeen = current;
+    if (stop) {
+      return;
+    }
+    executeRange(thread);
+    finished.fetch_add(1, std::memory_order_release);
+  }
+}
+
+void seissol::parallel::PersistentRegion::executeRange(int thread) {
+  const auto begin = static_cast<unsigned>(static_cast<unsigned long>(workCells) * thread / threads);
+  const auto end = static_cast<unsigned>(static_cast<unsigned long>(workCells) * (thread + 1) / threads);
+  if (begin < end) {
+    workBody(workContext, begin, end, thread);
+  }
+}
+
+void seissol::parallel::PersistentRegion::execute(unsigned numberOfCells, RangeBody body, void* context) {
+  workCells = numberOfCells;
+  workBody = body;
+  workContext = context;
+  if (threads == 1) {
+    executeRange(0);
+    return;
+  }
+  finished.store(0, std::memory_order_relaxed);
+  generation.fetch_add(1, std::memory_order_release);
+  executeRange(0);
+  while (finished.load(std::memory_order_acquire) != threads - 1) {
+  }
+}
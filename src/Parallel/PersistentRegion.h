@@ -0,0 +1,77 @@
+#ifndef SEISSOL_PARALLEL_PERSISTENTREGION_H
+#define SEISSOL_PARALLEL_PERSISTENTREGION_H
+
+#include <atomic>
+#include <type_traits>
+
+namespace seissol::parallel {
+
+/**
+ * One OpenMP parallel region for a whole advanceInTime (SEISSOL_PERSISTENT_REGION=1), instead of the
+ * fork and join of a parallel region in every cell loop.
+ *
+ * The first thread executes the scheduling of the time clusters, while the other threads wait for cell
+ * loops. A cell loop is split into one static range per thread (the same ranges as a static schedule),
+ * the threads are released and joined with atomic counters.
+ **/
+class PersistentRegion {
+  public:
+  //! True if the clusters advance in a persistent parallel region
+  static bool enabled();
+
+  //! True on the scheduling thread while run() executes
+  static bool isActive() { return active; }
+
+  /**
+   * Calls schedule() on the first thread of a new parallel region; the other threads execute the cell
+   * loops started from it, until schedule() returns.
+   **/
+  template <typename F>
+  static void run(F&& schedule) {
+    runImpl(&invoke<std::remove_reference_t<F>>, &schedule);
+  }
+
+  //! Calls body(begin, end, thread) for the static range of every thread of the region
+  template <typename F>
+  static void forEachRange(unsigned numberOfCells, F&& body) {
+    execute(numberOfCells, &invokeRange<std::remove_reference_t<F>>, &body);
+  }
+
+  //! Number of threads of the region
+  static int numberOfThreads() { return threads; }
+
+  private:
+  using Schedule = void (*)(void*);
+  using RangeBody = void (*)(void*, unsigned, unsigned, int);
+
+  template <typename F>
+  static void invoke(void* schedule) {
+    (*static_cast<F*>(schedule))();
+  }
+
+  template <typename F>
+  static void invokeRange(void* body, unsigned begin, unsigned end, int thread) {
+    (*static_cast<F*>(body))(begin, end, thread);
+  }
+
+  static void runImpl(Schedule schedule, void* context);
+
+  static void execute(unsigned numberOfCells, RangeBody body, void* context);
+
+  static void executeRange(int thread);
+
+  static void wait(int thread, unsigned generation);
+
+  static inline thread_local bool active = false;
+  static inline int threads = 1;
+  static inline std::atomic<unsigned> generation{0};
+  static inline std::atomic<int> finished{0};
+  static inline bool stop = false;
+  static inline unsigned workCells = 0;
+  static inline RangeBody workBody = nullptr;
+  static inline void* workContext = nullptr;
+};
+
+} // namespace seissol::parallel
+
+#endif // SEISSOL_PARALLEL_PERSISTENTREGION_H
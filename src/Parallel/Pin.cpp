@@ -42,12 +42,27 @@
 
 #include <sys/sysinfo.h>
 #include <sched.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstdint>
 #include <sstream>
 #include <set>
 #include "Parallel/MPI.h"
 
+#include <utils/env.h>
+#include <utils/stringutils.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#ifdef USE_HWLOC
+#include <hwloc.h>
+#endif
+
 #ifdef USE_NUMA_AWARE_PINNING
 #include "numa.h"
+#include "numaif.h"
 #endif
 
 seissol::parallel::Pinning::Pinning() {
@@ -121,8 +136,71 @@ bool seissol::parallel::Pinning::freeCPUsMaskEmpty(cpu_set_t const& set) {
 }
 
 void seissol::parallel::Pinning::pinToFreeCPUs() const {
-  auto freeMask = getFreeCPUsMask();
-  sched_setaffinity(0, sizeof(cpu_set_t), &freeMask);
+  pinToCPUs(getFreeCPUsMask());
+}
+
+cpu_set_t seissol::parallel::Pinning::restrictToNumaNode(cpu_set_t const& set, int numaNode) {
+#ifdef USE_NUMA_AWARE_PINNING
+  if (numaNode >= 0) {
+    cpu_set_t restricted;
+    CPU_ZERO(&restricted);
+    for (int cpu = 0; cpu < get_nprocs(); ++cpu) {
+      if (CPU_ISSET(cpu, &set) && numa_node_of_cpu(cpu) == numaNode) {
+        CPU_SET(cpu, &restricted);
+      }
+    }
+    if (!freeCPUsMaskEmpty(restricted)) {
+      return restricted;
+    }
+  }
+#endif
+  return set;
+}
+
+int seissol::parallel::Pinning::numaNodeOfAddress(const void* address) {
+#ifdef USE_NUMA_AWARE_PINNING
+  int numaNode = -1;
+  if (address != nullptr &&
+      get_mempolicy(&numaNode, nullptr, 0, const_cast<void*>(address), MPOL_F_NODE | MPOL_F_ADDR) == 0) {
+    return numaNode;
+  }
+#endif
+  return -1;
+}
+
+bool seissol::parallel::Pinning::useNumaAwareMemory() {
+  static const bool numaAwareMemory = utils::Env::get<int>("SEISSOL_NUMA_AWARE_MEMORY", 0) != 0;
+  return numaAwareMemory;
+}
+
+void seissol::parallel::Pinning::bindToLocalNumaNode(const void* begin, const void* end) {
+#ifdef USE_NUMA_AWARE_PINNING
+  const int cpu = sched_getcpu();
+  const int numaNode = (cpu >= 0) ? numa_node_of_cpu(cpu) : -1;
+  if (numaNode < 0) {
+    return;
+  }
+
+  // Pages at the boundaries are shared with the neighbouring threads and are left where they are
+  const auto pageSize = static_cast<std::uintptr_t>(sysconf(_SC_PAGESIZE));
+  const auto first = (reinterpret_cast<std::uintptr_t>(begin) + pageSize - 1) / pageSize * pageSize;
+  const auto last = reinterpret_cast<std::uintptr_t>(end) / pageSize * pageSize;
+  if (first >= last) {
+    return;
+  }
+
+  unsigned long nodeMask[(sizeof(unsigned long) * 8 + 1023) / (sizeof(unsigned long) * 8)] = {};
+  if (static_cast<std::size_t>(numaNode) >= sizeof(nodeMask) * 8) {
+    return;
+  }
+  nodeMask[numaNode / (sizeof(unsigned long) * 8)] |= 1UL << (numaNode % (sizeof(unsigned long) * 8));
+  // Failures (e.g. pages which are shared with another process) only cost performance
+  mbind(reinterpret_cast<void*>(first), last - first, MPOL_PREFERRED, nodeMask, sizeof(nodeMask) * 8, MPOL_MF_MOVE);
+#endif
+}
+
+void seissol::parallel::Pinning::pinToCPUs(cpu_set_t const& set) {
+  sched_setaffinity(0, sizeof(cpu_set_t), &set);
 }
 
 std::string seissol::parallel::Pinning::maskToString(cpu_set_t const& set) {
@@ -164,3 +242,172 @@ cpu_set_t seissol::parallel::Pinning::getNodeMask() const {
 
   return nodeMask;
 }
+
+seissol::parallel::Placement seissol::parallel::Pinning::computePlacement(std::vector<std::vector<int>> const& cores,
+                                                                          unsigned localRank,
+                                                                          unsigned numberOfLocalRanks,
+                                                                          unsigned numberOfThreads,
+                                                                          unsigned reservedCores) {
+  Placement placement;
+  placement.workers.resize(numberOfThreads);
+  if (cores.empty() || numberOfThreads == 0) {
+    return placement;
+  }
+
+  const auto numberOfRanks = std::max(1U, numberOfLocalRanks);
+  auto first = localRank * cores.size() / numberOfRanks;
+  auto last = (localRank + 1) * cores.size() / numberOfRanks;
+  if (first == last) {
+    // More ranks than cores
+    first = localRank % cores.size();
+    last = first + 1;
+  }
+  const auto blockSize = last - first;
+
+  const auto numberOfReserved = std::min<std::size_t>(reservedCores, blockSize - 1);
+  auto isReserved = std::vector<char>(blockSize, 0);
+  for (std::size_t i = 0; i < numberOfReserved; ++i) {
+    isReserved[(i + 1) * blockSize / numberOfReserved - 1] = 1;
+  }
+
+  std::vector<std::vector<int>> computeCores;
+  for (std::size_t core = 0; core < blockSize; ++core) {
+    if (isReserved[core] != 0) {
+      placement.free.insert(placement.free.end(), cores[first + core].begin(), cores[first + core].end());
+    } else {
+      computeCores.push_back(cores[first + core]);
+    }
+  }
+
+  if (numberOfThreads <= computeCores.size()) {
+    for (unsigned thread = 0; thread < numberOfThreads; ++thread) {
+      placement.workers[thread] = computeCores[thread * computeCores.size() / numberOfThreads];
+    }
+  } else {
+    std::vector<int> pus;
+    for (auto const& core : computeCores) {
+      pus.insert(pus.end(), core.begin(), core.end());
+    }
+    for (unsigned thread = 0; thread < numberOfThreads; ++thread) {
+      const auto pu = numberOfThreads <= pus.size() ? thread * pus.size() / numberOfThreads : thread % pus.size();
+      placement.workers[thread] = {pus[pu]};
+    }
+  }
+  return placement;
+}
+
+void seissol::parallel::Pinning::pinWorkers() {
+  const auto mode = utils::StringUtils::toLower(utils::Env::get<std::string>("SEISSOL_PINNING", "runtime"));
+  if (mode != "auto") {
+    return;
+  }
+  const int rank = MPI::mpi.rank();
+#ifdef USE_HWLOC
+  const auto nodeMask = getNodeMask();
+
+  MPI_Comm commNode;
+  MPI_Comm_split_type(MPI::mpi.comm(), MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL, &commNode);
+  int localRank = 0;
+  int localSize = 1;
+  MPI_Comm_rank(commNode, &localRank);
+  MPI_Comm_size(commNode, &localSize);
+  MPI_Comm_free(&commNode);
+
+  // The cores in topological order (packages, NUMA nodes, caches), restricted to the CPUs of the workers on the node
+  hwloc_topology_t topology;
+  hwloc_topology_init(&topology);
+  hwloc_topology_load(topology);
+  std::vector<std::vector<int>> cores;
+  const int numberOfCores = hwloc_get_nbobjs_by_type(topology, HWLOC_OBJ_CORE);
+  for (int i = 0; i < numberOfCores; ++i) {
+    const hwloc_obj_t core = hwloc_get_obj_by_type(topology, HWLOC_OBJ_CORE, i);
+    std::vector<int> pus;
+    unsigned pu;
+    hwloc_bitmap_foreach_begin(pu, core->cpuset) {
+      if (pu < CPU_SETSIZE && CPU_ISSET(pu, &nodeMask)) {
+        pus.push_back(static_cast<int>(pu));
+      }
+    }
+    hwloc_bitmap_foreach_end();
+    if (!pus.empty()) {
+      cores.push_back(std::move(pus));
+    }
+  }
+  hwloc_topology_destroy(topology);
+
+  // One core per communication thread and one for the asynchronous I/O thread, unless specified otherwise
+  unsigned defaultReserved = 0;
+#ifdef USE_COMM_THREAD
+  defaultReserved += std::max(1U, utils::Env::get<unsigned>("SEISSOL_COMMTHREADS", 1));
+#endif
+  if (utils::StringUtils::toLower(utils::Env::get<std::string>("ASYNC_MODE", "sync")) == "thread") {
+    ++defaultReserved;
+  }
+  const auto reservedCores = utils::Env::get<unsigned>("SEISSOL_PINNING_FREE_CORES", defaultReserved);
+
+#ifdef _OPENMP
+  const unsigned numberOfThreads = omp_get_max_threads();
+#else
+  const unsigned numberOfThreads = 1;
+#endif
+  if (cores.empty()) {
+    logWarning(rank) << "hwloc found no cores in the affinity masks of the OpenMP workers; the pinning is left to the OpenMP runtime.";
+    return;
+  }
+  const auto placement = computePlacement(cores, localRank, localSize, numberOfThreads, reservedCores);
+
+#ifdef _OPENMP
+#pragma omp parallel default(none) shared(placement)
+  {
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    for (const int cpu : placement.workers[omp_get_thread_num()]) {
+      CPU_SET(cpu, &mask);
+    }
+    pinToCPUs(mask);
+  }
+#else
+  cpu_set_t mask;
+  CPU_ZERO(&mask);
+  for (const int cpu : placement.workers[0]) {
+    CPU_SET(cpu, &mask);
+  }
+  pinToCPUs(mask);
+#endif
+  openmpMask = getWorkerUnionMask();
+
+  logInfo(rank) << "Pinned the OpenMP workers with hwloc:" << cores.size() << "cores on the node," << localSize
+                << "ranks," << placement.free.size() << "free CPUs per rank (SEISSOL_PINNING_FREE_CORES=" << reservedCores << ")";
+#else
+  logWarning(rank) << "SEISSOL_PINNING=auto requires hwloc (-DHWLOC=ON); the pinning is left to the OpenMP runtime.";
+#endif
+}
+
+void seissol::parallel::Pinning::checkWorkerPlacement() const {
+#ifdef _OPENMP
+  auto counts = std::vector<int>(get_nprocs(), 0);
+#pragma omp parallel default(none) shared(counts)
+  {
+    cpu_set_t worker;
+    CPU_ZERO(&worker);
+    sched_getaffinity(0, sizeof(cpu_set_t), &worker);
+#pragma omp critical
+    {
+      for (int cpu = 0; cpu < static_cast<int>(counts.size()); ++cpu) {
+        counts[cpu] += CPU_ISSET(cpu, &worker) ? 1 : 0;
+      }
+    }
+  }
+
+  MPI_Comm commNode;
+  MPI_Comm_split_type(MPI::mpi.comm(), MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL, &commNode);
+  MPI_Allreduce(MPI_IN_PLACE, counts.data(), counts.size(), MPI_INT, MPI_SUM, commNode);
+  MPI_Comm_free(&commNode);
+
+  const auto sharedCpus = std::count_if(counts.begin(), counts.end(), [](int count) { return count > 1; });
+  if (sharedCpus > 0) {
+    logWarning(MPI::mpi.rank()) << "OpenMP workers of this node share" << sharedCpus << "CPUs (or are not pinned);"
+                                << "check OMP_PLACES and OMP_PROC_BIND, or use SEISSOL_PINNING=auto.";
+  }
+#endif
+}
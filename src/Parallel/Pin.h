@@ -41,10 +41,18 @@
 #ifndef PARALLEL_PIN_H_
 #define PARALLEL_PIN_H_
 
+#include <sched.h>
 #include <string>
+#include <vector>
 
 namespace seissol {
   namespace parallel {
+//! CPUs of the OpenMP workers of a rank and the CPUs which are left for the communication and I/O threads
+struct Placement {
+  std::vector<std::vector<int>> workers;
+  std::vector<int> free;
+};
+
 class Pinning {
 private:
   cpu_set_t openmpMask{};
@@ -55,8 +63,40 @@ public:
   cpu_set_t getFreeCPUsMask() const;
   static bool freeCPUsMaskEmpty(cpu_set_t const& set);
   void pinToFreeCPUs() const;
+  //! Restricts the set to the CPUs of the NUMA node; returns the set unchanged if that leaves no CPU.
+  static cpu_set_t restrictToNumaNode(cpu_set_t const& set, int numaNode);
+  //! Returns the NUMA node of the page containing the address, or -1 if unknown.
+  static int numaNodeOfAddress(const void* address);
+  static void pinToCPUs(cpu_set_t const& set);
+  //! Returns true if the memory of the LTS trees is bound to the NUMA node of the computing threads (SEISSOL_NUMA_AWARE_MEMORY=1).
+  static bool useNumaAwareMemory();
+  /**
+   * Moves the pages which lie entirely in [begin, end) to the NUMA node of the calling thread
+   * and prefers this node for pages which are not yet allocated. Does nothing without libnuma.
+   **/
+  static void bindToLocalNumaNode(const void* begin, const void* end);
   static std::string maskToString(cpu_set_t const& set);
   cpu_set_t getNodeMask() const;
+
+  /**
+   * With SEISSOL_PINNING=auto, pins the OpenMP workers with hwloc (see computePlacement).
+   * The cores are those in the affinity masks of the workers of all ranks on the node.
+   * Has to be called after the initialization of MPI and before other threads are started.
+   **/
+  void pinWorkers();
+  //! Warns if OpenMP workers of the node share a CPU.
+  void checkWorkerPlacement() const;
+  /**
+   * Distributes the cores (in topological order, each given by its PUs) in contiguous blocks over the ranks
+   * on the node. In each block, reservedCores cores (spread evenly over the block, the last one at its end)
+   * are left free. The workers get a whole core each if there are enough cores, otherwise consecutive workers
+   * share the PUs (SMT siblings) of a core.
+   **/
+  static Placement computePlacement(std::vector<std::vector<int>> const& cores,
+                                    unsigned localRank,
+                                    unsigned numberOfLocalRanks,
+                                    unsigned numberOfThreads,
+                                    unsigned reservedCores);
 };
 
 }
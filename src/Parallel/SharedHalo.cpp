@@ -0,0 +1,154 @@
+#include "SharedHalo.h"
+
+#ifdef USE_MPI
+#include <new>
+
+#include <utils/logger.h>
+
+namespace {
+constexpr std::size_t CacheLine = 64;
+
+std::size_t roundUp(std::size_t size) { return (size + CacheLine - 1) / CacheLine * CacheLine; }
+
+//! Entry of the slot table at the start of the segment of each rank
+struct SlotEntry {
+  int destination;
+  int tag;
+  std::uint64_t size;
+  std::uint64_t offset;
+};
+
+struct SlotTable {
+  alignas(CacheLine) std::uint64_t numberOfEntries;
+
+  SlotEntry* entries() { return reinterpret_cast<SlotEntry*>(this + 1); }
+};
+} // namespace
+
+void seissol::parallel::SharedHaloWindow::allocate(MeshStructure* meshStructures,
+                                                   unsigned numberOfClusters,
+                                                   MPI_Comm comm,
+                                                   int tag) {
+  int rank;
+  MPI_Comm_rank(comm, &rank);
+  MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &m_nodeComm);
+
+  // rank of the neighbor of each region on the node (MPI_UNDEFINED if it is on another node)
+  MPI_Group group;
+  MPI_Group nodeGroup;
+  MPI_Comm_group(comm, &group);
+  MPI_Comm_group(m_nodeComm, &nodeGroup);
+  std::vector<std::vector<int>> nodeRanks(numberOfClusters);
+  for (unsigned tc = 0; tc < numberOfClusters; ++tc) {
+    const MeshStructure& meshStructure = meshStructures[tc];
+    std::vector<int> neighbors(meshStructure.numberOfRegions);
+    for (unsigned region = 0; region < meshStructure.numberOfRegions; ++region) {
+      neighbors[region] = meshStructure.neighboringClusters[region][0];
+    }
+    nodeRanks[tc].resize(neighbors.size());
+    MPI_Group_translate_ranks(group, static_cast<int>(neighbors.size()), neighbors.data(), nodeGroup, nodeRanks[tc].data());
+  }
+  MPI_Group_free(&group);
+  MPI_Group_free(&nodeGroup);
+
+  // layout of the segment: slot table, followed by the slots
+  std::size_t numberOfEntries = 0;
+  for (unsigned tc = 0; tc < numberOfClusters; ++tc) {
+    for (const int nodeRank : nodeRanks[tc]) {
+      numberOfEntries += nodeRank != MPI_UNDEFINED ? 1 : 0;
+    }
+  }
+  std::size_t segmentSize = roundUp(sizeof(SlotTable) + numberOfEntries * sizeof(SlotEntry));
+  std::vector<std::vector<std::size_t>> offsets(numberOfClusters);
+  for (unsigned tc = 0; tc < numberOfClusters; ++tc) {
+    const MeshStructure& meshStructure = meshStructures[tc];
+    offsets[tc].assign(meshStructure.numberOfRegions, 0);
+    for (unsigned region = 0; region < meshStructure.numberOfRegions; ++region) {
+      if (nodeRanks[tc][region] != MPI_UNDEFINED) {
+        offsets[tc][region] = segmentSize;
+        segmentSize += sizeof(SharedHaloSlot) + roundUp(meshStructure.copyRegionSizes[region] * sizeof(real));
+      }
+    }
+  }
+
+  MPI_Info info;
+  MPI_Info_create(&info);
+  MPI_Info_set(info, "alloc_shared_noncontig", "true");
+  char* base = nullptr;
+  MPI_Win_allocate_shared(static_cast<MPI_Aint>(segmentSize), 1, info, m_nodeComm, &base, &m_window);
+  MPI_Info_free(&info);
+
+  auto* table = new (base) SlotTable;
+  table->numberOfEntries = 0;
+  m_copySlots.assign(numberOfClusters, {});
+  m_ghostSlots.assign(numberOfClusters, {});
+  m_numberOfSharedRegions = 0;
+  for (unsigned tc = 0; tc < numberOfClusters; ++tc) {
+    MeshStructure& meshStructure = meshStructures[tc];
+    m_copySlots[tc].assign(meshStructure.numberOfRegions, nullptr);
+    for (unsigned region = 0; region < meshStructure.numberOfRegions; ++region) {
+      if (nodeRanks[tc][region] == MPI_UNDEFINED) {
+        continue;
+      }
+      m_copySlots[tc][region] = new (base + offsets[tc][region]) SharedHaloSlot;
+      table->entries()[table->numberOfEntries++] = {meshStructure.neighboringClusters[region][0],
+                                                    tag + meshStructure.sendIdentifiers[region],
+                                                    meshStructure.copyRegionSizes[region],
+                                                    offsets[tc][region]};
+      ++m_numberOfSharedRegions;
+    }
+    meshStructure.sharedCopySlots = m_copySlots[tc].data();
+  }
+
+  // The window stays locked (passively) until it is freed; the tables are complete after the barrier.
+  MPI_Win_lock_all(MPI_MODE_NOCHECK, m_window);
+  MPI_Win_sync(m_window);
+  MPI_Barrier(m_nodeComm);
+  MPI_Win_sync(m_window);
+
+  for (unsigned tc = 0; tc < numberOfClusters; ++tc) {
+    MeshStructure& meshStructure = meshStructures[tc];
+    m_ghostSlots[tc].assign(meshStructure.numberOfRegions, nullptr);
+    for (unsigned region = 0; region < meshStructure.numberOfRegions; ++region) {
+      if (nodeRanks[tc][region] == MPI_UNDEFINED) {
+        continue;
+      }
+      MPI_Aint size;
+      int dispUnit;
+      char* neighborBase = nullptr;
+      MPI_Win_shared_query(m_window, nodeRanks[tc][region], &size, &dispUnit, &neighborBase);
+      auto* neighborTable = reinterpret_cast<SlotTable*>(neighborBase);
+      const int receiveTag = tag + meshStructure.receiveIdentifiers[region];
+      for (std::uint64_t entry = 0; entry < neighborTable->numberOfEntries; ++entry) {
+        const SlotEntry& slotEntry = neighborTable->entries()[entry];
+        if (slotEntry.destination == rank && slotEntry.tag == receiveTag) {
+          if (slotEntry.size != meshStructure.ghostRegionSizes[region]) {
+            logError() << "The size of the shared copy region" << slotEntry.size << "of rank"
+                       << meshStructure.neighboringClusters[region][0] << "does not match the ghost region size"
+                       << meshStructure.ghostRegionSizes[region];
+          }
+          m_ghostSlots[tc][region] = reinterpret_cast<SharedHaloSlot*>(neighborBase + slotEntry.offset);
+        }
+      }
+      if (m_ghostSlots[tc][region] == nullptr) {
+        logError() << "Rank" << meshStructure.neighboringClusters[region][0]
+                   << "does not share a copy region with tag" << receiveTag;
+      }
+    }
+    meshStructure.sharedGhostSlots = m_ghostSlots[tc].data();
+  }
+}
+
+void seissol::parallel::SharedHaloWindow::free() {
+  if (m_window != MPI_WIN_NULL) {
+    MPI_Win_unlock_all(m_window);
+    MPI_Win_free(&m_window);
+  }
+  if (m_nodeComm != MPI_COMM_NULL) {
+    MPI_Comm_free(&m_nodeComm);
+  }
+  m_copySlots.clear();
+  m_ghostSlots.clear();
+  m_numberOfSharedRegions = 0;
+}
+#endif
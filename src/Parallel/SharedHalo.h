@@ -0,0 +1,91 @@
+#ifndef SEISSOL_PARALLEL_SHAREDHALO_H
+#define SEISSOL_PARALLEL_SHAREDHALO_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Initializer/typedefs.hpp"
+
+#ifdef USE_MPI
+#include <mpi.h>
+#endif
+
+namespace seissol::parallel {
+
+/**
+ * Slot of a copy region in the shared memory window; the data of the region follows the slot.
+ *
+ * The sender publishes its n-th message once the receiver consumed the (n-1)-th one,
+ * i.e. a slot holds at most one message which has not been received yet.
+ **/
+struct SharedHaloSlot {
+  alignas(64) std::atomic<std::uint64_t> published{0};
+  alignas(64) std::atomic<std::uint64_t> consumed{0};
+
+  real* data() { return reinterpret_cast<real*>(this + 1); }
+};
+static_assert(sizeof(SharedHaloSlot) == 128, "The data of a slot has to be aligned to a cache line.");
+
+//! Copies the copy region to the slot as message; false if the receiver did not consume the previous message yet.
+inline bool tryPublish(SharedHaloSlot& slot, std::uint64_t message, const real* copyRegion, std::size_t size) {
+  if (slot.consumed.load(std::memory_order_acquire) + 1 < message) {
+    return false;
+  }
+  std::copy_n(copyRegion, size, slot.data());
+  slot.published.store(message, std::memory_order_release);
+  return true;
+}
+
+//! Copies the message from the slot to the ghost region; false if it was not published yet.
+inline bool tryConsume(SharedHaloSlot& slot, std::uint64_t message, real* ghostRegion, std::size_t size) {
+  if (slot.published.load(std::memory_order_acquire) < message) {
+    return false;
+  }
+  std::copy_n(slot.data(), size, ghostRegion);
+  slot.consumed.store(message, std::memory_order_release);
+  return true;
+}
+
+#ifdef USE_MPI
+/**
+ * MPI-3 shared memory window, through which the copy and ghost regions are exchanged
+ * with the ranks on the same node (SEISSOL_MPI_SHARED_MEMORY=1).
+ *
+ * Each rank allocates one slot per copy region whose neighbor is on the same node and
+ * publishes a table of its slots (destination rank, message tag) at the start of its segment.
+ * The receivers look up the slots of their ghost regions in the tables of their neighbors.
+ **/
+class SharedHaloWindow {
+  public:
+  SharedHaloWindow() = default;
+  SharedHaloWindow(const SharedHaloWindow&) = delete;
+  SharedHaloWindow& operator=(const SharedHaloWindow&) = delete;
+
+  /**
+   * Sets sharedCopySlots and sharedGhostSlots of the mesh structures; collective over comm.
+   *
+   * @param tag Offset of the message identifiers (the tag of the MPI messages).
+   **/
+  void allocate(MeshStructure* meshStructures, unsigned numberOfClusters, MPI_Comm comm, int tag);
+
+  //! Frees the window; collective over the ranks of the node.
+  void free();
+
+  //! Number of regions of this rank, which are exchanged through the window
+  [[nodiscard]] unsigned numberOfSharedRegions() const { return m_numberOfSharedRegions; }
+
+  private:
+  MPI_Comm m_nodeComm = MPI_COMM_NULL;
+  MPI_Win m_window = MPI_WIN_NULL;
+  unsigned m_numberOfSharedRegions = 0;
+  //! Slot pointers per cluster and region (nullptr for regions exchanged with MPI messages)
+  std::vector<std::vector<SharedHaloSlot*>> m_copySlots;
+  std::vector<std::vector<SharedHaloSlot*>> m_ghostSlots;
+};
+#endif
+} // namespace seissol::parallel
+
+#endif // SEISSOL_PARALLEL_SHAREDHALO_H
@@ -0,0 +1,104 @@
+#ifndef SEISSOL_PARALLEL_TASKING_H
+#define SEISSOL_PARALLEL_TASKING_H
+
+#include <vector>
+
+#include <utils/env.h>
+
+#include "PersistentRegion.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace seissol::parallel {
+/**
+ * Returns true if the time cluster actors are executed as OpenMP tasks (SEISSOL_TASKING=1),
+ * see seissol::time_stepping::TimeManager::advanceInTime.
+ **/
+inline bool useTasking() {
+#ifdef _OPENMP
+  static const bool tasking = utils::Env::get<int>("SEISSOL_TASKING", 0) != 0;
+  return tasking;
+#else
+  return false;
+#endif
+}
+
+//! Number of cells (or faces) per task of a cell loop in tasking mode.
+inline unsigned taskGrainSize() {
+  static const unsigned grainSize = utils::Env::get<unsigned>("SEISSOL_TASKING_GRAIN_SIZE", 64);
+  return grainSize;
+}
+
+/**
+ * Calls body(cell) for all cells of a layer.
+ *
+ * Outside of a parallel region, the cells are distributed statically over a new parallel region.
+ * Inside of a parallel region (tasking mode), the cells are split into tasks, such that idle threads
+ * can steal the cells of one cluster while the encountering thread waits for them.
+ * In a persistent region (SEISSOL_PERSISTENT_REGION=1), the waiting threads take their static range.
+ **/
+template <typename F>
+void forEachCell(unsigned numberOfCells, F&& body) {
+  if (PersistentRegion::isActive()) {
+    PersistentRegion::forEachRange(numberOfCells, [&](unsigned begin, unsigned end, int) {
+      for (unsigned cell = begin; cell < end; ++cell) {
+        body(cell);
+      }
+    });
+    return;
+  }
+#ifdef _OPENMP
+  if (omp_in_parallel()) {
+    const unsigned grainSize = taskGrainSize();
+#pragma omp taskloop default(shared) grainsize(grainSize)
+    for (unsigned cell = 0; cell < numberOfCells; ++cell) {
+      body(cell);
+    }
+    return;
+  }
+#pragma omp parallel for schedule(static) default(shared)
+#endif
+  for (unsigned cell = 0; cell < numberOfCells; ++cell) {
+    body(cell);
+  }
+}
+
+//! Like forEachCell, but returns the sum of the values returned by body(cell).
+template <typename F>
+unsigned sumOverCells(unsigned numberOfCells, F&& body) {
+  unsigned sum = 0;
+  if (PersistentRegion::isActive()) {
+    std::vector<unsigned> sums(PersistentRegion::numberOfThreads(), 0);
+    PersistentRegion::forEachRange(numberOfCells, [&](unsigned begin, unsigned end, int thread) {
+      unsigned threadSum = 0;
+      for (unsigned cell = begin; cell < end; ++cell) {
+        threadSum += body(cell);
+      }
+      sums[thread] = threadSum;
+    });
+    for (const auto threadSum : sums) {
+      sum += threadSum;
+    }
+    return sum;
+  }
+#ifdef _OPENMP
+  if (omp_in_parallel()) {
+    const unsigned grainSize = taskGrainSize();
+#pragma omp taskloop default(shared) grainsize(grainSize) reduction(+:sum)
+    for (unsigned cell = 0; cell < numberOfCells; ++cell) {
+      sum += body(cell);
+    }
+    return sum;
+  }
+#pragma omp parallel for schedule(static) default(shared) reduction(+:sum)
+#endif
+  for (unsigned cell = 0; cell < numberOfCells; ++cell) {
+    sum += body(cell);
+  }
+  return sum;
+}
+} // namespace seissol::parallel
+
+#endif // SEISSOL_PARALLEL_TASKING_H
@@ -0,0 +1,43 @@
+#include "AbsorbingLayer.h"
+
+#include <Geometry/MeshTools.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace seissol::physics {
+double AbsorbingLayer::damping(const double x[3], double waveSpeed) const {
+  if (!isEnabled()) {
+    return 0.0;
+  }
+  double distanceSquared = 0.0;
+  for (unsigned dim = 0; dim < 3; ++dim) {
+    const double outside = std::max({0.0, interior[2 * dim] - x[dim], x[dim] - interior[2 * dim + 1]});
+    distanceSquared += outside * outside;
+  }
+  const double relativeDepth = std::min(std::sqrt(distanceSquared) / width, 1.0);
+  const double maximumDamping = 3.0 * waveSpeed * std::log(1.0 / reflection) / (2.0 * width);
+  return maximumDamping * relativeDepth * relativeDepth;
+}
+
+void initializeAbsorbingLayer(AbsorbingLayer const& absorbingLayer,
+                              MeshReader const& meshReader,
+                              initializers::LTSTree* ltsTree,
+                              initializers::LTS* lts,
+                              initializers::Lut* ltsLut) {
+  std::vector<Element> const& elements = meshReader.getElements();
+  std::vector<Vertex> const& vertices = meshReader.getVertices();
+  real* damping = ltsTree->var(lts->absorbingDamping);
+  CellMaterialData const* material = ltsTree->var(lts->material);
+
+  const unsigned numberOfCells = ltsTree->getNumberOfCells(lts->absorbingDamping.mask);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (unsigned ltsId = 0; ltsId < numberOfCells; ++ltsId) {
+    double barycenter[3];
+    MeshTools::center(elements[ltsLut->meshId(lts->absorbingDamping.mask, ltsId)], vertices, barycenter);
+    damping[ltsId] = absorbingLayer.damping(barycenter, material[ltsId].local.getMaxWaveSpeed());
+  }
+}
+} // namespace seissol::physics
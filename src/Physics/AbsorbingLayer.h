@@ -0,0 +1,42 @@
+#ifndef SEISSOL_PHYSICS_ABSORBINGLAYER_H
+#define SEISSOL_PHYSICS_ABSORBINGLAYER_H
+
+#include <Geometry/MeshReader.h>
+#include <Initializer/LTS.h>
+#include <Initializer/tree/LTSTree.hpp>
+#include <Initializer/tree/Lut.hpp>
+
+#include <array>
+
+namespace seissol::physics {
+/**
+ * Damping layer around a region of interest, which absorbs the outgoing waves before they reach the
+ * (absorbing) boundary of the domain.
+ *
+ * The degrees of freedom of a cell at distance r outside the region decay with the rate
+ * d(r) = d0 (r / width)^2, d0 = 3 c log(1 / R) / (2 width),
+ * where c is the largest wave speed of the cell and R the reflection coefficient at normal incidence.
+ **/
+struct AbsorbingLayer {
+  //! Thickness of the layer; the layer is disabled for 0
+  double width = 0.0;
+  //! Reflection coefficient of the layer, in (0, 1)
+  double reflection = 1.0e-3;
+  //! Region of interest (xmin, xmax, ymin, ymax, zmin, zmax), which is not damped
+  std::array<double, 6> interior{};
+
+  bool isEnabled() const { return width > 0.0; }
+
+  //! Damping rate at the point x in a material with the wave speed waveSpeed
+  double damping(const double x[3], double waveSpeed) const;
+};
+
+//! Sets the damping rates of all cells from the layer at their barycenters.
+void initializeAbsorbingLayer(AbsorbingLayer const& absorbingLayer,
+                              MeshReader const& meshReader,
+                              initializers::LTSTree* ltsTree,
+                              initializers::LTS* lts,
+                              initializers::Lut* ltsLut);
+} // namespace seissol::physics
+
+#endif // SEISSOL_PHYSICS_ABSORBINGLAYER_H
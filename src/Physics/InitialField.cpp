@@ -47,11 +47,13 @@ void seissol::physics::Planarwave::evaluate(double time,
   auto R = yateto::DenseTensorView<2,std::complex<double>>(const_cast<std::complex<double>*>(m_eigenvectors.data()), {NUMBER_OF_QUANTITIES, NUMBER_OF_QUANTITIES});
   for (unsigned v = 0; v < m_varField.size(); ++v) {
     const auto omega =  m_lambdaA[m_varField[v]];
-    for (unsigned j = 0; j < dofsQP.shape(1); ++j) {
-      for (size_t i = 0; i < points.size(); ++i) {
-        dofsQP(i,j) += (R(j, m_varField[v]) * m_ampField[v] *
+    for (size_t i = 0; i < points.size(); ++i) {
+      // The wave factor is the same for all quantities
+      const auto wave = m_ampField[v] *
                         std::exp(std::complex<double>(0.0, 1.0) * (
-                          omega * time - m_kVec[0]*points[i][0] - m_kVec[1]*points[i][1] - m_kVec[2]*points[i][2] + std::complex<double>(m_phase, 0)))).real();
+                          omega * time - m_kVec[0]*points[i][0] - m_kVec[1]*points[i][1] - m_kVec[2]*points[i][2] + std::complex<double>(m_phase, 0)));
+      for (unsigned j = 0; j < dofsQP.shape(1); ++j) {
+        dofsQP(i,j) += (R(j, m_varField[v]) * wave).real();
       }
     }
   }
@@ -118,16 +120,18 @@ void seissol::physics::TravellingWave::evaluate(double time,
   auto R = yateto::DenseTensorView<2,std::complex<double>>(const_cast<std::complex<double>*>(m_eigenvectors.data()), {NUMBER_OF_QUANTITIES, NUMBER_OF_QUANTITIES});
   for (unsigned v = 0; v < m_varField.size(); ++v) {
     const auto omega =  m_lambdaA[m_varField[v]];
-    for (unsigned j = 0; j < dofsQp.shape(1); ++j) {
-      for (size_t i = 0; i < points.size(); ++i) {
-        auto arg = std::complex<double>(0.0, 1.0) * (
-                          omega * time
-                        - m_kVec[0]*(points[i][0] - m_origin[0]) 
-                        - m_kVec[1]*(points[i][1] - m_origin[1]) 
-                        - m_kVec[2]*(points[i][2] - m_origin[2]) 
-                        + m_phase);
-        if(arg.imag() > -0.5*M_PI && arg.imag() < 1.5*M_PI) {
-          dofsQp(i,j) += (R(j,m_varField[v]) * m_ampField[v] * std::exp(arg)).real();
+    for (size_t i = 0; i < points.size(); ++i) {
+      auto arg = std::complex<double>(0.0, 1.0) * (
+                        omega * time
+                      - m_kVec[0]*(points[i][0] - m_origin[0]) 
+                      - m_kVec[1]*(points[i][1] - m_origin[1]) 
+                      - m_kVec[2]*(points[i][2] - m_origin[2]) 
+                      + m_phase);
+      if(arg.imag() > -0.5*M_PI && arg.imag() < 1.5*M_PI) {
+        // The wave factor is the same for all quantities
+        const auto wave = m_ampField[v] * std::exp(arg);
+        for (unsigned j = 0; j < dofsQp.shape(1); ++j) {
+          dofsQp(i,j) += (R(j,m_varField[v]) * wave).real();
         }
       }
     }
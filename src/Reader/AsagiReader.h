@@ -90,6 +90,24 @@ public:
 
 private:
 	static NUMACache_Mode getNUMAMode();
+
+#ifdef USE_MPI
+	/**
+	 * Communicator of the ranks on the same node (<prefix>_NODE_LOCAL=1), such that each node holds
+	 * one copy of the grid and the ranks only fetch blocks from their own node.
+	 * The communicator is created once and used by all grids.
+	 */
+	static MPI_Comm nodeCommunicator(MPI_Comm comm) {
+		static MPI_Comm nodeComm = [comm] {
+			int rank;
+			MPI_Comm_rank(comm, &rank);
+			MPI_Comm result;
+			MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &result);
+			return result;
+		}();
+		return nodeComm;
+	}
+#endif // USE_MPI
 };
 
 /**
@@ -112,7 +130,11 @@ private:
   // Set MPI mode
   if (AsagiModule::mpiMode() != MPI_OFF) {
 #ifdef USE_MPI
-    ::asagi::Grid::Error err = grid->setComm(m_comm);
+    MPI_Comm comm = m_comm;
+    if (utils::Env::get<bool>((m_envPrefix + "_NODE_LOCAL").c_str(), false)) {
+      comm = nodeCommunicator(m_comm);
+    }
+    ::asagi::Grid::Error err = grid->setComm(comm);
     if (err != ::asagi::Grid::SUCCESS)
       logError() << "Could not set ASAGI communicator:" << err;
 
@@ -46,18 +46,23 @@
 #include <sstream>
 #include <vector>
 
-class ParallelIStream : public std::wistringstream
+/**
+ * Reads a file on rank 0 and broadcasts its content, such that all ranks can parse it
+ * without accessing the file system.
+ */
+template<typename CharT>
+class BasicParallelIStream : public std::basic_istringstream<CharT>
 {
 private:
 	/** Contains the content of the file */
-	std::vector<wchar_t> m_buffer;
+	std::vector<CharT> m_buffer;
 
 public:
-	ParallelIStream()
+	BasicParallelIStream()
 	{
 	}
 
-	ParallelIStream(const char* filename)
+	BasicParallelIStream(const char* filename)
 	{
 		open(filename);
 	}
@@ -73,7 +78,7 @@ public:
 
 			// Open the file and set the buffer
 			// This only done on rank 0 when running in parallel
-			std::wifstream file(filename);
+			std::basic_ifstream<CharT> file(filename, std::ios::binary);
 			if (!file)
 				logError() << "Could not open file" << filename;
 
@@ -81,26 +86,45 @@ public:
 			m_buffer.resize(file.tellg());
 			file.seekg(0, std::ios::beg);
 
-			file.read(&m_buffer[0], m_buffer.size());
-
-			rdbuf()->pubsetbuf(&m_buffer[0], m_buffer.size());
+			file.read(m_buffer.data(), m_buffer.size());
 
 #ifdef USE_MPI
 			// Broadcast the size and the content of the file
 			unsigned long size = m_buffer.size();
 			MPI_Bcast(&size, 1, MPI_UNSIGNED_LONG, 0, comm);
-			MPI_Bcast(&m_buffer[0], size, MPI_WCHAR, 0, comm);
+			MPI_Bcast(m_buffer.data(), size, mpiType(), 0, comm);
 		} else {
 			unsigned long size;
 			MPI_Bcast(&size, 1, MPI_UNSIGNED_LONG, 0, comm);
 
 			m_buffer.resize(size);
-			MPI_Bcast(&m_buffer[0], size, MPI_WCHAR, 0, comm);
-
-			rdbuf()->pubsetbuf(&m_buffer[0], size);
+			MPI_Bcast(m_buffer.data(), size, mpiType(), 0, comm);
 		}
 #endif // USE_MPI
+
+		this->rdbuf()->pubsetbuf(m_buffer.data(), m_buffer.size());
 	}
+
+	/** The content of the file, e.g. for parsing binary files */
+	const std::vector<CharT>& buffer() const
+	{
+		return m_buffer;
+	}
+
+private:
+#ifdef USE_MPI
+	static MPI_Datatype mpiType()
+	{
+		if constexpr (sizeof(CharT) == sizeof(char)) {
+			return MPI_CHAR;
+		} else {
+			return MPI_WCHAR;
+		}
+	}
+#endif // USE_MPI
 };
 
+typedef BasicParallelIStream<wchar_t> ParallelIStream;
+typedef BasicParallelIStream<char> ParallelCharIStream;
+
 #endif // PARALLEL_ISTREAM_H
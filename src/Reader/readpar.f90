@@ -56,6 +56,13 @@ MODULE COMMON_readpar_mod
         integer(kind=c_int), value                        :: i_maxlen
         character(kind=c_char), dimension(*), intent(out) :: o_file
     end subroutine
+    subroutine readReceiverPoints( i_fileName, i_numberOfPoints, o_x, o_y, o_z ) bind( C, name='readReceiverPoints' )
+        use iso_c_binding
+        implicit none
+        character(kind=c_char), dimension(*), intent(in)  :: i_fileName
+        integer(kind=c_int), value                        :: i_numberOfPoints
+        real(kind=c_double), dimension(*), intent(out)    :: o_x, o_y, o_z
+    end subroutine
   end interface
   !----------------------------------------------------------------------------
   PUBLIC  :: readpar
@@ -570,6 +577,7 @@ CONTAINS
 
   subroutine readpar_faultAtPickpoint(EQN,BND,IC,DISC,IO,MPI,CalledFromStructCode)
     !------------------------------------------------------------------------
+    use iso_c_binding
     !------------------------------------------------------------------------
     IMPLICIT NONE
     !------------------------------------------------------------------------
@@ -581,11 +589,11 @@ CONTAINS
     TYPE (tMPI)                :: MPI
     LOGICAL                    :: CalledFromStructCode
     ! localVariables
-    INTEGER                    :: allocStat, OutputMask(16), i
+    INTEGER                    :: allocStat, OutputMask(16)
     INTEGER                    :: printtimeinterval
     INTEGER                    :: nOutPoints
     INTEGER                    :: readStat
-    REAL, DIMENSION(:), ALLOCATABLE ::X, Y, Z
+    REAL(KIND=c_double), DIMENSION(:), ALLOCATABLE ::X, Y, Z
     CHARACTER(LEN=600)         :: PPFileName
     !------------------------------------------------------------------------
     INTENT(INOUT)              :: EQN, IO, DISC
@@ -618,21 +626,8 @@ CONTAINS
      ALLOCATE(Z(DISC%DynRup%DynRup_out_atPickpoint%nOutPoints))
 
       logInfo0(*) ' Pickpoints read from ', TRIM(PPFileName)
-      CALL OpenFile(                                 &
-            UnitNr       = IO%UNIT%other01         , &
-            Name         = PPFileName              , &
-            create       = .FALSE.                 , &
-            MPI          = MPI                       )
-        DO i = 1, nOutPoints
-          READ(IO%UNIT%other01,*) X(i), Y(i), Z(i)
-
-            logInfo(*) 'Read in point :'
-            logInfo(*) 'x = ', X(i)
-            logInfo(*) 'y = ', Y(i)
-            logInfo(*) 'z = ', Z(i)
-
-       END DO
-       CLOSE(IO%UNIT%other01)
+      ! Rank 0 reads the (ASCII or binary) file and broadcasts it
+      CALL readReceiverPoints(TRIM(PPFileName) // c_null_char, nOutPoints, X, Y, Z)
       ALLOCATE ( DISC%DynRup%DynRup_out_atPickpoint%RecPoint(DISC%DynRup%DynRup_out_atPickpoint%nOutPoints),     &
                 STAT = allocStat                             )
 
@@ -765,12 +760,14 @@ CONTAINS
     INTEGER                    :: stat
     INTEGER                    :: allocStat
     INTEGER                    :: BC_fs, BC_nc, BC_dr, BC_if, BC_of, BC_pe
+    REAL                       :: AbsorbingLayerWidth, AbsorbingLayerReflection, AbsorbingLayerInterior(6)
     INTEGER                    :: readStat
     !------------------------------------------------------------------------
     INTENT(INOUT)              :: EQN, IO, DISC
     INTENT(INOUT)              :: BND
     !------------------------------------------------------------------------
-    NAMELIST                   /Boundaries/ BC_fs, BC_nc, BC_dr, BC_if, BC_of, BC_pe
+    NAMELIST                   /Boundaries/ BC_fs, BC_nc, BC_dr, BC_if, BC_of, BC_pe, &
+                                            AbsorbingLayerWidth, AbsorbingLayerReflection, AbsorbingLayerInterior
     !------------------------------------------------------------------------
 
 
@@ -786,6 +783,9 @@ CONTAINS
     BC_if = 0
     BC_of = 0
     BC_pe = 0
+    AbsorbingLayerWidth = 0.0
+    AbsorbingLayerReflection = 1.0e-3
+    AbsorbingLayerInterior(:) = 0.0
     !
     READ (IO%UNIT%FileIn, IOSTAT=readStat, nml = Boundaries)
     IF (readStat.NE.0) THEN
@@ -889,6 +889,22 @@ CONTAINS
       logInfo(*) ' '                                                            !
       logInfo(*) 'The number of connected surfaces is',BC_pe                  !
       logInfo(*) '-----------------------------------  '                   !
+      !--------------------------------------------------------------------------------------!
+      ! Absorbing layer
+      !--------------------------------------------------------------------------------------!
+
+      BND%AbsorbingLayerWidth = AbsorbingLayerWidth
+      BND%AbsorbingLayerReflection = AbsorbingLayerReflection
+      BND%AbsorbingLayerInterior(:) = AbsorbingLayerInterior(:)
+      IF(AbsorbingLayerWidth.GT.0.0)THEN
+        IF(AbsorbingLayerReflection.LE.0.0 .OR. AbsorbingLayerReflection.GE.1.0)THEN
+          logError(*) 'AbsorbingLayerReflection has to be in (0,1).'
+          call exit(134)
+        ENDIF
+        logInfo(*) ' '
+        logInfo(*) 'Absorbing layer of width',AbsorbingLayerWidth,'around',AbsorbingLayerInterior
+        logInfo(*) '-----------------------------------  '
+      ENDIF
 
 
   END SUBROUTINE readpar_boundaries                                                          !
@@ -2204,6 +2220,8 @@ ALLOCATE( SpacePositionx(nDirac), &
     INTEGER                    :: vertexWeightElement
     INTEGER                    :: vertexWeightDynamicRupture
     INTEGER                    :: vertexWeightFreeSurfaceWithGravity
+    INTEGER                    :: edgeWeightDynamicRupture
+    INTEGER                    :: communicationEdgeWeights
     CHARACTER(LEN=600)          :: Name
     LOGICAL                    :: file_exits
     !------------------------------------------------------------------------
@@ -2214,10 +2232,14 @@ ALLOCATE( SpacePositionx(nDirac), &
     REAL                             :: ScalingMatrixX(3), ScalingMatrixY(3), ScalingMatrixZ(3), &
                                         displacement(3)
     CHARACTER(LEN=600)               :: MeshFile, meshgenerator
+    INTEGER                          :: cubeX, cubeY, cubeZ, cubePx, cubePy, cubePz, cubeBoundary
+    REAL                             :: cubeScale
     NAMELIST                         /MeshNml/ MeshFile, meshgenerator, periodic, &
                                             periodic_direction, displacement, ScalingMatrixX, &
                                             ScalingMatrixY, ScalingMatrixZ, &
-                                            vertexWeightElement, vertexWeightDynamicRupture, vertexWeightFreeSurfaceWithGravity
+                                            vertexWeightElement, vertexWeightDynamicRupture, vertexWeightFreeSurfaceWithGravity, &
+                                            edgeWeightDynamicRupture, communicationEdgeWeights, &
+                                            cubeX, cubeY, cubeZ, cubePx, cubePy, cubePz, cubeScale, cubeBoundary
     !------------------------------------------------------------------------
     !
     logInfo(*) '<--------------------------------------------------------->'
@@ -2244,6 +2266,16 @@ ALLOCATE( SpacePositionx(nDirac), &
     vertexWeightElement = 100
     vertexWeightDynamicRupture = 100
     vertexWeightFreeSurfaceWithGravity = 100
+    edgeWeightDynamicRupture = 1
+    communicationEdgeWeights = 0
+    cubeX = 0
+    cubeY = 0
+    cubeZ = 0
+    cubePx = 0
+    cubePy = 0
+    cubePz = 0
+    cubeScale = 100.
+    cubeBoundary = 1
     !
     READ(IO%UNIT%FileIn, IOSTAT=readStat, nml = MeshNml)
     IF (readStat.NE.0) THEN
@@ -2265,6 +2297,12 @@ ALLOCATE( SpacePositionx(nDirac), &
     MESH%vertexWeightElement = vertexWeightElement
     MESH%vertexWeightDynamicRupture = vertexWeightDynamicRupture
     MESH%vertexWeightFreeSurfaceWithGravity = vertexWeightFreeSurfaceWithGravity
+    MESH%edgeWeightDynamicRupture = edgeWeightDynamicRupture
+    MESH%communicationEdgeWeights = communicationEdgeWeights
+    MESH%cubeSize(:) = (/ cubeX, cubeY, cubeZ /)
+    MESH%cubePartitions(:) = (/ cubePx, cubePy, cubePz /)
+    MESH%cubeScale = cubeScale
+    MESH%cubeBoundary = cubeBoundary
 
        SELECT CASE(IO%meshgenerator)
        CASE('Gambit3D-fast','Netcdf','PUML')
@@ -2318,13 +2356,19 @@ ALLOCATE( SpacePositionx(nDirac), &
             logInfo(*) 'Periodic boundary in z-direction. '
           ENDIF
 
+       CASE('CubeGenerator')
+          logInfo0(*) 'Generate a cube mesh of ', cubeX, ' x ', cubeY, ' x ', cubeZ, ' cubes'
+          BND%periodic = 0
+          BND%DirPeriodic(:) = .FALSE.
+
        CASE DEFAULT
           logError(*) 'Meshgenerator ', TRIM(IO%meshgenerator), ' is unknown!'
           call exit(134)
        END SELECT
     ! specify element type (3-d = tetrahedrons)
 
-      IF(IO%meshgenerator.eq.'Gambit3D-fast' .or. IO%meshgenerator.eq.'Netcdf' .or. IO%meshgenerator.eq.'PUML') THEN
+      IF(IO%meshgenerator.eq.'Gambit3D-fast' .or. IO%meshgenerator.eq.'Netcdf' .or. IO%meshgenerator.eq.'PUML' &
+         .or. IO%meshgenerator.eq.'CubeGenerator') THEN
           MESH%GlobalElemType = 4
           MESH%GlobalSideType = 3
           MESH%GlobalVrtxType = 4
@@ -2589,14 +2633,14 @@ ALLOCATE( SpacePositionx(nDirac), &
                                           ReceiverOutputInterval
       INTEGER :: OutputGroups(100) ! Larger buffer than necessary (probably)
 
-      CHARACTER(LEN=600)               :: OutputFile, RFileName, PGMFile, checkPointFile
+      CHARACTER(LEN=600)               :: OutputFile, RFileName, PGMFile, checkPointFile, OutputRegionsFile
       !> The checkpoint back-end is specified via a string.
       !!
       !! If none is specified, checkpoints are disabled. To use the HDF5, MPI-IO or SIONlib
       !! back-ends you need to compile SeisSol with HDF5, MPI or SIONlib respectively.
       !!
-      !! @allowed_values 'posix', 'hdf5', 'mpio', 'mpio_async', 'sionlib', 'none'
-      !! @warning When using an asynchronous back-end (mpio_async), you might lose
+      !! @allowed_values 'posix', 'hdf5', 'hdf5_async', 'mpio', 'mpio_async', 'mpio_elastic', 'sionlib', 'gds', 'none'
+      !! @warning When using an asynchronous back-end (hdf5_async, mpio_async), you might lose
       !!  2 * checkPointInterval of your computation.
       !! @more_info https://github.com/SeisSol/SeisSol/wiki/Parameter-File
       !!
@@ -2610,7 +2654,7 @@ ALLOCATE( SpacePositionx(nDirac), &
                                                 Format, Interval, TimeInterval, printIntervalCriterion, Refinement, &
                                                 pickdt, pickDtType, RFileName, &
                                                 FaultOutputFlag, &
-                                                checkPointInterval, checkPointFile, checkPointBackend, OutputRegionBounds, OutputGroups, IntegrationMask, &
+                                                checkPointInterval, checkPointFile, checkPointBackend, OutputRegionBounds, OutputGroups, OutputRegionsFile, IntegrationMask, &
                                                 SurfaceOutput, SurfaceOutputRefinement, SurfaceOutputInterval, xdmfWriterBackend, &
                                                 ReceiverOutputInterval, nRecordPoints, &
                                                 EnergyOutput, EnergyTerminalOutput, EnergyOutputInterval
@@ -2632,6 +2676,7 @@ ALLOCATE( SpacePositionx(nDirac), &
       pickDtType = 1
       OutputRegionBounds(:) = 0.0
       outputGroups(:) = -1
+      OutputRegionsFile = ''
       RFileName = ''
       nRecordPoints = -1
       pickDtType = 1
@@ -2671,6 +2716,7 @@ ALLOCATE( SpacePositionx(nDirac), &
       logInfo(*) '  ' ,IO%OutputFile
 
       IO%RFileName = RFileName
+      IO%OutputRegionsFile = OutputRegionsFile
         IF (nRecordPoints /= -1) THEN
            logWarning(*) 'nRecordPoints is deprecated and will be ignored.'
         END IF
@@ -2994,6 +3040,10 @@ ALLOCATE( SpacePositionx(nDirac), &
 
       IO%Refinement = Refinement
       SELECT CASE(Refinement)
+         CASE(-1)
+
+            logInfo0(*) 'Volume output writes the modal coefficients of each cell (no refinement)'
+
          CASE(0)
 
             logInfo0(*) 'Refinement for volume output is disabled'
@@ -3026,6 +3076,12 @@ ALLOCATE( SpacePositionx(nDirac), &
             call exit(134)
 #endif
             logInfo0(*) 'Using HDF5 checkpoint backend'
+        case ("hdf5_async")
+#ifndef USE_HDF
+            logError(*) 'This version does not support HDF5 checkpoints'
+            call exit(134)
+#endif
+            logInfo0(*) 'Using async HDF5 checkpoint backend'
         case ("mpio")
 #ifndef USE_MPI
             logError(*) 'This version does not support MPI-IO checkpoints'
@@ -3038,12 +3094,24 @@ ALLOCATE( SpacePositionx(nDirac), &
             call exit(134)
 #endif
             logInfo0(*) 'Using async MPI-IO checkpoint backend'
+        case ("mpio_elastic")
+#ifndef USE_MPI
+            logError(*) 'This version does not support MPI-IO checkpoints'
+            call exit(134)
+#endif
+            logInfo0(*) 'Using elastic MPI-IO checkpoint backend'
         case ("sionlib")
 #ifndef USE_SIONLIB
             logError(*) 'This version does not support SIONlib checkpoints'
             call exit(134)
 #endif
             logInfo0(*) 'Using SIONlib checkpoint backend'
+        case ("gds")
+#ifndef USE_GDS
+            logError(*) 'This version does not support GPUDirect Storage checkpoints'
+            call exit(134)
+#endif
+            logInfo0(*) 'Using GPUDirect Storage checkpoint backend'
         case ("none")
             io%checkpoint%interval = 0
         case default
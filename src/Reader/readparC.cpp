@@ -38,8 +38,12 @@
  **/
 
 #include "SeisSol.h"
+#include "ResultWriter/ReceiverWriter.h"
+
+#include "utils/logger.h"
 
 #include <cstring>
+#include <stdexcept>
 
 extern "C" {
 
@@ -48,4 +52,26 @@ void getParameterFile(int i_maxlen, char* o_file)
 	strncpy(o_file, seissol::SeisSol::main.parameterFile(), i_maxlen);
 }
 
+/**
+ * Reads the first i_numberOfPoints points of an ASCII or binary receiver file, see
+ * seissol::writer::parseReceiverFile.
+ */
+void readReceiverPoints(const char* i_fileName, int i_numberOfPoints, double* o_x, double* o_y, double* o_z)
+{
+	std::vector<Eigen::Vector3d> points;
+	try {
+		points = seissol::writer::parseReceiverFile(i_fileName);
+	} catch (const std::exception& e) {
+		logError() << "Could not read the receivers from" << i_fileName << ":" << e.what();
+	}
+	if (points.size() < static_cast<std::size_t>(i_numberOfPoints))
+		logError() << i_fileName << "contains only" << points.size() << "of" << i_numberOfPoints << "receivers.";
+
+	for (int i = 0; i < i_numberOfPoints; i++) {
+		o_x[i] = points[i][0];
+		o_y[i] = points[i][1];
+		o_z[i] = points[i][2];
+	}
+}
+
 } // extern "C"
@@ -0,0 +1,129 @@
+#include "Adios2Writer.h"
+
+#ifdef USE_ADIOS2
+
+#include <utils/env.h>
+#include <utils/logger.h>
+
+seissol::writer::Adios2Writer::Adios2Writer(const char* outputPrefix,
+                                            const char* ioName,
+                                            unsigned int verticesPerCell)
+    : m_outputPrefix(outputPrefix), m_ioName(ioName), m_verticesPerCell(verticesPerCell) {}
+
+seissol::writer::Adios2Writer::~Adios2Writer() { close(); }
+
+void seissol::writer::Adios2Writer::init(const std::vector<const char*>& cellVariables,
+                                         const std::vector<const char*>& vertexVariables) {
+  if (!vertexVariables.empty()) {
+    logError() << "The ADIOS2 output does not support vertex variables";
+  }
+  m_variableNames.assign(cellVariables.begin(), cellVariables.end());
+}
+
+void seissol::writer::Adios2Writer::setMesh(unsigned int numCells,
+                                            const unsigned int* cells,
+                                            unsigned int numVertices,
+                                            const double* vertices,
+                                            bool restarting) {
+  m_numCells = numCells;
+  const std::uint64_t localVertices = numVertices;
+  std::uint64_t numGlobalVertices = numVertices;
+#ifdef USE_MPI
+  MPI_Comm_rank(m_comm, &m_rank);
+  MPI_Exscan(&m_numCells, &m_cellOffset, 1, MPI_UINT64_T, MPI_SUM, m_comm);
+  MPI_Exscan(&localVertices, &m_vertexOffset, 1, MPI_UINT64_T, MPI_SUM, m_comm);
+  if (m_rank == 0) {
+    m_cellOffset = 0;
+    m_vertexOffset = 0;
+  }
+  MPI_Allreduce(&m_numCells, &m_globalCells, 1, MPI_UINT64_T, MPI_SUM, m_comm);
+  MPI_Allreduce(&localVertices, &numGlobalVertices, 1, MPI_UINT64_T, MPI_SUM, m_comm);
+#else
+  m_globalCells = m_numCells;
+#endif // USE_MPI
+  m_globalVertices = numGlobalVertices;
+
+  // The connectivity refers to the global vertex ids
+  m_cells.resize(m_numCells * m_verticesPerCell);
+  for (std::size_t i = 0; i < m_cells.size(); ++i) {
+    m_cells[i] = m_vertexOffset + cells[i];
+  }
+  m_vertices.assign(vertices, vertices + 3 * static_cast<std::size_t>(numVertices));
+
+  const std::string config = utils::Env::get<std::string>("SEISSOL_ADIOS2_CONFIG", "");
+#ifdef USE_MPI
+  m_adios = config.empty() ? std::make_unique<adios2::ADIOS>(m_comm) : std::make_unique<adios2::ADIOS>(config, m_comm);
+#else
+  m_adios = config.empty() ? std::make_unique<adios2::ADIOS>() : std::make_unique<adios2::ADIOS>(config);
+#endif // USE_MPI
+
+  m_io = m_adios->DeclareIO(m_ioName);
+  if (!m_io.InConfigFile()) {
+    m_io.SetEngine(utils::Env::get<std::string>("SEISSOL_ADIOS2_ENGINE", "BP5"));
+  }
+
+  m_io.DefineVariable<double>("time");
+  m_io.DefineVariable<double>("geometry", {m_globalVertices, 3}, {m_vertexOffset, 0}, {localVertices, 3});
+  m_io.DefineVariable<std::uint64_t>(
+      "connect", {m_globalCells, m_verticesPerCell}, {m_cellOffset, 0}, {m_numCells, m_verticesPerCell});
+  for (const auto& name : m_variableNames) {
+    m_variables.push_back(m_io.DefineVariable<real>(name, {m_globalCells}, {m_cellOffset}, {m_numCells}));
+  }
+
+  m_engine = m_io.Open(m_outputPrefix + ".bp", restarting ? adios2::Mode::Append : adios2::Mode::Write);
+  // Appended steps do not repeat the mesh
+  m_meshWritten = restarting;
+}
+
+void seissol::writer::Adios2Writer::writeClusteringInfo(const unsigned int* clustering) {
+  m_clustering.assign(clustering, clustering + m_numCells);
+  m_io.DefineVariable<unsigned int>("clustering", {m_globalCells}, {m_cellOffset}, {m_numCells});
+}
+
+void seissol::writer::Adios2Writer::writeMesh() {
+  m_engine.Put(m_io.InquireVariable<double>("geometry"), m_vertices.data(), adios2::Mode::Sync);
+  m_engine.Put(m_io.InquireVariable<std::uint64_t>("connect"), m_cells.data(), adios2::Mode::Sync);
+  if (!m_clustering.empty()) {
+    m_engine.Put(m_io.InquireVariable<unsigned int>("clustering"), m_clustering.data(), adios2::Mode::Sync);
+  }
+  m_meshWritten = true;
+  m_cells = {};
+  m_vertices = {};
+  m_clustering = {};
+}
+
+void seissol::writer::Adios2Writer::addTimeStep(double time) {
+  if (m_stepOpen) {
+    flush();
+  }
+  m_engine.BeginStep();
+  m_stepOpen = true;
+  if (!m_meshWritten) {
+    writeMesh();
+  }
+  if (m_rank == 0) {
+    m_engine.Put(m_io.InquireVariable<double>("time"), time, adios2::Mode::Sync);
+  }
+}
+
+void seissol::writer::Adios2Writer::writeCellData(unsigned int id, const real* data) {
+  // Sync, as the caller may reuse the buffer for the next variable
+  m_engine.Put(m_variables[id], data, adios2::Mode::Sync);
+}
+
+void seissol::writer::Adios2Writer::flush() {
+  if (m_stepOpen) {
+    m_engine.EndStep();
+    m_stepOpen = false;
+  }
+}
+
+void seissol::writer::Adios2Writer::close() {
+  if (m_engine) {
+    flush();
+    m_engine.Close();
+    m_engine = adios2::Engine();
+  }
+}
+
+#endif // USE_ADIOS2
@@ -0,0 +1,97 @@
+#ifndef SEISSOL_RESULTWRITER_ADIOS2WRITER_H
+#define SEISSOL_RESULTWRITER_ADIOS2WRITER_H
+
+#ifdef USE_ADIOS2
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#ifdef USE_MPI
+#include <mpi.h>
+#endif // USE_MPI
+
+#include <adios2.h>
+
+#include "Kernels/precision.hpp"
+
+namespace seissol::writer {
+
+/**
+ * Writes a mesh with cell variables with ADIOS2, e.g. to BP5 files or as an SST stream to staging nodes
+ * (xdmfWriterBackend = 'adios2').
+ *
+ * The engine is chosen with SEISSOL_ADIOS2_ENGINE (default BP5); SEISSOL_ADIOS2_CONFIG may give an ADIOS2 XML file,
+ * whose settings for the IO ("wavefield", "wavefield-low", "surface" or "fault") take precedence.
+ * Each output time is one ADIOS2 step with the scalar "time" and one global array per variable.
+ * The first step additionally contains the mesh ("geometry", "connect" with global vertex ids and, if written,
+ * "clustering"), such that readers of a stream get the mesh once.
+ *
+ * Mirrors the subset of the xdmfwriter interface used by the writer executors.
+ **/
+class Adios2Writer {
+  public:
+  Adios2Writer(const char* outputPrefix, const char* ioName, unsigned int verticesPerCell);
+  ~Adios2Writer();
+
+#ifdef USE_MPI
+  void setComm(MPI_Comm comm) { m_comm = comm; }
+#endif // USE_MPI
+
+  void init(const std::vector<const char*>& cellVariables, const std::vector<const char*>& vertexVariables);
+
+  /**
+   * @param restarting Appends the steps to the existing output of a previous run
+   **/
+  void setMesh(unsigned int numCells,
+               const unsigned int* cells,
+               unsigned int numVertices,
+               const double* vertices,
+               bool restarting = false);
+
+  void writeClusteringInfo(const unsigned int* clustering);
+
+  void addTimeStep(double time);
+
+  void writeCellData(unsigned int id, const real* data);
+
+  void flush();
+
+  void close();
+
+  private:
+  void writeMesh();
+
+  std::string m_outputPrefix;
+  std::string m_ioName;
+  unsigned int m_verticesPerCell;
+#ifdef USE_MPI
+  MPI_Comm m_comm = MPI_COMM_WORLD;
+#endif // USE_MPI
+  int m_rank = 0;
+
+  std::vector<std::string> m_variableNames;
+  std::uint64_t m_numCells = 0;
+  std::uint64_t m_cellOffset = 0;
+  std::uint64_t m_globalCells = 0;
+
+  //! The mesh is kept until the first step
+  std::vector<std::uint64_t> m_cells;
+  std::vector<double> m_vertices;
+  std::vector<unsigned int> m_clustering;
+  std::uint64_t m_vertexOffset = 0;
+  std::uint64_t m_globalVertices = 0;
+  bool m_meshWritten = false;
+  bool m_stepOpen = false;
+
+  std::unique_ptr<adios2::ADIOS> m_adios;
+  adios2::IO m_io;
+  adios2::Engine m_engine;
+  std::vector<adios2::Variable<real>> m_variables;
+};
+} // namespace seissol::writer
+
+#endif // USE_ADIOS2
+
+#endif // SEISSOL_RESULTWRITER_ADIOS2WRITER_H
@@ -44,6 +44,10 @@
 #include <mpi.h>
 #endif // USE_MPI
 
+#include <limits>
+
+#include <utils/logger.h>
+
 #include "SeisSol.h"
 
 namespace seissol
@@ -73,9 +77,14 @@ public:
 #ifdef USE_MPI
 		// Add the offset to the cells
 		MPI_Comm groupComm = seissol::SeisSol::main.asyncIO().groupComm();
-		unsigned int offset = nVertices;
-		MPI_Scan(MPI_IN_PLACE, &offset, 1, MPI_UNSIGNED, MPI_SUM, groupComm);
-		offset -= nVertices;
+		// Global vertex ids are 32-bit in the output, the scan is done in 64 bit to detect an overflow
+		unsigned long globalVertices = nVertices;
+		MPI_Scan(MPI_IN_PLACE, &globalVertices, 1, MPI_UNSIGNED_LONG, MPI_SUM, groupComm);
+		if (globalVertices > std::numeric_limits<unsigned int>::max()) {
+			logError() << "The output supports at most" << std::numeric_limits<unsigned int>::max()
+				<< "vertices per output group, but has at least" << globalVertices;
+		}
+		const unsigned int offset = globalVertices - nVertices;
 
 		// Add the offset to all cells
 		m_cells = new unsigned int[nCells * CellVertices];
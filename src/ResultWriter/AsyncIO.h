@@ -50,6 +50,8 @@
 
 #include "async/Dispatcher.h"
 
+#include "OutputBandwidth.h"
+
 namespace seissol
 {
 
@@ -72,7 +74,8 @@ public:
 		// TODO Update fault communicator (not really sure how we can do this at this point)
 #endif // USE_MPI
 
-		return dispatch();
+		m_executorRank = !dispatch();
+		return !m_executorRank;
 	}
 
 	void finalize()
@@ -84,7 +87,14 @@ public:
 		// Reset the MPI communicator
 		seissol::MPI::mpi.setComm(MPI_COMM_WORLD);
 #endif // USE_MPI
+
+		// Recommend the number of I/O ranks or threads for the next run
+		writer::OutputBandwidth::bandwidth.report(m_executorRank);
 	}
+
+private:
+	/** True for dedicated I/O ranks */
+	bool m_executorRank = false;
 };
 
 }
@@ -0,0 +1,94 @@
+#include "DeviceEnergies.h"
+
+#include <Geometry/MeshTools.h>
+#include <Kernels/DeviceAux/StreamAux.h>
+#include <generated_code/tensor.h>
+
+#include <device.h>
+
+namespace seissol::writer {
+
+DeviceEnergies::DeviceEnergies(GlobalData const* globalOnDevice,
+                               seissol::initializers::LTSTree& ltsTree,
+                               seissol::initializers::LTS const& lts,
+                               seissol::initializers::Lut const& ltsLut,
+                               MeshReader const& meshReader,
+                               std::vector<double> const& quadratureWeights,
+                               bool isPlasticityEnabled)
+    : m_numberOfCells(ltsTree.getNumberOfCells(lts.dofs.mask)) {
+  std::vector<Element> const& elements = meshReader.getElements();
+  std::vector<Vertex> const& vertices = meshReader.getVertices();
+  CellMaterialData const* material = ltsTree.var(lts.material);
+
+  std::vector<real> jacobiDets(m_numberOfCells, 0.0);
+  std::vector<real> rho(m_numberOfCells, 0.0);
+  std::vector<real> lambda(m_numberOfCells, 0.0);
+  std::vector<real> mu(m_numberOfCells, 0.0);
+#ifdef USE_ELASTIC
+  for (std::size_t ltsId = 0; ltsId < m_numberOfCells; ++ltsId) {
+    // Cells that are duplicated in the tree are only counted at their first occurrence
+    if (ltsLut.isFirstOccurrence(lts.dofs.mask, ltsId)) {
+      const unsigned meshId = ltsLut.meshId(lts.dofs.mask, ltsId);
+      jacobiDets[ltsId] = 6 * MeshTools::volume(elements[meshId], vertices);
+    }
+    rho[ltsId] = material[ltsId].local.rho;
+    lambda[ltsId] = material[ltsId].local.lambda;
+    mu[ltsId] = material[ltsId].local.mu;
+  }
+#endif // USE_ELASTIC
+
+  // dofs and plastic strains are allocated in unified memory on devices, i.e. the host pointers are valid on the device
+  m_layer.dofs = *ltsTree.var(lts.dofs);
+  m_layer.evalAtQP = globalOnDevice->evalAtQPMatrix;
+  m_layer.quadratureWeights = upload(std::vector<real>(quadratureWeights.begin(), quadratureWeights.end()));
+  m_layer.jacobiDets = upload(jacobiDets);
+  m_layer.rho = upload(rho);
+  m_layer.lambda = upload(lambda);
+  m_layer.mu = upload(mu);
+  if (isPlasticityEnabled) {
+    m_layer.pstrain = *ltsTree.var(lts.pstrain) + 6 * NUMBER_OF_ALIGNED_BASIS_FUNCTIONS;
+    m_layer.pstrainSize = 7 * NUMBER_OF_ALIGNED_BASIS_FUNCTIONS;
+  }
+
+  m_cellEnergies = upload(std::vector<double>(m_numberOfCells * kernels::device::aux::energy::NumVolumeEnergies));
+  m_energies = upload(std::vector<double>(kernels::device::aux::energy::NumVolumeEnergies));
+}
+
+DeviceEnergies::~DeviceEnergies() {
+  for (void* memory : m_memory) {
+    device::DeviceInstance::getInstance().api->freeMem(memory);
+  }
+}
+
+bool DeviceEnergies::isSupported() {
+#if defined(USE_ELASTIC) && !defined(MULTIPLE_SIMULATIONS)
+  return true;
+#else
+  return false;
+#endif
+}
+
+DeviceEnergies::Energies DeviceEnergies::compute() {
+  auto& api = *device::DeviceInstance::getInstance().api;
+  void* stream = api.getDefaultStream();
+  kernels::device::aux::energy::computeVolumeEnergies(
+      m_layer, m_numberOfCells, m_cellEnergies, m_energies, stream);
+  kernels::device::aux::stream::synchronizeStream(stream);
+
+  Energies energies{};
+  api.copyFrom(energies.data(), m_energies, energies.size() * sizeof(double));
+  return energies;
+}
+
+template <typename T>
+T* DeviceEnergies::upload(std::vector<T> const& data) {
+  if (data.empty()) {
+    return nullptr;
+  }
+  auto& api = *device::DeviceInstance::getInstance().api;
+  void* memory = api.allocGlobMem(data.size() * sizeof(T));
+  api.copyTo(memory, data.data(), data.size() * sizeof(T));
+  m_memory.push_back(memory);
+  return static_cast<T*>(memory);
+}
+} // namespace seissol::writer
@@ -0,0 +1,54 @@
+#ifndef SEISSOL_RESULTWRITER_DEVICEENERGIES_H
+#define SEISSOL_RESULTWRITER_DEVICEENERGIES_H
+
+#include <Initializer/typedefs.hpp>
+#include <Initializer/LTS.h>
+#include <Initializer/tree/LTSTree.hpp>
+#include <Initializer/tree/Lut.hpp>
+#include <Geometry/MeshReader.h>
+#include <Kernels/DeviceAux/EnergyAux.h>
+
+#include <array>
+#include <vector>
+
+namespace seissol::writer {
+/**
+ * Integrates the volume energies of the cells on the device.
+ *
+ * The materials and volumes of the cells are uploaded once; the energies are reduced on the device, such that
+ * only the sums are copied to the host.
+ **/
+class DeviceEnergies {
+  public:
+  using Energies = std::array<double, kernels::device::aux::energy::NumVolumeEnergies>;
+
+  DeviceEnergies(GlobalData const* globalOnDevice,
+                 seissol::initializers::LTSTree& ltsTree,
+                 seissol::initializers::LTS const& lts,
+                 seissol::initializers::Lut const& ltsLut,
+                 MeshReader const& meshReader,
+                 std::vector<double> const& quadratureWeights,
+                 bool isPlasticityEnabled);
+  ~DeviceEnergies();
+  DeviceEnergies(DeviceEnergies const&) = delete;
+  DeviceEnergies& operator=(DeviceEnergies const&) = delete;
+
+  //! False if the energies are computed on the host (other equations than elastic, fused simulations)
+  static bool isSupported();
+
+  //! Volume energies of all cells, indexed by kernels::device::aux::energy::VolumeEnergy
+  Energies compute();
+
+  private:
+  template <typename T>
+  T* upload(std::vector<T> const& data);
+
+  kernels::device::aux::energy::VolumeEnergiesLayer m_layer{};
+  std::size_t m_numberOfCells;
+  double* m_cellEnergies = nullptr;
+  double* m_energies = nullptr;
+  std::vector<void*> m_memory;
+};
+} // namespace seissol::writer
+
+#endif // SEISSOL_RESULTWRITER_DEVICEENERGIES_H
@@ -1,8 +1,13 @@
 #include "EnergyOutput.h"
+#include <algorithm>
+#include <iterator>
+#include <limits>
 #include <Kernels/DynamicRupture.h>
 #include <Numerical_aux/Quadrature.h>
 #include <Parallel/MPI.h>
 #include "SeisSol.h"
+#include "ResultWriter/FaultOutputFilter.h"
+#include "utils/env.h"
 
 namespace seissol::writer {
 
@@ -24,6 +29,13 @@ double& EnergiesStorage::plasticMoment() { return energies[7]; }
 
 double& EnergiesStorage::seismicMoment() { return energies[8]; }
 
+EnergiesStorage& EnergiesStorage::operator+=(const EnergiesStorage& other) {
+  for (std::size_t i = 0; i < energies.size(); ++i) {
+    energies[i] += other.energies[i];
+  }
+  return *this;
+}
+
 void EnergyOutput::init(GlobalData* newGlobal,
                         seissol::initializers::DynamicRupture* newDynRup,
                         seissol::initializers::LTSTree* newDynRuptTree,
@@ -57,6 +69,36 @@ void EnergyOutput::init(GlobalData* newGlobal,
 
   isPlasticityEnabled = newIsPlasticityEnabled;
 
+  const std::string mode = utils::Env::get("SEISSOL_ENERGY_OUTPUT", "sync");
+  if (mode == "clusters") {
+#ifdef ACL_DEVICE
+    logError() << "SEISSOL_ENERGY_OUTPUT=clusters is not supported on GPUs.";
+#endif // ACL_DEVICE
+    accumulateInClusters = true;
+#ifdef USE_MPI
+    // The reductions overlap with the communication of the simulation
+    MPI_Comm_dup(MPI::mpi.comm(), &comm);
+#endif // USE_MPI
+  } else if (mode != "sync") {
+    logError() << "Unknown energy output mode" << mode;
+  }
+
+  stopCriterion = EnergyStopCriterion(utils::Env::get<double>("SEISSOL_ENERGY_STOP_KINETIC", 0.0),
+                                      utils::Env::get<double>("SEISSOL_ENERGY_STOP_SLIP_RATE",
+                                                              std::numeric_limits<double>::infinity()),
+                                      utils::Env::get<double>("SEISSOL_ENERGY_STOP_DURATION", 0.0));
+  const auto& drParameters = seissol::SeisSol::main.getDRParameters();
+  if (stopCriterion.isEnabled() && drParameters.frictionLaw != 0 && !drParameters.isNativeSolverEnabled) {
+    logWarning(rank) << "The energy stop criterion ignores the slip rate of the Fortran friction solvers.";
+  }
+
+  // The quadrature rules do not depend on the cell
+  constexpr auto quadPolyDegree = CONVERGENCE_ORDER + 1;
+  auto const& ruleTet = seissol::quadrature::tetrahedronQuadratureRule<quadPolyDegree>();
+  auto const& ruleTri = seissol::quadrature::triangleQuadratureRule<double, quadPolyDegree>();
+  quadratureWeightsTet.assign(std::begin(ruleTet.weights), std::end(ruleTet.weights));
+  quadratureWeightsTri.assign(std::begin(ruleTri.weights), std::end(ruleTri.weights));
+
   Modules::registerHook(*this, SIMULATION_START);
   Modules::registerHook(*this, SYNCHRONIZATION_POINT);
   setSyncInterval(newSyncPointInterval);
@@ -66,13 +108,26 @@ void EnergyOutput::syncPoint(double time) {
   assert(isEnabled);
   const auto rank = MPI::mpi.rank();
   logInfo(rank) << "Writing energy output at time" << time;
-  computeEnergies();
-  reduceEnergies();
-  if (isTerminalOutputEnabled) {
-    printEnergies();
-  }
-  if (isFileOutputEnabled) {
-    writeEnergies(time);
+  if (!accumulateInClusters) {
+    computeEnergies();
+    reduceEnergies();
+    writeOutput(time);
+  } else {
+    // The reduction of the previous output time has overlapped with the time steps since then
+    completeReduction();
+
+    // Forced synchronization points (e.g. the end of the simulation) are not known to the clusters
+    if (isOutputTime(time)) {
+      std::lock_guard<std::mutex> lock(clusterEnergiesMutex);
+      energiesStorage = clusterEnergies;
+      clusterEnergies.energies.fill(0.0);
+    } else {
+      energiesStorage.energies.fill(0.0);
+      computeVolumeEnergies();
+    }
+    computeDynamicRuptureEnergies();
+    startReduction(time);
+    nextOutputTime = time + syncInterval();
   }
   logInfo(rank) << "Writing energy output at time" << time << "Done.";
 }
@@ -82,17 +137,56 @@ void EnergyOutput::simulationStart() {
     out.open(outputFileName);
     writeHeader();
   }
+  nextOutputTime = seissol::SeisSol::main.simulator().getCurrentTime() + syncInterval();
   syncPoint(0.0);
 }
 
+void EnergyOutput::finalize() {
+  if (isAccumulatedInClusters()) {
+    completeReduction();
+#ifdef USE_MPI
+    MPI_Comm_free(&comm);
+#endif // USE_MPI
+  }
+}
+
+bool EnergyOutput::isTerminationRequested() {
+  if (!isEnabled || !stopCriterion.isEnabled()) {
+    return false;
+  }
+  int requested = terminationRequested ? 1 : 0;
+#ifdef USE_MPI
+  MPI_Bcast(&requested, 1, MPI_INT, 0, MPI::mpi.comm());
+#endif // USE_MPI
+  return requested != 0;
+}
+
+bool EnergyOutput::isOutputTime(double time) const {
+  return std::abs(time - nextOutputTime) <= 1e-8 * std::max(1.0, std::abs(nextOutputTime));
+}
+
+void EnergyOutput::writeOutput(double time) {
+  if (isTerminalOutputEnabled) {
+    printEnergies();
+  }
+  if (isFileOutputEnabled) {
+    writeEnergies(time);
+  }
+  if (MPI::mpi.rank() == 0 && !terminationRequested) {
+    const double kineticEnergy =
+        energiesStorage.elasticKineticEnergy() + energiesStorage.acousticKineticEnergy();
+    terminationRequested = stopCriterion.shouldStop(time, kineticEnergy, maxSlipRate);
+  }
+}
+
 real EnergyOutput::computeStaticWork(const real* degreesOfFreedomPlus,
                                      const real* degreesOfFreedomMinus,
                                      const DRFaceInformation& faceInfo,
                                      const DRGodunovData& godunovData,
                                      const real slip[seissol::tensor::slipInterpolated::size()]) {
-  real points[NUMBER_OF_SPACE_QUADRATURE_POINTS][2];
-  real spaceWeights[NUMBER_OF_SPACE_QUADRATURE_POINTS];
-  seissol::quadrature::TriangleQuadrature(points, spaceWeights, CONVERGENCE_ORDER + 1);
+  // Computed once, as this is called for every fault face
+  auto const& spaceWeights =
+      seissol::quadrature::triangleQuadratureRule<real, CONVERGENCE_ORDER + 1>().weights;
 
   dynamicRupture::kernel::evaluateAndRotateQAtInterpolationPoints krnl;
   krnl.V3mTo2n = global->faceToNodalMatrices;
@@ -175,179 +269,347 @@ void EnergyOutput::computeDynamicRuptureEnergies() {
       }
     }
   }
-}
 
-void EnergyOutput::computeEnergies() {
-  energiesStorage.energies.fill(0.0);
-
-  auto& totalGravitationalEnergyLocal = energiesStorage.gravitationalEnergy();
-  auto& totalAcousticEnergyLocal = energiesStorage.acousticEnergy();
-  auto& totalAcousticKineticEnergyLocal = energiesStorage.acousticKineticEnergy();
-  auto& totalElasticEnergyLocal = energiesStorage.elasticEnergy();
-  auto& totalElasticKineticEnergyLocal = energiesStorage.elasticKineticEnergy();
-  auto& totalPlasticMoment = energiesStorage.plasticMoment();
+  maxSlipRate = 0.0;
+  if (stopCriterion.isEnabled() && seissol::SeisSol::main.getDRParameters().isNativeSolverEnabled) {
+    for (auto it = dynRupTree->beginLeaf(initializers::LayerMask(Ghost)); it != dynRupTree->endLeaf(); ++it) {
+      real(*slipRate1)[dr::numPaddedPoints] = it->var(dynRup->slipRate1);
+      real(*slipRate2)[dr::numPaddedPoints] = it->var(dynRup->slipRate2);
+      // The padded points are zero
+      const auto layerMax = writer::maxSlipRate(
+          slipRate1[0], slipRate2[0], it->getNumberOfCells() * dr::numPaddedPoints);
+      maxSlipRate = std::max(maxSlipRate, static_cast<double>(layerMax));
+    }
+  }
+}
 
+void EnergyOutput::addGravitationalEnergy(std::size_t elementId,
+                                          const CellMaterialData& material,
+                                          const CellLocalInformation& cellInformation,
+                                          real* const* faceDisplacements,
+                                          const CellBoundaryMapping* boundaryMappings,
+                                          EnergiesStorage& energies) const {
+#if defined(USE_ELASTIC) || defined(USE_VISCOELASTIC2)
   std::vector<Element> const& elements = meshReader->getElements();
   std::vector<Vertex> const& vertices = meshReader->getVertices();
 
   const auto g = SeisSol::main.getGravitationSetup().acceleration;
+  constexpr auto quadPolyDegree = CONVERGENCE_ORDER + 1;
+  constexpr auto numQuadraturePointsTri = quadPolyDegree * quadPolyDegree;
+
+  for (int face = 0; face < 4; ++face) {
+    if (cellInformation.faceTypes[face] != FaceType::freeSurfaceGravity)
+      continue;
+
+    // Displacements are stored in face-aligned coordinate system.
+    // We need to rotate it to the global coordinate system.
+    const auto& boundaryMapping = boundaryMappings[face];
+    auto Tinv = init::Tinv::view::create(boundaryMapping.TinvData);
+    alignas(ALIGNMENT)
+        real rotateDisplacementToFaceNormalData[init::displacementRotationMatrix::Size];
+
+    auto rotateDisplacementToFaceNormal =
+        init::displacementRotationMatrix::view::create(rotateDisplacementToFaceNormalData);
+    for (int i = 0; i < 3; ++i) {
+      for (int j = 0; j < 3; ++j) {
+        rotateDisplacementToFaceNormal(i, j) = Tinv(i + 6, j + 6);
+      }
+    }
 
-  // Note: Default(none) is not possible, clang requires data sharing attribute for g, gcc forbids
-  // it
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static) reduction(+ : totalGravitationalEnergyLocal, totalAcousticEnergyLocal, totalAcousticKineticEnergyLocal, totalElasticEnergyLocal, totalElasticKineticEnergyLocal, totalPlasticMoment) shared(elements, vertices, lts, ltsLut, global)
+    alignas(ALIGNMENT) std::array<real, tensor::rotatedFaceDisplacementAtQuadratureNodes::Size>
+        displQuadData{};
+    const auto* curFaceDisplacementsData = faceDisplacements[face];
+    seissol::kernel::rotateFaceDisplacementsAndEvaluateAtQuadratureNodes evalKrnl;
+    evalKrnl.rotatedFaceDisplacement = curFaceDisplacementsData;
+    evalKrnl.V2nTo2JacobiQuad = init::V2nTo2JacobiQuad::Values;
+    evalKrnl.rotatedFaceDisplacementAtQuadratureNodes = displQuadData.data();
+    evalKrnl.displacementRotationMatrix = rotateDisplacementToFaceNormalData;
+    evalKrnl.execute();
+
+    // Perform quadrature
+    const auto surface = MeshTools::surface(elements[elementId], face, vertices);
+    const auto rho = material.local.rho;
+
+    static_assert(numQuadraturePointsTri ==
+                  init::rotatedFaceDisplacementAtQuadratureNodes::Shape[0]);
+    auto rotatedFaceDisplacement =
+        init::rotatedFaceDisplacementAtQuadratureNodes::view::create(displQuadData.data());
+    for (unsigned i = 0; i < rotatedFaceDisplacement.shape(0); ++i) {
+      // See for example (Saito, Tsunami generation and propagation, 2019) section 3.2.3 for
+      // derivation.
+      const auto displ = rotatedFaceDisplacement(i, 0);
+      const auto curEnergy = 0.5 * rho * g * displ * displ;
+      const auto curWeight = 2.0 * surface * quadratureWeightsTri[i];
+      energies.gravitationalEnergy() += curWeight * curEnergy;
+    }
+  }
 #endif
-  for (std::size_t elementId = 0; elementId < elements.size(); ++elementId) {
-    real volume = MeshTools::volume(elements[elementId], vertices);
-    CellMaterialData& material = ltsLut->lookup(lts->material, elementId);
+}
+
+void EnergyOutput::addCellEnergies(std::size_t elementId,
+                                   const real* dofs,
+                                   const CellMaterialData& material,
+                                   const CellLocalInformation& cellInformation,
+                                   real* const* faceDisplacements,
+                                   const CellBoundaryMapping* boundaryMappings,
+                                   const real* pstrain,
+                                   EnergiesStorage& energies) const {
+  std::vector<Element> const& elements = meshReader->getElements();
+  std::vector<Vertex> const& vertices = meshReader->getVertices();
+
+  real volume = MeshTools::volume(elements[elementId], vertices);
 #if defined(USE_ELASTIC) || defined(USE_VISCOELASTIC2)
-    auto& cellInformation = ltsLut->lookup(lts->cellInformation, elementId);
-    auto& faceDisplacements = ltsLut->lookup(lts->faceDisplacements, elementId);
-
-    constexpr auto quadPolyDegree = CONVERGENCE_ORDER + 1;
-    constexpr auto numQuadraturePointsTet = quadPolyDegree * quadPolyDegree * quadPolyDegree;
-
-    double quadraturePointsTet[numQuadraturePointsTet][3];
-    double quadratureWeightsTet[numQuadraturePointsTet];
-    seissol::quadrature::TetrahedronQuadrature(
-        quadraturePointsTet, quadratureWeightsTet, quadPolyDegree);
-
-    constexpr auto numQuadraturePointsTri = quadPolyDegree * quadPolyDegree;
-    double quadraturePointsTri[numQuadraturePointsTri][2];
-    double quadratureWeightsTri[numQuadraturePointsTri];
-    seissol::quadrature::TriangleQuadrature(
-        quadraturePointsTri, quadratureWeightsTri, quadPolyDegree);
-
-    // Needed to weight the integral.
-    const auto jacobiDet = 6 * volume;
-
-    alignas(ALIGNMENT) real numericalSolutionData[tensor::dofsQP::size()];
-    auto numericalSolution = init::dofsQP::view::create(numericalSolutionData);
-    // Evaluate numerical solution at quad. nodes
-    kernel::evalAtQP krnl;
-    krnl.evalAtQP = global->evalAtQPMatrix;
-    krnl.dofsQP = numericalSolutionData;
-    krnl.Q = ltsLut->lookup(lts->dofs, elementId);
-    krnl.execute();
+  constexpr auto quadPolyDegree = CONVERGENCE_ORDER + 1;
+  constexpr auto numQuadraturePointsTet = quadPolyDegree * quadPolyDegree * quadPolyDegree;
+
+  // Needed to weight the integral.
+  const auto jacobiDet = 6 * volume;
+
+  alignas(ALIGNMENT) real numericalSolutionData[tensor::dofsQP::size()];
+  auto numericalSolution = init::dofsQP::view::create(numericalSolutionData);
+  // Evaluate numerical solution at quad. nodes
+  kernel::evalAtQP krnl;
+  krnl.evalAtQP = global->evalAtQPMatrix;
+  krnl.dofsQP = numericalSolutionData;
+  krnl.Q = dofs;
+  krnl.execute();
 
 #ifdef MULTIPLE_SIMULATIONS
-    auto numSub = numericalSolution.subtensor(sim, yateto::slice<>(), yateto::slice<>());
+  auto numSub = numericalSolution.subtensor(sim, yateto::slice<>(), yateto::slice<>());
 #else
-    auto numSub = numericalSolution;
+  auto numSub = numericalSolution;
 #endif
-    for (size_t qp = 0; qp < numQuadraturePointsTet; ++qp) {
-      constexpr int uIdx = 6;
-      const auto curWeight = jacobiDet * quadratureWeightsTet[qp];
-      const auto rho = material.local.rho;
-
-      const auto u = numSub(qp, uIdx + 0);
-      const auto v = numSub(qp, uIdx + 1);
-      const auto w = numSub(qp, uIdx + 2);
-      const double curKineticEnergy = 0.5 * rho * (u * u + v * v + w * w);
-
-      if (std::abs(material.local.mu) < 10e-14) {
-        // Acoustic
-        constexpr int pIdx = 0;
-        const auto K = material.local.lambda;
-        const auto p = numSub(qp, pIdx);
-
-        const double curAcousticEnergy = (p * p) / (2 * K);
-        totalAcousticEnergyLocal += curWeight * curAcousticEnergy;
-        totalAcousticKineticEnergyLocal += curWeight * curKineticEnergy;
-      } else {
-        // Elastic
-        totalElasticKineticEnergyLocal += curWeight * curKineticEnergy;
-        auto getStressIndex = [](int i, int j) {
-          const static auto lookup = std::array<std::array<int, 3>, 3>{{{0, 3, 5}, {3, 1, 4}, {5, 4, 2}}};
-          return lookup[i][j];
-        };
-        auto getStress = [&](int i, int j) { return numSub(qp, getStressIndex(i, j)); };
-
-        const auto lambda = material.local.lambda;
-        const auto mu = material.local.mu;
-        const auto sumUniaxialStresses = getStress(0, 0) + getStress(1, 1) + getStress(2, 2);
-        auto computeStrain = [&](int i, int j) {
-          double strain = 0.0;
-          const auto factor = -1.0 * (lambda) / (2.0 * mu * (3.0 * lambda + 2.0 * mu));
-          if (i == j) {
-            strain += factor * sumUniaxialStresses;
-          }
-          strain += 1.0 / (2.0 * mu) * getStress(i, j);
-          return strain;
-        };
-        double curElasticEnergy = 0.0;
-        for (int i = 0; i < 3; ++i) {
-          for (int j = 0; j < 3; ++j) {
-            curElasticEnergy += getStress(i, j) * computeStrain(i, j);
-          }
+  for (size_t qp = 0; qp < numQuadraturePointsTet; ++qp) {
+    constexpr int uIdx = 6;
+    const auto curWeight = jacobiDet * quadratureWeightsTet[qp];
+    const auto rho = material.local.rho;
+
+    const auto u = numSub(qp, uIdx + 0);
+    const auto v = numSub(qp, uIdx + 1);
+    const auto w = numSub(qp, uIdx + 2);
+    const double curKineticEnergy = 0.5 * rho * (u * u + v * v + w * w);
+
+    if (std::abs(material.local.mu) < 10e-14) {
+      // Acoustic
+      constexpr int pIdx = 0;
+      const auto K = material.local.lambda;
+      const auto p = numSub(qp, pIdx);
+
+      const double curAcousticEnergy = (p * p) / (2 * K);
+      energies.acousticEnergy() += curWeight * curAcousticEnergy;
+      energies.acousticKineticEnergy() += curWeight * curKineticEnergy;
+    } else {
+      // Elastic
+      energies.elasticKineticEnergy() += curWeight * curKineticEnergy;
+      auto getStressIndex = [](int i, int j) {
+        const static auto lookup = std::array<std::array<int, 3>, 3>{{{0, 3, 5}, {3, 1, 4}, {5, 4, 2}}};
+        return lookup[i][j];
+      };
+      auto getStress = [&](int i, int j) { return numSub(qp, getStressIndex(i, j)); };
+
+      const auto lambda = material.local.lambda;
+      const auto mu = material.local.mu;
+      const auto sumUniaxialStresses = getStress(0, 0) + getStress(1, 1) + getStress(2, 2);
+      auto computeStrain = [&](int i, int j) {
+        double strain = 0.0;
+        const auto factor = -1.0 * (lambda) / (2.0 * mu * (3.0 * lambda + 2.0 * mu));
+        if (i == j) {
+          strain += factor * sumUniaxialStresses;
+        }
+        strain += 1.0 / (2.0 * mu) * getStress(i, j);
+        return strain;
+      };
+      double curElasticEnergy = 0.0;
+      for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+          curElasticEnergy += getStress(i, j) * computeStrain(i, j);
         }
-        totalElasticEnergyLocal += curWeight * 0.5 * curElasticEnergy;
       }
+      energies.elasticEnergy() += curWeight * 0.5 * curElasticEnergy;
     }
+  }
+
+#endif
+  addGravitationalEnergy(elementId, material, cellInformation, faceDisplacements, boundaryMappings, energies);
+
+  if (isPlasticityEnabled) {
+    // plastic moment
+#ifdef USE_ANISOTROPIC
+    real mu = (material.local.c44 + material.local.c55 + material.local.c66) / 3.0;
+#else
+    real mu = material.local.mu;
+#endif
+    energies.plasticMoment() += mu * volume * pstrain[6 * NUMBER_OF_ALIGNED_BASIS_FUNCTIONS];
+  }
+}
 
-    auto* boundaryMappings = ltsLut->lookup(lts->boundaryMapping, elementId);
-    // Compute gravitational energy
-    for (int face = 0; face < 4; ++face) {
-      if (cellInformation.faceTypes[face] != FaceType::freeSurfaceGravity)
+#ifdef ACL_DEVICE
+void EnergyOutput::computeVolumeEnergiesOnDevice() {
+  if (deviceEnergies == nullptr) {
+    deviceEnergies = std::make_unique<DeviceEnergies>(SeisSol::main.getMemoryManager().getGlobalDataOnDevice(),
+                                                      *ltsTree,
+                                                      *lts,
+                                                      *ltsLut,
+                                                      *meshReader,
+                                                      quadratureWeightsTet,
+                                                      isPlasticityEnabled);
+    // The face displacements are host memory, hence the few cells with a free surface with gravity stay on the host
+    const auto numberOfCells = ltsTree->getNumberOfCells(lts->dofs.mask);
+    for (std::size_t ltsId = 0; ltsId < numberOfCells; ++ltsId) {
+      if (!ltsLut->isFirstOccurrence(lts->dofs.mask, ltsId)) {
         continue;
+      }
+      const unsigned meshId = ltsLut->meshId(lts->dofs.mask, ltsId);
+      const auto& faceTypes = ltsLut->lookup(lts->cellInformation, meshId).faceTypes;
+      if (std::find(std::begin(faceTypes), std::end(faceTypes), FaceType::freeSurfaceGravity) !=
+          std::end(faceTypes)) {
+        gravitationalCells.push_back(meshId);
+      }
+    }
+  }
 
-      // Displacements are stored in face-aligned coordinate system.
-      // We need to rotate it to the global coordinate system.
-      auto& boundaryMapping = boundaryMappings[face];
-      auto Tinv = init::Tinv::view::create(boundaryMapping.TinvData);
-      alignas(ALIGNMENT)
-          real rotateDisplacementToFaceNormalData[init::displacementRotationMatrix::Size];
+  namespace energy = kernels::device::aux::energy;
+  const auto energies = deviceEnergies->compute();
+  energiesStorage.acousticEnergy() += energies[energy::AcousticEnergy];
+  energiesStorage.acousticKineticEnergy() += energies[energy::AcousticKineticEnergy];
+  energiesStorage.elasticEnergy() += energies[energy::ElasticEnergy];
+  energiesStorage.elasticKineticEnergy() += energies[energy::ElasticKineticEnergy];
+  energiesStorage.plasticMoment() += energies[energy::PlasticMoment];
+
+  for (const unsigned meshId : gravitationalCells) {
+    addGravitationalEnergy(meshId,
+                           ltsLut->lookup(lts->material, meshId),
+                           ltsLut->lookup(lts->cellInformation, meshId),
+                           ltsLut->lookup(lts->faceDisplacements, meshId),
+                           ltsLut->lookup(lts->boundaryMapping, meshId),
+                           energiesStorage);
+  }
+}
+#endif // ACL_DEVICE
 
-      auto rotateDisplacementToFaceNormal =
-          init::displacementRotationMatrix::view::create(rotateDisplacementToFaceNormalData);
-      for (int i = 0; i < 3; ++i) {
-        for (int j = 0; j < 3; ++j) {
-          rotateDisplacementToFaceNormal(i, j) = Tinv(i + 6, j + 6);
+void EnergyOutput::computeVolumeEnergies() {
+#ifdef ACL_DEVICE
+  if (DeviceEnergies::isSupported()) {
+    computeVolumeEnergiesOnDevice();
+    return;
+  }
+
+  // Only the dofs are staged, the batched copies overlap with the energies of the previous batch
+  auto addBatchEnergies = [&](const real* dofs, std::size_t begin, std::size_t end) {
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+      EnergiesStorage localEnergies{};
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+      for (std::size_t ltsId = begin; ltsId < end; ++ltsId) {
+        // Cells that are duplicated in the tree are only counted at their first occurrence
+        if (!ltsLut->isFirstOccurrence(lts->dofs.mask, ltsId)) {
+          continue;
         }
+        const unsigned meshId = ltsLut->meshId(lts->dofs.mask, ltsId);
+        addCellEnergies(meshId,
+                        &dofs[(ltsId - begin) * tensor::Q::size()],
+                        ltsLut->lookup(lts->material, meshId),
+                        ltsLut->lookup(lts->cellInformation, meshId),
+                        ltsLut->lookup(lts->faceDisplacements, meshId),
+                        ltsLut->lookup(lts->boundaryMapping, meshId),
+                        isPlasticityEnabled ? ltsLut->lookup(lts->pstrain, meshId) : nullptr,
+                        localEnergies);
       }
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+      energiesStorage += localEnergies;
+    }
+  };
+  dofsStaging.stage(*ltsTree->var(lts->dofs),
+                    ltsTree->getNumberOfCells(lts->dofs.mask),
+                    tensor::Q::size(),
+                    addBatchEnergies);
+#else
+  std::vector<Element> const& elements = meshReader->getElements();
 
-      alignas(ALIGNMENT) std::array<real, tensor::rotatedFaceDisplacementAtQuadratureNodes::Size>
-          displQuadData{};
-      const auto* curFaceDisplacementsData = faceDisplacements[face];
-      seissol::kernel::rotateFaceDisplacementsAndEvaluateAtQuadratureNodes evalKrnl;
-      evalKrnl.rotatedFaceDisplacement = curFaceDisplacementsData;
-      evalKrnl.V2nTo2JacobiQuad = init::V2nTo2JacobiQuad::Values;
-      evalKrnl.rotatedFaceDisplacementAtQuadratureNodes = displQuadData.data();
-      evalKrnl.displacementRotationMatrix = rotateDisplacementToFaceNormalData;
-      evalKrnl.execute();
-
-      // Perform quadrature
-      const auto surface = MeshTools::surface(elements[elementId], face, vertices);
-      const auto rho = material.local.rho;
-
-      static_assert(numQuadraturePointsTri ==
-                    init::rotatedFaceDisplacementAtQuadratureNodes::Shape[0]);
-      auto rotatedFaceDisplacement =
-          init::rotatedFaceDisplacementAtQuadratureNodes::view::create(displQuadData.data());
-      for (unsigned i = 0; i < rotatedFaceDisplacement.shape(0); ++i) {
-        // See for example (Saito, Tsunami generation and propagation, 2019) section 3.2.3 for
-        // derivation.
-        const auto displ = rotatedFaceDisplacement(i, 0);
-        const auto curEnergy = 0.5 * rho * g * displ * displ;
-        const auto curWeight = 2.0 * surface * quadratureWeightsTri[i];
-        totalGravitationalEnergyLocal += curWeight * curEnergy;
-      }
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+  {
+    EnergiesStorage localEnergies{};
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+    for (std::size_t elementId = 0; elementId < elements.size(); ++elementId) {
+      addCellEnergies(elementId,
+                      ltsLut->lookup(lts->dofs, elementId),
+                      ltsLut->lookup(lts->material, elementId),
+                      ltsLut->lookup(lts->cellInformation, elementId),
+                      ltsLut->lookup(lts->faceDisplacements, elementId),
+                      ltsLut->lookup(lts->boundaryMapping, elementId),
+                      isPlasticityEnabled ? ltsLut->lookup(lts->pstrain, elementId) : nullptr,
+                      localEnergies);
     }
+#ifdef _OPENMP
+#pragma omp critical
 #endif
+    energiesStorage += localEnergies;
+  }
+#endif // ACL_DEVICE
+}
 
-    if (isPlasticityEnabled) {
-      // plastic moment
-      real* pstrainCell = ltsLut->lookup(lts->pstrain, elementId);
-#ifdef USE_ANISOTROPIC
-      real mu = (material.local.c44 + material.local.c55 + material.local.c66) / 3.0;
-#else
-      real mu = material.local.mu;
+void EnergyOutput::computeEnergies() {
+  energiesStorage.energies.fill(0.0);
+  computeVolumeEnergies();
+  computeDynamicRuptureEnergies();
+}
+
+void EnergyOutput::accumulateLayer(seissol::initializers::Layer& layer, double time) {
+  if (!isAccumulatedInClusters() || !isOutputTime(time)) {
+    return;
+  }
+
+  real(*dofs)[tensor::Q::size()] = layer.var(lts->dofs);
+  CellMaterialData* material = layer.var(lts->material);
+  CellLocalInformation* cellInformation = layer.var(lts->cellInformation);
+  real*(*faceDisplacements)[4] = layer.var(lts->faceDisplacements);
+  CellBoundaryMapping(*boundaryMapping)[4] = layer.var(lts->boundaryMapping);
+  real(*pstrain)[7 * NUMBER_OF_ALIGNED_BASIS_FUNCTIONS] =
+      isPlasticityEnabled ? layer.var(lts->pstrain) : nullptr;
+  const unsigned offset = dofs - ltsTree->var(lts->dofs);
+
+  EnergiesStorage layerEnergies{};
+#ifdef _OPENMP
+#pragma omp parallel
 #endif
-      totalPlasticMoment += mu * volume * pstrainCell[6 * NUMBER_OF_ALIGNED_BASIS_FUNCTIONS];
+  {
+    EnergiesStorage localEnergies{};
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+    for (unsigned cell = 0; cell < layer.getNumberOfCells(); ++cell) {
+      // Cells that are duplicated in the tree are only counted at their first occurrence
+      if (!ltsLut->isFirstOccurrence(lts->dofs.mask, offset + cell)) {
+        continue;
+      }
+      const unsigned meshId = ltsLut->meshId(lts->dofs.mask, offset + cell);
+      addCellEnergies(meshId,
+                      dofs[cell],
+                      material[cell],
+                      cellInformation[cell],
+                      faceDisplacements[cell],
+                      boundaryMapping[cell],
+                      isPlasticityEnabled ? pstrain[cell] : nullptr,
+                      localEnergies);
     }
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+    layerEnergies += localEnergies;
   }
 
-  computeDynamicRuptureEnergies();
+  std::lock_guard<std::mutex> lock(clusterEnergiesMutex);
+  clusterEnergies += layerEnergies;
 }
 
 void EnergyOutput::reduceEnergies() {
@@ -367,7 +629,43 @@ void EnergyOutput::reduceEnergies() {
                0,
                comm);
   }
+  if (stopCriterion.isEnabled()) {
+    MPI_Reduce(rank == 0 ? MPI_IN_PLACE : &maxSlipRate, &maxSlipRate, 1, MPI_DOUBLE, MPI_MAX, 0, comm);
+  }
+#endif
+}
+
+void EnergyOutput::startReduction(double time) {
+  sendEnergies = energiesStorage.energies;
+#ifdef USE_MPI
+  const auto count = static_cast<int>(sendEnergies.size());
+  MPI_Ireduce(sendEnergies.data(),
+              energiesStorage.energies.data(),
+              count,
+              MPI_DOUBLE,
+              MPI_SUM,
+              0,
+              comm,
+              &reductionRequest);
+  if (stopCriterion.isEnabled()) {
+    sendMaxSlipRate = maxSlipRate;
+    MPI_Ireduce(&sendMaxSlipRate, &maxSlipRate, 1, MPI_DOUBLE, MPI_MAX, 0, comm, &slipRateRequest);
+  }
+#endif
+  hasPendingReduction = true;
+  pendingTime = time;
+}
+
+void EnergyOutput::completeReduction() {
+  if (!hasPendingReduction) {
+    return;
+  }
+#ifdef USE_MPI
+  MPI_Wait(&reductionRequest, MPI_STATUS_IGNORE);
+  MPI_Wait(&slipRateRequest, MPI_STATUS_IGNORE);
 #endif
+  hasPendingReduction = false;
+  writeOutput(pendingTime);
 }
 
 void EnergyOutput::printEnergies() {
@@ -5,6 +5,9 @@
 #include <string>
 #include <fstream>
 #include <iostream>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 #include <Initializer/typedefs.hpp>
 #include <Initializer/DynamicRupture.h>
@@ -12,6 +15,12 @@
 #include <Geometry/MeshReader.h>
 #include <Initializer/LTS.h>
 #include <Initializer/tree/Lut.hpp>
+#include <Parallel/MPI.h>
+#include <Solver/Pipeline/HostStaging.h>
+#include <ResultWriter/EnergyStopCriterion.h>
+#ifdef ACL_DEVICE
+#include <ResultWriter/DeviceEnergies.h>
+#endif // ACL_DEVICE
 
 #include "Modules/Module.h"
 #include "Modules/Modules.h"
@@ -38,6 +47,8 @@ struct EnergiesStorage {
   double& plasticMoment();
 
   double& seismicMoment();
+
+  EnergiesStorage& operator+=(const EnergiesStorage& other);
 };
 
 class EnergyOutput : public Module {
@@ -58,6 +69,32 @@ class EnergyOutput : public Module {
 
   void simulationStart() override;
 
+  /**
+   * True if the time clusters compute the volume energies at the end of their corrector
+   * (SEISSOL_ENERGY_OUTPUT=clusters) instead of the synchronization point.
+   */
+  bool isAccumulatedInClusters() const { return isEnabled && accumulateInClusters; }
+
+  /**
+   * Adds the volume energies of a layer if the current time step of its cluster ends at the next
+   * output time.
+   */
+  void accumulateLayer(seissol::initializers::Layer& layer, double time);
+
+  //! True if accumulateLayer adds the energies of a cluster time step which ends at time
+  bool isAccumulatedAt(double time) const { return isAccumulatedInClusters() && isOutputTime(time); }
+
+  /**
+   * Completes the pending reduction and writes its result.
+   */
+  void finalize();
+
+  /**
+   * True if the wave field has decayed according to the stop criterion (SEISSOL_ENERGY_STOP_*).
+   * Collective over MPI::mpi.comm(), the decision of rank 0 is broadcast.
+   */
+  bool isTerminationRequested();
+
   private:
   real computeStaticWork(const real* degreesOfFreedomPlus,
                          const real* degreesOfFreedomMinus,
@@ -67,10 +104,40 @@ class EnergyOutput : public Module {
 
   void computeDynamicRuptureEnergies();
 
+  void addGravitationalEnergy(std::size_t elementId,
+                              const CellMaterialData& material,
+                              const CellLocalInformation& cellInformation,
+                              real* const* faceDisplacements,
+                              const CellBoundaryMapping* boundaryMappings,
+                              EnergiesStorage& energies) const;
+
+  void addCellEnergies(std::size_t elementId,
+                       const real* dofs,
+                       const CellMaterialData& material,
+                       const CellLocalInformation& cellInformation,
+                       real* const* faceDisplacements,
+                       const CellBoundaryMapping* boundaryMappings,
+                       const real* pstrain,
+                       EnergiesStorage& energies) const;
+
+#ifdef ACL_DEVICE
+  void computeVolumeEnergiesOnDevice();
+#endif // ACL_DEVICE
+
+  void computeVolumeEnergies();
+
   void computeEnergies();
 
   void reduceEnergies();
 
+  bool isOutputTime(double time) const;
+
+  void startReduction(double time);
+
+  void completeReduction();
+
+  void writeOutput(double time);
+
   void printEnergies();
 
   void writeHeader();
@@ -81,6 +148,7 @@ class EnergyOutput : public Module {
   bool isTerminalOutputEnabled = false;
   bool isFileOutputEnabled = false;
   bool isPlasticityEnabled = false;
+  bool accumulateInClusters = false;
 
   std::string outputFileName;
   std::ofstream out;
@@ -93,7 +161,37 @@ class EnergyOutput : public Module {
   seissol::initializers::LTS* lts = nullptr;
   seissol::initializers::Lut* ltsLut = nullptr;
 
+  std::vector<double> quadratureWeightsTet;
+  std::vector<double> quadratureWeightsTri;
+
   EnergiesStorage energiesStorage{};
+
+  EnergyStopCriterion stopCriterion;
+  //! Maximum slip rate of the native friction solvers, only computed for the stop criterion
+  double maxSlipRate = 0.0;
+  bool terminationRequested = false;
+
+  double nextOutputTime = 0.0;
+  std::mutex clusterEnergiesMutex;
+  EnergiesStorage clusterEnergies{};
+
+  bool hasPendingReduction = false;
+  double pendingTime = 0.0;
+  std::array<double, 9> sendEnergies{};
+  double sendMaxSlipRate = 0.0;
+#ifdef ACL_DEVICE
+  //! Copies the dofs from the device while the energies of the previous batch are computed
+  HostStaging dofsStaging;
+  //! Reduces the volume energies on the device, such that only the sums are copied (elastic)
+  std::unique_ptr<DeviceEnergies> deviceEnergies;
+  //! Cells with a free surface with gravity, their energy is computed on the host
+  std::vector<unsigned> gravitationalCells;
+#endif // ACL_DEVICE
+#ifdef USE_MPI
+  MPI_Comm comm = MPI_COMM_NULL;
+  MPI_Request reductionRequest = MPI_REQUEST_NULL;
+  MPI_Request slipRateRequest = MPI_REQUEST_NULL;
+#endif // USE_MPI
 };
 
 } // namespace seissol::writer
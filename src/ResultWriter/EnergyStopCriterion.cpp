@@ -0,0 +1,20 @@
+#include "EnergyStopCriterion.h"
+
+bool seissol::writer::EnergyStopCriterion::shouldStop(double time, double kineticEnergy, double maxSlipRate) {
+  if (!isEnabled()) {
+    return false;
+  }
+  if (kineticEnergy >= m_kineticEnergyThreshold || maxSlipRate >= m_slipRateThreshold) {
+    m_armed = true;
+    m_quiet = false;
+    return false;
+  }
+  if (!m_armed) {
+    return false;
+  }
+  if (!m_quiet) {
+    m_quiet = true;
+    m_quietSince = time;
+  }
+  return time - m_quietSince >= m_duration * (1.0 - 1e-10);
+}
@@ -0,0 +1,38 @@
+#ifndef SEISSOL_RESULTWRITER_ENERGYSTOPCRITERION_H
+#define SEISSOL_RESULTWRITER_ENERGYSTOPCRITERION_H
+
+#include <limits>
+
+namespace seissol::writer {
+
+/**
+ * Decides at each energy output time if the simulation may end early: the kinetic energy and the
+ * maximum slip rate have to stay below their thresholds for the given (simulated) duration.
+ * The criterion is armed only once one of them has exceeded its threshold, such that the quiet
+ * time before the waves are excited (e.g. before the nucleation) does not end the simulation.
+ **/
+class EnergyStopCriterion {
+  public:
+  EnergyStopCriterion(double kineticEnergyThreshold = 0.0,
+                      double slipRateThreshold = std::numeric_limits<double>::infinity(),
+                      double duration = 0.0)
+      : m_kineticEnergyThreshold(kineticEnergyThreshold), m_slipRateThreshold(slipRateThreshold),
+        m_duration(duration) {}
+
+  bool isEnabled() const { return m_kineticEnergyThreshold > 0.0; }
+
+  //! True if the simulation should stop at time
+  bool shouldStop(double time, double kineticEnergy, double maxSlipRate);
+
+  private:
+  double m_kineticEnergyThreshold;
+  double m_slipRateThreshold;
+  double m_duration;
+  bool m_armed = false;
+  bool m_quiet = false;
+  double m_quietSince = 0.0;
+};
+
+} // namespace seissol::writer
+
+#endif // SEISSOL_RESULTWRITER_ENERGYSTOPCRITERION_H
@@ -0,0 +1,73 @@
+#include "FaultOutputFilter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+seissol::writer::FaultOutputMode seissol::writer::parseFaultOutputMode(const std::string& mode) {
+  if (mode == "all") {
+    return FaultOutputMode::All;
+  }
+  if (mode == "trigger") {
+    return FaultOutputMode::Trigger;
+  }
+  if (mode == "peaks") {
+    return FaultOutputMode::Peaks;
+  }
+  throw std::runtime_error("Unknown fault output mode " + mode + ".");
+}
+
+real seissol::writer::maxSlipRate(real const* slipRate1, real const* slipRate2, std::size_t numberOfCells) {
+  real result = 0.0;
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static) reduction(max : result)
+#endif // _OPENMP
+  for (std::size_t cell = 0; cell < numberOfCells; ++cell) {
+    result = std::max<real>(result, std::hypot(slipRate1[cell], slipRate2[cell]));
+  }
+  return result;
+}
+
+bool seissol::writer::FaultOutputTrigger::shouldWrite(double time, double maxSlipRate) {
+  const bool wasActive = m_active;
+  m_active = maxSlipRate >= m_threshold;
+
+  const bool quiescent = m_quiescentInterval > 0.0 &&
+                         time - m_lastWrite >= m_quiescentInterval * (1.0 - 1e-10);
+  const bool write = !m_written || m_active || wasActive || quiescent;
+  if (write) {
+    m_written = true;
+    m_lastWrite = time;
+  }
+  return write;
+}
+
+void seissol::writer::FaultPeaks::init(std::size_t numberOfCells, double threshold) {
+  m_threshold = threshold;
+  m_first = true;
+  m_peakSlipRate.assign(numberOfCells, 0.0);
+  m_ruptureTime.assign(numberOfCells, -1.0);
+  m_lastSlipRate.assign(numberOfCells, 0.0);
+}
+
+void seissol::writer::FaultPeaks::update(double time, real const* slipRate1, real const* slipRate2) {
+  const std::size_t numberOfCells = m_peakSlipRate.size();
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+#endif // _OPENMP
+  for (std::size_t cell = 0; cell < numberOfCells; ++cell) {
+    const real slipRate = std::hypot(slipRate1[cell], slipRate2[cell]);
+    m_peakSlipRate[cell] = std::max(m_peakSlipRate[cell], slipRate);
+    if (m_ruptureTime[cell] < 0.0 && slipRate >= m_threshold) {
+      if (m_first || slipRate == m_lastSlipRate[cell]) {
+        m_ruptureTime[cell] = time;
+      } else {
+        const double fraction = (m_threshold - m_lastSlipRate[cell]) / (slipRate - m_lastSlipRate[cell]);
+        m_ruptureTime[cell] = m_lastTime + std::clamp(fraction, 0.0, 1.0) * (time - m_lastTime);
+      }
+    }
+    m_lastSlipRate[cell] = slipRate;
+  }
+  m_lastTime = time;
+  m_first = false;
+}
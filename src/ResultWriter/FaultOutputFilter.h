@@ -0,0 +1,70 @@
+#ifndef SEISSOL_RESULTWRITER_FAULTOUTPUTFILTER_H
+#define SEISSOL_RESULTWRITER_FAULTOUTPUTFILTER_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <Kernels/precision.hpp>
+
+namespace seissol::writer {
+enum class FaultOutputMode {
+  //! Write each output time
+  All,
+  //! Write only while the maximum slip rate exceeds the threshold
+  Trigger,
+  //! Accumulate the peak slip rate and the rupture time and write them at the end
+  Peaks
+};
+
+//! Parses "all", "trigger" or "peaks"; throws std::runtime_error.
+FaultOutputMode parseFaultOutputMode(const std::string& mode);
+
+//! Maximum of the slip rate magnitude over the cells
+real maxSlipRate(real const* slipRate1, real const* slipRate2, std::size_t numberOfCells);
+
+/**
+ * Decides at each fault output time if a snapshot is written in the trigger mode: while the maximum
+ * slip rate exceeds the threshold, the first output time after an event and every quiescentInterval
+ * (if positive) in between the events.
+ **/
+class FaultOutputTrigger {
+  public:
+  FaultOutputTrigger(double threshold = 0.0, double quiescentInterval = 0.0)
+      : m_threshold(threshold), m_quiescentInterval(quiescentInterval) {}
+
+  bool shouldWrite(double time, double maxSlipRate);
+
+  private:
+  double m_threshold;
+  double m_quiescentInterval;
+  bool m_active = false;
+  bool m_written = false;
+  double m_lastWrite = 0.0;
+};
+
+/**
+ * Running maximum of the slip rate and the first time at which the slip rate exceeds the threshold,
+ * interpolated linearly between the output times (-1 if the threshold is never exceeded).
+ **/
+class FaultPeaks {
+  public:
+  void init(std::size_t numberOfCells, double threshold);
+
+  void update(double time, real const* slipRate1, real const* slipRate2);
+
+  real* peakSlipRate() { return m_peakSlipRate.data(); }
+
+  real* ruptureTime() { return m_ruptureTime.data(); }
+
+  private:
+  double m_threshold = 0.0;
+  double m_lastTime = 0.0;
+  bool m_first = true;
+  std::vector<real> m_peakSlipRate;
+  std::vector<real> m_ruptureTime;
+  std::vector<real> m_lastSlipRate;
+};
+} // namespace seissol::writer
+
+#endif // SEISSOL_RESULTWRITER_FAULTOUTPUTFILTER_H
@@ -42,12 +42,15 @@
 #include <algorithm>
 #include <cassert>
 #include <cstring>
+#include <stdexcept>
 
 #include "FaultWriter.h"
 #include "AsyncCellIDs.h"
 #include "SeisSol.h"
 #include "Modules/Modules.h"
 #include "Solver/Interoperability.h"
+#include "utils/env.h"
+#include "utils/stringutils.h"
 
 extern seissol::Interoperability e_interoperability;
 
@@ -71,7 +74,7 @@ void seissol::writer::FaultWriter::init(const unsigned int* cells, const double*
 	int* outputMask, const real** dataBuffer,
 	const char* outputPrefix,
 	double interval,
-  xdmfwriter::BackendType backend)
+  OutputBackend backend)
 {
 	const int rank = seissol::MPI::mpi.rank();
 
@@ -85,6 +88,11 @@ void seissol::writer::FaultWriter::init(const unsigned int* cells, const double*
 	FaultInitParam param;
 	param.timestep = m_timestep;
   param.backend = backend;
+	param.aggregation = std::max(1, utils::Env::get<int>("SEISSOL_FAULT_OUTPUT_AGGREGATION", 1));
+
+	// Dedicated output ranks wait for all ranks of their group
+	const bool dedicatedRanks = utils::StringUtils::toLower(utils::Env::get<std::string>("ASYNC_MODE", "sync")) == "mpi";
+	m_participates = nCells > 0 || dedicatedRanks;
 
 	// Create buffer for output prefix
 	unsigned int bufferId = addSyncBuffer(outputPrefix, strlen(outputPrefix)+1, true);
@@ -138,12 +146,44 @@ void seissol::writer::FaultWriter::init(const unsigned int* cells, const double*
                 param.outputMask[18] = true;
                 param.outputMask[19] = true;
         }
-	for (unsigned int i = 0; i < FaultInitParam::OUTPUT_MASK_SIZE; i++) {
+	for (unsigned int i = 0; i < FaultInitParam::FORTRAN_OUTPUT_MASK_SIZE; i++) {
 		if (param.outputMask[i]) {
 			addBuffer(dataBuffer[m_numVariables++], nCells * sizeof(real));
 		}
 	}
 
+	try {
+		m_mode = parseFaultOutputMode(utils::Env::get("SEISSOL_FAULT_OUTPUT", "all"));
+	} catch (const std::runtime_error& error) {
+		logError() << "Could not parse SEISSOL_FAULT_OUTPUT:" << error.what();
+	}
+	m_numCells = nCells;
+	if (m_mode != FaultOutputMode::All) {
+		if (!outputMask[0]) {
+			logError() << "The fault output modes trigger and peaks require the slip rate in the output mask.";
+		}
+		// The slip rates are the first variables
+		m_slipRate[0] = dataBuffer[0];
+		m_slipRate[1] = dataBuffer[1];
+
+		const double threshold = utils::Env::get("SEISSOL_FAULT_OUTPUT_THRESHOLD", 1e-3);
+		if (m_mode == FaultOutputMode::Trigger) {
+			const double quiescentInterval = utils::Env::get("SEISSOL_FAULT_OUTPUT_QUIESCENT_INTERVAL", 0.0);
+			m_trigger = FaultOutputTrigger(threshold, quiescentInterval);
+			logInfo(rank) << "Writing the fault output while the slip rate exceeds" << threshold
+				<< "(quiescent interval" << quiescentInterval << ").";
+		} else {
+			m_peaks.init(nCells, threshold);
+			param.outputMask[FaultInitParam::FORTRAN_OUTPUT_MASK_SIZE] = true;
+			param.outputMask[FaultInitParam::FORTRAN_OUTPUT_MASK_SIZE + 1] = true;
+			addBuffer(m_peaks.peakSlipRate(), nCells * sizeof(real));
+			addBuffer(m_peaks.ruptureTime(), nCells * sizeof(real));
+			m_numVariables += 2;
+			logInfo(rank) << "Writing the peak slip rate and rupture time (slip rate threshold" << threshold
+				<< ") at the end of the simulation.";
+		}
+	}
+
 	//
 	// Send all buffers for initialization
 	//
@@ -175,6 +215,26 @@ void seissol::writer::FaultWriter::syncPoint(double currentTime)
 {
 	SCOREP_USER_REGION("faultoutput_elementwise", SCOREP_USER_REGION_TYPE_FUNCTION)
 
-	e_interoperability.calcElementwiseFaultoutput(currentTime);
-	write(currentTime);
+	if (m_numCells > 0)
+		e_interoperability.calcElementwiseFaultoutput(currentTime);
+	m_lastTime = currentTime;
+
+	switch (m_mode) {
+	case FaultOutputMode::Trigger: {
+		double slipRate = maxSlipRate(m_slipRate[0], m_slipRate[1], m_numCells);
+		// All ranks count the written time steps, which are stored in the checkpoints
+#ifdef USE_MPI
+		MPI_Allreduce(MPI_IN_PLACE, &slipRate, 1, MPI_DOUBLE, MPI_MAX, seissol::MPI::mpi.comm());
+#endif // USE_MPI
+		if (m_trigger.shouldWrite(currentTime, slipRate)) {
+			write(currentTime);
+		}
+		break;
+	}
+	case FaultOutputMode::Peaks:
+		m_peaks.update(currentTime, m_slipRate[0], m_slipRate[1]);
+		break;
+	default:
+		write(currentTime);
+	}
 }
@@ -47,6 +47,7 @@
 
 #include "async/Module.h"
 
+#include "FaultOutputFilter.h"
 #include "FaultWriterExecutor.h"
 #include "Modules/Module.h"
 #include "Monitoring/instrumentation.fpp"
@@ -77,11 +78,42 @@ private:
 	/** Frontend stopwatch */
 	Stopwatch m_stopwatch;
 
+	/** Selects the written output times (SEISSOL_FAULT_OUTPUT) */
+	FaultOutputMode m_mode;
+
+	/** Slip rates in the data buffers (trigger and peaks mode) */
+	const real* m_slipRate[2];
+
+	/** Number of fault output cells */
+	unsigned int m_numCells;
+
+	FaultOutputTrigger m_trigger;
+
+	FaultPeaks m_peaks;
+
+	/** Time of the last fault output computation */
+	double m_lastTime;
+
+	/** True if the peaks have been written */
+	bool m_peaksWritten;
+
+	/**
+	 * False on ranks without fault output cells, which skip the output if their executor
+	 * runs on the same rank (i.e. without dedicated output ranks)
+	 */
+	bool m_participates;
+
 public:
 	FaultWriter()
 		: m_enabled(false),
 		m_numVariables(0),
-		m_timestep(0)
+		m_timestep(0),
+		m_mode(FaultOutputMode::All),
+		m_slipRate{nullptr, nullptr},
+		m_numCells(0),
+		m_lastTime(0.0),
+		m_peaksWritten(false),
+		m_participates(true)
 	{
 	}
 
@@ -95,12 +127,16 @@ public:
 		m_timestep = timestep;
 	}
 
+	/**
+	 * @param interval The output interval and, in the trigger and peaks mode, the sampling
+	 *  interval of the slip rate
+	 */
 	void init(const unsigned int* cells, const double* vertices,
 		unsigned int nCells, unsigned int nVertices,
 		int* outputMask, const real** dataBuffer,
 		const char* outputPrefix,
 		double interval,
-    xdmfwriter::BackendType backend);
+    OutputBackend backend);
 
 	/**
 	 * @return The current time step of the fault output
@@ -117,11 +153,20 @@ public:
 		if (!m_enabled)
 			logError() << "Trying to write fault output, but fault output is not enabled";
 
+		if (!m_participates) {
+			// The time step is stored in the checkpoints
+			m_timestep++;
+			return;
+		}
+
 		m_stopwatch.start();
 
 		const int rank = seissol::MPI::mpi.rank();
 
+		Stopwatch waitStopwatch;
+		waitStopwatch.start();
 		wait();
+		OutputBandwidth::bandwidth.recordSync(waitStopwatch.stop());
 
 		logInfo(rank) << "Writing faultoutput at time" << utils::nospace << time << ".";
 
@@ -143,6 +188,12 @@ public:
 
 	void close()
 	{
+		// The peaks mode writes a single snapshot at the end
+		if (m_enabled && m_mode == FaultOutputMode::Peaks && !m_peaksWritten) {
+			write(m_lastTime);
+			m_peaksWritten = true;
+		}
+
 		if (m_enabled)
 			wait();
 
@@ -56,9 +56,80 @@ void seissol::writer::FaultWriterExecutor::execInit(const async::ExecInfo &info,
 
 	unsigned int nCells = info.bufferSize(CELLS) / (3 * sizeof(int));
 	unsigned int nVertices = info.bufferSize(VERTICES) / (3 * sizeof(double));
+	const unsigned int* cells = static_cast<const unsigned int*>(info.buffer(CELLS));
+	const double* vertices = static_cast<const double*>(info.buffer(VERTICES));
+
+	std::vector<const char*> variables;
+	for (unsigned int i = 0; i < FaultInitParam::OUTPUT_MASK_SIZE; i++) {
+		if (param.outputMask[i])
+			variables.push_back(LABELS[i]);
+	}
+	// Also required by the ranks which only send their variables to the writer of their group
+	m_numVariables = nCells > 0 ? variables.size() : 0;
 
 #ifdef USE_MPI
 	MPI_Comm_split(seissol::MPI::mpi.comm(), (nCells > 0 ? 0 : MPI_UNDEFINED), 0, &m_comm);
+
+	// Only the first rank of each group writes, with the cells of the group
+	std::vector<unsigned int> groupCells;
+	std::vector<double> groupVertices;
+	if (nCells > 0 && param.aggregation > 1) {
+		int faultRank = 0;
+		MPI_Comm_rank(m_comm, &faultRank);
+		MPI_Comm_split(m_comm, faultRank / param.aggregation, faultRank, &m_groupComm);
+		int groupRank = 0;
+		int groupSize = 0;
+		MPI_Comm_rank(m_groupComm, &groupRank);
+		MPI_Comm_size(m_groupComm, &groupSize);
+		MPI_Comm writerComm = MPI_COMM_NULL;
+		MPI_Comm_split(m_comm, (groupRank == 0 ? 0 : MPI_UNDEFINED), faultRank, &writerComm);
+		MPI_Comm_free(&m_comm);
+		m_comm = writerComm;
+
+		int counts[2] = {static_cast<int>(nCells), static_cast<int>(nVertices)};
+		std::vector<int> groupCounts(groupRank == 0 ? 2 * groupSize : 0);
+		MPI_Gather(counts, 2, MPI_INT, groupCounts.data(), 2, MPI_INT, 0, m_groupComm);
+
+		std::vector<int> cellCounts;
+		std::vector<int> cellOffsets;
+		std::vector<int> vertexCounts;
+		std::vector<int> vertexOffsets;
+		if (groupRank == 0) {
+			m_groupCells.resize(groupSize);
+			m_groupOffsets.assign(groupSize + 1, 0);
+			cellCounts.resize(groupSize);
+			cellOffsets.assign(groupSize + 1, 0);
+			vertexCounts.resize(groupSize);
+			vertexOffsets.assign(groupSize + 1, 0);
+			for (int i = 0; i < groupSize; i++) {
+				m_groupCells[i] = groupCounts[2 * i];
+				m_groupOffsets[i + 1] = m_groupOffsets[i] + m_groupCells[i];
+				cellCounts[i] = 3 * groupCounts[2 * i];
+				cellOffsets[i + 1] = cellOffsets[i] + cellCounts[i];
+				vertexCounts[i] = 3 * groupCounts[2 * i + 1];
+				vertexOffsets[i + 1] = vertexOffsets[i] + vertexCounts[i];
+			}
+			groupCells.resize(cellOffsets.back());
+			groupVertices.resize(vertexOffsets.back());
+		}
+		MPI_Gatherv(cells, 3 * nCells, MPI_UNSIGNED, groupCells.data(), cellCounts.data(), cellOffsets.data(),
+			MPI_UNSIGNED, 0, m_groupComm);
+		MPI_Gatherv(vertices, 3 * nVertices, MPI_DOUBLE, groupVertices.data(), vertexCounts.data(),
+			vertexOffsets.data(), MPI_DOUBLE, 0, m_groupComm);
+
+		if (groupRank != 0)
+			return;
+
+		// The cells refer to the vertices of their rank
+		for (int i = 1; i < groupSize; i++) {
+			for (int j = cellOffsets[i]; j < cellOffsets[i + 1]; j++)
+				groupCells[j] += vertexOffsets[i] / 3;
+		}
+		nCells = groupCells.size() / 3;
+		nVertices = groupVertices.size() / 3;
+		cells = groupCells.data();
+		vertices = groupVertices.data();
+	}
 #endif // USE_MPI
 
 	if (nCells > 0) {
@@ -70,30 +141,43 @@ void seissol::writer::FaultWriterExecutor::execInit(const async::ExecInfo &info,
 		std::string outputName(static_cast<const char*>(info.buffer(OUTPUT_PREFIX)));
 		outputName += "-fault";
 
-		std::vector<const char*> variables;
-		for (unsigned int i = 0; i < FaultInitParam::OUTPUT_MASK_SIZE; i++) {
-			if (param.outputMask[i])
-				variables.push_back(LABELS[i]);
-		}
-		m_numVariables = variables.size();
-
 		// TODO get the timestep from the checkpoint
-		m_xdmfWriter = new xdmfwriter::XdmfWriter<xdmfwriter::TRIANGLE, double, real>(param.backend,
-			outputName.c_str(), param.timestep);
+		m_xdmfWriter = new MeshWriter<xdmfwriter::TRIANGLE>(param.backend,
+			outputName.c_str(), "fault", param.timestep);
 
 #ifdef USE_MPI
 		m_xdmfWriter->setComm(m_comm);
 #endif // USE_MPI
 
 		m_xdmfWriter->init(variables, std::vector<const char*>());
-		m_xdmfWriter->setMesh(nCells, static_cast<const unsigned int*>(info.buffer(CELLS)),
-			nVertices, static_cast<const double*>(info.buffer(VERTICES)),
-			param.timestep != 0);
+		m_xdmfWriter->setMesh(nCells, cells, nVertices, vertices, param.timestep != 0);
 
 		logInfo(rank) << "Initializing XDMF fault output. Done.";
 	}
 }
 
+#ifdef USE_MPI
+void seissol::writer::FaultWriterExecutor::gather(std::vector<const real*>& data, std::vector<std::size_t>& sizes)
+{
+	int groupRank = 0;
+	MPI_Comm_rank(m_groupComm, &groupRank);
+	if (groupRank == 0)
+		m_groupData.resize(data.size());
+
+	for (unsigned int i = 0; i < data.size(); i++) {
+		if (groupRank == 0)
+			m_groupData[i].resize(m_groupOffsets.back());
+		MPI_Gatherv(data[i], static_cast<int>(sizes[i]), MPI_C_REAL, m_groupData[i].data(), m_groupCells.data(),
+			m_groupOffsets.data(), MPI_C_REAL, 0, m_groupComm);
+		if (groupRank == 0) {
+			data[i] = m_groupData[i].data();
+			sizes[i] = m_groupData[i].size();
+		}
+	}
+}
+#endif // USE_MPI
+
 char const * const seissol::writer::FaultWriterExecutor::LABELS[] = {
-	"SRs", "SRd", "T_s", "T_d", "P_n", "u_n", "Mud", "StV", "Ts0", "Td0", "Pn0", "Sls", "Sld", "Vr", "ASl","PSR", "RT", "DS", "P_f", "Tmp"
+	"SRs", "SRd", "T_s", "T_d", "P_n", "u_n", "Mud", "StV", "Ts0", "Td0", "Pn0", "Sls", "Sld", "Vr", "ASl","PSR", "RT", "DS", "P_f", "Tmp",
+	"SRmax", "RTthr"
 };
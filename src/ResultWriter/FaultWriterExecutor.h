@@ -44,10 +44,15 @@
 #include <mpi.h>
 #endif // USE_MPI
 
-#include "xdmfwriter/XdmfWriter.h"
+#include <cstddef>
+#include <vector>
+
+#include "MeshWriter.h"
 #include "async/ExecInfo.h"
 #include "Monitoring/Stopwatch.h"
 #include "Kernels/precision.hpp"
+#include "OutputBandwidth.h"
+#include "OutputQueue.h"
 
 namespace seissol
 {
@@ -57,11 +62,17 @@ namespace writer
 
 struct FaultInitParam
 {
-	static const unsigned int OUTPUT_MASK_SIZE = 20;
+	/** Number of variables computed by the Fortran fault output */
+	static const unsigned int FORTRAN_OUTPUT_MASK_SIZE = 20;
+
+	/** Including the peak slip rate and rupture time of the peaks mode */
+	static const unsigned int OUTPUT_MASK_SIZE = FORTRAN_OUTPUT_MASK_SIZE + 2;
 
 	bool outputMask[OUTPUT_MASK_SIZE];
 	int timestep;
-  xdmfwriter::BackendType backend;
+  OutputBackend backend;
+	/** Number of fault ranks whose cells are gathered and written by one rank */
+	int aggregation;
 };
 
 struct FaultParam
@@ -80,11 +91,21 @@ public:
 	};
 
 private:
-	xdmfwriter::XdmfWriter<xdmfwriter::TRIANGLE, double, real>* m_xdmfWriter;
+	MeshWriter<xdmfwriter::TRIANGLE>* m_xdmfWriter;
 
 #ifdef USE_MPI
 	/** The MPI communicator for the writer */
 	MPI_Comm m_comm;
+
+	/** The fault ranks whose cells are written by the first one of them (SEISSOL_FAULT_OUTPUT_AGGREGATION) */
+	MPI_Comm m_groupComm;
+
+	/** Number of cells and offsets of the ranks in the group (first rank of the group only) */
+	std::vector<int> m_groupCells;
+	std::vector<int> m_groupOffsets;
+
+	/** Gathered variables of the group (first rank of the group only) */
+	std::vector<std::vector<real>> m_groupData;
 #endif // USE_MPI
 
 	/** The number of variables that should be written */
@@ -98,6 +119,7 @@ public:
 		: m_xdmfWriter(0L),
 #ifdef USE_MPI
 		m_comm(MPI_COMM_NULL),
+		m_groupComm(MPI_COMM_NULL),
 #endif // USE_MPI
 		m_numVariables(0)
 	{
@@ -110,23 +132,48 @@ public:
 
 	void exec(const async::ExecInfo &info, const FaultParam &param)
 	{
+		std::vector<const real*> data(m_numVariables);
+		std::vector<std::size_t> sizes(m_numVariables);
+		for (unsigned int i = 0; i < m_numVariables; i++) {
+			data[i] = static_cast<const real *>(info.buffer(VARIABLES0 + i));
+			sizes[i] = info.bufferSize(VARIABLES0 + i) / sizeof(real);
+		}
+
+#ifdef USE_MPI
+		if (m_groupComm != MPI_COMM_NULL) {
+			gather(data, sizes);
+		}
+#endif // USE_MPI
+
 		if (!m_xdmfWriter)
 			return;
 
-		m_stopwatch.start();
+		OutputQueue::queue.submitSnapshot(data, sizes,
+			[this, time = param.time](const std::vector<const real*>& snapshot,
+				const std::vector<std::size_t>& snapshotSizes) {
+				m_stopwatch.start();
 
-		m_xdmfWriter->addTimeStep(param.time);
+				m_xdmfWriter->addTimeStep(time);
 
-		for (unsigned int i = 0; i < m_numVariables; i++)
-			m_xdmfWriter->writeCellData(i, static_cast<const real *>(info.buffer(VARIABLES0 + i)));
+				for (unsigned int i = 0; i < m_numVariables; i++)
+					m_xdmfWriter->writeCellData(i, snapshot[i]);
 
-		m_xdmfWriter->flush();
+				m_xdmfWriter->flush();
 
-		m_stopwatch.pause();
+				std::size_t bytes = 0;
+				for (const auto size : snapshotSizes) {
+					bytes += size * sizeof(real);
+				}
+				OutputBandwidth::bandwidth.recordWrite(bytes, m_stopwatch.split());
+				m_stopwatch.pause();
+			});
 	}
 
 	void finalize()
 	{
+		// Write the pending snapshots before closing the file
+		OutputQueue::queue.drain();
+
 		if (m_xdmfWriter) {
 			m_stopwatch.printTime("Time fault writer backend:"
 #ifdef USE_MPI
@@ -140,6 +187,10 @@ public:
 			MPI_Comm_free(&m_comm);
 			m_comm = MPI_COMM_NULL;
 		}
+		if (m_groupComm != MPI_COMM_NULL) {
+			MPI_Comm_free(&m_groupComm);
+			m_groupComm = MPI_COMM_NULL;
+		}
 #endif // USE_MPI
 
 		delete m_xdmfWriter;
@@ -147,6 +198,14 @@ public:
 	}
 
 private:
+#ifdef USE_MPI
+	/**
+	 * Gathers the variables of the group on its first rank and replaces data and sizes
+	 * by the gathered variables there.
+	 */
+	void gather(std::vector<const real*>& data, std::vector<std::size_t>& sizes);
+#endif // USE_MPI
+
 	/** Variable names in the output */
 	static char const * const LABELS[];
 };
@@ -43,13 +43,18 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
 #include <Eigen/Dense>
 
 #include "AsyncCellIDs.h"
 #include "SeisSol.h"
 #include <Geometry/MeshTools.h>
 #include <Modules/Modules.h>
+#include "utils/env.h"
 
 void seissol::writer::FreeSurfaceWriter::constructSurfaceMesh(  MeshReader const& meshReader,
                                                                 unsigned*&        cells,
@@ -131,7 +136,7 @@ void seissol::writer::FreeSurfaceWriter::init(  MeshReader const&
                                                 seissol::solver::FreeSurfaceIntegrator* freeSurfaceIntegrator,
                                                 char const*                             outputPrefix,
                                                 double                                  interval,
-                                                xdmfwriter::BackendType                 backend )
+                                                OutputBackend                 backend )
 {
 	if (!m_enabled)
 		return;
@@ -163,13 +168,57 @@ void seissol::writer::FreeSurfaceWriter::init(  MeshReader const&
 	bufferId = addSyncBuffer(vertices, nVertices * 3 * sizeof(double));
 	assert(bufferId == FreeSurfaceWriterExecutor::VERTICES);
 
-	for (auto & velocity : m_freeSurfaceIntegrator->velocities) {
-		addBuffer(velocity, nCells * sizeof(real));
+	const std::string output = utils::Env::get("SEISSOL_FREESURFACE_OUTPUT", "timeseries");
+	if (output == "peaks") {
+		m_peaks = true;
+	} else if (output != "timeseries") {
+		logError() << "Unknown free surface output" << output << "in SEISSOL_FREESURFACE_OUTPUT.";
 	}
-	for (auto & displacement : m_freeSurfaceIntegrator->displacements) {
-		addBuffer(displacement, nCells * sizeof(real));
+	m_interval = interval;
+
+	std::vector<std::string> names;
+	if (m_peaks) {
+		std::vector<double> periods;
+		try {
+			periods = parseSpectralPeriods(utils::Env::get("SEISSOL_FREESURFACE_SPECTRA", ""));
+		} catch (const std::runtime_error& error) {
+			logError() << "Could not parse SEISSOL_FREESURFACE_SPECTRA:" << error.what();
+		}
+		const auto numberOfAngles = utils::Env::get<unsigned>("SEISSOL_FREESURFACE_ROTD_ANGLES", 0u);
+		m_peakGroundMotion.init(nCells, interval, periods, numberOfAngles);
+		logInfo(rank) << "Accumulating the peak ground motion with" << periods.size() << "response spectrum periods.";
+		if (numberOfAngles > 0) {
+			logInfo(rank) << "Computing the RotD50 values with" << numberOfAngles << "directions.";
+		}
+
+		names = m_peakGroundMotion.variableNames();
+	} else {
+		for (unsigned i = 0; i < 2*FREESURFACE_NUMBER_OF_COMPONENTS; ++i) {
+			names.emplace_back(FreeSurfaceWriterExecutor::LABELS[i]);
+		}
+	}
+	names.emplace_back(FreeSurfaceWriterExecutor::LABELS[2*FREESURFACE_NUMBER_OF_COMPONENTS]);
+	std::string variableNames;
+	for (auto const& name : names) {
+		variableNames += (variableNames.empty() ? "" : ",") + name;
+	}
+	bufferId = addSyncBuffer(variableNames.c_str(), variableNames.size()+1, true);
+	assert(bufferId == FreeSurfaceWriterExecutor::VARIABLE_NAMES);
+
+	if (m_peaks) {
+		for (unsigned i = 0; i < m_peakGroundMotion.numberOfVariables(); ++i) {
+			addBuffer(m_peakGroundMotion.data(i), nCells * sizeof(real));
+		}
+	} else {
+		for (auto & velocity : m_freeSurfaceIntegrator->velocities) {
+			addBuffer(velocity, nCells * sizeof(real));
+		}
+		for (auto & displacement : m_freeSurfaceIntegrator->displacements) {
+			addBuffer(displacement, nCells * sizeof(real));
+		}
 	}
 	addBuffer(m_freeSurfaceIntegrator->locationFlags.data(), nCells * sizeof(double));
+	m_numVariables = names.size();
 
 	//
 	// Send all buffers for initialization
@@ -178,6 +227,7 @@ void seissol::writer::FreeSurfaceWriter::init(  MeshReader const&
 
 	sendBuffer(FreeSurfaceWriterExecutor::CELLS);
 	sendBuffer(FreeSurfaceWriterExecutor::VERTICES);
+	sendBuffer(FreeSurfaceWriterExecutor::VARIABLE_NAMES);
 
 	// Initialize the executor
 	FreeSurfaceInitParam param;
@@ -189,11 +239,16 @@ void seissol::writer::FreeSurfaceWriter::init(  MeshReader const&
 	removeBuffer(FreeSurfaceWriterExecutor::OUTPUT_PREFIX);
 	removeBuffer(FreeSurfaceWriterExecutor::CELLS);
 	removeBuffer(FreeSurfaceWriterExecutor::VERTICES);
+	removeBuffer(FreeSurfaceWriterExecutor::VARIABLE_NAMES);
 
 	// Register for the synchronization point hook
 	Modules::registerHook(*this, SIMULATION_START);
 	Modules::registerHook(*this, SYNCHRONIZATION_POINT);
 	setSyncInterval(interval);
+	if (m_peaks) {
+		// The peaks require equidistant samples
+		setSyncWindow(0);
+	}
 
   delete[] cells;
   delete[] vertices;
@@ -210,14 +265,17 @@ void seissol::writer::FreeSurfaceWriter::write(double time)
 
 	int const rank = seissol::MPI::mpi.rank();
 
+	Stopwatch waitStopwatch;
+	waitStopwatch.start();
 	wait();
+	OutputBandwidth::bandwidth.recordSync(waitStopwatch.stop());
 
 	logInfo(rank) << "Writing free surface at time" << utils::nospace << time << ".";
 
 	FreeSurfaceParam param;
 	param.time = time;
 
-	for (unsigned i = 0; i < 2*FREESURFACE_NUMBER_OF_COMPONENTS + 1; ++i) {
+	for (unsigned i = 0; i < m_numVariables; ++i) {
 		sendBuffer(FreeSurfaceWriterExecutor::VARIABLES0 + i);
 	}
 
@@ -242,5 +300,17 @@ void seissol::writer::FreeSurfaceWriter::syncPoint(double currentTime)
 	SCOREP_USER_REGION("freesurfaceoutput", SCOREP_USER_REGION_TYPE_FUNCTION)
 
   m_freeSurfaceIntegrator->calculateOutput();
+
+	if (m_peaks) {
+		// The samples have to be equidistant for the accelerations and the oscillators (this skips
+		// the final synchronization point if it is not an output time)
+		const bool first = m_lastSampleTime < 0.0;
+		if (first || std::abs(currentTime - m_lastSampleTime - m_interval) <= 1e-6 * m_interval) {
+			m_peakGroundMotion.update(m_freeSurfaceIntegrator->velocities, m_freeSurfaceIntegrator->displacements);
+			m_lastSampleTime = currentTime;
+		}
+		return;
+	}
+
 	write(currentTime);
 }
@@ -52,6 +52,7 @@
 #include "Checkpoint/DynStruct.h"
 #include "Monitoring/Stopwatch.h"
 #include "FreeSurfaceWriterExecutor.h"
+#include "PeakGroundMotion.h"
 
 namespace seissol
 {
@@ -76,6 +77,21 @@ private:
   /** free surface integration module. */
   seissol::solver::FreeSurfaceIntegrator* m_freeSurfaceIntegrator;
 
+	/** Number of variables sent to the executor */
+	unsigned m_numVariables;
+
+	/** True if only the peak ground motion maps are written at the end of the simulation */
+	bool m_peaks;
+
+	/** Accumulates the peak ground motion at each output time */
+	PeakGroundMotion m_peakGroundMotion;
+
+	/** Output interval */
+	double m_interval;
+
+	/** Time of the last sample of the peak ground motion */
+	double m_lastSampleTime;
+
   void constructSurfaceMesh(  MeshReader const& meshReader,
                               unsigned*&        cells,
                               double*&          vertices,
@@ -83,7 +99,9 @@ private:
                               unsigned&         nVertices );
 
 public:
-	FreeSurfaceWriter() : m_enabled(false), m_freeSurfaceIntegrator(NULL) {}
+	FreeSurfaceWriter()
+		: m_enabled(false), m_freeSurfaceIntegrator(NULL), m_numVariables(0), m_peaks(false),
+		m_interval(0.0), m_lastSampleTime(-1.0) {}
 
 	/**
 	 * Called by ASYNC on all ranks
@@ -92,16 +110,25 @@ public:
 
 	void enable();
 
+	/**
+	 * With SEISSOL_FREESURFACE_OUTPUT=peaks, the output interval is the sampling interval of the
+	 * peak ground motion, which is written once when the writer is closed.
+	 */
 	void init(  MeshReader const&                       meshReader,
               seissol::solver::FreeSurfaceIntegrator* freeSurfaceIntegrator,
               char const*                             outputPrefix,
               double                                  interval,
-              xdmfwriter::BackendType                 backend );
+              OutputBackend                 backend );
 
 	void write(double time);
 
 	void close()
 	{
+		if (m_enabled && m_peaks) {
+			m_peakGroundMotion.finalize();
+			write(m_lastSampleTime);
+		}
+
 		if (m_enabled)
 			wait();
 
@@ -39,6 +39,7 @@
 
 #include "Parallel/MPI.h"
 
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -71,22 +72,30 @@ void seissol::writer::FreeSurfaceWriterExecutor::execInit(const async::ExecInfo
 		std::string outputName(static_cast<const char*>(info.buffer(OUTPUT_PREFIX)));
 		outputName += "-surface";
 
-    m_numVariables = 2*FREESURFACE_NUMBER_OF_COMPONENTS + 1;
+		std::istringstream names(static_cast<const char*>(info.buffer(VARIABLE_NAMES)));
+		std::string name;
+		m_variableNames.clear();
+		while (std::getline(names, name, ',')) {
+			m_variableNames.push_back(name);
+		}
+		m_numVariables = m_variableNames.size();
 		std::vector<const char*> variables;
-		for (unsigned int i = 0; i < m_numVariables; i++) {
-      variables.push_back(LABELS[i]);
+		for (auto const& variable : m_variableNames) {
+			variables.push_back(variable.c_str());
 		}
 
 		// TODO get the timestep from the checkpoint
-		m_xdmfWriter = new xdmfwriter::XdmfWriter<xdmfwriter::TRIANGLE, double, real>(param.backend,
-		                                                                              outputName.c_str(),
-		                                                                              param.timestep);
+		m_xdmfWriter = new MeshWriter<xdmfwriter::TRIANGLE>(param.backend,
+		                                                    outputName.c_str(),
+		                                                    "surface",
+		                                                    param.timestep);
 
 #ifdef USE_MPI
 		m_xdmfWriter->setComm(m_comm);
 #endif // USE_MPI
 
 		m_xdmfWriter->init(variables, std::vector<const char*>());
+		m_quantizer.init(variables);
 		m_xdmfWriter->setMesh(nCells,
 		                      static_cast<const unsigned int*>(info.buffer(CELLS)),
 		                      nVertices,
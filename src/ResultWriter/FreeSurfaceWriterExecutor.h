@@ -40,10 +40,17 @@
 #ifndef FREESURFACEWRITEREXECUTOR_H
 #define FREESURFACEWRITEREXECUTOR_H
 
-#include "xdmfwriter/XdmfWriter.h"
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "MeshWriter.h"
 #include "async/ExecInfo.h"
 
 #include "Monitoring/Stopwatch.h"
+#include "OutputQuantization.h"
+#include "OutputBandwidth.h"
+#include "OutputQueue.h"
 
 namespace seissol
 {
@@ -52,7 +59,7 @@ namespace writer
 struct FreeSurfaceInitParam
 {
 	int timestep;
-  xdmfwriter::BackendType backend;
+  OutputBackend backend;
 };
 
 struct FreeSurfaceParam
@@ -67,18 +74,28 @@ public:
 		OUTPUT_PREFIX = 0,
 		CELLS = 1,
 		VERTICES = 2,
-		VARIABLES0 = 3,
+		VARIABLE_NAMES = 3,
+		VARIABLES0 = 4,
 	};
 
+	/** Variable names of the time series output */
+	static char const * const LABELS[];
+
 private:
 #ifdef USE_MPI
 	/** The MPI communicator for the writer */
 	MPI_Comm m_comm;
 #endif // USE_MPI
 
-	xdmfwriter::XdmfWriter<xdmfwriter::TRIANGLE, double, real>* m_xdmfWriter;
+	MeshWriter<xdmfwriter::TRIANGLE>* m_xdmfWriter;
   unsigned m_numVariables;
 
+	/** Variable names (from the comma-separated VARIABLE_NAMES buffer) */
+	std::vector<std::string> m_variableNames;
+
+	/** Error-bounded quantization of the variables */
+	OutputQuantizer m_quantizer;
+
 	/** Backend stopwatch */
 	Stopwatch m_stopwatch;
 
@@ -102,21 +119,40 @@ public:
 			return;
 		}
 
-		m_stopwatch.start();
+		std::vector<const real*> data(m_numVariables);
+		std::vector<std::size_t> sizes(m_numVariables);
+		for (unsigned int i = 0; i < m_numVariables; i++) {
+			data[i] = static_cast<const real*>(info.buffer(VARIABLES0 + i));
+			sizes[i] = info.bufferSize(VARIABLES0 + i) / sizeof(real);
+		}
 
-		m_xdmfWriter->addTimeStep(param.time);
+		OutputQueue::queue.submitSnapshot(data, sizes,
+			[this, time = param.time](const std::vector<const real*>& snapshot,
+				const std::vector<std::size_t>& snapshotSizes) {
+				m_stopwatch.start();
 
-		for (unsigned int i = 0; i < m_numVariables; i++) {
-			m_xdmfWriter->writeCellData(i, static_cast<const real*>(info.buffer(VARIABLES0 + i)));
-    }
+				m_xdmfWriter->addTimeStep(time);
+
+				for (unsigned int i = 0; i < m_numVariables; i++) {
+					m_xdmfWriter->writeCellData(i, m_quantizer.apply(i, snapshot[i], snapshotSizes[i]));
+				}
 
-		m_xdmfWriter->flush();
+				m_xdmfWriter->flush();
 
-		m_stopwatch.pause();
+				std::size_t bytes = 0;
+				for (const auto size : snapshotSizes) {
+					bytes += size * sizeof(real);
+				}
+				OutputBandwidth::bandwidth.recordWrite(bytes, m_stopwatch.split());
+				m_stopwatch.pause();
+			});
 	}
 
 	void finalize()
 	{
+		// Write the pending snapshots before closing the file
+		OutputQueue::queue.drain();
+
 		if (m_xdmfWriter) {
 			m_stopwatch.printTime("Time free surface writer backend:"
 #ifdef USE_MPI
@@ -135,10 +171,6 @@ public:
 		delete m_xdmfWriter;
 		m_xdmfWriter = 0L;
 	}
-
-private:
-	/** Variable names in the output */
-	static char const * const LABELS[];
 };
 
 }
@@ -0,0 +1,109 @@
+#ifndef SEISSOL_RESULTWRITER_MESHWRITER_H
+#define SEISSOL_RESULTWRITER_MESHWRITER_H
+
+#include <memory>
+#include <vector>
+
+#ifdef USE_MPI
+#include <mpi.h>
+#endif // USE_MPI
+
+#include "xdmfwriter/XdmfWriter.h"
+
+#include "Kernels/precision.hpp"
+#include "common.hpp"
+
+#ifdef USE_ADIOS2
+#include "Adios2Writer.h"
+#endif // USE_ADIOS2
+
+namespace seissol::writer {
+
+/**
+ * Writer of a mesh with cell variables for the wave field, free surface and fault output:
+ * the XDMF writer for the POSIX and HDF5 backends or the ADIOS2 writer.
+ **/
+template <xdmfwriter::TopoType Topo>
+class MeshWriter {
+  public:
+  /**
+   * @param ioName Name of the ADIOS2 IO, i.e. of its settings in the ADIOS2 XML configuration file
+   **/
+  MeshWriter(OutputBackend backend,
+             const char* outputPrefix,
+             [[maybe_unused]] const char* ioName,
+             unsigned int timestep = 0) {
+#ifdef USE_ADIOS2
+    if (backend == OutputBackend::Adios2) {
+      m_adios2Writer = std::make_unique<Adios2Writer>(outputPrefix, ioName, Topo == xdmfwriter::TRIANGLE ? 3 : 4);
+      return;
+    }
+#endif // USE_ADIOS2
+    m_xdmfWriter =
+        std::make_unique<xdmfwriter::XdmfWriter<Topo, double, real>>(xdmfBackendType(backend), outputPrefix, timestep);
+  }
+
+#ifdef USE_MPI
+  void setComm(MPI_Comm comm) { dispatch([&](auto& writer) { writer.setComm(comm); }); }
+#endif // USE_MPI
+
+  //! Additional flags (e.g. for the partition and clustering information) only apply to the XDMF writer
+  template <typename... Flags>
+  void init(const std::vector<const char*>& cellVariables,
+            const std::vector<const char*>& vertexVariables,
+            Flags... flags) {
+    if (m_xdmfWriter) {
+      m_xdmfWriter->init(cellVariables, vertexVariables, flags...);
+    }
+#ifdef USE_ADIOS2
+    if (m_adios2Writer) {
+      m_adios2Writer->init(cellVariables, vertexVariables);
+    }
+#endif // USE_ADIOS2
+  }
+
+  void setMesh(unsigned int numCells,
+               const unsigned int* cells,
+               unsigned int numVertices,
+               const double* vertices,
+               bool restarting = false) {
+    dispatch([&](auto& writer) { writer.setMesh(numCells, cells, numVertices, vertices, restarting); });
+  }
+
+  void writeClusteringInfo(const unsigned int* clustering) {
+    dispatch([&](auto& writer) { writer.writeClusteringInfo(clustering); });
+  }
+
+  void addTimeStep(double time) {
+    dispatch([&](auto& writer) { writer.addTimeStep(time); });
+  }
+
+  void writeCellData(unsigned int id, const real* data) {
+    dispatch([&](auto& writer) { writer.writeCellData(id, data); });
+  }
+
+  void flush() {
+    dispatch([&](auto& writer) { writer.flush(); });
+  }
+
+  private:
+  template <typename F>
+  void dispatch(F&& function) {
+    if (m_xdmfWriter) {
+      function(*m_xdmfWriter);
+    }
+#ifdef USE_ADIOS2
+    if (m_adios2Writer) {
+      function(*m_adios2Writer);
+    }
+#endif // USE_ADIOS2
+  }
+
+  std::unique_ptr<xdmfwriter::XdmfWriter<Topo, double, real>> m_xdmfWriter;
+#ifdef USE_ADIOS2
+  std::unique_ptr<Adios2Writer> m_adios2Writer;
+#endif // USE_ADIOS2
+};
+} // namespace seissol::writer
+
+#endif // SEISSOL_RESULTWRITER_MESHWRITER_H
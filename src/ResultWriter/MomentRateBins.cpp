@@ -0,0 +1,42 @@
+#include "MomentRateBins.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace seissol::writer {
+
+double* MomentRateBins::bin(std::size_t index) {
+  if ((index + 1) * m_numberOfSegments > m_moments.size()) {
+    m_moments.resize((index + 1) * m_numberOfSegments, 0.0);
+  }
+  return &m_moments[index * m_numberOfSegments];
+}
+
+void MomentRateBins::add(double begin, double end, const double* moments) {
+  if (m_numberOfSegments == 0) {
+    return;
+  }
+  const auto first = static_cast<std::size_t>(std::max(0.0, std::floor(begin / m_interval)));
+  if (end <= begin) {
+    double* moment = bin(first);
+    for (std::size_t segment = 0; segment < m_numberOfSegments; ++segment) {
+      moment[segment] += moments[segment];
+    }
+    return;
+  }
+  const auto last =
+      std::max(first, static_cast<std::size_t>(std::max(1.0, std::ceil(end / m_interval))) - 1);
+  for (std::size_t index = first; index <= last; ++index) {
+    const double overlap = std::min(end, (index + 1) * m_interval) - std::max(begin, index * m_interval);
+    if (overlap <= 0.0) {
+      continue;
+    }
+    const double fraction = overlap / (end - begin);
+    double* moment = bin(index);
+    for (std::size_t segment = 0; segment < m_numberOfSegments; ++segment) {
+      moment[segment] += fraction * moments[segment];
+    }
+  }
+}
+
+} // namespace seissol::writer
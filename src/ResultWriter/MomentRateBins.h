@@ -0,0 +1,51 @@
+#ifndef SEISSOL_RESULTWRITER_MOMENTRATEBINS_H
+#define SEISSOL_RESULTWRITER_MOMENTRATEBINS_H
+
+#include <cstddef>
+#include <vector>
+
+namespace seissol::writer {
+
+/**
+ * Seismic moment of each fault segment, summed up in output intervals of equal length.
+ * The moment released in a time step is distributed over the intervals proportional to their
+ * overlap with the time step, i.e. the moment rate is assumed to be constant within the time step.
+ **/
+class MomentRateBins {
+  public:
+  MomentRateBins(double interval = 1.0, std::size_t numberOfSegments = 0)
+      : m_interval(interval), m_numberOfSegments(numberOfSegments) {}
+
+  //! Adds the moments released by each segment in [begin, end]
+  void add(double begin, double end, const double* moments);
+
+  double interval() const { return m_interval; }
+
+  std::size_t numberOfSegments() const { return m_numberOfSegments; }
+
+  std::size_t numberOfBins() const {
+    return m_numberOfSegments == 0 ? 0 : m_moments.size() / m_numberOfSegments;
+  }
+
+  //! Appends empty intervals, such that all ranks have the same number of intervals
+  void resize(std::size_t numberOfBins) { m_moments.resize(numberOfBins * m_numberOfSegments, 0.0); }
+
+  //! Mean moment rate of a segment in the interval [bin * interval, (bin + 1) * interval]
+  double momentRate(std::size_t bin, std::size_t segment) const {
+    return m_moments[bin * m_numberOfSegments + segment] / m_interval;
+  }
+
+  //! Moments of all intervals, the segments are the fastest index
+  std::vector<double>& moments() { return m_moments; }
+
+  private:
+  double* bin(std::size_t index);
+
+  double m_interval;
+  std::size_t m_numberOfSegments;
+  std::vector<double> m_moments;
+};
+
+} // namespace seissol::writer
+
+#endif // SEISSOL_RESULTWRITER_MOMENTRATEBINS_H
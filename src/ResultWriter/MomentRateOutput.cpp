@@ -0,0 +1,203 @@
+#include "MomentRateOutput.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+
+#include "Parallel/MPI.h"
+#include "Parallel/Tasking.h"
+#include "utils/env.h"
+#include "utils/logger.h"
+
+namespace seissol::writer {
+
+void MomentRateOutput::init(seissol::initializers::DynamicRupture* newDynRup,
+                            seissol::initializers::LTSTree* newDynRupTree,
+                            const MeshReader& meshReader,
+                            const std::string& outputFileNamePrefix) {
+  const double interval = utils::Env::get<double>("SEISSOL_MOMENT_RATE_INTERVAL", 0.0);
+  if (interval <= 0.0) {
+    return;
+  }
+  const auto rank = MPI::mpi.rank();
+#ifdef ACL_DEVICE
+  logWarning(rank) << "SEISSOL_MOMENT_RATE_INTERVAL is not supported on GPUs and ignored.";
+  return;
+#endif // ACL_DEVICE
+  logInfo(rank) << "Initializing the moment rate output with an interval of" << interval << "s.";
+
+  enabled = true;
+  outputFileName = outputFileNamePrefix + "-moment-rate.csv";
+  dynRup = newDynRup;
+  dynRupTree = newDynRupTree;
+
+  const std::vector<Fault>& fault = meshReader.getFault();
+  const std::vector<Element>& elements = meshReader.getElements();
+  const std::size_t numberOfFaces = dynRupTree->getNumberOfCells();
+  std::vector<int> faceTags(numberOfFaces, -1);
+  momentFactors.assign(numberOfFaces, 0.0);
+  faceMoments.assign(numberOfFaces, 0.0);
+  faceIncrements.assign(numberOfFaces, 0.0);
+
+  // Faces on a partition boundary are counted on the rank of their plus side
+  std::vector<int> localTags;
+  for (auto it = dynRupTree->beginLeaf(); it != dynRupTree->endLeaf(); ++it) {
+    DRFaceInformation* faceInformation = it->var(dynRup->faceInformation);
+    DRGodunovData* godunovData = it->var(dynRup->godunovData);
+    seissol::model::IsotropicWaveSpeeds* waveSpeedsPlus = it->var(dynRup->waveSpeedsPlus);
+    seissol::model::IsotropicWaveSpeeds* waveSpeedsMinus = it->var(dynRup->waveSpeedsMinus);
+    const std::size_t offset = faceInformation - dynRupTree->var(dynRup->faceInformation);
+    for (unsigned i = 0; i < it->getNumberOfCells(); ++i) {
+      if (!faceInformation[i].plusSideOnThisRank) {
+        continue;
+      }
+      const Fault& face = fault[faceInformation[i].meshFace];
+      faceTags[offset + i] = elements[face.element].faultTags[face.side];
+      localTags.push_back(faceTags[offset + i]);
+
+      // As in EnergyOutput::computeDynamicRuptureEnergies
+      const double muPlus = waveSpeedsPlus[i].density * waveSpeedsPlus[i].sWaveVelocity *
+                            waveSpeedsPlus[i].sWaveVelocity;
+      const double muMinus = waveSpeedsMinus[i].density * waveSpeedsMinus[i].sWaveVelocity *
+                             waveSpeedsMinus[i].sWaveVelocity;
+      const double mu = 2.0 * muPlus * muMinus / (muPlus + muMinus);
+      momentFactors[offset + i] = 0.5 * godunovData[i].doubledSurfaceArea * mu /
+                                  seissol::tensor::squaredNormSlipRateInterpolated::size();
+    }
+  }
+  std::sort(localTags.begin(), localTags.end());
+  localTags.erase(std::unique(localTags.begin(), localTags.end()), localTags.end());
+
+  faultMpi.init(numberOfFaces > 0);
+  segmentTags = localTags;
+#ifdef USE_MPI
+  if (faultMpi.comm() != MPI_COMM_NULL) {
+    // All fault ranks need the same segments for the reduction
+    int numberOfLocalTags = static_cast<int>(localTags.size());
+    std::vector<int> numbersOfTags(faultMpi.size());
+    MPI_Allgather(&numberOfLocalTags, 1, MPI_INT, numbersOfTags.data(), 1, MPI_INT, faultMpi.comm());
+    std::vector<int> displacements(faultMpi.size() + 1, 0);
+    for (int i = 0; i < faultMpi.size(); ++i) {
+      displacements[i + 1] = displacements[i] + numbersOfTags[i];
+    }
+    segmentTags.resize(displacements.back());
+    MPI_Allgatherv(localTags.data(),
+                   numberOfLocalTags,
+                   MPI_INT,
+                   segmentTags.data(),
+                   numbersOfTags.data(),
+                   displacements.data(),
+                   MPI_INT,
+                   faultMpi.comm());
+    std::sort(segmentTags.begin(), segmentTags.end());
+    segmentTags.erase(std::unique(segmentTags.begin(), segmentTags.end()), segmentTags.end());
+  }
+#endif // USE_MPI
+
+  faceSegments.assign(numberOfFaces, -1);
+  for (std::size_t i = 0; i < numberOfFaces; ++i) {
+    if (faceTags[i] >= 0) {
+      faceSegments[i] = static_cast<int>(
+          std::lower_bound(segmentTags.begin(), segmentTags.end(), faceTags[i]) - segmentTags.begin());
+    }
+  }
+  bins = MomentRateBins(interval, segmentTags.size());
+}
+
+void MomentRateOutput::accumulateLayer(seissol::initializers::Layer& layer, double time, double timeStepSize) {
+  if (!enabled || layer.getNumberOfCells() == 0) {
+    return;
+  }
+
+  DROutput* drOutput = layer.var(dynRup->drOutput);
+  const std::size_t offset = drOutput - dynRupTree->var(dynRup->drOutput);
+  parallel::forEachCell(layer.getNumberOfCells(), [&](unsigned face) {
+    const std::size_t index = offset + face;
+    if (faceSegments[index] < 0) {
+      return;
+    }
+    double accumulatedSlip = 0.0;
+    for (unsigned k = 0; k < seissol::tensor::squaredNormSlipRateInterpolated::size(); ++k) {
+      accumulatedSlip += drOutput[face].accumulatedSlip[k];
+    }
+    const double moment = momentFactors[index] * accumulatedSlip;
+    faceIncrements[index] = moment - faceMoments[index];
+    faceMoments[index] = moment;
+  });
+
+  std::vector<double> moments(segmentTags.size(), 0.0);
+  for (unsigned face = 0; face < layer.getNumberOfCells(); ++face) {
+    const int segment = faceSegments[offset + face];
+    if (segment >= 0) {
+      moments[segment] += faceIncrements[offset + face];
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(binsMutex);
+  bins.add(time, time + timeStepSize, moments.data());
+}
+
+void MomentRateOutput::finalize() {
+  if (!enabled) {
+    return;
+  }
+#ifdef USE_MPI
+  if (faultMpi.comm() == MPI_COMM_NULL) {
+    return;
+  }
+  // The ranks have stopped accumulating at different times
+  unsigned long numberOfBins = bins.numberOfBins();
+  MPI_Allreduce(MPI_IN_PLACE, &numberOfBins, 1, MPI_UNSIGNED_LONG, MPI_MAX, faultMpi.comm());
+  bins.resize(numberOfBins);
+
+  MomentRateBins reduced(bins.interval(), bins.numberOfSegments());
+  reduced.resize(numberOfBins);
+  MPI_Reduce(bins.moments().data(),
+             reduced.moments().data(),
+             static_cast<int>(bins.moments().size()),
+             MPI_DOUBLE,
+             MPI_SUM,
+             0,
+             faultMpi.comm());
+  if (faultMpi.rank() == 0) {
+    write(reduced);
+  }
+  faultMpi.finalize();
+#else
+  if (dynRupTree->getNumberOfCells() > 0) {
+    write(bins);
+  }
+#endif // USE_MPI
+  enabled = false;
+}
+
+void MomentRateOutput::write(const MomentRateBins& reduced) {
+  std::ofstream out(outputFileName);
+  out << "time";
+  for (const int tag : segmentTags) {
+    out << ",moment_rate_" << tag;
+  }
+  out << ",moment_rate" << std::endl;
+  out << std::setprecision(std::numeric_limits<double>::max_digits10);
+
+  double seismicMoment = 0.0;
+  for (std::size_t bin = 0; bin < reduced.numberOfBins(); ++bin) {
+    // The rates are the means over the intervals
+    out << (bin + 0.5) * reduced.interval();
+    double momentRate = 0.0;
+    for (std::size_t segment = 0; segment < reduced.numberOfSegments(); ++segment) {
+      out << "," << reduced.momentRate(bin, segment);
+      momentRate += reduced.momentRate(bin, segment);
+    }
+    out << "," << momentRate << std::endl;
+    seismicMoment += momentRate * reduced.interval();
+  }
+
+  // The first fault rank is not necessarily the first rank
+  logInfo(0) << "Seismic moment of the fault:" << seismicMoment << "Nm, Mw:"
+             << 2.0 / 3.0 * (std::log10(std::max(seismicMoment, std::numeric_limits<double>::min())) - 9.1);
+}
+
+} // namespace seissol::writer
@@ -0,0 +1,71 @@
+#ifndef SEISSOL_RESULTWRITER_MOMENTRATEOUTPUT_H
+#define SEISSOL_RESULTWRITER_MOMENTRATEOUTPUT_H
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <Geometry/MeshReader.h>
+#include <Initializer/DynamicRupture.h>
+#include <Initializer/tree/Layer.hpp>
+#include <Initializer/tree/LTSTree.hpp>
+#include <Parallel/FaultMPI.h>
+#include <ResultWriter/MomentRateBins.h>
+
+namespace seissol::writer {
+
+/**
+ * Moment rate function of each fault segment (fault tag), computed from the accumulated slip of the
+ * dynamic rupture faces after each time step (SEISSOL_MOMENT_RATE_INTERVAL > 0).
+ * The moment rates are reduced over the fault ranks and written by the first fault rank at the end
+ * of the simulation, such that no fault output is required to compute them.
+ **/
+class MomentRateOutput {
+  public:
+  void init(seissol::initializers::DynamicRupture* newDynRup,
+            seissol::initializers::LTSTree* newDynRupTree,
+            const MeshReader& meshReader,
+            const std::string& outputFileNamePrefix);
+
+  bool isEnabled() const { return enabled; }
+
+  /**
+   * Adds the moment released by the faces of a layer in the time step [time, time + timeStepSize].
+   * Called by the time clusters after the friction law; thread-safe for different layers.
+   **/
+  void accumulateLayer(seissol::initializers::Layer& layer, double time, double timeStepSize);
+
+  /**
+   * Reduces the moment rates and writes them. Collective over all ranks.
+   **/
+  void finalize();
+
+  private:
+  void write(const MomentRateBins& reduced);
+
+  bool enabled = false;
+  std::string outputFileName;
+
+  seissol::initializers::DynamicRupture* dynRup = nullptr;
+  seissol::initializers::LTSTree* dynRupTree = nullptr;
+
+  //! Fault tag of each segment
+  std::vector<int> segmentTags;
+  //! Segment of each face of the tree, -1 if its plus side is on another rank
+  std::vector<int> faceSegments;
+  //! Area times shear modulus divided by the number of points, per face
+  std::vector<double> momentFactors;
+  //! Moment of each face at the end of its last time step
+  std::vector<double> faceMoments;
+  //! Moment released by each face in its last time step
+  std::vector<double> faceIncrements;
+
+  std::mutex binsMutex;
+  MomentRateBins bins;
+
+  FaultMPI faultMpi;
+};
+
+} // namespace seissol::writer
+
+#endif // SEISSOL_RESULTWRITER_MOMENTRATEOUTPUT_H
@@ -0,0 +1,92 @@
+#include "OutputBandwidth.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Parallel/MPI.h"
+#include "utils/logger.h"
+
+seissol::writer::OutputBandwidth seissol::writer::OutputBandwidth::bandwidth;
+
+void seissol::writer::OutputBandwidth::recordSync(double waitTime) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_lastSync = std::chrono::steady_clock::now();
+  if (m_numSyncs == 0) {
+    m_firstSync = m_lastSync;
+  }
+  ++m_numSyncs;
+  m_waitTime += waitTime;
+}
+
+void seissol::writer::OutputBandwidth::recordWrite(std::size_t bytes, double time) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  ++m_numWrites;
+  m_writtenBytes += bytes;
+  m_writeTime += time;
+}
+
+unsigned int seissol::writer::OutputBandwidth::recommendedExecutors(double requiredBandwidth,
+                                                                    double executorBandwidth,
+                                                                    double headroom) {
+  if (requiredBandwidth <= 0.0 || executorBandwidth <= 0.0) {
+    return 1;
+  }
+  return std::max(1u, static_cast<unsigned int>(std::ceil(headroom * requiredBandwidth / executorBandwidth)));
+}
+
+void seissol::writer::OutputBandwidth::report(bool executorRank) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  const double span = std::chrono::duration<double>(m_lastSync - m_firstSync).count();
+  // Bytes, write time, executors, dedicated I/O ranks, compute ranks and wait time
+  double sums[6] = {static_cast<double>(m_writtenBytes),
+                    m_writeTime,
+                    m_numWrites > 0 ? 1.0 : 0.0,
+                    executorRank ? 1.0 : 0.0,
+                    executorRank ? 0.0 : 1.0,
+                    m_waitTime};
+  double maxima[2] = {span, m_waitTime};
+#ifdef USE_MPI
+  MPI_Allreduce(MPI_IN_PLACE, sums, 6, MPI_DOUBLE, MPI_SUM, seissol::MPI::mpi.comm());
+  MPI_Allreduce(MPI_IN_PLACE, maxima, 2, MPI_DOUBLE, MPI_MAX, seissol::MPI::mpi.comm());
+#endif // USE_MPI
+
+  const double bytes = sums[0];
+  if (bytes == 0.0 || sums[1] <= 0.0) {
+    return;
+  }
+  const auto executors = static_cast<unsigned int>(sums[2]);
+  const auto dedicatedRanks = static_cast<unsigned int>(sums[3]);
+  const auto computeRanks = static_cast<unsigned int>(sums[4]);
+  const double executorBandwidth = bytes / sums[1];
+
+  constexpr double MiB = 1024.0 * 1024.0;
+  const int rank = seissol::MPI::mpi.rank();
+  logInfo(rank) << "Output:" << bytes / (1024.0 * MiB) << "GiB written by" << executors
+                << "I/O ranks or threads with" << executorBandwidth / MiB << "MiB/s each.";
+  logInfo(rank) << "Compute ranks waited up to" << maxima[1] << "s (mean" << sums[5] / std::max(computeRanks, 1u)
+                << "s) for the output.";
+  if (maxima[0] <= 0.0) {
+    return;
+  }
+
+  // The writes should take at most half of the time between two synchronization points
+  constexpr double Headroom = 2.0;
+  const double requiredBandwidth = bytes / maxima[0];
+  const unsigned int recommended = recommendedExecutors(requiredBandwidth, executorBandwidth, Headroom);
+  const unsigned int groupSize = (computeRanks + recommended - 1) / recommended;
+  logInfo(rank) << "Required output bandwidth:" << requiredBandwidth / MiB
+                << "MiB/s; recommended number of I/O ranks or threads:" << recommended;
+  if (recommended > computeRanks) {
+    logWarning(rank) << "The output needs more I/O ranks or threads than there are compute ranks; consider larger "
+                        "output intervals or fewer output variables.";
+  } else if (dedicatedRanks > 0) {
+    if (recommended != dedicatedRanks) {
+      logInfo(rank) << "Recommended: ASYNC_GROUP_SIZE=" << utils::nospace << groupSize << " (" << recommended
+                    << " dedicated I/O ranks instead of " << dedicatedRanks << ")";
+    }
+  } else if (recommended < computeRanks) {
+    logInfo(rank) << "Recommended: ASYNC_MODE=MPI with ASYNC_GROUP_SIZE=" << utils::nospace << groupSize << " ("
+                  << recommended << " dedicated I/O ranks instead of an I/O thread on each rank)";
+  }
+}
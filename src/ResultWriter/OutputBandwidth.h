@@ -0,0 +1,54 @@
+#ifndef SEISSOL_RESULTWRITER_OUTPUTBANDWIDTH_H
+#define SEISSOL_RESULTWRITER_OUTPUTBANDWIDTH_H
+
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+
+namespace seissol::writer {
+/**
+ * Measures the output volume and the bandwidth of the asynchronous I/O to size its resources.
+ *
+ * The writers record how long the compute ranks wait for the previous output at each synchronization
+ * point; the executors record the bytes they write and the time it takes (on the I/O ranks or threads).
+ * At the end, the required bandwidth (bytes per time of the time loop) is compared with the bandwidth
+ * achieved per I/O rank or thread to recommend their number, assuming the bandwidth scales with it.
+ **/
+class OutputBandwidth {
+  public:
+  //! Compute side: the writer waited waitTime seconds for its previous output
+  void recordSync(double waitTime);
+
+  //! Executor side: bytes were written in time seconds
+  void recordWrite(std::size_t bytes, double time);
+
+  /**
+   * Logs the statistics and the recommended number of I/O ranks or threads. Collective over MPI::mpi.comm().
+   *
+   * @param executorRank true for dedicated I/O ranks (ASYNC_MODE=MPI)
+   **/
+  void report(bool executorRank);
+
+  /**
+   * @return Number of I/O ranks or threads which write requiredBandwidth with executorBandwidth each,
+   *  using at most 1/headroom of the time
+   **/
+  static unsigned int recommendedExecutors(double requiredBandwidth, double executorBandwidth, double headroom);
+
+  static OutputBandwidth bandwidth;
+
+  private:
+  std::mutex m_mutex;
+
+  unsigned long m_numSyncs = 0;
+  double m_waitTime = 0.0;
+  std::chrono::steady_clock::time_point m_firstSync;
+  std::chrono::steady_clock::time_point m_lastSync;
+
+  unsigned long m_numWrites = 0;
+  std::size_t m_writtenBytes = 0;
+  double m_writeTime = 0.0;
+};
+} // namespace seissol::writer
+
+#endif // SEISSOL_RESULTWRITER_OUTPUTBANDWIDTH_H
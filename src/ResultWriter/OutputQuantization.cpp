@@ -0,0 +1,86 @@
+#include "OutputQuantization.h"
+
+#include <regex>
+#include <sstream>
+#include <stdexcept>
+
+#include "utils/env.h"
+#include "utils/logger.h"
+
+std::vector<std::pair<std::string, seissol::writer::ErrorBound>>
+    seissol::writer::parseErrorBounds(std::string const& specification) {
+  std::vector<std::pair<std::string, ErrorBound>> bounds;
+  std::istringstream stream(specification);
+  std::string entry;
+  while (std::getline(stream, entry, ',')) {
+    if (entry.empty()) {
+      continue;
+    }
+    auto const colon = entry.find(':');
+    auto const equal = entry.find('=', colon);
+    if (colon == std::string::npos || equal == std::string::npos) {
+      throw std::runtime_error("Expected <variable>:abs=<bound> or <variable>:rel=<bound>, got " + entry);
+    }
+    std::string const type = entry.substr(colon + 1, equal - colon - 1);
+    ErrorBound bound;
+    if (type == "abs") {
+      bound.type = ErrorBound::Type::Absolute;
+    } else if (type == "rel") {
+      bound.type = ErrorBound::Type::Relative;
+    } else {
+      throw std::runtime_error("Unknown error bound type " + type + " in " + entry);
+    }
+    std::size_t parsed = 0;
+    try {
+      bound.value = std::stod(entry.substr(equal + 1), &parsed);
+    } catch (std::exception const&) {
+      parsed = 0;
+    }
+    if (parsed != entry.size() - equal - 1 || !(bound.value > 0.0)) {
+      throw std::runtime_error("Invalid error bound in " + entry);
+    }
+    bounds.emplace_back(entry.substr(0, colon), bound);
+  }
+  return bounds;
+}
+
+seissol::writer::ErrorBound
+    seissol::writer::findErrorBound(std::vector<std::pair<std::string, ErrorBound>> const& bounds,
+                                    std::string const& variable) {
+  static std::regex const modalSuffix("_m[0-9]+$");
+  std::string const base = std::regex_replace(variable, modalSuffix, "");
+  for (auto const& name : {variable, base, std::string("*")}) {
+    for (auto const& bound : bounds) {
+      if (bound.first == name) {
+        return bound.second;
+      }
+    }
+  }
+  return ErrorBound();
+}
+
+void seissol::writer::OutputQuantizer::init(std::vector<char const*> const& variables) {
+  static std::string const specification = utils::Env::get("SEISSOL_OUTPUT_QUANTIZATION", "");
+  std::vector<std::pair<std::string, ErrorBound>> bounds;
+  try {
+    bounds = parseErrorBounds(specification);
+  } catch (std::runtime_error const& error) {
+    logError() << "SEISSOL_OUTPUT_QUANTIZATION:" << error.what();
+  }
+
+  m_bounds.clear();
+  for (auto const* variable : variables) {
+    m_bounds.push_back(findErrorBound(bounds, variable));
+  }
+  m_buffers.assign(variables.size(), std::vector<real>());
+}
+
+real const* seissol::writer::OutputQuantizer::apply(unsigned variable, real const* data, std::size_t size) {
+  if (variable >= m_bounds.size() || m_bounds[variable].type == ErrorBound::Type::None) {
+    return data;
+  }
+  auto& buffer = m_buffers[variable];
+  buffer.resize(size);
+  quantize(data, buffer.data(), size, m_bounds[variable]);
+  return buffer.data();
+}
@@ -0,0 +1,98 @@
+#ifndef SEISSOL_RESULTWRITER_OUTPUTQUANTIZATION_H
+#define SEISSOL_RESULTWRITER_OUTPUTQUANTIZATION_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <Kernels/precision.hpp>
+
+namespace seissol::writer {
+struct ErrorBound {
+  enum class Type { None, Absolute, Relative };
+  Type type = Type::None;
+  double value = 0.0;
+};
+
+/**
+ * Parses a comma-separated list of <variable>:abs=<bound> and <variable>:rel=<bound>, e.g.
+ * "u:abs=1e-6,v:abs=1e-6,*:rel=1e-3", where * matches all variables; throws std::runtime_error.
+ **/
+std::vector<std::pair<std::string, ErrorBound>> parseErrorBounds(std::string const& specification);
+
+/**
+ * Returns the bound of the variable: an exact match, the match of the variable without
+ * the suffix of the modal output (u_m3 -> u) or the match of *.
+ **/
+ErrorBound findErrorBound(std::vector<std::pair<std::string, ErrorBound>> const& bounds,
+                          std::string const& variable);
+
+/**
+ * Error-bounded quantization, which makes the output highly compressible (e.g. with h5repack or a
+ * compressing file system). Absolute bounds round to multiples of 2 * bound, relative bounds round
+ * the mantissa to the number of bits required for the bound. Non-finite values are kept.
+ **/
+template <typename T>
+void quantize(T const* in, T* out, std::size_t size, ErrorBound bound) {
+  static_assert(std::is_floating_point_v<T>, "Only floating point values can be quantized.");
+  using Bits = std::conditional_t<sizeof(T) == 8, uint64_t, uint32_t>;
+  static_assert(sizeof(Bits) == sizeof(T), "Unsupported floating point type.");
+
+  if (bound.type == ErrorBound::Type::Absolute) {
+    T const step = static_cast<T>(2.0 * bound.value);
+    for (std::size_t i = 0; i < size; ++i) {
+      out[i] = std::isfinite(in[i]) ? std::round(in[i] / step) * step : in[i];
+    }
+  } else if (bound.type == ErrorBound::Type::Relative) {
+    // rounding to keep explicit mantissa bits gives a relative error of at most 2^-(keep+1)
+    int const mantissaBits = std::numeric_limits<T>::digits - 1;
+    int const keep = std::max(0, static_cast<int>(std::ceil(-std::log2(bound.value))) - 1);
+    int const drop = mantissaBits - keep;
+    if (drop <= 0) {
+      std::memmove(out, in, size * sizeof(T));
+      return;
+    }
+    Bits const half = Bits(1) << (drop - 1);
+    Bits const mask = ~((Bits(1) << drop) - 1);
+    for (std::size_t i = 0; i < size; ++i) {
+      if (!std::isfinite(in[i])) {
+        out[i] = in[i];
+        continue;
+      }
+      Bits bits;
+      std::memcpy(&bits, &in[i], sizeof(T));
+      bits = (bits + half) & mask;
+      std::memcpy(&out[i], &bits, sizeof(T));
+    }
+  } else {
+    std::memmove(out, in, size * sizeof(T));
+  }
+}
+
+/**
+ * Rounds the variables of an output writer to the error bounds given in SEISSOL_OUTPUT_QUANTIZATION, such that the
+ * files compress well afterwards (no compression filter is set by SeisSol);
+ * runs in the executor, i.e. on the dedicated I/O ranks or threads with asynchronous output.
+ **/
+class OutputQuantizer {
+  public:
+  //! Selects the bounds of the variables; aborts if the environment variable cannot be parsed.
+  void init(std::vector<char const*> const& variables);
+
+  //! Returns data or its quantized copy (valid until the next call for this variable).
+  real const* apply(unsigned variable, real const* data, std::size_t size);
+
+  private:
+  std::vector<ErrorBound> m_bounds;
+  std::vector<std::vector<real>> m_buffers;
+};
+} // namespace seissol::writer
+
+#endif // SEISSOL_RESULTWRITER_OUTPUTQUANTIZATION_H
@@ -0,0 +1,106 @@
+#include "OutputQueue.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include "Parallel/MPI.h"
+#include "utils/env.h"
+#include "utils/logger.h"
+
+seissol::writer::OutputQueue seissol::writer::OutputQueue::queue;
+
+seissol::writer::OutputQueue::~OutputQueue() {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stop = true;
+  }
+  m_changed.notify_all();
+  if (m_thread.joinable()) {
+    m_thread.join();
+  }
+}
+
+bool seissol::writer::OutputQueue::enabled() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (!m_initialized) {
+    m_maxSnapshots = utils::Env::get<unsigned int>("SEISSOL_OUTPUT_SNAPSHOTS", 0);
+    m_initialized = true;
+    if (m_maxSnapshots > 0) {
+      logInfo(seissol::MPI::mpi.rank())
+          << "Writing up to" << m_maxSnapshots << "output snapshots in the background.";
+    }
+  }
+  return m_maxSnapshots > 0;
+}
+
+void seissol::writer::OutputQueue::submit(Task task) {
+  if (!enabled()) {
+    task();
+    return;
+  }
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+  if (!m_thread.joinable()) {
+    m_stop = false;
+    m_thread = std::thread(&OutputQueue::run, this);
+  }
+  if (m_inFlight >= m_maxSnapshots) {
+    // The memory budget is exhausted: wait for the file system
+    auto const start = std::chrono::steady_clock::now();
+    m_changed.wait(lock, [this]() { return m_inFlight < m_maxSnapshots; });
+    m_stallTime += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    ++m_numStalls;
+  }
+  m_tasks.push_back(std::move(task));
+  ++m_inFlight;
+  ++m_numSnapshots;
+  m_maxInFlight = std::max(m_maxInFlight, m_inFlight);
+  m_changed.notify_all();
+}
+
+void seissol::writer::OutputQueue::drain() {
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_changed.wait(lock, [this]() { return m_inFlight == 0; });
+}
+
+void seissol::writer::OutputQueue::finalize() {
+  drain();
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stop = true;
+  }
+  m_changed.notify_all();
+  if (m_thread.joinable()) {
+    m_thread.join();
+  }
+
+  if (m_numSnapshots > 0) {
+    logInfo(seissol::MPI::mpi.rank())
+        << "Wrote" << m_numSnapshots << "output snapshots in the background, at most" << m_maxInFlight
+        << "in flight. Waited" << m_numStalls << "times for a free snapshot (" << utils::nospace
+        << m_stallTime << " s).";
+  }
+}
+
+void seissol::writer::OutputQueue::run() {
+  while (true) {
+    Task task;
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_changed.wait(lock, [this]() { return m_stop || !m_tasks.empty(); });
+      if (m_tasks.empty()) {
+        return;
+      }
+      task = std::move(m_tasks.front());
+      m_tasks.pop_front();
+    }
+
+    task();
+
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      --m_inFlight;
+    }
+    m_changed.notify_all();
+  }
+}
@@ -0,0 +1,88 @@
+#ifndef SEISSOL_RESULTWRITER_OUTPUTQUEUE_H
+#define SEISSOL_RESULTWRITER_OUTPUTQUEUE_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace seissol::writer {
+/**
+ * Writes snapshots of the output in a background thread, such that the executors return as soon
+ * as the data is copied and compute ranks do not wait for slow file systems.
+ *
+ * The number of snapshots in flight is limited by SEISSOL_OUTPUT_SNAPSHOTS (0, the default,
+ * writes synchronously). All writers share one thread, which keeps the order of the collective
+ * I/O operations the same on all ranks.
+ **/
+class OutputQueue {
+  public:
+  using Task = std::function<void()>;
+
+  ~OutputQueue();
+
+  //! True if snapshots are written in the background
+  bool enabled();
+
+  /**
+   * Adds a snapshot. Blocks while the maximum number of snapshots is in flight;
+   * the task must own the copy of its data.
+   **/
+  void submit(Task task);
+
+  /**
+   * Calls write(data, sizes) directly or, in the background, with a copy of the data,
+   * as the buffers of the executors are reused for the next snapshot.
+   **/
+  template <typename T, typename Write>
+  void submitSnapshot(std::vector<T const*> const& data, std::vector<std::size_t> const& sizes, Write write) {
+    if (!enabled()) {
+      write(data, sizes);
+      return;
+    }
+    std::vector<std::vector<T>> snapshot(data.size());
+    for (std::size_t i = 0; i < data.size(); ++i) {
+      snapshot[i].assign(data[i], data[i] + sizes[i]);
+    }
+    submit([write, sizes, snapshot = std::move(snapshot)]() {
+      std::vector<T const*> snapshotData;
+      for (auto const& values : snapshot) {
+        snapshotData.push_back(values.data());
+      }
+      write(snapshotData, sizes);
+    });
+  }
+
+  //! Waits until all submitted snapshots are written
+  void drain();
+
+  //! Drains the queue, prints the statistics and stops the thread
+  void finalize();
+
+  static OutputQueue queue;
+
+  private:
+  void run();
+
+  std::mutex m_mutex;
+  std::condition_variable m_changed;
+  std::deque<Task> m_tasks;
+  std::thread m_thread;
+  bool m_stop = false;
+  //! Submitted, but not yet completely written snapshots
+  std::size_t m_inFlight = 0;
+  std::size_t m_maxSnapshots = 0;
+  bool m_initialized = false;
+
+  // Back-pressure statistics
+  std::size_t m_numSnapshots = 0;
+  std::size_t m_numStalls = 0;
+  double m_stallTime = 0.0;
+  std::size_t m_maxInFlight = 0;
+};
+} // namespace seissol::writer
+
+#endif // SEISSOL_RESULTWRITER_OUTPUTQUEUE_H
@@ -0,0 +1,68 @@
+#include "OutputRegions.h"
+
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+seissol::writer::OutputRegion seissol::writer::parseOutputRegionLine(const std::string& line) {
+  std::istringstream stream(line);
+  OutputRegion region;
+  std::string variables;
+  stream >> region.name >> region.interval >> region.refinement;
+  for (auto& bound : region.bounds) {
+    stream >> bound;
+  }
+  stream >> variables;
+  if (stream.fail()) {
+    throw std::runtime_error("Incomplete output region in line " + line + ".");
+  }
+  std::string rest;
+  if (stream >> rest) {
+    throw std::runtime_error("Too many entries in output region line " + line + ".");
+  }
+
+  if (region.interval <= 0.0) {
+    throw std::runtime_error("The interval of output region " + region.name + " must be positive.");
+  }
+  for (unsigned i = 0; i < 3; ++i) {
+    if (region.bounds[2 * i + 1] <= region.bounds[2 * i]) {
+      throw std::runtime_error("The bounds of output region " + region.name + " are empty.");
+    }
+  }
+
+  std::istringstream variableStream(variables);
+  std::string variable;
+  while (std::getline(variableStream, variable, ',')) {
+    if (variable.empty()) {
+      throw std::runtime_error("Empty variable name in output region " + region.name + ".");
+    }
+    region.variables.push_back(variable);
+  }
+  return region;
+}
+
+std::vector<seissol::writer::OutputRegion>
+    seissol::writer::parseOutputRegionFile(const std::string& fileName) {
+  std::ifstream file{fileName};
+  if (!file) {
+    throw std::runtime_error("Could not open the output region file " + fileName + ".");
+  }
+  std::vector<OutputRegion> regions;
+  std::string line;
+  while (std::getline(file, line)) {
+    auto const first = std::find_if(line.begin(), line.end(), [](auto& c) { return !std::isspace(c); });
+    if (first != line.end() && *first != '#') {
+      regions.emplace_back(parseOutputRegionLine(line));
+    }
+  }
+  for (unsigned i = 0; i < regions.size(); ++i) {
+    for (unsigned j = 0; j < i; ++j) {
+      if (regions[i].name == regions[j].name) {
+        throw std::runtime_error("Output region " + regions[i].name + " is defined twice.");
+      }
+    }
+  }
+  return regions;
+}
@@ -0,0 +1,35 @@
+#ifndef SEISSOL_RESULTWRITER_OUTPUTREGIONS_H
+#define SEISSOL_RESULTWRITER_OUTPUTREGIONS_H
+
+#include <array>
+#include <string>
+#include <vector>
+
+namespace seissol::writer {
+//! Maximum number of output regions besides the global wave field output
+constexpr unsigned MaxOutputRegions = 4;
+
+/**
+ * A wave field output group with its own region, variables, refinement and interval.
+ **/
+struct OutputRegion {
+  std::string name;
+  double interval = 0.0;
+  int refinement = 0;
+  //! xMin, xMax, yMin, yMax, zMin, zMax
+  std::array<double, 6> bounds{};
+  std::vector<std::string> variables;
+};
+
+/**
+ * Parses a line "<name> <interval> <refinement> <xMin> <xMax> <yMin> <yMax> <zMin> <zMax> <variables>",
+ * where the variables are a comma-separated list of output variable names (e.g. u,v,w);
+ * throws std::runtime_error.
+ **/
+OutputRegion parseOutputRegionLine(const std::string& line);
+
+//! Parses all lines of the file which are neither empty nor start with #.
+std::vector<OutputRegion> parseOutputRegionFile(const std::string& fileName);
+} // namespace seissol::writer
+
+#endif // SEISSOL_RESULTWRITER_OUTPUTREGIONS_H
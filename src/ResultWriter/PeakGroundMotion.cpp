@@ -0,0 +1,201 @@
+#include "PeakGroundMotion.h"
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+std::vector<double> seissol::writer::parseSpectralPeriods(const std::string& specification) {
+  std::vector<double> periods;
+  std::istringstream stream(specification);
+  std::string entry;
+  while (std::getline(stream, entry, ',')) {
+    std::size_t end = 0;
+    double period = 0.0;
+    try {
+      period = std::stod(entry, &end);
+    } catch (const std::exception&) {
+      throw std::runtime_error("Invalid oscillator period " + entry + ".");
+    }
+    if (end != entry.size() || !(period > 0.0)) {
+      throw std::runtime_error("Invalid oscillator period " + entry + ".");
+    }
+    periods.push_back(period);
+  }
+  return periods;
+}
+
+seissol::writer::PeakGroundMotion::Oscillator
+    seissol::writer::PeakGroundMotion::createOscillator(double period, double interval) {
+  const double xi = Damping;
+  const double omega = 2.0 * M_PI / period;
+  const double omega2 = omega * omega;
+  const double root = std::sqrt(1.0 - xi * xi);
+  const double omegaD = omega * root;
+  const double e = std::exp(-xi * omega * interval);
+  const double s = std::sin(omegaD * interval);
+  const double c = std::cos(omegaD * interval);
+  const double k1 = (2.0 * xi * xi - 1.0) / (omega2 * interval);
+  const double k2 = 2.0 * xi / (omega2 * omega * interval);
+  const double damped = c - xi / root * s;
+  const double derivative = omegaD * s + xi * omega * c;
+
+  Oscillator oscillator;
+  oscillator.omega2 = omega2;
+  oscillator.a11 = e * (xi / root * s + c);
+  oscillator.a12 = e * s / omegaD;
+  oscillator.a21 = -omega / root * e * s;
+  oscillator.a22 = e * damped;
+  oscillator.b11 = e * ((k1 + xi / omega) * s / omegaD + (k2 + 1.0 / omega2) * c) - k2;
+  oscillator.b12 = -e * (k1 * s / omegaD + k2 * c) - 1.0 / omega2 + k2;
+  oscillator.b21 = e * ((k1 + xi / omega) * damped - (k2 + 1.0 / omega2) * derivative) + 1.0 / (omega2 * interval);
+  oscillator.b22 = -e * (k1 * damped - k2 * derivative) - 1.0 / (omega2 * interval);
+  return oscillator;
+}
+
+void seissol::writer::PeakGroundMotion::init(std::size_t numberOfTriangles,
+                                             double interval,
+                                             std::vector<double> periods,
+                                             unsigned numberOfAngles) {
+  m_numberOfTriangles = numberOfTriangles;
+  m_interval = interval;
+  m_periods = std::move(periods);
+  m_numberOfSamples = 0;
+
+  m_oscillators.clear();
+  for (auto period : m_periods) {
+    m_oscillators.push_back(createOscillator(period, interval));
+  }
+
+  m_cosAngles.resize(numberOfAngles);
+  m_sinAngles.resize(numberOfAngles);
+  for (unsigned angle = 0; angle < numberOfAngles; ++angle) {
+    m_cosAngles[angle] = std::cos(M_PI * angle / numberOfAngles);
+    m_sinAngles[angle] = std::sin(M_PI * angle / numberOfAngles);
+  }
+  const std::size_t numberOfRotated = numberOfAngles > 0 ? 2 + m_periods.size() : 0;
+  m_directionalPeaks.assign(numberOfTriangles * numberOfRotated * numberOfAngles, 0.0);
+
+  m_peaks.assign(3 + m_periods.size() + numberOfRotated, std::vector<real>(numberOfTriangles, 0.0));
+  for (unsigned component = 0; component < 2; ++component) {
+    m_velocity[component].assign(numberOfTriangles, 0.0);
+    m_acceleration[component].assign(numberOfTriangles, 0.0);
+  }
+  m_state.assign(numberOfTriangles * m_periods.size() * 2 * 2, 0.0);
+}
+
+void seissol::writer::PeakGroundMotion::update(real const* const* velocities, real const* const* displacements) {
+  const bool hasAcceleration = m_numberOfSamples > 0;
+  const std::size_t numberOfPeriods = m_periods.size();
+  const std::size_t numberOfAngles = m_cosAngles.size();
+  const std::size_t numberOfRotated = numberOfAngles > 0 ? 2 + numberOfPeriods : 0;
+
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+#endif // _OPENMP
+  for (std::size_t triangle = 0; triangle < m_numberOfTriangles; ++triangle) {
+    const double vx = velocities[0][triangle];
+    const double vy = velocities[1][triangle];
+    const double ux = displacements[0][triangle];
+    const double uy = displacements[1][triangle];
+    m_peaks[0][triangle] = std::max<real>(m_peaks[0][triangle], std::hypot(vx, vy));
+    m_peaks[2][triangle] = std::max<real>(m_peaks[2][triangle], std::hypot(ux, uy));
+
+    // Peak of the projection of the horizontal vector (x, y) onto each direction
+    real* directionalPeaks = m_directionalPeaks.data() + triangle * numberOfRotated * numberOfAngles;
+    auto updateDirections = [&](std::size_t variable, double x, double y) {
+      real* peaks = &directionalPeaks[variable * numberOfAngles];
+      for (std::size_t angle = 0; angle < numberOfAngles; ++angle) {
+        const double projection = std::abs(m_cosAngles[angle] * x + m_sinAngles[angle] * y);
+        peaks[angle] = std::max<real>(peaks[angle], projection);
+      }
+    };
+    updateDirections(0, vx, vy);
+
+    if (hasAcceleration) {
+      const double acceleration[2] = {(vx - m_velocity[0][triangle]) / m_interval,
+                                      (vy - m_velocity[1][triangle]) / m_interval};
+      m_peaks[1][triangle] = std::max<real>(m_peaks[1][triangle], std::hypot(acceleration[0], acceleration[1]));
+      updateDirections(1, acceleration[0], acceleration[1]);
+
+      for (std::size_t period = 0; period < numberOfPeriods; ++period) {
+        const auto& oscillator = m_oscillators[period];
+        double response = 0.0;
+        double displacement[2];
+        for (unsigned component = 0; component < 2; ++component) {
+          double* state = &m_state[((triangle * numberOfPeriods + period) * 2 + component) * 2];
+          const double previous = m_acceleration[component][triangle];
+          const double x = oscillator.a11 * state[0] + oscillator.a12 * state[1] +
+                           oscillator.b11 * previous + oscillator.b12 * acceleration[component];
+          const double v = oscillator.a21 * state[0] + oscillator.a22 * state[1] +
+                           oscillator.b21 * previous + oscillator.b22 * acceleration[component];
+          state[0] = x;
+          state[1] = v;
+          response = std::max(response, std::abs(x));
+          displacement[component] = x;
+        }
+        m_peaks[3 + period][triangle] = std::max<real>(m_peaks[3 + period][triangle], oscillator.omega2 * response);
+        // The oscillators are linear, i.e. the response in a direction is the projection of the responses
+        updateDirections(2 + period,
+                         oscillator.omega2 * displacement[0],
+                         oscillator.omega2 * displacement[1]);
+      }
+
+      m_acceleration[0][triangle] = acceleration[0];
+      m_acceleration[1][triangle] = acceleration[1];
+    }
+
+    m_velocity[0][triangle] = vx;
+    m_velocity[1][triangle] = vy;
+  }
+
+  ++m_numberOfSamples;
+}
+
+void seissol::writer::PeakGroundMotion::finalize() {
+  const std::size_t numberOfAngles = m_cosAngles.size();
+  if (numberOfAngles == 0) {
+    return;
+  }
+  const std::size_t numberOfRotated = 2 + m_periods.size();
+  const std::size_t firstRotated = 3 + m_periods.size();
+
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+#endif // _OPENMP
+  for (std::size_t triangle = 0; triangle < m_numberOfTriangles; ++triangle) {
+    std::vector<real> peaks(numberOfAngles);
+    for (std::size_t variable = 0; variable < numberOfRotated; ++variable) {
+      const real* directionalPeaks = &m_directionalPeaks[(triangle * numberOfRotated + variable) * numberOfAngles];
+      std::copy(directionalPeaks, directionalPeaks + numberOfAngles, peaks.begin());
+      // The median is the mean of the two central values for an even number of directions
+      const std::size_t middle = numberOfAngles / 2;
+      std::nth_element(peaks.begin(), peaks.begin() + middle, peaks.end());
+      real median = peaks[middle];
+      if (numberOfAngles % 2 == 0) {
+        median = 0.5 * (median + *std::max_element(peaks.begin(), peaks.begin() + middle));
+      }
+      m_peaks[firstRotated + variable][triangle] = median;
+    }
+  }
+}
+
+std::vector<std::string> seissol::writer::PeakGroundMotion::variableNames() const {
+  std::vector<std::string> names = {"PGV", "PGA", "PGD"};
+  for (auto period : m_periods) {
+    std::ostringstream name;
+    name << "SA_" << period << "s";
+    names.push_back(name.str());
+  }
+  if (!m_cosAngles.empty()) {
+    names.emplace_back("PGV_RotD50");
+    names.emplace_back("PGA_RotD50");
+    for (auto period : m_periods) {
+      std::ostringstream name;
+      name << "SA_RotD50_" << period << "s";
+      names.push_back(name.str());
+    }
+  }
+  return names;
+}
@@ -0,0 +1,91 @@
+#ifndef SEISSOL_RESULTWRITER_PEAKGROUNDMOTION_H
+#define SEISSOL_RESULTWRITER_PEAKGROUNDMOTION_H
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <Kernels/precision.hpp>
+
+namespace seissol::writer {
+/**
+ * Parses a comma-separated list of oscillator periods in seconds, e.g. "0.1,0.5,1,2";
+ * throws std::runtime_error.
+ **/
+std::vector<double> parseSpectralPeriods(const std::string& specification);
+
+/**
+ * Accumulates peak ground motion maps from the free surface output, which is sampled at a
+ * fixed interval: the horizontal (x and y components) peak velocity, acceleration and
+ * displacement and the pseudo-spectral accelerations of damped single-degree-of-freedom
+ * oscillators. The acceleration is the difference quotient of consecutive velocity samples;
+ * the oscillators are integrated exactly for a piecewise linear ground acceleration
+ * (Nigam and Jennings, 1969).
+ *
+ * Optionally, the orientation-independent RotD50 values (Boore, 2010) of the velocity, acceleration and
+ * spectral accelerations are computed as well: the median over the horizontal directions of the peak
+ * of the motion along the direction, with numberOfAngles directions in [0, 180) degrees.
+ **/
+class PeakGroundMotion {
+  public:
+  //! Damping ratio of the oscillators
+  static constexpr double Damping = 0.05;
+
+  void init(std::size_t numberOfTriangles, double interval, std::vector<double> periods, unsigned numberOfAngles = 0);
+
+  /**
+   * Adds the next sample (one interval after the previous one)
+   *
+   * @param velocities The x, y and z components of the velocity per triangle
+   * @param displacements The x, y and z components of the displacement per triangle
+   */
+  void update(real const* const* velocities, real const* const* displacements);
+
+  //! Computes the RotD50 values from the peaks of all directions; called before the peaks are written
+  void finalize();
+
+  //! PGV, PGA, PGD and SA_<period>s for each period, followed by PGV_RotD50, PGA_RotD50 and SA_RotD50_<period>s
+  [[nodiscard]] std::vector<std::string> variableNames() const;
+
+  [[nodiscard]] std::size_t numberOfVariables() const { return m_peaks.size(); }
+
+  [[nodiscard]] real* data(unsigned variable) { return m_peaks[variable].data(); }
+
+  private:
+  struct Oscillator {
+    double omega2;
+    //! Coefficients of the displacement and velocity of the oscillator
+    double a11, a12, a21, a22;
+    //! Coefficients of the ground acceleration at the beginning and end of the interval
+    double b11, b12, b21, b22;
+  };
+
+  static Oscillator createOscillator(double period, double interval);
+
+  std::size_t m_numberOfTriangles = 0;
+  double m_interval = 0.0;
+  std::vector<double> m_periods;
+  std::vector<Oscillator> m_oscillators;
+  std::size_t m_numberOfSamples = 0;
+
+  //! Directions of the RotD50 values
+  std::vector<double> m_cosAngles;
+  std::vector<double> m_sinAngles;
+
+  //! Peak values: PGV, PGA, PGD and the spectral accelerations (and the RotD50 values)
+  std::vector<std::vector<real>> m_peaks;
+
+  //! Peaks per triangle, RotD50 variable (velocity, acceleration and periods) and direction
+  std::vector<real> m_directionalPeaks;
+
+  //! Horizontal velocity and acceleration of the previous sample
+  std::array<std::vector<double>, 2> m_velocity;
+  std::array<std::vector<double>, 2> m_acceleration;
+
+  //! Displacement and velocity of the oscillators per triangle, period and component
+  std::vector<double> m_state;
+};
+} // namespace seissol::writer
+
+#endif // SEISSOL_RESULTWRITER_PEAKGROUNDMOTION_H
@@ -40,13 +40,29 @@
 #include "PostProcessor.h"
 #include "SeisSol.h"
 
-void seissol::writer::PostProcessor::integrateQuantities(const double i_timestep,
-	seissol::initializers::Layer& i_layerData, const unsigned int l_cell,
-	const double * const i_dofs) {
+#include <algorithm>
 
+void seissol::writer::PostProcessor::integrateQuantities(seissol::initializers::Layer& i_layerData,
+	const unsigned int l_cell, const real * const i_timeIntegrated) {
+
+	if (i_layerData.var(m_excludedCells)[l_cell]) {
+		return;
+	}
 	real *integrals = i_layerData.var(m_integrals);
 	for (int i = 0; i < m_numberOfVariables; i++) {
-		integrals[l_cell*m_numberOfVariables+i] += i_dofs[NUMBER_OF_ALIGNED_BASIS_FUNCTIONS*m_integerMap[i]]*i_timestep;
+		integrals[l_cell*m_numberOfVariables+i] += i_timeIntegrated[NUMBER_OF_ALIGNED_BASIS_FUNCTIONS*m_integerMap[i]];
+	}
+}
+
+void seissol::writer::PostProcessor::setIntegrationCells(const unsigned int * const i_ltsIds,
+	unsigned int i_numberOfCells) {
+	if (m_numberOfVariables == 0) {
+		return;
+	}
+	bool *excludedCells = m_ltsTree->var(m_excludedCells);
+	std::fill_n(excludedCells, m_ltsTree->getNumberOfCells(m_excludedCells.mask), true);
+	for (unsigned int i = 0; i < i_numberOfCells; i++) {
+		excludedCells[i_ltsIds[i]] = false;
 	}
 }
 
@@ -74,8 +90,11 @@ void seissol::writer::PostProcessor::getIntegrationMask(bool* transferTo) {
 }
 
 void seissol::writer::PostProcessor::allocateMemory(seissol::initializers::LTSTree* ltsTree) {
+	m_ltsTree = ltsTree;
 	ltsTree->addVar( m_integrals, seissol::initializers::LayerMask(Ghost), PAGESIZE_HEAP,
       seissol::memory::Standard );
+	ltsTree->addVar( m_excludedCells, seissol::initializers::LayerMask(Ghost), 1,
+      seissol::memory::Standard );
 }
 
 const real* seissol::writer::PostProcessor::getIntegrals(seissol::initializers::LTSTree* ltsTree) {
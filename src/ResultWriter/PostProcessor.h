@@ -58,16 +58,29 @@ private:
     int m_numberOfVariables;
     std::vector<int> m_integerMap;
     seissol::initializers::Variable<real> m_integrals;
+    //! Cells outside of the output region, which are not integrated
+    seissol::initializers::Variable<bool> m_excludedCells;
+    seissol::initializers::LTSTree* m_ltsTree;
 public:
-    PostProcessor (): m_numberOfVariables(0), m_integerMap(0L) {
+    PostProcessor (): m_numberOfVariables(0), m_integerMap(0L), m_ltsTree(nullptr) {
         for (size_t i = 0; i < 9; i++) {
             m_integrationMask[i] = false;
         }
     }
     virtual ~PostProcessor () {}
-    void integrateQuantities(const double i_timestep,
-    	seissol::initializers::Layer& i_layerData, const unsigned int l_cell,
-    	const double * const i_dofs);
+    /**
+     * Adds the cell averages of the time integrated degrees of freedom of one time step to the integrals.
+     *
+     * @param i_timeIntegrated time integrated degrees of freedom (tensor I) of the cell.
+     **/
+    void integrateQuantities(seissol::initializers::Layer& i_layerData, const unsigned int l_cell,
+    	const real * const i_timeIntegrated);
+    /**
+     * Restricts the integration to the given cells; all cells are integrated by default.
+     *
+     * @param i_ltsIds ids of the cells in the LTS tree (without ghost cells).
+     **/
+    void setIntegrationCells(const unsigned int * const i_ltsIds, unsigned int i_numberOfCells);
     void setIntegrationMask(const int * const i_integrationMask);
     int getNumberOfVariables();
     void getIntegrationMask(bool* transferTo);
@@ -0,0 +1,105 @@
+#include "ReceiverDatFile.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <regex>
+#include <sstream>
+#include <stdexcept>
+
+void seissol::writer::writeReceiverDatHeader(std::ostream& stream,
+                                             const std::string& title,
+                                             const std::vector<std::string>& variables,
+                                             const std::array<double, 3>& point) {
+  stream << "TITLE = \"" << title << "\"" << std::endl;
+  stream << "VARIABLES = \"Time\"";
+  for (auto const& name : variables) {
+    stream << ",\"" << name << "\"";
+  }
+  stream << std::endl;
+  for (int d = 0; d < 3; ++d) {
+    stream << "# x" << (d + 1) << "       " << std::scientific << std::setprecision(12) << point[d] << std::endl;
+  }
+}
+
+seissol::writer::ReceiverDatFile seissol::writer::readReceiverDatFile(const std::string& fileName) {
+  std::ifstream file(fileName);
+  if (!file) {
+    throw std::runtime_error("Could not open the receiver file " + fileName + ".");
+  }
+
+  ReceiverDatFile receiver;
+  bool hasVariables = false;
+  std::string line;
+  std::vector<double> row;
+  while (std::getline(file, line)) {
+    const auto first = line.find_first_not_of(" \t\r");
+    if (first == std::string::npos) {
+      continue;
+    }
+    if (line.compare(first, 5, "TITLE") == 0) {
+      const auto begin = line.find('"');
+      const auto end = line.rfind('"');
+      if (begin != std::string::npos && end > begin) {
+        receiver.title = line.substr(begin + 1, end - begin - 1);
+      }
+    } else if (line.compare(first, 9, "VARIABLES") == 0) {
+      const std::regex name("\"\\s*([^\"]*?)\\s*\"");
+      for (auto it = std::sregex_iterator(line.begin(), line.end(), name); it != std::sregex_iterator(); ++it) {
+        receiver.variables.push_back((*it)[1]);
+      }
+      if (receiver.variables.empty() || receiver.variables.front() != "Time") {
+        throw std::runtime_error("The first variable of the receiver file " + fileName + " is not the time.");
+      }
+      receiver.variables.erase(receiver.variables.begin());
+      hasVariables = true;
+    } else if (line[first] == '#') {
+      std::istringstream stream(line.substr(first + 1));
+      std::string key;
+      double value = 0.0;
+      if (!(stream >> key >> value)) {
+        throw std::runtime_error("Invalid header line " + line + " in the receiver file " + fileName + ".");
+      }
+      if (key == "x1" || key == "x2" || key == "x3") {
+        receiver.point[key[1] - '1'] = value;
+      } else {
+        receiver.parameters.emplace_back(key, value);
+      }
+    } else {
+      if (!hasVariables) {
+        throw std::runtime_error("The receiver file " + fileName + " has samples before the variable names.");
+      }
+      std::istringstream stream(line);
+      row.clear();
+      double value = 0.0;
+      while (stream >> value) {
+        row.push_back(value);
+      }
+      if (!stream.eof() || row.size() != receiver.variables.size() + 1) {
+        throw std::runtime_error("Invalid sample " + line + " in the receiver file " + fileName + ".");
+      }
+      // A restart from a checkpoint writes the samples after the checkpoint again
+      if (!receiver.times.empty() && row[0] <= receiver.times.back()) {
+        const auto samples = std::lower_bound(receiver.times.begin(), receiver.times.end(), row[0]) -
+                             receiver.times.begin();
+        receiver.times.resize(samples);
+        receiver.values.resize(samples * receiver.variables.size());
+      }
+      receiver.times.push_back(row[0]);
+      receiver.values.insert(receiver.values.end(), row.begin() + 1, row.end());
+    }
+  }
+  if (!hasVariables) {
+    throw std::runtime_error("The receiver file " + fileName + " has no variable names.");
+  }
+  return receiver;
+}
+
+unsigned seissol::writer::receiverNumberFromFileName(const std::string& fileName) {
+  const std::regex pattern("-(fault)?receiver-(\\d+)(-\\d+)?\\.dat$");
+  std::smatch match;
+  if (!std::regex_search(fileName, match, pattern)) {
+    throw std::runtime_error("The file name " + fileName + " is not the one of a receiver.");
+  }
+  return std::stoul(match[2]);
+}
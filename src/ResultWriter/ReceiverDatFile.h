@@ -0,0 +1,59 @@
+#ifndef SEISSOL_RESULTWRITER_RECEIVERDATFILE_H
+#define SEISSOL_RESULTWRITER_RECEIVERDATFILE_H
+
+#include <array>
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace seissol::writer {
+/**
+ * A receiver or fault receiver time series in the ASCII format of SeisSol:
+ *
+ *   TITLE = "Temporal Signal for receiver number 00001"
+ *   VARIABLES = "Time","xx",...
+ *   # x1   <x>
+ *   # x2   <y>
+ *   # x3   <z>
+ *   # <name> <value>        (further header values, e.g. the initial stress of fault receivers)
+ *   <time> <variable 1> ...  (one line per sample)
+ *
+ * This file does not depend on the rest of SeisSol, such that postprocessing tools can read the receivers
+ * with the same code that writes them.
+ **/
+struct ReceiverDatFile {
+  std::string title;
+  //! Names of the variables without the time
+  std::vector<std::string> variables;
+  std::array<double, 3> point{};
+  //! Header values besides the coordinates
+  std::vector<std::pair<std::string, double>> parameters;
+  std::vector<double> times;
+  //! Samples [time][variable]
+  std::vector<double> values;
+
+  [[nodiscard]] std::size_t numberOfSamples() const { return times.size(); }
+};
+
+//! Writes the header of a receiver file (everything before the samples)
+void writeReceiverDatHeader(std::ostream& stream,
+                            const std::string& title,
+                            const std::vector<std::string>& variables,
+                            const std::array<double, 3>& point);
+
+/**
+ * Reads a receiver or fault receiver file; throws std::runtime_error.
+ * Samples which are contained twice (e.g. after a restart from a checkpoint) are only kept once.
+ **/
+ReceiverDatFile readReceiverDatFile(const std::string& fileName);
+
+/**
+ * The receiver number in a file name <prefix>-receiver-<number>[-<rank>].dat or
+ * <prefix>-faultreceiver-<number>[-<rank>].dat; throws std::runtime_error.
+ **/
+unsigned receiverNumberFromFileName(const std::string& fileName);
+} // namespace seissol::writer
+
+#endif // SEISSOL_RESULTWRITER_RECEIVERDATFILE_H
@@ -38,8 +38,13 @@
  **/
 
 #include "ReceiverWriter.h"
+#include "ReceiverDatFile.h"
+#include "OutputBandwidth.h"
 
+#include <algorithm>
+#include <cassert>
 #include <cctype>
+#include <cmath>
 #include <iterator>
 #include <sstream>
 #include <iomanip>
@@ -47,26 +52,40 @@
 #include <sys/stat.h>
 #include <Parallel/MPI.h>
 #include <Modules/Modules.h>
+#include <SeisSol.h>
+#include "utils/env.h"
+#include <Reader/ParallelIStream.h>
 
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
 #include <sstream>
 #include <string>
 #include <fstream>
-#include <regex>
 
 Eigen::Vector3d seissol::writer::parseReceiverLine(const std::string& line) {
-  std::regex rgx("\\s+");
-  std::sregex_token_iterator iter(line.begin(),
-                                  line.end(),
-                                  rgx,
-                                  -1);
-  std::sregex_token_iterator end;
+  // Coordinates are separated by whitespace or commas
+  auto isSeparator = [](char c) { return std::isspace(static_cast<unsigned char>(c)) || c == ','; };
   Eigen::Vector3d coordinates{};
   unsigned numberOfCoordinates = 0;
-  for (; iter != end; ++iter, ++numberOfCoordinates) {
+  const char* current = line.c_str();
+  while (true) {
+    while (*current != '\0' && isSeparator(*current)) {
+      ++current;
+    }
+    if (*current == '\0') {
+      break;
+    }
     if (numberOfCoordinates >= coordinates.size()) {
       throw std::runtime_error("Too many coordinates in line " + line + ".");
     }
-    coordinates[numberOfCoordinates] = std::stod(*iter);
+    char* end = nullptr;
+    coordinates[numberOfCoordinates] = std::strtod(current, &end);
+    if (end == current || (*end != '\0' && !isSeparator(*end))) {
+      throw std::invalid_argument("Could not parse the coordinates in line " + line + ".");
+    }
+    current = end;
+    ++numberOfCoordinates;
   }
   if (numberOfCoordinates != coordinates.size()) {
     throw std::runtime_error("To few coordinates in line " + line + ".");
@@ -74,10 +93,37 @@ Eigen::Vector3d seissol::writer::parseReceiverLine(const std::string& line) {
   return coordinates;
 }
 
+std::vector<Eigen::Vector3d> seissol::writer::parseBinaryReceiverFile(const std::vector<char>& content) {
+  const std::size_t headerSize = sizeof(BinaryReceiverFileMagic) + sizeof(std::uint64_t);
+  if (content.size() < headerSize ||
+      std::memcmp(content.data(), BinaryReceiverFileMagic, sizeof(BinaryReceiverFileMagic)) != 0) {
+    throw std::runtime_error("Not a binary receiver file.");
+  }
+  std::uint64_t numberOfPoints = 0;
+  std::memcpy(&numberOfPoints, content.data() + sizeof(BinaryReceiverFileMagic), sizeof(numberOfPoints));
+  if (content.size() != headerSize + 3 * sizeof(double) * numberOfPoints) {
+    throw std::runtime_error("The binary receiver file does not contain " + std::to_string(numberOfPoints) +
+                             " points.");
+  }
+
+  std::vector<Eigen::Vector3d> points(numberOfPoints);
+  const char* coordinates = content.data() + headerSize;
+  for (std::uint64_t i = 0; i < numberOfPoints; ++i) {
+    std::memcpy(points[i].data(), coordinates + 3 * sizeof(double) * i, 3 * sizeof(double));
+  }
+  return points;
+}
+
 std::vector<Eigen::Vector3d> seissol::writer::parseReceiverFile(const std::string& receiverFileName) {
-  std::vector<Eigen::Vector3d> points{};
+  // Rank 0 reads the file, all other ranks receive its content
+  ParallelCharIStream file(receiverFileName.c_str());
+  const auto& content = file.buffer();
+  if (content.size() >= sizeof(BinaryReceiverFileMagic) &&
+      std::memcmp(content.data(), BinaryReceiverFileMagic, sizeof(BinaryReceiverFileMagic)) == 0) {
+    return parseBinaryReceiverFile(content);
+  }
 
-  std::ifstream file{receiverFileName};
+  std::vector<Eigen::Vector3d> points{};
   std::string line{};
   while (std::getline(file, line)) {
     bool onlyWhiteSpace = std::all_of(line.begin(), line.end(), [](auto& c) {
@@ -98,15 +144,28 @@ std::string seissol::writer::ReceiverWriter::fileName(unsigned pointId) const {
   return fns.str();
 }
 
-void seissol::writer::ReceiverWriter::writeHeader( unsigned               pointId,
-                                                   Eigen::Vector3d const& point   ) {
-  auto name = fileName(pointId);
-
+std::vector<std::string> seissol::writer::ReceiverWriter::variableNames() {
   std::vector<std::string> names({"xx", "yy", "zz", "xy", "yz", "xz", "u", "v", "w"});
 #ifdef USE_POROELASTIC
   std::array<std::string, 4> additionalNames({"p", "u_f", "v_f", "w_f"});
   names.insert(names.end() ,additionalNames.begin(), additionalNames.end());
 #endif
+#ifdef MULTIPLE_SIMULATIONS
+  std::vector<std::string> simulationNames;
+  for (unsigned sim = init::QAtPoint::Start[0]; sim < init::QAtPoint::Stop[0]; ++sim) {
+    for (auto const& name : names) {
+      simulationNames.push_back(name + std::to_string(sim));
+    }
+  }
+  return simulationNames;
+#else
+  return names;
+#endif
+}
+
+void seissol::writer::ReceiverWriter::writeHeader( unsigned               pointId,
+                                                   Eigen::Vector3d const& point   ) {
+  auto name = fileName(pointId);
 
   /// \todo Find a nicer solution that is not so hard-coded.
   struct stat fileStat;
@@ -114,29 +173,167 @@ void seissol::writer::ReceiverWriter::writeHeader( unsigned               pointI
   if (stat(name.c_str(), &fileStat) != 0) {
     std::ofstream file;
     file.open(name);
-    file << "TITLE = \"Temporal Signal for receiver number " << std::setfill('0') << std::setw(5) << (pointId+1) << "\"" << std::endl;
-    file << "VARIABLES = \"Time\"";
-#ifdef MULTIPLE_SIMULATIONS
-    for (unsigned sim = init::QAtPoint::Start[0]; sim < init::QAtPoint::Stop[0]; ++sim) {
-      for (auto const& name : names) {
-        file << ",\"" << name << sim << "\"";
-      }
+    std::stringstream title;
+    title << "Temporal Signal for receiver number " << std::setfill('0') << std::setw(5) << (pointId+1);
+    writeReceiverDatHeader(file, title.str(), variableNames(), {point[0], point[1], point[2]});
+    file.close();
+  }
+}
+
+void seissol::writer::ReceiverWriter::setUp() {
+  setExecutor(m_executor);
+  if (isAffinityNecessary()) {
+    const auto freeCpus = SeisSol::main.getPinning().getFreeCPUsMask();
+    logInfo(seissol::MPI::mpi.rank()) << "Receiver writer thread affinity:" <<
+      parallel::Pinning::maskToString(freeCpus);
+    if (parallel::Pinning::freeCPUsMaskEmpty(freeCpus)) {
+      logError() << "There are no free CPUs left. Make sure to leave one for the I/O thread(s).";
     }
-#else
-    for (auto const& name : names) {
-      file << ",\"" << name << "\"";
+    setAffinityIfNecessary(freeCpus);
+  }
+}
+
+void seissol::writer::ReceiverWriter::initHdf5(const std::vector<Eigen::Vector3d>& points,
+                                               std::vector<short> const& contained) {
+  const auto rank = seissol::MPI::mpi.rank();
+  logInfo(rank) << "Initializing HDF5 receiver output.";
+
+  // Initialize the asynchronous module
+  async::Module<ReceiverWriterExecutor, ReceiverInitParam, ReceiverParam>::init();
+
+  const std::string fileName = m_fileNamePrefix + "-receivers.h5";
+  unsigned bufferId = addSyncBuffer(fileName.c_str(), fileName.size() + 1, true);
+  assert(bufferId == ReceiverWriterExecutor::FILE_NAME); NDBG_UNUSED(bufferId);
+
+  const auto names = variableNames();
+  std::string variables;
+  for (auto const& name : names) {
+    variables += (variables.empty() ? "" : ",") + name;
+  }
+  bufferId = addSyncBuffer(variables.c_str(), variables.size() + 1, true);
+  assert(bufferId == ReceiverWriterExecutor::VARIABLE_NAMES);
+
+  std::vector<double> localPoints;
+  for (unsigned point = 0; point < points.size(); ++point) {
+    if (contained[point] == 1) {
+      localPoints.insert(localPoints.end(), {static_cast<double>(point), points[point][0], points[point][1], points[point][2]});
     }
-#endif
-    file << std::endl;
-    for (int d = 0; d < 3; ++d) {
-      file << "# x" << (d+1) << "       " << std::scientific << std::setprecision(12) << point[d] << std::endl;
+  }
+  bufferId = addSyncBuffer(localPoints.data(), localPoints.size() * sizeof(double));
+  assert(bufferId == ReceiverWriterExecutor::POINTS);
+
+  // Buffers for all samples between two synchronization points
+  const std::size_t numberOfLocalPoints = localPoints.size() / ReceiverWriterExecutor::PointSize;
+  const auto samplesPerSync = static_cast<std::size_t>(std::ceil(syncInterval() / outputInterval())) + 2;
+  m_sampleIndices.assign(2 * numberOfLocalPoints * samplesPerSync, ReceiverWriterExecutor::InvalidPoint);
+  m_samples.assign(names.size() * numberOfLocalPoints * samplesPerSync, 0.0);
+  bufferId = addBuffer(m_samples.data(), m_samples.size() * sizeof(real));
+  assert(bufferId == ReceiverWriterExecutor::SAMPLES);
+  bufferId = addBuffer(m_sampleIndices.data(), m_sampleIndices.size() * sizeof(unsigned long));
+  assert(bufferId == ReceiverWriterExecutor::SAMPLE_INDICES);
+
+  sendBuffer(ReceiverWriterExecutor::FILE_NAME);
+  sendBuffer(ReceiverWriterExecutor::VARIABLE_NAMES);
+  sendBuffer(ReceiverWriterExecutor::POINTS);
+
+  ReceiverInitParam param;
+  param.numberOfReceivers = points.size();
+  param.numberOfVariables = names.size();
+  param.samplingInterval = outputInterval();
+  // The checkpoint is loaded before the receivers are initialized
+  param.append = seissol::SeisSol::main.simulator().getCurrentTime() > 0.0;
+  callInit(param);
+
+  removeBuffer(ReceiverWriterExecutor::FILE_NAME);
+  removeBuffer(ReceiverWriterExecutor::VARIABLE_NAMES);
+  removeBuffer(ReceiverWriterExecutor::POINTS);
+}
+
+void seissol::writer::ReceiverWriter::writeHdf5(double time) {
+  m_stopwatch.start();
+
+  const std::size_t capacity = m_sampleIndices.size() / 2;
+  const std::size_t numberOfVariables = capacity > 0 ? m_samples.size() / capacity : 0;
+
+  // The executors write collectively, so all ranks need the same number of calls
+  std::size_t numberOfRecords = 0;
+  for (auto& [layer, clusters] : m_receiverClusters) {
+    for (auto& cluster : clusters) {
+      for (auto& receiver : cluster) {
+        numberOfRecords += receiver.output.size() / cluster.ncols();
+      }
     }
-    file.close();
   }
+  unsigned long numberOfCalls = (capacity > 0) ? (numberOfRecords + capacity - 1) / capacity : 0;
+  numberOfCalls = std::max(numberOfCalls, 1UL);
+#ifdef USE_MPI
+  MPI_Allreduce(MPI_IN_PLACE, &numberOfCalls, 1, MPI_UNSIGNED_LONG, MPI_MAX, seissol::MPI::mpi.comm());
+#endif // USE_MPI
+
+  std::size_t record = 0;
+  unsigned long calls = 0;
+  auto flush = [&]() {
+    std::fill(m_sampleIndices.begin() + 2 * record, m_sampleIndices.end(), ReceiverWriterExecutor::InvalidPoint);
+    sendBuffer(ReceiverWriterExecutor::SAMPLES);
+    sendBuffer(ReceiverWriterExecutor::SAMPLE_INDICES);
+    ReceiverParam param;
+    param.time = time;
+    call(param);
+    record = 0;
+    ++calls;
+  };
+
+  // The buffers may still be in use by the previous call
+  Stopwatch waitStopwatch;
+  waitStopwatch.start();
+  wait();
+  OutputBandwidth::bandwidth.recordSync(waitStopwatch.stop());
+  for (auto& [layer, clusters] : m_receiverClusters) {
+    for (auto& cluster : clusters) {
+      auto ncols = cluster.ncols();
+      assert(ncols == numberOfVariables + 1);
+      for (auto& receiver : cluster) {
+        assert(receiver.output.size() % ncols == 0);
+        size_t nSamples = receiver.output.size() / ncols;
+        for (size_t i = 0; i < nSamples; ++i) {
+          if (record == capacity) {
+            flush();
+            wait();
+          }
+          m_sampleIndices[2 * record] = std::llround(receiver.output[i * ncols] / outputInterval());
+          m_sampleIndices[2 * record + 1] = receiver.pointId;
+          std::copy_n(&receiver.output[i * ncols + 1], numberOfVariables, &m_samples[record * numberOfVariables]);
+          ++record;
+        }
+        receiver.output.clear();
+      }
+    }
+  }
+  flush();
+  while (calls < numberOfCalls) {
+    wait();
+    flush();
+  }
+
+  auto duration = m_stopwatch.stop();
+  int const rank = seissol::MPI::mpi.rank();
+  logInfo(rank) << "Sent receivers to the writer in" << duration << "seconds.";
 }
 
-void seissol::writer::ReceiverWriter::syncPoint(double)
+void seissol::writer::ReceiverWriter::syncPoint(double time)
 {
+  // the samples of device builds are buffered on the device until now
+  for (auto& [layer, clusters] : m_receiverClusters) {
+    for (auto& cluster : clusters) {
+      cluster.flushSamples();
+    }
+  }
+
+  if (m_hdf5) {
+    writeHdf5(time);
+    return;
+  }
+
   if (m_receiverClusters.empty()) {
     return;
   }
@@ -175,14 +372,39 @@ void seissol::writer::ReceiverWriter::init(std::string receiverFileName, std::st
   m_receiverFileName = std::move(receiverFileName);
   m_fileNamePrefix = std::move(fileNamePrefix);
   m_samplingInterval = samplingInterval;
+
+  const std::string output = utils::Env::get("SEISSOL_RECEIVER_OUTPUT", "ascii");
+  if (output == "hdf5") {
+#ifdef USE_HDF
+    m_hdf5 = true;
+#else
+    logError() << "SEISSOL_RECEIVER_OUTPUT=hdf5 requires SeisSol compiled with HDF5.";
+#endif
+  } else if (output != "ascii") {
+    logError() << "Unknown receiver output" << output << "in SEISSOL_RECEIVER_OUTPUT.";
+  }
+
+  const auto decimation = utils::Env::get<unsigned>("SEISSOL_RECEIVER_DECIMATION", 1u);
+  if (decimation > 1) {
+    const auto cutoff = utils::Env::get<double>("SEISSOL_RECEIVER_DECIMATION_CUTOFF", 0.8);
+    if (cutoff <= 0.0 || cutoff > 1.0) {
+      logError() << "SEISSOL_RECEIVER_DECIMATION_CUTOFF must be in (0, 1].";
+    }
+    m_decimation = std::make_shared<kernels::DecimationFilter const>(m_samplingInterval, decimation, cutoff);
+    logInfo(seissol::MPI::mpi.rank()) << "Decimating the receivers by" << decimation << "to a sampling interval of"
+                                      << m_decimation->outputInterval() << "s.";
+  }
+
   setSyncInterval(syncPointInterval);
+  // The receivers are sampled in the clusters, hence an earlier synchronization point only writes fewer samples
+  setSyncWindow(0.5 * syncPointInterval);
   Modules::registerHook(*this, SYNCHRONIZATION_POINT);
 }
 
 void seissol::writer::ReceiverWriter::addPoints(MeshReader const& mesh,
                                                 const seissol::initializers::Lut& ltsLut,
                                                 const seissol::initializers::LTS& lts,
-                                                const GlobalData* global ) {
+                                                const CompoundGlobalData& global ) {
   std::vector<Eigen::Vector3d> points;
   const auto rank = seissol::MPI::mpi.rank();
   // Only parse if we have a receiver file
@@ -222,11 +444,20 @@ void seissol::writer::ReceiverWriter::addPoints(MeshReader const& mesh,
       auto& clusters = m_receiverClusters[layer];
       // Make sure that needed empty clusters are initialized.
       for (unsigned c = clusters.size(); c <= cluster; ++c) {
-        clusters.emplace_back(global, quantities, m_samplingInterval, syncInterval());
+        clusters.emplace_back(global, quantities, m_samplingInterval, syncInterval(), m_decimation);
       }
 
-      writeHeader(point, points[point]);
+      if (!m_hdf5) {
+        writeHeader(point, points[point]);
+      }
       m_receiverClusters[layer][cluster].addReceiver(meshId, point, points[point], mesh, ltsLut, lts);
     }
   }
+
+  // The number of points is the same on all ranks
+  if (m_hdf5 && numberOfPoints > 0) {
+    initHdf5(points, contained);
+  } else {
+    m_hdf5 = false;
+  }
 }
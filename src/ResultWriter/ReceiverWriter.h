@@ -40,25 +40,47 @@
 #ifndef RESULTWRITER_RECEIVERWRITER_H_
 #define RESULTWRITER_RECEIVERWRITER_H_
 
+#include <memory>
 #include <vector>
 #include <string_view>
 
 #include <Eigen/Dense>
+#include <async/Module.h>
 #include <Geometry/MeshReader.h>
 #include <Initializer/tree/Lut.hpp>
 #include <Initializer/LTS.h>
 #include <Kernels/Receiver.h>
 #include <Modules/Module.h>
 #include <Monitoring/Stopwatch.h>
+#include "ReceiverWriterExecutor.h"
 
 struct LocalIntegrationData;
 struct GlobalData;
 namespace seissol::writer {
+    /**
+     * Binary receiver files start with this magic, followed by the number of points (std::uint64_t) and
+     * the coordinates of the points (3 doubles per point), all in native byte order.
+     */
+    inline constexpr char BinaryReceiverFileMagic[8] = {'S', 'S', 'R', 'C', 'V', 'B', 'I', 'N'};
+
     Eigen::Vector3d parseReceiverLine(const std::string& line);
+    std::vector<Eigen::Vector3d> parseBinaryReceiverFile(const std::vector<char>& content);
+    //! Reads an ASCII or binary receiver file on rank 0 and parses it on all ranks
     std::vector<Eigen::Vector3d> parseReceiverFile(const std::string& receiverFileName);
 
-    class ReceiverWriter : public seissol::Module {
+    class ReceiverWriter : private async::Module<ReceiverWriterExecutor, ReceiverInitParam, ReceiverParam>,
+                           public seissol::Module {
     public:
+      /**
+       * Called by ASYNC on all ranks
+       */
+      void setUp();
+
+      /**
+       * With SEISSOL_RECEIVER_OUTPUT=hdf5, all receivers are written into a single HDF5 file
+       * instead of one ASCII file per receiver.
+       * With SEISSOL_RECEIVER_DECIMATION > 1, the samples are low-pass filtered and only every n-th is stored.
+       */
       void init(std::string receiverFileName, std::string fileNamePrefix,
                 double syncPointInterval, double samplingInterval);
 
@@ -66,7 +88,7 @@ namespace seissol::writer {
           const MeshReader& mesh,
           const seissol::initializers::Lut& ltsLut,
           const seissol::initializers::LTS& lts,
-          const GlobalData* global);
+          const CompoundGlobalData& global);
 
       kernels::ReceiverCluster* receiverCluster(unsigned clusterId, LayerType layer) {
         assert(layer != Ghost);
@@ -77,21 +99,48 @@ namespace seissol::writer {
         }
         return nullptr;
       }
+      void close() {
+        if (m_hdf5) {
+          wait();
+        }
+        finalize();
+      }
+
+      void tearDown() {
+        m_executor.finalize();
+      }
+
       //
       // Hooks
       //
       void syncPoint(double) override;
 
     private:
+      //! Interval of the stored samples
+      [[nodiscard]] double outputInterval() const {
+        return (m_decimation != nullptr) ? m_decimation->outputInterval() : m_samplingInterval;
+      }
       [[nodiscard]] std::string fileName(unsigned pointId) const;
+      [[nodiscard]] static std::vector<std::string> variableNames();
       void writeHeader(unsigned pointId, Eigen::Vector3d const& point);
+      void initHdf5(const std::vector<Eigen::Vector3d>& points, std::vector<short> const& contained);
+      void writeHdf5(double time);
 
       std::string m_receiverFileName;
       std::string m_fileNamePrefix;
       double      m_samplingInterval;
+      //! Low-pass filter for decimating the samples (SEISSOL_RECEIVER_DECIMATION), or nullptr
+      std::shared_ptr<kernels::DecimationFilter const> m_decimation;
       // Map needed because LayerType enum casts weirdly to int.
       std::unordered_map<LayerType, std::vector<kernels::ReceiverCluster>> m_receiverClusters;
       Stopwatch   m_stopwatch;
+
+      //! True if the receivers are written into a single HDF5 file
+      bool m_hdf5 = false;
+      ReceiverWriterExecutor m_executor;
+      //! (time step, point id) of the records which are sent to the executor
+      std::vector<unsigned long> m_sampleIndices;
+      std::vector<real> m_samples;
     };
   }
 
@@ -0,0 +1,319 @@
+#include "ReceiverWriterExecutor.h"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "utils/logger.h"
+
+#include "OutputBandwidth.h"
+
+#ifdef USE_HDF
+#include "Checkpoint/h5/H5ErrHandler.h"
+
+namespace {
+template <typename T>
+void checkH5Err(T status) {
+  if (status < 0) {
+    logError() << "An HDF5 error occurred in the receiver writer";
+  }
+}
+
+hid_t realType() {
+#if REAL_SIZE == 8
+  return H5T_NATIVE_DOUBLE;
+#else
+  return H5T_NATIVE_FLOAT;
+#endif
+}
+} // namespace
+#endif // USE_HDF
+
+void seissol::writer::ReceiverWriterExecutor::execInit(const async::ExecInfo& info,
+                                                       const ReceiverInitParam& param) {
+#ifdef USE_HDF
+  if (m_file >= 0) {
+    logError() << "Receiver writer already initialized.";
+  }
+
+  m_numberOfReceivers = param.numberOfReceivers;
+  m_numberOfVariables = param.numberOfVariables;
+  m_samplingInterval = param.samplingInterval;
+
+  int rank = 0;
+  hid_t access = H5P_DEFAULT;
+#ifdef USE_MPI
+  MPI_Comm_dup(seissol::MPI::mpi.comm(), &m_comm);
+  MPI_Comm_rank(m_comm, &rank);
+
+  access = H5Pcreate(H5P_FILE_ACCESS);
+  checkH5Err(access);
+  checkH5Err(H5Pset_fapl_mpio(access, m_comm, MPI_INFO_NULL));
+
+  m_transfer = H5Pcreate(H5P_DATASET_XFER);
+  checkH5Err(m_transfer);
+  checkH5Err(H5Pset_dxpl_mpio(m_transfer, H5FD_MPIO_COLLECTIVE));
+#endif // USE_MPI
+
+  const std::string fileName(static_cast<const char*>(info.buffer(FILE_NAME)));
+
+  if (param.append) {
+    checkpoint::h5::H5ErrHandler errHandler;
+    m_file = H5Fopen(fileName.c_str(), H5F_ACC_RDWR, access);
+  }
+
+  if (m_file >= 0) {
+    m_time = H5Dopen(m_file, "/time", H5P_DEFAULT);
+    checkH5Err(m_time);
+    m_samples = H5Dopen(m_file, "/receivers", H5P_DEFAULT);
+    checkH5Err(m_samples);
+
+    hid_t space = H5Dget_space(m_samples);
+    checkH5Err(space);
+    hsize_t dims[3];
+    checkH5Err(H5Sget_simple_extent_dims(space, dims, nullptr));
+    checkH5Err(H5Sclose(space));
+    if (dims[1] != m_numberOfReceivers || dims[2] != m_numberOfVariables) {
+      logError() << "The receivers in" << fileName << "do not match the receiver file.";
+    }
+    m_numberOfTimes = dims[0];
+
+    logInfo(rank) << "Continuing receiver output in" << fileName << "after" << m_numberOfTimes
+                  << "time steps.";
+  } else {
+    m_file = H5Fcreate(fileName.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, access);
+    checkH5Err(m_file);
+    m_numberOfTimes = 0;
+
+    // Points
+    const hsize_t pointDims[2] = {m_numberOfReceivers, 3};
+    hid_t pointSpace = H5Screate_simple(2, pointDims, nullptr);
+    checkH5Err(pointSpace);
+    hid_t pointProperties = H5Pcreate(H5P_DATASET_CREATE);
+    checkH5Err(pointProperties);
+    const double nan = std::nan("");
+    checkH5Err(H5Pset_fill_value(pointProperties, H5T_NATIVE_DOUBLE, &nan));
+    hid_t points = H5Dcreate(m_file, "/points", H5T_NATIVE_DOUBLE, pointSpace, H5P_DEFAULT,
+                             pointProperties, H5P_DEFAULT);
+    checkH5Err(points);
+    checkH5Err(H5Pclose(pointProperties));
+
+    // The hyperslabs are written in the order of the file, i.e. sorted by point id
+    const auto* pointBuffer = static_cast<const double*>(info.buffer(POINTS));
+    const std::size_t numberOfLocalPoints = info.bufferSize(POINTS) / (PointSize * sizeof(double));
+    std::vector<std::size_t> order(numberOfLocalPoints);
+    for (std::size_t i = 0; i < numberOfLocalPoints; ++i) {
+      order[i] = i;
+    }
+    std::sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) {
+      return pointBuffer[PointSize * a] < pointBuffer[PointSize * b];
+    });
+    std::vector<double> coordinates;
+    coordinates.reserve(3 * numberOfLocalPoints);
+    checkH5Err(H5Sselect_none(pointSpace));
+    for (auto i : order) {
+      const hsize_t start[2] = {static_cast<hsize_t>(pointBuffer[PointSize * i]), 0};
+      const hsize_t count[2] = {1, 3};
+      checkH5Err(H5Sselect_hyperslab(pointSpace, H5S_SELECT_OR, start, nullptr, count, nullptr));
+      coordinates.insert(coordinates.end(), &pointBuffer[PointSize * i + 1], &pointBuffer[PointSize * i + 4]);
+    }
+    const hsize_t memoryDims = std::max<hsize_t>(coordinates.size(), 1);
+    hid_t memorySpace = H5Screate_simple(1, &memoryDims, nullptr);
+    checkH5Err(memorySpace);
+    if (coordinates.empty()) {
+      checkH5Err(H5Sselect_none(memorySpace));
+    }
+    checkH5Err(H5Dwrite(points, H5T_NATIVE_DOUBLE, memorySpace, pointSpace, m_transfer, coordinates.data()));
+    checkH5Err(H5Sclose(memorySpace));
+    checkH5Err(H5Sclose(pointSpace));
+    checkH5Err(H5Dclose(points));
+
+    // Time steps
+    const hsize_t timeDims = 0;
+    const hsize_t timeMaxDims = H5S_UNLIMITED;
+    const hsize_t timeChunk = 1024;
+    hid_t timeSpace = H5Screate_simple(1, &timeDims, &timeMaxDims);
+    checkH5Err(timeSpace);
+    hid_t timeProperties = H5Pcreate(H5P_DATASET_CREATE);
+    checkH5Err(timeProperties);
+    checkH5Err(H5Pset_chunk(timeProperties, 1, &timeChunk));
+    m_time = H5Dcreate(m_file, "/time", H5T_NATIVE_DOUBLE, timeSpace, H5P_DEFAULT, timeProperties, H5P_DEFAULT);
+    checkH5Err(m_time);
+    checkH5Err(H5Pclose(timeProperties));
+    checkH5Err(H5Sclose(timeSpace));
+
+    // Samples
+    const hsize_t sampleDims[3] = {0, m_numberOfReceivers, m_numberOfVariables};
+    const hsize_t sampleMaxDims[3] = {H5S_UNLIMITED, m_numberOfReceivers, m_numberOfVariables};
+    const hsize_t sampleChunk[3] = {16, std::min<hsize_t>(m_numberOfReceivers, 1024), m_numberOfVariables};
+    hid_t sampleSpace = H5Screate_simple(3, sampleDims, sampleMaxDims);
+    checkH5Err(sampleSpace);
+    hid_t sampleProperties = H5Pcreate(H5P_DATASET_CREATE);
+    checkH5Err(sampleProperties);
+    checkH5Err(H5Pset_chunk(sampleProperties, 3, sampleChunk));
+    const real realNan = std::nan("");
+    checkH5Err(H5Pset_fill_value(sampleProperties, realType(), &realNan));
+    m_samples = H5Dcreate(m_file, "/receivers", realType(), sampleSpace, H5P_DEFAULT, sampleProperties, H5P_DEFAULT);
+    checkH5Err(m_samples);
+    checkH5Err(H5Pclose(sampleProperties));
+    checkH5Err(H5Sclose(sampleSpace));
+
+    // Comma-separated variable names
+    const std::string variables(static_cast<const char*>(info.buffer(VARIABLE_NAMES)));
+    hid_t stringType = H5Tcopy(H5T_C_S1);
+    checkH5Err(stringType);
+    checkH5Err(H5Tset_size(stringType, variables.size() + 1));
+    hid_t attributeSpace = H5Screate(H5S_SCALAR);
+    checkH5Err(attributeSpace);
+    hid_t attribute = H5Acreate(m_samples, "variables", stringType, attributeSpace, H5P_DEFAULT, H5P_DEFAULT);
+    checkH5Err(attribute);
+    checkH5Err(H5Awrite(attribute, stringType, variables.c_str()));
+    checkH5Err(H5Aclose(attribute));
+    checkH5Err(H5Sclose(attributeSpace));
+    checkH5Err(H5Tclose(stringType));
+
+    logInfo(rank) << "Writing" << m_numberOfReceivers << "receivers to" << fileName;
+  }
+
+#ifdef USE_MPI
+  checkH5Err(H5Pclose(access));
+#endif // USE_MPI
+#endif // USE_HDF
+}
+
+void seissol::writer::ReceiverWriterExecutor::exec(const async::ExecInfo& info, const ReceiverParam& param) {
+#ifdef USE_HDF
+  if (m_file < 0) {
+    return;
+  }
+
+  m_stopwatch.start();
+
+  const auto* indices = static_cast<const unsigned long*>(info.buffer(SAMPLE_INDICES));
+  const auto* samples = static_cast<const real*>(info.buffer(SAMPLES));
+  const std::size_t numberOfRecords = info.bufferSize(SAMPLE_INDICES) / (2 * sizeof(unsigned long));
+
+  // The hyperslabs are written in the order of the file, i.e. sorted by time step and point id
+  std::vector<std::size_t> records;
+  records.reserve(numberOfRecords);
+  unsigned long numberOfTimes = m_numberOfTimes;
+  for (std::size_t i = 0; i < numberOfRecords; ++i) {
+    if (indices[2 * i + 1] != InvalidPoint) {
+      records.push_back(i);
+      numberOfTimes = std::max(numberOfTimes, indices[2 * i] + 1);
+    }
+  }
+  std::sort(records.begin(), records.end(), [&](std::size_t a, std::size_t b) {
+    return indices[2 * a] < indices[2 * b] || (indices[2 * a] == indices[2 * b] && indices[2 * a + 1] < indices[2 * b + 1]);
+  });
+
+#ifdef USE_MPI
+  MPI_Allreduce(MPI_IN_PLACE, &numberOfTimes, 1, MPI_UNSIGNED_LONG, MPI_MAX, m_comm);
+  int rank = 0;
+  MPI_Comm_rank(m_comm, &rank);
+#else
+  const int rank = 0;
+#endif // USE_MPI
+
+  if (numberOfTimes > m_numberOfTimes) {
+    const hsize_t timeDims = numberOfTimes;
+    checkH5Err(H5Dset_extent(m_time, &timeDims));
+    const hsize_t sampleDims[3] = {numberOfTimes, m_numberOfReceivers, m_numberOfVariables};
+    checkH5Err(H5Dset_extent(m_samples, sampleDims));
+
+    // The first rank writes the new time steps
+    std::vector<double> times;
+    if (rank == 0) {
+      for (unsigned long t = m_numberOfTimes; t < numberOfTimes; ++t) {
+        times.push_back(t * m_samplingInterval);
+      }
+    }
+    hid_t timeSpace = H5Dget_space(m_time);
+    checkH5Err(timeSpace);
+    const hsize_t start = m_numberOfTimes;
+    const hsize_t count = numberOfTimes - m_numberOfTimes;
+    if (rank == 0) {
+      checkH5Err(H5Sselect_hyperslab(timeSpace, H5S_SELECT_SET, &start, nullptr, &count, nullptr));
+    } else {
+      checkH5Err(H5Sselect_none(timeSpace));
+    }
+    hid_t memorySpace = H5Screate_simple(1, &count, nullptr);
+    checkH5Err(memorySpace);
+    if (rank != 0) {
+      checkH5Err(H5Sselect_none(memorySpace));
+    }
+    checkH5Err(H5Dwrite(m_time, H5T_NATIVE_DOUBLE, memorySpace, timeSpace, m_transfer, times.data()));
+    checkH5Err(H5Sclose(memorySpace));
+    checkH5Err(H5Sclose(timeSpace));
+
+    m_numberOfTimes = numberOfTimes;
+  }
+
+  hid_t sampleSpace = H5Dget_space(m_samples);
+  checkH5Err(sampleSpace);
+  checkH5Err(H5Sselect_none(sampleSpace));
+  std::vector<real> buffer;
+  buffer.reserve(records.size() * m_numberOfVariables);
+  for (std::size_t begin = 0; begin < records.size();) {
+    // Consecutive points of the same time step form one hyperslab
+    std::size_t end = begin + 1;
+    while (end < records.size() && indices[2 * records[end]] == indices[2 * records[begin]] &&
+           indices[2 * records[end] + 1] == indices[2 * records[end - 1] + 1] + 1) {
+      ++end;
+    }
+    const hsize_t start[3] = {indices[2 * records[begin]], indices[2 * records[begin] + 1], 0};
+    const hsize_t count[3] = {1, end - begin, m_numberOfVariables};
+    checkH5Err(H5Sselect_hyperslab(sampleSpace, H5S_SELECT_OR, start, nullptr, count, nullptr));
+    for (std::size_t r = begin; r < end; ++r) {
+      const real* sample = &samples[records[r] * m_numberOfVariables];
+      buffer.insert(buffer.end(), sample, sample + m_numberOfVariables);
+    }
+    begin = end;
+  }
+  const hsize_t memoryDims = std::max<hsize_t>(buffer.size(), 1);
+  hid_t memorySpace = H5Screate_simple(1, &memoryDims, nullptr);
+  checkH5Err(memorySpace);
+  if (buffer.empty()) {
+    checkH5Err(H5Sselect_none(memorySpace));
+  }
+  checkH5Err(H5Dwrite(m_samples, realType(), memorySpace, sampleSpace, m_transfer, buffer.data()));
+  checkH5Err(H5Sclose(memorySpace));
+  checkH5Err(H5Sclose(sampleSpace));
+
+  checkH5Err(H5Fflush(m_file, H5F_SCOPE_GLOBAL));
+
+  OutputBandwidth::bandwidth.recordWrite(buffer.size() * sizeof(real), m_stopwatch.split());
+  m_stopwatch.pause();
+
+  logInfo(rank) << "Wrote receivers at time" << utils::nospace << param.time << ".";
+#endif // USE_HDF
+}
+
+void seissol::writer::ReceiverWriterExecutor::finalize() {
+#ifdef USE_HDF
+  if (m_file >= 0) {
+    m_stopwatch.printTime("Time receiver writer backend:"
+#ifdef USE_MPI
+                          , m_comm
+#endif // USE_MPI
+    );
+
+    checkH5Err(H5Dclose(m_samples));
+    checkH5Err(H5Dclose(m_time));
+    checkH5Err(H5Fclose(m_file));
+    m_samples = m_time = m_file = -1;
+  }
+  if (m_transfer != H5P_DEFAULT) {
+    checkH5Err(H5Pclose(m_transfer));
+    m_transfer = H5P_DEFAULT;
+  }
+#endif // USE_HDF
+
+#ifdef USE_MPI
+  if (m_comm != MPI_COMM_NULL) {
+    MPI_Comm_free(&m_comm);
+    m_comm = MPI_COMM_NULL;
+  }
+#endif // USE_MPI
+}
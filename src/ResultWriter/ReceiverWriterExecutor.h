@@ -0,0 +1,95 @@
+#ifndef SEISSOL_RESULTWRITER_RECEIVERWRITEREXECUTOR_H
+#define SEISSOL_RESULTWRITER_RECEIVERWRITEREXECUTOR_H
+
+#include "Parallel/MPI.h"
+
+#include <cstddef>
+#include <limits>
+
+#include "async/ExecInfo.h"
+
+#include "Kernels/precision.hpp"
+#include "Monitoring/Stopwatch.h"
+
+#ifdef USE_HDF
+#include <hdf5.h>
+#endif // USE_HDF
+
+namespace seissol::writer {
+struct ReceiverInitParam {
+  //! Number of receivers in the receiver file (on all ranks)
+  unsigned long numberOfReceivers;
+  //! Number of variables per sample (without the time)
+  unsigned numberOfVariables;
+  double samplingInterval;
+  //! True if the simulation is restarted from a checkpoint and the existing file is continued
+  bool append;
+};
+
+struct ReceiverParam {
+  double time;
+};
+
+/**
+ * Writes the samples of all receivers into a single HDF5 file with collective I/O.
+ *
+ * The file contains the datasets /points (receiver x coordinates), /time (time steps) and
+ * /receivers (time steps x receivers x variables). A sample is stored in the time step
+ * round(time / samplingInterval), so the position does not depend on the cluster which
+ * recorded the sample. Receivers which are not found in the mesh are filled with NaN.
+ */
+class ReceiverWriterExecutor {
+  public:
+  enum BufferIds {
+    FILE_NAME = 0,
+    VARIABLE_NAMES = 1,
+    POINTS = 2,
+    SAMPLES = 3,
+    SAMPLE_INDICES = 4,
+  };
+
+  //! Point id of unused records in the sample buffers
+  static constexpr unsigned long InvalidPoint = std::numeric_limits<unsigned long>::max();
+
+  //! Number of values for a receiver in the POINTS buffer (point id and coordinates)
+  static constexpr unsigned PointSize = 4;
+
+  /**
+   * Creates the file or opens the existing file on a restart
+   */
+  void execInit(const async::ExecInfo& info, const ReceiverInitParam& param);
+
+  /**
+   * Writes the records in the buffers: SAMPLE_INDICES contain (time step, point id) pairs,
+   * SAMPLES the variables of the records.
+   */
+  void exec(const async::ExecInfo& info, const ReceiverParam& param);
+
+  void finalize();
+
+  private:
+#ifdef USE_MPI
+  /** The MPI communicator for the writer */
+  MPI_Comm m_comm = MPI_COMM_NULL;
+#endif // USE_MPI
+
+#ifdef USE_HDF
+  hid_t m_file = -1;
+  hid_t m_time = -1;
+  hid_t m_samples = -1;
+  hid_t m_transfer = H5P_DEFAULT;
+#endif // USE_HDF
+
+  unsigned long m_numberOfReceivers = 0;
+  unsigned m_numberOfVariables = 0;
+  double m_samplingInterval = 0.0;
+
+  /** Number of time steps in the file */
+  unsigned long m_numberOfTimes = 0;
+
+  /** Backend stopwatch */
+  Stopwatch m_stopwatch;
+};
+} // namespace seissol::writer
+
+#endif // SEISSOL_RESULTWRITER_RECEIVERWRITEREXECUTOR_H
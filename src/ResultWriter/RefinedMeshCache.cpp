@@ -0,0 +1,74 @@
+#include "RefinedMeshCache.h"
+
+#include <cstdio>
+#include <fstream>
+#include <utility>
+
+namespace {
+constexpr std::uint64_t Magic = 0x5353524d43414348ULL; // "SSRMCACH"
+constexpr std::uint64_t Version = 1;
+
+struct Header {
+  std::uint64_t magic;
+  std::uint64_t version;
+  std::uint64_t key;
+  std::uint64_t numCells;
+  std::uint64_t numVertices;
+};
+} // namespace
+
+seissol::writer::RefinedMeshCache::RefinedMeshCache(std::string fileName, std::uint64_t key)
+    : m_fileName(std::move(fileName)), m_key(key) {}
+
+bool seissol::writer::RefinedMeshCache::load() {
+  std::ifstream file(m_fileName, std::ios::binary);
+  if (!file) {
+    return false;
+  }
+  Header header{};
+  file.read(reinterpret_cast<char*>(&header), sizeof(header));
+  if (!file || header.magic != Magic || header.version != Version || header.key != m_key) {
+    return false;
+  }
+  m_cells.resize(header.numCells * 4);
+  m_vertices.resize(header.numVertices * 3);
+  file.read(reinterpret_cast<char*>(m_cells.data()), m_cells.size() * sizeof(unsigned int));
+  file.read(reinterpret_cast<char*>(m_vertices.data()), m_vertices.size() * sizeof(double));
+  if (!file) {
+    m_cells.clear();
+    m_vertices.clear();
+    return false;
+  }
+  return true;
+}
+
+bool seissol::writer::RefinedMeshCache::store(const unsigned int* cells,
+                                              std::size_t numCells,
+                                              const double* vertices,
+                                              std::size_t numVertices) const {
+  // Written under another name first, such that an interrupted run never leaves an incomplete cache
+  const std::string tmpFileName = m_fileName + ".tmp";
+  {
+    std::ofstream file(tmpFileName, std::ios::binary | std::ios::trunc);
+    const Header header{Magic, Version, m_key, numCells, numVertices};
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(cells), numCells * 4 * sizeof(unsigned int));
+    file.write(reinterpret_cast<const char*>(vertices), numVertices * 3 * sizeof(double));
+    file.close();
+    if (!file) {
+      std::remove(tmpFileName.c_str());
+      return false;
+    }
+  }
+  return std::rename(tmpFileName.c_str(), m_fileName.c_str()) == 0;
+}
+
+std::uint64_t
+    seissol::writer::RefinedMeshCache::hash(const void* data, std::size_t size, std::uint64_t seed) {
+  const auto* bytes = static_cast<const unsigned char*>(data);
+  std::uint64_t value = seed;
+  for (std::size_t i = 0; i < size; ++i) {
+    value = (value ^ bytes[i]) * 1099511628211ULL;
+  }
+  return value;
+}
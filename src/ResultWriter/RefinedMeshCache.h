@@ -0,0 +1,47 @@
+#ifndef SEISSOL_RESULTWRITER_REFINEDMESHCACHE_H
+#define SEISSOL_RESULTWRITER_REFINEDMESHCACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace seissol::writer {
+/**
+ * The refined wave field output mesh of one rank, stored in a file.
+ *
+ * A restart (or a second run) with the same mesh partition, refinement and output region reads the refined cells and
+ * vertices instead of refining the mesh again. The key identifies the input of the refinement; a cache with another
+ * key is ignored and overwritten.
+ **/
+class RefinedMeshCache {
+  public:
+  RefinedMeshCache(std::string fileName, std::uint64_t key);
+
+  //! Reads the cache; false if the file does not exist, is incomplete or has another key
+  bool load();
+
+  //! Writes the refined mesh (4 vertex ids per cell, 3 coordinates per vertex); false if the file cannot be written
+  bool store(const unsigned int* cells, std::size_t numCells, const double* vertices, std::size_t numVertices) const;
+
+  const std::vector<unsigned int>& cells() const { return m_cells; }
+  const std::vector<double>& vertices() const { return m_vertices; }
+  std::size_t numCells() const { return m_cells.size() / 4; }
+  std::size_t numVertices() const { return m_vertices.size() / 3; }
+
+  const std::string& fileName() const { return m_fileName; }
+
+  //! FNV-1a hash of the bytes, continuing the hash value seed
+  static std::uint64_t hash(const void* data, std::size_t size, std::uint64_t seed = HashOffset);
+
+  static constexpr std::uint64_t HashOffset = 14695981039346656037ULL;
+
+  private:
+  std::string m_fileName;
+  std::uint64_t m_key;
+  std::vector<unsigned int> m_cells;
+  std::vector<double> m_vertices;
+};
+} // namespace seissol::writer
+
+#endif // SEISSOL_RESULTWRITER_REFINEDMESHCACHE_H
@@ -38,15 +38,22 @@
  * @section DESCRIPTION
  */
 
+#include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <cstring>
+#include <limits>
+#include <memory>
+#include <numeric>
 
 #include "SeisSol.h"
 #include "WaveFieldWriter.h"
 #include "Geometry/MeshReader.h"
 #include "Geometry/refinement/MeshRefiner.h"
+#include "RefinedMeshCache.h"
 #include "Monitoring/instrumentation.fpp"
 #include <Modules/Modules.h>
+#include "utils/env.h"
 
 void seissol::writer::WaveFieldWriter::setUp() {
   setExecutor(m_executor);
@@ -99,41 +106,65 @@ seissol::refinement::TetrahedronRefiner<double>*
   return tetRefiner;
 }
 
-unsigned const*
-    seissol::writer::WaveFieldWriter::adjustOffsets(refinement::MeshRefiner<double>* meshRefiner) {
+unsigned const* seissol::writer::WaveFieldWriter::adjustOffsets(const unsigned int* cellData,
+                                                                std::size_t numCells,
+                                                                std::size_t numVertices) {
   unsigned const* const_cells;
 // Cells are a bit complicated because the vertex filter will now longer work if we just use the
 // buffer We will add the offset later
 #ifdef USE_MPI
   // Add the offset to the cells
   MPI_Comm groupComm = seissol::SeisSol::main.asyncIO().groupComm();
-  unsigned int offset = meshRefiner->getNumVertices();
-  MPI_Scan(MPI_IN_PLACE, &offset, 1, MPI_UNSIGNED, MPI_SUM, groupComm);
-  offset -= meshRefiner->getNumVertices();
+  // The global vertex ids are stored as 32-bit integers in the output, hence the scan is done in 64 bit
+  // to detect an overflow instead of writing a corrupted connectivity
+  unsigned long globalVertices = numVertices;
+  MPI_Scan(MPI_IN_PLACE, &globalVertices, 1, MPI_UNSIGNED_LONG, MPI_SUM, groupComm);
+  if (globalVertices > std::numeric_limits<unsigned int>::max()) {
+    logError() << "The wave field output supports at most" << std::numeric_limits<unsigned int>::max()
+               << "vertices per output group, but has at least" << globalVertices;
+  }
+  const unsigned int offset = globalVertices - numVertices;
 
   // Add the offset to all cells
-  unsigned int* cells = new unsigned int[meshRefiner->getNumCells() * 4];
-  for (unsigned int i = 0; i < meshRefiner->getNumCells() * 4; i++) {
-    cells[i] = meshRefiner->getCellData()[i] + offset;
+  unsigned int* cells = new unsigned int[numCells * 4];
+  for (std::size_t i = 0; i < numCells * 4; i++) {
+    cells[i] = cellData[i] + offset;
   }
   const_cells = cells;
 #else  // USE_MPI
-  const_cells = meshRefiner->getCellData();
+  const_cells = cellData;
 #endif // USE_MPI
   return const_cells;
 }
 
+std::uint64_t seissol::writer::WaveFieldWriter::refinedMeshKey(
+    const MeshReader& meshReader, const std::vector<const Element*>& subElements, int refinement) {
+  // The refined mesh only depends on the refinement and the vertices of the (extracted) cells
+  const std::vector<Vertex>& vertices = meshReader.getVertices();
+  const std::size_t numElems =
+      isExtractRegionEnabled ? subElements.size() : meshReader.getElements().size();
+  std::uint64_t key = RefinedMeshCache::hash(&refinement, sizeof(refinement));
+  key = RefinedMeshCache::hash(&numElems, sizeof(numElems), key);
+  for (std::size_t i = 0; i < numElems; i++) {
+    const Element& element = isExtractRegionEnabled ? *subElements[i] : meshReader.getElements()[i];
+    for (int vertex : element.vertices) {
+      key = RefinedMeshCache::hash(vertices[vertex].coords, sizeof(vertices[vertex].coords), key);
+    }
+  }
+  return key;
+}
+
 std::vector<unsigned int> seissol::writer::WaveFieldWriter::generateRefinedClusteringData(
-    refinement::MeshRefiner<double>* meshRefiner,
+    std::size_t numCells,
+    std::size_t kSubCellsPerCell,
     const std::vector<unsigned>& LtsClusteringData,
     std::map<int, int>& newToOldCellMap) {
   // subsampling preserves the order of the cells, so we just need to repeat the LtsClusteringData
   // kSubCellsPerCell times. we also need to account for the extractRegion filter via the
   // newToOldCellMap hash map
-  std::vector<unsigned int> refinedClusteringData(meshRefiner->getNumCells());
+  std::vector<unsigned int> refinedClusteringData(numCells);
 
-  size_t kSubCellsPerCell = static_cast<size_t>(meshRefiner->getkSubCellsPerCell());
-  for (size_t j = 0; j < meshRefiner->getNumCells(); j++) {
+  for (size_t j = 0; j < numCells; j++) {
     if (isExtractRegionEnabled) {
       refinedClusteringData[j] =
           LtsClusteringData.data()[newToOldCellMap[static_cast<size_t>(j / kSubCellsPerCell)]];
@@ -159,7 +190,7 @@ void seissol::writer::WaveFieldWriter::init(unsigned int numVars,
                                             int* plasticityMask,
                                             const double* outputRegionBounds,
                                             const std::unordered_set<int>& outputGroups,
-                                            xdmfwriter::BackendType backend) {
+                                            OutputBackend backend) {
   if (!m_enabled)
     return;
 
@@ -184,6 +215,15 @@ void seissol::writer::WaveFieldWriter::init(unsigned int numVars,
 
   param.backend = backend;
 
+  // Modal output writes the coefficients on the unrefined mesh
+  const bool modal = refinement == ModalRefinement;
+  m_numBasisFunctions = modal ? order * (order + 1) * (order + 2) / 6 : 1;
+  param.numBasisFunctions = m_numBasisFunctions;
+  if (modal) {
+    logInfo(rank) << "Writing the" << m_numBasisFunctions << "modal coefficients of each variable.";
+    refinement = 0;
+  }
+
   //
   // High order I/O
   //
@@ -214,7 +254,7 @@ void seissol::writer::WaveFieldWriter::init(unsigned int numVars,
   std::map<int, int> newToOldCellMap;
   // Vertices of the extracted region
   std::vector<const Vertex*> subVertices;
-  // Mesh refiner
+  // Mesh refiner (not used if the refined mesh is read from the cache)
   refinement::MeshRefiner<double>* meshRefiner = nullptr;
 
   // If at least one of the outputRegionBounds is non-zero then extract.
@@ -278,22 +318,54 @@ void seissol::writer::WaveFieldWriter::init(unsigned int numVars,
 
     numElems = subElements.size();
     numVerts = subVertices.size();
-
-    meshRefiner = new refinement::MeshRefiner<double>(
-        subElements, subVertices, oldToNewVertexMap, *tetRefiner);
   } else {
-    meshRefiner = new refinement::MeshRefiner<double>(meshReader, *tetRefiner);
     m_map = map;
   }
 
-  if (numElems == 0) {
+  // The refined mesh of a previous run with the same input is read from the cache
+  std::unique_ptr<RefinedMeshCache> meshCache;
+  bool isMeshCached = false;
+  if (utils::Env::get<bool>("SEISSOL_WAVEFIELD_MESH_CACHE", false)) {
+    meshCache = std::make_unique<RefinedMeshCache>(
+        m_outputPrefix + "-mesh-cache." + std::to_string(rank) + ".bin",
+        refinedMeshKey(meshReader, subElements, refinement));
+    isMeshCached = meshCache->load();
+    if (isMeshCached) {
+      logInfo(rank) << "Read the refined wave field mesh from" << meshCache->fileName();
+    }
+  }
+  if (!isMeshCached) {
+    if (isExtractRegionEnabled) {
+      meshRefiner = new refinement::MeshRefiner<double>(
+          subElements, subVertices, oldToNewVertexMap, *tetRefiner);
+    } else {
+      meshRefiner = new refinement::MeshRefiner<double>(meshReader, *tetRefiner);
+    }
+    if (meshCache && !meshCache->store(meshRefiner->getCellData(), meshRefiner->getNumCells(),
+                                       meshRefiner->getVertexData(), meshRefiner->getNumVertices())) {
+      logWarning(rank) << "Could not write the refined wave field mesh to" << meshCache->fileName();
+    }
+  }
+  const std::size_t numRefinedCells = isMeshCached ? meshCache->numCells() : meshRefiner->getNumCells();
+  const std::size_t numRefinedVertices =
+      isMeshCached ? meshCache->numVertices() : meshRefiner->getNumVertices();
+  const unsigned int* refinedCells = isMeshCached ? meshCache->cells().data() : meshRefiner->getCellData();
+  const double* refinedVertices = isMeshCached ? meshCache->vertices().data() : meshRefiner->getVertexData();
+  const std::size_t kSubCellsPerCell = tetRefiner->getDivisionCount();
+
+  // Regions may be empty on some ranks, but not on all of them
+  unsigned long numTotalElems = numElems;
+#ifdef USE_MPI
+  MPI_Allreduce(MPI_IN_PLACE, &numTotalElems, 1, MPI_UNSIGNED_LONG, MPI_SUM, seissol::MPI::mpi.comm());
+#endif // USE_MPI
+  if (numTotalElems == 0) {
     logError() << "WaveFieldWriter: All elements have been filtered out (OutputRegionBounds and "
                   "OutputGroups).";
   }
 
   logInfo(rank) << "Refinement class initialized";
-  logDebug() << "Cells : " << numElems << "refined-to ->" << meshRefiner->getNumCells();
-  logDebug() << "Vertices : " << numVerts << "refined-to ->" << meshRefiner->getNumVertices();
+  logDebug() << "Cells : " << numElems << "refined-to ->" << numRefinedCells;
+  logDebug() << "Vertices : " << numVerts << "refined-to ->" << numRefinedVertices;
 
   m_variableSubsampler = std::make_unique<refinement::VariableSubsampler<double>>(
       numElems, *tetRefiner, order, numVars, numAlignedDOF);
@@ -309,32 +381,67 @@ void seissol::writer::WaveFieldWriter::init(unsigned int numVars,
   // Delete the tetRefiner since it is no longer required
   delete tetRefiner;
 
-  const unsigned int* const_cells = adjustOffsets(meshRefiner);
+  const unsigned int* const_cells = adjustOffsets(refinedCells, numRefinedCells, numRefinedVertices);
 
   // Create mesh buffers
-  param.bufferIds[CELLS] =
-      addSyncBuffer(const_cells, meshRefiner->getNumCells() * 4 * sizeof(unsigned int));
-  param.bufferIds[VERTICES] = addSyncBuffer(meshRefiner->getVertexData(),
-                                            meshRefiner->getNumVertices() * 3 * sizeof(double));
-  std::vector<unsigned int> refinedClusteringData =
-      generateRefinedClusteringData(meshRefiner, LtsClusteringData, newToOldCellMap);
-  param.bufferIds[CLUSTERING] = addSyncBuffer(refinedClusteringData.data(),
-                                              meshRefiner->getNumCells() * sizeof(unsigned int));
-
-  // Create data buffers
-  bool first = false;
-  for (unsigned int i = 0; i < m_numVariables; i++) {
-    if (m_outputFlags[i]) {
-      unsigned int id = addBuffer(0L, meshRefiner->getNumCells() * sizeof(real));
-      if (!first) {
-        param.bufferIds[VARIABLE0] = id;
-        first = true;
+  param.bufferIds[CELLS] = addSyncBuffer(const_cells, numRefinedCells * 4 * sizeof(unsigned int));
+  param.bufferIds[VERTICES] =
+      addSyncBuffer(refinedVertices, numRefinedVertices * 3 * sizeof(double));
+  std::vector<unsigned int> refinedClusteringData = generateRefinedClusteringData(
+      numRefinedCells, kSubCellsPerCell, LtsClusteringData, newToOldCellMap);
+  param.bufferIds[CLUSTERING] =
+      addSyncBuffer(refinedClusteringData.data(), numRefinedCells * sizeof(unsigned int));
+
+  // Zero copy output: the executor evaluates the variables from the dofs of the LTS tree
+  m_zeroCopy = utils::Env::get<bool>("SEISSOL_WAVEFIELD_ZERO_COPY", false) && refinement == 0 &&
+               !modal && !m_sampled;
+  param.zeroCopy = m_zeroCopy;
+  param.order = order;
+  param.numDofVariables = numVars;
+  param.numAlignedDOF = numAlignedDOF;
+  param.bufferIds[DOFS] = -1;
+  param.bufferIds[PSTRAIN] = -1;
+  param.bufferIds[CELL_MAP] = -1;
+  if (m_zeroCopy) {
+    // The buffers cover all cells up to the last one in the output
+    const std::size_t numDofCells =
+        numElems > 0 ? *std::max_element(m_map, m_map + numElems) + 1 : 0;
+    m_dofsSize = numDofCells * numVars * numAlignedDOF * sizeof(real);
+    m_pstrainSize = pstrain != nullptr ? numDofCells * WaveFieldWriterExecutor::NUM_PLASTICITY_VARIABLES *
+                                             numAlignedDOF * sizeof(real)
+                                       : 0;
+    // Without asynchronous output, ASYNC does not copy buffers with user memory
+    param.bufferIds[DOFS] = addBuffer(dofs, m_dofsSize);
+    param.bufferIds[PSTRAIN] = addBuffer(pstrain, m_pstrainSize);
+    param.bufferIds[CELL_MAP] = addSyncBuffer(m_map, numElems * sizeof(unsigned int));
+  } else {
+    // Create data buffers
+    bool first = false;
+    for (unsigned int i = 0; i < m_numVariables; i++) {
+      if (m_outputFlags[i]) {
+        unsigned int id =
+            addBuffer(0L, numRefinedCells * m_numBasisFunctions * sizeof(real));
+        if (!first) {
+          param.bufferIds[VARIABLE0] = id;
+          first = true;
+        }
       }
     }
   }
 
   // Save number of cells
-  m_numCells = meshRefiner->getNumCells();
+  m_numCells = numRefinedCells;
+#ifdef ACL_DEVICE
+  if (!m_zeroCopy) {
+    m_numDofCells = numElems > 0 ? *std::max_element(m_map, m_map + numElems) + 1 : 0;
+    m_dofsCellSize = numVars * numAlignedDOF;
+    m_cellsByDofs.resize(numElems);
+    std::iota(m_cellsByDofs.begin(), m_cellsByDofs.end(), 0);
+    std::sort(m_cellsByDofs.begin(), m_cellsByDofs.end(), [this](unsigned int a, unsigned int b) {
+      return m_map[a] < m_map[b];
+    });
+  }
+#endif // ACL_DEVICE
   // Set up for low order output flags
   m_lowOutputFlags = new bool[WaveFieldWriterExecutor::NUM_LOWVARIABLES];
   m_numIntegratedVariables = seissol::SeisSol::main.postProcessor().getNumberOfVariables();
@@ -361,7 +468,9 @@ void seissol::writer::WaveFieldWriter::init(unsigned int numVars,
       pLowMeshRefiner = new refinement::MeshRefiner<double>(meshReader, lowTetRefiner);
     }
 
-    const_lowCells = adjustOffsets(pLowMeshRefiner);
+    const_lowCells = adjustOffsets(pLowMeshRefiner->getCellData(),
+                                   pLowMeshRefiner->getNumCells(),
+                                   pLowMeshRefiner->getNumVertices());
 
     // Create mesh buffers
     param.bufferIds[LOWCELLS] =
@@ -393,9 +502,12 @@ void seissol::writer::WaveFieldWriter::init(unsigned int numVars,
 
   sendBuffer(param.bufferIds[OUTPUT_FLAGS], m_numVariables * sizeof(bool));
 
-  sendBuffer(param.bufferIds[CELLS], meshRefiner->getNumCells() * 4 * sizeof(unsigned int));
-  sendBuffer(param.bufferIds[VERTICES], meshRefiner->getNumVertices() * 3 * sizeof(double));
-  sendBuffer(param.bufferIds[CLUSTERING], meshRefiner->getNumCells() * sizeof(unsigned int));
+  sendBuffer(param.bufferIds[CELLS], numRefinedCells * 4 * sizeof(unsigned int));
+  sendBuffer(param.bufferIds[VERTICES], numRefinedVertices * 3 * sizeof(double));
+  sendBuffer(param.bufferIds[CLUSTERING], numRefinedCells * sizeof(unsigned int));
+  if (m_zeroCopy) {
+    sendBuffer(param.bufferIds[CELL_MAP], numElems * sizeof(unsigned int));
+  }
 
   if (integrals) {
     sendBuffer(param.bufferIds[LOWCELLS],
@@ -414,6 +526,9 @@ void seissol::writer::WaveFieldWriter::init(unsigned int numVars,
   removeBuffer(param.bufferIds[CELLS]);
   removeBuffer(param.bufferIds[VERTICES]);
   removeBuffer(param.bufferIds[CLUSTERING]);
+  if (m_zeroCopy) {
+    removeBuffer(param.bufferIds[CELL_MAP]);
+  }
   if (integrals) {
     removeBuffer(param.bufferIds[LOWCELLS]);
     removeBuffer(param.bufferIds[LOWVERTICES]);
@@ -432,14 +547,41 @@ void seissol::writer::WaveFieldWriter::init(unsigned int numVars,
   m_dofs = dofs;
   m_pstrain = pstrain;
   m_integrals = integrals;
+  if (integrals) {
+    seissol::SeisSol::main.postProcessor().setIntegrationCells(m_map, numElems);
+  }
 
   m_variableBufferIds[0] = param.bufferIds[VARIABLE0];
   m_variableBufferIds[1] = param.bufferIds[LOWVARIABLE0];
+  m_dofsBufferIds[0] = param.bufferIds[DOFS];
+  m_dofsBufferIds[1] = param.bufferIds[PSTRAIN];
 
   delete meshRefiner;
 }
 
-void seissol::writer::WaveFieldWriter::write(double time) {
+void seissol::writer::WaveFieldWriter::setWaveFieldInterval(double interval) {
+  m_interval = interval;
+  m_sampled = utils::Env::get("SEISSOL_WAVEFIELD_SAMPLING", "sync") == std::string("clusters");
+  // Sampled output only writes the last time step at the final synchronization
+  setSyncInterval(m_sampled ? std::numeric_limits<double>::max() : interval);
+}
+
+void seissol::writer::WaveFieldWriter::initSampling(GlobalData const* global,
+                                                    double startTime,
+                                                    std::size_t numberOfCells) {
+  logInfo(seissol::MPI::mpi.rank())
+      << "Sampling the wave field output every" << m_interval << "s in the time clusters.";
+  m_sampler.init(global, startTime, m_interval, m_dofs, numberOfCells);
+}
+
+void seissol::writer::WaveFieldWriter::writeSampledSnapshots() {
+  double time = 0.0;
+  while (m_sampler.popCompleteSnapshot(time, m_sampledDofs)) {
+    write(time, m_sampledDofs.data());
+  }
+}
+
+void seissol::writer::WaveFieldWriter::write(double time, const real* dofs) {
   SCOREP_USER_REGION("WaveFieldWriter_write", SCOREP_USER_REGION_TYPE_FUNCTION);
 
   if (!m_enabled)
@@ -452,36 +594,75 @@ void seissol::writer::WaveFieldWriter::write(double time) {
   SCOREP_USER_REGION_DEFINE(r_wait);
   SCOREP_USER_REGION_BEGIN(r_wait, "wavfieldwriter_wait", SCOREP_USER_REGION_TYPE_COMMON);
   logInfo(rank) << "Waiting for last wave field.";
+  Stopwatch waitStopwatch;
+  waitStopwatch.start();
   wait();
+  OutputBandwidth::bandwidth.recordSync(waitStopwatch.stop());
   SCOREP_USER_REGION_END(r_wait);
 
   logInfo(rank) << "Writing wave field at time" << utils::nospace << time << '.';
 
+  if (m_zeroCopy) {
+    // Takes the snapshot of the dofs for asynchronous output
+    assert(dofs == m_dofs);
+    sendBuffer(m_dofsBufferIds[0], m_dofsSize);
+    sendBuffer(m_dofsBufferIds[1], m_pstrainSize);
+  }
+
+#ifdef ACL_DEVICE
+  // Sampled snapshots are on the host already
+  const bool stagedDofs = !m_zeroCopy && dofs == m_dofs;
+  if (stagedDofs) {
+    subsampleStagedDofs(dofs);
+  }
+#else
+  const bool stagedDofs = false;
+#endif // ACL_DEVICE
+
+  // The sampled variables of the dofs and of the plastic strain are each evaluated with one matrix product per cell
+  std::vector<unsigned int> sampledVariables[2];
+  std::vector<real*> sampledBuffers[2];
+  std::vector<std::pair<unsigned int, real*>> outputs;
   unsigned int nextId = m_variableBufferIds[0];
-  for (unsigned int i = 0; i < m_numVariables; i++) {
+  for (unsigned int i = 0; !m_zeroCopy && i < m_numVariables; i++) {
     if (!m_outputFlags[i])
       continue;
 
     real* managedBuffer =
         async::Module<WaveFieldWriterExecutor, WaveFieldInitParam, WaveFieldParam>::managedBuffer<
             real*>(nextId);
-    if (i < m_numVariables - WaveFieldWriterExecutor::NUM_PLASTICITY_VARIABLES) {
-      m_variableSubsampler->get(m_dofs, m_map, i, managedBuffer);
+    outputs.emplace_back(nextId, managedBuffer);
+    nextId++;
+
+    const bool isPStrain = i >= m_numVariables - WaveFieldWriterExecutor::NUM_PLASTICITY_VARIABLES;
+    const auto& subsampler = isPStrain ? m_variableSubsamplerPStrain : m_variableSubsampler;
+    const real* data = isPStrain ? m_pstrain : dofs;
+    const unsigned int variable =
+        isPStrain ? i - (m_numVariables - WaveFieldWriterExecutor::NUM_PLASTICITY_VARIABLES) : i;
+    if (stagedDofs && !isPStrain) {
+      // Done by subsampleStagedDofs
+    } else if (m_numBasisFunctions > 1) {
+      subsampler->getCoefficients(data, m_map, variable, m_numBasisFunctions, managedBuffer);
     } else {
-      m_variableSubsamplerPStrain->get(
-          m_pstrain,
-          m_map,
-          i - (m_numVariables - WaveFieldWriterExecutor::NUM_PLASTICITY_VARIABLES),
-          managedBuffer);
+      sampledVariables[isPStrain].push_back(variable);
+      sampledBuffers[isPStrain].push_back(managedBuffer);
     }
-    for (unsigned int j = 0; j < m_numCells; j++) {
+  }
+  if (!sampledVariables[0].empty()) {
+    m_variableSubsampler->get(dofs, m_map, sampledVariables[0], sampledBuffers[0]);
+  }
+  if (!sampledVariables[1].empty()) {
+    m_variableSubsamplerPStrain->get(m_pstrain, m_map, sampledVariables[1], sampledBuffers[1]);
+  }
+
+  const unsigned int numValues = m_numCells * m_numBasisFunctions;
+  for (const auto& [id, managedBuffer] : outputs) {
+    for (unsigned int j = 0; j < numValues; j++) {
       if (!std::isfinite(managedBuffer[j])) {
         logError() << "Detected Inf/NaN in volume output. Aborting.";
       }
     }
-    sendBuffer(nextId, m_numCells * sizeof(real));
-
-    nextId++;
+    sendBuffer(id, numValues * sizeof(real));
   }
 
   // nextId is required in a manner similar to above for writing integrated variables
@@ -512,12 +693,65 @@ void seissol::writer::WaveFieldWriter::write(double time) {
 
   // Update last time step
   seissol::SeisSol::main.checkPointManager().header().value(m_timestepComp)++;
+  m_lastTime = time;
 
   m_stopwatch.pause();
 
   logInfo(rank) << "Writing wave field at time" << utils::nospace << time << ". Done.";
 }
 
+#ifdef ACL_DEVICE
+void seissol::writer::WaveFieldWriter::subsampleStagedDofs(const real* dofs) {
+  // The dofs variables and their output buffers, in the order of their ids
+  std::vector<unsigned int> variables;
+  std::vector<real*> buffers;
+  unsigned int nextId = m_variableBufferIds[0];
+  for (unsigned int i = 0; i < m_numVariables - WaveFieldWriterExecutor::NUM_PLASTICITY_VARIABLES; i++) {
+    if (m_outputFlags[i]) {
+      variables.push_back(i);
+      buffers.push_back(
+          async::Module<WaveFieldWriterExecutor, WaveFieldInitParam, WaveFieldParam>::managedBuffer<real*>(
+              nextId++));
+    }
+  }
+  if (variables.empty()) {
+    return;
+  }
+
+  m_staging.stage(dofs, m_numDofCells, m_dofsCellSize, [&](const real* cells, std::size_t begin, std::size_t end) {
+    const auto byDofs = [this](unsigned int cell, std::size_t dofsCell) { return m_map[cell] < dofsCell; };
+    const auto first =
+        std::lower_bound(m_cellsByDofs.begin(), m_cellsByDofs.end(), begin, byDofs) - m_cellsByDofs.begin();
+    const auto last =
+        std::lower_bound(m_cellsByDofs.begin(), m_cellsByDofs.end(), end, byDofs) - m_cellsByDofs.begin();
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif // _OPENMP
+    for (auto k = first; k < last; ++k) {
+      const unsigned int cell = m_cellsByDofs[k];
+      const real* cellData = &cells[(m_map[cell] - begin) * m_dofsCellSize];
+      if (m_numBasisFunctions > 1) {
+        for (std::size_t v = 0; v < variables.size(); ++v) {
+          m_variableSubsampler->getCellCoefficients(cellData, cell, variables[v], m_numBasisFunctions, buffers[v]);
+        }
+      } else {
+        m_variableSubsampler->getCell(cellData, cell, variables, buffers);
+      }
+    }
+  });
+}
+#endif // ACL_DEVICE
+
 void seissol::writer::WaveFieldWriter::simulationStart() { syncPoint(0.0); }
 
-void seissol::writer::WaveFieldWriter::syncPoint(double currentTime) { write(currentTime); }
+void seissol::writer::WaveFieldWriter::syncPoint(double currentTime) {
+  if (m_sampled) {
+    writeSampledSnapshots();
+    m_sampler.discardIncompleteSnapshots();
+    if (std::abs(currentTime - m_lastTime) < seissol::SeisSol::main.timeManager().getTimeTolerance()) {
+      return;
+    }
+  }
+  write(currentTime);
+}
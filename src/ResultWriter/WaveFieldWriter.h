@@ -45,6 +45,9 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <string>
 #include <vector>
 #include <memory>
@@ -56,7 +59,9 @@
 
 #include "Checkpoint/DynStruct.h"
 #include "Geometry/refinement/VariableSubSampler.h"
+#include "Kernels/WaveFieldSampler.h"
 #include "Monitoring/Stopwatch.h"
+#include "Solver/Pipeline/HostStaging.h"
 #include "WaveFieldWriterExecutor.h"
 #include <Modules/Module.h>
 
@@ -87,6 +92,16 @@ class WaveFieldWriter : private async::Module<WaveFieldWriterExecutor, WaveField
 	/** Variable buffer ids (high and low order variables) */
 	int m_variableBufferIds[2];
 
+	/** True if the executor reads the dofs and the plastic strain without intermediate buffers */
+	bool m_zeroCopy;
+
+	/** Buffer ids of the dofs and the plastic strain (zero copy output) */
+	int m_dofsBufferIds[2];
+
+	/** Sizes of the dofs and the plastic strain buffers in bytes (zero copy output) */
+	std::size_t m_dofsSize;
+	std::size_t m_pstrainSize;
+
 	/** The output prefix for the filename */
 	std::string m_outputPrefix;
 
@@ -111,6 +126,9 @@ class WaveFieldWriter : private async::Module<WaveFieldWriterExecutor, WaveField
 	/** Refined number of cells */
 	unsigned int m_numCells;
 
+	/** Number of modal coefficients written per cell and variable (1 for sampled output) */
+	unsigned int m_numBasisFunctions;
+
 	/** Unrefined (low order) number of cells */
 	unsigned int m_numLowCells;
 
@@ -129,6 +147,38 @@ class WaveFieldWriter : private async::Module<WaveFieldWriterExecutor, WaveField
 	/** The stopwatch for the frontend */
 	Stopwatch m_stopwatch;
 
+	/** Interval of the output */
+	double m_interval;
+
+	/** True if the time clusters sample the output without synchronization points */
+	bool m_sampled;
+
+	/** Samples the degrees of freedom in the time clusters */
+	kernels::WaveFieldSampler m_sampler;
+
+	/** Buffer for the sampled degrees of freedom */
+	std::vector<real> m_sampledDofs;
+
+	/** Time of the last written time step */
+	double m_lastTime;
+
+#ifdef ACL_DEVICE
+	/** Copies the dofs from the device in batches, which are subsampled while the next one is copied */
+	HostStaging m_staging;
+
+	/** Output cells in the order of their dofs cells */
+	std::vector<unsigned int> m_cellsByDofs;
+
+	/** Number of dofs cells up to the last one in the output */
+	std::size_t m_numDofCells = 0;
+
+	/** Number of reals per dofs cell */
+	std::size_t m_dofsCellSize = 0;
+
+	/** Subsamples the variables of the dofs (not the plastic strain) into the output buffers */
+	void subsampleStagedDofs(const real* dofs);
+#endif // ACL_DEVICE
+
 	/** Checks if a vertex given by the vertexCoords lies inside the boxBounds */
 	/*   The boxBounds is in the format: xMin, xMax, yMin, yMax, zMin, zMax */
 	bool vertexInBox(const double * const boxBounds, const double * const vertexCoords) {
@@ -143,20 +193,35 @@ class WaveFieldWriter : private async::Module<WaveFieldWriterExecutor, WaveField
   
   refinement::TetrahedronRefiner<double>* createRefiner(int refinement);
   
-  unsigned const* adjustOffsets(refinement::MeshRefiner<double>* meshRefiner);
-	std::vector<unsigned int> generateRefinedClusteringData(refinement::MeshRefiner<double>* meshRefiner,
+  unsigned const* adjustOffsets(const unsigned int* cellData, std::size_t numCells, std::size_t numVertices);
+	std::vector<unsigned int> generateRefinedClusteringData(std::size_t numCells, std::size_t kSubCellsPerCell,
 		const std::vector<unsigned> &LtsClusteringData, std::map<int, int> &newToOldCellMap);
 
+	/** Identifies the refined mesh in the cache, see RefinedMeshCache */
+	std::uint64_t refinedMeshKey(const MeshReader &meshReader, const std::vector<const Element*> &subElements,
+		int refinement);
+
+	/**
+	 * Write a time step of the given degrees of freedom
+	 */
+	void write(double time, const real* dofs);
+
 public:
+	/** Value of the refinement parameter which selects the output of the modal coefficients */
+	static constexpr int ModalRefinement = -1;
+
 	WaveFieldWriter()
 		: m_enabled(false),
       isExtractRegionEnabled(false),
+      m_zeroCopy(false), m_dofsBufferIds{-1, -1}, m_dofsSize(0), m_pstrainSize(0),
       m_numVariables(0),
       m_outputFlags(0L),
       m_lowOutputFlags(0L),
-      m_numCells(0), m_numLowCells(0),
+      m_numCells(0), m_numBasisFunctions(1), m_numLowCells(0),
       m_dofs(0L), m_pstrain(0L), m_integrals(0L),
-      m_map(0L)
+      m_map(0L),
+      m_interval(0), m_sampled(false),
+      m_lastTime(-std::numeric_limits<double>::infinity())
 	{
 	}
 
@@ -186,9 +251,36 @@ public:
 	 */
 	void setUp();
 
-  void setWaveFieldInterval(double interval) {
-    setSyncInterval(interval);
-  }
+  /**
+   * Sets the output interval; with SEISSOL_WAVEFIELD_SAMPLING=clusters, the output does not add
+   * synchronization points but is sampled by the time clusters (see initSampling).
+   */
+  void setWaveFieldInterval(double interval);
+
+	/**
+	 * @return True if the time clusters sample the output
+	 */
+	bool isSampled() const
+	{
+		return m_enabled && m_sampled;
+	}
+
+	/**
+	 * Initialize the sampling in the time clusters, which have to be added to sampler() afterwards
+	 *
+	 * @param numberOfCells The number of cells of the dofs variable
+	 */
+	void initSampling(GlobalData const* global, double startTime, std::size_t numberOfCells);
+
+	kernels::WaveFieldSampler& sampler()
+	{
+		return m_sampler;
+	}
+
+	/**
+	 * Writes the snapshots which were sampled by all time clusters
+	 */
+	void writeSampledSnapshots();
 
 	/**
 	 * Initialize the wave field ouput
@@ -205,12 +297,15 @@ public:
             int* plasticityMask,
             const double* outputRegionBounds,
             const std::unordered_set<int>& outputGroups,
-            xdmfwriter::BackendType backend);
+            OutputBackend backend);
 
 	/**
 	 * Write a time step
 	 */
-	void write(double time);
+	void write(double time)
+	{
+		write(time, m_dofs);
+	}
 
 	/**
 	 * Close wave field writer and free resources
@@ -43,15 +43,25 @@
 #include "Parallel/MPI.h"
 
 #include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <string>
 #include <vector>
 
 #include "utils/logger.h"
 
-#include "xdmfwriter/XdmfWriter.h"
+#include "MeshWriter.h"
 
 #include "async/ExecInfo.h"
 
+#include "Kernels/precision.hpp"
+#include "Geometry/refinement/RefinerUtils.h"
+#include "Geometry/refinement/VariableSubSampler.h"
 #include "Monitoring/Stopwatch.h"
+#include "OutputBandwidth.h"
+#include "OutputQuantization.h"
+#include "OutputQueue.h"
 
 namespace seissol
 {
@@ -71,7 +81,10 @@ enum BufferTags {
 	LOWVERTICES,
 	LOW_OUTPUT_FLAGS,
 	LOWVARIABLE0,
-	BUFFERTAG_MAX = LOWVARIABLE0
+	DOFS,
+	PSTRAIN,
+	CELL_MAP,
+	BUFFERTAG_MAX = CELL_MAP
 };
 
 struct WaveFieldInitParam
@@ -79,7 +92,19 @@ struct WaveFieldInitParam
 	int timestep;
 
 	int bufferIds[BUFFERTAG_MAX+1];
-  xdmfwriter::BackendType backend;
+  OutputBackend backend;
+
+	/** Number of values per cell and variable (modal coefficients or 1 for sampled output) */
+	unsigned int numBasisFunctions;
+
+	/**
+	 * True if the executor evaluates the variables from the DOFS and PSTRAIN buffers,
+	 * which are registered on the storage of the LTS tree
+	 */
+	bool zeroCopy;
+	int order;
+	unsigned int numDofVariables;
+	unsigned int numAlignedDOF;
 };
 
 struct WaveFieldParam
@@ -91,10 +116,10 @@ class WaveFieldWriterExecutor
 {
 private:
 	/** The XMDF Writer used for the wave field */
-	xdmfwriter::XdmfWriter<xdmfwriter::TETRAHEDRON, double, real>* m_waveFieldWriter;
+	MeshWriter<xdmfwriter::TETRAHEDRON>* m_waveFieldWriter;
 
 	/** The XDMF Writer for low order data */
-	xdmfwriter::XdmfWriter<xdmfwriter::TETRAHEDRON, double, real>* m_lowWaveFieldWriter;
+	MeshWriter<xdmfwriter::TETRAHEDRON>* m_lowWaveFieldWriter;
 
 	/** Buffer id for the first variable for high and low order output */
 	unsigned int m_variableBufferIds[2];
@@ -108,6 +133,35 @@ private:
 	/** Flags indicating which low order variables should be written */
 	const bool* m_lowOutputFlags;
 
+	/** Number of values per cell and (high order) variable */
+	unsigned int m_numBasisFunctions;
+
+	/** Number of (high order) cells */
+	unsigned int m_numCells;
+
+	/** Names of the modal coefficients */
+	std::vector<std::string> m_modalNames;
+
+	/** Evaluates the variables at the cell centers from the dofs (zero copy output) */
+	std::unique_ptr<refinement::VariableSubsampler<double>> m_subsampler;
+	std::unique_ptr<refinement::VariableSubsampler<double>> m_subsamplerPStrain;
+
+	/** Buffer ids of the dofs and the plastic strain (zero copy output) */
+	int m_dofsBufferIds[2];
+
+	/** Copy of the mapping from the cell order to the dofs order (zero copy output) */
+	std::vector<unsigned int> m_cellMap;
+
+	/** Number of variables of the dofs */
+	unsigned int m_numDofVariables;
+
+	/** Values of the variable that is currently written (zero copy output) */
+	std::vector<real> m_values;
+
+	/** Error-bounded quantization of the high and low order variables */
+	OutputQuantizer m_quantizer;
+	OutputQuantizer m_lowQuantizer;
+
 #ifdef USE_MPI
 	/** The MPI communicator for the XDMF writer */
 	MPI_Comm m_comm;
@@ -122,7 +176,11 @@ public:
 		  m_lowWaveFieldWriter(0L),
 		  m_numVariables(0),
 		  m_outputFlags(0L),
-		  m_lowOutputFlags(0L)
+		  m_lowOutputFlags(0L),
+		  m_numBasisFunctions(1),
+		  m_numCells(0),
+		  m_dofsBufferIds{-1, -1},
+		  m_numDofVariables(0)
 #ifdef USE_MPI
 		  , m_comm(MPI_COMM_NULL)
 #endif // USE_MPI
@@ -138,7 +196,7 @@ public:
 
 		int rank = seissol::MPI::mpi.rank();
 
-		xdmfwriter::BackendType type = param.backend;
+		OutputBackend type = param.backend;
 
 		const char* outputPrefix = static_cast<const char*>(info.buffer(param.bufferIds[OUTPUT_PREFIX]));
 
@@ -148,31 +206,8 @@ public:
 		m_numVariables = info.bufferSize(param.bufferIds[OUTPUT_FLAGS]) / sizeof(bool);
 		m_outputFlags = static_cast<const bool*>(info.buffer(param.bufferIds[OUTPUT_FLAGS]));
 
-
-		const char* varNames[20] = {
-			"sigma_xx",
-			"sigma_yy",
-			"sigma_zz",
-			"sigma_xy",
-			"sigma_yz",
-			"sigma_xz",
-			"u",
-			"v",
-			"w",
-#ifdef USE_POROELASTIC
-			"p",
-			"u_f",
-			"v_f",
-			"w_f",
-#endif
-			"ep_xx",
-			"ep_yy",
-			"ep_zz",
-			"ep_xy",
-			"ep_yz",
-			"ep_xz",
-			"eta"
-		};
+		m_numBasisFunctions = param.numBasisFunctions;
+		m_numCells = info.bufferSize(param.bufferIds[CELLS]) / (4*sizeof(unsigned int));
 
 		std::vector<const char*> variables;
 		for (unsigned int i = 0; i < m_numVariables; i++) {
@@ -182,9 +217,19 @@ public:
 #else
 				assert(i < 16);
 #endif
-				variables.push_back(varNames[i]);
+				if (m_numBasisFunctions == 1) {
+					variables.push_back(VariableNames[i]);
+				} else {
+					// Modal output: one variable per coefficient, e.g. u_m0, u_m1, ...
+					for (unsigned int b = 0; b < m_numBasisFunctions; b++) {
+						m_modalNames.push_back(std::string(VariableNames[i]) + "_m" + std::to_string(b));
+					}
+				}
       }
 		}
+		for (const auto& name : m_modalNames) {
+			variables.push_back(name.c_str());
+		}
 
 #ifdef USE_MPI
 	// Split the communicator into two - those containing vertices and those
@@ -198,14 +243,15 @@ public:
 #endif // USE_MPI
 
 		// Initialize the I/O handler and write the mesh
-		m_waveFieldWriter = new xdmfwriter::XdmfWriter<xdmfwriter::TETRAHEDRON, double, real>(
-			type, outputPrefix, param.timestep);
+		m_waveFieldWriter = new MeshWriter<xdmfwriter::TETRAHEDRON>(
+			type, outputPrefix, "wavefield", param.timestep);
 
 #ifdef USE_MPI
 		m_waveFieldWriter->setComm(m_comm);
 #endif // USE_MPI
 
 		m_waveFieldWriter->init(variables, std::vector<const char*>(), true, true, true);
+		m_quantizer.init(variables);
 		m_waveFieldWriter->setMesh(
 			info.bufferSize(param.bufferIds[CELLS]) / (4*sizeof(unsigned int)),
 			static_cast<const unsigned int*>(info.buffer(param.bufferIds[CELLS])),
@@ -242,14 +288,15 @@ public:
 				}
 			}
 
-			m_lowWaveFieldWriter = new xdmfwriter::XdmfWriter<xdmfwriter::TETRAHEDRON, double, real>(
-				type, (std::string(outputPrefix)+"-low").c_str());
+			m_lowWaveFieldWriter = new MeshWriter<xdmfwriter::TETRAHEDRON>(
+				type, (std::string(outputPrefix)+"-low").c_str(), "wavefield-low");
 
 #ifdef USE_MPI
 		m_lowWaveFieldWriter->setComm(m_comm);
 #endif // USE_MPI
 
 			m_lowWaveFieldWriter->init(lowVariables, std::vector<const char*>());
+			m_lowQuantizer.init(lowVariables);
 			m_lowWaveFieldWriter->setMesh(
 				info.bufferSize(param.bufferIds[LOWCELLS]) / (4*sizeof(unsigned int)),
 				static_cast<const unsigned int*>(info.buffer(param.bufferIds[LOWCELLS])),
@@ -264,6 +311,20 @@ public:
 		m_variableBufferIds[0] = param.bufferIds[VARIABLE0];
 		m_variableBufferIds[1] = param.bufferIds[LOWVARIABLE0];
 
+		if (param.zeroCopy) {
+			const refinement::IdentityRefiner<double> identityRefiner;
+			m_numDofVariables = param.numDofVariables;
+			m_subsampler = std::make_unique<refinement::VariableSubsampler<double>>(
+				m_numCells, identityRefiner, param.order, param.numDofVariables, param.numAlignedDOF);
+			m_subsamplerPStrain = std::make_unique<refinement::VariableSubsampler<double>>(
+				m_numCells, identityRefiner, param.order, static_cast<unsigned int>(NUM_PLASTICITY_VARIABLES), param.numAlignedDOF);
+			const auto* cellMap = static_cast<const unsigned int*>(info.buffer(param.bufferIds[CELL_MAP]));
+			m_cellMap.assign(cellMap, cellMap + m_numCells);
+			m_dofsBufferIds[0] = param.bufferIds[DOFS];
+			m_dofsBufferIds[1] = param.bufferIds[PSTRAIN];
+			logInfo(rank) << "Evaluating the wave field output from the dofs without intermediate buffers.";
+		}
+
 		logInfo(rank) << "Initializing XDMF wave field output. Done.";
 #ifdef USE_MPI
 	}
@@ -281,41 +342,45 @@ public:
 	// Execute this function only if m_waveFieldWriter is initialized
 		if (m_waveFieldWriter != 0L) {
 #endif // USE_MPI
-		m_stopwatch.start();
-
-		// High order output
-		m_waveFieldWriter->addTimeStep(param.time);
-
+		std::vector<const real*> data;
+		std::vector<std::size_t> sizes;
+		// Zero copy output: the snapshots in the background need their own values
+		std::vector<std::vector<real>> values;
 		unsigned int nextId = 0;
 		for (unsigned int i = 0; i < m_numVariables; i++) {
 			if (m_outputFlags[i]) {
-				m_waveFieldWriter->writeCellData(nextId,
-					static_cast<const real*>(info.buffer(m_variableBufferIds[0]+nextId)));
-
+				if (!m_subsampler) {
+					data.push_back(static_cast<const real*>(info.buffer(m_variableBufferIds[0]+nextId)));
+				} else if (OutputQueue::queue.enabled()) {
+					values.emplace_back(m_numCells);
+					evaluate(info, i, values.back().data());
+					data.push_back(values.back().data());
+				} else {
+					// Evaluated while writing
+					data.push_back(nullptr);
+				}
+				sizes.push_back(static_cast<std::size_t>(m_numCells) * m_numBasisFunctions);
 				nextId++;
 			}
 		}
-
-		m_waveFieldWriter->flush();
-
-		// Low order output
+		const unsigned int numHighVariables = nextId;
 		if (m_lowWaveFieldWriter) {
-			m_lowWaveFieldWriter->addTimeStep(param.time);
-
-		nextId = 0;
-		for (unsigned int i = 0; i < NUM_LOWVARIABLES; i++) {
-			if (m_lowOutputFlags[i]) {
-				m_lowWaveFieldWriter->writeCellData(nextId,
-					static_cast<const real*>(info.buffer(m_variableBufferIds[1]+nextId)));
-
-			nextId++;
+			nextId = 0;
+			for (unsigned int i = 0; i < NUM_LOWVARIABLES; i++) {
+				if (m_lowOutputFlags[i]) {
+					data.push_back(static_cast<const real*>(info.buffer(m_variableBufferIds[1]+nextId)));
+					sizes.push_back(info.bufferSize(m_variableBufferIds[1]+nextId) / sizeof(real));
+					nextId++;
+				}
 			}
 		}
 
-			m_lowWaveFieldWriter->flush();
-		}
-
-		m_stopwatch.pause();
+		// info is only used by synchronous writes, which evaluate the variables from the dofs
+		OutputQueue::queue.submitSnapshot(data, sizes,
+			[this, &info, time = param.time, numHighVariables](const std::vector<const real*>& snapshot,
+				const std::vector<std::size_t>& snapshotSizes) {
+				write(info, time, numHighVariables, snapshot, snapshotSizes);
+			});
 #ifdef USE_MPI
 		}
 #endif // USE_MPI
@@ -323,6 +388,9 @@ public:
 
 	void finalize()
 	{
+		// Write the pending snapshots before closing the files
+		OutputQueue::queue.drain();
+
 		if (m_waveFieldWriter) {
 			m_stopwatch.printTime("Time wave field writer backend:"
 #ifdef USE_MPI
@@ -342,12 +410,114 @@ public:
 		m_waveFieldWriter = 0L;
 		delete m_lowWaveFieldWriter;
 		m_lowWaveFieldWriter = 0L;
+		m_modalNames.clear();
+		m_subsampler.reset();
+		m_subsamplerPStrain.reset();
+		m_cellMap.clear();
+		m_values.clear();
+	}
+
+private:
+	/**
+	 * Evaluates a variable at the cell centers from the dofs or the plastic strain (zero copy output)
+	 */
+	void evaluate(const async::ExecInfo &info, unsigned int variable, real* values) const
+	{
+		const bool isPStrain = variable >= m_numDofVariables;
+		const auto* source = static_cast<const real*>(info.buffer(m_dofsBufferIds[isPStrain ? 1 : 0]));
+		const auto& subsampler = isPStrain ? m_subsamplerPStrain : m_subsampler;
+		subsampler->get(source, m_cellMap.data(), isPStrain ? variable - m_numDofVariables : variable, values);
+		for (unsigned int j = 0; j < m_numCells; j++) {
+			if (!std::isfinite(values[j])) {
+				logError() << "Detected Inf/NaN in volume output. Aborting.";
+			}
+		}
+	}
+
+	/**
+	 * Writes the high order variables followed by the low order variables;
+	 * high order variables without data are evaluated from the dofs (zero copy output)
+	 */
+	void write(const async::ExecInfo &info, double time, unsigned int numHighVariables,
+		const std::vector<const real*>& data, const std::vector<std::size_t>& sizes)
+	{
+		m_stopwatch.start();
+
+		// High order output
+		m_waveFieldWriter->addTimeStep(time);
+
+		unsigned int outputVariable = 0;
+		for (unsigned int i = 0; i < numHighVariables; i++) {
+			while (!m_outputFlags[outputVariable]) {
+				outputVariable++;
+			}
+			const real* values = data[i];
+			if (values == nullptr) {
+				m_values.resize(m_numCells);
+				evaluate(info, outputVariable, m_values.data());
+				values = m_values.data();
+			}
+			outputVariable++;
+
+			for (unsigned int b = 0; b < m_numBasisFunctions; b++) {
+				const unsigned int variable = i * m_numBasisFunctions + b;
+				m_waveFieldWriter->writeCellData(variable,
+					m_quantizer.apply(variable, values + b * m_numCells, m_numCells));
+			}
+		}
+
+		m_waveFieldWriter->flush();
+
+		std::size_t bytes = static_cast<std::size_t>(numHighVariables) * m_numBasisFunctions * m_numCells * sizeof(real);
+
+		// Low order output
+		if (m_lowWaveFieldWriter) {
+			m_lowWaveFieldWriter->addTimeStep(time);
+
+			for (unsigned int i = numHighVariables; i < data.size(); i++) {
+				const unsigned int variable = i - numHighVariables;
+				m_lowWaveFieldWriter->writeCellData(variable,
+					m_lowQuantizer.apply(variable, data[i], sizes[i]));
+				bytes += sizes[i] * sizeof(real);
+			}
+
+			m_lowWaveFieldWriter->flush();
+		}
+
+		OutputBandwidth::bandwidth.recordWrite(bytes, m_stopwatch.split());
+		m_stopwatch.pause();
 	}
 
 public:
 	static const unsigned int NUM_PLASTICITY_VARIABLES = 7;
 	static const unsigned int NUM_INTEGRATED_VARIABLES = 9;
 	static const unsigned int NUM_LOWVARIABLES = NUM_INTEGRATED_VARIABLES;
+
+	/** Names of the high order variables (the quantities followed by the plastic strain) */
+	static constexpr const char* VariableNames[] = {
+		"sigma_xx",
+		"sigma_yy",
+		"sigma_zz",
+		"sigma_xy",
+		"sigma_yz",
+		"sigma_xz",
+		"u",
+		"v",
+		"w",
+#ifdef USE_POROELASTIC
+		"p",
+		"u_f",
+		"v_f",
+		"w_f",
+#endif
+		"ep_xx",
+		"ep_yy",
+		"ep_zz",
+		"ep_xy",
+		"ep_yz",
+		"ep_xz",
+		"eta"
+	};
 };
 
 }
@@ -41,22 +41,35 @@
 #ifndef RESULTWRITER_COMMON_HPP_
 #define RESULTWRITER_COMMON_HPP_
 
+#include <cstring>
+
 #include <xdmfwriter/backends/Backend.h>
+#include "utils/logger.h"
+
 namespace seissol
 {
 namespace writer
 {
 
-static xdmfwriter::BackendType backendType(char const* xdmfWriterBackend) {
-  xdmfwriter::BackendType type = xdmfwriter::POSIX;
+//! Backend of the wave field, free surface and fault output (xdmfWriterBackend)
+enum class OutputBackend { Posix, Hdf5, Adios2 };
+
+inline OutputBackend backendType(char const* xdmfWriterBackend) {
+  OutputBackend type = OutputBackend::Posix;
   if (strcmp(xdmfWriterBackend, "hdf5") == 0) {
 #ifdef USE_HDF
-    type = xdmfwriter::H5;
+    type = OutputBackend::Hdf5;
 #else
     logError() << "SeisSol is not compiled with hdf5 support.";
+#endif
+  } else if (strcmp(xdmfWriterBackend, "adios2") == 0) {
+#ifdef USE_ADIOS2
+    type = OutputBackend::Adios2;
+#else
+    logError() << "SeisSol is not compiled with ADIOS2 support.";
 #endif
   } else if (strcmp(xdmfWriterBackend, "posix") == 0) {
-    type = xdmfwriter::POSIX;
+    type = OutputBackend::Posix;
   } else {
     logError() << "Unknown backend type: " << xdmfWriterBackend;
   }
@@ -64,6 +77,16 @@ static xdmfwriter::BackendType backendType(char const* xdmfWriterBackend) {
   return type;
 }
 
+//! Backend of the XDMF writer; the ADIOS2 output does not use the XDMF writer
+inline xdmfwriter::BackendType xdmfBackendType([[maybe_unused]] OutputBackend backend) {
+#ifdef USE_HDF
+  if (backend == OutputBackend::Hdf5) {
+    return xdmfwriter::H5;
+  }
+#endif
+  return xdmfwriter::POSIX;
+}
+
 }
 }
 
@@ -271,6 +271,9 @@ CONTAINS
     real, allocatable  :: phiAtPoint(:)
     real, dimension( NUMBER_OF_BASIS_FUNCTIONS, NUMBER_OF_QUANTITIES ) :: DOFiElem_ptr ! no: it's not a pointer..
     real, dimension( NUMBER_OF_BASIS_FUNCTIONS, NUMBER_OF_QUANTITIES ) :: DOFiNeigh_ptr ! no pointer again
+    INTEGER :: nDofFaces, iDofCell
+    INTEGER, ALLOCATABLE :: DofSlot(:), DofMeshIds(:), DofFaceIds(:)            ! cells (or face neighbors) of the faces with output points
+    REAL, ALLOCATABLE    :: FaceDofs(:,:,:,:)                                 ! DOFs of both sides of these faces
     !-------------------------------------------------------------------------!
     INTENT(IN)    :: BND, DISC, EQN, MESH, MaterialVal, time
     INTENT(INOUT) :: DynRup_output
@@ -297,6 +300,52 @@ CONTAINS
     ELSE
         SubElem = 1
     ENDIF
+    ! Get the DOFs of both sides of each fault face with output points in one call, instead of per output point
+    ALLOCATE(DofSlot(MESH%Fault%nSide))
+    DofSlot(:) = 0
+    nDofFaces = 0
+    DO iOutPoints = 1,nOutPoints
+       iFace = DynRup_output%RecPoint(iOutPoints)%index
+       IF (DofSlot(iFace).EQ.0) THEN
+          nDofFaces = nDofFaces + 1
+          DofSlot(iFace) = nDofFaces
+       ENDIF
+    ENDDO
+    ALLOCATE(DofMeshIds(2*nDofFaces), DofFaceIds(2*nDofFaces))
+    ALLOCATE(FaceDofs(NUMBER_OF_BASIS_FUNCTIONS, NUMBER_OF_QUANTITIES, 2, nDofFaces))
+    DO iFace = 1,MESH%Fault%nSide
+       IF (DofSlot(iFace).EQ.0) CYCLE
+       iDofCell = 2*DofSlot(iFace) - 1
+       iElem              = MESH%Fault%Face(iFace,1,1)
+       iSide              = MESH%Fault%Face(iFace,2,1)
+       iNeighbor          = MESH%Fault%Face(iFace,1,2)
+       iLocalNeighborSide = MESH%Fault%Face(iFace,2,2)
+       ! Face id 0 denotes the cell itself; otherwise the DOFs of the face neighbor of the cell are used
+       IF (iElem == 0) THEN
+          DofMeshIds(iDofCell) = iNeighbor
+          DofFaceIds(iDofCell) = iLocalNeighborSide
+       ELSE
+          DofMeshIds(iDofCell) = iElem
+          DofFaceIds(iDofCell) = 0
+       ENDIF
+       IF (iNeighbor == 0) THEN
+          DofMeshIds(iDofCell+1) = iElem
+          DofFaceIds(iDofCell+1) = iSide
+       ELSE
+          DofMeshIds(iDofCell+1) = iNeighbor
+          DofFaceIds(iDofCell+1) = 0
+       ENDIF
+    ENDDO
+    IF (nDofFaces.GT.0) THEN
+       call c_interoperability_getBulkDofsFromDerivatives( i_numberOfCells = 2*nDofFaces, &
+                                                           i_meshIds       = DofMeshIds,  &
+                                                           i_faceIds       = DofFaceIds,  &
+                                                           o_dofs          = FaceDofs )
+    ENDIF
+    !
+    ! The receivers are independent of each other: each one only writes its own row of OutVal and TmpState
+    !$omp parallel do schedule(dynamic, 64) default(private) &
+    !$omp shared(DynRup_output, DISC, EQN, MESH, MaterialVal, BND, IO, MPI, time, nOutPoints, SubElem, DofSlot, FaceDofs)
     DO iOutPoints = 1,nOutPoints                                               ! loop over number of output receivers for this domain
           !
           iFace               = DynRup_output%RecPoint(iOutPoints)%index       ! current receiver location
@@ -309,23 +358,14 @@ CONTAINS
           w_speed(:)      = DISC%Galerkin%WaveSpeed(iElem,:)
           rho             = MaterialVal(iElem,1)
           !
-          if( iElem == 0 ) then
-            call c_interoperability_getNeighborDofsFromDerivatives( i_meshId = iNeighbor, &
-                                                                    i_faceId = iLocalNeighborSide, &
-                                                                    o_dofs   = dofiElem_ptr )
-          else
-            call c_interoperability_getDofsFromDerivatives( i_meshId = iElem, &
-                                                            o_dofs   = DOFiElem_ptr)
-          endif
+          DOFiElem_ptr  = FaceDofs(:,:,1,DofSlot(iFace))
+          DOFiNeigh_ptr = FaceDofs(:,:,2,DofSlot(iFace))
 
           IF (iNeighbor == 0) THEN
             ! iNeighbor is in the neighbor domain
             ! The neighbor element belongs to a different MPI domain
             iObject  = MESH%ELEM%BoundaryToObject(iSide,iElem)
             MPIIndex = MESH%ELEM%MPINumber(iSide,iElem)
-            call c_interoperability_getNeighborDofsFromDerivatives( i_meshId = iElem, &
-                                                                    i_faceId = iSide, &
-                                                                    o_dofs   = DOFiNeigh_ptr )
 
             ! Bimaterial case only possible for elastic isotropic materials
             TmpMat(:)   = BND%ObjMPI(iObject)%NeighborBackground(:,MPIIndex)
@@ -337,8 +377,6 @@ CONTAINS
             w_speed_neig(3) = w_speed_neig(2)
           ELSE
             ! normal case: iNeighbor present in local domain
-            call c_interoperability_getDofsFromDerivatives( i_meshId = iNeighbor, &
-                                                            o_dofs   = DOFiNeigh_ptr )
             w_speed_neig(:) = DISC%Galerkin%WaveSpeed(iNeighbor,:)
             rho_neig        = MaterialVal(iNeighbor,1)
           ENDIF
@@ -749,6 +787,9 @@ CONTAINS
           DynRup_output%TmpState(iOutPoints,DynRup_output%CurrentPick(iOutPoints),:) = DynRup_output%OutVal(iOutPoints,1,:)
           !
     ENDDO ! iOutPoints = 1,nOutPoints
+    !$omp end parallel do
+    !
+    DEALLOCATE(DofSlot, DofMeshIds, DofFaceIds, FaceDofs)
     !
     CONTINUE
 
@@ -54,8 +54,10 @@
 
 #include "SeisSol.h"
 #include "Modules/Modules.h"
+#include "Parallel/HostArch.h"
 #include "Parallel/MPI.h"
 #include "Parallel/Pin.h"
+#include "ResultWriter/OutputQueue.h"
 
 // Autogenerated file
 #include "version.h"
@@ -80,12 +82,14 @@ bool seissol::SeisSol::init(int argc, char* argv[])
 
 	MPI::mpi.init(argc, argv);
 	const int rank = MPI::mpi.rank();
+	m_startupProfiler.startPhase("initialization");
 
   // Print welcome message
   logInfo(rank) << "Welcome to SeisSol";
   logInfo(rank) << "Copyright (c) 2012-2021, SeisSol Group";
   logInfo(rank) << "Built on:" << __DATE__ << __TIME__ ;
   logInfo(rank) << "Version:" << VERSION_STRING;
+  parallel::checkHostArch();
 
   if (MPI::mpi.rank() == 0) {
     constexpr size_t hostNameMaxLength = 100;
@@ -94,12 +98,15 @@ bool seissol::SeisSol::init(int argc, char* argv[])
       logInfo() << "Running on:" << hostname;
   }
 
+  pinning.pinWorkers();
+
 #ifdef _OPENMP
   logInfo(rank) << "Using OMP with #threads/rank:" << omp_get_max_threads();
   logInfo(rank) << "OpenMP worker affinity (this process):" << parallel::Pinning::maskToString(
       pinning.getWorkerUnionMask());
   logInfo(rank) << "OpenMP worker affinity (this node)   :" << parallel::Pinning::maskToString(
       pinning.getNodeMask());
+  pinning.checkWorkerPlacement();
 #ifdef USE_MPI
   logInfo(rank) << "Using MPI with #ranks:" << MPI::mpi.size();
 #ifdef USE_COMM_THREAD
@@ -167,6 +174,7 @@ bool seissol::SeisSol::init(int argc, char* argv[])
 
   m_parameterFile = args.getAdditionalArgument("file", "PARAMETER.par");
   m_memoryManager->initialize();
+  m_startupProfiler.startPhase("parameters");
   return true;
 }
 
@@ -175,6 +183,9 @@ void seissol::SeisSol::finalize()
 	// Cleanup ASYNC I/O library
 	m_asyncIO.finalize();
 
+	// Stop the background output after the executors wrote their last snapshots
+	writer::OutputQueue::queue.finalize();
+
 	const int rank = MPI::mpi.rank();
 
 #ifdef ACL_DEVICE
@@ -41,6 +41,7 @@
 #ifndef SEISSOL_H
 #define SEISSOL_H
 
+#include <array>
 #include <string>
 
 #include "utils/logger.h"
@@ -57,10 +58,15 @@
 
 #include "ResultWriter/AsyncIO.h"
 #include "ResultWriter/WaveFieldWriter.h"
+#include "ResultWriter/OutputRegions.h"
 #include "ResultWriter/FaultWriter.h"
 #include "ResultWriter/EnergyOutput.h"
+#include "ResultWriter/MomentRateOutput.h"
 
 #include "ResultWriter/AnalysisWriter.h"
+#include "DynamicRupture/Parameters.h"
+#include "Physics/AbsorbingLayer.h"
+#include "Monitoring/StartupProfiler.h"
 #include <memory>
 
 #include "Parallel/Pin.h"
@@ -89,6 +95,12 @@ private:
 
 	GravitationSetup gravitationSetup;
 
+	/** Damping layer around the region of interest */
+	physics::AbsorbingLayer absorbingLayer;
+
+	/** Friction law settings of the dynamic rupture */
+	dr::DRParameters drParameters;
+
 	/** Async I/O handler (needs to be initialize before other I/O modules) */
 	io::AsyncIO m_asyncIO;
 
@@ -130,6 +142,9 @@ private:
 	/** Wavefield output module */
 	writer::WaveFieldWriter m_waveFieldWriter;
 
+	/** Wavefield output modules of the output regions */
+	std::array<writer::WaveFieldWriter, writer::MaxOutputRegions> m_waveFieldRegionWriters;
+
 	/** Fault output module */
 	writer::FaultWriter m_faultWriter;
     
@@ -138,6 +153,12 @@ private:
 
   //! Energy writer module
   writer::EnergyOutput m_energyOutput;
+
+  //! Moment rate output module
+  writer::MomentRateOutput m_momentRateOutput;
+
+  //! Wall time and memory of the startup phases
+  StartupProfiler m_startupProfiler;
 private:
 	/**
 	 * Only one instance of this class should exist (private constructor).
@@ -234,6 +255,14 @@ public:
 		return m_waveFieldWriter;
 	}
 
+	/**
+	 * Get the wave field writer module of an output region
+	 */
+	writer::WaveFieldWriter& waveFieldRegionWriter(unsigned region)
+	{
+		return m_waveFieldRegionWriters[region];
+	}
+
 	/**
 	 * Get the fault writer module
 	 */
@@ -257,6 +286,17 @@ public:
      return m_energyOutput;
    }
 
+  /**
+   * Get the moment rate output module
+   */
+  writer::MomentRateOutput& momentRateOutput() {
+    return m_momentRateOutput;
+  }
+
+  StartupProfiler& startupProfiler() {
+    return m_startupProfiler;
+  }
+
 	/**
 	 * Set the mesh reader
 	 */
@@ -308,6 +348,14 @@ public:
 	  return gravitationSetup;
 	}
 
+	physics::AbsorbingLayer& getAbsorbingLayer() {
+	  return absorbingLayer;
+	}
+
+	dr::DRParameters& getDRParameters() {
+	  return drParameters;
+	}
+
 public:
 	/** The only instance of this class; the main C++ functionality */
 	static SeisSol main;
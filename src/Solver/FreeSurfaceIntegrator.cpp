@@ -50,6 +50,9 @@
 #include <generated_code/kernel.h>
 #include <utils/logger.h>
 
+#include <algorithm>
+#include <numeric>
+
 void seissol::solver::FreeSurfaceIntegrator::SurfaceLTS::addTo(seissol::initializers::LTSTree& surfaceLtsTree)
 {
   seissol::initializers::LayerMask ghostMask(Ghost);
@@ -106,53 +109,66 @@ void seissol::solver::FreeSurfaceIntegrator::initialize(  unsigned maxRefinement
 void seissol::solver::FreeSurfaceIntegrator::calculateOutput()
 {
   unsigned offset = 0;
+  unsigned layerIndex = 0;
+  bool finite = true;
   seissol::initializers::LayerMask ghostMask(Ghost);
   for (auto surfaceLayer = surfaceLtsTree.beginLeaf(ghostMask);
-       surfaceLayer != surfaceLtsTree.endLeaf(); ++surfaceLayer) {
+       surfaceLayer != surfaceLtsTree.endLeaf(); ++surfaceLayer, ++layerIndex) {
     real** dofs = surfaceLayer->var(surfaceLts.dofs);
     real** displacementDofs = surfaceLayer->var(surfaceLts.displacementDofs);
     unsigned* side = surfaceLayer->var(surfaceLts.side);
+    unsigned const* faces = facesBySide[layerIndex].data();
+    unsigned const numberOfFaces = surfaceLayer->getNumberOfCells();
 
 #ifdef _OPENMP
-    #pragma omp parallel for schedule(static) default(none) shared(offset, surfaceLayer, dofs, displacementDofs, side)
+    #pragma omp parallel default(none) shared(offset, dofs, displacementDofs, side, faces, numberOfFaces) reduction(&& : finite)
 #endif // _OPENMP
-    for (unsigned face = 0; face < surfaceLayer->getNumberOfCells(); ++face) {
+    {
       real subTriangleDofs[tensor::subTriangleDofs::size(FREESURFACE_MAX_REFINEMENT)] __attribute__((aligned(ALIGNMENT)));
 
+      // The kernels are set up once per thread, only the face-dependent arguments change in the loop
       kernel::subTriangleVelocity vkrnl;
-      vkrnl.Q = dofs[face];
       vkrnl.selectVelocity = init::selectVelocity::Values;
-      vkrnl.subTriangleProjection(triRefiner.maxDepth) = projectionMatrix[ side[face] ];
       vkrnl.subTriangleDofs(triRefiner.maxDepth) = subTriangleDofs;
-      vkrnl.execute(triRefiner.maxDepth);
 
-      auto addOutput = [&] (real* output[FREESURFACE_NUMBER_OF_COMPONENTS]) {
+      kernel::subTriangleDisplacement dkrnl;
+      dkrnl.MV2nTo2m = nodal::init::MV2nTo2m::Values;
+      dkrnl.subTriangleProjectionFromFace(triRefiner.maxDepth) = projectionMatrixFromFace.get();
+      dkrnl.subTriangleDofs(triRefiner.maxDepth) = subTriangleDofs;
+
+      auto addOutput = [&] (unsigned face, real* output[FREESURFACE_NUMBER_OF_COMPONENTS]) {
         for (unsigned component = 0; component < FREESURFACE_NUMBER_OF_COMPONENTS; ++component) {
           real* target = output[component] + offset + face * numberOfSubTriangles;
           /// @yateto_todo fix for multiple simulations
-          real* source = subTriangleDofs + component * numberOfAlignedSubTriangles; 
+          real const* source = subTriangleDofs + component * numberOfAlignedSubTriangles;
           for (unsigned subtri = 0; subtri < numberOfSubTriangles; ++subtri) {
             target[subtri] = source[subtri];
-            if (!std::isfinite(source[subtri])) {
-              logError() << "Detected Inf/NaN in free surface output. Aborting.";
-            }
+            finite = finite && std::isfinite(source[subtri]);
           }
-
         }
       };
 
-      addOutput(velocities);
+#ifdef _OPENMP
+      #pragma omp for schedule(static)
+#endif // _OPENMP
+      for (unsigned index = 0; index < numberOfFaces; ++index) {
+        const unsigned face = faces[index];
 
-      kernel::subTriangleDisplacement dkrnl;
-      dkrnl.faceDisplacement = displacementDofs[face];
-      dkrnl.MV2nTo2m = nodal::init::MV2nTo2m::Values;
-      dkrnl.subTriangleProjectionFromFace(triRefiner.maxDepth) = projectionMatrixFromFace.get();
-      dkrnl.subTriangleDofs(triRefiner.maxDepth) = subTriangleDofs;
-      dkrnl.execute(triRefiner.maxDepth);
+        vkrnl.Q = dofs[face];
+        vkrnl.subTriangleProjection(triRefiner.maxDepth) = projectionMatrix[ side[face] ];
+        vkrnl.execute(triRefiner.maxDepth);
+        addOutput(face, velocities);
 
-      addOutput(displacements);
+        dkrnl.faceDisplacement = displacementDofs[face];
+        dkrnl.execute(triRefiner.maxDepth);
+        addOutput(face, displacements);
+      }
     }
-    offset += surfaceLayer->getNumberOfCells() * numberOfSubTriangles;
+    offset += numberOfFaces * numberOfSubTriangles;
+  }
+
+  if (!finite) {
+    logError() << "Detected Inf/NaN in free surface output. Aborting.";
   }
 }
 
@@ -375,4 +391,13 @@ void seissol::solver::FreeSurfaceIntegrator::initializeSurfaceLTSTree(  seissol:
     }
     baseLtsId += layer->getNumberOfCells();
   }
+
+  facesBySide.clear();
+  for (auto surfaceLayer = surfaceLtsTree.beginLeaf(ghostMask); surfaceLayer != surfaceLtsTree.endLeaf(); ++surfaceLayer) {
+    unsigned const* side = surfaceLayer->var(surfaceLts.side);
+    std::vector<unsigned> faces(surfaceLayer->getNumberOfCells());
+    std::iota(faces.begin(), faces.end(), 0);
+    std::stable_sort(faces.begin(), faces.end(), [&](unsigned a, unsigned b) { return side[a] < side[b]; });
+    facesBySide.push_back(std::move(faces));
+  }
 }
@@ -41,6 +41,7 @@
 #define FREE_SURFACE_INTEGRATOR_H
 
 #include <memory>
+#include <vector>
 
 #include <Geometry/MeshReader.h>
 #include <Geometry/refinement/TriangleRefiner.h>
@@ -78,6 +79,8 @@ private:
   std::unique_ptr<real> projectionMatrixFromFace;
   unsigned numberOfSubTriangles;
   unsigned numberOfAlignedSubTriangles;
+  //! Surface faces of each layer grouped by their side, such that consecutive faces share the projection matrix
+  std::vector<std::vector<unsigned>> facesBySide;
 
   static constexpr auto polyDegree = CONVERGENCE_ORDER-1;
   static constexpr auto numQuadraturePoints = polyDegree*polyDegree;
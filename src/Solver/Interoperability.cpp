@@ -40,8 +40,11 @@
  * C++/Fortran-interoperability.
  **/
 
+#include <algorithm>
 #include <cstddef>
 #include <cstring>
+#include <memory>
+#include <utility>
 
 #include "Interoperability.h"
 #include "time_stepping/TimeManager.h"
@@ -49,12 +52,18 @@
 #include <Initializer/CellLocalMatrices.h>
 #include <Initializer/InitialFieldProjection.h>
 #include <Initializer/ParameterDB.h>
+#include <Initializer/SetupSnapshot.h>
+#include <Initializer/time_stepping/CellTimeSteps.h>
+#include <Initializer/time_stepping/ClusterStatistics.h>
 #include <Initializer/time_stepping/common.hpp>
 #include <Initializer/typedefs.hpp>
 #include <Equations/Setup.h>
 #include <Numerical_aux/BasisFunction.h>
 #include <Monitoring/FlopCounter.hpp>
 #include <ResultWriter/common.hpp>
+#include <ResultWriter/OutputRegions.h>
+#include <DynamicRupture/Factory.h>
+#include <utils/env.h>
 
 seissol::Interoperability e_interoperability;
 
@@ -73,6 +82,12 @@ extern "C" {
                                          i_timeStepWidth );
   }
 
+  void c_interoperability_getTimeStepWidths( double  cfl,
+                                            double  maximumTimeStep,
+                                            double* timeStepWidths ) {
+    e_interoperability.getTimeStepWidths( cfl, maximumTimeStep, timeStepWidths );
+  }
+
   void c_interoperability_initializeClusteredLts( int i_clustering, bool enableFreeSurfaceIntegration, bool usePlasticity ) {
     e_interoperability.initializeClusteredLts( i_clustering, enableFreeSurfaceIntegration, usePlasticity );
   }
@@ -81,6 +96,13 @@ extern "C" {
     e_interoperability.initializeMemoryLayout(clustering, enableFreeSurfaceIntegration, usePlasticity);
   }
 
+  void c_interoperability_setAbsorbingLayer(double width, double reflection, double* interior) {
+    seissol::physics::AbsorbingLayer& absorbingLayer = seissol::SeisSol::main.getAbsorbingLayer();
+    absorbingLayer.width = width;
+    absorbingLayer.reflection = reflection;
+    std::copy_n(interior, absorbingLayer.interior.size(), absorbingLayer.interior.begin());
+  }
+
   void c_interoperability_initializeEasiBoundaries(char* fileName) {
     seissol::SeisSol::main.getMemoryManager().initializeEasiBoundaryReader(fileName);
   }
@@ -89,6 +111,82 @@ extern "C" {
     seissol::SeisSol::main.getGravitationSetup().acceleration = gravitationalAcceleration;
   }
 
+  void c_interoperability_setFrictionLawParameters(int frictionLaw,
+                                                   double t0,
+                                                   double rsF0,
+                                                   double rsSr0,
+                                                   double rsB,
+                                                   double muW,
+                                                   int instHealing,
+                                                   int thermalPress,
+                                                   int ruptureTimeOn,
+                                                   int dynStressOutputOn,
+                                                   int magnitudeOutputOn) {
+    auto& drParameters = seissol::SeisSol::main.getDRParameters();
+    drParameters.frictionLaw = frictionLaw;
+    drParameters.t0 = t0;
+    drParameters.rsF0 = rsF0;
+    drParameters.rsSr0 = rsSr0;
+    drParameters.rsB = rsB;
+    drParameters.muW = muW;
+    drParameters.isInstantaneousHealingOn = (instHealing == 1);
+    drParameters.isThermalPressureOn = (thermalPress == 1);
+    drParameters.isRuptureFrontOutputOn = (ruptureTimeOn == 1);
+    drParameters.isDynamicStressOutputOn = (dynStressOutputOn == 1);
+    drParameters.isMagnitudeOutputOn = (magnitudeOutputOn == 1);
+    seissol::dr::factory::selectFrictionSolver(drParameters);
+  }
+
+  void c_interoperability_setThermalPressurizationParameters(double alphaTh,
+                                                             double rhoC,
+                                                             double lambda,
+                                                             double initialTemperature,
+                                                             double initialPressure) {
+    auto& drParameters = seissol::SeisSol::main.getDRParameters();
+    drParameters.tpAlphaTh = alphaTh;
+    drParameters.tpRhoC = rhoC;
+    drParameters.tpLambda = lambda;
+    drParameters.tpInitialTemperature = initialTemperature;
+    drParameters.tpInitialPressure = initialPressure;
+  }
+
+  void c_interoperability_initializeFrictionSolver(double* mu,
+                                                   double* slipRate1,
+                                                   double* slipRate2,
+                                                   double* slip,
+                                                   double* slip1,
+                                                   double* slip2,
+                                                   double* tractionXY,
+                                                   double* tractionXZ,
+                                                   double* stateVariable,
+                                                   double* peakSlipRate,
+                                                   double* ruptureTime,
+                                                   double* dynStressTime,
+                                                   double* initialStressInFaultCS,
+                                                   double* nucleationStressInFaultCS,
+                                                   bool hasNucleationStress) {
+    seissol::dr::FortranFaultState fortranState;
+    fortranState.mu = mu;
+    fortranState.slipRate1 = slipRate1;
+    fortranState.slipRate2 = slipRate2;
+    fortranState.slip = slip;
+    fortranState.slip1 = slip1;
+    fortranState.slip2 = slip2;
+    fortranState.tractionXY = tractionXY;
+    fortranState.tractionXZ = tractionXZ;
+    fortranState.stateVariable = stateVariable;
+    fortranState.peakSlipRate = peakSlipRate;
+    fortranState.ruptureTime = ruptureTime;
+    fortranState.dynStressTime = dynStressTime;
+    fortranState.initialStressInFaultCS = initialStressInFaultCS;
+    fortranState.nucleationStressInFaultCS = hasNucleationStress ? nucleationStressInFaultCS : nullptr;
+    e_interoperability.initializeFrictionSolver(fortranState);
+  }
+
+  void c_interoperability_initializeThermalPressurization(double* temperatureAndPressure, int numberOfFaultSides) {
+    e_interoperability.initializeThermalPressurization(temperatureAndPressure, numberOfFaultSides);
+  }
+
   void c_interoperability_setTravellingWaveInformation(const double* origin, const double* kVec, const double* ampField) {
     e_interoperability.setTravellingWaveInformation(origin, kVec, ampField);
   }
@@ -216,8 +314,9 @@ extern "C" {
     e_interoperability.synchronizeCopyLayerDofs();
   }
 
-  void c_interoperability_enableWaveFieldOutput( double i_waveFieldInterval, const char* i_waveFieldFilename ) {
-    e_interoperability.enableWaveFieldOutput( i_waveFieldInterval, i_waveFieldFilename );
+  void c_interoperability_enableWaveFieldOutput( double i_waveFieldInterval, const char* i_waveFieldFilename,
+                                                 const char* i_outputRegionsFilename ) {
+    e_interoperability.enableWaveFieldOutput( i_waveFieldInterval, i_waveFieldFilename, i_outputRegionsFilename );
   }
 
   void c_interoperability_enableFreeSurfaceOutput(int maxRefinementDepth) {
@@ -270,6 +369,13 @@ extern "C" {
     e_interoperability.getNeighborDofsFromDerivatives( i_meshId, i_localFaceId, o_dofs );
   }
 
+  void c_interoperability_getBulkDofsFromDerivatives( int           i_numberOfCells,
+                                                      const int*    i_meshIds,
+                                                      const int*    i_localFaceIds,
+                                                      double*       o_dofs ) {
+    e_interoperability.getBulkDofsFromDerivatives( i_numberOfCells, i_meshIds, i_localFaceIds, o_dofs );
+  }
+
   void c_interoperability_simulate( double i_finalTime, int i_plasticity ) {
     e_interoperability.simulate( i_finalTime, i_plasticity );
   }
@@ -336,6 +442,8 @@ void c_interoperability_report_device_memory_status() {
 
   extern void f_interoperability_copyDynamicRuptureState(void* domain);
 
+  extern void f_interoperability_shareDynamicRuptureOutput(void* domain);
+
   extern void f_interoperability_faultOutput( void   *i_domain,
                                               double *i_fullUpdateTime,
                                               double *i_timeStepWidth );
@@ -421,6 +529,7 @@ void seissol::Interoperability::initializeClusteredLts(int clustering,
                                                        bool usePlasticity) {
   // assert a valid clustering
   assert(clustering > 0 );
+  seissol::SeisSol::main.startupProfiler().startPhase("lts_layout");
 
   // either derive a GTS or LTS layout
   if(clustering == 1 ) {
@@ -453,6 +562,9 @@ void seissol::Interoperability::initializeClusteredLts(int clustering,
   delete[] numberOfDRCopyFaces;
   delete[] numberOfDRInteriorFaces;
 
+  // overlap reading the checkpoint with the remaining setup
+  seissol::SeisSol::main.checkPointManager().prefetch();
+
   m_ltsTree = seissol::SeisSol::main.getMemoryManager().getLtsTree();
   m_lts = seissol::SeisSol::main.getMemoryManager().getLts();
 
@@ -478,6 +590,8 @@ void seissol::Interoperability::initializeClusteredLts(int clustering,
 }
 
 void seissol::Interoperability::initializeMemoryLayout(int clustering, bool enableFreeSurfaceIntegration, bool usePlasticity) {
+  seissol::SeisSol::main.startupProfiler().startPhase("memory_layout");
+
   // initialize memory layout
   seissol::SeisSol::main.getMemoryManager().initializeMemoryLayout(enableFreeSurfaceIntegration);
 
@@ -493,12 +607,32 @@ void seissol::Interoperability::initializeMemoryLayout(int clustering, bool enab
 
   // initialize face lts trees
   seissol::SeisSol::main.getMemoryManager().fixateBoundaryLtsTree();
+
+  // the LTS setups are final after the memory layout, e.g. with compacted buffers
+  auto& memoryManager = seissol::SeisSol::main.getMemoryManager();
+  seissol::initializers::time_stepping::writeClusterStatistics(m_timeStepping,
+                                                               m_meshStructure,
+                                                               *memoryManager.getLtsTree(),
+                                                               *memoryManager.getLts(),
+                                                               *memoryManager.getDynamicRuptureTree(),
+                                                               usePlasticity);
+
+  // allocated memory per variable and bucket of the LTS tree
+  auto& profiler = seissol::SeisSol::main.startupProfiler();
+  auto* ltsTree = memoryManager.getLtsTree();
+  for (unsigned var = 0; var < ltsTree->getNumberOfVariables(); ++var) {
+    profiler.addMemory(ltsTree->info(var).name, ltsTree->getVariableSizes()[var]);
+  }
+  for (unsigned bucket = 0; bucket < ltsTree->getNumberOfBuckets(); ++bucket) {
+    profiler.addMemory(ltsTree->bucketMemoryInfo(bucket).name, ltsTree->getBucketSizes()[bucket]);
+  }
 }
 
 
 #if defined(USE_NETCDF) && !defined(NETCDF_PASSIVE)
 void seissol::Interoperability::setupNRFPointSources( char const* fileName )
 {
+  seissol::SeisSol::main.startupProfiler().startPhase("sources");
   SeisSol::main.sourceTermManager().loadSourcesFromNRF(
     fileName,
     seissol::SeisSol::main.meshReader(),
@@ -525,6 +659,7 @@ void seissol::Interoperability::setupFSRMPointSources( double const* momentTenso
                                                        int           numberOfSamples,
                                                        double const* timeHistories )
 {
+  seissol::SeisSol::main.startupProfiler().startPhase("sources");
   SeisSol::main.sourceTermManager().loadSourcesFromFSRM(
     momentTensor,
     solidVelocityComponent,
@@ -559,6 +694,8 @@ void seissol::Interoperability::initializeModel(  char*   materialFileName,
                                                   double* iniStress,
                                                   double* waveSpeeds)
 {
+  seissol::SeisSol::main.startupProfiler().startPhase("material");
+
   //There are only some valid combinations of material properties
   // elastic materials
   // viscoelastic materials
@@ -569,7 +706,17 @@ void seissol::Interoperability::initializeModel(  char*   materialFileName,
 
   //first initialize the (visco-)elastic part
   auto nElements = seissol::SeisSol::main.meshReader().getElements().size();
-  seissol::initializers::ElementBarycentreGenerator queryGen(seissol::SeisSol::main.meshReader());
+  // SEISSOL_MATERIAL_AVERAGING > 0 averages the material over the quadrature points of each element
+  static unsigned const averagingPoints = utils::Env::get<unsigned>("SEISSOL_MATERIAL_AVERAGING", 0u);
+  std::unique_ptr<seissol::initializers::QueryGenerator> queryGenerator;
+  if (averagingPoints > 0) {
+    logInfo(seissol::MPI::mpi.rank()) << "Averaging the material over" << averagingPoints * averagingPoints * averagingPoints
+                                      << "points per element.";
+    queryGenerator = std::make_unique<seissol::initializers::ElementAverageGenerator>(seissol::SeisSol::main.meshReader(), averagingPoints);
+  } else {
+    queryGenerator = std::make_unique<seissol::initializers::ElementBarycentreGenerator>(seissol::SeisSol::main.meshReader());
+  }
+  seissol::initializers::QueryGenerator const& queryGen = *queryGenerator;
   auto calcWaveSpeeds = [&] (seissol::model::Material* material, int pos) {
     waveSpeeds[pos] = material->getMaxWaveSpeed();
     waveSpeeds[nElements + pos] = material->getSWaveSpeed();
@@ -674,6 +821,22 @@ void seissol::Interoperability::initializeModel(  char*   materialFileName,
       }
     } 
   }
+
+  // The maximum wave speeds are known now, such that the CFL time steps are computed once for all later users
+  MeshReader& meshReader = seissol::SeisSol::main.meshReader();
+  meshReader.setCellTimeSteps(seissol::initializers::time_stepping::computeCellTimeSteps(
+      meshReader.getElements(), meshReader.getVertices(), waveSpeeds));
+}
+
+void seissol::Interoperability::getTimeStepWidths(double cfl, double maximumTimeStep, double* timeStepWidths) {
+  std::vector<double> const& cellTimeSteps = seissol::SeisSol::main.meshReader().getCellTimeSteps();
+  if (cellTimeSteps.size() != seissol::SeisSol::main.meshReader().getElements().size()) {
+    logError() << "The time step widths are requested before the material is initialized.";
+  }
+  #pragma omp parallel for schedule(static)
+  for (std::size_t cell = 0; cell < cellTimeSteps.size(); ++cell) {
+    timeStepWidths[cell] = std::min(cfl * cellTimeSteps[cell], maximumTimeStep);
+  }
 }
 
 void seissol::Interoperability::fitAttenuation( double rho,
@@ -696,6 +859,8 @@ void seissol::Interoperability::initializeFault( char*   modelFileName,
                                                  double* bndPoints,
                                                  int     numberOfBndPoints )
 {
+  seissol::SeisSol::main.startupProfiler().startPhase("dynamic_rupture");
+
   seissol::initializers::FaultParameterDB parameterDB;
   for (auto const& kv : m_faultParameters) {
     parameterDB.addParameter(kv.first, kv.second);
@@ -773,13 +938,20 @@ void seissol::Interoperability::setTv(double tv) {
 
 void seissol::Interoperability::initializeCellLocalMatrices(bool usePlasticity)
 {
+  seissol::SeisSol::main.startupProfiler().startPhase("cell_local_matrices");
+
   // \todo Move this to some common initialization place
   MeshReader& meshReader = seissol::SeisSol::main.meshReader();
-  seissol::initializers::initializeCellLocalMatrices( meshReader,
-                                                      m_ltsTree,
-                                                      m_lts,
-                                                      &m_ltsLut,
-                                                      m_timeStepping);
+  seissol::initializers::SetupSnapshot snapshot(meshReader, m_ltsTree, m_lts, &m_ltsLut, m_timeStepping);
+  const bool loadedSnapshot = snapshot.load();
+  if (!loadedSnapshot) {
+    seissol::initializers::initializeCellLocalMatrices( meshReader,
+                                                        m_ltsTree,
+                                                        m_lts,
+                                                        &m_ltsLut,
+                                                        m_timeStepping);
+    snapshot.store();
+  }
 
   initializers::MemoryManager& memoryManager = seissol::SeisSol::main.getMemoryManager();
   seissol::initializers::initializeDynamicRuptureMatrices( meshReader,
@@ -798,13 +970,23 @@ void seissol::Interoperability::initializeCellLocalMatrices(bool usePlasticity)
                                                     m_lts,
                                                     &m_ltsLut);
 
+  const physics::AbsorbingLayer& absorbingLayer = seissol::SeisSol::main.getAbsorbingLayer();
+  if (absorbingLayer.isEnabled()) {
+#ifdef ACL_DEVICE
+    logError() << "The absorbing layer is not supported on GPUs.";
+#endif
+    physics::initializeAbsorbingLayer(absorbingLayer, meshReader, m_ltsTree, m_lts, &m_ltsLut);
+  }
+
 #ifdef ACL_DEVICE
-  initializers::copyCellMatricesToDevice(m_ltsTree,
-                                         m_lts,
-                                         memoryManager.getDynamicRuptureTree(),
-                                         memoryManager.getDynamicRupture(),
-                                         memoryManager.getBoundaryTree(),
-                                         memoryManager.getBoundary());
+  if (loadedSnapshot) {
+    initializers::copyCellMatricesToDevice(m_ltsTree,
+                                           m_lts,
+                                           memoryManager.getDynamicRuptureTree(),
+                                           memoryManager.getDynamicRupture(),
+                                           memoryManager.getBoundaryTree(),
+                                           memoryManager.getBoundary());
+  }
 
   memoryManager.recordExecutionPaths(usePlasticity);
 #endif
@@ -813,18 +995,17 @@ void seissol::Interoperability::initializeCellLocalMatrices(bool usePlasticity)
 template<typename T>
 void seissol::Interoperability::synchronize(seissol::initializers::Variable<T> const& handle)
 {
-  unsigned *const (&meshToLts)[seissol::initializers::Lut::MaxDuplicates] = m_ltsLut.getMeshToLtsLut(handle.mask);
-  unsigned* duplicatedMeshIds = m_ltsLut.getDuplicatedMeshIds(handle.mask);
+  unsigned const (*duplicatedLtsIds)[seissol::initializers::Lut::MaxDuplicates] = m_ltsLut.getDuplicatedLtsIds(handle.mask);
   unsigned numberOfDuplicatedMeshIds = m_ltsLut.getNumberOfDuplicatedMeshIds(handle.mask);
   T* var = m_ltsTree->var(handle);
 #ifdef _OPENMP
   #pragma omp parallel for schedule(static)
 #endif
   for (unsigned dupMeshId = 0; dupMeshId < numberOfDuplicatedMeshIds; ++dupMeshId) {
-    unsigned meshId = duplicatedMeshIds[dupMeshId];
-    T* ref = &var[ meshToLts[0][meshId] ];
-    for (unsigned dup = 1; dup < seissol::initializers::Lut::MaxDuplicates && meshToLts[dup][meshId] != std::numeric_limits<unsigned>::max(); ++dup) {
-      memcpy(reinterpret_cast<void*>(&var[ meshToLts[dup][meshId] ]),
+    unsigned const* ltsIds = duplicatedLtsIds[dupMeshId];
+    T* ref = &var[ ltsIds[0] ];
+    for (unsigned dup = 1; dup < seissol::initializers::Lut::MaxDuplicates && ltsIds[dup] != std::numeric_limits<unsigned>::max(); ++dup) {
+      memcpy(reinterpret_cast<void*>(&var[ ltsIds[dup] ]),
              reinterpret_cast<void*>(ref),
              sizeof(T));
     }
@@ -845,10 +1026,33 @@ void seissol::Interoperability::synchronizeCopyLayerDofs() {
   }
 }
 
-void seissol::Interoperability::enableWaveFieldOutput( double i_waveFieldInterval, const char *i_waveFieldFilename ) {
+void seissol::Interoperability::enableWaveFieldOutput( double i_waveFieldInterval, const char *i_waveFieldFilename,
+                                                       const char *i_outputRegionsFilename ) {
   seissol::SeisSol::main.waveFieldWriter().setWaveFieldInterval( i_waveFieldInterval );
   seissol::SeisSol::main.waveFieldWriter().enable();
   seissol::SeisSol::main.waveFieldWriter().setFilename( i_waveFieldFilename );
+
+  if (std::strlen(i_outputRegionsFilename) == 0) {
+    return;
+  }
+  try {
+    m_outputRegions = writer::parseOutputRegionFile(i_outputRegionsFilename);
+  } catch (std::exception const& error) {
+    logError() << error.what();
+  }
+  if (m_outputRegions.size() > writer::MaxOutputRegions) {
+    logError() << "At most" << writer::MaxOutputRegions << "output regions are supported, but"
+               << i_outputRegionsFilename << "defines" << m_outputRegions.size() << "regions.";
+  }
+  // Each region is an independent writer with its own interval and files
+  for (unsigned region = 0; region < m_outputRegions.size(); ++region) {
+    auto& writer = seissol::SeisSol::main.waveFieldRegionWriter(region);
+    writer.setWaveFieldInterval( m_outputRegions[region].interval );
+    writer.enable();
+    writer.setFilename( (std::string(i_waveFieldFilename) + "-" + m_outputRegions[region].name).c_str() );
+    logInfo(seissol::MPI::mpi.rank()) << "Wave field output region" << m_outputRegions[region].name
+                                      << "is written every" << m_outputRegions[region].interval << "s.";
+  }
 }
 
 void seissol::Interoperability::enableFreeSurfaceOutput(int maxRefinementDepth)
@@ -870,12 +1074,18 @@ void seissol::Interoperability::enableCheckPointing( double i_checkPointInterval
 	  seissol::SeisSol::main.checkPointManager().setBackend(checkpoint::POSIX);
   else if (strcmp(i_checkPointBackend, "hdf5") == 0)
 	  seissol::SeisSol::main.checkPointManager().setBackend(checkpoint::HDF5);
+  else if (strcmp(i_checkPointBackend, "hdf5_async") == 0)
+	  seissol::SeisSol::main.checkPointManager().setBackend(checkpoint::HDF5_ASYNC);
   else if (strcmp(i_checkPointBackend, "mpio") == 0)
 	  seissol::SeisSol::main.checkPointManager().setBackend(checkpoint::MPIO);
   else if (strcmp(i_checkPointBackend, "mpio_async") == 0)
 	  seissol::SeisSol::main.checkPointManager().setBackend(checkpoint::MPIO_ASYNC);
+  else if (strcmp(i_checkPointBackend, "mpio_elastic") == 0)
+	  seissol::SeisSol::main.checkPointManager().setBackend(checkpoint::MPIO_ELASTIC);
   else if (strcmp(i_checkPointBackend, "sionlib") == 0)
 	  seissol::SeisSol::main.checkPointManager().setBackend(checkpoint::SIONLIB);
+  else if (strcmp(i_checkPointBackend, "gds") == 0)
+	  seissol::SeisSol::main.checkPointManager().setBackend(checkpoint::GDS);
   else
 	  logError() << "Unknown checkpoint backend";
   seissol::SeisSol::main.checkPointManager().setFilename( i_checkPointFilename );
@@ -899,9 +1109,37 @@ seissol::Interoperability::initializeIO(double* mu, double* slipRate1, double* s
                                         bool isPlasticityEnabled, bool isEnergyTerminalOutputEnabled,
                                         double energySyncInterval)
 {
+  seissol::SeisSol::main.startupProfiler().startPhase("output");
+
   auto type = writer::backendType(xdmfWriterBackend);
   
 	// Initialize checkpointing
+	if (seissol::SeisSol::main.checkPointManager().requiresGlobalIds()) {
+		const MeshReader& meshReader = seissol::SeisSol::main.meshReader();
+		const std::vector<unsigned long>& globalIds = meshReader.getElementGlobalIds();
+		if (globalIds.size() != meshReader.getElements().size())
+			logError() << "The elastic MPI-IO checkpoint requires a mesh reader with global element ids (PUML).";
+
+		std::vector<unsigned long> cellIds(m_ltsTree->getNumberOfCells(m_lts->dofs.mask));
+		for (unsigned ltsId = 0; ltsId < cellIds.size(); ++ltsId) {
+			const unsigned meshId = m_ltsLut.meshId(m_lts->dofs.mask, ltsId);
+			cellIds[ltsId] = meshId < globalIds.size() ? globalIds[meshId] : checkpoint::INVALID_GLOBAL_ID;
+		}
+
+		// A fault side is stored with the ids of both elements, such that it can be loaded if
+		// only one of them is local after repartitioning
+		const std::vector<Fault>& fault = meshReader.getFault();
+		std::vector<unsigned long> faceIds(2 * fault.size(), checkpoint::INVALID_GLOBAL_ID);
+		for (unsigned side = 0; side < fault.size(); ++side) {
+			if (fault[side].element >= 0)
+				faceIds[2 * side] = 4 * globalIds[fault[side].element] + fault[side].side;
+			if (fault[side].neighborElement >= 0)
+				faceIds[2 * side + 1] = 4 * globalIds[fault[side].neighborElement] + fault[side].neighborSide;
+		}
+
+		seissol::SeisSol::main.checkPointManager().setGlobalIds(std::move(cellIds), std::move(faceIds));
+	}
+
 	int faultTimeStep;
 	bool hasCheckpoint = seissol::SeisSol::main.checkPointManager().init(reinterpret_cast<real*>(m_ltsTree->var(m_lts->dofs)),
 			m_ltsTree->getNumberOfCells(m_lts->dofs.mask) * tensor::Q::size(),
@@ -912,6 +1150,9 @@ seissol::Interoperability::initializeIO(double* mu, double* slipRate1, double* s
 		seissol::SeisSol::main.simulator().setCurrentTime(
 			seissol::SeisSol::main.checkPointManager().header().time());
 		seissol::SeisSol::main.faultWriter().setTimestep(faultTimeStep);
+		if (m_faultStateBridge.isInitialized()) {
+			m_faultStateBridge.copyStateFromFortran();
+		}
 	}
 
   constexpr auto numberOfQuantities = tensor::Q::Shape[ sizeof(tensor::Q::Shape) / sizeof(tensor::Q::Shape[0]) - 1];
@@ -932,10 +1173,56 @@ seissol::Interoperability::initializeIO(double* mu, double* slipRate1, double* s
       reinterpret_cast<const real*>(m_ltsTree->var(m_lts->dofs)),
       reinterpret_cast<const real*>(m_ltsTree->var(m_lts->pstrain)),
       seissol::SeisSol::main.postProcessor().getIntegrals(m_ltsTree),
-      m_ltsLut.getMeshToLtsLut(m_lts->dofs.mask)[0],
+      m_ltsLut.getMeshToLtsLut(m_lts->dofs.mask),
       refinement, outputMask, plasticityMask, outputRegionBounds,outputGroups,
 			type);
 
+	// Initialize the wave field output of the regions
+	constexpr auto numberOfPlasticityVariables = writer::WaveFieldWriterExecutor::NUM_PLASTICITY_VARIABLES;
+	for (unsigned region = 0; region < m_outputRegions.size(); ++region) {
+		auto const& outputRegion = m_outputRegions[region];
+		std::vector<int> regionOutputMask(numberOfQuantities, 0);
+		std::vector<int> regionPlasticityMask(numberOfPlasticityVariables, 0);
+		for (auto const& variable : outputRegion.variables) {
+			auto const* names = writer::WaveFieldWriterExecutor::VariableNames;
+			auto const* found = std::find(names, names + numberOfQuantities + numberOfPlasticityVariables, variable);
+			auto const index = static_cast<unsigned>(found - names);
+			if (index < numberOfQuantities) {
+				regionOutputMask[index] = 1;
+			} else if (index < numberOfQuantities + numberOfPlasticityVariables) {
+				regionPlasticityMask[index - numberOfQuantities] = 1;
+			} else {
+				logError() << "Unknown variable" << variable << "in output region" << outputRegion.name;
+			}
+		}
+		seissol::SeisSol::main.waveFieldRegionWriter(region).init(
+			numberOfQuantities, CONVERGENCE_ORDER,
+			NUMBER_OF_ALIGNED_BASIS_FUNCTIONS,
+			seissol::SeisSol::main.meshReader(),
+			LtsClusteringData,
+			reinterpret_cast<const real*>(m_ltsTree->var(m_lts->dofs)),
+			reinterpret_cast<const real*>(m_ltsTree->var(m_lts->pstrain)),
+			nullptr,
+			m_ltsLut.getMeshToLtsLut(m_lts->dofs.mask),
+			outputRegion.refinement, regionOutputMask.data(), regionPlasticityMask.data(),
+			outputRegion.bounds.data(), std::unordered_set<int>(),
+			type);
+	}
+
+	// Let the time clusters sample the wave field outputs without synchronization points
+	auto sampleWaveField = [&](writer::WaveFieldWriter& waveFieldWriter) {
+		if (waveFieldWriter.isSampled()) {
+			waveFieldWriter.initSampling(m_globalData,
+			                             seissol::SeisSol::main.simulator().getCurrentTime(),
+			                             m_ltsTree->getNumberOfCells(m_lts->dofs.mask));
+			seissol::SeisSol::main.timeManager().addSampledWaveFieldWriter(waveFieldWriter);
+		}
+	};
+	sampleWaveField(seissol::SeisSol::main.waveFieldWriter());
+	for (unsigned region = 0; region < m_outputRegions.size(); ++region) {
+		sampleWaveField(seissol::SeisSol::main.waveFieldRegionWriter(region));
+	}
+
 	// Initialize free surface output
 	seissol::SeisSol::main.freeSurfaceWriter().init(
 		seissol::SeisSol::main.meshReader(),
@@ -953,7 +1240,7 @@ seissol::Interoperability::initializeIO(double* mu, double* slipRate1, double* s
     seissol::SeisSol::main.meshReader(),
     m_ltsLut,
     *m_lts,
-    m_globalData
+    seissol::SeisSol::main.getMemoryManager().getGlobalData()
   );
   seissol::SeisSol::main.timeManager().setReceiverClusters(receiverWriter);
 
@@ -972,6 +1259,15 @@ seissol::Interoperability::initializeIO(double* mu, double* slipRate1, double* s
                     isEnergyTerminalOutputEnabled,
                     freeSurfaceFilename,
                     energySyncInterval);
+  if (energyOutput.isAccumulatedInClusters()) {
+    seissol::SeisSol::main.timeManager().setEnergyOutput(energyOutput);
+  }
+
+  auto& momentRateOutput = seissol::SeisSol::main.momentRateOutput();
+  momentRateOutput.init(dynRup, dynRupTree, seissol::SeisSol::main.meshReader(), freeSurfaceFilename);
+  if (momentRateOutput.isEnabled()) {
+    seissol::SeisSol::main.timeManager().setMomentRateOutput(momentRateOutput);
+  }
 
 	seissol::SeisSol::main.analysisWriter().init(
 	    &seissol::SeisSol::main.meshReader(),
@@ -980,9 +1276,47 @@ seissol::Interoperability::initializeIO(double* mu, double* slipRate1, double* s
 
 void seissol::Interoperability::copyDynamicRuptureState()
 {
+	if (m_faultStateBridge.isInitialized()) {
+		// The fault output reads the Fortran fault state directly (see initializeFrictionSolver)
+		m_faultStateBridge.copyStateToFortran();
+		return;
+	}
 	f_interoperability_copyDynamicRuptureState(m_domain);
 }
 
+void seissol::Interoperability::initializeFrictionSolver(seissol::dr::FortranFaultState const& fortranState)
+{
+	seissol::SeisSol::main.startupProfiler().startPhase("dynamic_rupture");
+
+	auto const& drParameters = seissol::SeisSol::main.getDRParameters();
+	if (drParameters.isNativeSolverEnabled) {
+		auto& memoryManager = seissol::SeisSol::main.getMemoryManager();
+		m_faultStateBridge.initialize(fortranState,
+		                              m_faultParameters,
+		                              drParameters,
+		                              memoryManager.getDynamicRuptureTree(),
+		                              memoryManager.getDynamicRupture());
+		// The state is only written back to Fortran before outputs and checkpoints, thus no separate output copy is needed
+		f_interoperability_shareDynamicRuptureOutput(m_domain);
+	}
+}
+
+void seissol::Interoperability::initializeThermalPressurization(double* temperatureAndPressure, int numberOfFaultSides)
+{
+	if (m_faultStateBridge.isInitialized()) {
+		// DISC%DynRup%TP has the shape (nBndGP, nSide, 2)
+		double* pressure = temperatureAndPressure + static_cast<size_t>(numberOfFaultSides) * seissol::dr::numberOfPoints;
+		m_faultStateBridge.initializeThermalPressurization(temperatureAndPressure, pressure);
+	}
+}
+
+void seissol::Interoperability::copyFrictionSolverStateToFortran()
+{
+	if (m_faultStateBridge.isInitialized()) {
+		copyDynamicRuptureState();
+	}
+}
+
 void seissol::Interoperability::initInitialConditions()
 {
   auto initialConditionDescription = m_initialConditionType;
@@ -1032,6 +1366,8 @@ void seissol::Interoperability::initInitialConditions()
 
 void seissol::Interoperability::projectInitialField()
 {
+  seissol::SeisSol::main.startupProfiler().startPhase("initial_conditions");
+
   initInitialConditions();
 
   if (m_initialConditionType == "Zero") {
@@ -1069,6 +1405,23 @@ void seissol::Interoperability::getNeighborDofsFromDerivatives( int    i_meshId,
                                          o_dofs );
 }
 
+void seissol::Interoperability::getBulkDofsFromDerivatives( int           i_numberOfCells,
+                                                            const int*    i_meshIds,
+                                                            const int*    i_localFaceIds,
+                                                            double*       o_dofs ) {
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (int cell = 0; cell < i_numberOfCells; ++cell) {
+    double* dofs = o_dofs + static_cast<std::size_t>(cell) * tensor::QFortran::size();
+    if (i_localFaceIds[cell] == 0) {
+      getDofsFromDerivatives( i_meshIds[cell], dofs );
+    } else {
+      getNeighborDofsFromDerivatives( i_meshIds[cell], i_localFaceIds[cell], dofs );
+    }
+  }
+}
+
 seissol::initializers::Lut* seissol::Interoperability::getLtsLut() {
   return &m_ltsLut;
 }
@@ -1081,15 +1434,24 @@ void seissol::Interoperability::simulate( double i_finalTime, int i_plasticity )
   seissol::SeisSol::main.simulator().setFinalTime( i_finalTime );
   seissol::SeisSol::main.simulator().setUsePlasticity( i_plasticity );
 
+  // the startup ends with the time loop
+  seissol::SeisSol::main.startupProfiler().finish();
+
  seissol::SeisSol::main.simulator().simulate();
 }
 
 void seissol::Interoperability::finalizeIO()
 {
 	seissol::SeisSol::main.waveFieldWriter().close();
+	for (unsigned region = 0; region < m_outputRegions.size(); ++region) {
+		seissol::SeisSol::main.waveFieldRegionWriter(region).close();
+	}
 	seissol::SeisSol::main.checkPointManager().close();
 	seissol::SeisSol::main.faultWriter().close();
 	seissol::SeisSol::main.freeSurfaceWriter().close();
+	seissol::SeisSol::main.receiverWriter().close();
+	seissol::SeisSol::main.energyOutput().finalize();
+	seissol::SeisSol::main.momentRateOutput().finalize();
 }
 
 void seissol::Interoperability::deallocateMemoryManager() {
@@ -1099,6 +1461,7 @@ void seissol::Interoperability::deallocateMemoryManager() {
 void seissol::Interoperability::faultOutput( double i_fullUpdateTime,
                                              double i_timeStepWidth )
 {
+  copyFrictionSolverStateToFortran();
   f_interoperability_faultOutput( m_domain, &i_fullUpdateTime, &i_timeStepWidth );
 }
 
@@ -1141,6 +1504,7 @@ void seissol::Interoperability::evaluateFrictionLaw(  int face,
 
 void seissol::Interoperability::calcElementwiseFaultoutput(double time)
 {
+	copyFrictionSolverStateToFortran();
 	f_interoperability_calcElementwiseFaultoutput(m_domain, time);
 }
 
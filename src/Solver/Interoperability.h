@@ -53,7 +53,9 @@
 #include <Initializer/tree/LTSTree.hpp>
 #include <Initializer/tree/Lut.hpp>
 #include <Physics/InitialField.h>
+#include <ResultWriter/OutputRegions.h>
 #include "Equations/datastructures.hpp"
+#include <DynamicRupture/FortranFaultState.h>
 
 namespace seissol {
   class Interoperability;
@@ -99,9 +101,15 @@ class seissol::Interoperability {
     //! Set of parameters that have to be initialized for dynamic rupture
     std::unordered_map<std::string, double*> m_faultParameters;
 
+    //! Synchronization of the fault state if the C++ friction solvers are used
+    seissol::dr::FortranFaultStateBridge m_faultStateBridge;
+
     //! Vector of initial conditions
     std::vector<std::unique_ptr<physics::InitialField>> m_iniConds;
 
+    //! Additional wave field output regions
+    std::vector<writer::OutputRegion> m_outputRegions;
+
     void initInitialConditions();
  public:
    /**
@@ -137,6 +145,17 @@ class seissol::Interoperability {
    void setTimeStepWidth( int    i_meshId,
                           double i_timeStepWidth );
 
+   /**
+    * Gets the time step widths of all cells, which are computed once with the material.
+    *
+    * @param cfl CFL number.
+    * @param maximumTimeStep upper bound of the time step widths.
+    * @param timeStepWidths time step width of every cell.
+    **/
+   void getTimeStepWidths( double  cfl,
+                           double  maximumTimeStep,
+                           double* timeStepWidths );
+
    /**
     * Initializes clustered local time stepping.
     *   1) Derivation of the LTS layout
@@ -267,8 +286,10 @@ class seissol::Interoperability {
     *
     * @param i_waveFieldInterval plotting interval of the wave field.
     * @param i_waveFieldFilename file name prefix of the wave field.
+    * @param i_outputRegionsFilename file with additional output regions (empty if none).
     **/
-   void enableWaveFieldOutput( double i_waveFieldInterval, const char *i_waveFieldFilename );
+   void enableWaveFieldOutput( double i_waveFieldInterval, const char *i_waveFieldFilename,
+                               const char *i_outputRegionsFilename );
 
    /**
     * Enable free surface output
@@ -302,6 +323,24 @@ class seissol::Interoperability {
     **/
    void copyDynamicRuptureState();
 
+   /**
+    * Hands the Fortran fault state over to the C++ friction solvers (if enabled).
+    **/
+   void initializeFrictionSolver(seissol::dr::FortranFaultState const& fortranState);
+
+   /**
+    * Hands temperature and pore pressure of thermal pressurization over to the C++ friction solvers (if enabled).
+    *
+    * @param temperatureAndPressure DISC%DynRup%TP.
+    **/
+   void initializeThermalPressurization(double* temperatureAndPressure, int numberOfFaultSides);
+
+   /**
+    * Writes the fault state of the C++ friction solvers back to Fortran (if enabled),
+    * e.g. before fault output or checkpointing.
+    **/
+   void copyFrictionSolverStateToFortran();
+
   /**
    * Returns (possibly multiple) initial conditions
    */
@@ -344,6 +383,20 @@ class seissol::Interoperability {
    void getNeighborDofsFromDerivatives( int    i_meshId,
                                         int    i_localFaceId,
                                         double o_dofs[tensor::QFortran::size()] );
+
+   /**
+    * Gets the DOFs from the derivatives of several cells or face neighbors in one (OpenMP parallel) call.
+    * Assumes valid storage of time derivatives.
+    *
+    * @param i_numberOfCells number of requested cells.
+    * @param i_meshIds mesh ids.
+    * @param i_localFaceIds 0 for the cell itself or the local id of the face neighbor (see getNeighborDofsFromDerivatives).
+    * @param o_dofs degrees of freedom, contiguous per cell.
+    **/
+   void getBulkDofsFromDerivatives( int           i_numberOfCells,
+                                    const int*    i_meshIds,
+                                    const int*    i_localFaceIds,
+                                    double*       o_dofs );
    /**
     * Gets the LTS lookup table.
     */
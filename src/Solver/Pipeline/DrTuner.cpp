@@ -41,6 +41,7 @@
  **/
 
 #include "DrTuner.h"
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 
@@ -52,6 +53,10 @@ namespace seissol::dr::pipeline {
     invPhi = 0.5 * (std::sqrt(5.0) - 1);
     invPhiSquared = invPhi * invPhi;
 
+    initSearch();
+  }
+
+  void DrPipelineTuner::initSearch() {
     stepSize = maxBatchSize - minBatchSize;
     leftPoint = minBatchSize + invPhiSquared * stepSize;
     rightPoint = minBatchSize + invPhi * stepSize;
@@ -60,6 +65,34 @@ namespace seissol::dr::pipeline {
     action = Action::BeginRecordingRightEvaluation;
   }
 
+  void DrPipelineTuner::setNumberOfFaces(size_t faces) {
+    if (numberOfFaces != 0 || faces == 0) {
+      return;
+    }
+    numberOfFaces = faces;
+    if (isConverged) {
+      return;
+    }
+
+    // larger batches than faces are all the same, i.e. a single batch without overlap
+    const auto faceCount = static_cast<double>(faces);
+    if (faceCount >= maxBatchSize) {
+      return;
+    }
+    if (faceCount <= minBatchSize) {
+      setBatchSize(faceCount);
+      return;
+    }
+    maxBatchSize = faceCount;
+    initSearch();
+  }
+
+  void DrPipelineTuner::setBatchSize(double batchSize) {
+    currBatchSize = std::max(1.0, std::min(batchSize, static_cast<double>(DefaultBatchSize)));
+    action = Action::SkipAction;
+    isConverged = true;
+  }
+
   /**
    * Implements a golden-section search to find a optimal batch size.
    *
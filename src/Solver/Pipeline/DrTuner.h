@@ -52,10 +52,22 @@ namespace seissol::dr::pipeline {
     DrPipelineTuner();
     ~DrPipelineTuner() override = default;
     void tune(const std::array<double, NumStages>& stageTiming) override;
+
+    /**
+     * Restricts the search to batches which are not larger than the number of faces.
+     * Only the first call has an effect; it has to happen before the first run of the pipeline.
+     **/
+    void setNumberOfFaces(size_t numberOfFaces);
+
+    //! Uses a fixed batch size, e.g. the tuned batch size of a previous run, and stops tuning
+    void setBatchSize(double batchSize);
     [[nodiscard]] bool isTunerConverged() const {return isConverged;}
     [[nodiscard]] double getMaxBatchSize() const {return maxBatchSize;}
     [[nodiscard]] double getMinBatchSize() const {return minBatchSize;}
+    [[nodiscard]] size_t getNumberOfFaces() const {return numberOfFaces;}
   private:
+    void initSearch();
+
     enum class Action {
       BeginRecordingLeftEvaluation,
       BeginRecordingRightEvaluation,
@@ -77,6 +89,7 @@ namespace seissol::dr::pipeline {
     double invPhiSquared{};
     double eps{5e-2};
     bool isConverged{false};
+    size_t numberOfFaces{0};
   };
 }
 
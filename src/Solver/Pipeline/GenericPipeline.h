@@ -100,6 +100,8 @@ namespace seissol {
       callBacks[id] = callBack;
     }
 
+    TunerT& getTuner() { return tuner; }
+
     void run(size_t size) {
       init(size);
       fill();
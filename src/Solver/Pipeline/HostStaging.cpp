@@ -0,0 +1,103 @@
+#include "HostStaging.h"
+
+#include <Initializer/MemoryAllocator.h>
+
+#include <algorithm>
+
+#ifdef ACL_DEVICE
+#include <device.h>
+#endif
+
+namespace {
+using Pipeline = seissol::HostStaging::Pipeline;
+
+#ifdef ACL_DEVICE
+struct StagingContext {
+  const real* source{nullptr};
+  real* slots{nullptr};
+  std::size_t cellSize{0};
+};
+
+struct AsyncCopyToHost : public Pipeline::PipelineCallBack {
+  explicit AsyncCopyToHost(StagingContext context) : context(context) {
+    copyStream = device.api->getNextCircularStream();
+  }
+
+  void operator()(size_t begin, size_t batchSize, size_t callCounter) override {
+    const size_t slotOffset = (callCounter % Pipeline::NumStages) * Pipeline::DefaultBatchSize * context.cellSize;
+
+    // The previous batch has to arrive before the host processes it
+    device.api->syncStreamFromCircularBuffer(copyStream);
+    device.api->copyFromAsync(&context.slots[slotOffset],
+                              const_cast<real*>(&context.source[begin * context.cellSize]),
+                              batchSize * context.cellSize * sizeof(real),
+                              copyStream);
+  }
+
+  void finalize() override { device.api->syncStreamFromCircularBuffer(copyStream); }
+
+  private:
+  StagingContext context;
+  device::DeviceInstance& device = device::DeviceInstance::getInstance();
+  void* copyStream{nullptr};
+};
+
+struct ProcessOnHost : public Pipeline::PipelineCallBack {
+  ProcessOnHost(StagingContext context, seissol::HostStaging::Consumer const& consumer)
+      : context(context), consumer(consumer) {}
+
+  void operator()(size_t begin, size_t batchSize, size_t callCounter) override {
+    const size_t slotOffset = (callCounter % Pipeline::NumStages) * Pipeline::DefaultBatchSize * context.cellSize;
+    consumer(&context.slots[slotOffset], begin, begin + batchSize);
+  }
+
+  void finalize() override {}
+
+  private:
+  StagingContext context;
+  seissol::HostStaging::Consumer const& consumer;
+};
+#endif // ACL_DEVICE
+} // namespace
+
+seissol::HostStaging::~HostStaging() {
+#ifdef ACL_DEVICE
+  if (slots != nullptr) {
+    seissol::memory::free(slots, seissol::memory::PinnedMemory);
+  }
+#endif // ACL_DEVICE
+}
+
+void seissol::HostStaging::stage(const real* source,
+                                 std::size_t numberOfCells,
+                                 std::size_t cellSize,
+                                 Consumer const& consumer) {
+  if (numberOfCells == 0) {
+    return;
+  }
+#ifdef ACL_DEVICE
+  const std::size_t requiredSize = Pipeline::NumStages * Pipeline::DefaultBatchSize * cellSize;
+  if (requiredSize > slotSize) {
+    if (slots != nullptr) {
+      seissol::memory::free(slots, seissol::memory::PinnedMemory);
+    }
+    slots = static_cast<real*>(
+        seissol::memory::allocate(requiredSize * sizeof(real), ALIGNMENT, seissol::memory::PinnedMemory));
+    slotSize = requiredSize;
+  }
+
+  const StagingContext context{source, slots, cellSize};
+  AsyncCopyToHost asyncCopyToHost(context);
+  ProcessOnHost processOnHost(context, consumer);
+  pipeline.registerCallBack(0, &asyncCopyToHost);
+  pipeline.registerCallBack(1, &processOnHost);
+  pipeline.run(numberOfCells);
+
+  device::DeviceInstance::getInstance().api->resetCircularStreamCounter();
+#else
+  for (std::size_t begin = 0; begin < numberOfCells; begin += Pipeline::DefaultBatchSize) {
+    const std::size_t end = std::min(begin + Pipeline::DefaultBatchSize, numberOfCells);
+    consumer(&source[begin * cellSize], begin, end);
+  }
+#endif // ACL_DEVICE
+}
@@ -0,0 +1,51 @@
+#ifndef SEISSOL_SOLVER_PIPELINE_HOSTSTAGING_H
+#define SEISSOL_SOLVER_PIPELINE_HOSTSTAGING_H
+
+#include <Kernels/precision.hpp>
+#include <Solver/Pipeline/GenericPipeline.h>
+
+#include <cstddef>
+#include <functional>
+
+namespace seissol {
+
+/**
+ * Stages an array of cells from the device to the host for the outputs.
+ *
+ * The cells are copied in batches to pinned host memory; the copy of a batch overlaps with the processing
+ * of the previous batch on the host (e.g. packing or subsampling for a writer). Without a device,
+ * the cells are processed in place.
+ **/
+class HostStaging {
+  public:
+  /**
+   * Processes the cells [begin, end) on the host.
+   *
+   * @param cells the data of the cell begin; only valid during the call
+   **/
+  using Consumer = std::function<void(const real* cells, std::size_t begin, std::size_t end)>;
+
+  using Pipeline = GenericPipeline<2, 2048>;
+
+  HostStaging() = default;
+  ~HostStaging();
+  HostStaging(HostStaging const&) = delete;
+  HostStaging& operator=(HostStaging const&) = delete;
+
+  /**
+   * Passes all cells of the array to the consumer in increasing order; returns once all cells are processed.
+   *
+   * @param source array of the cells (device memory in GPU builds)
+   * @param cellSize number of reals per cell
+   **/
+  void stage(const real* source, std::size_t numberOfCells, std::size_t cellSize, Consumer const& consumer);
+
+  private:
+  //! One batch per stage, as the copy of the next batch runs while the previous one is processed
+  real* slots{nullptr};
+  std::size_t slotSize{0};
+  Pipeline pipeline;
+};
+} // namespace seissol
+
+#endif // SEISSOL_SOLVER_PIPELINE_HOSTSTAGING_H
@@ -47,9 +47,18 @@
 #include "time_stepping/TimeManager.h"
 #include "Modules/Modules.h"
 #include "Monitoring/Stopwatch.h"
+#include "Checkpoint/AdaptiveInterval.h"
 #include "Monitoring/FlopCounter.hpp"
+#include "Monitoring/Telemetry.h"
+#include "Monitoring/StragglerMonitor.h"
+#include "Initializer/ThreadLocalArena.h"
 #include "ResultWriter/AnalysisWriter.h"
 #include "ResultWriter/EnergyOutput.h"
+#if defined(USE_METIS) && defined(USE_HDF) && defined(USE_MPI)
+#include "Geometry/PUMLReader.h"
+#endif
+
+#include <utils/env.h>
 
 extern seissol::Interoperability e_interoperability;
 
@@ -84,15 +93,34 @@ void seissol::Simulator::setCurrentTime( double i_currentTime ) {
 	m_currentTime = i_currentTime;
 }
 
+void seissol::Simulator::suggestPartition() {
+  static const bool suggest = utils::Env::get<int>("SEISSOL_SUGGEST_PARTITION", 0) != 0;
+  if (!suggest) {
+    return;
+  }
+#if defined(USE_METIS) && defined(USE_HDF) && defined(USE_MPI)
+  auto* pumlReader = dynamic_cast<PUMLReader*>(&seissol::SeisSol::main.meshReader());
+  if (pumlReader != nullptr) {
+    pumlReader->writeSuggestedPartition(seissol::SeisSol::main.timeManager().getMeasuredCellCosts());
+    return;
+  }
+#endif
+  logWarning(seissol::MPI::mpi.rank()) << "SEISSOL_SUGGEST_PARTITION requires a PUML mesh; no partition is suggested.";
+}
+
 void seissol::Simulator::simulate() {
   SCOREP_USER_REGION( "simulate", SCOREP_USER_REGION_TYPE_FUNCTION )
 
   Stopwatch stopwatch;
   stopwatch.start();
+  const double startTime = m_currentTime;
 
   // Set start time (required for checkpointing)
   seissol::SeisSol::main.timeManager().setInitialTimes(m_currentTime);
 
+  // Allocate the scratch memory of the solver loops once for all threads
+  memory::ThreadLocalArena::initialize();
+
   double l_timeTolerance = seissol::SeisSol::main.timeManager().getTimeTolerance();
 
   // Copy initial dynamic rupture in order to ensure correct initial fault output
@@ -115,6 +143,19 @@ void seissol::Simulator::simulate() {
   upcomingTime = std::min( upcomingTime, Modules::callSyncHook(m_currentTime, 0.0) );
   upcomingTime = std::min( upcomingTime, std::abs(m_checkPointTime + m_checkPointInterval) );
 
+  // Adaptive checkpoint interval (SEISSOL_CHECKPOINT_FAILURE_RATE)
+  checkpoint::AdaptiveInterval adaptiveInterval(utils::Env::get<double>("SEISSOL_CHECKPOINT_FAILURE_RATE", 0.0));
+  double checkPointWallTime = 0.0;
+
+  // Live metrics (SEISSOL_TELEMETRY_PREFIX)
+  Telemetry telemetry;
+  TelemetrySample telemetrySample;
+  Stopwatch outputStopwatch;
+  telemetry.start(seissol::SeisSol::main.getPinning());
+
+  // Slow ranks (SEISSOL_STRAGGLER_INTERVAL)
+  StragglerMonitor stragglerMonitor;
+
   while( m_finalTime > m_currentTime + l_timeTolerance ) {
     if (upcomingTime < m_currentTime + l_timeTolerance)
       logError() << "Simulator did not advance in time from" << m_currentTime << "to" << upcomingTime;
@@ -128,19 +169,51 @@ void seissol::Simulator::simulate() {
     // Set new upcoming time (might by overwritten by any of the modules)
     upcomingTime = m_finalTime;
 
+    outputStopwatch.start();
+
     // Check all synchronization point hooks
     upcomingTime = std::min(upcomingTime, Modules::callSyncHook(m_currentTime, l_timeTolerance));
 
     // write checkpoint if required
     if( std::abs( m_currentTime - ( m_checkPointTime + m_checkPointInterval ) ) < l_timeTolerance ) {
+      const double computeTime = stopwatch.split() - checkPointWallTime;
       const unsigned int faultTimeStep = seissol::SeisSol::main.faultWriter().timestep();
+      e_interoperability.copyFrictionSolverStateToFortran();
       seissol::SeisSol::main.checkPointManager().write(m_currentTime, faultTimeStep);
       m_checkPointTime += m_checkPointInterval;
+      if (adaptiveInterval.enabled()) {
+        const double cost = seissol::SeisSol::main.checkPointManager().lastWriteTime();
+        m_checkPointInterval = adaptiveInterval.update(cost, m_checkPointInterval, computeTime);
+      }
+      suggestPartition();
+      checkPointWallTime = stopwatch.split();
     }
     upcomingTime = std::min(upcomingTime, m_checkPointTime + m_checkPointInterval);
 
-    printPerformance(stopwatch.split());
+    const double outputTime = outputStopwatch.pause();
+
+    const double wallTime = stopwatch.split();
+    printPerformance(wallTime);
+
+    if (telemetry.enabled()) {
+      telemetrySample.simulationTime = m_currentTime;
+      telemetrySample.wallTime = wallTime;
+      telemetrySample.hardwareFlops = hardwareFlops();
+      telemetrySample.outputTime = outputTime;
+      seissol::SeisSol::main.timeManager().addToTelemetrySample(telemetrySample);
+      telemetry.publish(telemetrySample);
+    }
+
+    seissol::SeisSol::main.timeManager().checkStragglers(stragglerMonitor);
+
+    // Stop early if the wave field has decayed (SEISSOL_ENERGY_STOP_*), the final synchronization writes all outputs
+    if (seissol::SeisSol::main.energyOutput().isTerminationRequested()) {
+      logInfo(seissol::MPI::mpi.rank()) << "The energies have decayed below the thresholds, stopping at time"
+                                        << m_currentTime << "instead of" << m_finalTime;
+      break;
+    }
   }
+  telemetry.stop();
 
   
   Modules::callSyncHook(m_currentTime, l_timeTolerance, true);
@@ -149,6 +222,8 @@ void seissol::Simulator::simulate() {
   logInfo(seissol::MPI::mpi.rank()) << "Elapsed time (via clock_gettime):" << wallTime << "seconds.";
 
   seissol::SeisSol::main.timeManager().printComputationTime();
+  seissol::SeisSol::main.timeManager().writeScalingReport(wallTime, m_currentTime - startTime);
+  seissol::SeisSol::main.timeManager().storeDrPipelineTuning();
 
 
   seissol::SeisSol::main.analysisWriter().printAnalysis(m_currentTime);
@@ -69,6 +69,11 @@ class seissol::Simulator {
     //! If true, a checkpoint is loaded before the simulation
     bool m_loadCheckPoint;
 
+    /**
+     * Writes a partition which balances the measured cell costs (SEISSOL_SUGGEST_PARTITION=1).
+     **/
+    void suggestPartition();
+
   public:
     /**
      * Constructor, which initializes all values.
@@ -99,6 +104,13 @@ class seissol::Simulator {
      */
     void setCurrentTime( double i_currentTime );
 
+    /**
+     * Returns the current time of the simulation
+     */
+    double getCurrentTime() const {
+      return m_currentTime;
+    }
+
     /**
      * Activates checkpoint loading at the beginning of the simulation
      */
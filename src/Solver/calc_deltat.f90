@@ -88,8 +88,6 @@ CONTAINS
     tol = 1.0 / (10.0**(PRECISION(1.0)-2) )                                      !
     !                                                                            !                                                    !
     ALLOCATE(                                             &                      ! Allocate
-               OptionalFields%vel(         MESH%nElem)    , &                    ! Allocate
-               OptionalFields%sound(       MESH%nElem)    , &                    ! Allocate
                OptionalFields%mask(        MESH%nElem)    , &                    ! Allocate
                OptionalFields%dt_convectiv(MESH%nElem)    , &                    ! Allocate
                OptionalFields%dtmin       (MESH%nElem)    , &                    ! Allocate
@@ -110,12 +108,6 @@ CONTAINS
     TYPE (tUnstructOptionalFields):: OptionalFields
     !--------------------------------------------------------------------------
     !                                                   !
-    IF (allocated(OptionalFields%vel)) THEN            !
-        DEALLOCATE(OptionalFields%vel)                  ! Deallocate
-    END IF                                              !
-    IF (allocated(OptionalFields%sound)) THEN          !
-        DEALLOCATE(OptionalFields%sound)                ! Deallocate
-    END IF                                              !
     IF (allocated(OptionalFields%dt_convectiv)) THEN   !
         DEALLOCATE(OptionalFields%dt_convectiv)         ! Deallocate
     END IF                                              !
@@ -133,6 +125,7 @@ CONTAINS
     
   SUBROUTINE cfl_step(OptionalFields,EQN,MESH,DISC,IO,MPI)
     !--------------------------------------------------------------------------
+    use f_ftoc_bind_interoperability
     IMPLICIT NONE
     !--------------------------------------------------------------------------
     ! argument list declaration
@@ -143,58 +136,26 @@ CONTAINS
     TYPE (tInputOutput)                   :: IO
     TYPE (tMPI)                           :: MPI
     ! local variable declaration
-    REAL,POINTER                          :: MaterialVal(:,:)
     INTEGER                               :: iElem, iNeighbor, iSide
-    INTEGER                               :: idxNeighbors(MESH%GlobalElemType)
-    REAL                                  :: rho, C(6,6)
     !--------------------------------------------------------------------------
     INTENT(IN)                            :: EQN, MESH, IO, MPI
     INTENT(INOUT)                         :: OptionalFields
     INTENT(INOUT)                         :: DISC
     !--------------------------------------------------------------------------
     !                                                                         !
-    ! Compute Velocities                       
-    !                                                                         
-    !
-       DO iElem = 1, MESH%nElem
-           OptionalFields%sound(iElem) = DISC%Galerkin%MaxWaveSpeed(iElem)
-       ENDDO
-
-       SELECT CASE(EQN%Advection)
-       CASE(0) 
-           OptionalFields%vel(:) = 0.
-       CASE(1)
-           IF ((.NOT.ASSOCIATED(OptionalFields%BackgroundValue))) THEN              
-              logError(*) 'OptionalFields%BackgroundValue not associated!'
-              logError(*) 'although linearized Equations are specified. '
-              call MPI_ABORT(MPI%commWorld, 134)                                                                
-           END IF                                                                                                                              
-           MaterialVal => OptionalFields%BackgroundValue           
-           OptionalFields%vel(:) = SQRT( MaterialVal(:,4)**2 + MaterialVal(:,5)**2 + MaterialVal(:,6)**2 )
-       END SELECT
-    !                                                                         
-    ! Berechne dt aus dt_convectiv und dt_fix                      
-    !             fuer jedes Element                                          
-    !                                                                         
-    !                                                                      
-    ! U N S T E A D Y   S O L U T I O N                                    
-    !
-    OptionalFields%dt_convectiv(:)  = DISC%CFL*2.0*MESH%ELEM%MinDistBarySide(:)  & 
-                                     / ( OptionalFields%sound(:) + OptionalFields%vel(:) )
-   !
-   IF(DISC%Galerkin%pAdaptivity.GE.1) THEN                         
-    OptionalFields%dt_convectiv(:) = OptionalFields%dt_convectiv(:) / & 
-                                     ( 2.*DISC%Galerkin%LocPoly(:)+1  )    
-   ELSE                                                            
-    OptionalFields%dt_convectiv(:) = OptionalFields%dt_convectiv(:) / & 
-                                     ( 2.*DISC%Galerkin%nPoly+1       )         
-   ENDIF                                                  
+    ! The time step widths with CFL number 1 are computed once in C++ together with the material
+    ! (insphere radius and maximum wave speed of each element), and only scaled and bounded here.
     !
+    IF (EQN%Advection.NE.0) THEN
+       logError(*) 'Advection is not supported by the time step computation.'
+       call MPI_ABORT(MPI%commWorld, 134)
+    ENDIF
+    IF (DISC%Galerkin%pAdaptivity.GE.1) THEN
+       logError(*) 'p-adaptivity is not supported by the time step computation.'
+       call MPI_ABORT(MPI%commWorld, 134)
+    ENDIF
 
-    ! set to min(dt_convectiv,fixtimestep) for each element
-    WHERE(OptionalFields%dt_convectiv(:).GT.DISC%FixTimeStep)
-        OptionalFields%dt_convectiv(:) = DISC%FixTimeStep
-    END WHERE
+    call c_interoperability_getTimeStepWidths( DISC%CFL, DISC%FixTimeStep, OptionalFields%dt_convectiv )
 
     !
     IF(DISC%Galerkin%DGMethod.EQ.3) THEN
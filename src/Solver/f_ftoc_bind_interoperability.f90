@@ -81,6 +81,16 @@ module f_ftoc_bind_interoperability
     end subroutine
   end interface
 
+  interface c_interoperability_getTimeStepWidths
+    subroutine c_interoperability_getTimeStepWidths( i_cfl, i_maximumTimeStep, o_timeStepWidths ) bind( C, name='c_interoperability_getTimeStepWidths' )
+      use iso_c_binding
+      implicit none
+      real(kind=c_double), value        :: i_cfl
+      real(kind=c_double), value        :: i_maximumTimeStep
+      real(kind=c_double), dimension(*) :: o_timeStepWidths
+    end subroutine
+  end interface
+
   interface
     subroutine c_interoperability_initializeClusteredLts( i_clustering, i_enableFreeSurfaceIntegration, usePlasticity ) bind( C, name='c_interoperability_initializeClusteredLts' )
       use iso_c_binding
@@ -101,6 +111,16 @@ module f_ftoc_bind_interoperability
     end subroutine
   end interface
 
+  interface
+    subroutine c_interoperability_setAbsorbingLayer( width, reflection, interior ) bind( C, name='c_interoperability_setAbsorbingLayer' )
+      use iso_c_binding
+      implicit none
+      real(kind=c_double), value                     :: width
+      real(kind=c_double), value                     :: reflection
+      real(kind=c_double), dimension(*), intent(in)  :: interior
+    end subroutine
+  end interface
+
   interface
     subroutine c_interoperability_initializeEasiBoundaries(fileName) bind( C, name='c_interoperability_initializeEasiBoundaries' )
       use iso_c_binding
@@ -117,6 +137,52 @@ module f_ftoc_bind_interoperability
     end subroutine
   end interface
 
+  interface
+    subroutine c_interoperability_setFrictionLawParameters(frictionLaw, t0, rsF0, rsSr0, rsB, muW, instHealing, &
+        thermalPress, ruptureTimeOn, dynStressOutputOn, magnitudeOutputOn) &
+        bind( C, name='c_interoperability_setFrictionLawParameters' )
+      use iso_c_binding, only: c_double, c_int
+      implicit none
+      integer(kind=c_int), value :: frictionLaw
+      real(kind=c_double), value :: t0, rsF0, rsSr0, rsB, muW
+      integer(kind=c_int), value :: instHealing, thermalPress, ruptureTimeOn, dynStressOutputOn, magnitudeOutputOn
+    end subroutine
+  end interface
+
+  interface
+    subroutine c_interoperability_setThermalPressurizationParameters(alphaTh, rhoC, lambda, initialTemperature, &
+        initialPressure) bind( C, name='c_interoperability_setThermalPressurizationParameters' )
+      use iso_c_binding, only: c_double
+      implicit none
+      real(kind=c_double), value :: alphaTh, rhoC, lambda, initialTemperature, initialPressure
+    end subroutine
+  end interface
+
+  interface
+    subroutine c_interoperability_initializeFrictionSolver(mu, slipRate1, slipRate2, slip, slip1, slip2, &
+        tractionXY, tractionXZ, stateVariable, peakSlipRate, ruptureTime, dynStressTime, &
+        initialStressInFaultCS, nucleationStressInFaultCS, hasNucleationStress) &
+        bind( C, name='c_interoperability_initializeFrictionSolver' )
+      use iso_c_binding, only: c_double, c_bool
+      implicit none
+      real(kind=c_double), dimension(*), intent(in) :: mu, slipRate1, slipRate2, slip, slip1, slip2
+      real(kind=c_double), dimension(*), intent(in) :: tractionXY, tractionXZ, stateVariable, peakSlipRate
+      real(kind=c_double), dimension(*), intent(in) :: ruptureTime, dynStressTime
+      real(kind=c_double), dimension(*), intent(in) :: initialStressInFaultCS, nucleationStressInFaultCS
+      logical(kind=c_bool), value                   :: hasNucleationStress
+    end subroutine
+  end interface
+
+  interface
+    subroutine c_interoperability_initializeThermalPressurization(temperatureAndPressure, numberOfFaultSides) &
+        bind( C, name='c_interoperability_initializeThermalPressurization' )
+      use iso_c_binding, only: c_double, c_int
+      implicit none
+      real(kind=c_double), dimension(*), intent(in) :: temperatureAndPressure
+      integer(kind=c_int), value                    :: numberOfFaultSides
+    end subroutine
+  end interface
+
 
   ! Don't forget to add // c_null_char to NRFFileName when using this interface
   interface
@@ -265,11 +331,12 @@ module f_ftoc_bind_interoperability
   end interface
 
   interface
-    subroutine c_interoperability_enableWaveFieldOutput( i_waveFieldInterval, i_waveFieldFilename ) bind( C, name='c_interoperability_enableWaveFieldOutput' )
+    subroutine c_interoperability_enableWaveFieldOutput( i_waveFieldInterval, i_waveFieldFilename, i_outputRegionsFilename ) bind( C, name='c_interoperability_enableWaveFieldOutput' )
       use iso_c_binding
       implicit none
       real(kind=c_double), value :: i_waveFieldInterval
       character(kind=c_char), dimension(*), intent(in) :: i_waveFieldFilename
+      character(kind=c_char), dimension(*), intent(in) :: i_outputRegionsFilename
     end subroutine
 
     subroutine c_interoperability_enableFreeSurfaceOutput( maxRefinementDepth ) bind( C, name='c_interoperability_enableFreeSurfaceOutput' )
@@ -356,6 +423,15 @@ module f_ftoc_bind_interoperability
       integer(kind=c_int), value :: i_faceId
       real(kind=c_double), dimension(*), intent(out) :: o_dofs
     end subroutine
+
+    subroutine c_interoperability_getBulkDofsFromDerivatives( i_numberOfCells, i_meshIds, i_faceIds, o_dofs ) bind( C, name='c_interoperability_getBulkDofsFromDerivatives' )
+      use iso_c_binding
+      implicit none
+      integer(kind=c_int), value                     :: i_numberOfCells
+      integer(kind=c_int), dimension(*), intent(in)  :: i_meshIds
+      integer(kind=c_int), dimension(*), intent(in)  :: i_faceIds
+      real(kind=c_double), dimension(*), intent(out) :: o_dofs
+    end subroutine
   end interface
 
   interface c_interoperability_simulate
@@ -9,6 +9,14 @@ double AbstractTimeCluster::timeStepSize() const {
   return ct.timeStepSize(syncTime);
 }
 
+ClusterTimes AbstractTimeCluster::timesAfterCorrection() const {
+  ClusterTimes times = ct;
+  times.correctionTime += timeStepSize();
+  times.stepsSinceLastSync += times.timeStepRate;
+  times.stepsSinceStart += times.timeStepRate;
+  return times;
+}
+
 AbstractTimeCluster::AbstractTimeCluster(double maxTimeStepSize, long timeStepRate)
     : timeStepRate(timeStepRate), numberOfTimeSteps(0),
       timeOfLastStageChange(std::chrono::steady_clock::now()) {
@@ -29,6 +37,12 @@ ActorAction AbstractTimeCluster::getNextLegalAction() {
     }
     case ActorState::Predicted: {
       if (mayCorrect()) {
+        // The prediction is legal right after the correction if the neighbors are done with the current
+        // prediction and the next correction is not the last one before the sync point
+        const bool mayPredictNext = mayPredict() && ct.stepsSinceLastSync + ct.timeStepRate < ct.stepsUntilSync;
+        if (mayPredictNext && mayCorrectAndPredict()) {
+          return ActorAction::CorrectAndPredict;
+        }
         return ActorAction::Correct;
       }
       break;
@@ -52,44 +66,21 @@ void AbstractTimeCluster::unsafePerformAction(ActorAction action) {
     case ActorAction::Correct:
       assert(state == ActorState::Predicted);
       correct();
-      ct.correctionTime += timeStepSize();
-      ++numberOfTimeSteps;
-      ct.stepsSinceLastSync += ct.timeStepRate;
-      ct.stepsSinceStart += ct.timeStepRate;
-      for (auto &neighbor : neighbors) {
-        const bool justBeforeSync = ct.stepsUntilSync <= ct.predictionsSinceLastSync;
-        const bool sendMessage = justBeforeSync
-                                 || ct.stepsSinceLastSync >= neighbor.ct.predictionsSinceLastSync;
-        if (sendMessage) {
-          AdvancedCorrectionTimeMessage message{};
-          message.time = ct.correctionTime;
-          message.stepsSinceSync = ct.stepsSinceLastSync;
-          neighbor.outbox->push(message);
-        }
-      }
+      finishCorrection();
       state = ActorState::Corrected;
       break;
     case ActorAction::Predict:
       assert(state == ActorState::Corrected);
       predict();
-      ct.predictionsSinceLastSync += ct.timeStepRate;
-      ct.predictionsSinceStart += ct.timeStepRate;
-      ct.predictionTime += timeStepSize();
-
-      for (auto &neighbor : neighbors) {
-        // Maybe check also how many steps neighbor has to sync!
-        const bool justBeforeSync = ct.stepsUntilSync <= ct.predictionsSinceLastSync;
-        const bool sendMessage = justBeforeSync
-                                 || ct.predictionsSinceLastSync >= neighbor.ct.nextCorrectionSteps();
-        if (sendMessage) {
-          AdvancedPredictionTimeMessage message{};
-          message.time = ct.predictionTime;
-          message.stepsSinceSync = ct.predictionsSinceLastSync;
-          neighbor.outbox->push(message);
-        }
-      }
+      finishPrediction();
       state = ActorState::Predicted;
       break;
+    case ActorAction::CorrectAndPredict:
+      assert(state == ActorState::Predicted);
+      correctAndPredict();
+      finishCorrection();
+      finishPrediction();
+      break;
     case ActorAction::Sync:
       assert(state == ActorState::Corrected);
       logDebug(MPI::mpi.rank()) << "synced at" << syncTime
@@ -109,14 +100,69 @@ void AbstractTimeCluster::unsafePerformAction(ActorAction action) {
   }
 }
 
+void AbstractTimeCluster::finishCorrection() {
+  ct.correctionTime += timeStepSize();
+  ++numberOfTimeSteps;
+  ct.stepsSinceLastSync += ct.timeStepRate;
+  ct.stepsSinceStart += ct.timeStepRate;
+  for (auto &neighbor : neighbors) {
+    const bool justBeforeSync = ct.stepsUntilSync <= ct.predictionsSinceLastSync;
+    const bool sendMessage = justBeforeSync
+                             || ct.stepsSinceLastSync >= neighbor.ct.predictionsSinceLastSync;
+    if (sendMessage) {
+      AdvancedCorrectionTimeMessage message{};
+      message.time = ct.correctionTime;
+      message.stepsSinceSync = ct.stepsSinceLastSync;
+      message.event = correctionEvent;
+      if (traceRecorder != nullptr) {
+        message.traceId = traceRecorder->addSend(1);
+      }
+      neighbor.outbox->push(message);
+    }
+  }
+}
+
+void AbstractTimeCluster::finishPrediction() {
+  ct.predictionsSinceLastSync += ct.timeStepRate;
+  ct.predictionsSinceStart += ct.timeStepRate;
+  ct.predictionTime += timeStepSize();
+
+  for (auto &neighbor : neighbors) {
+    // Maybe check also how many steps neighbor has to sync!
+    const bool justBeforeSync = ct.stepsUntilSync <= ct.predictionsSinceLastSync;
+    const bool sendMessage = justBeforeSync
+                             || ct.predictionsSinceLastSync >= neighbor.ct.nextCorrectionSteps();
+    if (sendMessage) {
+      AdvancedPredictionTimeMessage message{};
+      message.time = ct.predictionTime;
+      message.stepsSinceSync = ct.predictionsSinceLastSync;
+      message.event = predictionEvent;
+      if (traceRecorder != nullptr) {
+        message.traceId = traceRecorder->addSend(0);
+      }
+      neighbor.outbox->push(message);
+    }
+  }
+}
+
 ActResult AbstractTimeCluster::act() {
   ActResult result;
   auto stateBefore = state;
   auto nextAction = getNextLegalAction();
-  unsafePerformAction(nextAction);
+  if (traceRecorder != nullptr && nextAction != ActorAction::Nothing) {
+    timespec begin;
+    timespec end;
+    clock_gettime(CLOCK_MONOTONIC, &begin);
+    unsafePerformAction(nextAction);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    traceRecorder->addAction(static_cast<int>(nextAction), begin, end);
+  } else {
+    unsafePerformAction(nextAction);
+  }
 
   const auto currentTime = std::chrono::steady_clock::now();
-  result.isStateChanged = stateBefore != state;
+  // CorrectAndPredict ends in the state it started from
+  result.isStateChanged = stateBefore != state || nextAction == ActorAction::CorrectAndPredict;
   if (!result.isStateChanged) {
     const auto timeSinceLastUpdate = currentTime - timeOfLastStageChange;
     if (timeSinceLastUpdate > timeout && !alreadyPrintedTimeOut) {
@@ -143,11 +189,19 @@ bool AbstractTimeCluster::processMessages() {
           assert(msg.time > neighbor.ct.predictionTime);
           neighbor.ct.predictionTime = msg.time;
           neighbor.ct.predictionsSinceLastSync = msg.stepsSinceSync;
+          neighbor.predictionEvent = msg.event;
+          if (traceRecorder != nullptr) {
+            traceRecorder->addReceive(0, msg.traceId);
+          }
           handleAdvancedPredictionTimeMessage(neighbor);
         } else if constexpr (std::is_same_v<T, AdvancedCorrectionTimeMessage>) {
           assert(msg.time > neighbor.ct.correctionTime);
           neighbor.ct.correctionTime = msg.time;
           neighbor.ct.stepsSinceLastSync = msg.stepsSinceSync;
+          neighbor.correctionEvent = msg.event;
+          if (traceRecorder != nullptr) {
+            traceRecorder->addReceive(1, msg.traceId);
+          }
           handleAdvancedCorrectionTimeMessage(neighbor);
         } else {
           static_assert(always_false<T>::value, "non-exhaustive visitor!");
@@ -182,6 +236,15 @@ bool AbstractTimeCluster::mayCorrect() {
 }
 
 
+bool AbstractTimeCluster::mayCorrectAndPredict() {
+  return false;
+}
+
+void AbstractTimeCluster::correctAndPredict() {
+  correct();
+  predict();
+}
+
 bool AbstractTimeCluster::maySync() {
     return ct.stepsSinceLastSync >= ct.stepsUntilSync;
 }
@@ -195,6 +258,10 @@ void AbstractTimeCluster::connect(AbstractTimeCluster &other) {
   other.neighbors.back().outbox = neighbors.back().inbox;
 }
 
+void AbstractTimeCluster::setTraceRecorder(ActorTraceRecorder* recorder) {
+  traceRecorder = recorder;
+}
+
 void AbstractTimeCluster::setSyncTime(double newSyncTime) {
   assert(newSyncTime > syncTime);
   assert(state == ActorState::Synced);
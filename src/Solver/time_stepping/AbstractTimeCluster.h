@@ -5,6 +5,7 @@
 #include <memory>
 #include <chrono>
 #include "ActorState.h"
+#include "Monitoring/ActorTrace.h"
 
 namespace seissol::time_stepping {
 
@@ -15,13 +16,24 @@ private:
   const std::chrono::seconds timeout = std::chrono::minutes(15);
   bool alreadyPrintedTimeOut = false;
 
+  //! Advances the times after correct() and sends them to the neighbors
+  void finishCorrection();
+  //! Advances the times after predict() and sends them to the neighbors
+  void finishPrediction();
+
 protected:
   ActorState state = ActorState::Synced;
   ClusterTimes ct;
   std::vector<NeighborCluster> neighbors;
   double syncTime = 0.0;
+  //! Device events recorded after predict() and correct(), passed to the neighbors with the messages
+  void* predictionEvent = nullptr;
+  void* correctionEvent = nullptr;
+  ActorTraceRecorder* traceRecorder = nullptr;
 
   [[nodiscard]] double timeStepSize() const;
+  //! Times of the cluster after the current correction, e.g. for the prediction of correctAndPredict()
+  [[nodiscard]] ClusterTimes timesAfterCorrection() const;
 
   void unsafePerformAction(ActorAction action);
   AbstractTimeCluster(double maxTimeStepSize, long timeStepRate);
@@ -32,6 +44,17 @@ protected:
   virtual void start() = 0;
   virtual void predict() = 0;
   virtual void correct() = 0;
+  /**
+   * True if the cluster may perform its correction and next prediction as one action
+   * (ActorAction::CorrectAndPredict). It is only requested if the prediction would be legal
+   * directly after the correction anyway.
+   **/
+  virtual bool mayCorrectAndPredict();
+  /**
+   * Correction and next prediction in one action; the times are advanced afterwards.
+   * The default calls correct() and predict(), both see the times before the correction.
+   **/
+  virtual void correctAndPredict();
   virtual bool processMessages();
   virtual void handleAdvancedPredictionTimeMessage(const NeighborCluster& neighborCluster) = 0;
   virtual void handleAdvancedCorrectionTimeMessage(const NeighborCluster& neighborCluster) = 0;
@@ -54,6 +77,8 @@ public:
   virtual void setPriority(ActorPriority priority);
 
   void connect(AbstractTimeCluster& other);
+  //! Records the actions and messages of the actor (SEISSOL_ACTOR_TRACE_PREFIX).
+  void setTraceRecorder(ActorTraceRecorder* recorder);
   void setSyncTime(double newSyncTime);
 
   [[nodiscard]] ActorState getState() const;
@@ -48,10 +48,12 @@ Message MessageQueue::pop() {
 }
 
 bool MessageQueue::hasMessages() const {
+  std::lock_guard lock{mutex};
   return !queue.empty();
 }
 
 size_t MessageQueue::size() const {
+  std::lock_guard lock{mutex};
   return queue.size();
 }
 
@@ -1,20 +1,33 @@
 #ifndef SEISSOL_ACTORSTATE_H
 #define SEISSOL_ACTORSTATE_H
 
+#include <cstdint>
 #include <mutex>
 #include <queue>
 #include <variant>
 
+#ifdef ACL_DEVICE
+#include <Solver/Pipeline/DrPipeline.h>
+#endif
+
 namespace seissol::time_stepping {
 
 struct AdvancedPredictionTimeMessage {
   double time;
   long stepsSinceSync;
+  //! Device event which completes with the prediction (nullptr if the sender synchronizes the device itself)
+  void* event = nullptr;
+  //! Identifies the message in the actor trace (0 if tracing is disabled)
+  std::uint64_t traceId = 0;
 };
 
 struct AdvancedCorrectionTimeMessage {
   double time;
   long stepsSinceSync;
+  //! Device event which completes with the correction (nullptr if the sender synchronizes the device itself)
+  void* event = nullptr;
+  //! Identifies the message in the actor trace (0 if tracing is disabled)
+  std::uint64_t traceId = 0;
 };
 
 using Message = std::variant<AdvancedPredictionTimeMessage, AdvancedCorrectionTimeMessage>;
@@ -26,7 +39,7 @@ inline std::ostream& operator<<(std::ostream& stream, const Message& message);
 class MessageQueue {
  private:
   std::queue<Message> queue;
-  std::mutex mutex;
+  mutable std::mutex mutex;
 
  public:
   MessageQueue() = default;
@@ -52,7 +65,9 @@ enum class ActorAction {
   Correct,
   Predict,
   Sync,
-  RestartAfterSync
+  RestartAfterSync,
+  //! Correct directly followed by Predict, see AbstractTimeCluster::correctAndPredict
+  CorrectAndPredict
 };
 
 std::string actorStateToString(ActorState state);
@@ -84,20 +99,33 @@ struct NeighborCluster {
   ClusterTimes ct;
   std::shared_ptr<MessageQueue> inbox = nullptr;
   std::shared_ptr<MessageQueue> outbox = nullptr;
+  //! Events of the last received messages, see AdvancedPredictionTimeMessage::event
+  void* predictionEvent = nullptr;
+  void* correctionEvent = nullptr;
 
   NeighborCluster(double maxTimeStepSize, int timeStepRate);
 
 };
 
+/**
+ * Shared by the copy and the interior actor of a cluster.
+ * In tasking mode, both actors may correct concurrently; they have to hold the lock
+ * (the scheduler is BasicLockable) while they query or update the scheduler.
+ **/
 class DynamicRuptureScheduler {
   long lastCorrectionStepsInterior = -1;
   long lastCorrectionStepsCopy = -1;
   long lastFaultOutput = -1;
   long numberOfDynamicRuptureFaces;
+  std::mutex mutex;
 
 public:
   explicit DynamicRuptureScheduler(long numberOfDynamicRuptureFaces);
 
+  void lock() { mutex.lock(); }
+
+  void unlock() { mutex.unlock(); }
+
   [[nodiscard]] bool mayComputeInterior(long curCorrectionSteps) const;
 
   [[nodiscard]] bool mayComputeFaultOutput(long curCorrectionSteps) const;
@@ -109,6 +137,12 @@ public:
   void setLastFaultOutput(long steps);
 
   [[nodiscard]] bool hasDynamicRuptureFaces() const;
+
+#ifdef ACL_DEVICE
+  // One pipeline per layer, each tuned to its number of faces; the interior one only runs under the lock
+  dr::pipeline::DrPipeline interiorPipeline;
+  dr::pipeline::DrPipeline copyPipeline;
+#endif
 };
 
 struct ActResult {
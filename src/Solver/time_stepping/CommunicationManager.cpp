@@ -1,9 +1,20 @@
 #include "CommunicationManager.h"
 
 #include "Parallel/Pin.h"
+#include "Parallel/MPI.h"
+#include <utils/env.h>
+#include <utils/logger.h>
+
+#include <algorithm>
+
+#ifdef ACL_DEVICE
+#include <device.h>
+#endif
 
 seissol::time_stepping::AbstractCommunicationManager::AbstractCommunicationManager(
-    seissol::time_stepping::AbstractCommunicationManager::ghostClusters_t ghostClusters) : ghostClusters(std::move(ghostClusters)) {
+    seissol::time_stepping::AbstractCommunicationManager::ghostClusters_t ghostClusters,
+    MessageAggregator* messageAggregator)
+    : ghostClusters(std::move(ghostClusters)), messageAggregator(messageAggregator) {
 
 }
 void seissol::time_stepping::AbstractCommunicationManager::reset(double newSyncTime) {
@@ -19,12 +30,32 @@ bool seissol::time_stepping::AbstractCommunicationManager::poll() {
     ghostCluster->act();
     finished = finished && ghostCluster->synced();
   }
+  progressAggregation();
   return finished;
 }
 
+bool seissol::time_stepping::AbstractCommunicationManager::poll(std::vector<GhostTimeCluster*> const& someGhostClusters) {
+  bool finished = true;
+  for (auto* ghostCluster : someGhostClusters) {
+    ghostCluster->act();
+    finished = finished && ghostCluster->synced();
+  }
+  progressAggregation();
+  return finished;
+}
+
+void seissol::time_stepping::AbstractCommunicationManager::progressAggregation() {
+#ifdef USE_MPI
+  if (messageAggregator != nullptr) {
+    messageAggregator->progress();
+  }
+#endif
+}
+
 seissol::time_stepping::SerialCommunicationManager::SerialCommunicationManager(
-    seissol::time_stepping::AbstractCommunicationManager::ghostClusters_t ghostClusters)
-    : AbstractCommunicationManager(std::move(ghostClusters)) {
+    seissol::time_stepping::AbstractCommunicationManager::ghostClusters_t ghostClusters,
+    MessageAggregator* messageAggregator)
+    : AbstractCommunicationManager(std::move(ghostClusters), messageAggregator) {
 
 }
 
@@ -41,52 +72,95 @@ void seissol::time_stepping::SerialCommunicationManager::progression() {
 
 seissol::time_stepping::ThreadedCommunicationManager::ThreadedCommunicationManager(
     seissol::time_stepping::AbstractCommunicationManager::ghostClusters_t ghostClusters,
-    const seissol::parallel::Pinning* pinning)
-    : AbstractCommunicationManager(std::move(ghostClusters)),
-      thread(),
+    const seissol::parallel::Pinning* pinning,
+    MessageAggregator* messageAggregator)
+    : AbstractCommunicationManager(std::move(ghostClusters), messageAggregator),
       shouldReset(false),
-      isFinished(false),
       pinning(pinning) {
+  const auto requestedThreads = std::max(1U, utils::Env::get<unsigned>("SEISSOL_COMMTHREADS", 1));
+  const auto numberOfThreads = std::max<std::size_t>(1, std::min<std::size_t>(requestedThreads, this->ghostClusters.size()));
+
+  // Group the ghost clusters by the NUMA node of their copy layers
+  std::vector<std::pair<int, GhostTimeCluster*>> clustersByNumaNode;
+  clustersByNumaNode.reserve(this->ghostClusters.size());
+  for (auto& ghostCluster : this->ghostClusters) {
+    clustersByNumaNode.emplace_back(parallel::Pinning::numaNodeOfAddress(ghostCluster->getCopyLayerAddress()),
+                                    ghostCluster.get());
+  }
+  std::stable_sort(clustersByNumaNode.begin(), clustersByNumaNode.end(), [](auto const& a, auto const& b) {
+    return a.first < b.first;
+  });
+
+  // The free CPUs are computed once, as this involves a collective over all ranks of the node.
+  const auto freeMask = pinning->getFreeCPUsMask();
+  const int rank = MPI::mpi.rank();
+  for (std::size_t threadId = 0; threadId < numberOfThreads; ++threadId) {
+    auto progressThread = std::make_unique<ProgressThread>();
+    const auto begin = threadId * clustersByNumaNode.size() / numberOfThreads;
+    const auto end = (threadId + 1) * clustersByNumaNode.size() / numberOfThreads;
+    for (auto i = begin; i < end; ++i) {
+      progressThread->ghostClusters.push_back(clustersByNumaNode[i].second);
+    }
+    if (begin < end) {
+      progressThread->numaNode = clustersByNumaNode[begin].first;
+    }
+    progressThread->mask = parallel::Pinning::restrictToNumaNode(freeMask, progressThread->numaNode);
+    logInfo(rank) << "Communication thread" << threadId << "progresses" << progressThread->ghostClusters.size()
+                  << "ghost clusters on NUMA node" << progressThread->numaNode
+                  << "with affinity" << parallel::Pinning::maskToString(progressThread->mask);
+    threads.push_back(std::move(progressThread));
+  }
 }
 
 void seissol::time_stepping::ThreadedCommunicationManager::progression() {
-  // Do nothing: Thread takes care of that.
+  // Do nothing: Threads take care of that.
 }
 
 bool seissol::time_stepping::ThreadedCommunicationManager::checkIfFinished() const {
-  return isFinished.load();
+  return std::all_of(threads.begin(), threads.end(), [](auto const& progressThread) {
+    return progressThread->isFinished.load();
+  });
+}
+
+void seissol::time_stepping::ThreadedCommunicationManager::joinThreads() {
+  for (auto& progressThread : threads) {
+    if (progressThread->thread.joinable()) {
+      progressThread->thread.join();
+    }
+  }
 }
 
 void seissol::time_stepping::ThreadedCommunicationManager::reset(double newSyncTime) {
-  // Send signal to comm. thread to finish and wait.
+  // Send signal to comm. threads to finish and wait.
   shouldReset.store(true);
-  if (thread.joinable()) {
-    thread.join();
-  }
+  joinThreads();
 
   // Reset flags and reset ghost clusters
   shouldReset.store(false);
-  isFinished.store(false);
+  for (auto& progressThread : threads) {
+    progressThread->isFinished.store(false);
+  }
   AbstractCommunicationManager::reset(newSyncTime);
 
-  // Start a new communication thread.
-  // Note: Easier than keeping one alive, and not that expensive.
-  thread = std::thread([this](){
-    // Pin this thread to the last core
-    // We compute the mask outside the thread because otherwise
-    // it confuses profilers and debuggers!
-    pinning->pinToFreeCPUs();
-    while(!shouldReset.load() && !isFinished.load()) {
-      isFinished.store(this->poll());
-    }
-  });
+  // Start new communication threads.
+  // Note: Easier than keeping them alive, and not that expensive.
+  for (auto& progressThread : threads) {
+    progressThread->thread = std::thread([this, progressThread = progressThread.get()]() {
+      // Pin this thread to the free CPUs (of the NUMA node of its copy layers).
+      // We compute the mask outside the thread because otherwise
+      // it confuses profilers and debuggers!
+      parallel::Pinning::pinToCPUs(progressThread->mask);
+#ifdef ACL_DEVICE
+      // The ghost clusters may copy from and to the device (SEISSOL_MPI_DEVICE_BUFFERS=1)
+      device::DeviceInstance::getInstance().api->setDevice(seissol::MPI::mpi.getDeviceID());
+#endif
+      while (!shouldReset.load() && !progressThread->isFinished.load()) {
+        progressThread->isFinished.store(poll(progressThread->ghostClusters));
+      }
+    });
+  }
 }
 
 seissol::time_stepping::ThreadedCommunicationManager::~ThreadedCommunicationManager() {
-  if (thread.joinable()) {
-    thread.join();
-  }
+  joinThreads();
 }
-
-
-
@@ -8,6 +8,7 @@
 #include <Parallel/Pin.h>
 
 #include "Solver/time_stepping/GhostTimeCluster.h"
+#include "Solver/time_stepping/MessageAggregator.h"
 
 namespace seissol::time_stepping {
 
@@ -21,15 +22,22 @@ public:
   virtual ~AbstractCommunicationManager() = default;
 
 protected:
-  explicit AbstractCommunicationManager(ghostClusters_t ghostClusters);
+  AbstractCommunicationManager(ghostClusters_t ghostClusters, MessageAggregator* messageAggregator);
   bool poll();
+  //! Lets the given ghost clusters act once; returns true if all of them are synced.
+  bool poll(std::vector<GhostTimeCluster*> const& someGhostClusters);
+  //! Sends the regions aggregated in the last sweep over the ghost clusters.
+  void progressAggregation();
   ghostClusters_t ghostClusters;
+  //! nullptr unless SEISSOL_MPI_AGGREGATION=1
+  MessageAggregator* messageAggregator;
 
 };
 
 class SerialCommunicationManager : public AbstractCommunicationManager {
 public:
-  explicit SerialCommunicationManager(ghostClusters_t ghostClusters);
+  explicit SerialCommunicationManager(ghostClusters_t ghostClusters,
+                                      MessageAggregator* messageAggregator = nullptr);
   void progression() override;
   [[nodiscard]] bool checkIfFinished() const override;
 };
@@ -37,7 +45,8 @@ public:
 class ThreadedCommunicationManager : public AbstractCommunicationManager {
 public:
   ThreadedCommunicationManager(ghostClusters_t ghostClusters,
-                               const parallel::Pinning* pinning);
+                               const parallel::Pinning* pinning,
+                               MessageAggregator* messageAggregator = nullptr);
   void progression() override;
   [[nodiscard]] bool checkIfFinished() const override;
   void reset(double newSyncTime) override;
@@ -45,9 +54,20 @@ public:
   ~ThreadedCommunicationManager() override;
 
 private:
-  std::thread thread;
+  //! A communication thread, which progresses a subset of the ghost clusters.
+  struct ProgressThread {
+    std::vector<GhostTimeCluster*> ghostClusters;
+    //! NUMA node which holds the copy layers of the ghost clusters (-1 if unknown)
+    int numaNode = -1;
+    cpu_set_t mask{};
+    std::thread thread;
+    std::atomic<bool> isFinished{false};
+  };
+
+  void joinThreads();
+
+  std::vector<std::unique_ptr<ProgressThread>> threads;
   std::atomic<bool> shouldReset;
-  std::atomic<bool> isFinished;
   const parallel::Pinning* pinning;
 };
 
@@ -2,65 +2,209 @@
 #include <Solver/time_stepping/GhostTimeCluster.h>
 
 #include "GhostTimeCluster.h"
+#include "MessageAggregator.h"
+#include "Monitoring/Stopwatch.h"
+#include "Parallel/SharedHalo.h"
+
+#include <algorithm>
+#include <cmath>
+
+#ifdef ACL_DEVICE
+#include <device.h>
+#include <Kernels/DeviceAux/StreamAux.h>
+#endif
 
 namespace seissol::time_stepping {
 void GhostTimeCluster::sendCopyLayer(){
   SCOREP_USER_REGION( "sendCopyLayer", SCOREP_USER_REGION_TYPE_FUNCTION )
   assert(ct.correctionTime > lastSendTime);
   lastSendTime = ct.correctionTime;
-  for (unsigned int region = 0; region < meshStructure->numberOfRegions; ++region) {
-    if (meshStructure->neighboringClusters[region][1] == static_cast<int>(otherGlobalClusterId)) {
-     MPI_Isend(meshStructure->copyRegions[region],
+  clock_gettime(CLOCK_MONOTONIC, &sendBegin);
+  for (unsigned int region : regions) {
+    void* copyRegion = meshStructure->copyRegions[region];
+    MPI_Datatype datatype = MPI_C_REAL;
+    if (meshStructure->compressedCopyRegions != nullptr) {
+      compressCopyRegion(region);
+      copyRegion = meshStructure->compressedCopyRegions[region];
+      datatype = MPI_FLOAT;
+    } else if (meshStructure->deviceCopyRegions != nullptr) {
+      stageCopyRegionOnDevice(region);
+      copyRegion = meshStructure->deviceCopyRegions[region];
+    }
+    if (isSharedRegion(region)) {
+      // published by testRegion once the neighbor consumed the previous message
+      ++sharedSends[region];
+    } else if (isAggregatedRegion(region)) {
+      aggregatedSends[region] = messageAggregator->send(meshStructure->neighboringClusters[region][0],
+                                                        meshStructure->sendIdentifiers[region],
+                                                        meshStructure->copyRegions[region],
+                                                        meshStructure->copyRegionSizes[region]);
+    } else if (meshStructure->hasPersistentRequests) {
+      MPI_Start(meshStructure->sendRequests + region);
+    } else {
+      MPI_Isend(copyRegion,
                 static_cast<int>(meshStructure->copyRegionSizes[region]),
-                MPI_C_REAL,
+                datatype,
                 meshStructure->neighboringClusters[region][0],
                 timeData + meshStructure->sendIdentifiers[region],
                 seissol::MPI::mpi.comm(),
                 meshStructure->sendRequests + region
                );
-      sendQueue.push_back(meshStructure->sendRequests + region);
     }
+    sendQueue.push_back(region);
   }
 } void GhostTimeCluster::receiveGhostLayer(){
   SCOREP_USER_REGION( "receiveGhostLayer", SCOREP_USER_REGION_TYPE_FUNCTION )
   assert(ct.predictionTime > lastSendTime);
-  for (unsigned int region = 0; region < meshStructure->numberOfRegions; ++region) {
-    if (meshStructure->neighboringClusters[region][1] == static_cast<int>(otherGlobalClusterId) ) {
-      MPI_Irecv(meshStructure->ghostRegions[region],
+  clock_gettime(CLOCK_MONOTONIC, &receiveBegin);
+  for (unsigned int region : regions) {
+    if (isSharedRegion(region)) {
+      ++sharedReceives[region];
+    } else if (isAggregatedRegion(region)) {
+      // fetched by testRegion once the aggregated message arrived
+    } else if (meshStructure->hasPersistentRequests) {
+      MPI_Start(meshStructure->receiveRequests + region);
+    } else {
+      void* ghostRegion = meshStructure->ghostRegions[region];
+      MPI_Datatype datatype = MPI_C_REAL;
+      if (meshStructure->compressedGhostRegions != nullptr) {
+        ghostRegion = meshStructure->compressedGhostRegions[region];
+        datatype = MPI_FLOAT;
+      } else if (meshStructure->deviceGhostRegions != nullptr) {
+        ghostRegion = meshStructure->deviceGhostRegions[region];
+      }
+      MPI_Irecv(ghostRegion,
                 static_cast<int>(meshStructure->ghostRegionSizes[region]),
-                MPI_C_REAL,
+                datatype,
                 meshStructure->neighboringClusters[region][0],
                 timeData + meshStructure->receiveIdentifiers[region],
                 seissol::MPI::mpi.comm(),
                 meshStructure->receiveRequests + region
                );
-      receiveQueue.push_back(meshStructure->receiveRequests + region );
     }
+    receiveQueue.push_back(region);
   }
 }
 
 
-bool GhostTimeCluster::testQueue(std::list<MPI_Request*>& queue) {
-  for (auto request = queue.begin(); request != queue.end(); ) {
-    int testSuccess = 0;
-    MPI_Test(*request, &testSuccess, MPI_STATUS_IGNORE);
-    if (testSuccess) {
-      request = queue.erase(request);
-    } else {
-      ++request;
+bool GhostTimeCluster::trySendPendingCopyLayer() {
+  if (pendingSendEvent == nullptr) {
+    return true;
+  }
+  if (!isDeviceEventComplete(pendingSendEvent)) {
+    return false;
+  }
+  pendingSendEvent = nullptr;
+  sendCopyLayer();
+  return true;
+}
+
+void GhostTimeCluster::compressCopyRegion(unsigned int region) {
+  const real* source = meshStructure->copyRegions[region];
+  float* target = meshStructure->compressedCopyRegions[region];
+  const unsigned int size = meshStructure->copyRegionSizes[region];
+  double maxError = 0.0;
+  double maxValue = 0.0;
+  for (unsigned int i = 0; i < size; ++i) {
+    target[i] = static_cast<float>(source[i]);
+    maxError = std::max(maxError, std::abs(static_cast<double>(source[i]) - static_cast<double>(target[i])));
+    maxValue = std::max(maxValue, std::abs(static_cast<double>(source[i])));
+  }
+  actorStateStatistics->addHaloCompressionError(maxError, maxValue);
+}
+
+void GhostTimeCluster::decompressGhostRegion(unsigned int region) {
+  const float* source = meshStructure->compressedGhostRegions[region];
+  real* target = meshStructure->ghostRegions[region];
+  std::copy_n(source, meshStructure->ghostRegionSizes[region], target);
+}
+
+void GhostTimeCluster::stageCopyRegionOnDevice(unsigned int region) {
+#ifdef ACL_DEVICE
+  // The copy layer was computed on the device, which was synchronized at the end of the prediction.
+  device::DeviceInstance::getInstance().api->copyBetween(meshStructure->deviceCopyRegions[region],
+                                                         meshStructure->copyRegions[region],
+                                                         meshStructure->copyRegionSizes[region] * sizeof(real));
+#endif
+}
+
+void GhostTimeCluster::unstageGhostRegionFromDevice(unsigned int region) {
+#ifdef ACL_DEVICE
+  device::DeviceInstance::getInstance().api->copyBetween(meshStructure->ghostRegions[region],
+                                                         meshStructure->deviceGhostRegions[region],
+                                                         meshStructure->ghostRegionSizes[region] * sizeof(real));
+#endif
+}
+
+bool GhostTimeCluster::isSharedRegion(unsigned int region) const {
+  return meshStructure->sharedCopySlots != nullptr && meshStructure->sharedCopySlots[region] != nullptr;
+}
+
+bool GhostTimeCluster::isAggregatedRegion(unsigned int region) const {
+  return messageAggregator != nullptr && !isSharedRegion(region);
+}
+
+bool GhostTimeCluster::testRegion(unsigned int region, bool isReceive) {
+  if (isSharedRegion(region)) {
+    if (isReceive) {
+      return parallel::tryConsume(*meshStructure->sharedGhostSlots[region],
+                                  sharedReceives[region],
+                                  meshStructure->ghostRegions[region],
+                                  meshStructure->ghostRegionSizes[region]);
+    }
+    return parallel::tryPublish(*meshStructure->sharedCopySlots[region],
+                                sharedSends[region],
+                                meshStructure->copyRegions[region],
+                                meshStructure->copyRegionSizes[region]);
+  }
+  if (isAggregatedRegion(region)) {
+    if (isReceive) {
+      return messageAggregator->tryReceive(meshStructure->neighboringClusters[region][0],
+                                           meshStructure->receiveIdentifiers[region],
+                                           meshStructure->ghostRegions[region],
+                                           meshStructure->ghostRegionSizes[region]);
     }
+    return messageAggregator->isSent(aggregatedSends[region]);
+  }
+  int testSuccess = 0;
+  MPI_Test((isReceive ? meshStructure->receiveRequests : meshStructure->sendRequests) + region,
+           &testSuccess,
+           MPI_STATUS_IGNORE);
+  if (testSuccess != 0 && isReceive) {
+    if (meshStructure->compressedGhostRegions != nullptr) {
+      decompressGhostRegion(region);
+    } else if (meshStructure->deviceGhostRegions != nullptr) {
+      unstageGhostRegionFromDevice(region);
+    }
+  }
+  return testSuccess != 0;
+}
+
+bool GhostTimeCluster::testQueue(std::vector<unsigned int>& queue, timespec const& postedAt, bool isReceiveQueue) {
+  const bool wasEmpty = queue.empty();
+  timespec end{};
+  queue.erase(std::remove_if(queue.begin(), queue.end(), [&](unsigned int region) {
+    if (!testRegion(region, isReceiveQueue)) {
+      return false;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    actorStateStatistics->recordRegionMessage(regionStatistics[region], isReceiveQueue, seissol::difftime(postedAt, end));
+    return true;
+  }), queue.end());
+  if (!wasEmpty && queue.empty()) {
+    actorStateStatistics->addCommunication(postedAt, end);
   }
   return queue.empty();
 }
 bool GhostTimeCluster::testForGhostLayerReceives(){
   SCOREP_USER_REGION( "testForGhostLayerReceives", SCOREP_USER_REGION_TYPE_FUNCTION )
-  return testQueue(receiveQueue);
+  return testQueue(receiveQueue, receiveBegin, true);
 }
 
 
 bool GhostTimeCluster::testForCopyLayerSends(){
   SCOREP_USER_REGION( "testForCopyLayerSends", SCOREP_USER_REGION_TYPE_FUNCTION )
-  return testQueue(sendQueue);
+  return trySendPendingCopyLayer() && testQueue(sendQueue, sendBegin, false);
 }
 
 ActResult GhostTimeCluster::act() {
@@ -93,9 +237,29 @@ bool GhostTimeCluster::maySync() {
   return testForGhostLayerReceives() && testForCopyLayerSends() && AbstractTimeCluster::maySync();
 }
 
-void GhostTimeCluster::handleAdvancedPredictionTimeMessage(const NeighborCluster&) {
+void GhostTimeCluster::waitForDeviceEvent(void* event) {
+#ifdef ACL_DEVICE
+  if (event != nullptr) {
+    kernels::device::aux::stream::synchronizeEvent(event);
+  }
+#endif
+}
+
+bool GhostTimeCluster::isDeviceEventComplete(void* event) {
+#ifdef ACL_DEVICE
+  if (event != nullptr) {
+    return kernels::device::aux::stream::queryEvent(event);
+  }
+#endif
+  return true;
+}
+
+void GhostTimeCluster::handleAdvancedPredictionTimeMessage(const NeighborCluster& neighborCluster) {
   assert(testForCopyLayerSends());
-  sendCopyLayer();
+  // The copy layer has to be complete before it is sent. Instead of blocking the scheduler, the send is posted by
+  // act() as soon as the prediction of the copy layer is done on the device.
+  pendingSendEvent = neighborCluster.predictionEvent;
+  trySendPendingCopyLayer();
 }
 void GhostTimeCluster::handleAdvancedCorrectionTimeMessage(const NeighborCluster& neighborCluster) {
   assert(testForGhostLayerReceives());
@@ -112,6 +276,8 @@ void GhostTimeCluster::handleAdvancedCorrectionTimeMessage(const NeighborCluster
   // This is also true for the last sync point (i.e. end of simulation), as in this case we do not want to have any
   // hanging request.
   if (!ignoreMessage) {
+    // the copy cluster must not read the ghost layer anymore when it is overwritten
+    waitForDeviceEvent(neighborCluster.correctionEvent);
     receiveGhostLayer();
   }
 }
@@ -120,12 +286,46 @@ GhostTimeCluster::GhostTimeCluster(double maxTimeStepSize,
                                    int timeStepRate,
                                    int globalTimeClusterId,
                                    int otherGlobalTimeClusterId,
-                                   const MeshStructure *meshStructure)
+                                   const MeshStructure *meshStructure,
+                                   ActorStateStatistics* actorStateStatistics,
+                                   MessageAggregator* messageAggregator)
     : AbstractTimeCluster(maxTimeStepSize, timeStepRate),
       globalClusterId(globalTimeClusterId),
       otherGlobalClusterId(otherGlobalTimeClusterId),
-      meshStructure(meshStructure) {
+      meshStructure(meshStructure),
+      messageAggregator(messageAggregator),
+      actorStateStatistics(actorStateStatistics) {
+  for (unsigned int region = 0; region < meshStructure->numberOfRegions; ++region) {
+    if (meshStructure->neighboringClusters[region][1] == static_cast<int>(otherGlobalClusterId)) {
+      regions.push_back(region);
+    }
+  }
+  sendQueue.reserve(regions.size());
+  receiveQueue.reserve(regions.size());
+  sharedSends.assign(meshStructure->numberOfRegions, 0);
+  sharedReceives.assign(meshStructure->numberOfRegions, 0);
+  aggregatedSends.assign(meshStructure->numberOfRegions, 0);
+
+  const std::size_t bytesPerValue = meshStructure->compressedCopyRegions != nullptr ? sizeof(float) : sizeof(real);
+  regionStatistics.assign(meshStructure->numberOfRegions, 0);
+  for (unsigned int region : regions) {
+    RegionCommunication communication;
+    communication.rank = MPI::mpi.rank();
+    communication.neighborRank = meshStructure->neighboringClusters[region][0];
+    communication.globalClusterId = globalClusterId;
+    communication.neighborClusterId = otherGlobalClusterId;
+    communication.sendBytes = meshStructure->copyRegionSizes[region] * bytesPerValue;
+    communication.receiveBytes = meshStructure->ghostRegionSizes[region] * bytesPerValue;
+    regionStatistics[region] = actorStateStatistics->addRegionCommunication(communication);
+  }
 }
+const void* GhostTimeCluster::getCopyLayerAddress() const {
+  if (regions.empty()) {
+    return nullptr;
+  }
+  return meshStructure->copyRegions[regions.front()];
+}
+
 void GhostTimeCluster::reset() {
   AbstractTimeCluster::reset();
   assert(testForGhostLayerReceives());
@@ -1,26 +1,72 @@
 #ifndef SEISSOL_GHOSTTIMECLUSTER_H
 #define SEISSOL_GHOSTTIMECLUSTER_H
 
-#include <list>
+#include <cstdint>
+#include <time.h>
+#include <vector>
 #include "Initializer/typedefs.hpp"
 #include "AbstractTimeCluster.h"
+#include "Monitoring/ActorStateStatistics.h"
 
 namespace seissol::time_stepping {
+class MessageAggregator;
 
 class GhostTimeCluster : public AbstractTimeCluster {
  private:
   const int globalClusterId;
   const int otherGlobalClusterId;
   const MeshStructure* meshStructure;
-  std::list<MPI_Request*> sendQueue;
-  std::list<MPI_Request*> receiveQueue;
+  //! Regions of the mesh structure which are exchanged with the other cluster
+  std::vector<unsigned int> regions;
+  //! Regions whose sends and receives are not complete yet
+  std::vector<unsigned int> sendQueue;
+  std::vector<unsigned int> receiveQueue;
+  //! Number of messages sent and received per region, which are exchanged through shared memory
+  std::vector<std::uint64_t> sharedSends;
+  std::vector<std::uint64_t> sharedReceives;
+  //! Aggregates the regions sent to the same rank (nullptr unless SEISSOL_MPI_AGGREGATION=1)
+  MessageAggregator* messageAggregator;
+  //! Handles of the aggregated messages, which contain the last send of each region
+  std::vector<std::uint64_t> aggregatedSends;
+  ActorStateStatistics* actorStateStatistics;
+  //! Index of each exchanged region in the region communications of the statistics
+  std::vector<std::size_t> regionStatistics;
+  //! Time at which the requests of the (non-empty) queues were posted
+  timespec sendBegin{};
+  timespec receiveBegin{};
 
   double lastSendTime = -1.0;
+  //! Event of the copy layer whose prediction is sent once it completes; nullptr if no send is pending
+  void* pendingSendEvent = nullptr;
 
   void sendCopyLayer();
+  //! Sends the copy layer if its prediction is done on the device; returns false while the send is still pending.
+  bool trySendPendingCopyLayer();
   void receiveGhostLayer();
 
-  static bool testQueue(std::list<MPI_Request*>& queue);
+  //! Converts a copy region to single precision and records the conversion error.
+  void compressCopyRegion(unsigned int region);
+  //! Converts a received ghost region back to the working precision.
+  void decompressGhostRegion(unsigned int region);
+  //! Copies a copy region to its device staging buffer, which is sent by a GPU-aware MPI.
+  void stageCopyRegionOnDevice(unsigned int region);
+  //! Copies a received device staging buffer to the ghost region.
+  void unstageGhostRegionFromDevice(unsigned int region);
+
+  //! Blocks until the work of a neighboring cluster, which was announced with the event, is done on the device.
+  static void waitForDeviceEvent(void* event);
+  //! True if the work announced with the event is done on the device (or if there is no event).
+  static bool isDeviceEventComplete(void* event);
+
+  //! True if the region is exchanged through the shared memory window.
+  [[nodiscard]] bool isSharedRegion(unsigned int region) const;
+  //! True if the region is sent and received in aggregated messages.
+  [[nodiscard]] bool isAggregatedRegion(unsigned int region) const;
+  //! Tests the send or receive of a region; shared memory regions are copied once the handshake allows it.
+  bool testRegion(unsigned int region, bool isReceive);
+
+  //! Tests all regions of the queue and records the communication once it became empty.
+  bool testQueue(std::vector<unsigned int>& queue, timespec const& postedAt, bool isReceiveQueue);
   bool testForCopyLayerSends();
   bool testForGhostLayerReceives();
 
@@ -39,11 +85,16 @@ class GhostTimeCluster : public AbstractTimeCluster {
                    int timeStepRate,
                    int globalTimeClusterId,
                    int otherGlobalTimeClusterId,
-                   const MeshStructure* meshStructure
+                   const MeshStructure* meshStructure,
+                   ActorStateStatistics* actorStateStatistics,
+                   MessageAggregator* messageAggregator = nullptr
   );
   void reset() override;
   ActResult act() override;
 
+  //! Start of the first exchanged copy region (nullptr if there is none), e.g. to find its NUMA node.
+  [[nodiscard]] const void* getCopyLayerAddress() const;
+
 };
 
 
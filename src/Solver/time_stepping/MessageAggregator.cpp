@@ -0,0 +1,115 @@
+#include "MessageAggregator.h"
+
+#ifdef USE_MPI
+#include <algorithm>
+
+#include <utils/logger.h>
+
+namespace seissol::time_stepping {
+namespace {
+constexpr int AggregatedMessageTag = 0;
+} // namespace
+
+MessageAggregator::MessageAggregator(MPI_Comm comm) { MPI_Comm_dup(comm, &m_comm); }
+
+MessageAggregator::~MessageAggregator() {
+  int isFinalized = 0;
+  MPI_Finalized(&isFinalized);
+  if (!isFinalized) {
+    for (auto& pendingSend : m_sends) {
+      MPI_Wait(&pendingSend.request, MPI_STATUS_IGNORE);
+    }
+    MPI_Comm_free(&m_comm);
+  }
+}
+
+std::uint64_t MessageAggregator::send(int rank, int identifier, const real* data, std::size_t size) {
+  std::lock_guard lock(m_mutex);
+  auto message = m_messages.find(rank);
+  if (message == m_messages.end()) {
+    message = m_messages.emplace(rank, std::make_pair(AggregatedMessage{}, m_nextHandle++)).first;
+    m_pendingHandles.insert(message->second.second);
+  }
+  message->second.first.append(identifier, data, size);
+  ++m_numberOfRegions;
+  return message->second.second;
+}
+
+bool MessageAggregator::isSent(std::uint64_t handle) {
+  std::lock_guard lock(m_mutex);
+  return m_pendingHandles.count(handle) == 0;
+}
+
+bool MessageAggregator::tryReceive(int rank, int identifier, real* data, std::size_t size) {
+  std::lock_guard lock(m_mutex);
+  auto regions = m_received.find({rank, identifier});
+  if (regions == m_received.end() || regions->second.empty()) {
+    return false;
+  }
+  const auto& region = regions->second.front();
+  if (region.size() != size) {
+    logError() << "The aggregated region" << identifier << "of rank" << rank << "has" << region.size()
+               << "values instead of" << size;
+  }
+  std::copy(region.begin(), region.end(), data);
+  regions->second.pop_front();
+  return true;
+}
+
+void MessageAggregator::progress() {
+  std::lock_guard lock(m_mutex);
+
+  // send one message per rank with all regions of this sweep
+  for (auto& [rank, message] : m_messages) {
+    PendingSend& pendingSend = m_sends.emplace_back();
+    pendingSend.handle = message.second;
+    pendingSend.buffer = message.first.finish();
+    MPI_Isend(pendingSend.buffer.data(),
+              static_cast<int>(pendingSend.buffer.size()),
+              MPI_BYTE,
+              rank,
+              AggregatedMessageTag,
+              m_comm,
+              &pendingSend.request);
+    ++m_numberOfMessages;
+  }
+  m_messages.clear();
+
+  m_sends.erase(std::remove_if(m_sends.begin(), m_sends.end(), [&](PendingSend& pendingSend) {
+    int testSuccess = 0;
+    MPI_Test(&pendingSend.request, &testSuccess, MPI_STATUS_IGNORE);
+    if (testSuccess != 0) {
+      m_pendingHandles.erase(pendingSend.handle);
+    }
+    return testSuccess != 0;
+  }), m_sends.end());
+
+  // receive all arrived messages; the regions of a rank arrive in the order they were sent
+  while (true) {
+    int hasMessage = 0;
+    MPI_Message probedMessage;
+    MPI_Status status;
+    MPI_Improbe(MPI_ANY_SOURCE, AggregatedMessageTag, m_comm, &hasMessage, &probedMessage, &status);
+    if (hasMessage == 0) {
+      break;
+    }
+    int size = 0;
+    MPI_Get_count(&status, MPI_BYTE, &size);
+    std::vector<char> buffer(size);
+    MPI_Mrecv(buffer.data(), size, MPI_BYTE, &probedMessage, MPI_STATUS_IGNORE);
+    const int rank = status.MPI_SOURCE;
+    const bool isValid = AggregatedMessage::unpack(buffer, [&](std::int32_t identifier, std::vector<real>&& data) {
+      m_received[{rank, identifier}].push_back(std::move(data));
+    });
+    if (!isValid) {
+      logError() << "Received a malformed aggregated message from rank" << rank;
+    }
+  }
+}
+
+std::pair<std::uint64_t, std::uint64_t> MessageAggregator::statistics() {
+  std::lock_guard lock(m_mutex);
+  return {m_numberOfRegions, m_numberOfMessages};
+}
+} // namespace seissol::time_stepping
+#endif
@@ -0,0 +1,151 @@
+#ifndef SEISSOL_MESSAGEAGGREGATOR_H
+#define SEISSOL_MESSAGEAGGREGATOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "Kernels/precision.hpp"
+
+#ifdef USE_MPI
+#include <mpi.h>
+#endif
+
+namespace seissol::time_stepping {
+
+//! Region in an aggregated message: the message identifier of the region and its size (in reals)
+struct AggregatedPart {
+  std::int32_t identifier;
+  std::uint32_t size;
+};
+
+/**
+ * Message, which packs several regions for the same rank.
+ * Layout: the data of all regions, followed by the parts (header) and the number of parts,
+ * such that the data can be appended without knowing the number of regions in advance.
+ **/
+class AggregatedMessage {
+  public:
+  void append(std::int32_t identifier, const real* data, std::size_t size) {
+    const auto offset = m_buffer.size();
+    m_buffer.resize(offset + size * sizeof(real));
+    std::memcpy(m_buffer.data() + offset, data, size * sizeof(real));
+    m_parts.push_back({identifier, static_cast<std::uint32_t>(size)});
+  }
+
+  [[nodiscard]] bool empty() const { return m_parts.empty(); }
+
+  //! Appends the header and returns the message; the aggregated message is empty afterwards.
+  std::vector<char> finish() {
+    const std::uint64_t numberOfParts = m_parts.size();
+    const auto offset = m_buffer.size();
+    m_buffer.resize(offset + numberOfParts * sizeof(AggregatedPart) + sizeof(numberOfParts));
+    std::memcpy(m_buffer.data() + offset, m_parts.data(), numberOfParts * sizeof(AggregatedPart));
+    std::memcpy(m_buffer.data() + offset + numberOfParts * sizeof(AggregatedPart), &numberOfParts, sizeof(numberOfParts));
+    m_parts.clear();
+    return std::exchange(m_buffer, {});
+  }
+
+  /**
+   * Calls handler(identifier, data) with the data of each region (std::vector<real>) of a received message,
+   * in the order the regions were appended.
+   * Returns false if the message is malformed.
+   **/
+  template <typename HandlerT>
+  static bool unpack(const std::vector<char>& message, HandlerT&& handler) {
+    std::uint64_t numberOfParts = 0;
+    if (message.size() < sizeof(numberOfParts)) {
+      return false;
+    }
+    std::memcpy(&numberOfParts, message.data() + message.size() - sizeof(numberOfParts), sizeof(numberOfParts));
+    const auto headerSize = numberOfParts * sizeof(AggregatedPart) + sizeof(numberOfParts);
+    if (headerSize > message.size()) {
+      return false;
+    }
+    std::vector<AggregatedPart> parts(numberOfParts);
+    std::memcpy(parts.data(), message.data() + message.size() - headerSize, numberOfParts * sizeof(AggregatedPart));
+
+    std::size_t offset = 0;
+    std::vector<real> data;
+    for (const auto& part : parts) {
+      if (offset + part.size * sizeof(real) > message.size() - headerSize) {
+        return false;
+      }
+      data.resize(part.size);
+      std::memcpy(data.data(), message.data() + offset, part.size * sizeof(real));
+      handler(part.identifier, std::move(data));
+      offset += part.size * sizeof(real);
+    }
+    return offset == message.size() - headerSize;
+  }
+
+  private:
+  std::vector<char> m_buffer;
+  std::vector<AggregatedPart> m_parts;
+};
+
+#ifdef USE_MPI
+/**
+ * Aggregates the copy regions, which are sent to the same rank at the same time, into one message
+ * (SEISSOL_MPI_AGGREGATION=1).
+ *
+ * The ghost clusters hand their copy regions to the aggregator, which packs them per destination rank.
+ * At the end of each sweep over the ghost clusters (progress), one message is sent per rank, i.e. the regions
+ * of all ghost clusters which sent in the same sweep are aggregated. The receiver unpacks the messages
+ * with the header and keeps the regions until the ghost clusters posted their receives.
+ * The messages are exchanged on a duplicate of the communicator, such that they cannot interfere with other messages.
+ *
+ * All functions are thread-safe.
+ **/
+class MessageAggregator {
+  public:
+  explicit MessageAggregator(MPI_Comm comm);
+  ~MessageAggregator();
+  MessageAggregator(const MessageAggregator&) = delete;
+  MessageAggregator& operator=(const MessageAggregator&) = delete;
+
+  //! Copies the region to the message for the rank; returns a handle to test for the completion of the send.
+  std::uint64_t send(int rank, int identifier, const real* data, std::size_t size);
+
+  //! True if the message with the region of the handle was sent.
+  bool isSent(std::uint64_t handle);
+
+  //! Copies the next region with the identifier from the rank to data, if it was received already.
+  bool tryReceive(int rank, int identifier, real* data, std::size_t size);
+
+  //! Sends the pending messages, tests the sends, and receives the arrived messages.
+  void progress();
+
+  //! Number of regions and messages sent so far
+  [[nodiscard]] std::pair<std::uint64_t, std::uint64_t> statistics();
+
+  private:
+  struct PendingSend {
+    MPI_Request request;
+    std::uint64_t handle;
+    std::vector<char> buffer;
+  };
+
+  std::mutex m_mutex;
+  MPI_Comm m_comm = MPI_COMM_NULL;
+  //! Messages which are not sent yet, per rank, with their handles
+  std::map<int, std::pair<AggregatedMessage, std::uint64_t>> m_messages;
+  std::deque<PendingSend> m_sends;
+  //! Handles of the messages which are not sent yet or whose send is not complete yet
+  std::unordered_set<std::uint64_t> m_pendingHandles;
+  std::uint64_t m_nextHandle = 0;
+  //! Received regions per (rank, identifier), which were not fetched by the ghost clusters yet
+  std::map<std::pair<int, int>, std::deque<std::vector<real>>> m_received;
+  std::uint64_t m_numberOfRegions = 0;
+  std::uint64_t m_numberOfMessages = 0;
+};
+#endif
+} // namespace seissol::time_stepping
+
+#endif // SEISSOL_MESSAGEAGGREGATOR_H
@@ -42,7 +42,53 @@
 
 #include <Kernels/Time.h>
 #include <Kernels/Local.h>
+#include <Initializer/Hash.h>
 #include <Monitoring/Stopwatch.h>
+#include <Parallel/MPI.h>
+
+#include <utils/env.h>
+#include <utils/logger.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#ifdef ACL_DEVICE
+#include <device.h>
+#include <Initializer/BatchRecorders/Recorders.h>
+#endif
+
+namespace {
+std::string cpuModel() {
+  std::ifstream cpuinfo("/proc/cpuinfo");
+  std::string line;
+  while (std::getline(cpuinfo, line)) {
+    if (line.compare(0, 10, "model name") == 0) {
+      return line.substr(line.find(':') + 2);
+    }
+  }
+  return "unknown";
+}
+
+int ranksPerNode() {
+#ifdef USE_MPI
+  MPI_Comm commNode;
+  MPI_Comm_split_type(seissol::MPI::mpi.comm(), MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL, &commNode);
+  int size = 1;
+  MPI_Comm_size(commNode, &size);
+  MPI_Comm_free(&commNode);
+  return size;
+#else
+  return 1;
+#endif
+}
+} // namespace
 
 void seissol::localIntegration( struct GlobalData* globalData,
                                 initializers::LTS& lts,
@@ -139,12 +185,26 @@ void seissol::fakeData(initializers::LTS& lts,
   fillWithStuff(reinterpret_cast<real*>(localIntegration), sizeof(LocalIntegrationData)/sizeof(real) * layer.getNumberOfCells());
   fillWithStuff(reinterpret_cast<real*>(neighboringIntegration), sizeof(NeighboringIntegrationData)/sizeof(real) * layer.getNumberOfCells());
 
+#ifdef USE_SINGLE_PRECISION_FLUX_SOLVERS
+  // the bit patterns written above are no valid numbers in the reduced precision
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (unsigned cell = 0; cell < layer.getNumberOfCells(); ++cell) {
+    for (unsigned face = 0; face < 4; ++face) {
+      std::fill_n(localIntegration[cell].nApNm1[face], tensor::AplusT::size(), static_cast<FluxSolverReal>(1.0e-3));
+      std::fill_n(neighboringIntegration[cell].nAmNm1[face], tensor::AminusT::size(), static_cast<FluxSolverReal>(1.0e-3));
+    }
+  }
+#endif
+
 #ifdef USE_POROELASTIC
 #ifdef _OPENMP
   #pragma omp parallel for schedule(static)
 #endif
   for (unsigned cell = 0; cell < layer.getNumberOfCells(); ++cell) {    
     localIntegration[cell].specific.typicalTimeStepWidth = miniSeisSolTimeStep;
+    localIntegration[cell].specific.cachedTimeStepWidth = 0.0;
   }
 #endif
 }
@@ -173,13 +233,137 @@ double seissol::miniSeisSol(initializers::MemoryManager& memoryManager, bool use
   ltsTree.allocateBuckets();
   
   fakeData(lts, layer);
-  
-  localIntegration(globalData, lts, layer);
+
+#ifdef ACL_DEVICE
+  // ltsSetup = 0, i.e. every cell computes its derivatives in the scratch memory
+  layer.setScratchpadSize(lts.idofsScratch, layer.getNumberOfCells() * tensor::I::size() * sizeof(real));
+  layer.setScratchpadSize(lts.derivativesScratch,
+                          layer.getNumberOfCells() * yateto::computeFamilySize<tensor::dQ>() * sizeof(real));
+#ifdef USE_POROELASTIC
+  layer.setScratchpadSize(lts.stpRhsScratch,
+                          layer.getNumberOfCells() * tensor::spaceTimePredictorRhs::size() * sizeof(real));
+#endif
+#ifdef USE_RECOMPUTED_STAR_MATRICES
+  layer.setScratchpadSize(lts.starMatricesScratch,
+                          layer.getNumberOfCells() * yateto::computeFamilySize<tensor::star>() * sizeof(real));
+#endif
+  ltsTree.allocateScratchPads();
+
+  device::DeviceInstance& device = device::DeviceInstance::getInstance();
+  device.api->copyTo(layer.var(lts.localIntegrationOnDevice),
+                     layer.var(lts.localIntegration),
+                     layer.getNumberOfCells() * sizeof(LocalIntegrationData));
+
+  initializers::recording::CompositeRecorder<initializers::LTS> recorder;
+  recorder.addRecorder(new initializers::recording::LocalIntegrationRecorder);
+  recorder.record(lts, layer);
+
+  kernels::Time timeKernel;
+  kernels::Local localKernel;
+  timeKernel.setGlobalData(memoryManager.getGlobalData());
+  localKernel.setGlobalData(memoryManager.getGlobalData());
+  auto integrate = [&]() { localIntegrationOnDevice(timeKernel, localKernel, layer); };
+#else
+  auto integrate = [&]() { localIntegration(globalData, lts, layer); };
+#endif
+
+  integrate();
   
   Stopwatch stopwatch;
   stopwatch.start();
   for (unsigned t = 0; t < 10; ++t) {
-    localIntegration(globalData, lts, layer);
+    integrate();
   }
   return stopwatch.stop();
 }
+
+std::string seissol::miniSeisSolFingerprint(bool usePlasticity) {
+  std::ostringstream fingerprint;
+  fingerprint << "cpu=" << cpuModel();
+#ifdef _OPENMP
+  fingerprint << ";threads=" << omp_get_max_threads();
+#endif
+  fingerprint << ";ranksPerNode=" << ranksPerNode();
+#ifdef ACL_DEVICE
+  device::DeviceInstance& device = device::DeviceInstance::getInstance();
+  fingerprint << ";device=" << device.api->getDeviceInfoAsText(device.api->getDeviceId());
+#endif
+  fingerprint << ";order=" << CONVERGENCE_ORDER
+              << ";quantities=" << NUMBER_OF_QUANTITIES
+              << ";real=" << sizeof(real)
+              << ";plasticity=" << usePlasticity;
+
+  // The fingerprint is stored as one line
+  std::string result = fingerprint.str();
+  std::replace(result.begin(), result.end(), '\n', ' ');
+  return result;
+}
+
+double seissol::cachedMiniSeisSol(initializers::MemoryManager& memoryManager, bool usePlasticity) {
+  static std::string const directory = utils::Env::get("SEISSOL_NODE_WEIGHT_CACHE", "");
+  int const rank = MPI::mpi.rank();
+  if (directory.empty()) {
+    logInfo(rank) << "Running mini SeisSol to determine node weight";
+    return miniSeisSol(memoryManager, usePlasticity);
+  }
+
+  std::string const fingerprint = miniSeisSolFingerprint(usePlasticity);
+  std::ostringstream name;
+  name << directory << "/miniseissol-" << std::hex << std::setw(16) << std::setfill('0')
+       << initializers::hashBytes(fingerprint.data(), fingerprint.size()) << ".txt";
+  std::string const fileName = name.str();
+
+  double time = 0.0;
+  bool cached = false;
+  {
+    std::ifstream file(fileName);
+    std::string storedFingerprint;
+    // A hash collision must not mix up different hardware
+    if (std::getline(file, storedFingerprint) && storedFingerprint == fingerprint && (file >> time) && time > 0.0) {
+      cached = true;
+    }
+  }
+
+  int measured = cached ? 0 : 1;
+#ifdef USE_MPI
+  MPI_Allreduce(MPI_IN_PLACE, &measured, 1, MPI_INT, MPI_SUM, MPI::mpi.comm());
+#endif
+  if (measured > 0) {
+    logInfo(rank) << "Running mini SeisSol to determine node weight on" << measured << "of" << MPI::mpi.size()
+                  << "ranks";
+  } else {
+    logInfo(rank) << "Node weights read from" << directory;
+  }
+
+  if (!cached) {
+    time = miniSeisSol(memoryManager, usePlasticity);
+
+    // Write to a temporary file first, such that concurrent ranks never read a partial entry
+    std::string const temporaryFile = fileName + ".tmp" + std::to_string(rank);
+    {
+      std::ofstream file(temporaryFile, std::ios::trunc);
+      file << fingerprint << "\n" << std::setprecision(17) << time << "\n";
+      if (!file) {
+        logWarning(rank) << "Could not write the node weight cache" << fileName;
+        return time;
+      }
+    }
+    if (std::rename(temporaryFile.c_str(), fileName.c_str()) != 0) {
+      logWarning(rank) << "Could not write the node weight cache" << fileName;
+    }
+  }
+  return time;
+}
+
+#ifdef ACL_DEVICE
+void seissol::localIntegrationOnDevice(kernels::Time& timeKernel,
+                                       kernels::Local& localKernel,
+                                       initializers::Layer& layer) {
+  kernels::LocalTmp tmp;
+  ConditionalBatchTableT& table = layer.getCondBatchTable();
+
+  timeKernel.computeBatchedAder(static_cast<double>(miniSeisSolTimeStep), tmp, table);
+  localKernel.computeBatchedIntegral(table, tmp);
+  device::DeviceInstance::getInstance().api->synchDevice();
+}
+#endif
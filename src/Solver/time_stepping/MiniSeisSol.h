@@ -42,6 +42,10 @@
 #define MINISEISSOL_H_
 
 #include <Initializer/MemoryManager.h>
+#include <Kernels/Local.h>
+#include <Kernels/Time.h>
+
+#include <string>
 
 namespace seissol {
   void localIntegration(  struct GlobalData* globalData,
@@ -55,7 +59,31 @@ namespace seissol {
                   initializers::Layer& layer,
                   FaceType faceTp = FaceType::regular);
   
+#ifdef ACL_DEVICE
+  //! Batched version of localIntegration; the batches of the layer have to be recorded
+  void localIntegrationOnDevice(kernels::Time& timeKernel,
+                                kernels::Local& localKernel,
+                                initializers::Layer& layer);
+#endif
+
+  /**
+   * Measures the time of 10 local integrations of 50000 cells with fake data.
+   * On GPUs, the batched kernels are measured.
+   */
   double miniSeisSol(initializers::MemoryManager& memoryManager, bool usePlasticity);
+
+  /**
+   * Identifies the hardware of this rank (CPU model, threads, ranks per node, device)
+   * and the build configuration, i.e. everything the time of mini SeisSol depends on.
+   */
+  std::string miniSeisSolFingerprint(bool usePlasticity);
+
+  /**
+   * Same as miniSeisSol, but with SEISSOL_NODE_WEIGHT_CACHE set to a directory, the measured time is
+   * stored per fingerprint and reused by later runs on the same hardware. Collective.
+   */
+  double cachedMiniSeisSol(initializers::MemoryManager& memoryManager, bool usePlasticity);
+
   const real miniSeisSolTimeStep = 1.0;
 }
 
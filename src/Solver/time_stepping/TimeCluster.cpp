@@ -80,11 +80,33 @@
 #include <Solver/Interoperability.h>
 #include <SourceTerm/PointSource.h>
 #include <Kernels/TimeCommon.h>
+#include <Kernels/denseMatrixOps.hpp>
 #include <Kernels/DynamicRupture.h>
+#include <Kernels/WaveFieldSampler.h>
+#include <ResultWriter/EnergyOutput.h>
+#include <ResultWriter/MomentRateOutput.h>
+#include <Initializer/ThreadLocalArena.h>
 #include <Monitoring/FlopCounter.hpp>
+#include <Monitoring/Stopwatch.h>
+#include "utils/env.h"
+#ifdef ACL_DEVICE
+#include <Kernels/DeviceAux/GraphAux.h>
+#include <Kernels/DeviceAux/PeerAux.h>
+#include <Kernels/DeviceAux/StreamAux.h>
+#include <Kernels/DeviceReceivers.h>
+#endif
 
+#include <algorithm>
 #include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <cstring>
+#include <functional>
+#include <mutex>
+#include <numeric>
+#include <thread>
+#include <unordered_map>
 
 //! fortran interoperability
 extern seissol::Interoperability e_interoperability;
@@ -100,6 +122,7 @@ seissol::time_stepping::TimeCluster::TimeCluster(unsigned int i_clusterId, unsig
                                                  seissol::initializers::Layer *dynRupCopyData,
                                                  seissol::initializers::LTS *i_lts,
                                                  seissol::initializers::DynamicRupture *i_dynRup,
+                                                 seissol::dr::friction_law::FrictionSolver* i_frictionSolver,
                                                  LoopStatistics *i_loopStatistics,
                                                  ActorStateStatistics* actorStateStatistics) :
     AbstractTimeCluster(maxTimeStepSize, timeStepRate),
@@ -113,6 +136,7 @@ seissol::time_stepping::TimeCluster::TimeCluster(unsigned int i_clusterId, unsig
     dynRupCopyData(dynRupCopyData),
     m_lts(i_lts),
     m_dynRup(i_dynRup),
+    m_frictionSolver(i_frictionSolver),
     m_cellToPointSources(nullptr),
     m_numberOfCellToPointSourcesMappings(0),
     m_pointSources(nullptr),
@@ -144,17 +168,169 @@ seissol::time_stepping::TimeCluster::TimeCluster(unsigned int i_clusterId, unsig
 
   computeFlops();
 
+  // temporaries of the cell and face loops; with ACL_DEVICE, the cluster may run on the host as well
+  using Arena = memory::ThreadLocalArena;
+  // the local integration takes the integration buffer and, with compensated dofs, a copy of the dofs
+  Arena::reserve(Arena::bytesFor<real>(tensor::I::size()) + Arena::bytesFor<real>(tensor::Q::size()));
+#ifndef ACL_DEVICE
+  Arena::reserve(2 * Arena::bytesFor<real[tensor::QInterpolated::size()]>(CONVERGENCE_ORDER));
+#else
+  m_deviceContext = std::make_unique<kernels::DeviceContext>(kernels::DeviceContext::clusterStreamsEnabled(),
+                                                             streamPriority());
+  if (m_deviceContext->hasOwnStream()) {
+    predictionEvent = kernels::device::aux::stream::createEvent();
+    correctionEvent = kernels::device::aux::stream::createEvent();
+  }
+  if (memory::isDeviceMemoryOversubscribed()) {
+    // the cell matrices are only written at the setup
+    const std::size_t numberOfCells = m_clusterData->getNumberOfCells();
+    kernels::device::aux::peer::adviseReadMostly(m_clusterData->var(m_lts->localIntegrationOnDevice),
+                                                 numberOfCells * sizeof(LocalIntegrationData));
+    kernels::device::aux::peer::adviseReadMostly(m_clusterData->var(m_lts->neighIntegrationOnDevice),
+                                                 numberOfCells * sizeof(NeighboringIntegrationData));
+  }
+#endif
+
   m_regionComputeLocalIntegration = m_loopStatistics->getRegion("computeLocalIntegration");
   m_regionComputeNeighboringIntegration = m_loopStatistics->getRegion("computeNeighboringIntegration");
   m_regionComputeDynamicRupture = m_loopStatistics->getRegion("computeDynamicRupture");
+  m_counterDynamicRuptureActiveFaces = m_loopStatistics->getCounter("dynamicRuptureActiveFaces");
+  m_counterActiveCells = m_loopStatistics->getCounter("activeCells");
 };
 
 seissol::time_stepping::TimeCluster::~TimeCluster() {
 #ifndef NDEBUG
   logInfo() << "#(time steps):" << numberOfTimeSteps;
 #endif
+#ifdef ACL_DEVICE
+  for (auto& graph : m_localIntegrationGraphs) {
+    kernels::device::aux::graph::destroyGraph(graph.instance);
+  }
+  if (m_deviceContext->hasOwnStream()) {
+    synchronizeDeviceStream();
+    kernels::device::aux::stream::destroyEvent(predictionEvent);
+    kernels::device::aux::stream::destroyEvent(correctionEvent);
+  }
+#endif
 }
 
+#ifdef ACL_DEVICE
+void seissol::time_stepping::TimeCluster::waitForNeighborEvents(bool predictions) {
+  if (!m_deviceContext->hasOwnStream()) {
+    return;
+  }
+  kernels::DeviceContext::Scope deviceScope(*m_deviceContext);
+  for (auto& neighbor : neighbors) {
+    void* event = predictions ? neighbor.predictionEvent : neighbor.correctionEvent;
+    if (event == nullptr) {
+      continue;
+    }
+    if (m_executeOnHost) {
+      // the host reads the buffers and derivatives of the neighbors (or overwrites the ones they read)
+      kernels::device::aux::stream::synchronizeEvent(event);
+    } else {
+      kernels::device::aux::stream::waitEvent(m_deviceContext->stream(), event);
+    }
+  }
+}
+
+seissol::kernels::DeviceContext::StreamPriority seissol::time_stepping::TimeCluster::streamPriority() const {
+  // the ghost clusters of the neighboring ranks wait for the copy layer
+  return layerType == Copy ? kernels::DeviceContext::StreamPriority::High
+                           : kernels::DeviceContext::StreamPriority::Normal;
+}
+
+void seissol::time_stepping::TimeCluster::synchronizeDeviceStream() {
+  if (m_deviceContext->hasOwnStream()) {
+    kernels::device::aux::stream::synchronizeStream(m_deviceContext->stream());
+  }
+}
+
+void seissol::time_stepping::TimeCluster::recordDeviceEvent(void* event) {
+  if (m_deviceContext->hasOwnStream()) {
+    // the event and the stream belong to the device of the cluster
+    kernels::DeviceContext::Scope deviceScope(*m_deviceContext);
+    kernels::device::aux::stream::recordEvent(event, m_deviceContext->stream());
+  }
+}
+#endif
+
+void seissol::time_stepping::TimeCluster::setExecuteOnHost(bool executeOnHost) {
+  assert(!executeOnHost || mayExecuteOnHost());
+  m_executeOnHost = !seissol::isDeviceOn() || executeOnHost;
+}
+
+bool seissol::time_stepping::TimeCluster::mayExecuteOnHost() const {
+  // the friction laws of the device builds run on the device
+  return !seissol::isDeviceOn() || !hasDynamicRuptureFaces();
+}
+
+bool seissol::time_stepping::TimeCluster::hasDynamicRuptureFaces() const {
+  return dynamicRuptureScheduler->hasDynamicRuptureFaces();
+}
+
+#ifdef ACL_DEVICE
+void seissol::time_stepping::TimeCluster::setDevice(int deviceId, CompoundGlobalData globalData) {
+  // the dynamic rupture runs in the default stream of the primary device
+  assert(m_deviceContext->hasOwnStream() && !hasDynamicRuptureFaces());
+
+  synchronizeDeviceStream();
+  for (auto& graph : m_localIntegrationGraphs) {
+    kernels::device::aux::graph::destroyGraph(graph.instance);
+  }
+  m_localIntegrationGraphs.clear();
+  kernels::device::aux::stream::destroyEvent(predictionEvent);
+  kernels::device::aux::stream::destroyEvent(correctionEvent);
+
+  // the events are recorded to the stream of the cluster, hence they belong to the same device
+  m_deviceContext = std::make_unique<kernels::DeviceContext>(true, deviceId, streamPriority());
+  kernels::DeviceContext::Scope deviceScope(*m_deviceContext);
+  predictionEvent = kernels::device::aux::stream::createEvent();
+  correctionEvent = kernels::device::aux::stream::createEvent();
+
+  m_globalDataOnDevice = globalData.onDevice;
+  m_timeKernel.setGlobalData(globalData);
+  m_localKernel.setGlobalData(globalData);
+  m_neighborKernel.setGlobalData(globalData);
+
+  prefetchCellData(deviceId, true);
+  prefetchCellData(deviceId, false);
+  synchronizeDeviceStream();
+}
+
+void seissol::time_stepping::TimeCluster::prefetchCellData(int deviceId, bool prediction) {
+  auto prefetch = [&](const void* memory, std::size_t bytes) {
+    kernels::device::aux::peer::prefetch(memory, bytes, deviceId, m_deviceContext->stream());
+  };
+  const std::size_t numberOfCells = m_clusterData->getNumberOfCells();
+  prefetch(m_clusterData->var(m_lts->dofs), numberOfCells * sizeof(real[tensor::Q::size()]));
+  if (prediction) {
+    if (m_clusterData->getBucketSize(m_lts->buffersDerivatives) > 0) {
+      prefetch(m_clusterData->bucket(m_lts->buffersDerivatives), m_clusterData->getBucketSize(m_lts->buffersDerivatives));
+    }
+    prefetch(m_clusterData->var(m_lts->localIntegrationOnDevice), numberOfCells * sizeof(LocalIntegrationData));
+    prefetch(m_clusterData->getScratchpadMemory(m_lts->derivativesScratch),
+             m_clusterData->getScratchpadSize(m_lts->derivativesScratch));
+  } else {
+    prefetch(m_clusterData->var(m_lts->neighIntegrationOnDevice), numberOfCells * sizeof(NeighboringIntegrationData));
+    prefetch(m_clusterData->getScratchpadMemory(m_lts->idofsScratch), m_clusterData->getScratchpadSize(m_lts->idofsScratch));
+    if (usePlasticity) {
+      prefetch(m_clusterData->var(m_lts->plasticity), numberOfCells * sizeof(PlasticityData));
+      prefetch(m_clusterData->var(m_lts->pstrain), numberOfCells * sizeof(real[7 * NUMBER_OF_ALIGNED_BASIS_FUNCTIONS]));
+    }
+  }
+}
+
+void seissol::time_stepping::TimeCluster::prefetchCellDataIfOversubscribed(bool prediction) {
+  if (!memory::isDeviceMemoryOversubscribed() || m_executeOnHost) {
+    return;
+  }
+  kernels::DeviceContext::Scope deviceScope(*m_deviceContext);
+  const int deviceId = m_deviceContext->deviceId() >= 0 ? m_deviceContext->deviceId() : seissol::MPI::mpi.getDeviceID();
+  prefetchCellData(deviceId, prediction);
+}
+#endif
+
 void seissol::time_stepping::TimeCluster::setPointSources( sourceterm::CellToPointSourcesMapping const* i_cellToPointSources,
                                                            unsigned i_numberOfCellToPointSourcesMappings,
                                                            sourceterm::PointSources const* i_pointSources )
@@ -162,55 +338,103 @@ void seissol::time_stepping::TimeCluster::setPointSources( sourceterm::CellToPoi
   m_cellToPointSources = i_cellToPointSources;
   m_numberOfCellToPointSourcesMappings = i_numberOfCellToPointSourcesMappings;
   m_pointSources = i_pointSources;
+  m_sourceIntegrals.assign((i_pointSources != nullptr) ? 3 * i_pointSources->numberOfSources : 0, 0.0);
+#ifdef ACL_DEVICE
+  m_devicePointSources.reset();
+  if (i_numberOfCellToPointSourcesMappings != 0 && sourceterm::DevicePointSources::isSupported()) {
+    m_devicePointSources = std::make_unique<sourceterm::DevicePointSources>(
+        i_cellToPointSources, i_numberOfCellToPointSourcesMappings, *i_pointSources);
+  }
+#endif
 }
 
 void seissol::time_stepping::TimeCluster::writeReceivers() {
   SCOREP_USER_REGION("writeReceivers", SCOREP_USER_REGION_TYPE_FUNCTION)
 
   if (m_receiverCluster != nullptr) {
+#ifdef ACL_DEVICE
+    // the receivers are sampled in the stream of the cluster
+    kernels::DeviceContext::Scope deviceScope(*m_deviceContext);
+#endif
     m_receiverTime = m_receiverCluster->calcReceivers(m_receiverTime, ct.correctionTime, timeStepSize());
   }
 
 }
 
-void seissol::time_stepping::TimeCluster::computeSources() {
+void seissol::time_stepping::TimeCluster::addWaveFieldSampler( kernels::WaveFieldSampler* sampler ) {
+  m_waveFieldSamplers.emplace_back(sampler, sampler->addCluster());
+}
+
+void seissol::time_stepping::TimeCluster::sampleWaveField() {
+  SCOREP_USER_REGION("sampleWaveField", SCOREP_USER_REGION_TYPE_FUNCTION)
+
+  for (auto& [sampler, id] : m_waveFieldSamplers) {
+    sampler->sample(id, *m_lts, *m_clusterData, ct.correctionTime, timeStepSize());
+  }
+}
+
+void seissol::time_stepping::TimeCluster::computeSources(double fromTime, double toTime) {
 #ifdef ACL_DEVICE
   device.api->putProfilingMark("computeSources", device::ProfilingColors::Blue);
 #endif
   SCOREP_USER_REGION( "computeSources", SCOREP_USER_REGION_TYPE_FUNCTION )
 
+#ifdef ACL_DEVICE
+  if (m_devicePointSources != nullptr && !m_executeOnHost) {
+    // Runs after the local integration in the stream of the cluster
+    m_devicePointSources->add(fromTime, toTime, m_deviceContext->stream());
+    device.api->popLastProfilingMark();
+    return;
+  }
+#endif
+
   // Return when point sources not initialised. This might happen if there
   // are no point sources on this rank.
   if (m_numberOfCellToPointSourcesMappings != 0) {
-#ifdef _OPENMP
-  #pragma omp parallel for schedule(static)
+#ifdef ACL_DEVICE
+    synchronizeDeviceStream();
 #endif
-    for (unsigned mapping = 0; mapping < m_numberOfCellToPointSourcesMappings; ++mapping) {
+    // Time integration of all sources, balanced by the number of sources (a cell may hold many sources)
+    real* integrals = m_sourceIntegrals.data();
+    if (m_pointSources->mode == sourceterm::PointSources::NRF) {
+      parallel::forEachCell(m_pointSources->numberOfSources, [&](unsigned source) {
+        sourceterm::computeRotatedSlipNRF(m_pointSources->tensor[source],
+                                          m_pointSources->slipRates[source],
+                                          fromTime,
+                                          toTime,
+                                          &integrals[3 * source]);
+      });
+    } else {
+      parallel::forEachCell(m_pointSources->numberOfSources, [&](unsigned source) {
+        integrals[3 * source] = sourceterm::computePwLFTimeIntegral(m_pointSources->slipRates[source][0],
+                                                                    fromTime,
+                                                                    toTime);
+      });
+    }
+
+    // Scatter to the dofs; the sources of one cell are added by one thread
+    parallel::forEachCell(m_numberOfCellToPointSourcesMappings, [&](unsigned mapping) {
       unsigned startSource = m_cellToPointSources[mapping].pointSourcesOffset;
       unsigned endSource =
           m_cellToPointSources[mapping].pointSourcesOffset + m_cellToPointSources[mapping].numberOfPointSources;
       if (m_pointSources->mode == sourceterm::PointSources::NRF) {
         for (unsigned source = startSource; source < endSource; ++source) {
-          sourceterm::addTimeIntegratedPointSourceNRF(m_pointSources->mInvJInvPhisAtSources[source],
-                                                      m_pointSources->tensor[source],
-                                                      m_pointSources->A[source],
-                                                      m_pointSources->stiffnessTensor[source],
-                                                      m_pointSources->slipRates[source],
-                                                      ct.correctionTime,
-                                                      ct.correctionTime + timeStepSize(),
-                                                      *m_cellToPointSources[mapping].dofs);
+          sourceterm::addPointSourceNRF(m_pointSources->mInvJInvPhisAtSources[source],
+                                        m_pointSources->tensor[source],
+                                        m_pointSources->A[source],
+                                        m_pointSources->stiffnessTensor[source],
+                                        &integrals[3 * source],
+                                        *m_cellToPointSources[mapping].dofs);
         }
       } else {
         for (unsigned source = startSource; source < endSource; ++source) {
-          sourceterm::addTimeIntegratedPointSourceFSRM(m_pointSources->mInvJInvPhisAtSources[source],
-                                                       m_pointSources->tensor[source],
-                                                       m_pointSources->slipRates[source][0],
-                                                       ct.correctionTime,
-                                                       ct.correctionTime + timeStepSize(),
-                                                       *m_cellToPointSources[mapping].dofs);
+          sourceterm::addPointSourceFSRM(m_pointSources->mInvJInvPhisAtSources[source],
+                                         m_pointSources->tensor[source],
+                                         integrals[3 * source],
+                                         *m_cellToPointSources[mapping].dofs);
         }
       }
-    }
+    });
   }
 #ifdef ACL_DEVICE
   device.api->popLastProfilingMark();
@@ -233,15 +457,27 @@ void seissol::time_stepping::TimeCluster::computeDynamicRupture( seissol::initia
   seissol::model::IsotropicWaveSpeeds*  waveSpeedsPlus                                                    = layerData.var(m_dynRup->waveSpeedsPlus);
   seissol::model::IsotropicWaveSpeeds*  waveSpeedsMinus                                                   = layerData.var(m_dynRup->waveSpeedsMinus);
 
-  alignas(ALIGNMENT) real QInterpolatedPlus[CONVERGENCE_ORDER][tensor::QInterpolated::size()];
-  alignas(ALIGNMENT) real QInterpolatedMinus[CONVERGENCE_ORDER][tensor::QInterpolated::size()];
+  // The derivative pointers of the faces are fixed after the setup, hence the order is computed once
+  std::vector<unsigned> const* faceOrder = nullptr;
+  if (useDynamicRuptureFaceOrdering()) {
+    std::vector<unsigned>& order = m_dynamicRuptureFaceOrders[&layerData];
+    if (order.size() != layerData.getNumberOfCells()) {
+      order = computeDynamicRuptureFaceOrder(layerData, timeDerivativePlus);
+    }
+    faceOrder = &order;
+  }
+  auto faceAt = [&](unsigned index) {
+    return faceOrder == nullptr ? index : (*faceOrder)[index];
+  };
 
   m_dynamicRuptureKernel.setTimeStepWidth(timeStepSize());
-#ifdef _OPENMP
-  #pragma omp parallel for schedule(static) private(QInterpolatedPlus,QInterpolatedMinus)
-#endif
-  for (unsigned face = 0; face < layerData.getNumberOfCells(); ++face) {
-    unsigned prefetchFace = (face < layerData.getNumberOfCells()-1) ? face+1 : face;
+  const unsigned activeFaces = parallel::sumOverCells(layerData.getNumberOfCells(), [&](unsigned index) {
+    memory::ThreadLocalArena::Scope scratch;
+    auto* QInterpolatedPlus = scratch.allocate<real[tensor::QInterpolated::size()]>(CONVERGENCE_ORDER);
+    auto* QInterpolatedMinus = scratch.allocate<real[tensor::QInterpolated::size()]>(CONVERGENCE_ORDER);
+
+    const unsigned face = faceAt(index);
+    unsigned prefetchFace = (index < layerData.getNumberOfCells()-1) ? faceAt(index+1) : face;
     m_dynamicRuptureKernel.spaceTimeInterpolation(  faceInformation[face],
                                                     m_globalDataOnHost,
                                                    &godunovData[face],
@@ -253,18 +489,34 @@ void seissol::time_stepping::TimeCluster::computeDynamicRupture( seissol::initia
                                                     timeDerivativePlus[prefetchFace],
                                                     timeDerivativeMinus[prefetchFace] );
 
-    e_interoperability.evaluateFrictionLaw( static_cast<int>(faceInformation[face].meshFace),
-                                            QInterpolatedPlus,
-                                            QInterpolatedMinus,
-                                            imposedStatePlus[face],
-                                            imposedStateMinus[face],
-                                            ct.correctionTime,
-                                            m_dynamicRuptureKernel.timePoints,
-                                            m_dynamicRuptureKernel.timeWeights,
-                                            waveSpeedsPlus[face],
-                                            waveSpeedsMinus[face] );
-  }
+    if (m_frictionSolver != nullptr) {
+      return m_frictionSolver->evaluate( layerData,
+                                         m_dynRup,
+                                         face,
+                                         QInterpolatedPlus,
+                                         QInterpolatedMinus,
+                                         ct.correctionTime,
+                                         m_dynamicRuptureKernel.timePoints,
+                                         m_dynamicRuptureKernel.timeWeights ) ? 1u : 0u;
+    } else {
+      e_interoperability.evaluateFrictionLaw( static_cast<int>(faceInformation[face].meshFace),
+                                              QInterpolatedPlus,
+                                              QInterpolatedMinus,
+                                              imposedStatePlus[face],
+                                              imposedStateMinus[face],
+                                              ct.correctionTime,
+                                              m_dynamicRuptureKernel.timePoints,
+                                              m_dynamicRuptureKernel.timeWeights,
+                                              waveSpeedsPlus[face],
+                                              waveSpeedsMinus[face] );
+      return 0u;
+    }
+  });
 
+  // The Fortran friction laws do not report whether a face slipped
+  if (m_frictionSolver != nullptr) {
+    m_loopStatistics->count(m_counterDynamicRuptureActiveFaces, activeFaces, layerData.getNumberOfCells());
+  }
   m_loopStatistics->end(m_regionComputeDynamicRupture, layerData.getNumberOfCells(), m_globalClusterId);
 }
 #else
@@ -281,6 +533,22 @@ void seissol::time_stepping::TimeCluster::computeDynamicRupture( seissol::initia
     m_dynamicRuptureKernel.batchedSpaceTimeInterpolation(table);
 
     // compute friction part
+    if (m_frictionSolver != nullptr) {
+      // the friction state stays on the device, no host staging required
+      m_frictionSolver->evaluateOnDevice(layerData,
+                                         m_dynRup,
+                                         static_cast<real*>(layerData.getScratchpadMemory(m_dynRup->QInterpolatedPlusOnDevice)),
+                                         static_cast<real*>(layerData.getScratchpadMemory(m_dynRup->QInterpolatedMinusOnDevice)),
+                                         ct.correctionTime,
+                                         m_dynamicRuptureKernel.timePoints,
+                                         m_dynamicRuptureKernel.timeWeights,
+                                         m_globalDataOnDevice->resampleMatrix,
+                                         device.api->getDefaultStream());
+      m_loopStatistics->end(m_regionComputeDynamicRupture, layerData.getNumberOfCells(), m_globalClusterId);
+      device.api->popLastProfilingMark();
+      return;
+    }
+
     using namespace dr::pipeline;
     DrContext context;
     context.QInterpolatedPlusOnDevice = static_cast<real *>(layerData.getScratchpadMemory(m_dynRup->QInterpolatedPlusOnDevice));
@@ -392,6 +660,9 @@ void seissol::time_stepping::TimeCluster::computeDynamicRupture( seissol::initia
       void *copyBackStream{nullptr};
     } asyncCopyBack(context, this);
 
+    // the interior and the copy faces are tuned separately, see DynamicRuptureScheduler
+    auto& drPipeline = (&layerData == dynRupCopyData) ? dynamicRuptureScheduler->copyPipeline
+                                                      : dynamicRuptureScheduler->interiorPipeline;
     drPipeline.registerCallBack(0, &asyncCopyFrom);
     drPipeline.registerCallBack(1, &computeFriction);
     drPipeline.registerCallBack(2, &asyncCopyBack);
@@ -424,111 +695,367 @@ void seissol::time_stepping::TimeCluster::computeDynamicRuptureFlops( seissol::i
   }
 }
 
-#ifndef ACL_DEVICE
-void seissol::time_stepping::TimeCluster::computeLocalIntegration(seissol::initializers::Layer& i_layerData, bool resetBuffers ) {
+void seissol::time_stepping::TimeCluster::computeLocalIntegrationOnHost(seissol::initializers::Layer& i_layerData, bool resetBuffers ) {
   SCOREP_USER_REGION( "computeLocalIntegration", SCOREP_USER_REGION_TYPE_FUNCTION )
 
   m_loopStatistics->begin(m_regionComputeLocalIntegration);
 
+  kernels::LocalData::Loader loader;
+  loader.load(*m_lts, i_layerData);
+
+  const double correctionTime = ct.correctionTime;
+  const double dt = timeStepSize();
+  parallel::forEachCell(i_layerData.getNumberOfCells(), [&](unsigned l_cell) {
+    computeLocalIntegrationOfCell(i_layerData, loader, l_cell, resetBuffers, correctionTime, dt);
+  });
+
+  if (!m_activeCells.empty()) {
+    m_loopStatistics->count(m_counterActiveCells, m_numberOfActiveCells, i_layerData.getNumberOfCells());
+  }
+  m_loopStatistics->end(m_regionComputeLocalIntegration, i_layerData.getNumberOfCells(), m_globalClusterId);
+}
+
+void seissol::time_stepping::TimeCluster::computeLocalIntegrationOfCell(seissol::initializers::Layer& layerData,
+                                                                        kernels::LocalData::Loader& loader,
+                                                                        unsigned cell,
+                                                                        bool resetBuffers,
+                                                                        double correctionTime,
+                                                                        double timeStepSize) {
+  // The time integrated degrees of freedom of an inactive cell are zero
+  if (!isCellActive(cell)) {
+    return;
+  }
+
+  real** buffers = layerData.var(m_lts->buffers);
+  real** derivatives = layerData.var(m_lts->derivatives);
+  CellMaterialData* materialData = layerData.var(m_lts->material);
+  CellBoundaryMapping (*boundaryMapping)[4] = layerData.var(m_lts->boundaryMapping);
+
   // local integration buffer
-  real l_integrationBuffer[tensor::I::size()] __attribute__((aligned(ALIGNMENT)));
+  memory::ThreadLocalArena::Scope scratch;
+  real* l_integrationBuffer = scratch.allocate<real>(tensor::I::size());
 
   // pointer for the call of the ADER-function
   real* l_bufferPointer;
 
-  real** buffers = i_layerData.var(m_lts->buffers);
-  real** derivatives = i_layerData.var(m_lts->derivatives);
-  CellMaterialData* materialData = i_layerData.var(m_lts->material);
+  kernels::LocalTmp tmp;
 
-  kernels::LocalData::Loader loader;
-  loader.load(*m_lts, i_layerData);
-  kernels::LocalTmp tmp{};
+  auto data = loader.entry(cell);
 
-#ifdef _OPENMP
-  #pragma omp parallel for private(l_bufferPointer, l_integrationBuffer, tmp) schedule(static)
-#endif
-  for (unsigned int l_cell = 0; l_cell < i_layerData.getNumberOfCells(); l_cell++) {
-    auto data = loader.entry(l_cell);
+  // We need to check, whether we can overwrite the buffer or if it is
+  // needed by some other time cluster.
+  // If we cannot overwrite the buffer, we compute everything in a temporary
+  // local buffer and accumulate the results later in the shared buffer.
+  const bool buffersProvided = (data.cellInformation.ltsSetup >> 8) % 2 == 1; // buffers are provided
+  const bool resetMyBuffers = buffersProvided && ( (data.cellInformation.ltsSetup >> 10) %2 == 0 || resetBuffers ); // they should be reset
 
-    // We need to check, whether we can overwrite the buffer or if it is
-    // needed by some other time cluster.
-    // If we cannot overwrite the buffer, we compute everything in a temporary
-    // local buffer and accumulate the results later in the shared buffer.
-    const bool buffersProvided = (data.cellInformation.ltsSetup >> 8) % 2 == 1; // buffers are provided
-    const bool resetMyBuffers = buffersProvided && ( (data.cellInformation.ltsSetup >> 10) %2 == 0 || resetBuffers ); // they should be reset
+  // The buffer is only read again in the neighboring integrations: compute it in the (cache resident) local buffer
+  // and stream it out at the end, which avoids the read-for-ownership of the stores.
+  const bool streamMyBuffers = resetMyBuffers && useStreamingStores();
 
-    if (resetMyBuffers) {
-      // assert presence of the buffer
-      assert(buffers[l_cell] != nullptr);
+  if (resetMyBuffers && !streamMyBuffers) {
+    // assert presence of the buffer
+    assert(buffers[cell] != nullptr);
 
-      l_bufferPointer = buffers[l_cell];
-    } else {
-      // work on local buffer
-      l_bufferPointer = l_integrationBuffer;
-    }
-
-    m_timeKernel.computeAder(timeStepSize(),
-                             data,
-                             tmp,
-                             l_bufferPointer,
-                             derivatives[l_cell],
-                             ct.correctionTime,
-                             true);
-
-    // Compute local integrals (including some boundary conditions)
-    CellBoundaryMapping (*boundaryMapping)[4] = i_layerData.var(m_lts->boundaryMapping);
-    m_localKernel.computeIntegral(l_bufferPointer,
-                                  data,
-                                  tmp,
-                                  &materialData[l_cell],
-                                  &boundaryMapping[l_cell],
-                                  ct.correctionTime,
-                                  timeStepSize()
-    );
+    l_bufferPointer = buffers[cell];
+  } else {
+    // work on local buffer
+    l_bufferPointer = l_integrationBuffer;
+  }
+
+  m_timeKernel.computeAder(timeStepSize,
+                           data,
+                           tmp,
+                           l_bufferPointer,
+                           derivatives[cell],
+                           correctionTime,
+                           true);
+
+  // With compensated summation, the kernels accumulate the update from zero, which is then added to the dofs
+  real (*dofsCompensation)[tensor::Q::size()] = layerData.var(m_lts->dofsCompensation);
+  real* dofsBefore = nullptr;
+  if (dofsCompensation != nullptr) {
+    dofsBefore = scratch.allocate<real>(tensor::Q::size());
+    std::copy_n(data.dofs, tensor::Q::size(), dofsBefore);
+    std::fill_n(data.dofs, tensor::Q::size(), 0);
+  }
+
+  // Compute local integrals (including some boundary conditions)
+  m_localKernel.computeIntegral(l_bufferPointer,
+                                data,
+                                tmp,
+                                &materialData[cell],
+                                &boundaryMapping[cell],
+                                correctionTime,
+                                timeStepSize
+  );
+
+  if (dofsCompensation != nullptr) {
+    kernels::compensatedAdd(tensor::Q::size(), data.dofs, dofsBefore, dofsCompensation[cell]);
+    std::copy_n(dofsBefore, tensor::Q::size(), data.dofs);
+  }
+
+#ifdef INTEGRATE_QUANTITIES
+  // The time integrated degrees of freedom are the exact integral over the time step
+  seissol::SeisSol::main.postProcessor().integrateQuantities(layerData, cell, l_bufferPointer);
+#endif // INTEGRATE_QUANTITIES
+
+  for (unsigned face = 0; face < 4; ++face) {
+    auto& curFaceDisplacements = data.faceDisplacements[face];
+    // Note: Displacement for freeSurfaceGravity is computed in Time.cpp
+    if (curFaceDisplacements != nullptr
+        && data.cellInformation.faceTypes[face] != FaceType::freeSurfaceGravity) {
+      kernel::addVelocity addVelocityKrnl;
+
+      addVelocityKrnl.V3mTo2nFace = m_globalDataOnHost->V3mTo2nFace;
+      addVelocityKrnl.selectVelocity = init::selectVelocity::Values;
+      addVelocityKrnl.faceDisplacement = data.faceDisplacements[face];
+      addVelocityKrnl.I = l_bufferPointer;
+      addVelocityKrnl.execute(face);
+    }
+  }
+
+  if (streamMyBuffers) {
+    assert(buffers[cell] != nullptr);
+    kernels::streamstore(tensor::I::size(), l_integrationBuffer, buffers[cell]);
+  }
 
+  // TODO: Integrate this step into the kernel
+  // We've used a temporary buffer -> need to accumulate update in
+  // shared buffer.
+  if (!resetMyBuffers && buffersProvided) {
+    assert(buffers[cell] != nullptr);
+
+    for (unsigned int l_dof = 0; l_dof < tensor::I::size(); ++l_dof) {
+      buffers[cell][l_dof] += l_integrationBuffer[l_dof];
+    }
+  }
+}
+
+bool seissol::time_stepping::TimeCluster::useStreamingStores() {
+  static const bool streaming = utils::Env::get<int>("SEISSOL_STREAMING_STORES", kernels::hasNonTemporalStores ? 1 : 0) != 0;
+  return streaming;
+}
+
+bool seissol::time_stepping::TimeCluster::useNeighborBinning() {
+  static const bool binning = utils::Env::get<int>("SEISSOL_NEIGHBOR_BINNING", 0) != 0;
+  return binning;
+}
+
+#ifndef ACL_DEVICE
+bool seissol::time_stepping::TimeCluster::useDynamicRuptureFaceOrdering() {
+  static const bool ordering = utils::Env::get<int>("SEISSOL_DR_FACE_ORDERING", 0) != 0;
+  return ordering;
+}
+
+std::vector<unsigned> seissol::time_stepping::TimeCluster::computeDynamicRuptureFaceOrder(seissol::initializers::Layer& layerData,
+                                                                                          real** timeDerivativePlus) {
+  std::vector<unsigned> order(layerData.getNumberOfCells());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&](unsigned a, unsigned b) {
+    return std::less<real const*>()(timeDerivativePlus[a], timeDerivativePlus[b]);
+  });
+  return order;
+}
+#endif // ACL_DEVICE
+
+std::vector<unsigned> seissol::time_stepping::TimeCluster::computeNeighborCellOrder(seissol::initializers::Layer& layerData) const {
+  CellLocalInformation const* cellInformation = layerData.var(m_lts->cellInformation);
+  const unsigned numberOfCells = layerData.getNumberOfCells();
+
+  // One byte per face: the face type and, for faces with a neighboring flux, the id of the flux matrix
+  std::vector<std::uint32_t> signatures(numberOfCells);
+  for (unsigned cell = 0; cell < numberOfCells; ++cell) {
+    std::uint32_t signature = 0;
     for (unsigned face = 0; face < 4; ++face) {
-      auto& curFaceDisplacements = data.faceDisplacements[face];
-      // Note: Displacement for freeSurfaceGravity is computed in Time.cpp
-      if (curFaceDisplacements != nullptr
-          && data.cellInformation.faceTypes[face] != FaceType::freeSurfaceGravity) {
-        kernel::addVelocity addVelocityKrnl;
-
-        addVelocityKrnl.V3mTo2nFace = m_globalDataOnHost->V3mTo2nFace;
-        addVelocityKrnl.selectVelocity = init::selectVelocity::Values;
-        addVelocityKrnl.faceDisplacement = data.faceDisplacements[face];
-        addVelocityKrnl.I = l_bufferPointer;
-        addVelocityKrnl.execute(face);
+      const FaceType faceType = cellInformation[cell].faceTypes[face];
+      std::uint32_t faceSignature = static_cast<std::uint32_t>(faceType) << 4;
+      if (faceType == FaceType::regular || faceType == FaceType::periodic) {
+        faceSignature |= cellInformation[cell].faceRelations[face][1] + 3 * cellInformation[cell].faceRelations[face][0];
       }
+      signature = (signature << 8) | faceSignature;
     }
+    signatures[cell] = signature;
+  }
+
+  std::vector<unsigned> order(numberOfCells);
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&](unsigned a, unsigned b) {
+    return signatures[a] < signatures[b];
+  });
+  return order;
+}
 
-    // TODO: Integrate this step into the kernel
-    // We've used a temporary buffer -> need to accumulate update in
-    // shared buffer.
-    if (!resetMyBuffers && buffersProvided) {
-      assert(buffers[l_cell] != nullptr);
+bool seissol::time_stepping::TimeCluster::useFusedUpdates() {
+  static const bool fused = utils::Env::get<int>("SEISSOL_FUSED_UPDATES", 0) != 0;
+  return fused;
+}
+
+bool seissol::time_stepping::TimeCluster::useCommunicationSkeleton() {
+  static const bool skeleton = utils::Env::get<int>("SEISSOL_COMMUNICATION_SKELETON", 0) != 0;
+  return skeleton;
+}
+
+void seissol::time_stepping::TimeCluster::emulateComputation() {
+  static const double cellTime = utils::Env::get<double>("SEISSOL_COMMUNICATION_SKELETON_CELL_TIME", 0.0);
+  if (cellTime > 0.0) {
+    std::this_thread::sleep_for(std::chrono::duration<double>(cellTime * m_clusterData->getNumberOfCells()));
+  }
+}
+
+seissol::time_stepping::TimeCluster::FusedSchedule
+    seissol::time_stepping::TimeCluster::computeFusedSchedule(seissol::initializers::Layer& layerData) const {
+  real** buffers = layerData.var(m_lts->buffers);
+  real** derivatives = layerData.var(m_lts->derivatives);
+  real* (*faceNeighbors)[4] = layerData.var(m_lts->faceNeighbors);
+  const unsigned numberOfCells = layerData.getNumberOfCells();
+
+  std::unordered_map<real const*, unsigned> owners;
+  for (unsigned cell = 0; cell < numberOfCells; ++cell) {
+    if (buffers[cell] != nullptr) {
+      owners.emplace(buffers[cell], cell);
+    }
+    if (derivatives[cell] != nullptr) {
+      owners.emplace(derivatives[cell], cell);
+    }
+  }
 
-      for (unsigned int l_dof = 0; l_dof < tensor::I::size(); ++l_dof) {
-        buffers[l_cell][l_dof] += l_integrationBuffer[l_dof];
+  // The first and last cell of the layer which read the buffers or derivatives of a cell;
+  // the prediction of a cell also has to follow its own correction
+  std::vector<unsigned> firstReader(numberOfCells);
+  std::vector<unsigned> lastReader(numberOfCells);
+  std::iota(firstReader.begin(), firstReader.end(), 0);
+  std::iota(lastReader.begin(), lastReader.end(), 0);
+  for (unsigned cell = 0; cell < numberOfCells; ++cell) {
+    for (unsigned face = 0; face < 4; ++face) {
+      real const* neighbor = faceNeighbors[cell][face];
+      const auto owner = (neighbor != nullptr) ? owners.find(neighbor) : owners.end();
+      if (owner != owners.end()) {
+        firstReader[owner->second] = std::min(firstReader[owner->second], cell);
+        lastReader[owner->second] = std::max(lastReader[owner->second], cell);
       }
     }
   }
 
-  m_loopStatistics->end(m_regionComputeLocalIntegration, i_layerData.getNumberOfCells(), m_globalClusterId);
+  FusedSchedule schedule;
+  schedule.offsets.assign(numberOfCells + 1, 0);
+  for (unsigned cell = 0; cell < numberOfCells; ++cell) {
+    if (firstReader[cell] / FusedBlockSize == lastReader[cell] / FusedBlockSize) {
+      ++schedule.offsets[lastReader[cell] + 1];
+    } else {
+      schedule.deferred.push_back(cell);
+    }
+  }
+  std::partial_sum(schedule.offsets.begin(), schedule.offsets.end(), schedule.offsets.begin());
+
+  schedule.cells.resize(schedule.offsets.back());
+  std::vector<unsigned> next(schedule.offsets.begin(), schedule.offsets.end() - 1);
+  for (unsigned cell = 0; cell < numberOfCells; ++cell) {
+    if (firstReader[cell] / FusedBlockSize == lastReader[cell] / FusedBlockSize) {
+      schedule.cells[next[lastReader[cell]]++] = cell;
+    }
+  }
+  return schedule;
 }
-#else // ACL_DEVICE
-void seissol::time_stepping::TimeCluster::computeLocalIntegration(seissol::initializers::Layer& i_layerData, bool resetBuffers ) {
-  SCOREP_USER_REGION( "computeLocalIntegration", SCOREP_USER_REGION_TYPE_FUNCTION )
-  device.api->putProfilingMark("computeLocalIntegration", device::ProfilingColors::Yellow);
 
-  m_loopStatistics->begin(m_regionComputeLocalIntegration);
+bool seissol::time_stepping::TimeCluster::useQuiescentCellSkipping() {
+  static const bool skipping = utils::Env::get<int>("SEISSOL_SKIP_QUIESCENT_CELLS", 0) != 0;
+  return skipping;
+}
+
+void seissol::time_stepping::TimeCluster::initializeActiveCells(seissol::initializers::Layer& layerData) {
+  m_activeCellsInitialized = true;
+  // Plastic yielding of the initial stresses changes cells without any incoming wave
+  if (!useQuiescentCellSkipping() || !m_executeOnHost || usePlasticity) {
+    return;
+  }
+
+  real (*dofs)[tensor::Q::size()] = layerData.var(m_lts->dofs);
+  CellLocalInformation* cellInformation = layerData.var(m_lts->cellInformation);
+  const unsigned numberOfCells = layerData.getNumberOfCells();
+
+  m_activeCells.assign(numberOfCells, 0);
+  for (unsigned mapping = 0; mapping < m_numberOfCellToPointSourcesMappings; ++mapping) {
+    const std::ptrdiff_t cell = m_cellToPointSources[mapping].dofs - dofs;
+    if (cell >= 0 && cell < static_cast<std::ptrdiff_t>(numberOfCells)) {
+      m_activeCells[cell] = 1;
+    }
+  }
+
+  unsigned numberOfActiveCells = 0;
+  for (unsigned cell = 0; cell < numberOfCells; ++cell) {
+    for (unsigned face = 0; face < 4; ++face) {
+      const FaceType faceType = cellInformation[cell].faceTypes[face];
+      if (faceType == FaceType::dynamicRupture || faceType == FaceType::dirichlet ||
+          faceType == FaceType::analytical || faceType == FaceType::freeSurfaceGravity) {
+        m_activeCells[cell] = 1;
+      }
+    }
+    if (std::any_of(dofs[cell], dofs[cell] + tensor::Q::size(), [](real dof) { return dof != 0; })) {
+      m_activeCells[cell] = 1;
+    }
+    numberOfActiveCells += m_activeCells[cell];
+  }
+  m_numberOfActiveCells = numberOfActiveCells;
+}
 
-  real* (*faceNeighbors)[4] = i_layerData.var(m_lts->faceNeighbors);
+bool seissol::time_stepping::TimeCluster::activateCell(seissol::initializers::Layer& layerData, unsigned cell) {
+  real* (*faceNeighbors)[4] = layerData.var(m_lts->faceNeighbors);
+  CellLocalInformation const& cellInformation = layerData.var(m_lts->cellInformation)[cell];
+
+  for (unsigned face = 0; face < 4; ++face) {
+    const FaceType faceType = cellInformation.faceTypes[face];
+    real const* neighbor = faceNeighbors[cell][face];
+    if (neighbor == nullptr || faceType == FaceType::outflow || faceType == FaceType::dynamicRupture) {
+      continue;
+    }
+    const bool providesDerivatives = (cellInformation.ltsSetup >> face) % 2 == 1;
+    const unsigned size = providesDerivatives ? yateto::computeFamilySize<tensor::dQ>() : tensor::I::size();
+    if (std::any_of(neighbor, neighbor + size, [](real value) { return value != 0; })) {
+      m_activeCells[cell] = 1;
+      ++m_numberOfActiveCells;
+      return true;
+    }
+  }
+  return false;
+}
+
+void seissol::time_stepping::TimeCluster::computeFusedIntegrationOnHost(seissol::initializers::Layer& layerData,
+                                                                        double subTimeStart,
+                                                                        bool resetBuffers,
+                                                                        double nextCorrectionTime,
+                                                                        double nextTimeStepSize) {
+  if (usePlasticity) {
+    const auto [nonZeroFlopsPlasticity, hardwareFlopsPlasticity] = computeFusedIntegrationImplementation<true>(
+        layerData, subTimeStart, resetBuffers, nextCorrectionTime, nextTimeStepSize);
+    addFlops(g_SeisSolNonZeroFlopsPlasticity, nonZeroFlopsPlasticity);
+    addFlops(g_SeisSolHardwareFlopsPlasticity, hardwareFlopsPlasticity);
+  } else {
+    computeFusedIntegrationImplementation<false>(
+        layerData, subTimeStart, resetBuffers, nextCorrectionTime, nextTimeStepSize);
+  }
+}
+
+#ifndef ACL_DEVICE
+void seissol::time_stepping::TimeCluster::computeLocalIntegration(seissol::initializers::Layer& i_layerData, bool resetBuffers ) {
+  computeLocalIntegrationOnHost(i_layerData, resetBuffers);
+}
+#else // ACL_DEVICE
+namespace {
+bool useDeviceGraphs() {
+  static const bool graphs = utils::Env::get<int>("SEISSOL_DEVICE_GRAPHS", 0) != 0 &&
+                             seissol::kernels::device::aux::graph::isCapableOfGraphCapturing();
+  return graphs;
+}
+} // namespace
+
+void seissol::time_stepping::TimeCluster::launchLocalIntegration(seissol::initializers::Layer& i_layerData, bool resetBuffers) {
   ConditionalBatchTableT& table = i_layerData.getCondBatchTable();
   kernels::LocalTmp tmp;
 
   m_timeKernel.computeBatchedAder(timeStepSize(), tmp, table);
   m_localKernel.computeBatchedIntegral(table, tmp);
-  auto defaultStream = device.api->getDefaultStream();
+  auto stream = m_deviceContext->stream();
 
   for (unsigned face = 0; face < 4; ++face) {
     ConditionalKey key(*KernelNames::FaceDisplacements, *ComputationKind::None, face);
@@ -544,7 +1071,7 @@ void seissol::time_stepping::TimeCluster::computeLocalIntegration(seissol::initi
 
       // Note: this kernel doesn't require tmp. memory
       displacementKrnl.numElements = entry.content[*EntityId::FaceDisplacement]->getSize();
-      displacementKrnl.streamPtr = device.api->getDefaultStream();
+      displacementKrnl.streamPtr = stream;
       displacementKrnl.execute(face);
     }
   }
@@ -558,42 +1085,225 @@ void seissol::time_stepping::TimeCluster::computeLocalIntegration(seissol::initi
                                           (entry.content[*EntityId::Buffers])->getPointers(),
                                           tensor::I::Size,
                                           (entry.content[*EntityId::Idofs])->getSize(),
-                                          defaultStream);
+                                          stream);
     }
     else {
       device.algorithms.accumulateBatchedData((entry.content[*EntityId::Idofs])->getPointers(),
                                               (entry.content[*EntityId::Buffers])->getPointers(),
                                               tensor::I::Size,
                                               (entry.content[*EntityId::Idofs])->getSize(),
-                                              defaultStream);
+                                              stream);
     }
   }
+}
 
-  device.api->synchDevice();
+void seissol::time_stepping::TimeCluster::computeLocalIntegration(seissol::initializers::Layer& i_layerData, bool resetBuffers ) {
+  if (m_executeOnHost) {
+    computeLocalIntegrationOnHost(i_layerData, resetBuffers);
+    return;
+  }
+
+  SCOREP_USER_REGION( "computeLocalIntegration", SCOREP_USER_REGION_TYPE_FUNCTION )
+  device.api->putProfilingMark("computeLocalIntegration", device::ProfilingColors::Yellow);
+
+  m_loopStatistics->begin(m_regionComputeLocalIntegration);
+
+  kernels::DeviceContext::Scope deviceScope(*m_deviceContext);
+#ifdef USE_POROELASTIC
+  // host work, which may not be captured into a device graph
+  m_timeKernel.prepareBatchedAder(timeStepSize(), i_layerData, *m_lts);
+#endif
+  if (useDeviceGraphs() && !m_localIntegrationGraphsFailed) {
+    namespace graph = kernels::device::aux::graph;
+    void* stream = m_deviceContext->stream();
+    const double dt = timeStepSize();
+    auto cached = std::find_if(m_localIntegrationGraphs.begin(), m_localIntegrationGraphs.end(), [&](const auto& entry) {
+      return entry.timeStepSize == dt && entry.resetBuffers == resetBuffers;
+    });
+    void* instance = (cached != m_localIntegrationGraphs.end()) ? cached->instance : nullptr;
+    if (instance == nullptr && graph::beginCapture(stream)) {
+      launchLocalIntegration(i_layerData, resetBuffers);
+      instance = graph::endCapture(stream);
+      if (instance != nullptr) {
+        m_localIntegrationGraphs.push_back({dt, resetBuffers, instance});
+      }
+    }
+    if (instance != nullptr) {
+      graph::launchGraph(instance, stream);
+    } else {
+      logWarning(seissol::MPI::mpi.rank()) << "Could not capture the local integration of cluster" << m_globalClusterId
+                                           << "into a device graph; launching the kernels directly.";
+      m_localIntegrationGraphsFailed = true;
+      launchLocalIntegration(i_layerData, resetBuffers);
+    }
+  } else {
+    launchLocalIntegration(i_layerData, resetBuffers);
+  }
+
+  if (!m_deviceContext->hasOwnStream()) {
+    device.api->synchDevice();
+  }
   m_loopStatistics->end(m_regionComputeLocalIntegration, i_layerData.getNumberOfCells(), m_globalClusterId);
 
   device.api->popLastProfilingMark();
 }
 #endif // ACL_DEVICE
 
-#ifndef ACL_DEVICE
-void seissol::time_stepping::TimeCluster::computeNeighboringIntegration(seissol::initializers::Layer& i_layerData,
-                                                                        double subTimeStart) {
+real* seissol::time_stepping::TimeCluster::computeNeighborsIntegralOfCell(seissol::initializers::Layer& layerData,
+                                                                          kernels::NeighborData::Loader& loader,
+                                                                          unsigned cell,
+                                                                          double subTimeStart) {
+  real* (*faceNeighbors)[4] = layerData.var(m_lts->faceNeighbors);
+  CellDRMapping (*drMapping)[4] = layerData.var(m_lts->drMapping);
+  CellLocalInformation* cellInformation = layerData.var(m_lts->cellInformation);
+
+  real *l_timeIntegrated[4];
+  real *l_faceNeighbors_prefetch[4];
+
+  auto data = loader.entry(cell);
+  if (!isCellActive(cell) && !activateCell(layerData, cell)) {
+    return data.dofs;
+  }
+
+  seissol::kernels::TimeCommon::computeIntegrals(m_timeKernel,
+                                                 data.cellInformation.ltsSetup,
+                                                 data.cellInformation.faceTypes,
+                                                 subTimeStart,
+                                                 timeStepSize(),
+                                                 faceNeighbors[cell],
+#ifdef _OPENMP
+                                                 *reinterpret_cast<real (*)[4][tensor::I::size()]>(&(m_globalDataOnHost->integrationBufferLTS[omp_get_thread_num()*4*tensor::I::size()])),
+#else
+      *reinterpret_cast<real (*)[4][tensor::I::size()]>(m_globalDataOnHost->integrationBufferLTS),
+#endif
+                                                 l_timeIntegrated);
+
+#ifdef ENABLE_MATRIX_PREFETCH
+  l_faceNeighbors_prefetch[0] = (cellInformation[cell].faceTypes[1] != FaceType::dynamicRupture) ?
+                                faceNeighbors[cell][1] :
+                                drMapping[cell][1].godunov;
+  l_faceNeighbors_prefetch[1] = (cellInformation[cell].faceTypes[2] != FaceType::dynamicRupture) ?
+                                faceNeighbors[cell][2] :
+                                drMapping[cell][2].godunov;
+  l_faceNeighbors_prefetch[2] = (cellInformation[cell].faceTypes[3] != FaceType::dynamicRupture) ?
+                                faceNeighbors[cell][3] :
+                                drMapping[cell][3].godunov;
+
+  // fourth face's prefetches
+  if (cell < (layerData.getNumberOfCells()-1) ) {
+    l_faceNeighbors_prefetch[3] = (cellInformation[cell+1].faceTypes[0] != FaceType::dynamicRupture) ?
+                                  faceNeighbors[cell+1][0] :
+                                  drMapping[cell+1][0].godunov;
+    // the kernels only prefetch time-integrated buffers; the derivatives are integrated before
+    seissol::kernels::TimeCommon::prefetchDerivatives(cellInformation[cell+1].ltsSetup,
+                                                      cellInformation[cell+1].faceTypes,
+                                                      faceNeighbors[cell+1]);
+  } else {
+    l_faceNeighbors_prefetch[3] = faceNeighbors[cell][3];
+  }
+#endif
+
+  // See computeLocalIntegrationOfCell
+  real (*dofsCompensation)[tensor::Q::size()] = layerData.var(m_lts->dofsCompensation);
+  memory::ThreadLocalArena::Scope scratch;
+  real* dofsBefore = nullptr;
+  if (dofsCompensation != nullptr) {
+    dofsBefore = scratch.allocate<real>(tensor::Q::size());
+    std::copy_n(data.dofs, tensor::Q::size(), dofsBefore);
+    std::fill_n(data.dofs, tensor::Q::size(), 0);
+  }
+
+  m_neighborKernel.computeNeighborsIntegral( data,
+                                             drMapping[cell],
+#ifdef ENABLE_MATRIX_PREFETCH
+                                             l_timeIntegrated, l_faceNeighbors_prefetch
+#else
+      l_timeIntegrated
+#endif
+  );
+
+  if (dofsCompensation != nullptr) {
+    kernels::compensatedAdd(tensor::Q::size(), data.dofs, dofsBefore, dofsCompensation[cell]);
+    std::copy_n(dofsBefore, tensor::Q::size(), data.dofs);
+  }
+
+  // The damping of the absorbing layer decays the degrees of freedom exactly over the time step
+  real* absorbingDamping = layerData.var(m_lts->absorbingDamping);
+  if (absorbingDamping != nullptr && absorbingDamping[cell] > 0) {
+    const real decay = std::exp(-absorbingDamping[cell] * timeStepSize());
+    for (unsigned dof = 0; dof < tensor::Q::size(); ++dof) {
+      data.dofs[dof] *= decay;
+    }
+    if (dofsCompensation != nullptr) {
+      for (unsigned dof = 0; dof < tensor::Q::size(); ++dof) {
+        dofsCompensation[cell][dof] *= decay;
+      }
+    }
+  }
+  return data.dofs;
+}
+
+unsigned seissol::time_stepping::TimeCluster::numberOfPlasticCells(seissol::initializers::Layer& layerData) {
+  // The plastic parameters are set after the clusters are created, but do not change during the simulation
+  if (m_numberOfPlasticCells == std::numeric_limits<unsigned>::max()) {
+    PlasticityData const* plasticity = layerData.var(m_lts->plasticity);
+    m_numberOfPlasticCells = std::count_if(plasticity, plasticity + layerData.getNumberOfCells(), [](auto const& data) {
+      return seissol::kernels::Plasticity::isPlasticCell(&data);
+    });
+  }
+  return m_numberOfPlasticCells;
+}
+
+std::pair<long, long> seissol::time_stepping::TimeCluster::countPlasticityFlops(unsigned numberOfCells,
+                                                                                unsigned numberOfPlasticityChecks,
+                                                                                unsigned numberOfYieldingCells,
+                                                                                bool precheck) {
+  const unsigned numberOfPrechecks = precheck ? numberOfCells : 0;
+  const long long nonZeroFlopsPlasticity =
+      numberOfPrechecks * m_flops_nonZero[static_cast<int>(ComputePart::PlasticityPrecheck)] +
+      numberOfPlasticityChecks * m_flops_nonZero[static_cast<int>(ComputePart::PlasticityCheck)] +
+      numberOfYieldingCells * m_flops_nonZero[static_cast<int>(ComputePart::PlasticityYield)];
+  const long long hardwareFlopsPlasticity =
+      numberOfPrechecks * m_flops_hardware[static_cast<int>(ComputePart::PlasticityPrecheck)] +
+      numberOfPlasticityChecks * m_flops_hardware[static_cast<int>(ComputePart::PlasticityCheck)] +
+      numberOfYieldingCells * m_flops_hardware[static_cast<int>(ComputePart::PlasticityYield)];
+  addFlops(g_SeisSolPlasticityCells, numberOfCells);
+  addFlops(g_SeisSolPlasticitySkippedCells, numberOfCells - numberOfPlasticityChecks);
+  return {nonZeroFlopsPlasticity, hardwareFlopsPlasticity};
+}
+
+void seissol::time_stepping::TimeCluster::computeNeighboringIntegrationOnHost(seissol::initializers::Layer& i_layerData,
+                                                                              double subTimeStart) {
   if (usePlasticity) {
-    computeNeighboringIntegrationImplementation<true>(i_layerData, subTimeStart);
+    const auto [nonZeroFlopsPlasticity, hardwareFlopsPlasticity] =
+        computeNeighboringIntegrationImplementation<true>(i_layerData, subTimeStart);
+    addFlops(g_SeisSolNonZeroFlopsPlasticity, nonZeroFlopsPlasticity);
+    addFlops(g_SeisSolHardwareFlopsPlasticity, hardwareFlopsPlasticity);
   } else {
     computeNeighboringIntegrationImplementation<false>(i_layerData, subTimeStart);
   }
 }
+
+#ifndef ACL_DEVICE
+void seissol::time_stepping::TimeCluster::computeNeighboringIntegration(seissol::initializers::Layer& i_layerData,
+                                                                        double subTimeStart) {
+  computeNeighboringIntegrationOnHost(i_layerData, subTimeStart);
+}
 #else // ACL_DEVICE
 void seissol::time_stepping::TimeCluster::computeNeighboringIntegration( seissol::initializers::Layer&  i_layerData,
                                                                          double subTimeStart) {
+  if (m_executeOnHost) {
+    computeNeighboringIntegrationOnHost(i_layerData, subTimeStart);
+    return;
+  }
+
   device.api->putProfilingMark("computeNeighboring", device::ProfilingColors::Red);
   SCOREP_USER_REGION( "computeNeighboringIntegration", SCOREP_USER_REGION_TYPE_FUNCTION )
   m_loopStatistics->begin(m_regionComputeNeighboringIntegration);
 
   ConditionalBatchTableT &table = i_layerData.getCondBatchTable();
 
+  kernels::DeviceContext::Scope deviceScope(*m_deviceContext);
   seissol::kernels::TimeCommon::computeBatchedIntegrals(m_timeKernel,
                                                         subTimeStart,
                                                         timeStepSize(),
@@ -609,15 +1319,17 @@ void seissol::time_stepping::TimeCluster::computeNeighboringIntegration( seissol
                                                                                       table,
                                                                                       plasticity);
 
-    g_SeisSolNonZeroFlopsPlasticity +=
+    addFlops(g_SeisSolNonZeroFlopsPlasticity,
         i_layerData.getNumberOfCells() * m_flops_nonZero[static_cast<int>(ComputePart::PlasticityCheck)]
-        + numAdjustedDofs * m_flops_nonZero[static_cast<int>(ComputePart::PlasticityYield)];
-    g_SeisSolHardwareFlopsPlasticity +=
+        + numAdjustedDofs * m_flops_nonZero[static_cast<int>(ComputePart::PlasticityYield)]);
+    addFlops(g_SeisSolHardwareFlopsPlasticity,
         i_layerData.getNumberOfCells() * m_flops_hardware[static_cast<int>(ComputePart::PlasticityCheck)]
-        + numAdjustedDofs * m_flops_hardware[static_cast<int>(ComputePart::PlasticityYield)];
+        + numAdjustedDofs * m_flops_hardware[static_cast<int>(ComputePart::PlasticityYield)]);
   }
 
-  device.api->synchDevice();
+  if (!m_deviceContext->hasOwnStream()) {
+    device.api->synchDevice();
+  }
   device.api->popLastProfilingMark();
   m_loopStatistics->end(m_regionComputeNeighboringIntegration, i_layerData.getNumberOfCells(), m_globalClusterId);
 }
@@ -686,12 +1398,20 @@ void seissol::time_stepping::TimeCluster::computeNeighborIntegrationFlops(seisso
 void seissol::time_stepping::TimeCluster::computeFlops() {
   computeLocalIntegrationFlops(*m_clusterData);
   computeNeighborIntegrationFlops(*m_clusterData);
+  const long long numberOfCells = m_clusterData->getNumberOfCells();
+  m_bytes[static_cast<int>(RooflineKernel::Local)] =
+      numberOfCells * (m_timeKernel.bytesAder() + m_localKernel.bytesIntegral());
+  m_bytes[static_cast<int>(RooflineKernel::Neighbor)] = numberOfCells * m_neighborKernel.bytesNeighborsIntegral();
   computeDynamicRuptureFlops(*dynRupInteriorData,
                              m_flops_nonZero[static_cast<int>(ComputePart::DRFrictionLawInterior)],
                              m_flops_hardware[static_cast<int>(ComputePart::DRFrictionLawInterior)]);
   computeDynamicRuptureFlops(*dynRupCopyData,
                              m_flops_nonZero[static_cast<int>(ComputePart::DRFrictionLawCopy)],
                              m_flops_hardware[static_cast<int>(ComputePart::DRFrictionLawCopy)]);
+  seissol::kernels::Plasticity::flopsYieldingPossible(
+          m_flops_nonZero[static_cast<int>(ComputePart::PlasticityPrecheck)],
+          m_flops_hardware[static_cast<int>(ComputePart::PlasticityPrecheck)]
+          );
   seissol::kernels::Plasticity::flopsPlasticity(
           m_flops_nonZero[static_cast<int>(ComputePart::PlasticityCheck)],
           m_flops_hardware[static_cast<int>(ComputePart::PlasticityCheck)],
@@ -703,7 +1423,15 @@ void seissol::time_stepping::TimeCluster::computeFlops() {
 namespace seissol::time_stepping {
 ActResult TimeCluster::act() {
   actorStateStatistics->enter(state);
+  const auto stateBefore = state;
+  timespec begin;
+  clock_gettime(CLOCK_MONOTONIC, &begin);
   const auto result = AbstractTimeCluster::act();
+  if (result.isStateChanged && stateBefore != ActorState::Synced && state != ActorState::Synced) {
+    timespec end;
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    actorStateStatistics->addComputation(begin, end);
+  }
   actorStateStatistics->enter(state);
   return result;
 }
@@ -716,31 +1444,71 @@ void TimeCluster::handleAdvancedPredictionTimeMessage(const NeighborCluster& nei
 void TimeCluster::handleAdvancedCorrectionTimeMessage(const NeighborCluster&) {
   // Doesn't do anything
 }
-void TimeCluster::predict() {
-  assert(state == ActorState::Corrected);
+bool TimeCluster::mayResetBuffers(long stepsSinceLastSync) const {
   bool resetBuffers = true;
   for (auto& neighbor : neighbors) {
       if (neighbor.ct.timeStepRate > ct.timeStepRate
-          && ct.stepsSinceLastSync > neighbor.ct.stepsSinceLastSync) {
+          && stepsSinceLastSync > neighbor.ct.stepsSinceLastSync) {
           resetBuffers = false;
         }
   }
-  if (ct.stepsSinceLastSync == 0) {
+  if (stepsSinceLastSync == 0) {
     resetBuffers = true;
   }
+  return resetBuffers;
+}
+
+void TimeCluster::predict() {
+  assert(state == ActorState::Corrected);
+  if (useCommunicationSkeleton()) {
+    emulateComputation();
+    return;
+  }
+  const bool resetBuffers = mayResetBuffers(ct.stepsSinceLastSync);
+  if (!m_activeCellsInitialized) {
+    initializeActiveCells(*m_clusterData);
+  }
 
   // These methods compute the receivers/sources for both interior and copy cluster
   // and are called in actors for both copy AND interior.
+#ifdef ACL_DEVICE
+  // the neighbors have to be done with the buffers and derivatives of the last prediction
+  waitForNeighborEvents(false);
+  prefetchCellDataIfOversubscribed(true);
+  if (m_receiverCluster != nullptr && !kernels::DeviceReceivers::isSupported()) {
+    synchronizeDeviceStream();
+  }
+#endif
+  const double receiverTime = m_receiverTime;
   writeReceivers();
+  sampleWaveField();
+#ifdef ACL_DEVICE
+  if (m_executeOnHost && m_receiverCluster != nullptr) {
+    // the receivers are sampled on the device, but the host overwrites the degrees of freedom next
+    kernels::device::aux::stream::synchronizeStream(m_deviceContext->stream());
+  }
+#endif
+  timespec localBegin;
+  clock_gettime(CLOCK_MONOTONIC, &localBegin);
   computeLocalIntegration(*m_clusterData, resetBuffers);
-  computeSources();
+  timespec localEnd;
+  clock_gettime(CLOCK_MONOTONIC, &localEnd);
+  m_roofline[static_cast<int>(RooflineKernel::Local)].add(seconds(difftime(localBegin, localEnd)),
+                                                          m_flops_hardware[static_cast<int>(ComputePart::Local)],
+                                                          m_bytes[static_cast<int>(RooflineKernel::Local)]);
+  // receivers in cells with stored derivatives reuse the time prediction of the local integration
+  if (m_receiverCluster != nullptr) {
+    m_receiverCluster->calcReceiversFromDerivatives(receiverTime, ct.correctionTime, timeStepSize());
+  }
+  computeSources(ct.correctionTime, ct.correctionTime + timeStepSize());
+#ifdef ACL_DEVICE
+  recordDeviceEvent(predictionEvent);
+#endif
 
-  g_SeisSolNonZeroFlopsLocal += m_flops_nonZero[static_cast<int>(ComputePart::Local)];
-  g_SeisSolHardwareFlopsLocal += m_flops_hardware[static_cast<int>(ComputePart::Local)];
+  addFlops(g_SeisSolNonZeroFlopsLocal, m_flops_nonZero[static_cast<int>(ComputePart::Local)]);
+  addFlops(g_SeisSolHardwareFlopsLocal, m_flops_hardware[static_cast<int>(ComputePart::Local)]);
 }
-void TimeCluster::correct() {
-  assert(state == ActorState::Predicted);
-
+double TimeCluster::startCorrection() {
   /* Sub start time of width respect to the next cluster; use 0 if not relevant, for example in GTS.
    * LTS requires to evaluate a partial time integration of the derivatives. The point zero in time refers to the derivation of the surrounding time derivatives, which
    * coincides with the last completed time step of the next cluster. The start/end of the time step is the start/end of this clusters time step relative to the zero point.
@@ -760,38 +1528,94 @@ void TimeCluster::correct() {
    */
   double subTimeStart = ct.correctionTime - lastSubTime;
 
+#ifdef ACL_DEVICE
+  waitForNeighborEvents(true);
+  prefetchCellDataIfOversubscribed(false);
+  if (dynamicRuptureScheduler->hasDynamicRuptureFaces()) {
+    // the dynamic rupture runs in the default stream and the friction laws partially on the host
+    synchronizeDeviceStream();
+  }
+#endif
+
   // Note, if this is a copy layer actor, we need the FL_Copy and the FL_Int.
   // Otherwise, this is an interior layer actor, and we need only the FL_Int.
   // We need to avoid computing it twice.
   if (dynamicRuptureScheduler->hasDynamicRuptureFaces()) {
-    if (dynamicRuptureScheduler->mayComputeInterior(ct.stepsSinceStart)) {
-      computeDynamicRupture(*dynRupInteriorData);
-      g_SeisSolNonZeroFlopsDynamicRupture += m_flops_nonZero[static_cast<int>(ComputePart::DRFrictionLawInterior)];
-      g_SeisSolHardwareFlopsDynamicRupture += m_flops_hardware[static_cast<int>(ComputePart::DRFrictionLawInterior)];
-      dynamicRuptureScheduler->setLastCorrectionStepsInterior(ct.stepsSinceStart);
+    {
+      // The other actor of this cluster has to wait until the interior faces are done,
+      // as its neighboring integration needs their imposed states.
+      std::lock_guard lock(*dynamicRuptureScheduler);
+      if (dynamicRuptureScheduler->mayComputeInterior(ct.stepsSinceStart)) {
+        computeDynamicRupture(*dynRupInteriorData);
+        if (m_momentRateOutput != nullptr) {
+          m_momentRateOutput->accumulateLayer(*dynRupInteriorData, ct.correctionTime, timeStepSize());
+        }
+        addFlops(g_SeisSolNonZeroFlopsDynamicRupture, m_flops_nonZero[static_cast<int>(ComputePart::DRFrictionLawInterior)]);
+        addFlops(g_SeisSolHardwareFlopsDynamicRupture, m_flops_hardware[static_cast<int>(ComputePart::DRFrictionLawInterior)]);
+        dynamicRuptureScheduler->setLastCorrectionStepsInterior(ct.stepsSinceStart);
+      }
     }
     if (layerType == Copy) {
       computeDynamicRupture(*dynRupCopyData);
-      g_SeisSolNonZeroFlopsDynamicRupture += m_flops_nonZero[static_cast<int>(ComputePart::DRFrictionLawCopy)];
-      g_SeisSolHardwareFlopsDynamicRupture += m_flops_hardware[static_cast<int>(ComputePart::DRFrictionLawCopy)];
+      if (m_momentRateOutput != nullptr) {
+        m_momentRateOutput->accumulateLayer(*dynRupCopyData, ct.correctionTime, timeStepSize());
+      }
+      addFlops(g_SeisSolNonZeroFlopsDynamicRupture, m_flops_nonZero[static_cast<int>(ComputePart::DRFrictionLawCopy)]);
+      addFlops(g_SeisSolHardwareFlopsDynamicRupture, m_flops_hardware[static_cast<int>(ComputePart::DRFrictionLawCopy)]);
+      std::lock_guard lock(*dynamicRuptureScheduler);
       dynamicRuptureScheduler->setLastCorrectionStepsCopy((ct.stepsSinceStart));
     }
+#ifdef ACL_DEVICE
+    if (m_deviceContext->hasOwnStream()) {
+      device.api->fastStreamsSync();
+    }
+#endif
+  }
+  return subTimeStart;
+}
 
+void TimeCluster::correct() {
+  assert(state == ActorState::Predicted);
+  if (useCommunicationSkeleton()) {
+    emulateComputation();
+    return;
   }
+  const double subTimeStart = startCorrection();
+
+  timespec neighborBegin;
+  clock_gettime(CLOCK_MONOTONIC, &neighborBegin);
   computeNeighboringIntegration(*m_clusterData, subTimeStart);
+  timespec neighborEnd;
+  clock_gettime(CLOCK_MONOTONIC, &neighborEnd);
+  m_roofline[static_cast<int>(RooflineKernel::Neighbor)].add(seconds(difftime(neighborBegin, neighborEnd)),
+                                                             m_flops_hardware[static_cast<int>(ComputePart::Neighbor)],
+                                                             m_bytes[static_cast<int>(RooflineKernel::Neighbor)]);
+#ifdef ACL_DEVICE
+  recordDeviceEvent(correctionEvent);
+#endif
+
+  completeCorrection();
+}
 
-  g_SeisSolNonZeroFlopsNeighbor += m_flops_nonZero[static_cast<int>(ComputePart::Neighbor)];
-  g_SeisSolHardwareFlopsNeighbor += m_flops_hardware[static_cast<int>(ComputePart::Neighbor)];
-  g_SeisSolNonZeroFlopsDynamicRupture += m_flops_nonZero[static_cast<int>(ComputePart::DRNeighbor)];
-  g_SeisSolHardwareFlopsDynamicRupture += m_flops_hardware[static_cast<int>(ComputePart::DRNeighbor)];
+void TimeCluster::completeCorrection() {
+  addFlops(g_SeisSolNonZeroFlopsNeighbor, m_flops_nonZero[static_cast<int>(ComputePart::Neighbor)]);
+  addFlops(g_SeisSolHardwareFlopsNeighbor, m_flops_hardware[static_cast<int>(ComputePart::Neighbor)]);
+  addFlops(g_SeisSolNonZeroFlopsDynamicRupture, m_flops_nonZero[static_cast<int>(ComputePart::DRNeighbor)]);
+  addFlops(g_SeisSolHardwareFlopsDynamicRupture, m_flops_hardware[static_cast<int>(ComputePart::DRNeighbor)]);
+
+  if (m_energyOutput != nullptr) {
+    m_energyOutput->accumulateLayer(*m_clusterData, ct.correctionTime + timeStepSize());
+  }
 
   // First cluster calls fault receiver output
   // Call fault output only if both interior and copy parts of DR were computed
   // TODO: Change from iteration based to time based
-  if (m_clusterId == 0
-      && dynamicRuptureScheduler->mayComputeFaultOutput(ct.stepsSinceStart)) {
-    e_interoperability.faultOutput(ct.correctionTime + timeStepSize(), timeStepSize());
-    dynamicRuptureScheduler->setLastFaultOutput(ct.stepsSinceStart);
+  if (m_clusterId == 0) {
+    std::lock_guard lock(*dynamicRuptureScheduler);
+    if (dynamicRuptureScheduler->mayComputeFaultOutput(ct.stepsSinceStart)) {
+      e_interoperability.faultOutput(ct.correctionTime + timeStepSize(), timeStepSize());
+      dynamicRuptureScheduler->setLastFaultOutput(ct.stepsSinceStart);
+    }
   }
 
 
@@ -809,6 +1633,41 @@ void TimeCluster::correct() {
 
 }
 
+bool TimeCluster::mayCorrectAndPredict() {
+#ifdef ACL_DEVICE
+  // The device integrations synchronize with the neighbors before each of them
+  return false;
+#else
+  if (!useFusedUpdates() || useCommunicationSkeleton()) {
+    return false;
+  }
+  // The outputs read the degrees of freedom between the correction and the next prediction
+  const bool isEnergyOutputStep =
+      m_energyOutput != nullptr && m_energyOutput->isAccumulatedAt(ct.correctionTime + timeStepSize());
+  return m_receiverCluster == nullptr && m_waveFieldSamplers.empty() && !isEnergyOutputStep;
+#endif
+}
+
+void TimeCluster::correctAndPredict() {
+  assert(state == ActorState::Predicted);
+  const double subTimeStart = startCorrection();
+
+  // The prediction advances from the end of the current time step
+  const ClusterTimes next = timesAfterCorrection();
+  const double nextTimeStepSize = next.timeStepSize(syncTime);
+  computeFusedIntegrationOnHost(*m_clusterData,
+                                subTimeStart,
+                                mayResetBuffers(next.stepsSinceLastSync),
+                                next.correctionTime,
+                                nextTimeStepSize);
+
+  completeCorrection();
+  computeSources(next.correctionTime, next.correctionTime + nextTimeStepSize);
+
+  addFlops(g_SeisSolNonZeroFlopsLocal, m_flops_nonZero[static_cast<int>(ComputePart::Local)]);
+  addFlops(g_SeisSolHardwareFlopsLocal, m_flops_hardware[static_cast<int>(ComputePart::Local)]);
+}
+
 void TimeCluster::reset() {
     AbstractTimeCluster::reset();
 }
@@ -850,6 +1709,25 @@ unsigned int TimeCluster::getGlobalClusterId() const {
 LayerType TimeCluster::getLayerType() const {
   return layerType;
 }
+const RooflineCounters& TimeCluster::getRooflineCounters(RooflineKernel kernel) const {
+  return m_roofline[static_cast<int>(kernel)];
+}
+unsigned TimeCluster::getNumberOfCells() const {
+  return m_clusterData->getNumberOfCells();
+}
+std::size_t TimeCluster::getWorkingSetBytes() const {
+  constexpr std::size_t BytesPerCell = sizeof(real[tensor::Q::size()]) + sizeof(LocalIntegrationData) +
+                                       sizeof(NeighboringIntegrationData) + sizeof(CellLocalInformation) +
+                                       sizeof(real*[4]) + 2 * sizeof(real*);
+  return m_clusterData->getNumberOfCells() * BytesPerCell + m_clusterData->getBucketSize(m_lts->buffersDerivatives);
+}
+long long TimeCluster::getHardwareFlopsPerUpdate() const {
+  const auto drFrictionLaw = layerType == Copy ? ComputePart::DRFrictionLawCopy : ComputePart::DRFrictionLawInterior;
+  return m_flops_hardware[static_cast<int>(ComputePart::Local)] +
+         m_flops_hardware[static_cast<int>(ComputePart::Neighbor)] +
+         m_flops_hardware[static_cast<int>(ComputePart::DRNeighbor)] +
+         m_flops_hardware[static_cast<int>(drFrictionLaw)];
+}
 void TimeCluster::setReceiverTime(double receiverTime) {
   m_receiverTime = receiverTime;
 }
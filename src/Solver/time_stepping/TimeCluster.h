@@ -73,7 +73,14 @@
 
 #ifdef USE_MPI
 #include <mpi.h>
+#include <atomic>
+#include <cstdint>
+#include <limits>
 #include <list>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
 #endif
 
 #include <Initializer/typedefs.hpp>
@@ -86,17 +93,23 @@
 #include <Kernels/Local.h>
 #include <Kernels/Neighbor.h>
 #include <Kernels/DynamicRupture.h>
+#include <DynamicRupture/FrictionLaws/FrictionSolver.h>
 #include <Kernels/Plasticity.h>
 #include <Kernels/TimeCommon.h>
 #include <Solver/FreeSurfaceIntegrator.h>
 #include <Monitoring/LoopStatistics.h>
 #include <Monitoring/ActorStateStatistics.h>
+#include <Monitoring/FlopCounter.hpp>
+#include <Monitoring/Roofline.h>
+#include <Parallel/Tasking.h>
 
 #include "AbstractTimeCluster.h"
 
 #ifdef ACL_DEVICE
 #include <device.h>
+#include <Kernels/DeviceContext.h>
 #include <Solver/Pipeline/DrPipeline.h>
+#include <SourceTerm/DevicePointSources.h>
 #endif
 
 namespace seissol {
@@ -106,6 +119,12 @@ namespace seissol {
 
   namespace kernels {
     class ReceiverCluster;
+    class WaveFieldSampler;
+  }
+
+  namespace writer {
+    class EnergyOutput;
+    class MomentRateOutput;
   }
 }
 
@@ -123,6 +142,12 @@ private:
     void start() override {}
     void predict() override;
     void correct() override;
+    bool mayCorrectAndPredict() override;
+    void correctAndPredict() override;
+    //! Dynamic rupture of the correction; returns the start of the time step relative to the next larger cluster
+    double startCorrection();
+    //! Flops and outputs after the neighboring integration
+    void completeCorrection();
     bool usePlasticity;
 
     //! number of time steps
@@ -150,7 +175,46 @@ private:
     GlobalData *m_globalDataOnDevice{nullptr};
 #ifdef ACL_DEVICE
     device::DeviceInstance& device = device::DeviceInstance::getInstance();
-    dr::pipeline::DrPipeline drPipeline;
+
+    /**
+     * Captured kernel launches of the local integration (SEISSOL_DEVICE_GRAPHS=1).
+     * The time step width and the buffer reset are baked into the graph, hence one graph per combination.
+     **/
+    struct LocalIntegrationGraph {
+      double timeStepSize;
+      bool resetBuffers;
+      void* instance;
+    };
+    std::vector<LocalIntegrationGraph> m_localIntegrationGraphs;
+    bool m_localIntegrationGraphsFailed{false};
+
+    //! Launches the batched kernels of the local integration to the stream of the cluster.
+    void launchLocalIntegration(seissol::initializers::Layer& i_layerData, bool resetBuffers);
+
+    /**
+     * Stream and temporaries of the kernels of this cluster. With SEISSOL_DEVICE_CLUSTER_STREAMS=1, every cluster
+     * has its own stream, the host does not wait for the integrations, and the neighboring clusters are ordered
+     * with the events predictionEvent and correctionEvent instead.
+     **/
+    std::unique_ptr<kernels::DeviceContext> m_deviceContext;
+
+    //! High for the copy layer, such that its kernels, which the MPI sends wait for, run ahead of the interior.
+    kernels::DeviceContext::StreamPriority streamPriority() const;
+
+    //! Delays the following kernels of this cluster until the last announced predictions (or corrections) of all neighbors are done.
+    void waitForNeighborEvents(bool predictions);
+
+    //! Blocks the host until the kernels of this cluster are done, i.e. before the host accesses the cell data.
+    void synchronizeDeviceStream();
+
+    //! Records the event after the kernels of this cluster; without an own stream, the device is synchronized after each integration instead.
+    void recordDeviceEvent(void* event);
+
+    //! Migrates the unified cell data which the prediction (or the correction) of this cluster uses to the device.
+    void prefetchCellData(int deviceId, bool prediction);
+
+    //! Prefetches the cell data before the integration if it may not fit into the device memory, see memory::isDeviceMemoryOversubscribed.
+    void prefetchCellDataIfOversubscribed(bool prediction);
 #endif
 
     /*
@@ -161,6 +225,8 @@ private:
     seissol::initializers::Layer* dynRupCopyData;
     seissol::initializers::LTS*         m_lts;
     seissol::initializers::DynamicRupture* m_dynRup;
+    //! C++ friction solver; nullptr if the friction law is evaluated in Fortran
+    seissol::dr::friction_law::FrictionSolver* m_frictionSolver;
 
     //! Mapping of cells to point sources
     sourceterm::CellToPointSourcesMapping const* m_cellToPointSources;
@@ -171,12 +237,21 @@ private:
     //! Point sources
     sourceterm::PointSources const* m_pointSources;
 
+    //! Time-integrated source time functions of the current time step (3 per source)
+    std::vector<real> m_sourceIntegrals;
+
+#ifdef ACL_DEVICE
+    //! Point sources of this cluster on the device; nullptr if the sources are added on the host
+    std::unique_ptr<sourceterm::DevicePointSources> m_devicePointSources;
+#endif
+
     enum class ComputePart {
       Local = 0,
       Neighbor,
       DRNeighbor,
       DRFrictionLawInterior,
       DRFrictionLawCopy,
+      PlasticityPrecheck,
       PlasticityCheck,
       PlasticityYield,
       NUM_COMPUTE_PARTS
@@ -184,6 +259,12 @@ private:
 
     long long m_flops_nonZero[static_cast<int>(ComputePart::NUM_COMPUTE_PARTS)];
     long long m_flops_hardware[static_cast<int>(ComputePart::NUM_COMPUTE_PARTS)];
+
+    //! Estimated memory traffic of the local and neighbor integration of all cells per time step
+    long long m_bytes[static_cast<int>(RooflineKernel::NUM_KERNELS)];
+
+    //! Measurements of the local and neighbor integration for the roofline report
+    RooflineCounters m_roofline[static_cast<int>(RooflineKernel::NUM_KERNELS)];
     
     //! Tv parameter for plasticity
     double m_tv;
@@ -197,18 +278,40 @@ private:
     unsigned        m_regionComputeLocalIntegration;
     unsigned        m_regionComputeNeighboringIntegration;
     unsigned        m_regionComputeDynamicRupture;
+    unsigned        m_counterDynamicRuptureActiveFaces;
+    unsigned        m_counterActiveCells;
 
     kernels::ReceiverCluster* m_receiverCluster;
 
+    //! Wave field outputs sampled by the cluster and the id of the cluster in each sampler
+    std::vector<std::pair<kernels::WaveFieldSampler*, unsigned>> m_waveFieldSamplers;
+
+    //! Energy output to which the cluster adds the volume energies at the output times, if any
+    writer::EnergyOutput* m_energyOutput = nullptr;
+
+    //! Moment rate output to which the cluster adds the moment released by its dynamic rupture faces, if any
+    writer::MomentRateOutput* m_momentRateOutput = nullptr;
+
     /**
      * Writes the receiver output if applicable (receivers present, receivers have to be written).
      **/
     void writeReceivers();
 
     /**
-     * Computes the source terms if applicable.
+     * Samples the wave field outputs at their output times in the next time step.
+     **/
+    void sampleWaveField();
+
+    /**
+     * Computes the source terms of the time interval [fromTime, toTime] if applicable.
+     **/
+    void computeSources(double fromTime, double toTime);
+
+    /**
+     * True if the next prediction may overwrite the time integration buffers, i.e. no neighbor with a larger time
+     * step still accumulates them. stepsSinceLastSync is the step count of the cluster at the prediction.
      **/
-    void computeSources();
+    bool mayResetBuffers(long stepsSinceLastSync) const;
 
     /**
      * Computes dynamic rupture.
@@ -250,7 +353,141 @@ private:
     void computeNeighboringIntegration( seissol::initializers::Layer&  i_layerData, double subTimeStart );
 
     void computeLocalIntegrationFlops(seissol::initializers::Layer& layerData);
+
+    /**
+     * True if the integrations of this cluster run on the host, see setExecuteOnHost.
+     * Always true without ACL_DEVICE.
+     **/
+    bool m_executeOnHost{!seissol::isDeviceOn()};
+
+    //! Local integration of the cells of the layer on the host.
+    void computeLocalIntegrationOnHost(seissol::initializers::Layer& i_layerData, bool resetBuffers);
+
+    //! Local integration of one cell on the host for the time step [correctionTime, correctionTime + timeStepSize].
+    void computeLocalIntegrationOfCell(seissol::initializers::Layer& layerData,
+                                       kernels::LocalData::Loader& loader,
+                                       unsigned cell,
+                                       bool resetBuffers,
+                                       double correctionTime,
+                                       double timeStepSize);
+
+    //! Neighbor integral of one cell on the host; returns the degrees of freedom of the cell.
+    real* computeNeighborsIntegralOfCell(seissol::initializers::Layer& layerData,
+                                         kernels::NeighborData::Loader& loader,
+                                         unsigned cell,
+                                         double subTimeStart);
+
+    //! Number of cells of the layer in plastic regions, see Plasticity::isPlasticCell; counted at the first call.
+    unsigned numberOfPlasticCells(seissol::initializers::Layer& layerData);
+    unsigned m_numberOfPlasticCells = std::numeric_limits<unsigned>::max();
+
+    /**
+     * Plasticity flops (non-zero, hardware) of a neighboring integration; counts the checked cells.
+     * Without precheck, the cells skipped the cheap check of Plasticity::isYieldingPossible.
+     **/
+    std::pair<long, long> countPlasticityFlops(unsigned numberOfCells,
+                                               unsigned numberOfPlasticityChecks,
+                                               unsigned numberOfYieldingCells,
+                                               bool precheck = true);
+
+    //! Neighboring integration of the cells of the layer on the host.
+    void computeNeighboringIntegrationOnHost(seissol::initializers::Layer& i_layerData, double subTimeStart);
+
+    //! Returns true if the neighbor integration visits the cells grouped by face configuration (SEISSOL_NEIGHBOR_BINNING=1).
+    static bool useNeighborBinning();
+
+    /**
+     * Returns true if the local integration streams the buffers of the cells out with non-temporal stores
+     * (SEISSOL_STREAMING_STORES; on by default if the architecture has them).
+     */
+    static bool useStreamingStores();
+
+    /**
+     * Sorts the cells of the layer by their face types and neighboring flux matrices, such that consecutive cells
+     * in the neighbor integration take the same branches and kernels. The order of cells with the same faces is kept.
+     **/
+    std::vector<unsigned> computeNeighborCellOrder(seissol::initializers::Layer& layerData) const;
+
+    //! Order of the cells in the neighbor integration; empty for the storage order
+    std::vector<unsigned> m_neighborCellOrder;
+
+    /**
+     * Returns true if a correction, which is directly followed by the next prediction, is computed in one pass
+     * over the cells on the host (SEISSOL_FUSED_UPDATES=1), see correctAndPredict.
+     **/
+    static bool useFusedUpdates();
+
+    //! Sleeps instead of computing a prediction or correction in the communication skeleton.
+    void emulateComputation();
+
+    //! Number of consecutive cells which one thread corrects and predicts in a fused update
+    static constexpr unsigned FusedBlockSize = 256;
+
+    /**
+     * Order of the predictions in a fused update. The prediction of a cell overwrites its buffers and derivatives,
+     * hence it has to wait for the corrections of all cells of the layer which read them.
+     * Within a block of FusedBlockSize cells, the cells predicted after the correction of cell i are
+     * cells[offsets[i]..offsets[i+1]); the cells which are read by other blocks are deferred until all blocks are
+     * corrected.
+     **/
+    struct FusedSchedule {
+      std::vector<unsigned> offsets;
+      std::vector<unsigned> cells;
+      std::vector<unsigned> deferred;
+    };
+
+    FusedSchedule computeFusedSchedule(seissol::initializers::Layer& layerData) const;
+
+    //! Computed at the first fused update, as the faces of the cells do not change
+    FusedSchedule m_fusedSchedule;
+
+    //! Fused neighboring integration of the current and local integration of the next time step on the host.
+    void computeFusedIntegrationOnHost(seissol::initializers::Layer& layerData,
+                                       double subTimeStart,
+                                       bool resetBuffers,
+                                       double nextCorrectionTime,
+                                       double nextTimeStepSize);
+
+    //! Returns true if the host skips cells while they and their neighbors are exactly zero (SEISSOL_SKIP_QUIESCENT_CELLS=1).
+    static bool useQuiescentCellSkipping();
+
+    /**
+     * Activates the cells of the layer which may be non-zero before any wave arrives: cells with non-zero degrees of
+     * freedom (initial conditions, checkpoints), point sources or faces which inject data (dynamic rupture,
+     * inhomogeneous boundary conditions). Leaves the mask empty, i.e. all cells active, if skipping is disabled.
+     **/
+    void initializeActiveCells(seissol::initializers::Layer& layerData);
+
+    //! Activates an inactive cell if a neighbor provides non-zero buffers or derivatives; returns true if the cell is active.
+    bool activateCell(seissol::initializers::Layer& layerData, unsigned cell);
+
+    bool isCellActive(unsigned cell) const {
+      return m_activeCells.empty() || m_activeCells[cell] != 0;
+    }
+
+    /**
+     * Activation mask of the cells of the layer. Inactive cells skip the local and neighboring integration, hence their
+     * buffers and derivatives stay zero. The wave field of an active cell is never assumed to vanish again.
+     **/
+    std::vector<std::uint8_t> m_activeCells;
+    bool m_activeCellsInitialized = false;
+    std::atomic<unsigned> m_numberOfActiveCells{0};
+
 #ifndef ACL_DEVICE
+    //! Returns true if the dynamic rupture faces are visited ordered by their plus-side cells (SEISSOL_DR_FACE_ORDERING=1).
+    static bool useDynamicRuptureFaceOrdering();
+
+    /**
+     * Sorts the dynamic rupture faces of the layer by the address of the time derivatives of their plus side, such that
+     * consecutive faces read neighboring derivatives. The order of faces with the same plus side is kept.
+     **/
+    static std::vector<unsigned> computeDynamicRuptureFaceOrder(seissol::initializers::Layer& layerData,
+                                                                real** timeDerivativePlus);
+
+    //! Order of the dynamic rupture faces of the interior and copy layer
+    std::map<seissol::initializers::Layer const*, std::vector<unsigned>> m_dynamicRuptureFaceOrders;
+#endif // ACL_DEVICE
+
     template<bool usePlasticity>
     std::pair<long, long> computeNeighboringIntegrationImplementation(seissol::initializers::Layer& i_layerData,
                                                                       double subTimeStart) {
@@ -258,97 +495,175 @@ private:
 
       m_loopStatistics->begin(m_regionComputeNeighboringIntegration);
 
-      real* (*faceNeighbors)[4] = i_layerData.var(m_lts->faceNeighbors);
-      CellDRMapping (*drMapping)[4] = i_layerData.var(m_lts->drMapping);
-      CellLocalInformation* cellInformation = i_layerData.var(m_lts->cellInformation);
       PlasticityData* plasticity = i_layerData.var(m_lts->plasticity);
       real (*pstrain)[7 * NUMBER_OF_ALIGNED_BASIS_FUNCTIONS] = i_layerData.var(m_lts->pstrain);
-      unsigned numberOTetsWithPlasticYielding = 0;
 
       kernels::NeighborData::Loader loader;
       loader.load(*m_lts, i_layerData);
 
-      real *l_timeIntegrated[4];
-      real *l_faceNeighbors_prefetch[4];
+      // The face configuration of the cells does not change, hence the order is computed once
+      if (useNeighborBinning() && m_neighborCellOrder.size() != i_layerData.getNumberOfCells()) {
+        m_neighborCellOrder = computeNeighborCellOrder(i_layerData);
+      }
+      auto cellAt = [&](unsigned index) {
+        return m_neighborCellOrder.empty() ? index : m_neighborCellOrder[index];
+      };
 
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static) default(none) private(l_timeIntegrated, l_faceNeighbors_prefetch) shared(cellInformation, loader, faceNeighbors, pstrain, i_layerData, plasticity, drMapping, subTimeStart) reduction(+:numberOTetsWithPlasticYielding)
-#endif
-      for( unsigned int l_cell = 0; l_cell < i_layerData.getNumberOfCells(); l_cell++ ) {
-        auto data = loader.entry(l_cell);
-        seissol::kernels::TimeCommon::computeIntegrals(m_timeKernel,
-                                                       data.cellInformation.ltsSetup,
-                                                       data.cellInformation.faceTypes,
-                                                       subTimeStart,
-                                                       timeStepSize(),
-                                                       faceNeighbors[l_cell],
-#ifdef _OPENMP
-                                                       *reinterpret_cast<real (*)[4][tensor::I::size()]>(&(m_globalDataOnHost->integrationBufferLTS[omp_get_thread_num()*4*tensor::I::size()])),
-#else
-            *reinterpret_cast<real (*)[4][tensor::I::size()]>(m_globalData->integrationBufferLTS),
-#endif
-                                                       l_timeIntegrated);
-
-#ifdef ENABLE_MATRIX_PREFETCH
-        l_faceNeighbors_prefetch[0] = (cellInformation[l_cell].faceTypes[1] != FaceType::dynamicRupture) ?
-                                      faceNeighbors[l_cell][1] :
-                                      drMapping[l_cell][1].godunov;
-        l_faceNeighbors_prefetch[1] = (cellInformation[l_cell].faceTypes[2] != FaceType::dynamicRupture) ?
-                                      faceNeighbors[l_cell][2] :
-                                      drMapping[l_cell][2].godunov;
-        l_faceNeighbors_prefetch[2] = (cellInformation[l_cell].faceTypes[3] != FaceType::dynamicRupture) ?
-                                      faceNeighbors[l_cell][3] :
-                                      drMapping[l_cell][3].godunov;
-
-        // fourth face's prefetches
-        if (l_cell < (i_layerData.getNumberOfCells()-1) ) {
-          l_faceNeighbors_prefetch[3] = (cellInformation[l_cell+1].faceTypes[0] != FaceType::dynamicRupture) ?
-                                        faceNeighbors[l_cell+1][0] :
-                                        drMapping[l_cell+1][0].godunov;
-        } else {
-          l_faceNeighbors_prefetch[3] = faceNeighbors[l_cell][3];
-        }
-#endif
+      // Computes the neighbor integral of a cell and returns its degrees of freedom
+      auto computeNeighborsIntegral = [&](unsigned l_cell) {
+        return computeNeighborsIntegralOfCell(i_layerData, loader, l_cell, subTimeStart);
+      };
 
-        m_neighborKernel.computeNeighborsIntegral( data,
-                                                   drMapping[l_cell],
-#ifdef ENABLE_MATRIX_PREFETCH
-                                                   l_timeIntegrated, l_faceNeighbors_prefetch
-#else
-            l_timeIntegrated
-#endif
-        );
+      // Cells which pass the cheap yield check; only increased for the (few) cells close to yielding
+      std::atomic<unsigned> numberOfPlasticityChecks{0};
+      unsigned numberOTetsWithPlasticYielding = 0;
+      const bool useCellBlocks = usePlasticity && seissol::kernels::Plasticity::useCellBlocks();
+      if (useCellBlocks) {
+        // The yield check is vectorized over a block of cells, see Plasticity::computePlasticityBlock. It replaces
+        // the cheap check of the cells, which would only skip cells that the vectorized check rejects anyway.
+        constexpr unsigned blockSize = seissol::kernels::Plasticity::BlockSize;
+        const unsigned numberOfCells = i_layerData.getNumberOfCells();
+        const unsigned numberOfBlocks = (numberOfCells + blockSize - 1) / blockSize;
+        numberOTetsWithPlasticYielding = parallel::sumOverCells(numberOfBlocks, [&](unsigned block) {
+          real* blockDofs[blockSize];
+          PlasticityData const* blockPlasticity[blockSize];
+          real* blockPstrain[blockSize];
+          unsigned numberOfBlockCells = 0;
 
-        if constexpr (usePlasticity) {
           updateRelaxTime();
-          numberOTetsWithPlasticYielding += seissol::kernels::Plasticity::computePlasticity( m_oneMinusIntegratingFactor,
-                                                                                             timeStepSize(),
-                                                                                             m_tv,
-                                                                                             m_globalDataOnHost,
-                                                                                             &plasticity[l_cell],
-                                                                                             data.dofs,
-                                                                                             pstrain[l_cell] );
-        }
-#ifdef INTEGRATE_QUANTITIES
-        seissol::SeisSol::main.postProcessor().integrateQuantities( m_timeStepWidth,
-                                                              i_layerData,
-                                                              l_cell,
-                                                              dofs[l_cell] );
-#endif // INTEGRATE_QUANTITIES
+          const unsigned blockEnd = std::min(numberOfCells, (block + 1) * blockSize);
+          for (unsigned index = block * blockSize; index < blockEnd; ++index) {
+            const unsigned l_cell = cellAt(index);
+            real* cellDofs = computeNeighborsIntegral(l_cell);
+            // Only the cells of the plastic regions are packed into the block
+            if (seissol::kernels::Plasticity::isPlasticCell(&plasticity[l_cell])) {
+              blockDofs[numberOfBlockCells] = cellDofs;
+              blockPlasticity[numberOfBlockCells] = &plasticity[l_cell];
+              blockPstrain[numberOfBlockCells] = pstrain[l_cell];
+              ++numberOfBlockCells;
+            }
+          }
+
+          unsigned numberOfYieldingCells = 0;
+          if (numberOfBlockCells > 0) {
+            numberOfPlasticityChecks.fetch_add(numberOfBlockCells, std::memory_order_relaxed);
+            numberOfYieldingCells = seissol::kernels::Plasticity::computePlasticityBlock(m_oneMinusIntegratingFactor,
+                                                                                         timeStepSize(),
+                                                                                         m_tv,
+                                                                                         m_globalDataOnHost,
+                                                                                         numberOfBlockCells,
+                                                                                         blockPlasticity,
+                                                                                         blockDofs,
+                                                                                         blockPstrain);
+          }
+          return numberOfYieldingCells;
+        });
+      } else {
+        numberOTetsWithPlasticYielding = parallel::sumOverCells(i_layerData.getNumberOfCells(), [&](unsigned index) {
+          const unsigned l_cell = cellAt(index);
+          unsigned isPlasticallyYielding = 0;
+          real* cellDofs = computeNeighborsIntegral(l_cell);
+
+          if constexpr (usePlasticity) {
+            updateRelaxTime();
+            if (seissol::kernels::Plasticity::isPlasticCell(&plasticity[l_cell]) &&
+                seissol::kernels::Plasticity::isYieldingPossible(m_globalDataOnHost, &plasticity[l_cell], cellDofs)) {
+              numberOfPlasticityChecks.fetch_add(1, std::memory_order_relaxed);
+              isPlasticallyYielding = seissol::kernels::Plasticity::computePlasticity( m_oneMinusIntegratingFactor,
+                                                                                       timeStepSize(),
+                                                                                       m_tv,
+                                                                                       m_globalDataOnHost,
+                                                                                       &plasticity[l_cell],
+                                                                                       cellDofs,
+                                                                                       pstrain[l_cell] );
+            }
+          }
+          return isPlasticallyYielding;
+        });
       }
 
-      const long long nonZeroFlopsPlasticity =
-          i_layerData.getNumberOfCells() * m_flops_nonZero[static_cast<int>(ComputePart::PlasticityCheck)] +
-          numberOTetsWithPlasticYielding * m_flops_nonZero[static_cast<int>(ComputePart::PlasticityYield)];
-      const long long hardwareFlopsPlasticity =
-          i_layerData.getNumberOfCells() * m_flops_hardware[static_cast<int>(ComputePart::PlasticityCheck)] +
-          numberOTetsWithPlasticYielding * m_flops_hardware[static_cast<int>(ComputePart::PlasticityYield)];
-
       m_loopStatistics->end(m_regionComputeNeighboringIntegration, i_layerData.getNumberOfCells(), m_globalClusterId);
 
-      return {nonZeroFlopsPlasticity, hardwareFlopsPlasticity};
+      if constexpr (usePlasticity) {
+        return countPlasticityFlops(
+            numberOfPlasticCells(i_layerData), numberOfPlasticityChecks, numberOTetsWithPlasticYielding, !useCellBlocks);
+      }
+      return {0, 0};
+    }
+
+    template<bool usePlasticity>
+    std::pair<long, long> computeFusedIntegrationImplementation(seissol::initializers::Layer& layerData,
+                                                                double subTimeStart,
+                                                                bool resetBuffers,
+                                                                double nextCorrectionTime,
+                                                                double nextTimeStepSize) {
+      SCOREP_USER_REGION( "computeFusedIntegration", SCOREP_USER_REGION_TYPE_FUNCTION )
+
+      // The cell updates are counted by the local integration
+      m_loopStatistics->begin(m_regionComputeLocalIntegration);
+
+      PlasticityData* plasticity = layerData.var(m_lts->plasticity);
+      real (*pstrain)[7 * NUMBER_OF_ALIGNED_BASIS_FUNCTIONS] = layerData.var(m_lts->pstrain);
+
+      kernels::NeighborData::Loader neighborLoader;
+      neighborLoader.load(*m_lts, layerData);
+      kernels::LocalData::Loader localLoader;
+      localLoader.load(*m_lts, layerData);
+
+      const unsigned numberOfCells = layerData.getNumberOfCells();
+      if (m_fusedSchedule.offsets.size() != numberOfCells + 1) {
+        m_fusedSchedule = computeFusedSchedule(layerData);
+      }
+
+      auto predictCell = [&](unsigned cell) {
+        computeLocalIntegrationOfCell(layerData, localLoader, cell, resetBuffers, nextCorrectionTime, nextTimeStepSize);
+      };
+
+      std::atomic<unsigned> numberOfPlasticityChecks{0};
+      const unsigned numberOfBlocks = (numberOfCells + FusedBlockSize - 1) / FusedBlockSize;
+      const unsigned numberOTetsWithPlasticYielding = parallel::sumOverCells(numberOfBlocks, [&](unsigned block) {
+        unsigned numberOfYieldingCells = 0;
+        const unsigned blockEnd = std::min(numberOfCells, (block + 1) * FusedBlockSize);
+        for (unsigned cell = block * FusedBlockSize; cell < blockEnd; ++cell) {
+          real* cellDofs = computeNeighborsIntegralOfCell(layerData, neighborLoader, cell, subTimeStart);
+
+          if constexpr (usePlasticity) {
+            updateRelaxTime();
+            if (seissol::kernels::Plasticity::isPlasticCell(&plasticity[cell]) &&
+                seissol::kernels::Plasticity::isYieldingPossible(m_globalDataOnHost, &plasticity[cell], cellDofs)) {
+              numberOfPlasticityChecks.fetch_add(1, std::memory_order_relaxed);
+              numberOfYieldingCells += seissol::kernels::Plasticity::computePlasticity(m_oneMinusIntegratingFactor,
+                                                                                       timeStepSize(),
+                                                                                       m_tv,
+                                                                                       m_globalDataOnHost,
+                                                                                       &plasticity[cell],
+                                                                                       cellDofs,
+                                                                                       pstrain[cell]);
+            }
+          }
+
+          // The degrees of freedom of the predicted cells are still in the cache
+          for (unsigned i = m_fusedSchedule.offsets[cell]; i < m_fusedSchedule.offsets[cell + 1]; ++i) {
+            predictCell(m_fusedSchedule.cells[i]);
+          }
+        }
+        return numberOfYieldingCells;
+      });
+
+      parallel::forEachCell(m_fusedSchedule.deferred.size(), [&](unsigned index) {
+        predictCell(m_fusedSchedule.deferred[index]);
+      });
+
+      if (!m_activeCells.empty()) {
+        m_loopStatistics->count(m_counterActiveCells, m_numberOfActiveCells, numberOfCells);
+      }
+      m_loopStatistics->end(m_regionComputeLocalIntegration, numberOfCells, m_globalClusterId);
+
+      if constexpr (usePlasticity) {
+        return countPlasticityFlops(numberOfPlasticCells(layerData), numberOfPlasticityChecks, numberOTetsWithPlasticYielding);
+      }
+      return {0, 0};
     }
-#endif // ACL_DEVICE
 
     void computeLocalIntegrationFlops(unsigned numberOfCells,
                                       CellLocalInformation const* cellInformation,
@@ -402,6 +717,7 @@ public:
    * @param i_copyCellData cell data in the copy layer.
    * @param i_interiorCellData cell data in the interior.
    * @param i_cells degrees of freedom, time buffers, time derivatives.
+   * @param i_frictionSolver C++ friction solver or nullptr if the Fortran friction law is used.
    **/
   TimeCluster(unsigned int i_clusterId, unsigned int i_globalClusterId, bool usePlasticity,
               LayerType layerType, double maxTimeStepSize,
@@ -409,7 +725,8 @@ public:
               DynamicRuptureScheduler* dynamicRuptureScheduler, CompoundGlobalData i_globalData,
               seissol::initializers::Layer *i_clusterData, seissol::initializers::Layer* dynRupInteriorData,
               seissol::initializers::Layer* dynRupCopyData, seissol::initializers::LTS* i_lts,
-              seissol::initializers::DynamicRupture* i_dynRup, LoopStatistics* i_loopStatistics,
+              seissol::initializers::DynamicRupture* i_dynRup,
+              seissol::dr::friction_law::FrictionSolver* i_frictionSolver, LoopStatistics* i_loopStatistics,
               ActorStateStatistics* actorStateStatistics);
 
   /**
@@ -433,6 +750,16 @@ public:
     m_receiverCluster = receiverCluster;
   }
 
+  void addWaveFieldSampler( kernels::WaveFieldSampler* sampler );
+
+  void setEnergyOutput( writer::EnergyOutput* energyOutput ) {
+    m_energyOutput = energyOutput;
+  }
+
+  void setMomentRateOutput( writer::MomentRateOutput* momentRateOutput ) {
+    m_momentRateOutput = momentRateOutput;
+  }
+
   /**
    * Set Tv constant for plasticity.
    */
@@ -441,12 +768,53 @@ public:
     updateRelaxTime();
   }
 
+  /**
+   * Moves the integrations of this cluster from the device to the host (hybrid execution).
+   * The cells, buffers and derivatives stay in unified memory; the cluster synchronizes with the events of its
+   * neighbors before the host accesses them. Clusters with dynamic rupture faces stay on the device.
+   **/
+  void setExecuteOnHost(bool executeOnHost);
+  [[nodiscard]] bool executesOnHost() const { return m_executeOnHost; }
+
+  //! True if the cluster may run on the host, i.e. it has no dynamic rupture faces.
+  [[nodiscard]] bool mayExecuteOnHost() const;
+
+  [[nodiscard]] bool hasDynamicRuptureFaces() const;
+
+#ifdef ACL_DEVICE
+  /**
+   * Moves the integrations of this cluster to another device of the rank (see MPI::getDeviceIDs).
+   * The cluster gets a stream on this device, uses the given global data, and the unified cell data of its layer
+   * migrates to the device. The halo of the neighboring clusters is read from their devices.
+   * Requires an own stream per cluster and no dynamic rupture faces.
+   **/
+  void setDevice(int deviceId, CompoundGlobalData globalData);
+#endif
+
 
   void reset() override;
 
+  /**
+   * Returns true if the kernels are replaced by a sleep of SEISSOL_COMMUNICATION_SKELETON_CELL_TIME seconds per cell
+   * in each prediction and correction (SEISSOL_COMMUNICATION_SKELETON=1). The actors, the exchange of the ghost
+   * layers and the synchronization points run as usual, but the wave field is not computed.
+   **/
+  static bool useCommunicationSkeleton();
+
   [[nodiscard]] unsigned int getClusterId() const;
   [[nodiscard]] unsigned int getGlobalClusterId() const;
   [[nodiscard]] LayerType getLayerType() const;
+  [[nodiscard]] const RooflineCounters& getRooflineCounters(RooflineKernel kernel) const;
+  [[nodiscard]] unsigned getNumberOfCells() const;
+
+  /**
+   * Hardware flops of one update without the data-dependent plasticity.
+   * The interior dynamic rupture faces are attributed to the interior layer.
+   **/
+  [[nodiscard]] long long getHardwareFlopsPerUpdate() const;
+
+  //! Bytes of the cell data which is read or written in every time step (dofs, matrices, buffers and derivatives)
+  [[nodiscard]] std::size_t getWorkingSetBytes() const;
   void setReceiverTime(double receiverTime);
 };
 
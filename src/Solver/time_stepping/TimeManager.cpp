@@ -46,6 +46,30 @@
 #include <Initializer/preProcessorMacros.fpp>
 #include <Initializer/time_stepping/common.hpp>
 #include "SeisSol.h"
+#include <Geometry/MeshReader.h>
+#include <ResultWriter/EnergyOutput.h>
+#include <ResultWriter/MomentRateOutput.h>
+#include <Monitoring/Roofline.h>
+#include <Monitoring/ScalingReport.h>
+#include <Monitoring/StartupEstimate.h>
+#include <Parallel/Tasking.h>
+#include <Initializer/Hash.h>
+#include <utils/env.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <numeric>
+#include <sstream>
+#include <tuple>
+#include <unistd.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 seissol::time_stepping::TimeManager::TimeManager():
   m_logUpdates(std::numeric_limits<unsigned int>::max())
@@ -56,6 +80,8 @@ seissol::time_stepping::TimeManager::TimeManager():
   m_loopStatistics.addRegion("stateCorrected");
   m_loopStatistics.addRegion("statePredicted");
   m_loopStatistics.addRegion("stateSynced");
+  m_loopStatistics.addCounter("dynamicRuptureActiveFaces");
+  m_loopStatistics.addCounter("activeCells");
 
   actorStateStatisticsManager = ActorStateStatisticsManager();
 }
@@ -69,12 +95,27 @@ void seissol::time_stepping::TimeManager::addClusters(TimeStepping& i_timeSteppi
                                                       bool usePlasticity) {
   SCOREP_USER_REGION( "addClusters", SCOREP_USER_REGION_TYPE_FUNCTION );
   std::vector<std::unique_ptr<GhostTimeCluster>> ghostClusters;
+  StartupEstimate startupEstimate;
   // assert non-zero pointers
   assert( i_meshStructure         != NULL );
 
   // store the time stepping
   m_timeStepping = i_timeStepping;
 
+  if (TimeCluster::useCommunicationSkeleton()) {
+    logWarning(MPI::mpi.rank()) << "Communication skeleton: the kernels are replaced by"
+                                << utils::Env::get<double>("SEISSOL_COMMUNICATION_SKELETON_CELL_TIME", 0.0)
+                                << "s of sleep per cell, the wave field is not computed.";
+  }
+
+  MessageAggregator* aggregator = nullptr;
+#ifdef USE_MPI
+  if (initializers::MemoryManager::useMessageAggregation()) {
+    messageAggregator = std::make_unique<MessageAggregator>(MPI::mpi.comm());
+    aggregator = messageAggregator.get();
+  }
+#endif
+
   // iterate over local time clusters
   for (unsigned int localClusterId = 0; localClusterId < m_timeStepping.numberOfLocalClusters; localClusterId++) {
     // get memory layout of this cluster
@@ -94,6 +135,10 @@ void seissol::time_stepping::TimeManager::addClusters(TimeStepping& i_timeSteppi
         dynRupTree.child(Ghost).getNumberOfCells();
 
     auto& drScheduler = dynamicRuptureSchedulers.emplace_back(std::make_unique<DynamicRuptureScheduler>(numberOfDynRupCells));
+#ifdef ACL_DEVICE
+    drScheduler->interiorPipeline.getTuner().setNumberOfFaces(dynRupTree.child(Interior).getNumberOfCells());
+    drScheduler->copyPipeline.getTuner().setNumberOfFaces(dynRupTree.child(Copy).getNumberOfCells());
+#endif
 
     for (auto type : {Copy, Interior}) {
       const auto offsetMonitoring = type == Interior ? 0 : m_timeStepping.numberOfGlobalClusters;
@@ -115,13 +160,25 @@ void seissol::time_stepping::TimeManager::addClusters(TimeStepping& i_timeSteppi
           &dynRupTree.child(Copy),
           memoryManager.getLts(),
           memoryManager.getDynamicRupture(),
+          memoryManager.getFrictionSolver(),
           &m_loopStatistics,
           &actorStateStatisticsManager.addCluster(l_globalClusterId + offsetMonitoring))
       );
+      if (actorTrace.enabled()) {
+        clusters.back()->setTraceRecorder(&actorTrace.addActor(type == Interior ? "interior" : "copy", l_globalClusterId));
+      }
     }
     auto& interior = clusters[clusters.size() - 1];
     auto& copy = clusters[clusters.size() - 2];
 
+    // the copy cells are sent after every update of the cluster
+    double communicatedBytes = 0.0;
+    for (unsigned region = 0; region < meshStructure->numberOfRegions; ++region) {
+      communicatedBytes += meshStructure->copyRegionSizes[region] * sizeof(real);
+    }
+    startupEstimate.addCluster(timeStepSize, interior->getNumberOfCells(), interior->getHardwareFlopsPerUpdate(), 0.0);
+    startupEstimate.addCluster(timeStepSize, copy->getNumberOfCells(), copy->getHardwareFlopsPerUpdate(), communicatedBytes);
+
     // Mark copy layers as higher priority layers.
     interior->setPriority(ActorPriority::Low);
     copy->setPriority(ActorPriority::High);
@@ -166,8 +223,13 @@ void seissol::time_stepping::TimeManager::addClusters(TimeStepping& i_timeSteppi
               otherTimeStepRate,
               globalClusterId,
               otherGlobalClusterId,
-              meshStructure)
+              meshStructure,
+              &actorStateStatisticsManager.addGhostCluster(),
+              aggregator)
         );
+        if (actorTrace.enabled()) {
+          ghostClusters.back()->setTraceRecorder(&actorTrace.addActor("ghost", globalClusterId, otherGlobalClusterId));
+        }
         // Connect with previous copy layer.
         ghostClusters.back()->connect(*copy);
       }
@@ -189,6 +251,8 @@ void seissol::time_stepping::TimeManager::addClusters(TimeStepping& i_timeSteppi
     }
   }
 
+  selectTemporalBlocks();
+
   std::sort(ghostClusters.begin(), ghostClusters.end(), rateSorter);
 
 #ifdef USE_COMM_THREAD
@@ -203,11 +267,28 @@ void seissol::time_stepping::TimeManager::addClusters(TimeStepping& i_timeSteppi
 
   if (useCommthread) {
     communicationManager = std::make_unique<ThreadedCommunicationManager>(std::move(ghostClusters),
-                                                                          &seissol::SeisSol::main.getPinning()
+                                                                          &seissol::SeisSol::main.getPinning(),
+                                                                          aggregator
                                                                           );
   } else {
-    communicationManager = std::make_unique<SerialCommunicationManager>(std::move(ghostClusters));
+    communicationManager = std::make_unique<SerialCommunicationManager>(std::move(ghostClusters), aggregator);
+  }
+
+  if (useTasking()) {
+    logInfo(MPI::mpi.rank()) << "Executing the time clusters as OpenMP tasks.";
+  } else if (usePersistentRegion()) {
+    logInfo(MPI::mpi.rank()) << "Executing the time clusters in a persistent OpenMP parallel region.";
+  } else if (parallel::useTasking()) {
+    logWarning(MPI::mpi.rank()) << "Tasking requires at least two OpenMP threads and is not supported on GPUs."
+                                << "Executing the time clusters in a fixed order.";
   }
+#ifdef ACL_DEVICE
+  loadDrPipelineTuning();
+  assignHybridExecution();
+  assignDevices(memoryManager);
+#endif
+  startupEstimate.report();
+  m_loopStatistics.openHardwareCounters();
 }
 
 
@@ -241,16 +322,124 @@ void seissol::time_stepping::TimeManager::advanceInTime(const double &synchroniz
     assert(cluster->getState() == ActorState::Corrected);
   }
 
+  if (useTasking()) {
+    advanceClustersAsTasks();
+  } else if (usePersistentRegion()) {
+    parallel::PersistentRegion::run([this]() { advanceClustersByPolling(); });
+  } else {
+    advanceClustersByPolling();
+  }
+#ifdef ACL_DEVICE
+  // clusters with an own stream do not wait for their last integration
+  for (int deviceId : MPI::mpi.getDeviceIDs()) {
+    device.api->setDevice(deviceId);
+    device.api->synchDevice();
+  }
+  device.api->setDevice(MPI::mpi.getDeviceID());
+  device.api->popLastProfilingMark();
+#endif
+  writeSampledWaveFields();
+}
+
+void seissol::time_stepping::TimeManager::selectTemporalBlocks() {
+#ifndef ACL_DEVICE
+  if (!utils::Env::get<bool>("SEISSOL_TEMPORAL_BLOCKING", false)) {
+    return;
+  }
+  const int rank = MPI::mpi.rank();
+  long defaultCacheBytes = sysconf(_SC_LEVEL3_CACHE_SIZE);
+  if (defaultCacheBytes <= 0) {
+    defaultCacheBytes = sysconf(_SC_LEVEL2_CACHE_SIZE);
+  }
+  const auto cacheBytes = utils::Env::get<std::size_t>("SEISSOL_TEMPORAL_BLOCKING_CACHE",
+                                                       static_cast<std::size_t>(std::max(defaultCacheBytes, 0L)));
+  if (cacheBytes == 0) {
+    logWarning(rank) << "Unknown cache size, set SEISSOL_TEMPORAL_BLOCKING_CACHE for temporal blocking.";
+    return;
+  }
+
+  // The slowest cluster limits all other clusters, blocking it would not change the order of the steps
+  for (unsigned localClusterId = 0; localClusterId + 1 < m_timeStepping.numberOfLocalClusters; ++localClusterId) {
+    const unsigned globalClusterId = m_timeStepping.clusterIds[localClusterId];
+    std::vector<TimeCluster*> block;
+    std::size_t workingSetBytes = 0;
+    for (auto& cluster : clusters) {
+      if (cluster->getGlobalClusterId() == globalClusterId) {
+        block.push_back(cluster.get());
+        workingSetBytes += cluster->getWorkingSetBytes();
+      }
+    }
+    if (workingSetBytes > cacheBytes) {
+      continue;
+    }
+    // The copy layer first, as the neighboring ranks wait for it
+    std::sort(block.begin(), block.end(), [](auto* a, auto* b) {
+      return a->getPriority() == ActorPriority::High && b->getPriority() != ActorPriority::High;
+    });
+    for (auto* prioClusters : {&highPrioClusters, &lowPrioClusters}) {
+      prioClusters->erase(std::remove_if(prioClusters->begin(), prioClusters->end(), [&](auto* cluster) {
+        return std::find(block.begin(), block.end(), cluster) != block.end();
+      }), prioClusters->end());
+    }
+    temporalBlocks.push_back(std::move(block));
+    logInfo(rank) << "Temporal blocking of cluster" << globalClusterId << "with"
+                  << static_cast<double>(workingSetBytes) / (1024.0 * 1024.0) << "MiB.";
+  }
+#endif
+}
+
+bool seissol::time_stepping::TimeManager::advanceTemporalBlock(std::vector<TimeCluster*> const& block,
+                                                                bool progressCommunication) {
+  bool acted = false;
+  bool advanced = true;
+  while (advanced) {
+    advanced = false;
+    for (auto* cluster : block) {
+      const auto action = cluster->getNextLegalAction();
+      if (action == ActorAction::Predict || action == ActorAction::Correct ||
+          action == ActorAction::CorrectAndPredict) {
+        cluster->act();
+        advanced = true;
+        if (progressCommunication) {
+          communicationManager->progression();
+        }
+      }
+    }
+    acted |= advanced;
+  }
+  return acted;
+}
+
+bool seissol::time_stepping::TimeManager::useTasking() {
+#if defined(_OPENMP) && !defined(ACL_DEVICE)
+  return parallel::useTasking() && omp_get_max_threads() > 1;
+#else
+  return false;
+#endif
+}
+
+bool seissol::time_stepping::TimeManager::usePersistentRegion() {
+#if defined(_OPENMP) && !defined(ACL_DEVICE)
+  return !useTasking() && parallel::PersistentRegion::enabled() && omp_get_max_threads() > 1;
+#else
+  return false;
+#endif
+}
+
+void seissol::time_stepping::TimeManager::advanceClustersByPolling() {
   bool finished = false; // Is true, once all clusters reached next sync point
   while (!finished) {
     finished = true;
     communicationManager->progression();
 
     // Update all high priority clusters
+    // The copy layers are predicted first and the ghost clusters are progressed right afterwards,
+    // such that the sends are posted before the interior is computed.
     std::for_each(highPrioClusters.begin(), highPrioClusters.end(), [&](auto& cluster) {
       if (cluster->getNextLegalAction() == ActorAction::Predict) {
         communicationManager->progression();
         cluster->act();
+        communicationManager->progression();
       }
     });
     std::for_each(highPrioClusters.begin(), highPrioClusters.end(), [&](auto& cluster) {
@@ -279,14 +468,109 @@ void seissol::time_stepping::TimeManager::advanceInTime(const double &synchroniz
       (*correctable)->act();
     } else {
     }
+
+    // The substeps of the cache-resident clusters are computed back-to-back, the cells stay on the same threads
+    for (auto& block : temporalBlocks) {
+      advanceTemporalBlock(block, true);
+      for (auto* cluster : block) {
+        if (cluster->getNextLegalAction() == ActorAction::Sync) {
+          cluster->act();
+        }
+      }
+    }
     finished = std::all_of(clusters.begin(), clusters.end(),
                            [](auto& c) {
       return c->synced();
     });
     finished &= communicationManager->checkIfFinished();
+
+    // Sampled wave field outputs are written while the clusters advance to the next synchronization point
+    writeSampledWaveFields();
+  }
+}
+
+void seissol::time_stepping::TimeManager::advanceClustersAsTasks() {
+#ifdef _OPENMP
+  // High priority clusters are considered first, such that their tasks are created first.
+  std::vector<TimeCluster*> actors(highPrioClusters);
+  actors.insert(actors.end(), lowPrioClusters.begin(), lowPrioClusters.end());
+  // An actor is busy while one of its actions is executed by a task.
+  std::vector<std::atomic<bool>> isBusy(actors.size());
+  for (auto& busy : isBusy) {
+    busy.store(false);
+  }
+  std::vector<std::atomic<bool>> isBlockBusy(temporalBlocks.size());
+  for (auto& busy : isBlockBusy) {
+    busy.store(false);
+  }
+  TimeManager* manager = this;
+
+#pragma omp parallel default(shared)
+  {
+    // The master thread only schedules the actors and progresses the communication, such that
+    // MPI is called from it only. All other threads execute the actions and their cell ranges
+    // (see parallel::forEachCell), hence idle threads may steal cells of any cluster.
+#pragma omp master
+    {
+      bool finished = false;
+      while (!finished) {
+        communicationManager->progression();
+        for (std::size_t i = 0; i < actors.size(); ++i) {
+          if (isBusy[i].load(std::memory_order_acquire)) {
+            continue;
+          }
+          TimeCluster* cluster = actors[i];
+          const auto action = cluster->getNextLegalAction();
+          if (action == ActorAction::Predict || action == ActorAction::Correct ||
+              action == ActorAction::CorrectAndPredict) {
+            isBusy[i].store(true, std::memory_order_relaxed);
+            std::atomic<bool>* busy = &isBusy[i];
+            // Copy layers first, as the ghost clusters of the neighboring ranks wait for them.
+            const int priority = cluster->getPriority() == ActorPriority::High ? 1 : 0;
+#pragma omp task default(none) firstprivate(cluster, busy) priority(priority)
+            {
+              cluster->act();
+              busy->store(false, std::memory_order_release);
+            }
+          } else if (action == ActorAction::Sync) {
+            cluster->act();
+          }
+        }
+        // A temporal block is advanced by one task, which computes its substeps back-to-back
+        for (std::size_t i = 0; i < temporalBlocks.size(); ++i) {
+          if (isBlockBusy[i].load(std::memory_order_acquire)) {
+            continue;
+          }
+          std::vector<TimeCluster*>* block = &temporalBlocks[i];
+          bool mayAdvance = false;
+          for (auto* cluster : *block) {
+            const auto action = cluster->getNextLegalAction();
+            if (action == ActorAction::Sync) {
+              cluster->act();
+            } else if (action != ActorAction::Nothing) {
+              mayAdvance = true;
+            }
+          }
+          if (mayAdvance) {
+            isBlockBusy[i].store(true, std::memory_order_relaxed);
+            std::atomic<bool>* busy = &isBlockBusy[i];
+            const int priority = block->front()->getPriority() == ActorPriority::High ? 1 : 0;
+#pragma omp task default(none) firstprivate(manager, block, busy) priority(priority)
+            {
+              manager->advanceTemporalBlock(*block, false);
+              busy->store(false, std::memory_order_release);
+            }
+          }
+        }
+        finished = std::all_of(clusters.begin(), clusters.end(),
+                               [](auto& c) {
+          return c->synced();
+        });
+        finished &= communicationManager->checkIfFinished();
+      }
+#pragma omp taskwait
+    }
   }
-#ifdef ACL_DEVICE
-  device.api->popLastProfilingMark();
 #endif
 }
 
@@ -295,8 +579,301 @@ void seissol::time_stepping::TimeManager::printComputationTime()
   actorStateStatisticsManager.addToLoopStatistics(m_loopStatistics);
 #ifdef USE_MPI
   m_loopStatistics.printSummary(MPI::mpi.comm());
+  actorStateStatisticsManager.printOverlap(MPI::mpi.rank());
+  if (initializers::MemoryManager::useCompressedHalo()) {
+    actorStateStatisticsManager.printHaloCompressionError(MPI::mpi.rank());
+  }
+  const auto communicationReport = utils::Env::get<std::string>("SEISSOL_COMMUNICATION_REPORT", "");
+  if (TimeCluster::useCommunicationSkeleton() || !communicationReport.empty()) {
+    actorStateStatisticsManager.reportRegionCommunication(communicationReport);
+  }
+  if (messageAggregator != nullptr) {
+    const auto [numberOfRegions, numberOfMessages] = messageAggregator->statistics();
+    logInfo(MPI::mpi.rank()) << "Aggregated" << numberOfRegions << "copy regions into" << numberOfMessages << "messages.";
+  }
 #endif
+  printRoofline();
   m_loopStatistics.writeSamples();
+  actorTrace.write();
+}
+
+void seissol::time_stepping::TimeManager::printRoofline() {
+  // The same entries on all ranks, including the clusters and layers which are empty on this rank
+  std::vector<RooflineEntry> entries;
+  for (unsigned cluster = 0; cluster < m_timeStepping.numberOfGlobalClusters; ++cluster) {
+    for (auto const layer : {Interior, Copy}) {
+      for (auto const kernel : {RooflineKernel::Local, RooflineKernel::Neighbor}) {
+        RooflineEntry entry;
+        entry.cluster = cluster;
+        entry.layer = layer == Interior ? "interior" : "copy";
+        entry.kernel = kernel;
+        for (auto const& timeCluster : clusters) {
+          if (timeCluster->getGlobalClusterId() == cluster && timeCluster->getLayerType() == layer) {
+            entry.counters = timeCluster->getRooflineCounters(kernel);
+          }
+        }
+        entries.push_back(entry);
+      }
+    }
+  }
+  Roofline().report(std::move(entries));
+}
+
+void seissol::time_stepping::TimeManager::writeScalingReport(double wallTime, double simulatedTime) {
+  ScalingReport report;
+  if (!report.enabled()) {
+    return;
+  }
+  ScalingSample sample;
+  sample.cells = seissol::SeisSol::main.meshReader().getElements().size();
+  sample.cellUpdates = m_loopStatistics.getNumberOfIterations(m_loopStatistics.getRegion("computeLocalIntegration"));
+  sample.wallTime = wallTime;
+  std::tie(sample.computeTime, sample.communicationTime, sample.communicationWait) =
+      actorStateStatisticsManager.getTotalTimes();
+
+  const auto timeSteps =
+      static_cast<unsigned long>(std::llround(simulatedTime / m_timeStepping.globalCflTimeStepWidths[0]));
+  report.write(sample, timeSteps, simulatedTime, m_timeStepping.numberOfGlobalClusters);
+}
+
+#ifdef ACL_DEVICE
+std::string seissol::time_stepping::TimeManager::drPipelineCacheFile(std::string& fingerprint) {
+  static std::string const directory = utils::Env::get("SEISSOL_DR_PIPELINE_CACHE", "");
+  if (directory.empty()) {
+    return {};
+  }
+  device::DeviceInstance& device = device::DeviceInstance::getInstance();
+  std::ostringstream key;
+  key << "device=" << device.api->getDeviceInfoAsText(device.api->getDeviceId())
+      << ";order=" << CONVERGENCE_ORDER
+      << ";quantities=" << NUMBER_OF_QUANTITIES
+      << ";real=" << sizeof(real);
+  fingerprint = key.str();
+  std::replace(fingerprint.begin(), fingerprint.end(), '\n', ' ');
+
+  std::ostringstream name;
+  name << directory << "/drpipeline-" << std::hex << std::setw(16) << std::setfill('0')
+       << initializers::hashBytes(fingerprint.data(), fingerprint.size()) << std::dec << "-"
+       << MPI::mpi.rank() << "of" << MPI::mpi.size() << ".txt";
+  return name.str();
+}
+
+namespace {
+//! Hardware flops per unit of simulated time; a cluster with twice the time step rate updates half as often
+double workOf(seissol::time_stepping::TimeCluster& cluster) {
+  return static_cast<double>(cluster.getHardwareFlopsPerUpdate()) / cluster.getTimeStepRate();
+}
+} // namespace
+
+void seissol::time_stepping::TimeManager::assignHybridExecution() {
+  const double hostShare = utils::Env::get<double>("SEISSOL_HYBRID_HOST_SHARE", 0.0);
+  if (hostShare <= 0.0) {
+    return;
+  }
+
+  double totalWork = 0.0;
+  std::vector<TimeCluster*> candidates;
+  for (auto& cluster : clusters) {
+    totalWork += workOf(*cluster);
+    if (cluster->mayExecuteOnHost()) {
+      candidates.push_back(cluster.get());
+    }
+  }
+
+  // The small clusters barely occupy the device, hence they go to the host first
+  std::stable_sort(candidates.begin(), candidates.end(), [](TimeCluster* a, TimeCluster* b) {
+    return a->getNumberOfCells() < b->getNumberOfCells();
+  });
+  double hostWork = 0.0;
+  unsigned numberOfHostClusters = 0;
+  for (auto* cluster : candidates) {
+    const double work = workOf(*cluster);
+    if (hostWork + work > hostShare * totalWork) {
+      break;
+    }
+    cluster->setExecuteOnHost(true);
+    hostWork += work;
+    ++numberOfHostClusters;
+  }
+
+  logInfo(MPI::mpi.rank()) << "Hybrid execution:" << numberOfHostClusters << "of" << clusters.size()
+                           << "clusters run on the host with"
+                           << (totalWork > 0.0 ? 100.0 * hostWork / totalWork : 0.0) << "% of the work.";
+}
+
+void seissol::time_stepping::TimeManager::assignDevices(initializers::MemoryManager& memoryManager) {
+  const auto& deviceIds = MPI::mpi.getDeviceIDs();
+  if (deviceIds.size() <= 1) {
+    return;
+  }
+  if (!kernels::DeviceContext::clusterStreamsEnabled()) {
+    logWarning(MPI::mpi.rank()) << "Several devices per rank require SEISSOL_DEVICE_CLUSTER_STREAMS=1."
+                                << "All clusters run on device" << deviceIds.front();
+    return;
+  }
+
+  std::vector<double> deviceWork(deviceIds.size(), 0.0);
+  std::vector<TimeCluster*> movable;
+  for (auto& cluster : clusters) {
+    if (cluster->executesOnHost()) {
+      continue;
+    }
+    if (cluster->hasDynamicRuptureFaces()) {
+      deviceWork[0] += workOf(*cluster);
+    } else {
+      movable.push_back(cluster.get());
+    }
+  }
+
+  // Largest work first, each to the device with the least work so far
+  std::stable_sort(movable.begin(), movable.end(), [&](TimeCluster* a, TimeCluster* b) {
+    return workOf(*a) > workOf(*b);
+  });
+  for (auto* cluster : movable) {
+    const auto device = std::distance(deviceWork.begin(), std::min_element(deviceWork.begin(), deviceWork.end()));
+    deviceWork[device] += workOf(*cluster);
+    if (device > 0) {
+      cluster->setDevice(deviceIds[device], memoryManager.getGlobalData(device));
+    }
+  }
+
+  const double totalWork = std::accumulate(deviceWork.begin(), deviceWork.end(), 0.0);
+  for (std::size_t device = 0; device < deviceIds.size(); ++device) {
+    logInfo(MPI::mpi.rank()) << "Device" << deviceIds[device] << "computes"
+                             << (totalWork > 0.0 ? 100.0 * deviceWork[device] / totalWork : 0.0)
+                             << "% of the work of the device clusters.";
+  }
+}
+
+void seissol::time_stepping::TimeManager::loadDrPipelineTuning() {
+  std::string fingerprint;
+  std::string const fileName = drPipelineCacheFile(fingerprint);
+  if (fileName.empty()) {
+    return;
+  }
+  std::ifstream file(fileName);
+  std::string storedFingerprint;
+  // A hash collision must not mix up different devices
+  if (!std::getline(file, storedFingerprint) || storedFingerprint != fingerprint) {
+    return;
+  }
+
+  std::string layer;
+  unsigned globalClusterId = 0;
+  size_t faces = 0;
+  double batchSize = 0.0;
+  while (file >> globalClusterId >> layer >> faces >> batchSize) {
+    for (unsigned localClusterId = 0; localClusterId < m_timeStepping.numberOfLocalClusters; ++localClusterId) {
+      if (m_timeStepping.clusterIds[localClusterId] != globalClusterId) {
+        continue;
+      }
+      auto& scheduler = *dynamicRuptureSchedulers[localClusterId];
+      auto& tuner = (layer == "copy") ? scheduler.copyPipeline.getTuner() : scheduler.interiorPipeline.getTuner();
+      // The batch size was tuned for another mesh or partition otherwise
+      if (tuner.getNumberOfFaces() == faces && batchSize >= 1.0) {
+        tuner.setBatchSize(batchSize);
+      }
+    }
+  }
+  logInfo(MPI::mpi.rank()) << "Read the DR pipeline batch sizes from" << fileName;
+}
+#endif
+
+void seissol::time_stepping::TimeManager::storeDrPipelineTuning() {
+#ifdef ACL_DEVICE
+  int const rank = MPI::mpi.rank();
+  std::ostringstream entries;
+  for (unsigned localClusterId = 0; localClusterId < m_timeStepping.numberOfLocalClusters; ++localClusterId) {
+    const auto globalClusterId = m_timeStepping.clusterIds[localClusterId];
+    auto& scheduler = *dynamicRuptureSchedulers[localClusterId];
+    for (auto [layer, pipeline] : {std::make_pair("interior", &scheduler.interiorPipeline),
+                                   std::make_pair("copy", &scheduler.copyPipeline)}) {
+      auto& tuner = pipeline->getTuner();
+      // Pipelines which never ran (no faces or friction laws on the device) have nothing to report
+      if (tuner.getNumberOfFaces() == 0 || !tuner.isTunerConverged()) {
+        continue;
+      }
+      logInfo(rank) << "DR pipeline of cluster" << globalClusterId << "(" << layer << "," << tuner.getNumberOfFaces()
+                    << "faces): batch size" << tuner.getBatchSize();
+      entries << globalClusterId << " " << layer << " " << tuner.getNumberOfFaces() << " " << tuner.getBatchSize()
+              << "\n";
+    }
+  }
+
+  std::string fingerprint;
+  std::string const fileName = drPipelineCacheFile(fingerprint);
+  if (fileName.empty() || entries.str().empty()) {
+    return;
+  }
+  std::string const temporaryFile = fileName + ".tmp";
+  {
+    std::ofstream file(temporaryFile, std::ios::trunc);
+    file << fingerprint << "\n" << entries.str();
+    if (!file) {
+      logWarning(rank) << "Could not write the DR pipeline cache" << fileName;
+      return;
+    }
+  }
+  if (std::rename(temporaryFile.c_str(), fileName.c_str()) != 0) {
+    logWarning(rank) << "Could not write the DR pipeline cache" << fileName;
+  }
+#endif
+}
+
+std::vector<double> seissol::time_stepping::TimeManager::getMeasuredCellCosts() {
+  const auto& ltsLayout = seissol::SeisSol::main.getLtsLayout();
+  const auto numberOfCells = seissol::SeisSol::main.meshReader().getElements().size();
+  const auto numberOfClusters = m_timeStepping.numberOfGlobalClusters;
+
+  std::vector<double> clusterTimes(numberOfClusters, 0.0);
+  for (auto const* name : {"computeLocalIntegration", "computeNeighboringIntegration", "computeDynamicRupture"}) {
+    const auto times = m_loopStatistics.getTimePerSubRegion(m_loopStatistics.getRegion(name), numberOfClusters);
+    for (unsigned cluster = 0; cluster < numberOfClusters; ++cluster) {
+      clusterTimes[cluster] += times[cluster];
+    }
+  }
+
+  std::vector<unsigned> clusterSizes(numberOfClusters, 0);
+  for (unsigned cell = 0; cell < numberOfCells; ++cell) {
+    ++clusterSizes[ltsLayout.getGlobalClusterId(cell)];
+  }
+
+  std::vector<double> cellCosts(numberOfCells);
+  for (unsigned cell = 0; cell < numberOfCells; ++cell) {
+    const auto cluster = ltsLayout.getGlobalClusterId(cell);
+    cellCosts[cell] = clusterTimes[cluster] / clusterSizes[cluster];
+  }
+  return cellCosts;
+}
+
+void seissol::time_stepping::TimeManager::addToTelemetrySample(TelemetrySample& sample) {
+  const auto numberOfClusters = m_timeStepping.numberOfGlobalClusters;
+  sample.regions = m_loopStatistics.getRegions();
+  sample.timePerCluster.clear();
+  for (unsigned region = 0; region < sample.regions.size(); ++region) {
+    sample.timePerCluster.push_back(m_loopStatistics.getTimePerSubRegion(region, numberOfClusters));
+  }
+  sample.cellUpdates = m_loopStatistics.getNumberOfIterations(m_loopStatistics.getRegion("computeLocalIntegration"));
+
+  const auto [communicationTime, exposedCommunicationTime] = actorStateStatisticsManager.takeCommunicationTime();
+  sample.communicationTime += communicationTime;
+  sample.exposedCommunicationTime += exposedCommunicationTime;
+}
+
+void seissol::time_stepping::TimeManager::checkStragglers(StragglerMonitor& monitor) {
+  if (!monitor.enabled()) {
+    return;
+  }
+  double computeTime = 0.0;
+  for (const auto* name : {"computeLocalIntegration", "computeNeighboringIntegration"}) {
+    for (const double time : m_loopStatistics.getTimePerSubRegion(m_loopStatistics.getRegion(name),
+                                                                  m_timeStepping.numberOfGlobalClusters)) {
+      computeTime += time;
+    }
+  }
+  const double cellUpdates =
+      m_loopStatistics.getNumberOfIterations(m_loopStatistics.getRegion("computeLocalIntegration"));
+  monitor.check(computeTime, cellUpdates);
 }
 
 double seissol::time_stepping::TimeManager::getTimeTolerance() {
@@ -323,6 +900,34 @@ void seissol::time_stepping::TimeManager::setReceiverClusters(writer::ReceiverWr
   }
 }
 
+void seissol::time_stepping::TimeManager::addSampledWaveFieldWriter(writer::WaveFieldWriter& waveFieldWriter)
+{
+  for (auto& cluster : clusters) {
+    cluster->addWaveFieldSampler(&waveFieldWriter.sampler());
+  }
+  sampledWaveFieldWriters.push_back(&waveFieldWriter);
+}
+
+void seissol::time_stepping::TimeManager::setEnergyOutput(writer::EnergyOutput& energyOutput)
+{
+  for (auto& cluster : clusters) {
+    cluster->setEnergyOutput(&energyOutput);
+  }
+}
+
+void seissol::time_stepping::TimeManager::setMomentRateOutput(writer::MomentRateOutput& momentRateOutput)
+{
+  for (auto& cluster : clusters) {
+    cluster->setMomentRateOutput(&momentRateOutput);
+  }
+}
+
+void seissol::time_stepping::TimeManager::writeSampledWaveFields() {
+  for (auto* waveFieldWriter : sampledWaveFieldWriters) {
+    waveFieldWriter->writeSampledSnapshots();
+  }
+}
+
 void seissol::time_stepping::TimeManager::setInitialTimes( double i_time ) {
   assert( i_time >= 0 );
 
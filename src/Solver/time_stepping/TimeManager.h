@@ -46,6 +46,7 @@
 #include <list>
 #include <cassert>
 #include <memory>
+#include <string>
 
 #include <Initializer/typedefs.hpp>
 #include <SourceTerm/typedefs.hpp>
@@ -55,10 +56,19 @@
 #include <Solver/FreeSurfaceIntegrator.h>
 #include <ResultWriter/ReceiverWriter.h>
 #include "TimeCluster.h"
+#include "Monitoring/ActorTrace.h"
 #include "Monitoring/Stopwatch.h"
+#include "Monitoring/Telemetry.h"
+#include "Monitoring/StragglerMonitor.h"
 #include "GhostTimeCluster.h"
+#include "MessageAggregator.h"
 
 namespace seissol {
+  namespace writer {
+    class WaveFieldWriter;
+    class EnergyOutput;
+    class MomentRateOutput;
+  }
   namespace time_stepping {
     class TimeManager;
     class AbstractCommunicationManager;
@@ -109,12 +119,71 @@ class seissol::time_stepping::TimeManager {
     //! one dynamic rupture scheduler per pair of interior/copy cluster
     std::vector<std::unique_ptr<DynamicRuptureScheduler>> dynamicRuptureSchedulers;
 
+#ifdef USE_MPI
+    //! aggregates the regions sent to the same rank (SEISSOL_MPI_AGGREGATION=1); outlives the ghost clusters
+    std::unique_ptr<MessageAggregator> messageAggregator;
+#endif
+
     //! all MPI (ghost) LTS clusters, which are under control of this time manager
     std::unique_ptr<AbstractCommunicationManager> communicationManager;
 
     //! Stopwatch
     LoopStatistics m_loopStatistics;
     ActorStateStatisticsManager actorStateStatisticsManager;
+    ActorTrace actorTrace;
+
+    //! True if the actors are executed as OpenMP tasks (SEISSOL_TASKING=1, not on GPUs).
+    static bool useTasking();
+
+    //! True if the polling runs in one parallel region per synchronization interval (SEISSOL_PERSISTENT_REGION=1).
+    static bool usePersistentRegion();
+
+    //! Lets the actors act in a fixed order until all of them reached the synchronization time.
+    void advanceClustersByPolling();
+
+    //! Wave field outputs which are sampled by the clusters
+    std::vector<writer::WaveFieldWriter*> sampledWaveFieldWriters;
+
+    //! Writes the snapshots of the sampled wave field outputs which all clusters passed
+    void writeSampledWaveFields();
+
+    //! Executes the actions of the actors as OpenMP tasks until all of them reached the synchronization time.
+    void advanceClustersAsTasks();
+
+    /**
+     * Copy and interior layer of the fast clusters whose working set fits into the cache (SEISSOL_TEMPORAL_BLOCKING=1).
+     * Their time steps are computed back-to-back instead of alternating with the other clusters.
+     **/
+    std::vector<std::vector<TimeCluster*>> temporalBlocks;
+
+    //! Moves the clusters which fit into the cache from the prioritized clusters to temporal blocks.
+    void selectTemporalBlocks();
+
+    /**
+     * Lets the clusters of a temporal block predict and correct until none of them may advance
+     * any further before the slower neighbors. Returns true if a cluster acted.
+     **/
+    bool advanceTemporalBlock(std::vector<TimeCluster*> const& block, bool progressCommunication);
+
+#ifdef ACL_DEVICE
+    //! Per-rank file of the tuned DR pipeline batch sizes for the device of this rank (empty if disabled)
+    static std::string drPipelineCacheFile(std::string& fingerprint);
+
+    //! Fixes the batch sizes of the DR pipelines which a previous run on the same device tuned
+    void loadDrPipelineTuning();
+
+    /**
+     * Hybrid execution: moves the smallest clusters to the host until they hold the share of the work given by
+     * SEISSOL_HYBRID_HOST_SHARE (default 0, i.e. all clusters run on the device).
+     **/
+    void assignHybridExecution();
+
+    /**
+     * Distributes the clusters which run on the device among the devices of the rank (SEISSOL_DEVICES_PER_RANK),
+     * balancing their work. The clusters with dynamic rupture faces stay on the primary device.
+     **/
+    void assignDevices(initializers::MemoryManager& memoryManager);
+#endif
     
   public:
     /**
@@ -165,6 +234,21 @@ class seissol::time_stepping::TimeManager {
    */
     void setReceiverClusters(writer::ReceiverWriter& receiverWriter); 
 
+    /**
+     * Lets all clusters sample the wave field output, which is written once all clusters passed an output time
+     */
+    void addSampledWaveFieldWriter(writer::WaveFieldWriter& waveFieldWriter);
+
+    /**
+     * Lets all clusters compute the volume energies at the energy output times
+     */
+    void setEnergyOutput(writer::EnergyOutput& energyOutput);
+
+    /**
+     * Lets all clusters add the moment released by their dynamic rupture faces
+     */
+    void setMomentRateOutput(writer::MomentRateOutput& momentRateOutput);
+
     /**
      * Set Tv constant for plasticity.
      */
@@ -179,6 +263,45 @@ class seissol::time_stepping::TimeManager {
     void setInitialTimes( double i_time = 0 );
 
     void printComputationTime();
+
+    /**
+     * Prints the roofline report of the local and neighbor integration of each cluster and layer.
+     * Collective over all ranks.
+     **/
+    void printRoofline();
+
+    /**
+     * Writes the scaling report (SEISSOL_SCALING_REPORT). Collective over all ranks.
+     *
+     * @param wallTime wall time of the time loop.
+     * @param simulatedTime simulated time of the time loop.
+     **/
+    void writeScalingReport(double wallTime, double simulatedTime);
+
+    /**
+     * Logs the batch sizes of the DR pipelines of each cluster and layer (GPUs only) and stores them
+     * for later runs on the same device (SEISSOL_DR_PIPELINE_CACHE).
+     **/
+    void storeDrPipelineTuning();
+
+    /**
+     * Gets the measured compute time of each cell of the mesh since the start of the simulation.
+     * The time of the integration and dynamic rupture kernels of each cluster is distributed evenly
+     * over the cells of the cluster.
+     **/
+    std::vector<double> getMeasuredCellCosts();
+
+    /**
+     * Adds the loop statistics, the element updates and the communication time to a telemetry sample.
+     * Must only be called at a synchronization point.
+     **/
+    void addToTelemetrySample(TelemetrySample& sample);
+
+    /**
+     * Hands the time of the local and neighboring integration and the cell updates to the straggler monitor.
+     * Must only be called at a synchronization point; collective over all ranks.
+     **/
+    void checkStragglers(StragglerMonitor& monitor);
 };
 
 #endif
@@ -0,0 +1,96 @@
+#include "DevicePointSources.h"
+
+#include <generated_code/tensor.h>
+
+#include <device.h>
+
+namespace seissol::sourceterm {
+
+DevicePointSources::DevicePointSources(CellToPointSourcesMapping const* cellToPointSources,
+                                       unsigned numberOfMappings,
+                                       PointSources const& pointSources)
+    : m_isNRF(pointSources.mode == PointSources::NRF), m_numberOfMappings(numberOfMappings) {
+  unsigned const numberOfSources = pointSources.numberOfSources;
+
+  // dofs are allocated in unified memory on devices, i.e. the host pointers are valid on the device
+  std::vector<real*> dofs(numberOfMappings);
+  std::vector<unsigned> sourceOffsets(numberOfMappings + 1);
+  for (unsigned mapping = 0; mapping < numberOfMappings; ++mapping) {
+    dofs[mapping] = *cellToPointSources[mapping].dofs;
+    sourceOffsets[mapping] = cellToPointSources[mapping].pointSourcesOffset;
+    sourceOffsets[mapping + 1] =
+        cellToPointSources[mapping].pointSourcesOffset + cellToPointSources[mapping].numberOfPointSources;
+  }
+
+  std::vector<real> mInvJInvPhisAtSources(pointSources.mInvJInvPhisAtSources[0],
+                                          pointSources.mInvJInvPhisAtSources[0] +
+                                              numberOfSources * tensor::mInvJInvPhisAtSources::size());
+  std::vector<real> sourceTensor(pointSources.tensor[0],
+                                 pointSources.tensor[0] + numberOfSources * PointSources::TensorSize);
+
+  std::vector<real> stiffnessTensor;
+  for (auto const& stiffness : pointSources.stiffnessTensor) {
+    stiffnessTensor.insert(stiffnessTensor.end(), stiffness.begin(), stiffness.end());
+  }
+
+  std::vector<unsigned> pieceOffsets(1, 0);
+  std::vector<real> onsetTimes;
+  std::vector<real> samplingIntervals;
+  std::vector<real> slopes;
+  std::vector<real> intercepts;
+  for (unsigned source = 0; source < numberOfSources; ++source) {
+    for (auto const& slipRate : pointSources.slipRates[source]) {
+      slopes.insert(slopes.end(), slipRate.slopes, slipRate.slopes + slipRate.numberOfPieces);
+      intercepts.insert(intercepts.end(), slipRate.intercepts, slipRate.intercepts + slipRate.numberOfPieces);
+      pieceOffsets.push_back(slopes.size());
+      onsetTimes.push_back(slipRate.onsetTime);
+      samplingIntervals.push_back(slipRate.samplingInterval);
+    }
+  }
+
+  m_layer.dofs = upload(dofs);
+  m_layer.sourceOffsets = upload(sourceOffsets);
+  m_layer.mInvJInvPhisAtSources = upload(mInvJInvPhisAtSources);
+  m_layer.tensor = upload(sourceTensor);
+  m_layer.tensorSize = PointSources::TensorSize;
+  m_layer.area = upload(pointSources.A);
+  m_layer.stiffnessTensor = upload(stiffnessTensor);
+  m_layer.pieceOffsets = upload(pieceOffsets);
+  m_layer.onsetTimes = upload(onsetTimes);
+  m_layer.samplingIntervals = upload(samplingIntervals);
+  m_layer.slopes = upload(slopes);
+  m_layer.intercepts = upload(intercepts);
+}
+
+DevicePointSources::~DevicePointSources() {
+  for (void* memory : m_memory) {
+    device::DeviceInstance::getInstance().api->freeMem(memory);
+  }
+}
+
+bool DevicePointSources::isSupported() {
+#ifdef MULTIPLE_SIMULATIONS
+  // the kernel does not scale the sources of the fused simulations
+  return false;
+#else
+  return true;
+#endif
+}
+
+void DevicePointSources::add(double fromTime, double toTime, void* streamPtr) const {
+  kernels::device::aux::point_sources::addPointSources(
+      m_layer, m_isNRF, fromTime, toTime, m_numberOfMappings, streamPtr);
+}
+
+template <typename T>
+T* DevicePointSources::upload(std::vector<T> const& data) {
+  if (data.empty()) {
+    return nullptr;
+  }
+  auto& api = *device::DeviceInstance::getInstance().api;
+  void* memory = api.allocGlobMem(data.size() * sizeof(T));
+  api.copyTo(memory, data.data(), data.size() * sizeof(T));
+  m_memory.push_back(memory);
+  return static_cast<T*>(memory);
+}
+} // namespace seissol::sourceterm
@@ -0,0 +1,43 @@
+#ifndef SEISSOL_SOURCETERM_DEVICEPOINTSOURCES_H
+#define SEISSOL_SOURCETERM_DEVICEPOINTSOURCES_H
+
+#include <Kernels/DeviceAux/PointSourceAux.h>
+#include <SourceTerm/typedefs.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace seissol::sourceterm {
+/**
+ * Copy of the point sources of a time cluster in device memory.
+ *
+ * The sources are uploaded once; in each time step, a single kernel integrates the slip rates of all sources
+ * and adds them to the dofs of their cells on the device, i.e. the dofs of the source cells stay on the device.
+ **/
+class DevicePointSources {
+  public:
+  DevicePointSources(CellToPointSourcesMapping const* cellToPointSources,
+                     unsigned numberOfMappings,
+                     PointSources const& pointSources);
+  ~DevicePointSources();
+  DevicePointSources(DevicePointSources const&) = delete;
+  DevicePointSources& operator=(DevicePointSources const&) = delete;
+
+  //! False if the point sources are added on the host (fused simulations)
+  static bool isSupported();
+
+  //! Launches the kernel which adds the sources integrated over [fromTime, toTime] to the dofs in the stream.
+  void add(double fromTime, double toTime, void* streamPtr) const;
+
+  private:
+  template <typename T>
+  T* upload(std::vector<T> const& data);
+
+  kernels::device::aux::point_sources::PointSourcesLayer m_layer{};
+  bool m_isNRF;
+  std::size_t m_numberOfMappings;
+  std::vector<void*> m_memory;
+};
+} // namespace seissol::sourceterm
+
+#endif // SEISSOL_SOURCETERM_DEVICEPOINTSOURCES_H
@@ -82,6 +82,7 @@
 #include <Solver/Interoperability.h>
 #include <utils/logger.h>
 #include <cstring>
+#include <vector>
 
 template<typename T>
 class index_sort_by_value
@@ -408,28 +409,38 @@ void seissol::sourceterm::Manager::loadSourcesFromNRF(  char const*
   logInfo(rank) << "<--------------------------------------------------------->";
 
   logInfo(rank) << "Reading" << fileName;
-  NRF nrf;
-  readNRF(fileName, nrf);
+  NRFReader reader(fileName);
+  const unsigned numberOfFileSources = reader.numberOfSources();
+  std::vector<Eigen::Vector3d> centres(numberOfFileSources);
+  reader.readCentres(centres.data());
 
-  short* contained = new short[nrf.source];
-  unsigned* meshIds = new unsigned[nrf.source];
+  short* contained = new short[numberOfFileSources];
+  unsigned* meshIds = new unsigned[numberOfFileSources];
 
   logInfo(rank) << "Finding meshIds for point sources...";
-  initializers::findMeshIds(nrf.centres, mesh, nrf.source, contained, meshIds);
+  initializers::findMeshIds(centres.data(), mesh, numberOfFileSources, contained, meshIds);
 
 #ifdef USE_MPI
   logInfo(rank) << "Cleaning possible double occurring point sources for MPI...";
-  initializers::cleanDoubles(contained, nrf.source);
+  initializers::cleanDoubles(contained, numberOfFileSources);
 #endif
 
-  unsigned* originalIndex = new unsigned[nrf.source];
+  std::vector<unsigned> localSources;
   unsigned numSources = 0;
-  for (unsigned source = 0; source < nrf.source; ++source) {
-    originalIndex[numSources] = source;
+  for (unsigned source = 0; source < numberOfFileSources; ++source) {
+    if (contained[source]) {
+      localSources.push_back(source);
+    }
     meshIds[numSources] = meshIds[source];
     numSources += contained[source];
   }
   delete[] contained;
+  centres.clear();
+  centres.shrink_to_fit();
+
+  logInfo(rank) << "Reading parameters and slip rates of the local subfaults...";
+  NRF nrf;
+  reader.readSubfaults(localSources, nrf);
 
   // Checking that all sources are within the domain
   int globalnumSources = numSources;
@@ -438,9 +449,9 @@ void seissol::sourceterm::Manager::loadSourcesFromNRF(  char const*
 #endif
 
   if (rank==0) {
-     int numSourceOutside = nrf.source - globalnumSources;
+     int numSourceOutside = numberOfFileSources - globalnumSources;
      if (numSourceOutside > 0) {
-        logError() << nrf.source - globalnumSources <<" point sources are outside the domain.";
+        logError() << numSourceOutside <<" point sources are outside the domain.";
      }
   }
 
@@ -471,12 +482,11 @@ void seissol::sourceterm::Manager::loadSourcesFromNRF(  char const*
 
       for (unsigned clusterSource = 0; clusterSource < clusterMappings[cluster].numberOfSources; ++clusterSource) {
         unsigned sourceIndex = clusterMappings[cluster].sources[clusterSource];
-        unsigned nrfIndex = originalIndex[sourceIndex];
-        transformNRFSourceToInternalSource(nrf.centres[nrfIndex],
+        transformNRFSourceToInternalSource(nrf.centres[sourceIndex],
                                            meshIds[sourceIndex],
-                                           mesh,nrf.subfaults[nrfIndex],
-                                           nrf.sroffsets[nrfIndex],
-                                           nrf.sroffsets[nrfIndex + 1],
+                                           mesh,nrf.subfaults[sourceIndex],
+                                           nrf.sroffsets[sourceIndex],
+                                           nrf.sroffsets[sourceIndex + 1],
                                            nrf.sliprates,
                                            &ltsLut->lookup(lts->material, meshIds[sourceIndex]).local,
                                            sources[cluster],
@@ -484,7 +494,6 @@ void seissol::sourceterm::Manager::loadSourcesFromNRF(  char const*
       }
     }
   }
-  delete[] originalIndex;
   delete[] meshIds;
 
   timeManager.setPointSourcesForClusters(layeredClusterMapping, layeredSources);
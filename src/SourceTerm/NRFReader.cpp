@@ -50,113 +50,131 @@ void check_err(const int stat, const int line, const char *file) {
   }
 }
 
-void seissol::sourceterm::readNRF(char const* filename, NRF& nrf)
+seissol::sourceterm::NRFReader::NRFReader(char const* filename)
 {
-  int ncid;
   int stat;
 
-  /* dimension ids */
-  int source_dim;
-  int sroffset_dim;
-  int sample1_dim;
-  int sample2_dim;
-  int sample3_dim;
-
-  /* dimension lengths */
-  size_t sroffset_len;
-  size_t sample_len[3];
-
-  /* variable ids */
-  int centres_id;
-  int subfaults_id;
-  int sroffsets_id;
-  int sliprates1_id;
-  int sliprates2_id;
-  int sliprates3_id;
-
   /* open nrf */
-  stat = nc_open(filename, NC_NOWRITE, &ncid);
+  stat = nc_open(filename, NC_NOWRITE, &m_ncid);
   check_err(stat,__LINE__,__FILE__);
 
   /* get dimensions */
-  stat = nc_inq_dimid(ncid, "source", &source_dim);
+  int source_dim;
+  stat = nc_inq_dimid(m_ncid, "source", &source_dim);
   check_err(stat,__LINE__,__FILE__);
-  stat = nc_inq_dimlen(ncid, source_dim, &nrf.source);
+  stat = nc_inq_dimlen(m_ncid, source_dim, &m_numberOfSources);
   check_err(stat,__LINE__,__FILE__);
 
-  stat = nc_inq_dimid(ncid, "sroffset", &sroffset_dim);
+  int sroffset_dim;
+  size_t sroffset_len;
+  stat = nc_inq_dimid(m_ncid, "sroffset", &sroffset_dim);
   check_err(stat,__LINE__,__FILE__);
-  stat = nc_inq_dimlen(ncid, sroffset_dim, &sroffset_len);
+  stat = nc_inq_dimlen(m_ncid, sroffset_dim, &sroffset_len);
   check_err(stat,__LINE__,__FILE__);
 
-  stat = nc_inq_dimid(ncid, "sample1", &sample1_dim);
-  check_err(stat,__LINE__,__FILE__);
-  stat = nc_inq_dimlen(ncid, sample1_dim, &sample_len[0]);
-  check_err(stat,__LINE__,__FILE__);
+  assert( m_numberOfSources + 1 == sroffset_len );
 
-  stat = nc_inq_dimid(ncid, "sample2", &sample2_dim);
-  check_err(stat,__LINE__,__FILE__);
-  stat = nc_inq_dimlen(ncid, sample2_dim, &sample_len[1]);
+  /* get varids */
+  stat = nc_inq_varid(m_ncid, "centres", &m_centresId);
   check_err(stat,__LINE__,__FILE__);
 
-  stat = nc_inq_dimid(ncid, "sample3", &sample3_dim);
-  check_err(stat,__LINE__,__FILE__);
-  stat = nc_inq_dimlen(ncid, sample3_dim, &sample_len[2]);
+  stat = nc_inq_varid(m_ncid, "subfaults", &m_subfaultsId);
   check_err(stat,__LINE__,__FILE__);
 
-  assert( nrf.source + 1 == sroffset_len );
+  char const* sliprateNames[3] = {"sliprates1", "sliprates2", "sliprates3"};
+  for (unsigned sr = 0; sr < 3; ++sr) {
+    stat = nc_inq_varid(m_ncid, sliprateNames[sr], &m_sliprateIds[sr]);
+    check_err(stat,__LINE__,__FILE__);
+  }
 
-  /* get varids */
-  stat = nc_inq_varid(ncid, "centres", &centres_id);
+  /* the offsets of all subfaults are required to find the samples of a subfault */
+  static_assert(sizeof(std::array<unsigned, 3>) == sizeof(Offsets),
+      "sizeof(std::array<unsigned, 3>) does not equal sizeof(Offsets).");
+  int sroffsets_id;
+  stat = nc_inq_varid(m_ncid, "sroffsets", &sroffsets_id);
   check_err(stat,__LINE__,__FILE__);
-
-  stat = nc_inq_varid(ncid, "subfaults", &subfaults_id);
+  m_sroffsets.resize(sroffset_len);
+  stat = nc_get_var(m_ncid, sroffsets_id, m_sroffsets.data());
   check_err(stat,__LINE__,__FILE__);
+}
 
-  stat = nc_inq_varid(ncid, "sroffsets", &sroffsets_id);
+seissol::sourceterm::NRFReader::~NRFReader()
+{
+  /* close nrf */
+  int stat = nc_close(m_ncid);
   check_err(stat,__LINE__,__FILE__);
+}
 
-  stat = nc_inq_varid(ncid, "sliprates1", &sliprates1_id);
+void seissol::sourceterm::NRFReader::readRange(int varid, size_t first, size_t count, void* data) const
+{
+  int ndims;
+  int stat = nc_inq_varndims(m_ncid, varid, &ndims);
   check_err(stat,__LINE__,__FILE__);
-
-  stat = nc_inq_varid(ncid, "sliprates2", &sliprates2_id);
+  std::vector<int> dimids(ndims);
+  stat = nc_inq_vardimid(m_ncid, varid, dimids.data());
   check_err(stat,__LINE__,__FILE__);
 
-  stat = nc_inq_varid(ncid, "sliprates3", &sliprates3_id);
+  std::vector<size_t> start(ndims, 0);
+  std::vector<size_t> counts(ndims);
+  start[0] = first;
+  counts[0] = count;
+  for (int dim = 1; dim < ndims; ++dim) {
+    stat = nc_inq_dimlen(m_ncid, dimids[dim], &counts[dim]);
+    check_err(stat,__LINE__,__FILE__);
+  }
+  stat = nc_get_vara(m_ncid, varid, start.data(), counts.data(), data);
   check_err(stat,__LINE__,__FILE__);
+}
 
-  /* allocate memory */
+void seissol::sourceterm::NRFReader::readCentres(Eigen::Vector3d* centres) const
+{
   static_assert(sizeof(Eigen::Vector3d) == 3*sizeof(double), 
       "sizeof(Eigen::Vector3d) does not equal 3*sizeof(double).");
+  int stat = nc_get_var(m_ncid, m_centresId, centres);
+  check_err(stat,__LINE__,__FILE__);
+}
+
+void seissol::sourceterm::NRFReader::readSubfaults(std::vector<unsigned> const& sources, NRF& nrf) const
+{
+  /* allocate memory */
+  nrf.source = sources.size();
   nrf.centres = new Eigen::Vector3d[nrf.source];
-  nrf.sroffsets = new Offsets[nrf.source + 1];
   nrf.subfaults = new Subfault[nrf.source];
-  for (unsigned i = 0; i < 3; ++i) {
-    nrf.sliprates[0] = new double[sample_len[0]];
-    nrf.sliprates[1] = new double[sample_len[1]];
-    nrf.sliprates[2] = new double[sample_len[2]];
+  nrf.sroffsets = new Offsets[nrf.source + 1];
+  for (unsigned sr = 0; sr < 3; ++sr) {
+    nrf.sroffsets[0][sr] = 0;
+  }
+  for (size_t i = 0; i < sources.size(); ++i) {
+    assert(i == 0 || sources[i-1] < sources[i]);
+    for (unsigned sr = 0; sr < 3; ++sr) {
+      nrf.sroffsets[i+1][sr] = nrf.sroffsets[i][sr] + m_sroffsets[sources[i]+1][sr] - m_sroffsets[sources[i]][sr];
+    }
+  }
+  for (unsigned sr = 0; sr < 3; ++sr) {
+    nrf.sliprates[sr] = new double[nrf.sroffsets[nrf.source][sr]];
   }
 
-  /* get values */
-  stat = nc_get_var(ncid, centres_id, nrf.centres);
-  check_err(stat,__LINE__,__FILE__);
-
-  stat = nc_get_var(ncid, sroffsets_id, nrf.sroffsets);
-  check_err(stat,__LINE__,__FILE__);
-
-  stat = nc_get_var(ncid, subfaults_id, nrf.subfaults);
-  check_err(stat,__LINE__,__FILE__);
-
-  stat = nc_get_var_double(ncid, sliprates1_id, nrf.sliprates[0]);
-  check_err(stat,__LINE__,__FILE__);
-
-  stat = nc_get_var_double(ncid, sliprates2_id, nrf.sliprates[1]);
-  check_err(stat,__LINE__,__FILE__);
-
-  stat = nc_get_var_double(ncid, sliprates3_id, nrf.sliprates[2]);
-  check_err(stat,__LINE__,__FILE__);
-
-  /* close nrf */
-  stat = nc_close(ncid);
-  check_err(stat,__LINE__,__FILE__);
+  /* get values, one read per run of consecutive subfaults */
+  size_t begin = 0;
+  while (begin < sources.size()) {
+    size_t end = begin + 1;
+    while (end < sources.size() && sources[end] == sources[end-1] + 1) {
+      ++end;
+    }
+    const unsigned first = sources[begin];
+    const size_t count = end - begin;
+
+    readRange(m_centresId, first, count, &nrf.centres[begin]);
+    readRange(m_subfaultsId, first, count, &nrf.subfaults[begin]);
+    for (unsigned sr = 0; sr < 3; ++sr) {
+      size_t start = m_sroffsets[first][sr];
+      size_t samples = m_sroffsets[first + count][sr] - start;
+      if (samples > 0) {
+        int stat = nc_get_vara_double(m_ncid, m_sliprateIds[sr], &start, &samples,
+                                      &nrf.sliprates[sr][nrf.sroffsets[begin][sr]]);
+        check_err(stat,__LINE__,__FILE__);
+      }
+    }
+    begin = end;
+  }
 }
@@ -41,11 +41,48 @@
 #ifndef READER_NRFREADER_H_
 #define READER_NRFREADER_H_
 
+#include <array>
+#include <cstddef>
+#include <vector>
+
 #include "NRF.h"
 
 namespace seissol {
   namespace sourceterm {
-    void readNRF(char const* filename, NRF& nrf);
+    /**
+     * Reads an NRF file in two steps: all ranks read the centres of the subfaults to locate them,
+     * and each rank then reads the parameters and slip rates of its own subfaults only.
+     */
+    class NRFReader {
+    public:
+      explicit NRFReader(char const* filename);
+      ~NRFReader();
+      NRFReader(NRFReader const&) = delete;
+      NRFReader& operator=(NRFReader const&) = delete;
+
+      size_t numberOfSources() const { return m_numberOfSources; }
+
+      //! Reads the centres of all subfaults; centres must hold numberOfSources() entries
+      void readCentres(Eigen::Vector3d* centres) const;
+
+      /**
+       * Reads the given subfaults (ascending indices in the file) into nrf.
+       * The slip rate samples of these subfaults are stored contiguously, i.e. nrf.sroffsets
+       * refers to the samples in nrf.sliprates and not to the file.
+       */
+      void readSubfaults(std::vector<unsigned> const& sources, NRF& nrf) const;
+
+    private:
+      //! Reads count entries starting at first along the leading (source) dimension of the variable
+      void readRange(int varid, size_t first, size_t count, void* data) const;
+
+      int m_ncid;
+      size_t m_numberOfSources;
+      int m_centresId;
+      int m_subfaultsId;
+      int m_sliprateIds[3];
+      std::vector<std::array<unsigned, 3>> m_sroffsets;
+    };
   }
 }
 
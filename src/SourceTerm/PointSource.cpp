@@ -45,7 +45,56 @@
 #include <generated_code/kernel.h>
 #include <generated_code/init.h>
 #include <iostream>
- 
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#ifdef MULTIPLE_SIMULATIONS
+#include <array>
+
+#include <utils/env.h>
+#include <utils/logger.h>
+
+namespace {
+  /** Factor of the point sources in each fused simulation, given as a comma separated list
+   *  in SEISSOL_FUSED_SOURCE_SCALING; all sources act in full in all simulations by default. */
+  std::array<real, MULTIPLE_SIMULATIONS> readSimulationScaling() {
+    std::array<real, MULTIPLE_SIMULATIONS> scaling;
+    std::copy_n(init::oneSimToMultSim::Values, MULTIPLE_SIMULATIONS, scaling.begin());
+
+    std::stringstream factors(utils::Env::get<std::string>("SEISSOL_FUSED_SOURCE_SCALING", ""));
+    std::string factor;
+    unsigned sim = 0;
+    while (std::getline(factors, factor, ',')) {
+      if (sim < MULTIPLE_SIMULATIONS) {
+        std::size_t parsed = 0;
+        try {
+          scaling[sim] = std::stod(factor, &parsed);
+        } catch (std::logic_error const&) {
+          // std::invalid_argument or std::out_of_range
+          parsed = 0;
+        }
+        if (parsed == 0 || parsed != factor.size()) {
+          logError() << "SEISSOL_FUSED_SOURCE_SCALING has the invalid factor" << factor << "for simulation" << sim
+                     << ".";
+        }
+      }
+      ++sim;
+    }
+    if (sim != 0 && sim != MULTIPLE_SIMULATIONS) {
+      logError() << "SEISSOL_FUSED_SOURCE_SCALING has" << sim << "factors, but there are" << MULTIPLE_SIMULATIONS
+                 << "fused simulations.";
+    }
+    return scaling;
+  }
+
+  real const* simulationScaling() {
+    static const std::array<real, MULTIPLE_SIMULATIONS> scaling = readSimulationScaling();
+    return scaling.data();
+  }
+} // namespace
+#endif
+
 void seissol::sourceterm::transformMomentTensor(real const i_localMomentTensor[3][3],
                                                 real const i_localSolidVelocityComponent[3],
                                                 real i_localPressureComponent,
@@ -147,15 +196,12 @@ real seissol::sourceterm::computePwLFTimeIntegral(PiecewiseLinearFunction1D cons
    return l_integral;
 }
 
-void seissol::sourceterm::addTimeIntegratedPointSourceNRF( real const i_mInvJInvPhisAtSources[tensor::mInvJInvPhisAtSources::size()],
-                                                           real const faultBasis[9],
-                                                           real A,
-                                                           std::array<real, 81> const &stiffnessTensor,
-                                                           std::array<PiecewiseLinearFunction1D, 3> const &slipRates,
-                                                           double i_fromTime,
-                                                           double i_toTime,
-                                                           real o_dofUpdate[tensor::Q::size()] )
-{  
+void seissol::sourceterm::computeRotatedSlipNRF( real const faultBasis[9],
+                                                 std::array<PiecewiseLinearFunction1D, 3> const &slipRates,
+                                                 double i_fromTime,
+                                                 double i_toTime,
+                                                 real o_rotatedSlip[3] )
+{
   real slip[] = { 0.0, 0.0, 0.0};
   for (unsigned i = 0; i < 3; ++i) {
     if (slipRates[i].numberOfPieces > 0) {
@@ -163,13 +209,23 @@ void seissol::sourceterm::addTimeIntegratedPointSourceNRF( real const i_mInvJInv
     }
   }
   
-  real rotatedSlip[] = { 0.0, 0.0, 0.0 };
+  for (unsigned j = 0; j < 3; ++j) {
+    o_rotatedSlip[j] = 0.0;
+  }
   for (unsigned i = 0; i < 3; ++i) {
     for (unsigned j = 0; j < 3; ++j) {
-      rotatedSlip[j] += faultBasis[j + i*3] * slip[i];
+      o_rotatedSlip[j] += faultBasis[j + i*3] * slip[i];
     }
   }
-  
+}
+
+void seissol::sourceterm::addPointSourceNRF( real const i_mInvJInvPhisAtSources[tensor::mInvJInvPhisAtSources::size()],
+                                             real const faultBasis[9],
+                                             real A,
+                                             std::array<real, 81> const &stiffnessTensor,
+                                             real const rotatedSlip[3],
+                                             real o_dofUpdate[tensor::Q::size()] )
+{
   kernel::sourceNRF krnl;
   krnl.Q = o_dofUpdate;
   krnl.mInvJInvPhisAtSources = i_mInvJInvPhisAtSources;
@@ -179,25 +235,50 @@ void seissol::sourceterm::addTimeIntegratedPointSourceNRF( real const i_mInvJInv
   krnl.mArea = -A;
   krnl.momentToNRF = init::momentToNRF::Values;
 #ifdef MULTIPLE_SIMULATIONS
-  krnl.oneSimToMultSim = init::oneSimToMultSim::Values;
+  krnl.oneSimToMultSim = simulationScaling();
 #endif
   krnl.execute();
 }
 
-void seissol::sourceterm::addTimeIntegratedPointSourceFSRM( real const i_mInvJInvPhisAtSources[tensor::mInvJInvPhisAtSources::size()],
-                                                            real const i_forceComponents[tensor::momentFSRM::size()],
-                                                            PiecewiseLinearFunction1D const& i_pwLF,
-                                                            double i_fromTime,
-                                                            double i_toTime,
-                                                            real o_dofUpdate[tensor::Q::size()] )
+void seissol::sourceterm::addPointSourceFSRM( real const i_mInvJInvPhisAtSources[tensor::mInvJInvPhisAtSources::size()],
+                                              real const i_forceComponents[tensor::momentFSRM::size()],
+                                              real stfIntegral,
+                                              real o_dofUpdate[tensor::Q::size()] )
 {
   kernel::sourceFSRM krnl;
   krnl.Q = o_dofUpdate;
   krnl.mInvJInvPhisAtSources = i_mInvJInvPhisAtSources;
   krnl.momentFSRM = i_forceComponents;
-  krnl.stfIntegral = computePwLFTimeIntegral(i_pwLF, i_fromTime, i_toTime);
+  krnl.stfIntegral = stfIntegral;
 #ifdef MULTIPLE_SIMULATIONS
-  krnl.oneSimToMultSim = init::oneSimToMultSim::Values;
+  krnl.oneSimToMultSim = simulationScaling();
 #endif
   krnl.execute();
 }
+
+void seissol::sourceterm::addTimeIntegratedPointSourceNRF( real const i_mInvJInvPhisAtSources[tensor::mInvJInvPhisAtSources::size()],
+                                                           real const faultBasis[9],
+                                                           real A,
+                                                           std::array<real, 81> const &stiffnessTensor,
+                                                           std::array<PiecewiseLinearFunction1D, 3> const &slipRates,
+                                                           double i_fromTime,
+                                                           double i_toTime,
+                                                           real o_dofUpdate[tensor::Q::size()] )
+{  
+  real rotatedSlip[3];
+  computeRotatedSlipNRF(faultBasis, slipRates, i_fromTime, i_toTime, rotatedSlip);
+  addPointSourceNRF(i_mInvJInvPhisAtSources, faultBasis, A, stiffnessTensor, rotatedSlip, o_dofUpdate);
+}
+
+void seissol::sourceterm::addTimeIntegratedPointSourceFSRM( real const i_mInvJInvPhisAtSources[tensor::mInvJInvPhisAtSources::size()],
+                                                            real const i_forceComponents[tensor::momentFSRM::size()],
+                                                            PiecewiseLinearFunction1D const& i_pwLF,
+                                                            double i_fromTime,
+                                                            double i_toTime,
+                                                            real o_dofUpdate[tensor::Q::size()] )
+{
+  addPointSourceFSRM(i_mInvJInvPhisAtSources,
+                     i_forceComponents,
+                     computePwLFTimeIntegral(i_pwLF, i_fromTime, i_toTime),
+                     o_dofUpdate);
+}
@@ -128,6 +128,28 @@ namespace seissol {
                                  double i_fromTime,
                                  double i_toTime);
 
+    /** Returns the slip of an NRF source, i.e. the time integral of its slip rates
+     *  from i_fromTime to i_toTime, in the global coordinate system. */
+    void computeRotatedSlipNRF( real const faultBasis[9],
+                                std::array<PiecewiseLinearFunction1D, 3> const &slipRates,
+                                double i_fromTime,
+                                double i_toTime,
+                                real o_rotatedSlip[3] );
+
+    /** Adds the contribution of an NRF source with the given slip (see computeRotatedSlipNRF). */
+    void addPointSourceNRF( real const i_mInvJInvPhisAtSources[tensor::mInvJInvPhisAtSources::size()],
+                            real const faultBasis[9],
+                            real A,
+                            std::array<real, 81> const &stiffnessTensor,
+                            real const rotatedSlip[3],
+                            real o_dofUpdate[tensor::Q::size()] );
+
+    /** Adds the contribution of an FSRM source with the given time integral of the source time function. */
+    void addPointSourceFSRM( real const i_mInvJInvPhisAtSources[tensor::mInvJInvPhisAtSources::size()],
+                             real const i_forceComponents[tensor::momentFSRM::size()],
+                             real stfIntegral,
+                             real o_dofUpdate[tensor::Q::size()] );
+
     void addTimeIntegratedPointSourceNRF( real const i_mInvJInvPhisAtSources[tensor::mInvJInvPhisAtSources::size()],
                                           real const faultBasis[9],
                                           real A,
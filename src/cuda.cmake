@@ -5,12 +5,21 @@ set(CUDA_NVCC_FLAGS -std=c++14;
         -Xptxas -v;
         -arch=${DEVICE_ARCH};
         -DREAL_SIZE=${REAL_SIZE_IN_BYTES};
+        -DCONVERGENCE_ORDER=${ORDER};
         --compiler-options ${EXTRA_CXX_FLAGS};
         -O3;)
 
 set(DEVICE_SRC ${DEVICE_SRC}
                ${CMAKE_BINARY_DIR}/src/generated_code/gpulike_subroutine.cpp
-               ${CMAKE_CURRENT_SOURCE_DIR}/src/Kernels/DeviceAux/cuda/PlasticityAux.cu)
+               ${CMAKE_CURRENT_SOURCE_DIR}/src/Kernels/DeviceAux/cuda/PlasticityAux.cu
+               ${CMAKE_CURRENT_SOURCE_DIR}/src/Kernels/DeviceAux/cuda/FrictionLawAux.cu
+               ${CMAKE_CURRENT_SOURCE_DIR}/src/Kernels/DeviceAux/cuda/EnergyAux.cu
+               ${CMAKE_CURRENT_SOURCE_DIR}/src/Kernels/DeviceAux/cuda/PointSourceAux.cu
+               ${CMAKE_CURRENT_SOURCE_DIR}/src/Kernels/DeviceAux/cuda/StarMatricesAux.cu
+               ${CMAKE_CURRENT_SOURCE_DIR}/src/Kernels/DeviceAux/cuda/ReceiverAux.cu
+               ${CMAKE_CURRENT_SOURCE_DIR}/src/Kernels/DeviceAux/cuda/GraphAux.cu
+               ${CMAKE_CURRENT_SOURCE_DIR}/src/Kernels/DeviceAux/cuda/PeerAux.cu
+               ${CMAKE_CURRENT_SOURCE_DIR}/src/Kernels/DeviceAux/cuda/StreamAux.cu)
 
 set_source_files_properties(${DEVICE_SRC} PROPERTIES CUDA_SOURCE_PROPERTY_FORMAT OBJ)
 
@@ -14,7 +14,7 @@ set(HIP_COMPILER hcc)
 find_package(HIP REQUIRED)
 
 # Note: -std=c++14 because of cuda@10
-set(SEISSOL_HIPCC -DREAL_SIZE=${REAL_SIZE_IN_BYTES}; -std=c++14; -O3)
+set(SEISSOL_HIPCC -DREAL_SIZE=${REAL_SIZE_IN_BYTES}; -DCONVERGENCE_ORDER=${ORDER}; -std=c++14; -O3)
 set(SEISSOL_HCC)
 
 set(IS_NVCC_PLATFORM OFF)
@@ -47,7 +47,15 @@ ${HCC_PATH} \
 
 set(DEVICE_SRC ${DEVICE_SRC}
                ${CMAKE_BINARY_DIR}/src/generated_code/gpulike_subroutine.cpp
-               ${CMAKE_CURRENT_SOURCE_DIR}/src/Kernels/DeviceAux/hip/PlasticityAux.cpp)
+               ${CMAKE_CURRENT_SOURCE_DIR}/src/Kernels/DeviceAux/hip/PlasticityAux.cpp
+               ${CMAKE_CURRENT_SOURCE_DIR}/src/Kernels/DeviceAux/hip/FrictionLawAux.cpp
+               ${CMAKE_CURRENT_SOURCE_DIR}/src/Kernels/DeviceAux/hip/EnergyAux.cpp
+               ${CMAKE_CURRENT_SOURCE_DIR}/src/Kernels/DeviceAux/hip/PointSourceAux.cpp
+               ${CMAKE_CURRENT_SOURCE_DIR}/src/Kernels/DeviceAux/hip/StarMatricesAux.cpp
+               ${CMAKE_CURRENT_SOURCE_DIR}/src/Kernels/DeviceAux/hip/ReceiverAux.cpp
+               ${CMAKE_CURRENT_SOURCE_DIR}/src/Kernels/DeviceAux/hip/GraphAux.cpp
+               ${CMAKE_CURRENT_SOURCE_DIR}/src/Kernels/DeviceAux/hip/PeerAux.cpp
+               ${CMAKE_CURRENT_SOURCE_DIR}/src/Kernels/DeviceAux/hip/StreamAux.cpp)
 
 
 set_source_files_properties(${DEVICE_SRC} PROPERTIES HIP_SOURCE_PROPERTY_FORMAT 1)
@@ -6,9 +6,13 @@ src/Initializer/PointMapper.cpp
 src/Initializer/GlobalData.cpp
 src/Initializer/InternalState.cpp
 src/Initializer/MemoryAllocator.cpp
+src/Initializer/ThreadLocalArena.cpp
 src/Initializer/CellLocalMatrices.cpp
+src/Initializer/SetupSnapshot.cpp
 
 src/Initializer/time_stepping/LtsLayout.cpp
+src/Initializer/time_stepping/CellTimeSteps.cpp
+src/Initializer/time_stepping/ClusterStatistics.cpp
 src/Initializer/tree/Lut.cpp
 src/Initializer/MemoryManager.cpp
 src/Initializer/InitialFieldProjection.cpp
@@ -29,30 +33,59 @@ src/Solver/time_stepping/MiniSeisSol.cpp
 src/Solver/time_stepping/TimeCluster.cpp
 src/Solver/time_stepping/GhostTimeCluster.cpp
 src/Solver/time_stepping/CommunicationManager.cpp
+src/Solver/time_stepping/MessageAggregator.cpp
 
 src/Solver/time_stepping/TimeManager.cpp
 src/Solver/Pipeline/DrTuner.cpp
+src/Solver/Pipeline/HostStaging.cpp
 src/Kernels/DynamicRupture.cpp
+src/DynamicRupture/Factory.cpp
+src/DynamicRupture/FortranFaultState.cpp
 src/Kernels/Plasticity.cpp
 src/Kernels/TimeCommon.cpp
 src/Kernels/Receiver.cpp
+src/Kernels/ReceiverDecimation.cpp
+src/Kernels/WaveFieldSampler.cpp
 src/SeisSol.cpp
 src/SourceTerm/Manager.cpp
 
 src/SourceTerm/PointSource.cpp
 src/Parallel/Pin.cpp
+src/Parallel/SharedHalo.cpp
+src/Parallel/NodeSharedMemory.cpp
+src/Parallel/HostArch.cpp
+src/Parallel/PersistentRegion.cpp
 src/Parallel/MPI.cpp
 src/Parallel/mpiC.cpp
 src/Parallel/FaultMPI.cpp
 src/Geometry/GambitReader.cpp
 
+src/Geometry/CubeGenerator.cpp
+src/Geometry/ElementIndex.cpp
+src/Geometry/PartitionMapping.cpp
 src/Geometry/MeshReaderFBinding.cpp
 src/Geometry/MeshTools.cpp
+src/Geometry/UniformRefinement.cpp
+src/Monitoring/ActorStateStatistics.cpp
+src/Monitoring/ActorTrace.cpp
 src/Monitoring/FlopCounter.cpp
+src/Monitoring/HardwareCounters.cpp
 src/Monitoring/LoopStatistics.cpp
+src/Monitoring/RegionCommunication.cpp
+src/Monitoring/Roofline.cpp
+src/Monitoring/ScalingReport.cpp
+src/Monitoring/StartupEstimate.cpp
+src/Monitoring/StartupProfiler.cpp
+src/Monitoring/StragglerMonitor.cpp
+src/Monitoring/Telemetry.cpp
 src/Reader/readparC.cpp
 #Reader/StressReaderC.cpp
 src/Checkpoint/Manager.cpp
+src/Checkpoint/Incremental.cpp
+src/Checkpoint/NodeLocal.cpp
+src/Checkpoint/AdaptiveInterval.cpp
+src/Checkpoint/Codec.cpp
+src/Checkpoint/Prefetch.cpp
 
 
 # Checkpoint/sionlib/Wavefield.cpp
@@ -61,17 +94,30 @@ src/Checkpoint/Manager.cpp
 src/Checkpoint/Backend.cpp
 src/Checkpoint/Fault.cpp
 src/Checkpoint/posix/Wavefield.cpp
+src/Checkpoint/posix/WavefieldCompressed.cpp
 src/Checkpoint/posix/Fault.cpp
 src/ResultWriter/AnalysisWriter.cpp
 src/ResultWriter/FreeSurfaceWriterExecutor.cpp
 src/ResultWriter/PostProcessor.cpp
 src/ResultWriter/FaultWriterC.cpp
 src/ResultWriter/ReceiverWriter.cpp
+src/ResultWriter/ReceiverDatFile.cpp
+src/ResultWriter/ReceiverWriterExecutor.cpp
 src/ResultWriter/FaultWriterExecutor.cpp
 src/ResultWriter/FaultWriter.cpp
 src/ResultWriter/WaveFieldWriter.cpp
 src/ResultWriter/FreeSurfaceWriter.cpp
+src/ResultWriter/OutputQuantization.cpp
+src/ResultWriter/OutputRegions.cpp
+src/ResultWriter/RefinedMeshCache.cpp
+src/ResultWriter/OutputQueue.cpp
+src/ResultWriter/OutputBandwidth.cpp
+src/ResultWriter/PeakGroundMotion.cpp
+src/ResultWriter/FaultOutputFilter.cpp
+src/ResultWriter/EnergyStopCriterion.cpp
 src/ResultWriter/EnergyOutput.cpp
+src/ResultWriter/MomentRateBins.cpp
+src/ResultWriter/MomentRateOutput.cpp
 
 # Fortran:
 src/Geometry/allocate_mesh.f90
@@ -102,6 +148,7 @@ src/Physics/ini_model_DR.f90
 src/Physics/NucleationFunctions.f90
 src/Physics/thermalpressure.f90
 src/Physics/InitialField.cpp
+src/Physics/AbsorbingLayer.cpp
 src/Reader/readpar.f90
 src/Reader/read_backgroundstress.f90
 src/ResultWriter/inioutput_seissol.f90
@@ -133,6 +180,9 @@ if (MPI)
     ${CMAKE_CURRENT_SOURCE_DIR}/src/Checkpoint/mpio/FaultAsync.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/Checkpoint/mpio/Fault.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/Checkpoint/mpio/WavefieldAsync.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/Checkpoint/mpio/WavefieldElastic.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/Checkpoint/mpio/FaultElastic.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/Checkpoint/mpio/Redistribution.cpp
 )
 endif()
 
@@ -140,6 +190,20 @@ if (HDF5)
   target_sources(SeisSol-lib PUBLIC
     ${CMAKE_CURRENT_SOURCE_DIR}/src/Checkpoint/h5/Wavefield.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/Checkpoint/h5/Fault.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/Checkpoint/h5/WavefieldAsync.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/Checkpoint/h5/FaultAsync.cpp
+    )
+endif()
+
+if (GDS)
+  target_sources(SeisSol-lib PUBLIC
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/Checkpoint/gds/Wavefield.cpp
+    )
+endif()
+
+if (ADIOS2)
+  target_sources(SeisSol-lib PUBLIC
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/ResultWriter/Adios2Writer.cpp
     )
 endif()
 
@@ -227,7 +291,11 @@ if (WITH_GPU)
           ${CMAKE_CURRENT_SOURCE_DIR}/src/Initializer/BatchRecorders/LocalIntegrationRecorder.cpp
           ${CMAKE_CURRENT_SOURCE_DIR}/src/Initializer/BatchRecorders/NeighIntegrationRecorder.cpp
           ${CMAKE_CURRENT_SOURCE_DIR}/src/Initializer/BatchRecorders/PlasticityRecorder.cpp
-          ${CMAKE_CURRENT_SOURCE_DIR}/src/Initializer/BatchRecorders/DynamicRuptureRecorder.cpp)
+          ${CMAKE_CURRENT_SOURCE_DIR}/src/Initializer/BatchRecorders/DynamicRuptureRecorder.cpp
+          ${CMAKE_CURRENT_SOURCE_DIR}/src/Kernels/DeviceContext.cpp
+          ${CMAKE_CURRENT_SOURCE_DIR}/src/SourceTerm/DevicePointSources.cpp
+          ${CMAKE_CURRENT_SOURCE_DIR}/src/Kernels/DeviceReceivers.cpp
+          ${CMAKE_CURRENT_SOURCE_DIR}/src/ResultWriter/DeviceEnergies.cpp)
 
 
   set(SEISSOL_DEVICE_INCLUDE ${DEVICE_INCLUDE_DIRS}
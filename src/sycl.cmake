@@ -10,7 +10,15 @@ if ("${DEVICE_BACKEND}" STREQUAL "hipsycl")
 
   set(DEVICE_SRC ${DEVICE_SRC}
                  ${CMAKE_BINARY_DIR}/src/generated_code/gpulike_subroutine.cpp
-                 ${CMAKE_CURRENT_SOURCE_DIR}/src/Kernels/DeviceAux/sycl/PlasticityAux.cpp)
+                 ${CMAKE_CURRENT_SOURCE_DIR}/src/Kernels/DeviceAux/sycl/PlasticityAux.cpp
+                 ${CMAKE_CURRENT_SOURCE_DIR}/src/Kernels/DeviceAux/sycl/FrictionLawAux.cpp
+                 ${CMAKE_CURRENT_SOURCE_DIR}/src/Kernels/DeviceAux/sycl/EnergyAux.cpp
+                 ${CMAKE_CURRENT_SOURCE_DIR}/src/Kernels/DeviceAux/sycl/PointSourceAux.cpp
+                 ${CMAKE_CURRENT_SOURCE_DIR}/src/Kernels/DeviceAux/sycl/StarMatricesAux.cpp
+                 ${CMAKE_CURRENT_SOURCE_DIR}/src/Kernels/DeviceAux/sycl/ReceiverAux.cpp
+                 ${CMAKE_CURRENT_SOURCE_DIR}/src/Kernels/DeviceAux/sycl/GraphAux.cpp
+                 ${CMAKE_CURRENT_SOURCE_DIR}/src/Kernels/DeviceAux/sycl/PeerAux.cpp
+                 ${CMAKE_CURRENT_SOURCE_DIR}/src/Kernels/DeviceAux/sycl/StreamAux.cpp)
 
   add_library(SeisSol-device-lib STATIC ${DEVICE_SRC})
   add_sycl_to_target(TARGET SeisSol-device-lib SOURCES ${DEVICE_SRC})
@@ -19,20 +27,28 @@ if ("${DEVICE_BACKEND}" STREQUAL "hipsycl")
                                                        ${CUDA_TOOLKIT_ROOT_DIR})
 
   target_compile_options(SeisSol-device-lib PRIVATE ${EXTRA_CXX_FLAGS} "-O3" "-fPIC")
-  target_compile_definitions(SeisSol-device-lib PRIVATE DEVICE_HIPSYCL_LANG REAL_SIZE=${REAL_SIZE_IN_BYTES})
+  target_compile_definitions(SeisSol-device-lib PRIVATE DEVICE_HIPSYCL_LANG REAL_SIZE=${REAL_SIZE_IN_BYTES} CONVERGENCE_ORDER=${ORDER})
   target_link_libraries(SeisSol-device-lib PUBLIC -lcuda ${CUDA_LIBRARIES} ${Boost_LIBRARIES})
 
 elseif("${DEVICE_BACKEND}" STREQUAL "oneapi")
   set(DEVICE_SRC ${DEVICE_SRC}
                  ${CMAKE_BINARY_DIR}/src/generated_code/gpulike_subroutine.cpp
-                 ${CMAKE_CURRENT_SOURCE_DIR}/src/Kernels/DeviceAux/sycl/PlasticityAux.cpp)
+                 ${CMAKE_CURRENT_SOURCE_DIR}/src/Kernels/DeviceAux/sycl/PlasticityAux.cpp
+                 ${CMAKE_CURRENT_SOURCE_DIR}/src/Kernels/DeviceAux/sycl/FrictionLawAux.cpp
+                 ${CMAKE_CURRENT_SOURCE_DIR}/src/Kernels/DeviceAux/sycl/EnergyAux.cpp
+                 ${CMAKE_CURRENT_SOURCE_DIR}/src/Kernels/DeviceAux/sycl/PointSourceAux.cpp
+                 ${CMAKE_CURRENT_SOURCE_DIR}/src/Kernels/DeviceAux/sycl/StarMatricesAux.cpp
+                 ${CMAKE_CURRENT_SOURCE_DIR}/src/Kernels/DeviceAux/sycl/ReceiverAux.cpp
+                 ${CMAKE_CURRENT_SOURCE_DIR}/src/Kernels/DeviceAux/sycl/GraphAux.cpp
+                 ${CMAKE_CURRENT_SOURCE_DIR}/src/Kernels/DeviceAux/sycl/PeerAux.cpp
+                 ${CMAKE_CURRENT_SOURCE_DIR}/src/Kernels/DeviceAux/sycl/StreamAux.cpp)
 
   add_library(SeisSol-device-lib STATIC ${DEVICE_SRC})
 
   target_include_directories(SeisSol-device-lib PUBLIC ${SEISSOL_DEVICE_INCLUDE})
 
   target_compile_options(SeisSol-device-lib PRIVATE ${EXTRA_CXX_FLAGS} "-O3")
-  target_compile_definitions(SeisSol-device-lib PRIVATE DEVICE_ONEAPI_LANG REAL_SIZE=${REAL_SIZE_IN_BYTES})
+  target_compile_definitions(SeisSol-device-lib PRIVATE DEVICE_ONEAPI_LANG REAL_SIZE=${REAL_SIZE_IN_BYTES} CONVERGENCE_ORDER=${ORDER})
 
   if ("$ENV{PREFERRED_DEVICE_TYPE}" STREQUAL "FPGA")
     message(NOTICE "FPGA is used as target device, compilation will take several hours to complete!")
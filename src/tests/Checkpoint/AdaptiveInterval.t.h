@@ -0,0 +1,26 @@
+#include <cmath>
+
+#include "Checkpoint/AdaptiveInterval.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Adaptive checkpoint interval") {
+  using seissol::checkpoint::AdaptiveInterval;
+
+  REQUIRE(!AdaptiveInterval(0.0).enabled());
+  REQUIRE(AdaptiveInterval(0.5).enabled());
+
+  // Cheap checkpoints: close to Young's first-order estimate sqrt(2 C M)
+  const double meanTimeBetweenFailures = 36000.0;
+  const double interval = AdaptiveInterval::optimalComputeTime(60.0, meanTimeBetweenFailures);
+  REQUIRE(interval == AbsApprox(2038.65).epsilon(1e-2));
+  REQUIRE(std::abs(interval - std::sqrt(2.0 * 60.0 * meanTimeBetweenFailures)) < 0.05 * interval);
+
+  // More expensive checkpoints are written less often
+  REQUIRE(AdaptiveInterval::optimalComputeTime(600.0, meanTimeBetweenFailures) > interval);
+
+  // Checkpoints which take longer than twice the mean time between failures
+  REQUIRE(AdaptiveInterval::optimalComputeTime(80000.0, meanTimeBetweenFailures) == meanTimeBetweenFailures);
+}
+
+} // namespace seissol::unit_test
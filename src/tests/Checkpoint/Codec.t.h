@@ -0,0 +1,69 @@
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include "Checkpoint/Codec.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Parses the checkpoint compression") {
+  REQUIRE(seissol::checkpoint::parseCodecMode("none") == seissol::checkpoint::CodecMode::None);
+  REQUIRE(seissol::checkpoint::parseCodecMode("lossless") == seissol::checkpoint::CodecMode::Lossless);
+  REQUIRE(seissol::checkpoint::parseCodecMode("lossy") == seissol::checkpoint::CodecMode::Lossy);
+  CHECK_THROWS_AS(seissol::checkpoint::parseCodecMode("zfp"), std::runtime_error);
+}
+
+TEST_CASE("Checkpoint codec") {
+  // Three cells with 4 modes and 2 quantities; the first 2 modes are stored exactly
+  constexpr unsigned int BlockSize = 8;
+  const std::vector<real> dofs = {1.1, -2.2, 1e-3, 0.0, 3.3, 4.4, -2e-3, 5e-4,
+                                  1.2, -2.3, 1e-3, 0.0, 3.4, 4.5, -2e-3, 0.0,
+                                  1.3, -2.4, 7.0, 0.0, 3.5, 4.6, 1e20, -0.0};
+
+  SUBCASE("Lossless") {
+    const seissol::checkpoint::Codec codec(seissol::checkpoint::CodecMode::Lossless, BlockSize, 4, 2, 0.0);
+    std::vector<char> stream;
+    codec.encode(dofs.data(), dofs.size(), stream);
+    REQUIRE(stream.size() < dofs.size() * sizeof(real));
+
+    std::vector<real> decoded(dofs.size());
+    REQUIRE(codec.decode(stream.data(), stream.size(), 0, dofs.size(), decoded.data()));
+    for (unsigned int i = 0; i < dofs.size(); ++i) {
+      REQUIRE(std::signbit(decoded[i]) == std::signbit(dofs[i]));
+      REQUIRE(decoded[i] == dofs[i]);
+    }
+
+    // Decoding of a part (e.g. of a rank in a group)
+    std::vector<real> part(BlockSize);
+    REQUIRE(codec.decode(stream.data(), stream.size(), BlockSize, BlockSize, part.data()));
+    REQUIRE(part == std::vector<real>(dofs.begin() + BlockSize, dofs.begin() + 2 * BlockSize));
+
+    REQUIRE(!codec.decode(stream.data(), stream.size() - 1, 0, dofs.size(), decoded.data()));
+  }
+
+  SUBCASE("Lossy") {
+    const double tolerance = 1e-4;
+    const seissol::checkpoint::Codec codec(seissol::checkpoint::CodecMode::Lossy, BlockSize, 4, 2, tolerance);
+    std::vector<char> stream;
+    codec.encode(dofs.data(), dofs.size(), stream);
+    REQUIRE(stream.size() < dofs.size() * sizeof(real));
+
+    std::vector<real> decoded(dofs.size());
+    REQUIRE(codec.decode(stream.data(), stream.size(), 0, dofs.size(), decoded.data()));
+    for (unsigned int i = 0; i < dofs.size(); ++i) {
+      if (i % 4 < 2) {
+        REQUIRE(decoded[i] == dofs[i]);
+      } else {
+        REQUIRE(std::abs(decoded[i] - dofs[i]) <= tolerance * (1.0 + 1e-6));
+      }
+    }
+    // Values which cannot be quantized are stored as they are
+    REQUIRE(decoded[22] == dofs[22]);
+  }
+
+  CHECK_THROWS_AS(seissol::checkpoint::Codec(seissol::checkpoint::CodecMode::Lossy, BlockSize, 4, 2, 0.0),
+                  std::invalid_argument);
+  CHECK_THROWS_AS(seissol::checkpoint::Codec(seissol::checkpoint::CodecMode::Lossless, BlockSize, 3, 2, 0.0),
+                  std::invalid_argument);
+}
+} // namespace seissol::unit_test
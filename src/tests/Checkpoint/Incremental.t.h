@@ -0,0 +1,67 @@
+#include <cstdio>
+#include <vector>
+
+#include "Checkpoint/Incremental.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Incremental checkpoints select the changed blocks") {
+  const std::vector<real> reference = {0.0, 0.0, 1.0, 1.0, 2.0, 2.0, 3.0};
+  std::vector<real> dofs = reference;
+  REQUIRE(seissol::checkpoint::Incremental::changedBlocks(reference.data(), dofs.data(), 7, 2, 0.0).empty());
+
+  dofs[1] = 1e-3;
+  dofs[6] = 4.0;
+  const auto blocks = seissol::checkpoint::Incremental::changedBlocks(reference.data(), dofs.data(), 7, 2, 0.0);
+  REQUIRE(blocks == std::vector<unsigned long>{0, 3});
+  const auto tolerated = seissol::checkpoint::Incremental::changedBlocks(reference.data(), dofs.data(), 7, 2, 1e-2);
+  REQUIRE(tolerated == std::vector<unsigned long>{3});
+}
+
+TEST_CASE("Incremental checkpoints restore the last state") {
+  const std::string filename = "incremental-checkpoint-test";
+  const std::vector<real> reference = {0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0};
+
+  seissol::checkpoint::Incremental incremental;
+  incremental.init(filename, 2, 0.0, reference.size(), 4);
+  REQUIRE(incremental.isFullCheckpointDue());
+  incremental.setReference(1.0, reference.data());
+  REQUIRE(!incremental.isFullCheckpointDue());
+
+  // Changes in the first and the last (incomplete) block
+  std::vector<real> dofs = reference;
+  dofs[1] = -1.0;
+  dofs[9] = -9.0;
+  seissol::checkpoint::WavefieldHeader header;
+  header.alloc();
+  header.time() = 2.0;
+  incremental.write(2.0, header.data(), header.size(), dofs.data());
+  incremental.commit();
+  REQUIRE(!incremental.isFullCheckpointDue());
+
+  SUBCASE("Restores the incremental checkpoint of the loaded full checkpoint") {
+    std::vector<real> restored = reference;
+    seissol::checkpoint::WavefieldHeader loaded;
+    loaded.alloc();
+    loaded.time() = 1.0;
+    REQUIRE(seissol::checkpoint::Incremental::load(filename, loaded, restored.data(), restored.size()));
+    REQUIRE(loaded.time() == 2.0);
+    REQUIRE(restored == dofs);
+  }
+
+  SUBCASE("Ignores the incremental checkpoint of a different full checkpoint") {
+    std::vector<real> restored = reference;
+    seissol::checkpoint::WavefieldHeader loaded;
+    loaded.alloc();
+    loaded.time() = 0.5;
+    REQUIRE(!seissol::checkpoint::Incremental::load(filename, loaded, restored.data(), restored.size()));
+    REQUIRE(restored == reference);
+  }
+
+  incremental.write(3.0, header.data(), header.size(), dofs.data());
+  incremental.commit();
+  REQUIRE(incremental.isFullCheckpointDue());
+
+  std::remove(seissol::checkpoint::Incremental::deltaFile(filename).c_str());
+}
+} // namespace seissol::unit_test
@@ -0,0 +1,70 @@
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <vector>
+
+#include "Checkpoint/NodeLocal.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Node-local checkpoints") {
+  REQUIRE(seissol::checkpoint::NodeLocal::localFile("/tmp/local", "output/checkpoint", 3) ==
+          "/tmp/local/checkpoint.3.local");
+
+  const std::string directory = "nodelocal-test";
+  setenv("SEISSOL_CHECKPOINT_LOCAL_DIR", directory.c_str(), 1);
+  setenv("SEISSOL_CHECKPOINT_LOCAL_DRAIN", "2", 1);
+
+  seissol::checkpoint::WavefieldHeader header;
+  header.alloc();
+  header.clear();
+  header.time() = 1.5;
+
+  std::vector<real> dofs = {1.0, 2.0, 3.0};
+  std::vector<std::vector<double>> drData(seissol::checkpoint::NodeLocal::NumberOfDRVariables);
+  const double* drDofs[seissol::checkpoint::NodeLocal::NumberOfDRVariables];
+  for (unsigned int i = 0; i < drData.size(); i++) {
+    drData[i] = {static_cast<double>(i), -static_cast<double>(i)};
+    drDofs[i] = drData[i].data();
+  }
+
+  seissol::checkpoint::NodeLocal nodeLocal;
+  nodeLocal.init("checkpoint", dofs.size(), 2);
+  REQUIRE(nodeLocal.enabled());
+  // Every second checkpoint is drained
+  REQUIRE(nodeLocal.write(header, dofs.data(), drDofs, 7));
+  header.time() = 2.5;
+  REQUIRE_FALSE(nodeLocal.write(header, dofs.data(), drDofs, 8));
+
+  seissol::checkpoint::WavefieldHeader loadedHeader;
+  loadedHeader.alloc();
+  loadedHeader.clear();
+  std::vector<real> loadedDofs(dofs.size());
+  std::vector<std::vector<double>> loadedDrData(drData.size(), std::vector<double>(2));
+  double* loadedDrDofs[seissol::checkpoint::NodeLocal::NumberOfDRVariables];
+  for (unsigned int i = 0; i < loadedDrData.size(); i++) {
+    loadedDrDofs[i] = loadedDrData[i].data();
+  }
+  int faultTimeStep = 0;
+
+  // The checkpoint on the parallel file system is newer
+  REQUIRE_FALSE(nodeLocal.load(3.0, loadedHeader, loadedDofs.data(), loadedDrDofs, faultTimeStep));
+
+  REQUIRE(nodeLocal.load(-std::numeric_limits<double>::infinity(),
+                         loadedHeader,
+                         loadedDofs.data(),
+                         loadedDrDofs,
+                         faultTimeStep));
+  REQUIRE(loadedHeader.time() == AbsApprox(2.5));
+  REQUIRE(faultTimeStep == 8);
+  for (unsigned int i = 0; i < dofs.size(); i++) {
+    REQUIRE(loadedDofs[i] == AbsApprox(dofs[i]));
+  }
+  REQUIRE(loadedDrData[5][1] == AbsApprox(-5.0));
+
+  std::remove(seissol::checkpoint::NodeLocal::localFile(directory, "checkpoint", 0).c_str());
+  std::remove(directory.c_str());
+  unsetenv("SEISSOL_CHECKPOINT_LOCAL_DIR");
+  unsetenv("SEISSOL_CHECKPOINT_LOCAL_DRAIN");
+}
+} // namespace seissol::unit_test
@@ -0,0 +1,28 @@
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "Checkpoint/Prefetch.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Checkpoint prefetch") {
+  const std::string file = "prefetch-test.bin";
+  {
+    std::ofstream out(file, std::ios::binary);
+    out << std::string(1000, 'x');
+  }
+
+  seissol::checkpoint::Prefetch prefetch;
+  prefetch.start(file, 64);
+  REQUIRE(prefetch.wait() == 1000);
+  // Waiting again does not read the file again
+  REQUIRE(prefetch.wait() == 1000);
+
+  prefetch.start("prefetch-test-missing.bin");
+  REQUIRE(prefetch.wait() == 0);
+
+  std::remove(file.c_str());
+}
+
+} // namespace seissol::unit_test
@@ -0,0 +1,34 @@
+#include <vector>
+
+#include "Checkpoint/mpio/Redistribution.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Owner of a key in the checkpoint redistribution") {
+  REQUIRE(seissol::checkpoint::mpio::keyOwner(0, 10, 3) == 0);
+  REQUIRE(seissol::checkpoint::mpio::keyOwner(3, 10, 3) == 0);
+  REQUIRE(seissol::checkpoint::mpio::keyOwner(4, 10, 3) == 1);
+  REQUIRE(seissol::checkpoint::mpio::keyOwner(9, 10, 3) == 2);
+  // Keys outside of the key space belong to the last rank
+  REQUIRE(seissol::checkpoint::mpio::keyOwner(20, 10, 3) == 2);
+  REQUIRE(seissol::checkpoint::mpio::keyOwner(1, 2, 8) == 1);
+}
+
+TEST_CASE("Redistributes checkpoint records by key") {
+  using seissol::checkpoint::INVALID_GLOBAL_ID;
+
+  // Three records with two keys each
+  const std::vector<unsigned long> keys = {4, 9, 0, INVALID_GLOBAL_ID, 7, 2};
+  const std::vector<double> records = {4.0, 40.0, 0.0, 1.0, 7.0, 70.0};
+
+  const std::vector<unsigned long> requests = {2, INVALID_GLOBAL_ID, 0, 9, 4};
+  std::vector<double> result(2 * requests.size(), -1.0);
+  seissol::checkpoint::mpio::redistribute(keys.data(), 2, records.data(), 3, 2 * sizeof(double),
+                                          requests.data(), requests.size(), result.data(), 10, MPI_COMM_SELF);
+
+  const std::vector<double> expected = {7.0, 70.0, -1.0, -1.0, 0.0, 1.0, 4.0, 40.0, 4.0, 40.0};
+  for (unsigned i = 0; i < expected.size(); ++i) {
+    REQUIRE(result[i] == AbsApprox(expected[i]));
+  }
+}
+} // namespace seissol::unit_test
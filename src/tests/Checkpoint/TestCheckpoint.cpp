@@ -0,0 +1,11 @@
+#include "doctest.h"
+#include "tests/TestHelper.h"
+
+#include "AdaptiveInterval.t.h"
+#include "Codec.t.h"
+#include "Incremental.t.h"
+#include "NodeLocal.t.h"
+#include "Prefetch.t.h"
+#ifdef USE_MPI
+#include "Redistribution.t.h"
+#endif // USE_MPI
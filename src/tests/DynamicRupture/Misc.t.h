@@ -0,0 +1,44 @@
+#include "doctest.h"
+#include <DynamicRupture/Misc.h>
+
+namespace seissol::unit_test {
+
+TEST_CASE("Test smooth step function") {
+  constexpr double epsilon = 1e-12;
+  constexpr double tau = 2.0;
+  REQUIRE(seissol::dr::misc::smoothStep(-1.0, tau) == AbsApprox(0.0).epsilon(epsilon));
+  REQUIRE(seissol::dr::misc::smoothStep(0.0, tau) == AbsApprox(0.0).epsilon(epsilon));
+  REQUIRE(seissol::dr::misc::smoothStep(1.0, tau) == AbsApprox(std::exp(-1.0 / 3.0)).epsilon(epsilon));
+  REQUIRE(seissol::dr::misc::smoothStep(tau, tau) == AbsApprox(1.0).epsilon(epsilon));
+  REQUIRE(seissol::dr::misc::smoothStep(3.0, tau) == AbsApprox(1.0).epsilon(epsilon));
+}
+
+TEST_CASE("Test smooth step increment") {
+  constexpr double epsilon = 1e-12;
+  constexpr double tau = 2.0;
+  constexpr double dt = 0.1;
+  // increments add up to the full step
+  double sum = 0.0;
+  for (int i = 1; i <= 20; ++i) {
+    sum += seissol::dr::misc::smoothStepIncrement(i * dt, tau, dt);
+  }
+  REQUIRE(sum == AbsApprox(1.0).epsilon(epsilon));
+  REQUIRE(seissol::dr::misc::smoothStepIncrement(0.0, tau, dt) == AbsApprox(0.0).epsilon(epsilon));
+  REQUIRE(seissol::dr::misc::smoothStepIncrement(2.5, tau, dt) == AbsApprox(0.0).epsilon(epsilon));
+  REQUIRE(seissol::dr::misc::smoothStepIncrement(1.0, tau, dt) ==
+          AbsApprox(seissol::dr::misc::smoothStep(1.0, tau) - seissol::dr::misc::smoothStep(0.9, tau))
+              .epsilon(epsilon));
+}
+
+TEST_CASE("Test time step widths of the temporal quadrature points") {
+  constexpr double epsilon = 1e-12;
+  double const timePoints[3] = {0.1, 0.5, 0.9};
+  double deltaT[3];
+  seissol::dr::misc::computeDeltaT<3>(timePoints, deltaT);
+  REQUIRE(deltaT[0] == AbsApprox(0.1).epsilon(epsilon));
+  REQUIRE(deltaT[1] == AbsApprox(0.4).epsilon(epsilon));
+  REQUIRE(deltaT[2] == AbsApprox(0.5).epsilon(epsilon));
+  REQUIRE(deltaT[0] + deltaT[1] + deltaT[2] == AbsApprox(1.0).epsilon(epsilon));
+}
+
+} // namespace seissol::unit_test
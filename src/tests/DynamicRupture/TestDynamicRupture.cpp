@@ -0,0 +1,5 @@
+#include "doctest.h"
+#include "tests/TestHelper.h"
+
+#include "Misc.t.h"
+#include "ThermalPressurization.t.h"
@@ -0,0 +1,95 @@
+#include "doctest.h"
+#include <DynamicRupture/FrictionLaws/ThermalPressurization.h>
+
+#include <cmath>
+
+namespace seissol::unit_test {
+
+TEST_CASE("Thermal pressurization agrees with Calc_ThermalPressure") {
+  using namespace seissol::dr;
+  using namespace seissol::dr::friction_law;
+  constexpr unsigned nz = numberOfTPGridPoints;
+  constexpr double pi = 3.141592653589793;
+  constexpr double relativeEpsilon = (sizeof(real) == sizeof(double)) ? 1e-9 : 1e-4;
+  // the heat source of the largest wavenumbers underflows
+  auto const epsilon = [&](double value) { return relativeEpsilon * std::abs(value) + 1e-30; };
+
+  DRParameters drParameters;
+  drParameters.tpAlphaTh = 1.0e-6;
+  drParameters.tpRhoC = 2.7e6;
+  drParameters.tpLambda = 0.1e6;
+  drParameters.tpInitialTemperature = 483.15;
+  drParameters.tpInitialPressure = -80.0e6;
+  ThermalPressurization thermalPressurization(drParameters);
+
+  alignas(ALIGNMENT) real temperature[numPaddedPoints];
+  alignas(ALIGNMENT) real pressure[numPaddedPoints];
+  alignas(ALIGNMENT) real theta[nz][numPaddedPoints] = {};
+  alignas(ALIGNMENT) real sigma[nz][numPaddedPoints] = {};
+  alignas(ALIGNMENT) real halfWidth[numPaddedPoints];
+  alignas(ALIGNMENT) real alphaHy[numPaddedPoints];
+  alignas(ALIGNMENT) real heating[numPaddedPoints];
+  alignas(ALIGNMENT) real porePressure[numPaddedPoints];
+  for (unsigned point = 0; point < numPaddedPoints; ++point) {
+    halfWidth[point] = 0.01 + 0.001 * point;
+    alphaHy[point] = 1e-4 * (1.0 + 0.1 * point);
+  }
+  ThermalPressurizationFace face{temperature, pressure, theta, sigma, halfWidth, alphaHy};
+
+  // Fortran reference with the grid of thermalPress_init
+  double referenceTheta[nz][numPaddedPoints] = {};
+  double referenceSigma[nz][numPaddedPoints] = {};
+  double dwn[nz];
+  double dfInv[nz];
+  for (unsigned j = 0; j < nz; ++j) {
+    dwn[j] = 10.0 * std::exp(-0.3 * (nz - 1 - j));
+    double const weight = (j == 0) ? 1.0 + 0.15 : ((j == nz - 1) ? 0.15 : 0.3);
+    dfInv[j] = std::sqrt(2.0 / pi) * dwn[j] * weight;
+  }
+
+  constexpr double dt = 1e-3;
+  for (unsigned step = 0; step < 3; ++step) {
+    for (unsigned point = 0; point < numPaddedPoints; ++point) {
+      heating[point] = 1e6 * (step + 1) * (1.0 + 0.05 * point);
+    }
+    ThermalPressurizationSums sums;
+    thermalPressurization.computeSums(face, dt, sums);
+    thermalPressurization.updateTemperatureAndPressure(face, sums, heating, porePressure);
+    thermalPressurization.updateSpectrum(face, dt, heating);
+
+    for (unsigned point = 0; point < numberOfPoints; ++point) {
+      double const w = halfWidth[point];
+      double const alphaTh = drParameters.tpAlphaTh;
+      double const lambdaPrime = drParameters.tpLambda * alphaTh / (alphaHy[point] - alphaTh);
+      double t = 0.0;
+      double p = 0.0;
+      for (unsigned j = 0; j < nz; ++j) {
+        double const tmp = (dwn[j] / w) * (dwn[j] / w);
+        // heat_source, with expm1 instead of 1 - exp, which vanishes for the smallest wavenumbers
+        double const omegaTh = -1.0 / (alphaTh * tmp * std::sqrt(2.0 * pi)) * std::exp(-0.5 * dwn[j] * dwn[j]) *
+                               std::expm1(-alphaTh * dt * tmp);
+        double const omegaHy = -1.0 / (alphaHy[point] * tmp * std::sqrt(2.0 * pi)) *
+                               std::exp(-0.5 * dwn[j] * dwn[j]) * std::expm1(-alphaHy[point] * dt * tmp);
+        referenceTheta[j][point] = referenceTheta[j][point] * std::exp(-alphaTh * dt * tmp) +
+                                   heating[point] / drParameters.tpRhoC * omegaTh;
+        referenceSigma[j][point] = referenceSigma[j][point] * std::exp(-alphaHy[point] * dt * tmp) +
+                                   (drParameters.tpLambda + lambdaPrime) * heating[point] / drParameters.tpRhoC *
+                                       omegaHy;
+        t += dfInv[j] / w * referenceTheta[j][point];
+        p += dfInv[j] / w * referenceSigma[j][point];
+      }
+      p -= lambdaPrime * t;
+      double const referenceTemperature = t + drParameters.tpInitialTemperature;
+      double const referencePressure = -p + drParameters.tpInitialPressure;
+
+      REQUIRE(temperature[point] == AbsApprox(referenceTemperature).epsilon(epsilon(referenceTemperature)));
+      REQUIRE(pressure[point] == AbsApprox(referencePressure).epsilon(epsilon(referencePressure)));
+      REQUIRE(porePressure[point] == pressure[point]);
+      for (unsigned j = 0; j < nz; ++j) {
+        REQUIRE(theta[j][point] == AbsApprox(referenceTheta[j][point]).epsilon(epsilon(referenceTheta[j][point])));
+        REQUIRE(sigma[j][point] == AbsApprox(referenceSigma[j][point]).epsilon(epsilon(referenceSigma[j][point])));
+      }
+    }
+  }
+}
+} // namespace seissol::unit_test
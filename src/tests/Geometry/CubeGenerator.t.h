@@ -0,0 +1,110 @@
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <vector>
+
+#include "Geometry/CubeGenerator.h"
+#include "Geometry/MeshTools.h"
+
+namespace seissol::unit_test {
+
+namespace {
+std::array<std::array<double, 3>, 3> faceCoordinates(MeshReader const& mesh, Element const& element, int face) {
+  std::array<std::array<double, 3>, 3> coordinates;
+  for (int i = 0; i < 3; ++i) {
+    const auto& vertex = mesh.getVertices()[element.vertices[MeshTools::FACE2NODES[face][i]]];
+    std::copy_n(vertex.coords, 3, coordinates[i].begin());
+  }
+  return coordinates;
+}
+
+double volume(MeshReader const& mesh, Element const& element) {
+  const auto& v = mesh.getVertices();
+  double edges[3][3];
+  for (int i = 0; i < 3; ++i) {
+    for (int d = 0; d < 3; ++d) {
+      edges[i][d] = v[element.vertices[i + 1]].coords[d] - v[element.vertices[0]].coords[d];
+    }
+  }
+  return (edges[0][0] * (edges[1][1] * edges[2][2] - edges[1][2] * edges[2][1]) -
+          edges[0][1] * (edges[1][0] * edges[2][2] - edges[1][2] * edges[2][0]) +
+          edges[0][2] * (edges[1][0] * edges[2][1] - edges[1][1] * edges[2][0])) /
+         6.0;
+}
+} // namespace
+
+TEST_CASE("Cube generator partition grid") {
+  using geometry::CubeGenerator;
+  REQUIRE(CubeGenerator::partitionGrid(1, {0, 0, 0}) == std::array<unsigned, 3>{1, 1, 1});
+  REQUIRE(CubeGenerator::partitionGrid(8, {0, 0, 0}) == std::array<unsigned, 3>{2, 2, 2});
+  REQUIRE(CubeGenerator::partitionGrid(12, {0, 0, 0}) == std::array<unsigned, 3>{3, 2, 2});
+  REQUIRE(CubeGenerator::partitionGrid(12, {0, 0, 1}) == std::array<unsigned, 3>{3, 4, 1});
+  REQUIRE(CubeGenerator::partitionGrid(6, {1, 2, 3}) == std::array<unsigned, 3>{1, 2, 3});
+}
+
+TEST_CASE("Cube generator") {
+  constexpr int NumberOfRanks = 4;
+  const std::array<unsigned, 3> numCubes = {3, 4, 2};
+  const std::array<unsigned, 3> numPartitions = {2, 2, 1};
+  constexpr double Scale = 10.0;
+  constexpr int Boundary = 5;
+
+  std::vector<std::unique_ptr<geometry::CubeGenerator>> meshes;
+  for (int rank = 0; rank < NumberOfRanks; ++rank) {
+    meshes.emplace_back(new geometry::CubeGenerator(rank, NumberOfRanks, numCubes, numPartitions, Scale, Boundary));
+  }
+
+  unsigned numElements = 0;
+  unsigned numBoundaryFaces = 0;
+  double totalVolume = 0.0;
+  for (int rank = 0; rank < NumberOfRanks; ++rank) {
+    const auto& mesh = *meshes[rank];
+    const auto& elements = mesh.getElements();
+    numElements += elements.size();
+    REQUIRE(mesh.getElementGlobalIds().size() == elements.size());
+
+    for (const auto& element : elements) {
+      const double elementVolume = volume(mesh, element);
+      // Positive orientation
+      REQUIRE(elementVolume > 0.0);
+      totalVolume += elementVolume;
+
+      for (int face = 0; face < 4; ++face) {
+        if (element.boundaries[face] != 0) {
+          REQUIRE(element.boundaries[face] == Boundary);
+          ++numBoundaryFaces;
+          continue;
+        }
+        const auto local = faceCoordinates(mesh, element, face);
+
+        // The neighbor refers back to the element and the side orientation maps the first vertex
+        const auto& neighborMesh = *meshes[element.neighborRanks[face]];
+        const Element* neighbor = nullptr;
+        if (element.neighborRanks[face] == rank) {
+          REQUIRE(element.neighbors[face] < static_cast<int>(elements.size()));
+          neighbor = &elements[element.neighbors[face]];
+          REQUIRE(neighbor->neighbors[element.neighborSides[face]] == element.localId);
+        } else {
+          REQUIRE(element.neighbors[face] == static_cast<int>(elements.size()));
+          const auto& neighborInfo = neighborMesh.getMPINeighbors().at(rank);
+          const auto& ownInfo = mesh.getMPINeighbors().at(element.neighborRanks[face]);
+          REQUIRE(neighborInfo.elements.size() == ownInfo.elements.size());
+          const auto& remote = neighborInfo.elements[element.mpiIndices[face]];
+          neighbor = &neighborMesh.getElements()[remote.localElement];
+          REQUIRE(remote.localSide == element.neighborSides[face]);
+          REQUIRE(neighbor->mpiIndices[remote.localSide] == element.mpiIndices[face]);
+        }
+        REQUIRE(neighbor->neighborSides[element.neighborSides[face]] == face);
+        const auto remote = faceCoordinates(neighborMesh, *neighbor, element.neighborSides[face]);
+        REQUIRE(remote[element.sideOrientations[face]] == local[0]);
+      }
+    }
+  }
+
+  REQUIRE(numElements == 5 * numCubes[0] * numCubes[1] * numCubes[2]);
+  REQUIRE(numBoundaryFaces ==
+          4 * (numCubes[0] * numCubes[1] + numCubes[1] * numCubes[2] + numCubes[0] * numCubes[2]));
+  REQUIRE(totalVolume == doctest::Approx(Scale * Scale * Scale));
+}
+
+} // namespace seissol::unit_test
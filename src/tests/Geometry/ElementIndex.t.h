@@ -0,0 +1,97 @@
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <vector>
+
+#include "Geometry/ElementIndex.h"
+#include "Geometry/MeshTools.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Element index") {
+  // Unit cube of n^3 sub-cubes, each split into the 6 tetrahedra around its diagonal
+  constexpr int n = 4;
+  std::vector<Vertex> vertices((n + 1) * (n + 1) * (n + 1));
+  auto vertexId = [&](int x, int y, int z) { return x + (n + 1) * (y + (n + 1) * z); };
+  for (int z = 0; z <= n; ++z) {
+    for (int y = 0; y <= n; ++y) {
+      for (int x = 0; x <= n; ++x) {
+        Vertex& vertex = vertices[vertexId(x, y, z)];
+        vertex.coords[0] = static_cast<double>(x) / n;
+        vertex.coords[1] = static_cast<double>(y) / n;
+        vertex.coords[2] = static_cast<double>(z) / n;
+      }
+    }
+  }
+
+  std::vector<Element> elements;
+  std::array<int, 3> permutations[6] = {{0, 1, 2}, {0, 2, 1}, {1, 0, 2}, {1, 2, 0}, {2, 0, 1}, {2, 1, 0}};
+  for (int z = 0; z < n; ++z) {
+    for (int y = 0; y < n; ++y) {
+      for (int x = 0; x < n; ++x) {
+        for (auto const& permutation : permutations) {
+          Element element{};
+          std::array<int, 3> corner = {x, y, z};
+          element.vertices[0] = vertexId(corner[0], corner[1], corner[2]);
+          for (int v = 0; v < 3; ++v) {
+            ++corner[permutation[v]];
+            element.vertices[v + 1] = vertexId(corner[0], corner[1], corner[2]);
+          }
+          // Positive orientation such that the face normals point outward
+          VrtxCoords a, b, c, ab;
+          MeshTools::sub(vertices[element.vertices[1]].coords, vertices[element.vertices[0]].coords, a);
+          MeshTools::sub(vertices[element.vertices[2]].coords, vertices[element.vertices[0]].coords, b);
+          MeshTools::sub(vertices[element.vertices[3]].coords, vertices[element.vertices[0]].coords, c);
+          MeshTools::cross(a, b, ab);
+          if (MeshTools::dot(ab, c) < 0.0) {
+            std::swap(element.vertices[1], element.vertices[2]);
+          }
+          elements.push_back(element);
+        }
+      }
+    }
+  }
+
+  seissol::geometry::ElementIndex const index(elements, vertices);
+
+  SUBCASE("Points inside the mesh") {
+    std::srand(321);
+    for (int i = 0; i < 100; ++i) {
+      VrtxCoords const point = {static_cast<double>(std::rand()) / RAND_MAX,
+                                static_cast<double>(std::rand()) / RAND_MAX,
+                                static_cast<double>(std::rand()) / RAND_MAX};
+      unsigned expected = seissol::geometry::ElementIndex::NotFound;
+      for (unsigned elem = 0; elem < elements.size() && expected == seissol::geometry::ElementIndex::NotFound;
+           ++elem) {
+        if (MeshTools::inside(elements[elem], vertices, point)) {
+          expected = elem;
+        }
+      }
+      REQUIRE(expected != seissol::geometry::ElementIndex::NotFound);
+      REQUIRE(index.findElement(point) == expected);
+    }
+  }
+
+  SUBCASE("Points outside the mesh") {
+    VrtxCoords const below = {0.5, 0.5, -0.1};
+    VrtxCoords const beside = {1.1, 0.5, 0.5};
+    REQUIRE(index.findElement(below) == seissol::geometry::ElementIndex::NotFound);
+    REQUIRE(index.findElement(beside) == seissol::geometry::ElementIndex::NotFound);
+  }
+
+  SUBCASE("Points on shared vertices go to the lowest element id") {
+    // The origin is only contained in the first sub-cube, the center of the cube in many elements
+    VrtxCoords const origin = {0.0, 0.0, 0.0};
+    VrtxCoords const center = {0.5, 0.5, 0.5};
+    REQUIRE(index.findElement(origin) == 0);
+    unsigned expected = seissol::geometry::ElementIndex::NotFound;
+    for (unsigned elem = 0; elem < elements.size(); ++elem) {
+      if (MeshTools::inside(elements[elem], vertices, center)) {
+        expected = std::min(expected, elem);
+      }
+    }
+    REQUIRE(index.findElement(center) == expected);
+  }
+}
+
+} // namespace seissol::unit_test
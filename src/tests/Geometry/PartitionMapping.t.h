@@ -0,0 +1,42 @@
+#include <vector>
+
+#include "Geometry/PartitionMapping.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Partition mapping") {
+  using seissol::geometry::PartitionEdge;
+
+  SUBCASE("One rank per node keeps the partitions") {
+    const std::vector<PartitionEdge> edges = {{0, 3, 10.0}, {1, 2, 5.0}, {2, 3, 1.0}};
+    const std::vector<int> nodeOfRank = {0, 1, 2, 3};
+    REQUIRE(seissol::geometry::mapPartitionsToRanks(edges, nodeOfRank) == std::vector<int>{0, 1, 2, 3});
+  }
+
+  SUBCASE("Heavy edges are kept within the nodes") {
+    // Ring 0-1-2-3-4-5 with heavy edges 0-3, 1-4 and 2-5 on 3 nodes with 2 ranks each
+    const std::vector<PartitionEdge> edges = {
+        {0, 1, 1.0}, {1, 2, 1.0}, {2, 3, 1.0}, {3, 4, 1.0}, {4, 5, 1.0}, {0, 5, 1.0},
+        {0, 3, 8.0}, {1, 4, 8.0}, {2, 5, 8.0}};
+    const std::vector<int> nodeOfRank = {0, 0, 2, 2, 4, 4};
+    const auto rankOfPartition = seissol::geometry::mapPartitionsToRanks(edges, nodeOfRank);
+
+    std::vector<int> identity = {0, 1, 2, 3, 4, 5};
+    REQUIRE(seissol::geometry::intraNodeWeight(edges, identity, nodeOfRank) == AbsApprox(1.0 + 1.0 + 1.0));
+    REQUIRE(seissol::geometry::intraNodeWeight(edges, rankOfPartition, nodeOfRank) == AbsApprox(3 * 8.0));
+    REQUIRE(rankOfPartition == std::vector<int>{0, 2, 4, 1, 3, 5});
+  }
+
+  SUBCASE("Nodes with different numbers of ranks") {
+    const std::vector<PartitionEdge> edges = {{0, 2, 4.0}, {1, 2, 3.0}, {0, 1, 1.0}};
+    const std::vector<int> nodeOfRank = {0, 1, 1};
+    const auto rankOfPartition = seissol::geometry::mapPartitionsToRanks(edges, nodeOfRank);
+    // the heaviest edge 0-2 cannot be placed on the node of rank 0; 1-2 is placed on the other node
+    REQUIRE(rankOfPartition == std::vector<int>{0, 1, 2});
+
+    const std::vector<int> otherNodeOfRank = {0, 0, 1};
+    REQUIRE(seissol::geometry::mapPartitionsToRanks(edges, otherNodeOfRank) == std::vector<int>{0, 2, 1});
+  }
+}
+
+} // namespace seissol::unit_test
@@ -1,6 +1,10 @@
 #include "doctest.h"
 #include "tests/TestHelper.h"
 
+#include "CubeGenerator.t.h"
+#include "ElementIndex.t.h"
+#include "PartitionMapping.t.h"
 #include "MeshRefiner.t.h"
 #include "TriangleRefiner.t.h"
+#include "UniformRefinement.t.h"
 #include "VariableSubsampler.t.h"
@@ -0,0 +1,110 @@
+#include <algorithm>
+#include <array>
+#include <map>
+#include <vector>
+
+#include "Geometry/MeshTools.h"
+#include "Geometry/UniformRefinement.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Uniform refinement") {
+  // Two tetrahedra sharing the face (1,2,3): side 3 of the first and side 0 of the second one
+  std::vector<Vertex> vertices(5);
+  const double coords[5][3] = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {0, 0, 1}, {1, 1, 1}};
+  for (int i = 0; i < 5; ++i) {
+    std::copy_n(coords[i], 3, vertices[i].coords);
+  }
+
+  std::vector<Element> elements(2);
+  const int cellVertices[2][4] = {{0, 1, 2, 3}, {1, 2, 3, 4}};
+  for (int c = 0; c < 2; ++c) {
+    Element& element = elements[c];
+    element.localId = c;
+    element.rank = 0;
+    element.group = c + 1;
+    std::copy_n(cellVertices[c], 4, element.vertices);
+    for (int j = 0; j < 4; ++j) {
+      element.neighbors[j] = 2;
+      element.neighborSides[j] = 0;
+      element.sideOrientations[j] = 0;
+      element.boundaries[j] = c == 0 ? 1 : 5;
+      element.neighborRanks[j] = 0;
+      element.mpiIndices[j] = 0;
+      element.mpiFaultIndices[j] = 0;
+      element.faultTags[j] = 0;
+    }
+  }
+  const int sharedSide[2] = {3, 0};
+  for (int c = 0; c < 2; ++c) {
+    elements[c].neighbors[sharedSide[c]] = 1 - c;
+    elements[c].neighborSides[sharedSide[c]] = sharedSide[1 - c];
+    elements[c].boundaries[sharedSide[c]] = 0;
+  }
+
+  std::vector<unsigned long> globalIds = {3, 7};
+  std::map<int, MPINeighbor> mpiNeighbors;
+  double volume = 0.0;
+  for (const auto& element : elements) {
+    volume += MeshTools::volume(element, vertices);
+  }
+
+  seissol::geometry::refineUniformly(0, elements, vertices, mpiNeighbors, globalIds);
+
+  // 5 corners and the midpoints of 9 edges
+  REQUIRE(elements.size() == 16);
+  REQUIRE(vertices.size() == 14);
+  REQUIRE(globalIds[0] == 24);
+  REQUIRE(globalIds[15] == 63);
+
+  double refinedVolume = 0.0;
+  std::map<int, int> boundaryFaces;
+  int sharedFaces = 0;
+  for (unsigned int i = 0; i < elements.size(); ++i) {
+    const Element& element = elements[i];
+    REQUIRE(element.localId == static_cast<int>(i));
+    REQUIRE(element.group == static_cast<int>(i / 8 + 1));
+    const double cellVolume = MeshTools::volume(element, vertices);
+    REQUIRE(cellVolume == AbsApprox(volume / 16.0 * (i < 8 ? 2.0 / 3.0 : 4.0 / 3.0)));
+    refinedVolume += cellVolume;
+
+    for (int j = 0; j < 4; ++j) {
+      if (element.neighbors[j] == static_cast<int>(elements.size())) {
+        ++boundaryFaces[element.boundaries[j]];
+        continue;
+      }
+      REQUIRE(element.boundaries[j] == 0);
+      const Element& neighbor = elements[element.neighbors[j]];
+      const int neighborSide = element.neighborSides[j];
+      REQUIRE(neighbor.neighbors[neighborSide] == static_cast<int>(i));
+      REQUIRE(neighbor.neighborSides[neighborSide] == j);
+      REQUIRE(element.vertices[MeshTools::FACE2NODES[j][0]] ==
+              neighbor.vertices[MeshTools::FACE2NODES[neighborSide][element.sideOrientations[j]]]);
+
+      std::array<int, 3> face;
+      std::array<int, 3> neighborFace;
+      for (int k = 0; k < 3; ++k) {
+        face[k] = element.vertices[MeshTools::FACE2NODES[j][k]];
+        neighborFace[k] = neighbor.vertices[MeshTools::FACE2NODES[neighborSide][k]];
+      }
+      std::sort(face.begin(), face.end());
+      std::sort(neighborFace.begin(), neighborFace.end());
+      REQUIRE(face == neighborFace);
+      if (element.neighbors[j] / 8 != static_cast<int>(i / 8)) {
+        ++sharedFaces;
+      }
+    }
+  }
+  REQUIRE(refinedVolume == AbsApprox(volume));
+  REQUIRE(boundaryFaces[1] == 12);
+  REQUIRE(boundaryFaces[5] == 12);
+  REQUIRE(sharedFaces == 8);
+
+  unsigned int vertexElements = 0;
+  for (const auto& vertex : vertices) {
+    vertexElements += vertex.elements.size();
+  }
+  REQUIRE(vertexElements == 64);
+}
+
+} // namespace seissol::unit_test
@@ -1,6 +1,7 @@
 #include <array>
 #include <iostream>
 #include <iomanip>
+#include <vector>
 
 #include <Eigen/Dense>
 
@@ -50,6 +51,19 @@ TEST_CASE("Variable Subsampler") {
     for (int i = 0; i < 36; i++) {
       REQUIRE(outDofs[i] == AbsApprox(expectedDOFs[i]).epsilon(epsilon));
     }
+
+    // All variables at once, with the variables in a different order than in the dofs
+    const std::vector<unsigned> variables = {8, 0, 3, 5, 1, 7, 2, 6, 4};
+    real outDofsBatched[36];
+    std::fill(std::begin(outDofsBatched), std::end(outDofsBatched), 0);
+    std::vector<real*> outData;
+    for (const auto var : variables) {
+      outData.push_back(&outDofsBatched[var * 4]);
+    }
+    subsampler.get(dofs.data(), cellMap, variables, outData);
+    for (int i = 0; i < 36; i++) {
+      REQUIRE(outDofsBatched[i] == AbsApprox(expectedDOFs[i]).epsilon(10 * epsilon));
+    }
   };
 };
 
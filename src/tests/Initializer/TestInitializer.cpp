@@ -1,5 +1,10 @@
 #include "doctest.h"
 #include "tests/TestHelper.h"
 
+#include "time_stepping/CellTimeSteps.t.h"
+#include "time_stepping/ClusterStatistics.t.h"
 #include "time_stepping/LTSWeights.t.h"
-#include "PointMapper.t.h"
\ No newline at end of file
+#include "time_stepping/MultiRate.t.h"
+#include "PointMapper.t.h"
+#include "ThreadLocalArena.t.h"
+
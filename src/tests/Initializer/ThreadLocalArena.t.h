@@ -0,0 +1,29 @@
+#include <cstdint>
+
+#include "Initializer/ThreadLocalArena.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Thread-local arena") {
+  using Arena = seissol::memory::ThreadLocalArena;
+  Arena::reserve(Arena::bytesFor<real>(100) + Arena::bytesFor<real>(50));
+
+  Arena::Scope outer;
+  real* first = outer.allocate<real>(100);
+  REQUIRE(reinterpret_cast<std::uintptr_t>(first) % ALIGNMENT == 0);
+
+  real* second = nullptr;
+  {
+    Arena::Scope inner;
+    second = inner.allocate<real>(50);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(second) % ALIGNMENT == 0);
+    REQUIRE(second >= first + 100);
+  }
+  {
+    // the memory of the previous scope is reused
+    Arena::Scope inner;
+    REQUIRE(inner.allocate<real>(50) == second);
+  }
+}
+
+} // namespace seissol::unit_test
@@ -0,0 +1,45 @@
+#include <cmath>
+#include <utility>
+#include <vector>
+
+#include "Initializer/time_stepping/CellTimeSteps.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("CFL time steps of cells") {
+  using namespace seissol::initializers::time_stepping;
+
+  // Unit tetrahedron and a copy scaled by 2
+  std::vector<Vertex> vertices(8);
+  const double coords[4][3] = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {0, 0, 1}};
+  for (int i = 0; i < 8; ++i) {
+    for (int d = 0; d < 3; ++d) {
+      vertices[i].coords[d] = (i < 4 ? 1.0 : 2.0) * coords[i % 4][d];
+    }
+  }
+  std::vector<Element> elements(2);
+  for (int c = 0; c < 2; ++c) {
+    for (int j = 0; j < 4; ++j) {
+      elements[c].vertices[j] = 4 * c + j;
+    }
+  }
+
+  Eigen::Vector3d x[4];
+  for (int i = 0; i < 4; ++i) {
+    x[i] = Eigen::Vector3d(vertices[i].coords);
+  }
+  const double insphere = 1.0 / (3.0 + std::sqrt(3.0));
+  REQUIRE(insphereRadius(x) == AbsApprox(insphere));
+  // The radius does not depend on the orientation
+  std::swap(x[1], x[2]);
+  REQUIRE(insphereRadius(x) == AbsApprox(insphere));
+
+  const double waveSpeeds[2] = {2.0, 1.0};
+  const std::vector<double> timeSteps = computeCellTimeSteps(elements, vertices, waveSpeeds);
+  REQUIRE(timeSteps.size() == 2);
+  REQUIRE(timeSteps[0] == AbsApprox(insphere / (2 * CONVERGENCE_ORDER - 1)));
+  REQUIRE(timeSteps[1] == AbsApprox(4.0 * timeSteps[0]));
+  REQUIRE(cflTimeStep(insphere, 2.0) == AbsApprox(timeSteps[0]));
+}
+
+} // namespace seissol::unit_test
@@ -0,0 +1,49 @@
+#include <sstream>
+#include <stdexcept>
+
+#include "Initializer/time_stepping/ClusterStatistics.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Cluster statistics") {
+  using namespace seissol::initializers::time_stepping;
+
+  ClusterLayerStatistics copy;
+  copy.globalClusterId = 2;
+  copy.copy = true;
+  copy.timeStepWidth = 0.25;
+  copy.numberOfCells = 3;
+  copy.numberOfCellsWithDerivatives = 1;
+  copy.numberOfDerivativeFaces = 2;
+  copy.numberOfFaces[static_cast<unsigned>(FaceType::regular)] = 9;
+  copy.numberOfFaces[static_cast<unsigned>(FaceType::dynamicRupture)] = 2;
+  copy.numberOfFaces[static_cast<unsigned>(FaceType::outflow)] = 1;
+  copy.numberOfDynamicRuptureFaces = 1;
+  copy.numberOfGhostCells = 4;
+  copy.numberOfRegions = 2;
+  copy.plasticity = true;
+
+  const std::string csv = formatClusterStatistics({copy});
+  REQUIRE(csv == "cluster,layer,time_step_width,cells,cells_with_derivatives,derivative_faces,regular,free_surface,"
+                 "free_surface_gravity,dynamic_rupture,dirichlet,outflow,periodic,analytical,dr_faces,ghost_cells,"
+                 "regions,plasticity\n"
+                 "2,copy,0.25,3,1,2,9,0,0,2,0,1,0,0,1,4,2,1\n");
+
+  std::istringstream stream(csv);
+  const auto parsed = parseClusterStatistics(stream);
+  REQUIRE(parsed.size() == 1);
+  REQUIRE(parsed[0].globalClusterId == 2);
+  REQUIRE(parsed[0].copy);
+  REQUIRE(parsed[0].timeStepWidth == 0.25);
+  REQUIRE(parsed[0].numberOfFaces == copy.numberOfFaces);
+  REQUIRE(parsed[0].numberOfDynamicRuptureFaces == 1);
+  REQUIRE(parsed[0].numberOfGhostCells == 4);
+  REQUIRE(parsed[0].numberOfRegions == 2);
+  REQUIRE(parsed[0].plasticity);
+
+  std::istringstream invalid("cluster,layer\n1,interior\n");
+  REQUIRE_THROWS_AS(parseClusterStatistics(invalid), std::runtime_error);
+  std::istringstream truncated(csv.substr(0, csv.size() - 4) + "\n");
+  REQUIRE_THROWS_AS(parseClusterStatistics(truncated), std::runtime_error);
+}
+} // namespace seissol::unit_test
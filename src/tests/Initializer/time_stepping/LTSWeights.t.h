@@ -23,4 +23,43 @@ TEST_CASE("LTS Weights") {
 #endif
 }
 
+TEST_CASE("LTS Weights with edge weights") {
+#ifdef USE_MPI
+  using namespace seissol::initializers::time_stepping;
+  // Dynamic rupture edge weights only and additionally the communication volume
+  LtsWeightsConfig dynamicRuptureConfig{"Testing/material.yaml", 2, 1, 1, 1, 10};
+  LtsWeightsConfig communicationConfig{"Testing/material.yaml", 2, 1, 1, 1, 10, false, true};
+
+  for (const auto& config : {dynamicRuptureConfig, communicationConfig}) {
+    std::cout.setstate(std::ios_base::failbit);
+    auto ltsWeights = std::make_unique<ExponentialWeights>(config);
+    seissol::PUMLReader pumlReader("Testing/mesh.h5", 5000.0, "", ltsWeights.get());
+    std::cout.clear();
+
+    // The dual graph is symmetric, including the edge weights
+    const auto& graph = ltsWeights->dualGraph();
+    REQUIRE(graph.offsets.size() == 25);
+    for (int64_t cell = 0; cell < 24; ++cell) {
+      REQUIRE(graph.offsets[cell + 1] - graph.offsets[cell] <= 4);
+      for (auto edge = graph.offsets[cell]; edge < graph.offsets[cell + 1]; ++edge) {
+        const auto neighbor = graph.neighbors[edge];
+        if (config.communicationEdgeWeights) {
+          REQUIRE(graph.edgeWeights[edge] > 1);
+        } else {
+          REQUIRE((graph.edgeWeights[edge] == 1 || graph.edgeWeights[edge] == 10));
+        }
+        bool found = false;
+        for (auto back = graph.offsets[neighbor]; back < graph.offsets[neighbor + 1]; ++back) {
+          if (graph.neighbors[back] == cell) {
+            found = true;
+            REQUIRE(graph.edgeWeights[back] == graph.edgeWeights[edge]);
+          }
+        }
+        REQUIRE(found);
+      }
+    }
+  }
+#endif
+}
+
 } // namespace seissol::unit_test
\ No newline at end of file
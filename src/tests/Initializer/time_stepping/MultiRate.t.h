@@ -0,0 +1,28 @@
+#include <vector>
+
+#include "Initializer/time_stepping/MultiRate.hpp"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Multi-rate wiggle factor costs") {
+  using namespace seissol::initializers::time_stepping;
+
+  // three cells just below twice the minimum time step width move to the second cluster with factor 0.99
+  const std::vector<double> timeStepWidths = {1.0, 1.99, 1.99, 1.99};
+  const auto costs = MultiRate::wiggleFactorCosts(timeStepWidths.size(), timeStepWidths.data(), 1.0, 2, 0.99);
+
+  REQUIRE(costs.size() == 2);
+  REQUIRE(costs[0] == AbsApprox(4.0));
+  REQUIRE(costs[1] == AbsApprox(1.0 / 0.99 + 3.0 / 1.98).epsilon(1e-12));
+}
+
+TEST_CASE("Multi-rate fastest cluster speedup") {
+  using namespace seissol::initializers::time_stepping;
+
+  const unsigned int rates[] = {2, 2, 1};
+  REQUIRE(MultiRate::fastestClusterSpeedup({5.0}, rates) == 1.0);
+  REQUIRE(MultiRate::fastestClusterSpeedup({10.0, 90.0}, rates) == AbsApprox(110.0 / 100.0));
+  // a single cell in the fastest cluster, the second cluster is empty
+  REQUIRE(MultiRate::fastestClusterSpeedup({1.0, 0.0, 99.0}, rates) == AbsApprox(103.0 / 101.0));
+}
+} // namespace seissol::unit_test
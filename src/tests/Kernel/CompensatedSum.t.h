@@ -0,0 +1,32 @@
+#include <cmath>
+#include <limits>
+
+#include "Kernels/denseMatrixOps.hpp"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Compensated summation") {
+  constexpr unsigned NumberOfSteps = 1000000;
+  // The second increment is too small to change the sum by itself
+  const real increments[2] = {static_cast<real>(0.1), std::numeric_limits<real>::epsilon() / 4};
+  const double expected[2] = {NumberOfSteps * static_cast<double>(increments[0]),
+                              1.0 + NumberOfSteps * static_cast<double>(increments[1])};
+
+  real sums[2] = {0, 1};
+  real compensations[2] = {0, 0};
+  real naive[2] = {0, 1};
+  for (unsigned step = 0; step < NumberOfSteps; ++step) {
+    seissol::kernels::compensatedAdd(2, increments, sums, compensations);
+    naive[0] += increments[0];
+    naive[1] += increments[1];
+  }
+
+  constexpr double Epsilon = std::numeric_limits<real>::epsilon();
+  for (unsigned i = 0; i < 2; ++i) {
+    REQUIRE(std::abs(sums[i] - expected[i]) <= 4 * Epsilon * expected[i]);
+  }
+  REQUIRE(naive[1] == 1);
+  REQUIRE(sums[1] > 1);
+}
+
+} // namespace seissol::unit_test
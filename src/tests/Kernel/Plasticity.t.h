@@ -0,0 +1,146 @@
+#include <algorithm>
+#include <limits>
+#include <random>
+
+#include "Initializer/typedefs.hpp"
+#include "Kernels/Plasticity.h"
+#include "generated_code/init.h"
+#include "generated_code/tensor.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Plasticity yield check is conservative") {
+  alignas(ALIGNMENT) real vandermondeMatrix[tensor::v::size()];
+  alignas(ALIGNMENT) real vandermondeMatrixInverse[tensor::vInv::size()];
+  std::copy_n(init::v::Values, tensor::v::size(), vandermondeMatrix);
+  std::copy_n(init::vInv::Values, tensor::vInv::size(), vandermondeMatrixInverse);
+  GlobalData global;
+  global.vandermondeMatrix = vandermondeMatrix;
+  global.vandermondeMatrixInverse = vandermondeMatrixInverse;
+
+  PlasticityData plasticityData{};
+  const real initialLoading[6] = {-50.0e6, -60.0e6, -70.0e6, 5.0e6, -2.0e6, 1.0e6};
+  std::copy_n(initialLoading, 6, plasticityData.initialLoading);
+  plasticityData.cohesionTimesCosAngularFriction = 1.0e6;
+  plasticityData.sinAngularFriction = 0.5;
+  plasticityData.mufactor = 1.0 / (2.0 * 30.0e9);
+
+  std::mt19937 generator(20220714);
+  std::uniform_real_distribution<real> distribution(-1.0, 1.0);
+  alignas(ALIGNMENT) real dofs[tensor::Q::size()];
+  real pstrain[7 * NUMBER_OF_ALIGNED_BASIS_FUNCTIONS];
+
+  // Perturbations from far below to far above the yield stress
+  for (const real scale : {1.0e3, 1.0e5, 1.0e6, 3.0e6, 1.0e7, 1.0e8}) {
+    for (unsigned trial = 0; trial < 20; ++trial) {
+      for (unsigned i = 0; i < tensor::Q::size(); ++i) {
+        dofs[i] = scale * distribution(generator);
+      }
+      std::fill(pstrain, pstrain + 7 * NUMBER_OF_ALIGNED_BASIS_FUNCTIONS, 0.0);
+
+      const bool isYieldingPossible = seissol::kernels::Plasticity::isYieldingPossible(&global, &plasticityData, dofs);
+      const unsigned isYielding =
+          seissol::kernels::Plasticity::computePlasticity(0.5, 1.0e-3, 0.05, &global, &plasticityData, dofs, pstrain);
+      if (isYielding != 0) {
+        REQUIRE(isYieldingPossible);
+      }
+      if (scale <= 1.0e3) {
+        REQUIRE(!isYieldingPossible);
+      }
+    }
+  }
+}
+
+TEST_CASE("Cells with an infinite cohesion are elastic") {
+  alignas(ALIGNMENT) real vandermondeMatrix[tensor::v::size()];
+  alignas(ALIGNMENT) real vandermondeMatrixInverse[tensor::vInv::size()];
+  std::copy_n(init::v::Values, tensor::v::size(), vandermondeMatrix);
+  std::copy_n(init::vInv::Values, tensor::vInv::size(), vandermondeMatrixInverse);
+  GlobalData global;
+  global.vandermondeMatrix = vandermondeMatrix;
+  global.vandermondeMatrixInverse = vandermondeMatrixInverse;
+
+  PlasticityData plasticityData{};
+  const real initialLoading[6] = {-50.0e6, -60.0e6, -70.0e6, 5.0e6, -2.0e6, 1.0e6};
+  std::copy_n(initialLoading, 6, plasticityData.initialLoading);
+  plasticityData.cohesionTimesCosAngularFriction = 1.0e6;
+  plasticityData.sinAngularFriction = 0.5;
+  plasticityData.mufactor = 1.0 / (2.0 * 30.0e9);
+
+  REQUIRE(seissol::kernels::Plasticity::isPlasticCell(&plasticityData));
+
+  plasticityData.cohesionTimesCosAngularFriction = std::numeric_limits<real>::infinity();
+  REQUIRE(!seissol::kernels::Plasticity::isPlasticCell(&plasticityData));
+
+  // The cells outside of the plastic regions would not yield either
+  alignas(ALIGNMENT) real dofs[tensor::Q::size()];
+  real pstrain[7 * NUMBER_OF_ALIGNED_BASIS_FUNCTIONS] = {};
+  for (unsigned i = 0; i < tensor::Q::size(); ++i) {
+    dofs[i] = (i % 7) * 1.0e8;
+  }
+  REQUIRE(seissol::kernels::Plasticity::computePlasticity(0.5, 1.0e-3, 0.05, &global, &plasticityData, dofs, pstrain) ==
+          0);
+}
+
+TEST_CASE("Blocked plasticity matches the plasticity of single cells") {
+  alignas(ALIGNMENT) real vandermondeMatrix[tensor::v::size()];
+  alignas(ALIGNMENT) real vandermondeMatrixInverse[tensor::vInv::size()];
+  std::copy_n(init::v::Values, tensor::v::size(), vandermondeMatrix);
+  std::copy_n(init::vInv::Values, tensor::vInv::size(), vandermondeMatrixInverse);
+  GlobalData global;
+  global.vandermondeMatrix = vandermondeMatrix;
+  global.vandermondeMatrixInverse = vandermondeMatrixInverse;
+
+  PlasticityData plasticityData{};
+  const real initialLoading[6] = {-50.0e6, -60.0e6, -70.0e6, 5.0e6, -2.0e6, 1.0e6};
+  std::copy_n(initialLoading, 6, plasticityData.initialLoading);
+  plasticityData.cohesionTimesCosAngularFriction = 1.0e6;
+  plasticityData.sinAngularFriction = 0.5;
+  plasticityData.mufactor = 1.0 / (2.0 * 30.0e9);
+
+  constexpr unsigned blockSize = seissol::kernels::Plasticity::BlockSize;
+  constexpr unsigned pstrainSize = 7 * NUMBER_OF_ALIGNED_BASIS_FUNCTIONS;
+  alignas(ALIGNMENT) real dofs[blockSize][tensor::Q::size()];
+  alignas(ALIGNMENT) real dofsBlocked[blockSize][tensor::Q::size()];
+  real pstrain[blockSize][pstrainSize] = {};
+  real pstrainBlocked[blockSize][pstrainSize] = {};
+
+  // Every second cell yields
+  std::mt19937 generator(20220715);
+  std::uniform_real_distribution<real> distribution(-1.0, 1.0);
+  for (unsigned cell = 0; cell < blockSize; ++cell) {
+    const real scale = (cell % 2 == 0) ? 1.0e3 : 1.0e8;
+    for (unsigned i = 0; i < tensor::Q::size(); ++i) {
+      dofs[cell][i] = dofsBlocked[cell][i] = scale * distribution(generator);
+    }
+  }
+
+  unsigned numberOfYieldingCells = 0;
+  for (unsigned cell = 0; cell < blockSize; ++cell) {
+    numberOfYieldingCells += seissol::kernels::Plasticity::computePlasticity(
+        0.5, 1.0e-3, 0.05, &global, &plasticityData, dofs[cell], pstrain[cell]);
+  }
+
+  PlasticityData const* blockPlasticity[blockSize];
+  real* blockDofs[blockSize];
+  real* blockPstrain[blockSize];
+  for (unsigned cell = 0; cell < blockSize; ++cell) {
+    blockPlasticity[cell] = &plasticityData;
+    blockDofs[cell] = dofsBlocked[cell];
+    blockPstrain[cell] = pstrainBlocked[cell];
+  }
+  const unsigned numberOfYieldingCellsBlocked = seissol::kernels::Plasticity::computePlasticityBlock(
+      0.5, 1.0e-3, 0.05, &global, blockSize, blockPlasticity, blockDofs, blockPstrain);
+
+  REQUIRE(numberOfYieldingCellsBlocked == numberOfYieldingCells);
+  for (unsigned cell = 0; cell < blockSize; ++cell) {
+    for (unsigned i = 0; i < tensor::Q::size(); ++i) {
+      REQUIRE(dofsBlocked[cell][i] == dofs[cell][i]);
+    }
+    for (unsigned i = 0; i < pstrainSize; ++i) {
+      REQUIRE(pstrainBlocked[cell][i] == pstrain[cell][i]);
+    }
+  }
+}
+
+} // namespace seissol::unit_test
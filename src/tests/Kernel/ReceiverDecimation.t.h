@@ -0,0 +1,59 @@
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "Kernels/ReceiverDecimation.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Receiver decimation") {
+  using namespace seissol::kernels;
+
+  constexpr double SamplingInterval = 0.01;
+  constexpr unsigned Factor = 10;
+  const auto filter = std::make_shared<DecimationFilter const>(SamplingInterval, Factor);
+  REQUIRE(filter->outputInterval() == AbsApprox(0.1));
+
+  // Channels: constant, sine at 0.2 and at 1.6 times the output Nyquist frequency (5 Hz)
+  const double frequencies[2] = {1.0, 8.0};
+  auto signal = [&](double time, real* values) {
+    values[0] = 3.0;
+    values[1] = std::sin(2.0 * M_PI * frequencies[0] * time);
+    values[2] = std::sin(2.0 * M_PI * frequencies[1] * time);
+  };
+
+  // The second series misses every 7th sample and repeats the one before instead
+  DecimatedSeries series(filter, 3);
+  DecimatedSeries seriesWithGaps(filter, 3);
+  std::vector<real> output;
+  std::vector<real> outputWithGaps;
+  real values[3];
+  constexpr unsigned NumberOfSamples = 1000;
+  for (unsigned i = 0; i < NumberOfSamples; ++i) {
+    signal(i * SamplingInterval, values);
+    series.push(i * SamplingInterval, values, output);
+    const unsigned sample = (i % 7 == 6) ? i - 1 : i;
+    signal(sample * SamplingInterval, values);
+    seriesWithGaps.push(sample * SamplingInterval, values, outputWithGaps);
+  }
+
+  // The last 16 output samples are not complete yet
+  const unsigned numberOfOutputs = output.size() / 4;
+  REQUIRE(output.size() % 4 == 0);
+  REQUIRE(numberOfOutputs == (NumberOfSamples - 1) / Factor + 1 - 16);
+  REQUIRE(outputWithGaps.size() == output.size());
+  for (unsigned i = 0; i < numberOfOutputs; ++i) {
+    const double time = output[4 * i];
+    REQUIRE(time == AbsApprox(i * 0.1).epsilon(1.0e-5));
+    REQUIRE(outputWithGaps[4 * i] == AbsApprox(time).epsilon(1.0e-5));
+    REQUIRE(output[4 * i + 1] == AbsApprox(3.0).epsilon(1.0e-5));
+    // No phase shift in the pass band and no aliasing from the stop band (away from the start)
+    if (time > 2.0) {
+      REQUIRE(std::abs(output[4 * i + 2] - std::sin(2.0 * M_PI * frequencies[0] * time)) < 1.0e-4);
+      REQUIRE(std::abs(output[4 * i + 3]) < 1.0e-4);
+      REQUIRE(std::abs(outputWithGaps[4 * i + 2] - output[4 * i + 2]) < 0.05);
+    }
+  }
+}
+
+} // namespace seissol::unit_test
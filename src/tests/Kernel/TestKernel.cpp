@@ -1,4 +1,10 @@
 #include "doctest.h"
+#include "tests/TestHelper.h"
+
+#include "CompensatedSum.t.h"
+#include "Plasticity.t.h"
+#include "ReceiverDecimation.t.h"
+#include "TimeIntegrals.t.h"
 
 #ifdef USE_POROELASTIC
 #include "STP.t.h"
@@ -0,0 +1,49 @@
+#include <cmath>
+#include <limits>
+#include <random>
+
+#include "Kernels/Time.h"
+#include "Kernels/TimeCommon.h"
+#include "generated_code/tensor.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Neighbors integrate compacted buffers from their derivatives") {
+  // A cell of a cluster in its second step within the step of the next slower cluster
+  constexpr double TimeStepWidth = 0.01;
+  constexpr double SubTimeStart = TimeStepWidth;
+  constexpr unsigned DerivativesSize = yateto::computeFamilySize<tensor::dQ>();
+
+  std::mt19937 generator(20240312);
+  std::uniform_real_distribution<real> distribution(-1.0, 1.0);
+  alignas(ALIGNMENT) real derivatives[DerivativesSize];
+  for (unsigned i = 0; i < DerivativesSize; ++i) {
+    derivatives[i] = distribution(generator);
+  }
+
+  // The buffer which SEISSOL_COMPACT_BUFFERS=1 removes integrates the current step of the neighbor
+  seissol::kernels::Time timeKernel;
+  alignas(ALIGNMENT) real buffer[tensor::I::size()];
+  timeKernel.computeIntegral(0.0, 0.0, TimeStepWidth, derivatives, buffer);
+  alignas(ALIGNMENT) real slowerNeighbor[tensor::I::size()];
+  timeKernel.computeIntegral(0.0, SubTimeStart, SubTimeStart + TimeStepWidth, derivatives, slowerNeighbor);
+
+  // Face 0 reads the buffer, face 1 the derivatives of a neighbor in the same cluster (GTS on derivatives),
+  // and face 2 the derivatives of a neighbor in the next slower cluster
+  const FaceType faceTypes[4] = {FaceType::regular, FaceType::regular, FaceType::regular, FaceType::outflow};
+  const unsigned short ltsSetup = (1 << 1) | (1 << 2) | (1 << 4) | (1 << 5);
+  real* const timeDofs[4] = {buffer, derivatives, derivatives, nullptr};
+  alignas(ALIGNMENT) real integrationBuffer[4][tensor::I::size()];
+  real* timeIntegrated[4];
+  seissol::kernels::TimeCommon::computeIntegrals(
+      timeKernel, ltsSetup, faceTypes, SubTimeStart, TimeStepWidth, timeDofs, integrationBuffer, timeIntegrated);
+
+  REQUIRE(timeIntegrated[0] == buffer);
+  constexpr double Epsilon = 100 * std::numeric_limits<real>::epsilon();
+  for (unsigned i = 0; i < tensor::I::size(); ++i) {
+    REQUIRE(std::abs(timeIntegrated[1][i] - buffer[i]) <= Epsilon * (1.0 + std::abs(buffer[i])));
+    REQUIRE(std::abs(timeIntegrated[2][i] - slowerNeighbor[i]) <= Epsilon * (1.0 + std::abs(slowerNeighbor[i])));
+  }
+}
+
+} // namespace seissol::unit_test
@@ -0,0 +1,37 @@
+#include <cmath>
+
+#include <Physics/AbsorbingLayer.h>
+
+namespace seissol::unit_test {
+TEST_CASE("Damping of the absorbing layer") {
+  physics::AbsorbingLayer absorbingLayer;
+  absorbingLayer.interior = {-1.0, 1.0, -2.0, 2.0, -3.0, 0.0};
+  const double waveSpeed = 2.0;
+
+  SUBCASE("No damping without a layer") {
+    const double outside[3] = {5.0, 0.0, 0.0};
+    REQUIRE(absorbingLayer.damping(outside, waveSpeed) == 0.0);
+  }
+
+  absorbingLayer.width = 2.0;
+  absorbingLayer.reflection = 1e-3;
+  const double maximumDamping = 3.0 * waveSpeed * std::log(1e3) / (2.0 * absorbingLayer.width);
+
+  SUBCASE("No damping in the region of interest") {
+    const double inside[3] = {0.5, -2.0, -1.0};
+    REQUIRE(absorbingLayer.damping(inside, waveSpeed) == 0.0);
+  }
+
+  SUBCASE("Quadratic profile in the layer") {
+    const double face[3] = {0.0, 3.0, -1.0};
+    REQUIRE(absorbingLayer.damping(face, waveSpeed) == doctest::Approx(0.25 * maximumDamping));
+    const double edge[3] = {2.0, 0.0, 1.0};
+    REQUIRE(absorbingLayer.damping(edge, waveSpeed) == doctest::Approx(0.5 * maximumDamping));
+  }
+
+  SUBCASE("Maximal damping beyond the layer") {
+    const double beyond[3] = {0.0, 0.0, -10.0};
+    REQUIRE(absorbingLayer.damping(beyond, waveSpeed) == doctest::Approx(maximumDamping));
+  }
+}
+} // namespace seissol::unit_test
@@ -80,4 +80,30 @@ TEST_CASE("Godunov state is correct") {
   test_matrix(QgodLocal, solution_heterogeneous_local, epsilon);
   test_matrix(QgodNeighbor, solution_heterogeneous_neighbor, epsilon);
 }
+
+#ifdef USE_ANISOTROPIC
+TEST_CASE("Anisotropic Godunov state matches the isotropic closed form") {
+  constexpr real epsilon = 1e2 * std::numeric_limits<real>::epsilon();
+
+  real localData[tensor::QgodLocal::size()];
+  real neighborData[tensor::QgodLocal::size()];
+  init::QgodLocal::view::type QgodLocal = init::QgodLocal::view::create(localData);
+  init::QgodNeighbor::view::type QgodNeighbor = init::QgodNeighbor::view::create(neighborData);
+  QgodLocal.setZero();
+  QgodNeighbor.setZero();
+
+  model::AnisotropicMaterial local(materialVal_1, 22);
+  model::AnisotropicMaterial neighbor(materialVal_2, 22);
+  model::ElasticMaterial isotropic;
+  REQUIRE(model::getIsotropicMaterial(local, isotropic));
+
+  // the general path has to agree with the closed form used for isotropic materials
+  model::getTransposedAnisotropicGodunovState(local, neighbor, FaceType::regular, QgodLocal, QgodNeighbor);
+  test_matrix(QgodLocal, solution_heterogeneous_local, epsilon);
+  test_matrix(QgodNeighbor, solution_heterogeneous_neighbor, epsilon);
+
+  local.c16 = 0.1 * local.c44;
+  REQUIRE(!model::getIsotropicMaterial(local, isotropic));
+}
+#endif
 } // namespace seissol::unit_test
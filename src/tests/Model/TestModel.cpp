@@ -1,3 +1,4 @@
 #include "doctest.h"
 
+#include "AbsorbingLayer.t.h"
 #include "GodunovState.t.h"
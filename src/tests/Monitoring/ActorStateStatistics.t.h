@@ -0,0 +1,59 @@
+#include "Monitoring/ActorStateStatistics.h"
+
+namespace seissol::unit_test {
+
+namespace {
+TimeInterval secondsInterval(long begin, long end) {
+  TimeInterval result;
+  result.begin = {begin, 0};
+  result.end = {end, 0};
+  return result;
+}
+} // namespace
+
+TEST_CASE("Overlap of communication and computation") {
+  constexpr long long Second = 1000000000LL;
+  OverlapAccumulator accumulator;
+  // Two clusters compute in [0, 3) and [2, 4), the MPI requests are in flight in [1, 6)
+  accumulator.addComputation(secondsInterval(0, 3));
+  accumulator.addComputation(secondsInterval(2, 4));
+  accumulator.addCommunication(secondsInterval(1, 6));
+
+  auto total = accumulator.total();
+  REQUIRE(total.computation == 4 * Second);
+  REQUIRE(total.communication == 5 * Second);
+  REQUIRE(total.exposedCommunication == 2 * Second);
+
+  auto taken = accumulator.take();
+  REQUIRE(taken.communication == 5 * Second);
+  REQUIRE(taken.exposedCommunication == 2 * Second);
+
+  // Only the new intervals are taken, but all of them are in the total
+  accumulator.addCommunication(secondsInterval(10, 11));
+  taken = accumulator.take();
+  REQUIRE(taken.communication == 1 * Second);
+  REQUIRE(taken.exposedCommunication == 1 * Second);
+  total = accumulator.total();
+  REQUIRE(total.computation == 4 * Second);
+  REQUIRE(total.communication == 6 * Second);
+  REQUIRE(total.exposedCommunication == 3 * Second);
+}
+
+TEST_CASE("Overlap is folded in batches of bounded size") {
+  constexpr long long Second = 1000000000LL;
+  constexpr long long NumberOfIntervals = 3 * OverlapAccumulator::BatchSize;
+  OverlapAccumulator accumulator;
+  for (long long i = 0; i < NumberOfIntervals; ++i) {
+    accumulator.addComputation(secondsInterval(2 * i, 2 * i + 1));
+    accumulator.addCommunication(secondsInterval(2 * i, 2 * i + 2));
+  }
+  const auto total = accumulator.total();
+  REQUIRE(total.computation == NumberOfIntervals * Second);
+  REQUIRE(total.communication == 2 * NumberOfIntervals * Second);
+  // The computation of the last interval of a batch is folded before the communication is added
+  const long long numberOfBatches = NumberOfIntervals / OverlapAccumulator::BatchSize;
+  REQUIRE(total.exposedCommunication >= NumberOfIntervals * Second);
+  REQUIRE(total.exposedCommunication <= (NumberOfIntervals + numberOfBatches) * Second);
+}
+
+} // namespace seissol::unit_test
@@ -0,0 +1,20 @@
+#include <stdexcept>
+#include <string>
+
+#include "Monitoring/HardwareCounters.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Hardware counter events") {
+  const auto events = seissol::HardwareCounters::parseEvents(" cycles, Instructions,,r01C7");
+  REQUIRE(events.size() == 3);
+  REQUIRE(events[0].name == "cycles");
+  REQUIRE(events[1].name == "instructions");
+  REQUIRE(events[2].name == "r01c7");
+  REQUIRE(events[2].config == 0x01c7);
+  REQUIRE(events[0].type != events[2].type);
+
+  REQUIRE_THROWS_AS(seissol::HardwareCounters::parseEvents("cycles,flops"), std::invalid_argument);
+  REQUIRE_THROWS_AS(seissol::HardwareCounters::parseEvents("r"), std::invalid_argument);
+}
+} // namespace seissol::unit_test
@@ -0,0 +1,33 @@
+#include "Monitoring/RegionCommunication.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Region communication") {
+  RegionCommunication region;
+  region.rank = 1;
+  region.neighborRank = 3;
+  region.globalClusterId = 0;
+  region.neighborClusterId = 1;
+  region.sendBytes = 1000;
+  region.receiveBytes = 500;
+
+  REQUIRE(region.meanLatency(false) == 0.0);
+  REQUIRE(region.bandwidth(true) == 0.0);
+
+  region.addMessage(false, 1000000);
+  region.addMessage(false, 3000000);
+  region.addMessage(true, 500000);
+  REQUIRE(region.numberOfSends == 2);
+  REQUIRE(region.numberOfReceives == 1);
+  REQUIRE(region.meanLatency(false) == AbsApprox(0.002));
+  REQUIRE(region.bandwidth(false) == AbsApprox(500000.0));
+  REQUIRE(region.meanLatency(true) == AbsApprox(0.0005));
+  REQUIRE(region.bandwidth(true) == AbsApprox(1000000.0));
+
+  REQUIRE(formatRegionCommunication({region}) ==
+          "rank,neighbor_rank,cluster,neighbor_cluster,direction,messages,bytes_per_message,mean_latency,bandwidth\n"
+          "1,3,0,1,send,2,1000,0.002,500000\n"
+          "1,3,0,1,receive,1,500,0.0005,1e+06\n");
+}
+
+} // namespace seissol::unit_test
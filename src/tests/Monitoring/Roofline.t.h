@@ -0,0 +1,32 @@
+#include <string>
+#include <vector>
+
+#include "Monitoring/Roofline.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Roofline classification") {
+  // Ridge point at 10 flop/byte
+  REQUIRE(std::string(seissol::Roofline::bound(2.0, 1000.0, 100.0)) == "bandwidth");
+  REQUIRE(std::string(seissol::Roofline::bound(20.0, 1000.0, 100.0)) == "compute");
+  REQUIRE(std::string(seissol::Roofline::bound(20.0, 0.0, 0.0)) == "unknown");
+
+  seissol::RooflineCounters counters;
+  counters.add(1.0, 50e9, 25e9);
+  counters.add(1.0, 50e9, 25e9);
+  // 50 GFLOPS at 2 flop/byte, where 200 GFLOPS are attainable
+  REQUIRE(seissol::Roofline::efficiency(counters, 1000.0, 100.0) == doctest::Approx(0.25));
+}
+
+TEST_CASE("Roofline report") {
+  seissol::RooflineEntry entry;
+  entry.cluster = 1;
+  entry.layer = "copy";
+  entry.kernel = seissol::RooflineKernel::Neighbor;
+  entry.counters.add(2.0, 8e9, 1e9);
+
+  const std::string csv = seissol::Roofline::formatCsv({entry}, 1000.0, 100.0);
+  REQUIRE(csv == "cluster,layer,kernel,time,hardware_flops,bytes,gflops,gbytes_per_second,intensity,bound,efficiency\n"
+                 "1,copy,neighbor,2,8000000000,1000000000,4,0.5,8,bandwidth,0.005\n");
+}
+} // namespace seissol::unit_test
@@ -0,0 +1,37 @@
+#include <string>
+#include <vector>
+
+#include "Monitoring/ScalingReport.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Scaling report") {
+  std::vector<seissol::ScalingSample> samples(2);
+  samples[0] = {100, 1000.0, 4.0, 3.0, 1.0, 0.5};
+  samples[1] = {120, 1200.0, 5.0, 5.0, 2.0, 0.0};
+
+  const std::string json = seissol::ScalingReport::formatJson(samples, 10, 0.5, 1, 4);
+  REQUIRE(json == "{\n"
+                  "  \"ranks\": 2,\n"
+                  "  \"threads_per_rank\": 4,\n"
+                  "  \"cells\": 220,\n"
+                  "  \"clusters\": 1,\n"
+                  "  \"time_steps\": 10,\n"
+                  "  \"simulated_time\": 0.5,\n"
+                  "  \"wall_time\": 5,\n"
+                  "  \"time_per_step\": 0.5,\n"
+                  "  \"cell_updates_per_second\": 440,\n"
+                  "  \"cells_per_rank\": {\"min\": 100, \"mean\": 110, \"max\": 120},\n"
+                  "  \"compute_time\": {\"min\": 3, \"mean\": 4, \"max\": 5},\n"
+                  "  \"communication_time\": {\"min\": 1, \"mean\": 1.5, \"max\": 2},\n"
+                  "  \"communication_wait\": {\"min\": 0, \"mean\": 0.25, \"max\": 0.5},\n"
+                  "  \"imbalance\": 0.25,\n"
+                  "  \"per_rank\": [\n"
+                  "    {\"rank\": 0, \"cells\": 100, \"wall_time\": 4, \"compute_time\": 3, \"communication_time\": 1, "
+                  "\"communication_wait\": 0.5},\n"
+                  "    {\"rank\": 1, \"cells\": 120, \"wall_time\": 5, \"compute_time\": 5, \"communication_time\": 2, "
+                  "\"communication_wait\": 0}\n"
+                  "  ]\n"
+                  "}\n");
+}
+} // namespace seissol::unit_test
@@ -0,0 +1,33 @@
+#include <vector>
+
+#include "Monitoring/StartupEstimate.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Startup estimate") {
+  // rank 0: 10 cells with the time step 1 (100 flops per update), 20 cells with the time step 2 (200 flops)
+  seissol::StartupEstimate first;
+  first.addCluster(1.0, 10, 100.0, 8.0);
+  first.addCluster(2.0, 20, 200.0, 0.0);
+  // rank 1: 30 cells with the time step 2 (300 flops per update)
+  seissol::StartupEstimate second;
+  second.addCluster(2.0, 30, 300.0, 4.0);
+
+  REQUIRE(first.sample().cells == 30);
+  REQUIRE(first.sample().minTimeStepWidth == 1.0);
+  REQUIRE(first.sample().cellUpdates == AbsApprox(20.0));
+  REQUIRE(first.sample().flops == AbsApprox(200.0));
+
+  const auto summary = seissol::StartupEstimate::summarize({first.sample(), second.sample()}, 1.e-7);
+  REQUIRE(summary.cellUpdates == AbsApprox(35.0));
+  REQUIRE(summary.flops == AbsApprox(350.0));
+  // 600 flops per time step of 1 with global time stepping
+  REQUIRE(summary.ltsSpeedup == AbsApprox(600.0 / 350.0));
+  REQUIRE(summary.imbalance == AbsApprox(200.0 / 175.0 - 1.0));
+  REQUIRE(summary.communicatedBytes == AbsApprox(10.0));
+  REQUIRE(summary.maxCommunicatedBytes == AbsApprox(8.0));
+  REQUIRE(summary.timePerSimulatedSecond == AbsApprox(2.0).epsilon(1e-12));
+
+  REQUIRE(seissol::StartupEstimate::summarize({first.sample()}, 0.0).timePerSimulatedSecond == 0.0);
+}
+} // namespace seissol::unit_test
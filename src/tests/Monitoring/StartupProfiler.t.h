@@ -0,0 +1,35 @@
+#include <string>
+#include <vector>
+
+#include "Monitoring/StartupProfiler.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Startup profiler report") {
+  std::vector<seissol::StartupProfile> profiles(2);
+  profiles[0] = {{1.0, 3.0}, {1024.0, 4096.0}, {100.0}};
+  profiles[1] = {{1.0, 5.0}, {2048.0, 8192.0}, {300.0}};
+
+  const std::string json = seissol::StartupProfiler::formatJson({"mesh", "material"}, {"dofs"}, profiles);
+  REQUIRE(json == "{\n"
+                  "  \"ranks\": 2,\n"
+                  "  \"wall_time\": 6,\n"
+                  "  \"phases\": [\n"
+                  "    {\"name\": \"mesh\", \"wall_time\": {\"min\": 1, \"mean\": 1, \"max\": 1}, \"imbalance\": 0, "
+                  "\"memory_high_water_mark\": {\"min\": 1024, \"mean\": 1536, \"max\": 2048}, \"per_rank\": [1, 1]},\n"
+                  "    {\"name\": \"material\", \"wall_time\": {\"min\": 3, \"mean\": 4, \"max\": 5}, \"imbalance\": 0.25, "
+                  "\"memory_high_water_mark\": {\"min\": 4096, \"mean\": 6144, \"max\": 8192}, \"per_rank\": [3, 5]}\n"
+                  "  ],\n"
+                  "  \"memory\": [\n"
+                  "    {\"name\": \"dofs\", \"bytes\": {\"min\": 100, \"mean\": 200, \"max\": 300}, \"per_rank\": [100, 300]}\n"
+                  "  ]\n"
+                  "}\n");
+}
+
+TEST_CASE("Startup profiler memory high-water mark") {
+  const auto before = seissol::StartupProfiler::memoryHighWaterMark();
+  REQUIRE(before > 0);
+  std::vector<char> memory(64 * 1024 * 1024, 1);
+  REQUIRE(seissol::StartupProfiler::memoryHighWaterMark() >= before);
+}
+} // namespace seissol::unit_test
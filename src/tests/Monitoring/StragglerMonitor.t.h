@@ -0,0 +1,31 @@
+#include "Monitoring/StragglerMonitor.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Straggler monitor") {
+  SUBCASE("Threshold") {
+    REQUIRE(!seissol::StragglerMonitor::isStraggler(1.2, 1.0, 0.25));
+    REQUIRE(seissol::StragglerMonitor::isStraggler(1.3, 1.0, 0.25));
+    REQUIRE(!seissol::StragglerMonitor::isStraggler(1.0, 0.0, 0.25));
+  }
+
+  SUBCASE("Time per cell update since the last comparison") {
+    seissol::StragglerMonitor monitor(2, 0.25);
+    REQUIRE(monitor.enabled());
+    REQUIRE(!monitor.check(1.0, 100.0));
+    REQUIRE(monitor.timePerCellUpdate() == 0.0);
+    // a single rank is never slower than the mean
+    REQUIRE(!monitor.check(3.0, 300.0));
+    REQUIRE(monitor.timePerCellUpdate() == AbsApprox(0.01));
+    REQUIRE(!monitor.check(4.0, 400.0));
+    REQUIRE(!monitor.check(7.0, 500.0));
+    REQUIRE(monitor.timePerCellUpdate() == AbsApprox(0.02));
+  }
+
+  SUBCASE("Disabled") {
+    seissol::StragglerMonitor monitor(0, 0.25);
+    REQUIRE(!monitor.enabled());
+    REQUIRE(!monitor.check(1.0, 100.0));
+  }
+}
+} // namespace seissol::unit_test
@@ -0,0 +1,36 @@
+#include <string>
+
+#include "Monitoring/Telemetry.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Telemetry in the OpenMetrics format") {
+  seissol::TelemetrySample previous;
+  previous.wallTime = 1.0;
+  previous.cellUpdates = 100.0;
+  previous.hardwareFlops = 1e9;
+
+  seissol::TelemetrySample sample;
+  sample.simulationTime = 0.5;
+  sample.wallTime = 3.0;
+  sample.regions = {"computeLocalIntegration"};
+  sample.timePerCluster = {{1.5, 0.25}};
+  sample.cellUpdates = 300.0;
+  sample.hardwareFlops = 5e9;
+  sample.outputTime = 0.125;
+
+  const std::string text = seissol::Telemetry::format(sample, previous, 2.0, 3);
+
+  auto contains = [&text](const std::string& line) { return text.find(line + "\n") != std::string::npos; };
+  REQUIRE(contains("# TYPE seissol_region_time_seconds counter"));
+  REQUIRE(contains("seissol_simulation_time_seconds{rank=\"3\"} 0.5"));
+  REQUIRE(contains("seissol_sample_age_seconds{rank=\"3\"} 2"));
+  REQUIRE(contains("seissol_region_time_seconds_total{rank=\"3\",region=\"computeLocalIntegration\",cluster=\"1\"} 0.25"));
+  REQUIRE(contains("seissol_cell_updates_total{rank=\"3\"} 300"));
+  REQUIRE(contains("seissol_cell_updates_per_second{rank=\"3\"} 100"));
+  REQUIRE(contains("seissol_gflops{rank=\"3\"} 2"));
+  REQUIRE(contains("seissol_output_seconds_total{rank=\"3\"} 0.125"));
+  REQUIRE(text.size() >= 6);
+  REQUIRE(text.substr(text.size() - 6) == "# EOF\n");
+}
+} // namespace seissol::unit_test
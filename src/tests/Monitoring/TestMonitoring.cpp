@@ -0,0 +1,12 @@
+#include "doctest.h"
+#include "tests/TestHelper.h"
+
+#include "ActorStateStatistics.t.h"
+#include "HardwareCounters.t.h"
+#include "RegionCommunication.t.h"
+#include "Roofline.t.h"
+#include "ScalingReport.t.h"
+#include "StartupEstimate.t.h"
+#include "StartupProfiler.t.h"
+#include "StragglerMonitor.t.h"
+#include "Telemetry.t.h"
@@ -114,6 +114,47 @@ TEST_CASE("Test ODE Solver") {
     REQUIRE(curU[0] == AbsApprox(uShould[0]).epsilon(eps));
     REQUIRE(curU[1] == AbsApprox(uShould[1]).epsilon(eps));
   }
+  SUBCASE("Test adaptive integration") {
+    constexpr auto sizeSolution = 3;
+
+    alignas(ALIGNMENT) real curUSolution[sizeSolution] = {};
+
+    auto curU = seissol::ode::ODEVector{{curUSolution}, {sizeSolution}};
+
+    // Setup ODE solver, the initial time step is far too large on purpose
+    const auto timeSpan = seissol::ode::TimeSpan{0, 2};
+    auto odeSolverConfig = seissol::ode::ODESolverConfig(1.0);
+    odeSolverConfig.solver = seissol::ode::RungeKuttaVariant::RK5_DormandPrince;
+    odeSolverConfig.adaptive = true;
+#ifdef SINGLE_PRECISION
+    odeSolverConfig.absoluteTolerance = 1e-6;
+    odeSolverConfig.relativeTolerance = 1e-6;
+#endif
+
+    auto solver = seissol::ode::RungeKuttaODESolver({sizeSolution}, odeSolverConfig);
+    auto f = [&](seissol::ode::ODEVector& du, seissol::ode::ODEVector& u, double time) {
+      // Independent systems with different rates, f(x)' = k f(x) and f(0) = 1
+      for (int i = 0; i < sizeSolution; ++i) {
+        du[i] = (i + 1) * u[i];
+      }
+    };
+    for (int i = 0; i < sizeSolution; ++i) {
+      curUSolution[i] = 1.0;
+    }
+
+    solver.solve(f, curU, timeSpan);
+    for (int i = 0; i < sizeSolution; ++i) {
+      const double uShould = std::exp((i + 1) * timeSpan.end);
+      REQUIRE(curUSolution[i] ==
+              AbsApprox(uShould).epsilon(1e3 * odeSolverConfig.relativeTolerance * uShould));
+    }
+  }
+  SUBCASE("Adaptive integration requires an error estimate") {
+    auto odeSolverConfig = seissol::ode::ODESolverConfig(0.1);
+    odeSolverConfig.solver = seissol::ode::RungeKuttaVariant::RK4;
+    odeSolverConfig.adaptive = true;
+    REQUIRE_THROWS_AS(seissol::ode::RungeKuttaODESolver({1}, odeSolverConfig), std::invalid_argument);
+  }
 }
 
 } // namespace seissol::unit_test
\ No newline at end of file
@@ -41,4 +41,24 @@ TEST_CASE("test triangle quadrature") {
   CHECK(weights[3] == AbsApprox(0.15902069087198858472).epsilon(epsilon));
 }
 
+TEST_CASE("Cached quadrature rules") {
+  double points[4][2];
+  double weights[4];
+  seissol::quadrature::TriangleQuadrature(points, weights, 2);
+  auto const& rule = seissol::quadrature::triangleQuadratureRule<double, 2>();
+  REQUIRE(&rule == &seissol::quadrature::triangleQuadratureRule<double, 2>());
+  for (unsigned i = 0; i < 4; ++i) {
+    CHECK(rule.points[i][0] == points[i][0]);
+    CHECK(rule.points[i][1] == points[i][1]);
+    CHECK(rule.weights[i] == weights[i]);
+  }
+
+  auto const& tetRule = seissol::quadrature::tetrahedronQuadratureRule<3>();
+  double sumWeights = 0.0;
+  for (auto weight : tetRule.weights) {
+    sumWeights += weight;
+  }
+  CHECK(sumWeights == AbsApprox(1.0 / 6.0).epsilon(1e-12));
+}
+
 } // namespace seissol::unit_test
\ No newline at end of file
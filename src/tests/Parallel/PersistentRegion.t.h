@@ -0,0 +1,42 @@
+#include <atomic>
+#include <vector>
+
+#include "Parallel/PersistentRegion.h"
+#include "Parallel/Tasking.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Persistent parallel region") {
+  constexpr unsigned NumberOfCells = 1000;
+  std::vector<int> visits(NumberOfCells, 0);
+  unsigned sum = 0;
+  unsigned emptySum = 1;
+  bool activeInSchedule = false;
+
+  seissol::parallel::PersistentRegion::run([&]() {
+    activeInSchedule = seissol::parallel::PersistentRegion::isActive();
+    // Several loops, such that the threads are released and joined repeatedly
+    for (int repetition = 0; repetition < 3; ++repetition) {
+      seissol::parallel::forEachCell(NumberOfCells, [&](unsigned cell) { ++visits[cell]; });
+    }
+    sum = seissol::parallel::sumOverCells(NumberOfCells, [](unsigned cell) { return cell % 2; });
+    emptySum = seissol::parallel::sumOverCells(0, [](unsigned) { return 1u; });
+  });
+
+  REQUIRE(activeInSchedule);
+  REQUIRE(!seissol::parallel::PersistentRegion::isActive());
+  for (const int visit : visits) {
+    REQUIRE(visit == 3);
+  }
+  REQUIRE(sum == NumberOfCells / 2);
+  REQUIRE(emptySum == 0);
+
+  // A second region starts from the generation left by the first one
+  std::atomic<unsigned> count{0};
+  seissol::parallel::PersistentRegion::run([&]() {
+    seissol::parallel::forEachCell(NumberOfCells, [&](unsigned) { count.fetch_add(1); });
+  });
+  REQUIRE(count.load() == NumberOfCells);
+}
+
+} // namespace seissol::unit_test
@@ -0,0 +1,38 @@
+#include <vector>
+
+#include "Parallel/Pin.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Placement of the OpenMP workers") {
+  using seissol::parallel::Pinning;
+  // 8 cores with two SMT siblings each
+  std::vector<std::vector<int>> cores;
+  for (int core = 0; core < 8; ++core) {
+    cores.push_back({core, core + 8});
+  }
+
+  SUBCASE("One core per worker") {
+    const auto placement = Pinning::computePlacement(cores, 1, 2, 3, 1);
+    REQUIRE(placement.workers == std::vector<std::vector<int>>{{4, 12}, {5, 13}, {6, 14}});
+    REQUIRE(placement.free == std::vector<int>{7, 15});
+  }
+
+  SUBCASE("Reserved cores are spread over the block") {
+    const auto placement = Pinning::computePlacement(cores, 0, 1, 4, 2);
+    REQUIRE(placement.workers == std::vector<std::vector<int>>{{0, 8}, {1, 9}, {4, 12}, {5, 13}});
+    REQUIRE(placement.free == std::vector<int>{3, 11, 7, 15});
+  }
+
+  SUBCASE("SMT siblings") {
+    const auto placement = Pinning::computePlacement(cores, 1, 2, 6, 1);
+    REQUIRE(placement.workers == std::vector<std::vector<int>>{{4}, {12}, {5}, {13}, {6}, {14}});
+  }
+
+  SUBCASE("More ranks than cores") {
+    const auto placement = Pinning::computePlacement(cores, 9, 10, 1, 1);
+    REQUIRE(placement.workers == std::vector<std::vector<int>>{{1, 9}});
+    REQUIRE(placement.free.empty());
+  }
+}
+} // namespace seissol::unit_test
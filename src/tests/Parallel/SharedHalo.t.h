@@ -0,0 +1,33 @@
+#include <cstdint>
+#include <vector>
+
+#include "Parallel/SharedHalo.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Handshake of the shared memory ghost layer exchange") {
+  using namespace seissol::parallel;
+  constexpr unsigned Size = 5;
+  // a slot followed by its data
+  std::vector<SharedHaloSlot> memory(1 + (Size * sizeof(real) + sizeof(SharedHaloSlot) - 1) / sizeof(SharedHaloSlot));
+  SharedHaloSlot& slot = memory[0];
+  std::vector<real> copyRegion(Size);
+  std::vector<real> ghostRegion(Size, 0.0);
+
+  // nothing published yet
+  REQUIRE_FALSE(tryConsume(slot, 1, ghostRegion.data(), Size));
+
+  for (std::uint64_t message = 1; message <= 3; ++message) {
+    for (unsigned i = 0; i < Size; ++i) {
+      copyRegion[i] = static_cast<real>(10 * message + i);
+    }
+    REQUIRE(tryPublish(slot, message, copyRegion.data(), Size));
+    // the next message has to wait until this one is consumed
+    REQUIRE_FALSE(tryPublish(slot, message + 1, copyRegion.data(), Size));
+    REQUIRE(tryConsume(slot, message, ghostRegion.data(), Size));
+    REQUIRE(ghostRegion == copyRegion);
+    REQUIRE_FALSE(tryConsume(slot, message + 1, ghostRegion.data(), Size));
+  }
+}
+
+} // namespace seissol::unit_test
@@ -0,0 +1,6 @@
+#include "doctest.h"
+#include "tests/TestHelper.h"
+
+#include "Placement.t.h"
+#include "SharedHalo.t.h"
+#include "PersistentRegion.t.h"
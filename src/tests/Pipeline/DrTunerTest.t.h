@@ -45,5 +45,33 @@ TEST_CASE("Dr tuner") {
     }
     REQUIRE(batchSize == AbsApprox(midPoint).epsilon(eps));
   }
+
+  SUBCASE("Limited by the number of faces") {
+    constexpr static size_t NumberOfFaces{200};
+    tuner.setNumberOfFaces(NumberOfFaces);
+    REQUIRE(tuner.getMaxBatchSize() == NumberOfFaces);
+
+    auto hyperbolicTime = [](size_t x) { return 1.0 / (static_cast<double>(x + 1.0)); };
+
+    while (!tuner.isTunerConverged()) {
+      batchSize = tuner.getBatchSize();
+      REQUIRE(batchSize <= NumberOfFaces);
+      timing[ComputeStageId] = hyperbolicTime(batchSize);
+      tuner.tune(timing);
+    }
+  }
+
+  SUBCASE("Fewer faces than the min batch size") {
+    tuner.setNumberOfFaces(1);
+    REQUIRE(tuner.isTunerConverged());
+    REQUIRE(tuner.getBatchSize() == 1);
+  }
+
+  SUBCASE("Fixed batch size") {
+    tuner.setBatchSize(512.0);
+    REQUIRE(tuner.isTunerConverged());
+    tuner.tune(timing);
+    REQUIRE(tuner.getBatchSize() == 512);
+  }
 };
 } // namespace seissol::unit_test
@@ -0,0 +1,35 @@
+#include "Solver/Pipeline/HostStaging.h"
+#include <vector>
+
+namespace seissol::unit_test {
+
+TEST_CASE("Host staging") {
+  constexpr std::size_t CellSize{3};
+  constexpr std::size_t NumberOfCells{2 * HostStaging::Pipeline::DefaultBatchSize + 5};
+  std::vector<real> source(NumberOfCells * CellSize);
+  for (std::size_t i = 0; i < source.size(); ++i) {
+    source[i] = static_cast<real>(i);
+  }
+
+  HostStaging staging;
+  std::size_t nextCell{0};
+  bool valuesMatch{true};
+  staging.stage(source.data(), NumberOfCells, CellSize, [&](const real* cells, std::size_t begin, std::size_t end) {
+    // The batches arrive in order and without gaps
+    REQUIRE(begin == nextCell);
+    REQUIRE(end > begin);
+    for (std::size_t i = 0; i < (end - begin) * CellSize; ++i) {
+      valuesMatch = valuesMatch && cells[i] == source[begin * CellSize + i];
+    }
+    nextCell = end;
+  });
+  REQUIRE(nextCell == NumberOfCells);
+  REQUIRE(valuesMatch);
+
+  SUBCASE("No cells") {
+    bool called{false};
+    staging.stage(source.data(), 0, CellSize, [&](const real*, std::size_t, std::size_t) { called = true; });
+    REQUIRE(!called);
+  }
+}
+} // namespace seissol::unit_test
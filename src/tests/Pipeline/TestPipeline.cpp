@@ -3,3 +3,4 @@
 
 #include "PipelineTest.t.h"
 #include "DrTunerTest.t.h"
+#include "HostStagingTest.t.h"
@@ -8,8 +8,15 @@
 
 namespace seissol::unit_test {
 TEST_CASE("NRF Reader") {
+  seissol::sourceterm::NRFReader reader("Testing/source_loh.nrf");
+  REQUIRE(reader.numberOfSources() == 1);
+
+  Eigen::Vector3d centre;
+  reader.readCentres(&centre);
+  REQUIRE(centre(2) == AbsApprox(2000.0));
+
   seissol::sourceterm::NRF nrf;
-  seissol::sourceterm::readNRF("Testing/source_loh.nrf", nrf);
+  reader.readSubfaults({0}, nrf);
 
   REQUIRE(nrf.centres[0](0) == AbsApprox(0.0));
   REQUIRE(nrf.centres[0](1) == AbsApprox(0.0));
@@ -42,4 +49,15 @@ TEST_CASE("NRF Reader") {
     }
   }
 }
+
+TEST_CASE("NRF Reader without local subfaults") {
+  seissol::sourceterm::NRFReader reader("Testing/source_loh.nrf");
+  seissol::sourceterm::NRF nrf;
+  reader.readSubfaults({}, nrf);
+
+  REQUIRE(nrf.source == 0);
+  for (size_t dim = 0; dim < 3; dim++) {
+    REQUIRE(nrf.sroffsets[0][dim] == 0);
+  }
+}
 } // namespace seissol::unit_test
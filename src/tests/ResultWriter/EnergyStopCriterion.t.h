@@ -0,0 +1,33 @@
+#include <vector>
+
+#include "ResultWriter/EnergyStopCriterion.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Energy stop criterion") {
+  SUBCASE("Disabled") {
+    seissol::writer::EnergyStopCriterion criterion;
+    REQUIRE(!criterion.isEnabled());
+    REQUIRE(!criterion.shouldStop(0.0, 0.0, 0.0));
+  }
+
+  SUBCASE("Kinetic energy and slip rate") {
+    seissol::writer::EnergyStopCriterion criterion(1.0, 1e-3, 0.2);
+    REQUIRE(criterion.isEnabled());
+    // not armed before the event, event, decay, slip continues, coda
+    const std::vector<double> kineticEnergies = {0.0, 0.0, 5.0, 0.5, 0.5, 0.5, 0.1, 0.1, 0.1};
+    const std::vector<double> slipRates = {0.0, 0.0, 1.0, 0.0, 0.1, 0.0, 0.0, 0.0, 0.0};
+    const std::vector<bool> expected = {false, false, false, false, false, false, false, true, true};
+    for (unsigned i = 0; i < expected.size(); ++i) {
+      REQUIRE(criterion.shouldStop(0.1 * i, kineticEnergies[i], slipRates[i]) == expected[i]);
+    }
+  }
+
+  SUBCASE("Without slip rate threshold") {
+    seissol::writer::EnergyStopCriterion criterion(1.0);
+    REQUIRE(!criterion.shouldStop(0.0, 2.0, 100.0));
+    REQUIRE(criterion.shouldStop(1.0, 0.5, 100.0));
+  }
+}
+
+} // namespace seissol::unit_test
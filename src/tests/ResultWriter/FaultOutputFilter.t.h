@@ -0,0 +1,60 @@
+#include <stdexcept>
+#include <vector>
+
+#include "ResultWriter/FaultOutputFilter.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Parses the fault output mode") {
+  REQUIRE(seissol::writer::parseFaultOutputMode("all") == seissol::writer::FaultOutputMode::All);
+  REQUIRE(seissol::writer::parseFaultOutputMode("trigger") == seissol::writer::FaultOutputMode::Trigger);
+  REQUIRE(seissol::writer::parseFaultOutputMode("peaks") == seissol::writer::FaultOutputMode::Peaks);
+  CHECK_THROWS_AS(seissol::writer::parseFaultOutputMode("max"), std::runtime_error);
+}
+
+TEST_CASE("Fault output trigger") {
+  const std::vector<real> slipRate1 = {0.0, 3.0, -0.5};
+  const std::vector<real> slipRate2 = {0.0, 4.0, 0.0};
+  REQUIRE(seissol::writer::maxSlipRate(slipRate1.data(), slipRate2.data(), 3) == AbsApprox(5.0));
+
+  SUBCASE("Without quiescent output") {
+    seissol::writer::FaultOutputTrigger trigger(1e-3, 0.0);
+    // first output, quiescence, event, first output after the event, quiescence
+    const std::vector<double> slipRates = {0.0, 1e-6, 1e-2, 1.0, 1e-4, 1e-6, 1e-6};
+    const std::vector<bool> expected = {true, false, true, true, true, false, false};
+    for (unsigned i = 0; i < slipRates.size(); ++i) {
+      REQUIRE(trigger.shouldWrite(i, slipRates[i]) == expected[i]);
+    }
+  }
+
+  SUBCASE("With quiescent output") {
+    seissol::writer::FaultOutputTrigger trigger(1e-3, 3.0);
+    const std::vector<bool> expected = {true, false, false, true, false, false, true};
+    for (unsigned i = 0; i < expected.size(); ++i) {
+      REQUIRE(trigger.shouldWrite(i, 0.0) == expected[i]);
+    }
+  }
+}
+
+TEST_CASE("Fault peaks") {
+  seissol::writer::FaultPeaks peaks;
+  peaks.init(2, 1.0);
+
+  std::vector<real> slipRate1 = {0.0, 0.0};
+  std::vector<real> slipRate2 = {0.0, 0.0};
+  peaks.update(0.0, slipRate1.data(), slipRate2.data());
+  slipRate1[0] = 0.5;
+  peaks.update(1.0, slipRate1.data(), slipRate2.data());
+  // The threshold is reached at t = 1.5
+  slipRate1[0] = 1.5;
+  peaks.update(2.0, slipRate1.data(), slipRate2.data());
+  slipRate1[0] = 0.0;
+  slipRate2[1] = 0.25;
+  peaks.update(3.0, slipRate1.data(), slipRate2.data());
+
+  REQUIRE(peaks.peakSlipRate()[0] == AbsApprox(1.5));
+  REQUIRE(peaks.peakSlipRate()[1] == AbsApprox(0.25));
+  REQUIRE(peaks.ruptureTime()[0] == AbsApprox(1.5));
+  REQUIRE(peaks.ruptureTime()[1] == AbsApprox(-1.0));
+}
+} // namespace seissol::unit_test
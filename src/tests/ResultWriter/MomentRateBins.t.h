@@ -0,0 +1,44 @@
+#include <vector>
+
+#include "ResultWriter/MomentRateBins.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Moment rate bins") {
+  seissol::writer::MomentRateBins bins(0.5, 2);
+  REQUIRE(bins.numberOfBins() == 0);
+
+  // A time step within the first interval
+  const double first[2] = {1.0, 2.0};
+  bins.add(0.1, 0.3, first);
+  REQUIRE(bins.numberOfBins() == 1);
+  REQUIRE(bins.momentRate(0, 0) == AbsApprox(2.0));
+  REQUIRE(bins.momentRate(0, 1) == AbsApprox(4.0));
+
+  // A time step over three intervals, a quarter of it in the second one
+  const double second[2] = {4.0, 0.0};
+  bins.add(0.75, 1.75, second);
+  REQUIRE(bins.numberOfBins() == 4);
+  REQUIRE(bins.momentRate(0, 0) == AbsApprox(2.0));
+  REQUIRE(bins.momentRate(1, 0) == AbsApprox(2.0));
+  REQUIRE(bins.momentRate(2, 0) == AbsApprox(4.0));
+  REQUIRE(bins.momentRate(3, 0) == AbsApprox(2.0));
+  REQUIRE(bins.momentRate(3, 1) == AbsApprox(0.0));
+
+  // A time step ending at the end of an interval does not add an empty one
+  bins.add(1.75, 2.0, second);
+  REQUIRE(bins.numberOfBins() == 4);
+  REQUIRE(bins.momentRate(3, 0) == AbsApprox(10.0));
+
+  bins.resize(6);
+  REQUIRE(bins.numberOfBins() == 6);
+  REQUIRE(bins.momentRate(5, 0) == AbsApprox(0.0));
+
+  double total = 0.0;
+  for (std::size_t bin = 0; bin < bins.numberOfBins(); ++bin) {
+    total += bins.momentRate(bin, 0) * bins.interval();
+  }
+  REQUIRE(total == AbsApprox(9.0));
+}
+
+} // namespace seissol::unit_test
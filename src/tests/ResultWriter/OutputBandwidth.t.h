@@ -0,0 +1,19 @@
+#include "ResultWriter/OutputBandwidth.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Output bandwidth recommends the number of I/O ranks") {
+  using seissol::writer::OutputBandwidth;
+
+  // 1 GiB/s with 400 MiB/s per I/O rank and half of the time for writing
+  REQUIRE(OutputBandwidth::recommendedExecutors(1024.0, 400.0, 2.0) == 6);
+  REQUIRE(OutputBandwidth::recommendedExecutors(1024.0, 1024.0, 1.0) == 1);
+  REQUIRE(OutputBandwidth::recommendedExecutors(1025.0, 1024.0, 1.0) == 2);
+
+  SUBCASE("At least one I/O rank") {
+    REQUIRE(OutputBandwidth::recommendedExecutors(1.0, 1024.0, 2.0) == 1);
+    REQUIRE(OutputBandwidth::recommendedExecutors(0.0, 1024.0, 2.0) == 1);
+    REQUIRE(OutputBandwidth::recommendedExecutors(1024.0, 0.0, 2.0) == 1);
+  }
+}
+} // namespace seissol::unit_test
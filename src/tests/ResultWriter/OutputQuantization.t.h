@@ -0,0 +1,57 @@
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include "ResultWriter/OutputQuantization.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Parses output error bounds") {
+  const auto bounds = seissol::writer::parseErrorBounds("u:abs=1e-6,sigma_xx:rel=0.001,*:rel=1e-2");
+  REQUIRE(bounds.size() == 3);
+  REQUIRE(bounds[0].first == "u");
+  REQUIRE(bounds[0].second.type == seissol::writer::ErrorBound::Type::Absolute);
+  REQUIRE(bounds[0].second.value == AbsApprox(1e-6));
+
+  REQUIRE(seissol::writer::findErrorBound(bounds, "sigma_xx").value == AbsApprox(1e-3));
+  REQUIRE(seissol::writer::findErrorBound(bounds, "u_m12").type == seissol::writer::ErrorBound::Type::Absolute);
+  REQUIRE(seissol::writer::findErrorBound(bounds, "w").value == AbsApprox(1e-2));
+  REQUIRE(seissol::writer::findErrorBound({}, "w").type == seissol::writer::ErrorBound::Type::None);
+
+  CHECK_THROWS_AS(seissol::writer::parseErrorBounds("u=1e-6"), std::runtime_error);
+  CHECK_THROWS_AS(seissol::writer::parseErrorBounds("u:max=1e-6"), std::runtime_error);
+  CHECK_THROWS_AS(seissol::writer::parseErrorBounds("u:abs=-1"), std::runtime_error);
+  CHECK_THROWS_AS(seissol::writer::parseErrorBounds("u:abs=1e-6x"), std::runtime_error);
+}
+
+TEST_CASE("Quantization respects the error bounds") {
+  std::vector<double> values;
+  for (int i = -500; i < 500; ++i) {
+    values.push_back(std::sin(0.37 * i) * std::pow(10.0, (i % 7) - 3));
+  }
+  std::vector<double> quantized(values.size());
+
+  seissol::writer::ErrorBound absolute{seissol::writer::ErrorBound::Type::Absolute, 1e-4};
+  seissol::writer::quantize(values.data(), quantized.data(), values.size(), absolute);
+  for (unsigned i = 0; i < values.size(); ++i) {
+    REQUIRE(std::abs(quantized[i] - values[i]) <= 1e-4 * (1.0 + 1e-12));
+  }
+
+  for (double relativeBound : {0.1, 1e-3, 1e-6}) {
+    seissol::writer::ErrorBound relative{seissol::writer::ErrorBound::Type::Relative, relativeBound};
+    seissol::writer::quantize(values.data(), quantized.data(), values.size(), relative);
+    for (unsigned i = 0; i < values.size(); ++i) {
+      REQUIRE(std::abs(quantized[i] - values[i]) <= relativeBound * std::abs(values[i]));
+    }
+  }
+
+  std::vector<float> single = {1.0f, -3.14159f, 1e-20f, INFINITY};
+  std::vector<float> singleQuantized(single.size());
+  seissol::writer::ErrorBound relative{seissol::writer::ErrorBound::Type::Relative, 1e-2};
+  seissol::writer::quantize(single.data(), singleQuantized.data(), single.size(), relative);
+  for (unsigned i = 0; i < 3; ++i) {
+    REQUIRE(std::abs(singleQuantized[i] - single[i]) <= 1e-2f * std::abs(single[i]));
+  }
+  REQUIRE(std::isinf(singleQuantized[3]));
+}
+} // namespace seissol::unit_test
@@ -0,0 +1,34 @@
+#include <cstdlib>
+#include <vector>
+
+#include "ResultWriter/OutputQueue.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Output queue writes the snapshots in order") {
+  setenv("SEISSOL_OUTPUT_SNAPSHOTS", "2", 1);
+  seissol::writer::OutputQueue queue;
+  REQUIRE(queue.enabled());
+
+  std::vector<double> written;
+  for (unsigned step = 0; step < 10; ++step) {
+    std::vector<double> buffer = {1.0 * step, 2.0 * step};
+    queue.submitSnapshot(std::vector<double const*>{buffer.data()},
+                         std::vector<std::size_t>{buffer.size()},
+                         [&written](std::vector<double const*> const& data, std::vector<std::size_t> const& sizes) {
+                           written.insert(written.end(), data[0], data[0] + sizes[0]);
+                         });
+    // The snapshot must not depend on the buffer after submitting it
+    buffer.assign(buffer.size(), -1.0);
+  }
+  queue.drain();
+
+  REQUIRE(written.size() == 20);
+  for (unsigned step = 0; step < 10; ++step) {
+    REQUIRE(written[2 * step] == 1.0 * step);
+    REQUIRE(written[2 * step + 1] == 2.0 * step);
+  }
+  queue.finalize();
+  unsetenv("SEISSOL_OUTPUT_SNAPSHOTS");
+}
+} // namespace seissol::unit_test
@@ -0,0 +1,33 @@
+#include <stdexcept>
+
+#include "ResultWriter/OutputRegions.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Parses output regions") {
+  const auto region =
+      seissol::writer::parseOutputRegionLine("basin 0.05 1 -1e4 1e4 -2e4 2e4 -5e3 0 u,v,w");
+  REQUIRE(region.name == "basin");
+  REQUIRE(region.interval == AbsApprox(0.05));
+  REQUIRE(region.refinement == 1);
+  REQUIRE(region.bounds[0] == AbsApprox(-1e4));
+  REQUIRE(region.bounds[3] == AbsApprox(2e4));
+  REQUIRE(region.bounds[5] == AbsApprox(0.0));
+  REQUIRE(region.variables == std::vector<std::string>{"u", "v", "w"});
+
+  const auto modal = seissol::writer::parseOutputRegionLine("  fault\t1.0 -1 0 1 0 1 0 1 sigma_xx");
+  REQUIRE(modal.refinement == -1);
+  REQUIRE(modal.variables == std::vector<std::string>{"sigma_xx"});
+
+  CHECK_THROWS_AS(seissol::writer::parseOutputRegionLine("basin 0.05 1 -1e4 1e4 -2e4 2e4 -5e3 0"),
+                  std::runtime_error);
+  CHECK_THROWS_AS(seissol::writer::parseOutputRegionLine("basin 0.05 1 -1e4 1e4 -2e4 2e4 -5e3 0 u v"),
+                  std::runtime_error);
+  CHECK_THROWS_AS(seissol::writer::parseOutputRegionLine("basin 0 1 -1e4 1e4 -2e4 2e4 -5e3 0 u"),
+                  std::runtime_error);
+  CHECK_THROWS_AS(seissol::writer::parseOutputRegionLine("basin 1 1 1e4 -1e4 -2e4 2e4 -5e3 0 u"),
+                  std::runtime_error);
+  CHECK_THROWS_AS(seissol::writer::parseOutputRegionLine("basin 1 1 -1e4 1e4 -2e4 2e4 -5e3 0 u,,v"),
+                  std::runtime_error);
+}
+} // namespace seissol::unit_test
@@ -0,0 +1,122 @@
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include "ResultWriter/PeakGroundMotion.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Parses oscillator periods") {
+  const auto periods = seissol::writer::parseSpectralPeriods("0.1,0.5,2");
+  REQUIRE(periods.size() == 3);
+  REQUIRE(periods[0] == AbsApprox(0.1));
+  REQUIRE(periods[2] == AbsApprox(2.0));
+  REQUIRE(seissol::writer::parseSpectralPeriods("").empty());
+
+  CHECK_THROWS_AS(seissol::writer::parseSpectralPeriods("0.1,,2"), std::runtime_error);
+  CHECK_THROWS_AS(seissol::writer::parseSpectralPeriods("0.1,-1"), std::runtime_error);
+  CHECK_THROWS_AS(seissol::writer::parseSpectralPeriods("1s"), std::runtime_error);
+}
+
+TEST_CASE("Peak ground motion of a harmonic signal") {
+  // v = (A sin(wt), 0, 0) and u = (A (1 - cos(wt)) / w, 0, 0) on the first triangle, zero on the second
+  const double amplitude = 0.3;
+  const double omega = 2.0 * M_PI;
+  const double interval = 1e-4;
+
+  seissol::writer::PeakGroundMotion peaks;
+  peaks.init(2, interval, {});
+  REQUIRE(peaks.numberOfVariables() == 3);
+  REQUIRE(peaks.variableNames()[1] == "PGA");
+
+  std::vector<real> velocity[3], displacement[3];
+  for (unsigned c = 0; c < 3; ++c) {
+    velocity[c].assign(2, 0.0);
+    displacement[c].assign(2, 0.0);
+  }
+  real const* v[3] = {velocity[0].data(), velocity[1].data(), velocity[2].data()};
+  real const* u[3] = {displacement[0].data(), displacement[1].data(), displacement[2].data()};
+  for (unsigned step = 0; step <= 10000; ++step) {
+    const double t = step * interval;
+    velocity[0][0] = amplitude * std::sin(omega * t);
+    displacement[0][0] = amplitude * (1.0 - std::cos(omega * t)) / omega;
+    // The vertical component does not contribute
+    velocity[2][0] = 10.0 * amplitude;
+    peaks.update(v, u);
+  }
+
+  REQUIRE(peaks.data(0)[0] == AbsApprox(amplitude).epsilon(1e-6));
+  REQUIRE(peaks.data(1)[0] == AbsApprox(amplitude * omega).epsilon(1e-3));
+  REQUIRE(peaks.data(2)[0] == AbsApprox(2.0 * amplitude / omega).epsilon(1e-6));
+  for (unsigned variable = 0; variable < 3; ++variable) {
+    REQUIRE(peaks.data(variable)[1] == AbsApprox(0.0));
+  }
+}
+
+TEST_CASE("Spectral acceleration of a step in the ground acceleration") {
+  // A step a0 gives the peak displacement (1 + exp(-xi pi / sqrt(1 - xi^2))) a0 / omega^2
+  const double a0 = 2.0;
+  const double period = 0.5;
+  const double interval = 1e-3;
+  const double xi = seissol::writer::PeakGroundMotion::Damping;
+  const double expected = (1.0 + std::exp(-xi * M_PI / std::sqrt(1.0 - xi * xi))) * a0;
+
+  seissol::writer::PeakGroundMotion peaks;
+  peaks.init(1, interval, {period});
+  REQUIRE(peaks.variableNames()[3] == "SA_0.5s");
+
+  std::vector<real> velocity[3], displacement[3];
+  for (unsigned c = 0; c < 3; ++c) {
+    velocity[c].assign(1, 0.0);
+    displacement[c].assign(1, 0.0);
+  }
+  real const* v[3] = {velocity[0].data(), velocity[1].data(), velocity[2].data()};
+  real const* u[3] = {displacement[0].data(), displacement[1].data(), displacement[2].data()};
+  for (unsigned step = 0; step <= 5000; ++step) {
+    velocity[1][0] = a0 * step * interval;
+    peaks.update(v, u);
+  }
+
+  REQUIRE(peaks.data(1)[0] == AbsApprox(a0).epsilon(1e-2));
+  REQUIRE(peaks.data(3)[0] == AbsApprox(expected).epsilon(1e-2));
+}
+
+TEST_CASE("RotD50 of a linearly polarized signal") {
+  // v = A sin(wt) (cos(30), sin(30), 0): the peak in direction theta is A |cos(theta - 30)|, whose median over
+  // all directions is A cos(45)
+  const double amplitude = 0.3;
+  const double omega = 2.0 * M_PI;
+  const double interval = 1e-3;
+  const double polarization = M_PI / 6.0;
+
+  seissol::writer::PeakGroundMotion peaks;
+  peaks.init(1, interval, {0.5}, 180);
+  const auto names = peaks.variableNames();
+  REQUIRE(peaks.numberOfVariables() == 7);
+  REQUIRE(names[4] == "PGV_RotD50");
+  REQUIRE(names[5] == "PGA_RotD50");
+  REQUIRE(names[6] == "SA_RotD50_0.5s");
+
+  std::vector<real> velocity[3], displacement[3];
+  for (unsigned c = 0; c < 3; ++c) {
+    velocity[c].assign(1, 0.0);
+    displacement[c].assign(1, 0.0);
+  }
+  real const* v[3] = {velocity[0].data(), velocity[1].data(), velocity[2].data()};
+  real const* u[3] = {displacement[0].data(), displacement[1].data(), displacement[2].data()};
+  for (unsigned step = 0; step <= 2000; ++step) {
+    const double t = step * interval;
+    velocity[0][0] = amplitude * std::sin(omega * t) * std::cos(polarization);
+    velocity[1][0] = amplitude * std::sin(omega * t) * std::sin(polarization);
+    peaks.update(v, u);
+  }
+  peaks.finalize();
+
+  const double median = std::cos(M_PI / 4.0);
+  REQUIRE(peaks.data(0)[0] == AbsApprox(amplitude).epsilon(1e-6));
+  REQUIRE(peaks.data(4)[0] == AbsApprox(median * amplitude).epsilon(1e-2));
+  REQUIRE(peaks.data(5)[0] == AbsApprox(median * peaks.data(1)[0]).epsilon(1e-2));
+  // The response of the oscillator has the same polarization; SA is the larger one of the x and y components
+  REQUIRE(peaks.data(6)[0] == AbsApprox(median / std::cos(polarization) * peaks.data(3)[0]).epsilon(1e-2));
+}
+} // namespace seissol::unit_test
@@ -0,0 +1,40 @@
+#include <cstdio>
+#include <fstream>
+
+#include "ResultWriter/ReceiverDatFile.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Receiver dat file") {
+  const std::string fileName = "receiver-dat-file-test-receiver-00012-00003.dat";
+  {
+    std::ofstream stream(fileName);
+    seissol::writer::writeReceiverDatHeader(
+        stream, "Temporal Signal for receiver number 00012", {"u", "v"}, {1.0, -2.5, 3.0});
+    stream << "# P_0 1.5e+06" << std::endl;
+    stream << "0.0 1.0 2.0" << std::endl;
+    stream << "0.1 3.0 4.0" << std::endl;
+    // Restart from a checkpoint at t = 0.1
+    stream << "0.1 3.0 4.0" << std::endl;
+    stream << "0.2 5.0 6.0" << std::endl;
+  }
+
+  const auto receiver = seissol::writer::readReceiverDatFile(fileName);
+  REQUIRE(receiver.title == "Temporal Signal for receiver number 00012");
+  REQUIRE(receiver.variables == std::vector<std::string>{"u", "v"});
+  REQUIRE(receiver.point[0] == AbsApprox(1.0));
+  REQUIRE(receiver.point[1] == AbsApprox(-2.5));
+  REQUIRE(receiver.point[2] == AbsApprox(3.0));
+  REQUIRE(receiver.parameters.size() == 1);
+  REQUIRE(receiver.parameters[0].first == "P_0");
+  REQUIRE(receiver.parameters[0].second == AbsApprox(1.5e6));
+  REQUIRE(receiver.numberOfSamples() == 3);
+  REQUIRE(receiver.times[2] == AbsApprox(0.2));
+  REQUIRE(receiver.values == std::vector<double>{1.0, 2.0, 3.0, 4.0, 5.0, 6.0});
+
+  REQUIRE(seissol::writer::receiverNumberFromFileName(fileName) == 12);
+  REQUIRE(seissol::writer::receiverNumberFromFileName("out/tpv-faultreceiver-00004.dat") == 4);
+  std::remove(fileName.c_str());
+}
+
+} // namespace seissol::unit_test
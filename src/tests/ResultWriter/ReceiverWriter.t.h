@@ -1,4 +1,9 @@
 #include "ResultWriter/ReceiverWriter.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+
 namespace seissol::unit_test {
 
 TEST_CASE("Parses line correctly") {
@@ -29,6 +34,7 @@ TEST_CASE("Throws expected exceptions for incorrect number of columns") {
 
 TEST_CASE("Throws expected exceptions for conversion errors") {
   CHECK_THROWS_AS(seissol::writer::parseReceiverLine("0.1 center 0.3"), std::invalid_argument);
+  CHECK_THROWS_AS(seissol::writer::parseReceiverLine("0.1 0.2m 0.3"), std::invalid_argument);
 
 }
 
@@ -46,4 +52,32 @@ TEST_CASE("Parses receiver file correctly") {
     REQUIRE(points[i] == expectedPoints[i]);
   }
 }
-}
\ No newline at end of file
+
+TEST_CASE("Parses binary receiver file correctly") {
+  const auto receiverFileName = "receiver-binary-test.bin";
+  const auto expectedPoints = std::vector<Eigen::Vector3d>{
+      {1, 0.1, 10},
+      {10, 2, 0.2}
+  };
+  {
+    std::ofstream file(receiverFileName, std::ios::binary);
+    file.write(seissol::writer::BinaryReceiverFileMagic, sizeof(seissol::writer::BinaryReceiverFileMagic));
+    const std::uint64_t numberOfPoints = expectedPoints.size();
+    file.write(reinterpret_cast<const char*>(&numberOfPoints), sizeof(numberOfPoints));
+    for (const auto& point : expectedPoints) {
+      file.write(reinterpret_cast<const char*>(point.data()), 3 * sizeof(double));
+    }
+  }
+
+  const auto points = seissol::writer::parseReceiverFile(receiverFileName);
+  REQUIRE(points.size() == expectedPoints.size());
+  for (auto i = 0u; i < points.size(); ++i) {
+    REQUIRE(points[i] == expectedPoints[i]);
+  }
+
+  const auto truncated = std::vector<char>(seissol::writer::BinaryReceiverFileMagic,
+                                           seissol::writer::BinaryReceiverFileMagic + 8);
+  CHECK_THROWS_AS(seissol::writer::parseBinaryReceiverFile(truncated), std::runtime_error);
+  std::remove(receiverFileName);
+}
+}
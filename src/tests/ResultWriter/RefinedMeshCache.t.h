@@ -0,0 +1,34 @@
+#include <cstdio>
+#include <vector>
+
+#include "ResultWriter/RefinedMeshCache.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Refined mesh cache") {
+  const std::string fileName = "refined-mesh-cache-test.bin";
+  std::remove(fileName.c_str());
+  const std::vector<unsigned int> cells = {0, 1, 2, 3, 1, 2, 3, 4};
+  const std::vector<double> vertices = {0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 1};
+
+  seissol::writer::RefinedMeshCache cache(fileName, 42);
+  REQUIRE(!cache.load());
+  REQUIRE(cache.store(cells.data(), 2, vertices.data(), 5));
+
+  seissol::writer::RefinedMeshCache loaded(fileName, 42);
+  REQUIRE(loaded.load());
+  REQUIRE(loaded.numCells() == 2);
+  REQUIRE(loaded.numVertices() == 5);
+  REQUIRE(loaded.cells() == cells);
+  REQUIRE(loaded.vertices() == vertices);
+
+  seissol::writer::RefinedMeshCache otherKey(fileName, 43);
+  REQUIRE(!otherKey.load());
+
+  const int refinement = 3;
+  REQUIRE(seissol::writer::RefinedMeshCache::hash(&refinement, sizeof(refinement)) !=
+          seissol::writer::RefinedMeshCache::hash(&refinement, sizeof(refinement), 1));
+
+  std::remove(fileName.c_str());
+}
+} // namespace seissol::unit_test
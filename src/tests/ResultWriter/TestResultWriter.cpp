@@ -2,4 +2,14 @@
 #include "tests/TestHelper.h"
 
 #include "ReceiverWriter.t.h"
+#include "ReceiverDatFile.t.h"
+#include "OutputQuantization.t.h"
+#include "OutputRegions.t.h"
+#include "RefinedMeshCache.t.h"
+#include "OutputQueue.t.h"
+#include "OutputBandwidth.t.h"
+#include "PeakGroundMotion.t.h"
+#include "FaultOutputFilter.t.h"
+#include "EnergyStopCriterion.t.h"
+#include "MomentRateBins.t.h"
 
@@ -17,6 +17,16 @@ public:
   MAKE_MOCK1(printTimeoutMessage, void(std::chrono::seconds), override);
 };
 
+class FusingMockTimeCluster : public MockTimeCluster {
+public:
+  FusingMockTimeCluster(double maxTimeStepSize,
+                        long timeStepRate) :
+  MockTimeCluster(maxTimeStepSize, timeStepRate) { }
+
+  bool mayCorrectAndPredict() override { return true; }
+  MAKE_MOCK0(correctAndPredict, void(void), override);
+};
+
 
 TEST_CASE("TimeCluster") {
   auto cluster = MockTimeCluster(1.0, 1);
@@ -176,4 +186,74 @@ TEST_CASE("LTS Timesteping works") {
   REQUIRE(cluster2.getState() == ActorState::Synced);
 }
 
+TEST_CASE("Correction and prediction are fused") {
+  const double dt = 1.0;
+  const auto numberOfIterations = 3;
+  const double endTime = dt * numberOfIterations;
+  auto cluster1 = FusingMockTimeCluster(dt, 1);
+  auto cluster2 = FusingMockTimeCluster(dt, 1);
+  auto clusters = std::vector<FusingMockTimeCluster*>{
+      &cluster1,
+      &cluster2,
+  };
+
+  cluster1.connect(cluster2);
+
+  for (auto* cluster : clusters) {
+    cluster->setSyncTime(endTime);
+    cluster->reset();
+  }
+
+  ALLOW_CALL(cluster1, handleAdvancedCorrectionTimeMessage(ANY(NeighborCluster)));
+  ALLOW_CALL(cluster2, handleAdvancedCorrectionTimeMessage(ANY(NeighborCluster)));
+  ALLOW_CALL(cluster1, handleAdvancedPredictionTimeMessage(ANY(NeighborCluster)));
+  ALLOW_CALL(cluster2, handleAdvancedPredictionTimeMessage(ANY(NeighborCluster)));
+
+  for (auto& cluster : clusters) {
+    REQUIRE_CALL(*cluster, start());
+    cluster->act();
+    REQUIRE_CALL(*cluster, predict());
+    cluster->act();
+    REQUIRE(cluster->getState() == ActorState::Predicted);
+  }
+
+  // The second cluster has not corrected yet, i.e. it still reads the prediction of the first one
+  REQUIRE(cluster1.getNextLegalAction() == ActorAction::Correct);
+  REQUIRE_CALL(cluster1, correct());
+  cluster1.act();
+  REQUIRE(cluster1.getState() == ActorState::Corrected);
+
+  REQUIRE(cluster2.getNextLegalAction() == ActorAction::CorrectAndPredict);
+  REQUIRE_CALL(cluster2, correctAndPredict());
+  const auto result = cluster2.act();
+  REQUIRE(result.isStateChanged);
+  REQUIRE(cluster2.getState() == ActorState::Predicted);
+
+  REQUIRE(cluster1.getNextLegalAction() == ActorAction::Predict);
+  REQUIRE_CALL(cluster1, predict());
+  cluster1.act();
+
+  REQUIRE(cluster2.getNextLegalAction() == ActorAction::Correct);
+  REQUIRE_CALL(cluster2, correct());
+  cluster2.act();
+
+  REQUIRE(cluster1.getNextLegalAction() == ActorAction::CorrectAndPredict);
+  REQUIRE_CALL(cluster1, correctAndPredict());
+  cluster1.act();
+
+  REQUIRE(cluster2.getNextLegalAction() == ActorAction::Predict);
+  REQUIRE_CALL(cluster2, predict());
+  cluster2.act();
+
+  // The last correction before the sync point is never fused
+  for (auto& cluster : clusters) {
+    REQUIRE(cluster->getNextLegalAction() == ActorAction::Correct);
+    REQUIRE_CALL(*cluster, correct());
+    cluster->act();
+    REQUIRE(cluster->getNextLegalAction() == ActorAction::Sync);
+    cluster->act();
+    REQUIRE(cluster->synced());
+  }
+}
+
 } // namespace seissol::unit_test
\ No newline at end of file
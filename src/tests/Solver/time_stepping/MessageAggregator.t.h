@@ -0,0 +1,36 @@
+#include <vector>
+
+#include "Solver/time_stepping/MessageAggregator.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Aggregated messages keep the regions and their order") {
+  using namespace seissol::time_stepping;
+  const std::vector<real> first = {1.0, 2.0, 3.0};
+  const std::vector<real> second = {4.0};
+  const std::vector<real> third = {5.0, 6.0};
+
+  AggregatedMessage message;
+  REQUIRE(message.empty());
+  message.append(7, first.data(), first.size());
+  message.append(3, second.data(), second.size());
+  message.append(7, third.data(), third.size());
+  REQUIRE(!message.empty());
+  const auto buffer = message.finish();
+  REQUIRE(message.empty());
+
+  std::vector<int> identifiers;
+  std::vector<std::vector<real>> regions;
+  REQUIRE(AggregatedMessage::unpack(buffer, [&](int identifier, std::vector<real>&& data) {
+    identifiers.push_back(identifier);
+    regions.push_back(data);
+  }));
+  REQUIRE(identifiers == std::vector<int>{7, 3, 7});
+  REQUIRE(regions == std::vector<std::vector<real>>{first, second, third});
+
+  // a truncated message is rejected
+  const std::vector<char> truncated(buffer.begin() + sizeof(real), buffer.end());
+  REQUIRE(!AggregatedMessage::unpack(truncated, [](int, std::vector<real>&&) {}));
+}
+
+} // namespace seissol::unit_test